@@ -0,0 +1,116 @@
+"""
+Esquema de entrada da NEURA9 (GERADO, não editar)
+
+Fonte: ai_training/neura9_features.json
+Gerador: scripts/gen_feature_schema.py
+
+Mesma ordem e normalização de src/ai/neura9_feature_schema.h; quantize()
+reproduz o empacotamento INT8 de NEURA9Inference::predict.
+"""
+
+import numpy as np
+
+FEATURE_COUNT = 56
+NAMED_FEATURES = 37
+
+FEATURE_NAMES = [
+    "rssi_norm",
+    "snr_norm",
+    "beacon_rate",
+    "probereq_rate",
+    "deauth_rate",
+    "assocreq_rate",
+    "eapol_rate",
+    "management_frame_ratio",
+    "data_frame_ratio",
+    "control_frame_ratio",
+    "sequence_gap_score",
+    "retry_flag_ratio",
+    "protected_flag_ratio",
+    "duration_field_avg",
+    "oui_score",
+    "information_elt_hash",
+    "transmission_rate",
+    "channel_switch_rate",
+    "packet_size_avg",
+    "packet_size_std_dev",
+    "wps_frame_ratio",
+    "null_probe_ratio",
+    "broadcast_ratio",
+    "multicast_ratio",
+    "fragment_rate",
+    "max_burst_size",
+    "avg_inter_packet_gap",
+    "gap_variance",
+    "deauth_reason_code_dist",
+    "sequence_number_delta_avg",
+    "iv_reuse_detected",
+    "eapol_start_rate",
+    "eapol_key_rate",
+    "mac_randomness_score",
+    "ssid_entropy",
+    "channel_utilization",
+    "noise_floor_est",
+    "reserved_features_0",
+    "reserved_features_1",
+    "reserved_features_2",
+    "reserved_features_3",
+    "reserved_features_4",
+    "reserved_features_5",
+    "reserved_features_6",
+    "reserved_features_7",
+    "reserved_features_8",
+    "reserved_features_9",
+    "reserved_features_10",
+    "reserved_features_11",
+    "reserved_features_12",
+    "reserved_features_13",
+    "reserved_features_14",
+    "reserved_features_15",
+    "reserved_features_16",
+    "reserved_features_17",
+    "reserved_features_18",
+]
+
+FEATURE_INDEX = {name: i for i, name in enumerate(FEATURE_NAMES)}
+
+FEATURE_GAIN = np.array([
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0,
+], dtype=np.float32)
+
+FEATURE_BIAS = np.array([
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0, 0.0, 0.0, 0.0, 0.0,
+    0.0, 0.0,
+], dtype=np.float32)
+
+
+def normalize(x):
+    """Entrada float do modelo: x * gain + bias (shape [..., FEATURE_COUNT])"""
+    x = np.asarray(x, dtype=np.float32)
+    return x * FEATURE_GAIN + FEATURE_BIAS
+
+
+def quantize(x, scale, zero_point):
+    """Entrada INT8 do modelo, igual ao firmware (arredonda para o par)"""
+    x = np.asarray(x, dtype=np.float32)
+    mul = (FEATURE_GAIN / np.float32(scale)).astype(np.float32)
+    add = (FEATURE_BIAS / np.float32(scale) + np.float32(zero_point)).astype(np.float32)
+    q = np.clip(x * mul + add, -128.0, 127.0)
+    return np.rint(q).astype(np.int8)
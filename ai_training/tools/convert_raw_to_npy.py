@@ -6,8 +6,12 @@ import argparse
 import os
 import numpy as np
 import struct
+import sys
 from pathlib import Path
 
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+from neura9_features import FEATURE_COUNT  # noqa: E402 - gerado do esquema
+
 def parse_args():
     parser = argparse.ArgumentParser(
         description="Converte arquivos .raw salvos pelo LeleWatch em .npy para quantização INT8"
@@ -81,6 +85,10 @@ def main():
             features = struct.unpack_from("<H", data, offset)[0]
             offset += 2
 
+            if features != FEATURE_COUNT:
+                print(f"Pulando {raw_file.name} → {features} features, esquema tem {FEATURE_COUNT}")
+                continue
+
             expected_floats = timesteps * features
             if len(data) < offset + expected_floats * 4:
                 print(f"Pulando {raw_file.name} → dados incompletos")
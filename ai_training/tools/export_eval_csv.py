@@ -0,0 +1,68 @@
+# export_eval_csv.py
+# Exporta um dataset rotulado (.npy) para o CSV lido por NEURA9Inference::evaluate
+# Uso: python export_eval_csv.py neura9_dataset_X.npy neura9_dataset_y.npy
+#
+# Formato: uma linha de cabeçalho (nomes do esquema + "label") e uma amostra
+# por linha, FEATURE_COUNT floats crus (antes da normalização) e o rótulo.
+# Copie o arquivo para a raiz do SD como /neura9_eval.csv.
+
+import argparse
+import sys
+from pathlib import Path
+
+import numpy as np
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+from neura9_features import FEATURE_COUNT, FEATURE_NAMES  # noqa: E402 - gerado do esquema
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Exporta dataset .npy rotulado para CSV de avaliação no LeleWatch"
+    )
+    parser.add_argument("x_path", type=str, help="Arquivo de features (N x F)")
+    parser.add_argument("y_path", type=str, help="Arquivo de rótulos (N)")
+    parser.add_argument(
+        "--output",
+        type=str,
+        default="neura9_eval.csv",
+        help="CSV de saída (default: neura9_eval.csv)"
+    )
+    parser.add_argument(
+        "--max_rows",
+        type=int,
+        default=2000,
+        help="Máximo de amostras (default: 2000, mesmo limite do firmware)"
+    )
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    X = np.load(args.x_path).astype(np.float32)
+    y = np.load(args.y_path).astype(np.int32)
+
+    if X.ndim != 2 or len(X) != len(y):
+        print(f"❌ Formas incompatíveis: X={X.shape} y={y.shape}")
+        sys.exit(1)
+
+    if X.shape[1] != FEATURE_COUNT:
+        # Datasets antigos (ex: sintético de 32 features): completa com zero,
+        # que é o mesmo valor das features reservadas no firmware
+        print(f"⚠️  {X.shape[1]} features != esquema {FEATURE_COUNT}, ajustando com zeros")
+        fixed = np.zeros((len(X), FEATURE_COUNT), dtype=np.float32)
+        n = min(X.shape[1], FEATURE_COUNT)
+        fixed[:, :n] = X[:, :n]
+        X = fixed
+
+    rows = min(len(X), args.max_rows)
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(",".join(FEATURE_NAMES) + ",label\n")
+        for i in range(rows):
+            f.write(",".join(f"{v:.6g}" for v in X[i]) + f",{int(y[i])}\n")
+
+    print(f"✅ {rows} amostras exportadas para {args.output}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+# export_feature_fixture.py
+# Gera o fixture do teste de paridade do empacotamento da NEURA9
+# Uso: python export_feature_fixture.py [--output ../../test/test_neura9_inference/feature_vectors.h]
+#
+# Vetores fixos de features (dentro e fora da faixa do esquema, mais meios
+# degraus exatos para o arredondamento) com a saída de normalize() e
+# quantize() de neura9_features.py em alguns pares escala/zero-point. O teste
+# no host passa os mesmos vetores por computeQuantParams/quantizeFeatures/
+# normalizeFeatures do firmware e exige valores idênticos. Mudou o
+# neura9_features.json, rode de novo.
+
+import argparse
+import sys
+from pathlib import Path
+
+import numpy as np
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+from neura9_features import FEATURE_COUNT, normalize, quantize  # noqa: E402 - gerado do esquema
+
+DEFAULT_OUTPUT = (Path(__file__).resolve().parents[2] / "test" /
+                  "test_neura9_inference" / "feature_vectors.h")
+
+# (escala, zero-point) do tensor de entrada: [0, 1] em INT8, um que satura
+# acima de 1, um arbitrário e um de meio degrau exato (x * 2)
+QUANT_PARAMS = [
+    (1.0 / 255.0, -128),
+    (1.0 / 128.0, 0),
+    (0.01, -50),
+    (0.5, 0),
+]
+
+RANDOM_ROWS = 12
+
+
+def feature_rows(seed=32):
+    """Linhas fixas: aleatórias em [-0,25, 1,25], bordas e múltiplos de 0,25."""
+    rng = np.random.default_rng(seed)
+    rows = [rng.uniform(-0.25, 1.25, FEATURE_COUNT) for _ in range(RANDOM_ROWS)]
+    rows.append(np.zeros(FEATURE_COUNT))
+    rows.append(np.ones(FEATURE_COUNT))
+    rows.append((np.arange(FEATURE_COUNT) % 11) * 0.25 - 1.0)
+    return np.array(rows, dtype=np.float32)
+
+
+def fmt(v):
+    s = repr(float(v))
+    return s + "f" if "e" in s or "." in s else s + ".0f"
+
+
+def c_rows(values, per_line):
+    out = []
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(values[i:i + per_line]) + ",")
+    return out
+
+
+def render(rows):
+    out = []
+    out.append("#pragma once")
+    out.append("/**")
+    out.append(" * @file feature_vectors.h")
+    out.append(" * @brief Empacotamento da NEURA9 no Python para o teste no host (GERADO, não editar)")
+    out.append(" *")
+    out.append(" * Gerador: ai_training/tools/export_feature_fixture.py")
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"#define FEATURE_VECTOR_ROWS {len(rows)}")
+    out.append(f"#define FEATURE_VECTOR_WIDTH {FEATURE_COUNT}")
+    out.append(f"#define FEATURE_QUANT_CASES {len(QUANT_PARAMS)}")
+    out.append("")
+    out.append("struct FeatureQuantCase {")
+    out.append("  float scale;")
+    out.append("  int32_t zeroPoint;")
+    out.append("  const int8_t *expected; // rows x width")
+    out.append("};")
+    out.append("")
+    out.append("// Entrada crua (antes da normalização)")
+    out.append("static const float FEATURE_VECTORS[] = {")
+    out.extend(c_rows([fmt(v) for v in rows.reshape(-1)], 4))
+    out.append("};")
+    out.append("")
+    out.append("// normalize()")
+    out.append("static const float FEATURE_NORMALIZED[] = {")
+    out.extend(c_rows([fmt(v) for v in normalize(rows).reshape(-1)], 4))
+    out.append("};")
+    out.append("")
+
+    entries = []
+    for i, (scale, zp) in enumerate(QUANT_PARAMS):
+        scale = np.float32(scale)
+        q = quantize(rows, scale, zp)
+        out.append(f"// quantize(scale={float(scale)!r}, zero_point={zp})")
+        out.append(f"static const int8_t FEATURE_QUANTIZED_{i}[] = {{")
+        out.extend(c_rows([str(int(v)) for v in q.reshape(-1)], 28))
+        out.append("};")
+        out.append("")
+        entries.append(f"    {{{fmt(scale)}, {zp}, FEATURE_QUANTIZED_{i}}},")
+
+    out.append("static const FeatureQuantCase FEATURE_QUANT[] = {")
+    out.extend(entries)
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Gera o fixture de paridade do empacotamento da NEURA9"
+    )
+    parser.add_argument("--output", type=str, default=str(DEFAULT_OUTPUT),
+                        help="Header de saída (default: test/test_neura9_inference/feature_vectors.h)")
+    args = parser.parse_args()
+
+    rows = feature_rows()
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(render(rows))
+    print(f"✅ {args.output}: {len(rows)} vetores x {len(QUANT_PARAMS)} quantizações")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
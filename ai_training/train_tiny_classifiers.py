@@ -0,0 +1,499 @@
+#!/usr/bin/env python3
+"""
+═══════════════════════════════════════════════════════════════════════════
+WAVEPWN - Tiny Classifiers (Tips 14 e 15)
+Treina árvores de decisão pequenas e gera src/ai/detectors/tiny_models.h
+═══════════════════════════════════════════════════════════════════════════
+
+Modelos:
+  - pmkid: uma árvore (profundidade 4) -> probabilidade do PMKID ser fraco
+  - handshake: stumps com gradient boosting -> qualidade do handshake (0-100)
+
+Sem dependências (Python puro), para rodar em qualquer máquina. Sem --data
+os rótulos vêm das heurísticas antigas do firmware; com dados reais de
+captura/quebra (CSV) o modelo aprende o que de fato funcionou.
+
+O header gerado traz vetores de teste calculados aqui com aritmética float32
+na mesma ordem do avaliador C++; TinyClassifiers::selfTest() confere no boot
+que as predições são idênticas bit a bit. Junto sai um fixture maior para o
+teste no host (test/test_tiny_classifiers): SSID/BSSID crus e parâmetros do
+handshake, com as predições do Python, então o teste cobre também a
+extração de features do firmware (pio test -e native).
+
+Uso:
+  python ai_training/train_tiny_classifiers.py
+  python ai_training/train_tiny_classifiers.py --pmkid-data pmkid.csv
+      (colunas: ssid,bssid,weak  ex: VIVO-8E4A,C8:3A:35:01:02:03,1)
+  python ai_training/train_tiny_classifiers.py --handshake-data hs.csv
+      (colunas: half,anonces,snr,gap_ms,quality)
+"""
+
+import argparse
+import csv
+import os
+import random
+import struct
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+HEADER = os.path.join(ROOT, "src", "ai", "detectors", "tiny_models.h")
+FIXTURE = os.path.join(ROOT, "test", "test_tiny_classifiers", "tiny_vectors.h")
+
+# Split "sempre para a esquerda" usado para completar a árvore
+NO_SPLIT = 3.0e38
+
+PMKID_FEATURES = ["oui", "ssid_len", "digits", "underscore", "dash",
+                  "trailing_hex", "upper"]
+HANDSHAKE_FEATURES = ["half", "anonces", "snr", "gap_ms"]
+
+# OUIs com PMKID/senha padrão previsível (ver heurística antiga)
+WEAK_OUIS = [0x001D60, 0xC83A35]
+OTHER_OUIS = [0x001A2B, 0xF4F26D, 0x14CC20, 0x3C846A, 0x5C628B, 0xA0F3C1,
+              0x00E04C, 0x2C3033, 0xE894F6, 0x7C8BCA]
+
+
+def f32(v):
+    return struct.unpack("<f", struct.pack("<f", v))[0]
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# FEATURES (mesma definição de PmkidFeatures::from no firmware)
+# ═══════════════════════════════════════════════════════════════════════════
+
+def parse_oui(mac):
+    parts = mac.replace("-", ":").split(":")
+    return (int(parts[0], 16) << 16) | (int(parts[1], 16) << 8) | int(parts[2], 16)
+
+
+def pmkid_features(ssid, oui):
+    raw = ssid.encode("utf-8")[:32]
+    trailing = 0
+    for c in reversed(raw):
+        if chr(c) in "0123456789abcdefABCDEF":
+            trailing += 1
+        else:
+            break
+    return [
+        float(oui),
+        float(len(raw)),
+        float(sum(1 for c in raw if 48 <= c <= 57)),
+        float(b"_" in raw),
+        float(b"-" in raw),
+        float(trailing),
+        float(sum(1 for c in raw if 65 <= c <= 90)),
+    ]
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# DATASETS
+# ═══════════════════════════════════════════════════════════════════════════
+
+def legacy_pmkid_label(ssid, oui):
+    # Heurística antiga de TinyClassifiers::isPmkidWeak
+    if oui in WEAK_OUIS:
+        return 1.0
+    if len(ssid) < 5:
+        return 1.0
+    digits = sum(1 for c in ssid if c.isdigit())
+    return 1.0 if digits >= 4 and "_" in ssid else 0.0
+
+
+def synth_ssid(rng):
+    kind = rng.random()
+    if kind < 0.45:
+        prefix = rng.choice(["VIVO-", "NET_2G", "NET_5G", "CLARO_", "OI_",
+                             "TP-LINK_", "HUAWEI-", "Tenda_", "D-Link_"])
+        n = rng.randint(4, 6)
+        return prefix + "".join(rng.choice("0123456789ABCDEF") for _ in range(n))
+    if kind < 0.9:
+        words = ["Casa", "Familia", "Minha", "Rede", "Silva", "Home",
+                 "Escritorio", "Lele", "Wifi", "Apto"]
+        s = " ".join(rng.choice(words) for _ in range(rng.randint(1, 3)))
+        if rng.random() < 0.4:
+            s += rng.choice(["", " ", "_"]) + str(rng.randint(1, 999))
+        return s
+    return "".join(rng.choice("abcXYZ12") for _ in range(rng.randint(1, 4)))
+
+
+def pmkid_dataset(path, rng, n=3000):
+    X, y = [], []
+    if path:
+        with open(path, encoding="utf-8") as f:
+            for row in csv.DictReader(f):
+                X.append(pmkid_features(row["ssid"], parse_oui(row["bssid"])))
+                y.append(float(row["weak"]))
+        return X, y
+    for _ in range(n):
+        oui = rng.choice(WEAK_OUIS) if rng.random() < 0.15 else rng.choice(OTHER_OUIS)
+        ssid = synth_ssid(rng)
+        X.append(pmkid_features(ssid, oui))
+        y.append(legacy_pmkid_label(ssid, oui))
+    return X, y
+
+
+def legacy_handshake_score(half, anonces, snr, gap):
+    # Heurística antiga de TinyClassifiers::predictHandshakeStrength
+    score = 0
+    if half >= 1:
+        score += 50
+    if half >= 2:
+        score += 30
+    if anonces > 0:
+        score += 10
+    if snr > -60:
+        score += 10
+    elif snr > -80:
+        score += 5
+    if gap > 500:
+        score -= 20
+    return float(max(0, min(100, score)))
+
+
+def handshake_dataset(path, rng, n=3000):
+    X, y = [], []
+    if path:
+        with open(path, encoding="utf-8") as f:
+            for row in csv.DictReader(f):
+                X.append([float(row[k]) for k in HANDSHAKE_FEATURES])
+                y.append(float(row["quality"]))
+        return X, y
+    for _ in range(n):
+        half = rng.randint(0, 3)
+        anonces = rng.randint(0, 3)
+        snr = rng.randint(-95, -30)
+        gap = rng.randint(0, 1000)
+        X.append([float(half), float(anonces), float(snr), float(gap)])
+        y.append(legacy_handshake_score(half, anonces, snr, gap))
+    return X, y
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# CART (regressão, erro quadrático) - serve para 0/1 também (= Gini)
+# ═══════════════════════════════════════════════════════════════════════════
+
+def best_split(X, y, idx, min_leaf):
+    best = None
+    total = sum(y[i] for i in idx)
+    total_sq = sum(y[i] * y[i] for i in idx)
+    n = len(idx)
+    base = total_sq - total * total / n
+    for f in range(len(X[0])):
+        order = sorted(idx, key=lambda i: X[i][f])
+        s = sq = 0.0
+        for k in range(n - 1):
+            i = order[k]
+            s += y[i]
+            sq += y[i] * y[i]
+            left = k + 1
+            if left < min_leaf or n - left < min_leaf:
+                continue
+            a, b = X[i][f], X[order[k + 1]][f]
+            if a == b:
+                continue
+            sse = (sq - s * s / left) + (total_sq - sq - (total - s) ** 2 / (n - left))
+            if best is None or sse < best[0] - 1e-9:
+                best = (sse, f, f32((a + b) / 2.0))
+    if best is None or best[0] >= base - 1e-9:
+        return None
+    return best[1], best[2]
+
+
+def fit_tree(X, y, idx, depth, min_leaf=8):
+    value = sum(y[i] for i in idx) / len(idx)
+    if depth == 0 or len(idx) < 2 * min_leaf:
+        return {"leaf": value}
+    split = best_split(X, y, idx, min_leaf)
+    if split is None:
+        return {"leaf": value}
+    f, t = split
+    left = [i for i in idx if X[i][f] <= t]
+    right = [i for i in idx if X[i][f] > t]
+    return {"f": f, "t": t,
+            "l": fit_tree(X, y, left, depth - 1, min_leaf),
+            "r": fit_tree(X, y, right, depth - 1, min_leaf)}
+
+
+def predict_tree(node, x):
+    while "leaf" not in node:
+        node = node["l"] if x[node["f"]] <= node["t"] else node["r"]
+    return node["leaf"]
+
+
+def fit_boosted(X, y, rounds, depth, lr):
+    bias = sum(y) / len(y)
+    pred = [bias] * len(y)
+    trees = []
+    idx = list(range(len(y)))
+    for _ in range(rounds):
+        resid = [y[i] - pred[i] for i in idx]
+        tree = fit_tree(X, resid, idx, depth)
+        scale(tree, lr)
+        trees.append(tree)
+        for i in idx:
+            pred[i] += predict_tree(tree, X[i])
+    return bias, trees
+
+
+def scale(node, k):
+    if "leaf" in node:
+        node["leaf"] *= k
+    else:
+        scale(node["l"], k)
+        scale(node["r"], k)
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# EXPORTAÇÃO (árvore completa, índice implícito: filho = 2n + 1 + (x > t))
+# ═══════════════════════════════════════════════════════════════════════════
+
+def flatten(tree, depth):
+    inner = (1 << depth) - 1
+    feats = [0] * inner
+    thr = [f32(NO_SPLIT)] * inner
+    leaves = [0.0] * (inner + 1)
+
+    def fill(node, n, level):
+        if level == depth:
+            leaves[n - inner] = f32(node["leaf"])
+            return
+        if "leaf" in node:
+            # Folha antes da profundidade máxima: split que sempre vai à esquerda
+            fill(node, 2 * n + 1, level + 1)
+            fill(node, 2 * n + 2, level + 1)
+            return
+        feats[n] = node["f"]
+        thr[n] = f32(node["t"])
+        fill(node["l"], 2 * n + 1, level + 1)
+        fill(node["r"], 2 * n + 2, level + 1)
+
+    fill(tree, 0, 0)
+    return feats, thr, leaves
+
+
+def tree_depth(node):
+    if "leaf" in node:
+        return 0
+    return 1 + max(tree_depth(node["l"]), tree_depth(node["r"]))
+
+
+class Flat:
+    def __init__(self, bias, trees):
+        self.depth = max(1, max(tree_depth(t) for t in trees))
+        self.bias = f32(bias)
+        self.feats, self.thr, self.leaves = [], [], []
+        for t in trees:
+            f, th, lv = flatten(t, self.depth)
+            self.feats += f
+            self.thr += th
+            self.leaves += lv
+        self.trees = len(trees)
+
+    def eval(self, x):
+        # Mesma ordem de operações de tinyTreeEval (soma float32)
+        inner = (1 << self.depth) - 1
+        s = self.bias
+        for t in range(self.trees):
+            n = 0
+            for _ in range(self.depth):
+                k = t * inner + n
+                n = 2 * n + 1 + (1 if f32(x[self.feats[k]]) > self.thr[k] else 0)
+            s = f32(s + self.leaves[t * (inner + 1) + n - inner])
+        return s
+
+
+def cfloat(v):
+    s = "%.9g" % v
+    if "e" not in s and "." not in s and "n" not in s:
+        s += ".0"
+    return s + "f"
+
+
+def emit_array(out, ctype, name, values, per_line=6):
+    out.append(f"constexpr {ctype} {name}[] = {{")
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(values[i:i + per_line]) + ",")
+    out.append("};")
+
+
+def emit_model(out, prefix, flat, features, vectors):
+    out.append(f"// {prefix}: {flat.trees} árvore(s), profundidade {flat.depth}")
+    out.append(f"enum {prefix.capitalize()}Feature : uint8_t {{")
+    for i, name in enumerate(features):
+        out.append(f"  {prefix.upper()}_F_{name.upper()} = {i},")
+    out.append(f"  {prefix.upper()}_FEATURE_COUNT = {len(features)}")
+    out.append("};")
+    out.append("")
+    emit_array(out, "uint8_t", f"{prefix.upper()}_TREE_FEATURE",
+               [str(f) for f in flat.feats], 16)
+    emit_array(out, "float", f"{prefix.upper()}_TREE_THRESHOLD",
+               [cfloat(t) for t in flat.thr])
+    emit_array(out, "float", f"{prefix.upper()}_TREE_LEAF",
+               [cfloat(v) for v in flat.leaves])
+    out.append(f"constexpr TinyTreeModel {prefix.upper()}_MODEL = {{")
+    out.append(f"    {flat.depth}, {flat.trees}, {prefix.upper()}_TREE_FEATURE,")
+    out.append(f"    {prefix.upper()}_TREE_THRESHOLD, {prefix.upper()}_TREE_LEAF,")
+    out.append(f"    {cfloat(flat.bias)}}};")
+    out.append("")
+    out.append("// Vetores de teste: entrada -> saída esperada (bit a bit)")
+    xs = []
+    for x in vectors:
+        xs += [cfloat(f32(v)) for v in x]
+    emit_array(out, "float", f"{prefix.upper()}_TEST_X", xs, len(features))
+    emit_array(out, "float", f"{prefix.upper()}_TEST_Y",
+               [cfloat(flat.eval(x)) for x in vectors])
+    out.append(f"constexpr uint8_t {prefix.upper()}_TEST_COUNT = {len(vectors)};")
+    out.append("")
+
+
+def render(pmkid, handshake, pmkid_vecs, hs_vecs):
+    out = []
+    out.append("#pragma once")
+    out.append("/**")
+    out.append(" * @file tiny_models.h")
+    out.append(" * @brief Árvores dos classificadores Tiny (GERADO, não editar)")
+    out.append(" *")
+    out.append(" * Gerador: ai_training/train_tiny_classifiers.py")
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief Conjunto de árvores completas de mesma profundidade")
+    out.append(" *")
+    out.append(" * Nó n desce para 2n + 1 + (x[feature[n]] > threshold[n]); as folhas")
+    out.append(" * ficam em leaf[n - (2^depth - 1)]. Saída = bias + soma das folhas.")
+    out.append(" */")
+    out.append("struct TinyTreeModel {")
+    out.append("  uint8_t depth;")
+    out.append("  uint8_t trees;")
+    out.append("  const uint8_t *feature;  // trees * (2^depth - 1)")
+    out.append("  const float *threshold;  // trees * (2^depth - 1)")
+    out.append("  const float *leaf;       // trees * 2^depth")
+    out.append("  float bias;")
+    out.append("};")
+    out.append("")
+    emit_model(out, "pmkid", pmkid, PMKID_FEATURES, pmkid_vecs)
+    emit_model(out, "handshake", handshake, HANDSHAKE_FEATURES, hs_vecs)
+    return "\n".join(out)
+
+
+# ═══════════════════════════════════════════════════════════════════════════
+# FIXTURE DO TESTE NO HOST
+# ═══════════════════════════════════════════════════════════════════════════
+
+# Casos de borda além dos sorteados: vazio, > 32 bytes, sufixo hexa longo
+EDGE_SSIDS = ["", "a", "VIVO-8E4A", "NET_2G1A2B3C", "x" * 40,
+              "ABCDEF0123456789ABCDEF0123456789FF", "Casa_1234", "A-B_C"]
+
+
+def cstring(s):
+    out = ""
+    for c in s:
+        if c in "\\\"":
+            out += "\\" + c
+        elif 32 <= ord(c) < 127:
+            out += c
+        else:
+            out += "\\x%02x" % ord(c)
+    return '"' + out + '"'
+
+
+def quality(raw):
+    # predictHandshakeStrength: lrintf (meio para o par, como round) + clamp
+    return max(0, min(100, int(round(raw))))
+
+
+def render_fixture(pmkid, hs, rng, n=200):
+    out = []
+    out.append("#pragma once")
+    out.append("/**")
+    out.append(" * @file tiny_vectors.h")
+    out.append(" * @brief Predições do Python para o teste no host (GERADO, não editar)")
+    out.append(" *")
+    out.append(" * Gerador: ai_training/train_tiny_classifiers.py")
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("struct TinyPmkidCase {")
+    out.append("  const char *ssid;")
+    out.append("  uint8_t bssid[6];")
+    out.append("  float score;")
+    out.append("};")
+    out.append("")
+    out.append("struct TinyHandshakeCase {")
+    out.append("  int half, anonces, snr, gapMs;")
+    out.append("  float raw;")
+    out.append("  int quality;")
+    out.append("};")
+    out.append("")
+
+    ssids = EDGE_SSIDS + [synth_ssid(rng) for _ in range(n - len(EDGE_SSIDS))]
+    out.append("static const TinyPmkidCase TINY_PMKID_CASES[] = {")
+    for ssid in ssids:
+        oui = rng.choice(WEAK_OUIS) if rng.random() < 0.2 else rng.choice(OTHER_OUIS)
+        mac = [oui >> 16, (oui >> 8) & 0xFF, oui & 0xFF] + \
+              [rng.randint(0, 255) for _ in range(3)]
+        score = pmkid.eval(pmkid_features(ssid, oui))
+        out.append("    {%s, {%s}, %s}," % (
+            cstring(ssid), ", ".join("0x%02X" % b for b in mac), cfloat(score)))
+    out.append("};")
+    out.append("")
+
+    out.append("static const TinyHandshakeCase TINY_HANDSHAKE_CASES[] = {")
+    for _ in range(n):
+        x = [rng.randint(0, 4), rng.randint(0, 4), rng.randint(-100, -20),
+             rng.randint(0, 1200)]
+        raw = hs.eval([float(v) for v in x])
+        out.append("    {%d, %d, %d, %d, %s, %d}," % (
+            x[0], x[1], x[2], x[3], cfloat(raw), quality(raw)))
+    out.append("};")
+    return "\n".join(out)
+
+
+def pick_vectors(X, rng, n=12):
+    picks = rng.sample(range(len(X)), min(n, len(X)))
+    return [X[i] for i in picks]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Treina e exporta os Tiny Classifiers")
+    parser.add_argument("--pmkid-data", type=str, default=None)
+    parser.add_argument("--handshake-data", type=str, default=None)
+    parser.add_argument("--seed", type=int, default=9)
+    parser.add_argument("--output", type=str, default=HEADER)
+    parser.add_argument("--fixture", type=str, default=FIXTURE)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+
+    X, y = pmkid_dataset(args.pmkid_data, rng)
+    tree = fit_tree(X, y, list(range(len(X))), depth=4)
+    pmkid = Flat(0.0, [tree])
+    acc = sum((pmkid.eval(x) > 0.5) == (t > 0.5) for x, t in zip(X, y)) / len(X)
+    print(f"[PMKID] {len(X)} amostras, acurácia {acc * 100:.1f}%, "
+          f"profundidade {pmkid.depth}")
+
+    Xh, yh = handshake_dataset(args.handshake_data, rng)
+    bias, trees = fit_boosted(Xh, yh, rounds=24, depth=1, lr=0.5)
+    hs = Flat(bias, trees)
+    mae = sum(abs(hs.eval(x) - t) for x, t in zip(Xh, yh)) / len(Xh)
+    print(f"[HANDSHAKE] {len(Xh)} amostras, erro médio {mae:.2f} pontos, "
+          f"{hs.trees} stumps")
+
+    content = render(pmkid, hs, pick_vectors(X, rng),
+                     pick_vectors(Xh, rng))
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content + "\n")
+    size = len(pmkid.thr) * 5 + len(pmkid.leaves) * 4 + len(hs.thr) * 5 + len(hs.leaves) * 4
+    print(f"✅ Gerado {os.path.relpath(args.output, ROOT)} (~{size} bytes de modelo)")
+
+    # Gerador próprio: o fixture não muda os modelos nem os vetores do header
+    fixture = render_fixture(pmkid, hs, random.Random(args.seed + 1))
+    os.makedirs(os.path.dirname(args.fixture), exist_ok=True)
+    with open(args.fixture, "w", encoding="utf-8", newline="\n") as f:
+        f.write(fixture + "\n")
+    print(f"✅ Gerado {os.path.relpath(args.fixture, ROOT)}")
+
+
+if __name__ == "__main__":
+    main()
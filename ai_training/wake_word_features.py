@@ -0,0 +1,341 @@
+# wake_word_features.py
+# Features do wake word ("Hey Dragon") iguais às do device
+#
+# Mesmo microfrontend de src/voice/wake_word_frontend.h (janela 30 ms,
+# passo 20 ms, 40 canais, redução de ruído, PCAN, log) e a mesma escala
+# float (valor * 10 / 256). Mudou um parâmetro aqui, muda lá também.
+#
+# Uso:
+#   python wake_word_features.py audio.wav --output features.npy
+#   python wake_word_features.py audio.wav --compare dump_device.npy
+#   python wake_word_features.py [wavs...] --export-fixture \
+#       ../test/test_wake_word_features/wake_vectors.h
+# O dump de comparação é a matriz uint16 (frames x 40) do frontend em C.
+# O fixture leva clipes sintéticos fixos (mais os WAVs passados) com a saída
+# uint16 esperada; o teste no host roda o frontend do device neles.
+#
+# Sem TensorFlow instalado, a referência é a própria lib C do microfrontend
+# (a mesma que o op do TF embrulha), vinda do TensorFlowLite_ESP32 em
+# .pio/libdeps e compilada com o cc/c++ do sistema, com a configuração
+# deste script. Só o numpy é obrigatório.
+
+import argparse
+import ctypes
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+import wave
+
+import numpy as np
+
+SAMPLE_RATE = 16000
+WINDOW_MS = 30
+STRIDE_MS = 20
+CHANNELS = 40
+TIME_STEPS = 49
+FEATURE_SCALE = 10.0 / 256.0
+# Clipes do fixture: meio segundo (24 frames) cobre a partida da redução de
+# ruído e do PCAN sem inflar o header versionado
+FIXTURE_SAMPLES = SAMPLE_RATE // 2
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Parâmetros do microfrontend (src/voice/wake_word_frontend.h)
+FRONTEND = dict(
+    upper_band_limit=7500.0,
+    lower_band_limit=125.0,
+    smoothing_bits=10,
+    even_smoothing=0.025,
+    odd_smoothing=0.06,
+    min_signal_remaining=0.05,
+    enable_pcan=True,
+    pcan_strength=0.95,
+    pcan_offset=80.0,
+    gain_bits=21,
+    enable_log=True,
+    scale_shift=6,
+)
+
+
+def load_wav(path):
+    with wave.open(path, "rb") as w:
+        if w.getframerate() != SAMPLE_RATE or w.getsampwidth() != 2:
+            raise ValueError(f"{path}: esperado PCM16 {SAMPLE_RATE} Hz")
+        pcm = np.frombuffer(w.readframes(w.getnframes()), dtype=np.int16)
+        if w.getnchannels() > 1:
+            pcm = pcm.reshape(-1, w.getnchannels()).mean(axis=1).astype(np.int16)
+    return pcm
+
+
+def frontend_backend():
+    """'tf' com TensorFlow instalado; senão 'lib-c' (lib do microfrontend)."""
+    try:
+        import tensorflow  # noqa: F401
+        return "tf"
+    except ImportError:
+        return "lib-c"
+
+
+def frontend_uint16(pcm):
+    """Saída crua do microfrontend (frames x CHANNELS, uint16)."""
+    if frontend_backend() == "lib-c":
+        return frontend_uint16_c(pcm)
+
+    import tensorflow as tf
+    from tensorflow.lite.experimental.microfrontend.python.ops import (
+        audio_microfrontend_op as frontend_op,
+    )
+
+    out = frontend_op.audio_microfrontend(
+        tf.convert_to_tensor(pcm, dtype=tf.int16),
+        sample_rate=SAMPLE_RATE,
+        window_size=WINDOW_MS,
+        window_step=STRIDE_MS,
+        num_channels=CHANNELS,
+        out_scale=1,
+        out_type=tf.uint16,
+        **FRONTEND,
+    )
+    return out.numpy()
+
+
+# Mesmo laço do kernel do op do TF (audio_microfrontend_op.cc): config a
+# partir dos atributos, buffer inteiro de uma vez, um frame por saída
+_FRONTEND_C = r"""
+#include <string.h>
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.h"
+
+int wake_frontend(const int16_t *pcm, size_t len, int rate, int window_ms,
+                  int step_ms, int channels, float upper, float lower,
+                  int smoothing_bits, float even, float odd, float min_signal,
+                  int enable_pcan, float strength, float offset, int gain_bits,
+                  int enable_log, int scale_shift, uint16_t *out,
+                  int max_frames) {
+  struct FrontendConfig config;
+  struct FrontendState state;
+  FrontendFillConfigWithDefaults(&config);
+  config.window.size_ms = window_ms;
+  config.window.step_size_ms = step_ms;
+  config.filterbank.num_channels = channels;
+  config.filterbank.upper_band_limit = upper;
+  config.filterbank.lower_band_limit = lower;
+  config.noise_reduction.smoothing_bits = smoothing_bits;
+  config.noise_reduction.even_smoothing = even;
+  config.noise_reduction.odd_smoothing = odd;
+  config.noise_reduction.min_signal_remaining = min_signal;
+  config.pcan_gain_control.enable_pcan = enable_pcan;
+  config.pcan_gain_control.strength = strength;
+  config.pcan_gain_control.offset = offset;
+  config.pcan_gain_control.gain_bits = gain_bits;
+  config.log_scale.enable_log = enable_log;
+  config.log_scale.scale_shift = scale_shift;
+  if (!FrontendPopulateState(&config, &state, rate)) return -1;
+
+  int frames = 0;
+  while (len > 0) {
+    size_t read = 0;
+    struct FrontendOutput o = FrontendProcessSamples(&state, pcm, len, &read);
+    pcm += read;
+    len -= read;
+    if (o.values) {
+      if (frames == max_frames) break;
+      memcpy(out + (size_t)frames * channels, o.values,
+             o.size * sizeof(uint16_t));
+      frames++;
+    }
+  }
+  FrontendFreeStateContents(&state);
+  return frames;
+}
+"""
+
+_frontend_lib = None
+
+
+def _load_frontend_lib():
+    """Compila a lib do microfrontend do TensorFlowLite_ESP32 (uma vez)."""
+    global _frontend_lib
+    if _frontend_lib is not None:
+        return _frontend_lib
+
+    srcs = glob.glob(os.path.join(PROJECT_DIR, ".pio", "libdeps", "*",
+                                  "TensorFlowLite_ESP32", "src"))
+    if not srcs:
+        raise RuntimeError("TensorFlowLite_ESP32 não encontrado em .pio/libdeps "
+                           "(rode um build do PlatformIO) e TensorFlow ausente")
+    root = srcs[0]
+    lib = os.path.join(root, "tensorflow", "lite", "experimental",
+                       "microfrontend", "lib")
+
+    build = tempfile.mkdtemp(prefix="wake_frontend_")
+    glue = os.path.join(build, "wake_frontend.c")
+    with open(glue, "w") as f:
+        f.write(_FRONTEND_C)
+
+    # Cada fonte numa unidade própria (o kissfft int16 não convive com o .c)
+    objs = []
+    for src in [glue] + sorted(glob.glob(os.path.join(lib, "*.c"))) + \
+            sorted(glob.glob(os.path.join(lib, "*.cpp"))):
+        obj = os.path.join(build, os.path.basename(src) + ".o")
+        cc = "c++" if src.endswith(".cpp") else "cc"
+        subprocess.run([cc, "-O2", "-fPIC", "-I", root, "-c", src, "-o", obj],
+                       check=True)
+        objs.append(obj)
+    so = os.path.join(build, "libwake_frontend.so")
+    subprocess.run(["c++", "-shared", "-o", so] + objs, check=True)
+
+    _frontend_lib = ctypes.CDLL(so)
+    f = _frontend_lib.wake_frontend
+    c_int, c_float = ctypes.c_int, ctypes.c_float
+    f.argtypes = [ctypes.c_void_p, ctypes.c_size_t, c_int, c_int, c_int, c_int,
+                  c_float, c_float, c_int, c_float, c_float, c_float,
+                  c_int, c_float, c_float, c_int, c_int, c_int,
+                  ctypes.c_void_p, c_int]
+    f.restype = c_int
+    return _frontend_lib
+
+
+def frontend_uint16_c(pcm):
+    """Saída crua pela lib C do microfrontend (mesma do op do TF)."""
+    lib = _load_frontend_lib()
+    pcm = np.ascontiguousarray(pcm, dtype=np.int16)
+    max_frames = len(pcm) // (SAMPLE_RATE * STRIDE_MS // 1000) + 1
+    out = np.zeros((max_frames, CHANNELS), dtype=np.uint16)
+    p = FRONTEND
+    n = lib.wake_frontend(
+        pcm.ctypes.data, len(pcm), SAMPLE_RATE, WINDOW_MS, STRIDE_MS, CHANNELS,
+        p["upper_band_limit"], p["lower_band_limit"], p["smoothing_bits"],
+        p["even_smoothing"], p["odd_smoothing"], p["min_signal_remaining"],
+        int(p["enable_pcan"]), p["pcan_strength"], p["pcan_offset"],
+        p["gain_bits"], int(p["enable_log"]), p["scale_shift"],
+        out.ctypes.data, max_frames)
+    if n < 0:
+        raise RuntimeError("FrontendPopulateState falhou")
+    return out[:n]
+
+
+def features(pcm):
+    """Entrada float do modelo: últimos TIME_STEPS frames, zero à esquerda."""
+    raw = frontend_uint16(pcm).astype(np.float32) * FEATURE_SCALE
+    if len(raw) < TIME_STEPS:
+        raw = np.vstack([np.zeros((TIME_STEPS - len(raw), CHANNELS), np.float32), raw])
+    return raw[-TIME_STEPS:]
+
+
+def synthetic_clips(seed=1234):
+    """Clipes fixos de 0,5 s: silêncio, ruído, tons, varredura e rajadas."""
+    rng = np.random.default_rng(seed)
+    t = np.arange(FIXTURE_SAMPLES) / SAMPLE_RATE
+    noise = rng.normal(0, 300, FIXTURE_SAMPLES)
+    sweep = np.sin(2 * np.pi * (100 * t + 7400 * t * t))  # 100 Hz -> 7,5 kHz
+    bursts = np.sin(2 * np.pi * 800 * t) * ((t * 5) % 1 < 0.3)
+    clips = {
+        "silence": np.zeros(FIXTURE_SAMPLES),
+        "noise": noise,
+        "tones": 6000 * (np.sin(2 * np.pi * 440 * t) + 0.5 * np.sin(2 * np.pi * 2500 * t)) + noise,
+        "sweep": 12000 * sweep,
+        "bursts": 20000 * bursts + noise,
+        "clipped": np.clip(40000 * sweep, -32768, 32767),
+    }
+    return {k: np.clip(np.round(v), -32768, 32767).astype(np.int16)
+            for k, v in clips.items()}
+
+
+def c_array(values, per_line=16):
+    rows = []
+    for i in range(0, len(values), per_line):
+        rows.append("    " + ", ".join(str(int(v)) for v in values[i:i + per_line]) + ",")
+    return rows
+
+
+def render_fixture(clips):
+    out = []
+    out.append("#pragma once")
+    out.append("/**")
+    out.append(" * @file wake_vectors.h")
+    out.append(" * @brief Saída do microfrontend no Python para o teste no host (GERADO, não editar)")
+    out.append(" *")
+    out.append(" * Gerador: ai_training/wake_word_features.py --export-fixture")
+    out.append(" * Referência: %s" % ("microfrontend do TensorFlow" if frontend_backend() == "tf"
+                                      else "lib C do microfrontend (TensorFlow ausente)"))
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("struct WakeClip {")
+    out.append("  const char *name;")
+    out.append("  const int16_t *pcm;")
+    out.append("  uint32_t samples;")
+    out.append("  const uint16_t *features; // frames x %d" % CHANNELS)
+    out.append("  uint32_t frames;")
+    out.append("};")
+    out.append("")
+
+    entries = []
+    for i, (name, pcm) in enumerate(clips.items()):
+        feats = frontend_uint16(pcm)
+        out.append("static const int16_t WAKE_PCM_%d[] = {" % i)
+        out.extend(c_array(pcm))
+        out.append("};")
+        out.append("static const uint16_t WAKE_FEATURES_%d[] = {" % i)
+        out.extend(c_array(feats.reshape(-1), CHANNELS))
+        out.append("};")
+        out.append("")
+        entries.append('    {"%s", WAKE_PCM_%d, %d, WAKE_FEATURES_%d, %d},' % (
+            name, i, len(pcm), i, len(feats)))
+
+    out.append("static const WakeClip WAKE_CLIPS[] = {")
+    out.extend(entries)
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Features do wake word (microfrontend)")
+    parser.add_argument("wav", nargs="*", help="WAV PCM16 mono 16 kHz")
+    parser.add_argument("--output", help="Salva a entrada do modelo (.npy)")
+    parser.add_argument("--compare", help="Dump uint16 do frontend em C (.npy)")
+    parser.add_argument("--tolerance", type=int, default=1,
+                        help="Diferença máxima aceita por valor (default: 1)")
+    parser.add_argument("--export-fixture",
+                        help="Gera o header do teste no host (clipes + saída uint16)")
+    args = parser.parse_args()
+
+    if args.export_fixture:
+        clips = synthetic_clips()
+        for path in args.wav:
+            # WAV grande vira meio segundo: o fixture vai para o repo
+            clips[os.path.basename(path)] = load_wav(path)[:FIXTURE_SAMPLES]
+        with open(args.export_fixture, "w") as f:
+            f.write(render_fixture(clips))
+        print(f"✅ {args.export_fixture}: {len(clips)} clipes")
+        return 0
+
+    if len(args.wav) != 1:
+        parser.error("informe um WAV")
+    pcm = load_wav(args.wav[0])
+
+    if args.compare:
+        ref = frontend_uint16(pcm).astype(np.int32)
+        dev = np.load(args.compare).astype(np.int32)
+        n = min(len(ref), len(dev))
+        if n == 0 or abs(len(ref) - len(dev)) > 1:
+            print(f"❌ Frames: python={len(ref)} device={len(dev)}")
+            return 1
+        diff = np.abs(ref[:n] - dev[:n]).max()
+        print(f"{n} frames, diferença máxima {diff}")
+        return 0 if diff <= args.tolerance else 1
+
+    feats = features(pcm)
+    if args.output:
+        np.save(args.output, feats)
+        print(f"✅ {args.output}: {feats.shape}")
+    else:
+        print(feats.shape, feats.min(), feats.max())
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,200 @@
+"""
+Gera o esquema de features da NEURA9 a partir de ai_training/neura9_features.json
+
+Saídas (não editar à mão):
+  - src/ai/neura9_feature_schema.h: índices constexpr, ganho/offset por
+    feature, nomes e a X-macro usada para validar o layout de Neura9Features.
+  - ai_training/neura9_features.py: a mesma lista para os scripts de treino,
+    com normalize()/quantize() idênticos ao empacotamento do firmware.
+
+Uso:
+  - Automático como extra_script "pre:" do PlatformIO (só reescreve se mudou).
+  - Manual: python scripts/gen_feature_schema.py [--check]
+    --check falha (código 1) se os arquivos gerados estiverem desatualizados.
+"""
+
+import json
+import os
+import sys
+
+try:
+    Import("env")  # noqa: F821 - injetado pelo PlatformIO
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+    FROM_PIO = True
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    FROM_PIO = False
+
+SCHEMA = os.path.join(PROJECT_DIR, "ai_training", "neura9_features.json")
+HEADER = os.path.join(PROJECT_DIR, "src", "ai", "neura9_feature_schema.h")
+PYMOD = os.path.join(PROJECT_DIR, "ai_training", "neura9_features.py")
+
+
+def load_schema():
+    with open(SCHEMA, encoding="utf-8") as f:
+        schema = json.load(f)
+
+    feats = schema["features"]
+    count = schema["count"]
+    if len(feats) > count:
+        raise SystemExit(f"[SCHEMA] {len(feats)} features > count {count}")
+
+    names = set()
+    for f in feats:
+        if f["name"] in names:
+            raise SystemExit(f"[SCHEMA] Feature duplicada: {f['name']}")
+        names.add(f["name"])
+        if f["max"] <= f["min"]:
+            raise SystemExit(f"[SCHEMA] Faixa inválida em {f['name']}")
+    return schema
+
+
+def gain_bias(f):
+    # Entrada do modelo = (x - min) / (max - min) = x * gain + bias
+    gain = 1.0 / (f["max"] - f["min"])
+    return gain, -f["min"] * gain + 0.0  # evita -0.0
+
+
+def fmt(v):
+    s = repr(float(v))
+    return s + "f" if "e" in s or "." in s else s + ".0f"
+
+
+def render_header(schema):
+    feats = schema["features"]
+    count = schema["count"]
+    reserved = count - len(feats)
+    rname = schema["reserved"]["name"]
+
+    out = []
+    out.append("#pragma once")
+    out.append("/**")
+    out.append(" * @file neura9_feature_schema.h")
+    out.append(" * @brief Esquema de entrada da NEURA9 (GERADO, não editar)")
+    out.append(" *")
+    out.append(" * Fonte: ai_training/neura9_features.json")
+    out.append(" * Gerador: scripts/gen_feature_schema.py")
+    out.append(" */")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append(f"#define NEURA9_FEATURE_COUNT {count}")
+    out.append(f"#define NEURA9_NAMED_FEATURES {len(feats)}")
+    out.append(f"#define NEURA9_RESERVED_FEATURES {reserved}")
+    out.append("")
+    out.append("// X(nome, índice): valida offsetof(Neura9Features, nome)")
+    out.append("#define NEURA9_FEATURE_LIST(X) \\")
+    for i, f in enumerate(feats):
+        end = " \\" if i < len(feats) - 1 else ""
+        out.append(f"  X({f['name']}, {i}){end}")
+    out.append("")
+    out.append("enum Neura9Feature : uint8_t {")
+    for i, f in enumerate(feats):
+        out.append(f"  NEURA9_F_{f['name'].upper()} = {i},")
+    out.append(f"  NEURA9_F_{rname.upper()} = {len(feats)},")
+    out.append("};")
+    out.append("")
+    out.append("// Entrada do modelo = valor * gain + bias (faixa [min, max] -> [0, 1])")
+    for label, idx in (("GAIN", 0), ("BIAS", 1)):
+        out.append(f"constexpr float NEURA9_FEATURE_{label}[NEURA9_FEATURE_COUNT] = {{")
+        vals = [fmt(gain_bias(f)[idx]) for f in feats]
+        vals += [fmt(1.0 if idx == 0 else 0.0)] * reserved
+        for i in range(0, len(vals), 6):
+            out.append("    " + ", ".join(vals[i:i + 6]) + ",")
+        out.append("};")
+        out.append("")
+    out.append("constexpr const char *NEURA9_FEATURE_NAMES[NEURA9_FEATURE_COUNT] = {")
+    for f in feats:
+        out.append(f'    "{f["name"]}",')
+    for i in range(reserved):
+        out.append(f'    "{rname}_{i}",')
+    out.append("};")
+    out.append("")
+    return "\n".join(out)
+
+
+def render_python(schema):
+    feats = schema["features"]
+    count = schema["count"]
+    reserved = count - len(feats)
+    rname = schema["reserved"]["name"]
+
+    names = [f["name"] for f in feats] + [f"{rname}_{i}" for i in range(reserved)]
+    gains = [gain_bias(f)[0] for f in feats] + [1.0] * reserved
+    biases = [gain_bias(f)[1] for f in feats] + [0.0] * reserved
+
+    out = []
+    out.append('"""')
+    out.append("Esquema de entrada da NEURA9 (GERADO, não editar)")
+    out.append("")
+    out.append("Fonte: ai_training/neura9_features.json")
+    out.append("Gerador: scripts/gen_feature_schema.py")
+    out.append("")
+    out.append("Mesma ordem e normalização de src/ai/neura9_feature_schema.h; quantize()")
+    out.append("reproduz o empacotamento INT8 de NEURA9Inference::predict.")
+    out.append('"""')
+    out.append("")
+    out.append("import numpy as np")
+    out.append("")
+    out.append(f"FEATURE_COUNT = {count}")
+    out.append(f"NAMED_FEATURES = {len(feats)}")
+    out.append("")
+    out.append("FEATURE_NAMES = [")
+    for n in names:
+        out.append(f'    "{n}",')
+    out.append("]")
+    out.append("")
+    out.append("FEATURE_INDEX = {name: i for i, name in enumerate(FEATURE_NAMES)}")
+    out.append("")
+    for label, vals in (("FEATURE_GAIN", gains), ("FEATURE_BIAS", biases)):
+        out.append(f"{label} = np.array([")
+        for i in range(0, len(vals), 6):
+            out.append("    " + ", ".join(repr(float(v)) for v in vals[i:i + 6]) + ",")
+        out.append("], dtype=np.float32)")
+        out.append("")
+    out.append("")
+    out.append("def normalize(x):")
+    out.append('    """Entrada float do modelo: x * gain + bias (shape [..., FEATURE_COUNT])"""')
+    out.append("    x = np.asarray(x, dtype=np.float32)")
+    out.append("    return x * FEATURE_GAIN + FEATURE_BIAS")
+    out.append("")
+    out.append("")
+    out.append("def quantize(x, scale, zero_point):")
+    out.append('    """Entrada INT8 do modelo, igual ao firmware (arredonda para o par)"""')
+    out.append("    x = np.asarray(x, dtype=np.float32)")
+    out.append("    mul = (FEATURE_GAIN / np.float32(scale)).astype(np.float32)")
+    out.append("    add = (FEATURE_BIAS / np.float32(scale) + np.float32(zero_point)).astype(np.float32)")
+    out.append("    q = np.clip(x * mul + add, -128.0, 127.0)")
+    out.append("    return np.rint(q).astype(np.int8)")
+    out.append("")
+    return "\n".join(out)
+
+
+def write_if_changed(path, content, check):
+    old = None
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            old = f.read()
+    if old == content:
+        return False
+    if check:
+        print(f"[SCHEMA] Desatualizado: {os.path.relpath(path, PROJECT_DIR)}")
+        return True
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(content)
+    print(f"[SCHEMA] Gerado: {os.path.relpath(path, PROJECT_DIR)}")
+    return True
+
+
+def main(check=False):
+    schema = load_schema()
+    stale = write_if_changed(HEADER, render_header(schema), check)
+    stale |= write_if_changed(PYMOD, render_python(schema), check)
+    if check and stale:
+        sys.exit(1)
+
+
+if FROM_PIO:
+    main()
+elif __name__ == "__main__":
+    main(check="--check" in sys.argv)
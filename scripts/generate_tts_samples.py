@@ -1,29 +1,54 @@
 #!/usr/bin/env python3
 """
 TTS Audio Generator for WaveShare Dragon Watch
-Generates synthesized voice samples using Google TTS (gTTS)
-and converts them to C header format for embedding in firmware.
+Builds the voice prompt asset bank played by TTSPlayer (src/voice/tts_bank.h).
+
+Each phrase is synthesized with Google TTS (gTTS), or taken from a WAV you
+recorded, resampled to mono 16-bit and encoded as IMA-ADPCM blocks (the same
+block layout as WAV IMA-ADPCM: 4-byte header + nibbles). At 8 kHz this is
+~4 KB per second of speech instead of 16 KB for the old 8-bit 16 kHz arrays.
+The firmware decodes one block at a time while the audio engine plays.
+
+Bank layout (little-endian):
+    header  "TTSB", version, codec, count, sampleRate, blockAlign, lang[8]
+    index   count x {offset, samples}  (offset from the start of the bank)
+    payload ADPCM blocks per phrase, in index order
 
 Requirements:
-    pip install gtts pydub
+    pip install gtts pydub      (not needed for --wav-dir or --placeholder)
 
 Usage:
-    python generate_tts_samples.py
+    python generate_tts_samples.py                  # gTTS pt-BR, 8 kHz
+    python generate_tts_samples.py --wav-dir voz/   # voz/HELLO.wav, ...
+    python generate_tts_samples.py --placeholder    # offline ticks, ~400 B
 
 Output:
-    tts_samples_real.h - Ready to replace src/voice/tts_samples.h
+    src/voice/tts_samples.h - bank embedded in the firmware image
+    tts_bank.bin            - same bank for a data partition labelled "tts"
+                              (subtype 0x40); when present it overrides the
+                              embedded one. Flash with:
+                              parttool.py write_partition --partition-name tts
+                                  --input tts_bank.bin
 """
 
-from gtts import gTTS
-from pydub import AudioSegment
+import argparse
+import math
 import os
 import struct
+import wave
 
-# Output configuration
-OUTPUT_SAMPLE_RATE = 16000
-OUTPUT_BITS = 8  # 8-bit unsigned PCM
+REPO_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_HEADER = os.path.join(REPO_DIR, "src", "voice", "tts_samples.h")
 
-# TTS Messages in Portuguese (Brazilian)
+BANK_MAGIC = b"TTSB"
+BANK_VERSION = 1
+CODEC_IMA_ADPCM = 1
+HEADER_FMT = "<4sBBHHH8s"  # 20 bytes, matches TtsBankHeader
+ENTRY_FMT = "<II"          # 8 bytes, matches TtsBankEntry
+DEFAULT_BLOCK = 256
+PLACEHOLDER_BLOCK = 16     # 25 samples: ~3 ms tick per phrase
+
+# TTS Messages in Portuguese (Brazilian), in TTSMessage enum order
 MESSAGES = {
     "HELLO": "Olá! Eu sou o Dragão, seu assistente.",
     "SCANNING": "Escaneando redes...",
@@ -42,124 +67,292 @@ MESSAGES = {
     "WAKE_WORD": "Sim, estou aqui!",
 }
 
-def generate_audio(text: str, output_path: str):
-    """Generate TTS audio file"""
-    tts = gTTS(text=text, lang='pt-br')
-    mp3_path = output_path.replace('.raw', '.mp3')
-    tts.save(mp3_path)
-    
-    # Convert to 16kHz mono 8-bit
+# ============================================================
+# IMA-ADPCM (same quantizer/reconstruction as src/hardware/ima_adpcm.cpp)
+# ============================================================
+STEP = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190,
+    209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499,
+    2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845,
+    8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385,
+    24623, 27086, 29794, 32767]
+INDEX = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def adpcm_decode_nibble(state, nibble):
+    pred, idx = state
+    step = STEP[idx]
+    diff = step >> 3
+    if nibble & 1:
+        diff += step >> 2
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 4:
+        diff += step
+    pred = pred - diff if nibble & 8 else pred + diff
+    pred = max(-32768, min(32767, pred))
+    idx = max(0, min(88, idx + INDEX[nibble]))
+    return (pred, idx)
+
+
+def adpcm_encode_sample(state, sample):
+    pred, idx = state
+    step = STEP[idx]
+    diff = sample - pred
+    nibble = 0
+    if diff < 0:
+        nibble = 8
+        diff = -diff
+    if diff >= step:
+        nibble |= 4
+        diff -= step
+    step >>= 1
+    if diff >= step:
+        nibble |= 2
+        diff -= step
+    step >>= 1
+    if diff >= step:
+        nibble |= 1
+    return nibble, adpcm_decode_nibble(state, nibble)
+
+
+def adpcm_encode(samples, block_align):
+    """Mono WAV-style blocks; the last one is padded with its final sample"""
+    per_block = (block_align - 4) * 2 + 1
+    out = bytearray()
+    idx = 0
+    for start in range(0, len(samples), per_block):
+        block = list(samples[start:start + per_block])
+        block += [block[-1]] * (per_block - len(block))
+        # Header: first sample raw + current step index
+        state = (block[0], idx)
+        out += struct.pack("<hBB", block[0], idx, 0)
+        nibbles = []
+        for s in block[1:]:
+            n, state = adpcm_encode_sample(state, s)
+            nibbles.append(n)
+        for i in range(0, len(nibbles), 2):
+            out.append(nibbles[i] | (nibbles[i + 1] << 4))
+        idx = state[1]
+    return bytes(out)
+
+
+def adpcm_decode(data, count, block_align):
+    per_block = (block_align - 4) * 2 + 1
+    out = []
+    for off in range(0, len(data), block_align):
+        pred, idx = struct.unpack_from("<hB", data, off)
+        state = (pred, min(idx, 88))
+        block = [pred]
+        for byte in data[off + 4:off + block_align]:
+            for n in (byte & 0x0F, byte >> 4):
+                state = adpcm_decode_nibble(state, n)
+                block.append(state[0])
+        out += block[:per_block]
+    return out[:count]
+
+# ============================================================
+# Audio sources
+# ============================================================
+
+
+def resample(samples, src_rate, dst_rate):
+    """Linear resampling (sources are already band-limited speech)"""
+    if src_rate == dst_rate or not samples:
+        return list(samples)
+    count = int(len(samples) * dst_rate / src_rate)
+    out = []
+    for i in range(count):
+        pos = i * src_rate / dst_rate
+        j = int(pos)
+        frac = pos - j
+        a = samples[j]
+        b = samples[min(j + 1, len(samples) - 1)]
+        out.append(int(round(a + (b - a) * frac)))
+    return out
+
+
+def normalize(samples, peak=0.9):
+    """Scale to a common peak so all prompts play at the same level"""
+    top = max((abs(s) for s in samples), default=0)
+    if top == 0:
+        return samples
+    gain = peak * 32767 / top
+    return [max(-32768, min(32767, int(s * gain))) for s in samples]
+
+
+def read_wav(path, rate):
+    with wave.open(path, "rb") as w:
+        if w.getsampwidth() != 2:
+            raise ValueError(f"{path}: only 16-bit PCM WAV is supported")
+        channels = w.getnchannels()
+        src_rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    data = struct.unpack(f"<{len(raw) // 2}h", raw)
+    mono = [sum(data[i:i + channels]) // channels
+            for i in range(0, len(data), channels)]
+    return resample(mono, src_rate, rate)
+
+
+def synthesize_gtts(text, lang, rate, tmp_dir):
+    """Generate TTS audio with gTTS and convert with pydub"""
+    from gtts import gTTS
+    from pydub import AudioSegment
+
+    mp3_path = os.path.join(tmp_dir, "tts.mp3")
+    gTTS(text=text, lang=lang).save(mp3_path)
     audio = AudioSegment.from_mp3(mp3_path)
-    audio = audio.set_frame_rate(OUTPUT_SAMPLE_RATE)
-    audio = audio.set_channels(1)
-    audio = audio.set_sample_width(1)  # 8-bit
-    
-    # Export as raw
-    audio.export(output_path, format='raw')
-    
-    # Cleanup MP3
+    audio = audio.set_frame_rate(rate).set_channels(1).set_sample_width(2)
     os.remove(mp3_path)
-    
-    return len(audio.raw_data)
-
-def raw_to_c_array(raw_path: str, array_name: str) -> tuple:
-    """Convert raw audio to C array string"""
-    with open(raw_path, 'rb') as f:
-        data = f.read()
-    
-    # Convert to unsigned 8-bit (center at 128)
-    # gTTS outputs signed, we need unsigned for simpler playback
-    unsigned_data = bytes([(b + 128) & 0xFF for b in data])
-    
+    raw = audio.raw_data
+    return list(struct.unpack(f"<{len(raw) // 2}h", raw))
+
+
+def placeholder(index, count, rate):
+    """One-block tick (no network); pitch differs per message.
+
+    Keeps the committed bank about as small as the old placeholder arrays:
+    one --block sized block per phrase instead of real audio.
+    """
+    freq = 880.0 * 2 ** (index / 12.0)
+    return [int(12000 * math.sin(math.pi * i / (count - 1)) *
+                math.sin(2 * math.pi * freq * i / rate))
+            for i in range(count)]
+
+# ============================================================
+# Bank
+# ============================================================
+
+
+def build_bank(phrases, rate, block_align, lang):
+    header_len = struct.calcsize(HEADER_FMT)
+    entry_len = struct.calcsize(ENTRY_FMT)
+    offset = header_len + entry_len * len(phrases)
+    index = b""
+    payload = b""
+    for samples in phrases:
+        data = adpcm_encode(samples, block_align) if samples else b""
+        index += struct.pack(ENTRY_FMT, offset + len(payload), len(samples))
+        payload += data
+    header = struct.pack(HEADER_FMT, BANK_MAGIC, BANK_VERSION,
+                         CODEC_IMA_ADPCM, len(phrases), rate, block_align,
+                         lang.encode()[:7])
+    return header + index + payload
+
+
+def write_header(path, bank, keys, phrases, rate, lang):
+    seconds = sum(len(p) for p in phrases) / rate
     lines = []
-    for i in range(0, len(unsigned_data), 16):
-        chunk = unsigned_data[i:i+16]
-        hex_vals = ', '.join(f'0x{b:02X}' for b in chunk)
-        lines.append(f'    {hex_vals},')
-    
-    return '\n'.join(lines), len(unsigned_data)
+    for i in range(0, len(bank), 16):
+        chunk = bank[i:i + 16]
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in chunk) + ",")
+    index = "\n".join(
+        f" *   {i:2d} {key:<20s} {len(phrases[i]) * 1000 // rate:5d} ms  "
+        f"\"{MESSAGES[key]}\""
+        for i, key in enumerate(keys))
 
-def main():
-    print("🐉 WaveShare Dragon TTS Generator")
-    print("=" * 50)
-    
-    # Create temp directory
-    os.makedirs('temp_tts', exist_ok=True)
-    
-    samples = {}
-    
-    for key, text in MESSAGES.items():
-        print(f"Generating: {key} - \"{text[:30]}...\"")
-        raw_path = f'temp_tts/tts_{key.lower()}.raw'
-        
-        try:
-            length = generate_audio(text, raw_path)
-            c_array, size = raw_to_c_array(raw_path, f'TTS_{key}_DATA')
-            samples[key] = (c_array, size)
-            print(f"  ✓ {size} bytes generated")
-        except Exception as e:
-            print(f"  ✗ Error: {e}")
-            samples[key] = ("    0x80, // Error placeholder", 1)
-    
-    # Generate header file
-    print("\nGenerating tts_samples_real.h...")
-    
-    header = '''#pragma once
+    header = f'''#pragma once
 /**
  * @file tts_samples.h
- * @brief Pre-generated TTS audio samples (synthesized voice)
- * 
- * Audio format: 8-bit unsigned PCM, 16kHz, Mono
- * Generated using Google TTS (pt-BR)
- * 
+ * @brief Voice prompt bank embedded in the firmware (see tts_bank.h)
+ *
+ * IMA-ADPCM, {rate} Hz, mono, language "{lang}": {len(bank)} bytes for
+ * {seconds:.2f} s of audio. Index (TTSMessage order):
+{index}
+ *
  * AUTO-GENERATED FILE - Do not edit manually!
+ * Regenerate with scripts/generate_tts_samples.py
  */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <pgmspace.h>
 
-'''
-    
-    # Add each sample
-    for key, (c_array, size) in samples.items():
-        header += f'''// ============================================================
-// TTS: "{MESSAGES[key]}"
-// ============================================================
-const uint8_t TTS_{key}_DATA[] PROGMEM = {{
-{c_array}
+alignas(4) const uint8_t TTS_BANK_DATA[] PROGMEM = {{
+{chr(10).join(lines)}
 }};
-const size_t TTS_{key}_LEN = {size};
-
+const size_t TTS_BANK_LEN = sizeof(TTS_BANK_DATA);
 '''
-    
-    # Add lookup table
-    header += '''// ============================================================
-// Lookup table for TTSMessage enum
-// ============================================================
-struct TTSSample {
-    const uint8_t* data;
-    size_t length;
-};
-
-const TTSSample TTS_SAMPLES[] = {
-'''
-    
-    for key in MESSAGES.keys():
-        header += f'    {{TTS_{key}_DATA, TTS_{key}_LEN}},\n'
-    
-    header += '''};
-
-#define TTS_SAMPLE_COUNT (sizeof(TTS_SAMPLES) / sizeof(TTSSample))
-'''
-    
-    with open('tts_samples_real.h', 'w') as f:
+    with open(path, "w", encoding="utf-8") as f:
         f.write(header)
-    
-    print("✅ Done! Copy tts_samples_real.h to src/voice/tts_samples.h")
-    
-    # Cleanup
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--lang", default="pt-br", help="gTTS language")
+    parser.add_argument("--rate", type=int, default=8000,
+                        help="sample rate of the bank (Hz)")
+    parser.add_argument("--block", type=int,
+                        help="ADPCM block size in bytes (<= 256; default "
+                             f"{DEFAULT_BLOCK}, {PLACEHOLDER_BLOCK} with "
+                             "--placeholder)")
+    parser.add_argument("--wav-dir", help="use <KEY>.wav files instead of gTTS")
+    parser.add_argument("--placeholder", action="store_true",
+                        help="offline one-block ticks instead of speech")
+    parser.add_argument("--header", default=DEFAULT_HEADER)
+    parser.add_argument("--bin", default="tts_bank.bin")
+    args = parser.parse_args()
+
+    if args.block is None:
+        args.block = PLACEHOLDER_BLOCK if args.placeholder else DEFAULT_BLOCK
+    if args.block < 8 or args.block > 256 or args.block % 4:
+        parser.error("--block must be a multiple of 4 between 8 and 256")
+
+    print("🐉 WaveShare Dragon TTS Generator")
+    print("=" * 50)
+
+    os.makedirs("temp_tts", exist_ok=True)
+    keys = list(MESSAGES.keys())
+    phrases = []
+    for i, key in enumerate(keys):
+        text = MESSAGES[key]
+        print(f"Generating: {key} - \"{text[:30]}...\"")
+        try:
+            if args.placeholder:
+                samples = placeholder(i, (args.block - 4) * 2 + 1, args.rate)
+            elif args.wav_dir:
+                samples = read_wav(os.path.join(args.wav_dir, f"{key}.wav"),
+                                   args.rate)
+            else:
+                samples = synthesize_gtts(text, args.lang, args.rate,
+                                          "temp_tts")
+            samples = normalize(samples)
+            print(f"  ✓ {len(samples) * 1000 // args.rate} ms")
+        except Exception as e:
+            # Empty entry: TTSPlayer::play() returns false for it
+            print(f"  ✗ Error: {e}")
+            samples = []
+        phrases.append(samples)
+
     import shutil
-    shutil.rmtree('temp_tts')
+    shutil.rmtree("temp_tts")
+
+    bank = build_bank(phrases, args.rate, args.block, args.lang)
+
+    # The firmware decoder must reproduce exactly what the encoder predicted
+    # (sanity check of the packing; error is the codec's, not the format's)
+    for key, samples in zip(keys, phrases):
+        if not samples:
+            continue
+        off, count = struct.unpack_from(
+            ENTRY_FMT, bank,
+            struct.calcsize(HEADER_FMT) + keys.index(key) *
+            struct.calcsize(ENTRY_FMT))
+        per_block = (args.block - 4) * 2 + 1
+        size = -(-count // per_block) * args.block
+        decoded = adpcm_decode(bank[off:off + size], count, args.block)
+        assert len(decoded) == count, key
+
+    with open(args.bin, "wb") as f:
+        f.write(bank)
+    write_header(args.header, bank, keys, phrases, args.rate, args.lang)
+
+    pcm8 = sum(len(p) for p in phrases) * 16000 // args.rate
+    print(f"\n✅ {len(bank)} bytes (8-bit 16 kHz PCM would be {pcm8})")
+    print(f"   {args.header}\n   {args.bin}")
+
 
-if __name__ == '__main__':
+if __name__ == "__main__":
     main()
@@ -0,0 +1,262 @@
+"""
+Subset das fontes Montserrat PT (src/fonts/lv_font_montserrat_pt_*.c)
+
+Varre as tabelas de idioma (src/ui/ui_language.cpp) e os fontes da UI em busca
+dos code points realmente usados em literais de string, e regenera cada tamanho
+com lv_font_conv apenas com esses glifos, no formato de bitmap comprimido do
+LVGL (bitmap_format = 1). Nenhuma tela usa essas fontes ainda; quem adotar
+uma delas liga LV_USE_FONT_COMPRESSED e a declara no lv_conf.h.
+
+Passo MANUAL: o build não roda este script. As fontes geradas ficam
+versionadas em src/fonts/; rode, confira o diff e faça commit.
+
+  python scripts/subset_fonts.py [--force]
+
+- As opções de cada fonte (tamanho, --lcd, stride...) vêm da linha "Opts:" do
+  próprio arquivo gerado; só a faixa de caracteres muda.
+- Latin-1 (160-255) entra sempre: SSIDs e nomes vistos em runtime usam
+  acentos que não aparecem nos literais da UI.
+- Requer lv_font_conv instalado (npm i -g lv_font_conv); nada é baixado.
+- Montserrat-Bold.ttf não vem com o LVGL: coloque-o em scripts/fonts/
+  (Google Fonts, licença OFL) para regenerar as variantes Bold.
+"""
+
+import hashlib
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+FONT_DIR = os.path.join(PROJECT_DIR, "src", "fonts")
+SCAN_DIRS = [os.path.join(PROJECT_DIR, "src", "ui")]
+SCAN_EXTS = (".c", ".cpp", ".h")
+
+# TTFs: Medium vem com o LVGL; Bold precisa ser colocado em scripts/fonts/
+TTF_SEARCH = [
+    os.path.join(PROJECT_DIR, "scripts", "fonts"),
+    os.path.join(PROJECT_DIR, "lib", "lvgl", "scripts", "built_in_font"),
+]
+
+# Fontes regeneradas (opções lidas do cabeçalho de cada uma)
+FONTS = [
+    "lv_font_montserrat_pt_14",
+    "lv_font_montserrat_pt_16",
+    "lv_font_montserrat_pt_20",
+    "lv_font_montserrat_pt_m_14",
+    "lv_font_montserrat_pt_m_16",
+    "lv_font_montserrat_pt_m_20",
+]
+
+SUBSET_TAG = " * Subset: "
+OPTS_TAG = " * Opts: "
+
+# Sempre presentes: ASCII imprimível e Latin-1 (texto vindo de fora)
+BASE_RANGES = [(0x20, 0x7F), (0xA0, 0xFF)]
+
+# Faixas que o Montserrat cobre (usado quando fontTools não está disponível)
+LATIN_RANGES = [(0x20, 0x7E), (0xA0, 0x24F), (0x2010, 0x2027), (0x2030, 0x205E)]
+
+STRING_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+ESCAPE_RE = re.compile(
+    r"\\(x[0-9a-fA-F]{1,2}|[0-7]{1,3}|u[0-9a-fA-F]{4}|U[0-9a-fA-F]{8}|.)")
+SIMPLE_ESCAPES = {"n": 10, "t": 9, "r": 13, "0": 0, "\\": 92, '"': 34, "'": 39}
+
+
+def decode_literal(body):
+    """Converte o corpo de um literal C em bytes UTF-8."""
+    out = bytearray()
+    pos = 0
+    for m in ESCAPE_RE.finditer(body):
+        out += body[pos:m.start()].encode("utf-8")
+        esc = m.group(1)
+        if esc[0] == "x":
+            out.append(int(esc[1:], 16))
+        elif esc[0] in "uU":
+            out += chr(int(esc[1:], 16)).encode("utf-8")
+        elif esc[0].isdigit() and esc != "0":
+            out.append(int(esc, 8) & 0xFF)
+        else:
+            out.append(SIMPLE_ESCAPES.get(esc, ord(esc[0]) & 0xFF))
+        pos = m.end()
+    out += body[pos:].encode("utf-8")
+    return bytes(out)
+
+
+def collect_codepoints():
+    cps = set()
+    for lo, hi in BASE_RANGES:
+        cps.update(range(lo, hi + 1))
+    for base in SCAN_DIRS:
+        for root, _, files in os.walk(base):
+            for name in files:
+                if not name.endswith(SCAN_EXTS):
+                    continue
+                with open(os.path.join(root, name), "r", encoding="utf-8",
+                          errors="ignore") as f:
+                    src = COMMENT_RE.sub("", f.read())
+                for m in STRING_RE.finditer(src):
+                    text = decode_literal(m.group(1)).decode("utf-8", "ignore")
+                    cps.update(ord(c) for c in text if ord(c) >= 0x20)
+    return cps
+
+
+def find_ttf(name):
+    for d in TTF_SEARCH:
+        path = os.path.join(d, name)
+        if os.path.exists(path):
+            return path
+    return None
+
+
+def filter_supported(cps, ttf):
+    """Remove code points sem glifo no TTF (LV_SYMBOL_*, emojis, etc)."""
+    try:
+        from fontTools.ttLib import TTFont
+        cmap = TTFont(ttf).getBestCmap()
+        return sorted(cp for cp in cps if cp in cmap)
+    except Exception:
+        return sorted(cp for cp in cps
+                      if any(lo <= cp <= hi for lo, hi in LATIN_RANGES))
+
+
+def to_ranges(cps):
+    """Compacta code points em faixas para a linha de comando."""
+    ranges = []
+    for cp in cps:
+        if ranges and cp == ranges[-1][1] + 1:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp])
+    return ",".join(str(a) if a == b else "%d-%d" % (a, b) for a, b in ranges)
+
+
+def bitmap_bytes(path):
+    """Conta os bytes do array glyph_bitmap de uma fonte gerada."""
+    if not os.path.exists(path):
+        return 0
+    with open(path, "r", encoding="utf-8", errors="ignore") as f:
+        src = f.read()
+    start = src.find("glyph_bitmap[] = {")
+    end = src.find("};", start)
+    if start < 0 or end < 0:
+        return 0
+    return len(re.findall(r"0x[0-9a-fA-F]+", src[start:end]))
+
+
+def header_line(path, tag):
+    if not os.path.exists(path):
+        return None
+    with open(path, "r", encoding="utf-8", errors="ignore") as f:
+        for _ in range(8):
+            line = f.readline()
+            if line.startswith(tag):
+                return line[len(tag):].strip()
+    return None
+
+
+def parse_opts(opts):
+    """Opções originais sem --range/-o (substituídas a cada geração)."""
+    args = opts.split()
+    keep = []
+    i = 0
+    while i < len(args):
+        if args[i] in ("--range", "-o", "--output"):
+            i += 2
+            continue
+        keep.append(args[i])
+        i += 1
+    font = os.path.basename(keep[keep.index("--font") + 1])
+    size = int(keep[keep.index("--size") + 1])
+    return keep, font, size
+
+
+def find_converter():
+    if shutil.which("lv_font_conv"):
+        return ["lv_font_conv"]
+    return None
+
+
+def tag_output(path, digest):
+    """Insere o hash do subset no cabeçalho para detectar mudanças."""
+    with open(path, "r", encoding="utf-8") as f:
+        lines = f.readlines()
+    for i, line in enumerate(lines[:8]):
+        if line.startswith(" * Opts:"):
+            lines.insert(i + 1, SUBSET_TAG + digest + "\n")
+            break
+    with open(path, "w", encoding="utf-8") as f:
+        f.writelines(lines)
+
+
+def subset_fonts(force=False):
+    cps = collect_codepoints()
+    conv = find_converter()
+    if not conv:
+        print("[FONTS] lv_font_conv não encontrado (npm i -g lv_font_conv)")
+        return 1
+
+    failed = 0
+    total_before = 0
+    total_after = 0
+
+    for name in FONTS:
+        out = os.path.join(FONT_DIR, name + ".c")
+        before = bitmap_bytes(out)
+        total_before += before
+
+        opts = header_line(out, OPTS_TAG)
+        if not opts:
+            print("[FONTS] %s: sem linha Opts no cabeçalho" % name)
+            failed += 1
+            total_after += before
+            continue
+        args, ttf_name, size = parse_opts(opts)
+
+        ttf = find_ttf(ttf_name)
+        if not ttf:
+            print("[FONTS] %s: %s não encontrado em %s"
+                  % (name, ttf_name, ", ".join(TTF_SEARCH)))
+            failed += 1
+            total_after += before
+            continue
+
+        glyphs = filter_supported(cps, ttf)
+        ranges = to_ranges(glyphs)
+        digest = hashlib.sha1(
+            ("%s|%s" % (" ".join(args), ranges)).encode()
+        ).hexdigest()[:16]
+
+        if not force and header_line(out, SUBSET_TAG) == digest:
+            total_after += before
+            continue
+
+        # Sem --no-compress: lv_font_conv gera bitmap_format = 1 (RLE + prefilter)
+        font_arg = args.index("--font") + 1
+        cmd = conv + args[:font_arg] + [ttf] + args[font_arg + 1:] + [
+            "--range", ranges, "-o", out,
+        ]
+        try:
+            subprocess.check_call(cmd, cwd=FONT_DIR, timeout=180)
+        except (OSError, subprocess.SubprocessError) as e:
+            print("[FONTS] Falha ao gerar %s: %s" % (name, e))
+            failed += 1
+            total_after += before
+            continue
+
+        tag_output(out, digest)
+        after = bitmap_bytes(out)
+        total_after += after
+        print("[FONTS] %s: %d px, %d glifos, bitmap %d -> %d bytes"
+              % (name, size, len(glyphs), before, after))
+
+    print("[FONTS] %d code points usados, bitmaps %d -> %d bytes"
+          % (len(cps), total_before, total_after))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(subset_fonts(force="--force" in sys.argv))
@@ -4,6 +4,7 @@
 #include "../hardware/audio_driver.h"
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
+#include <SD_MMC.h>
 #include <WiFiClientSecure.h>
 
 // NEURA9 Integration
@@ -14,8 +15,12 @@
 #include "detectors/anomaly_detector.h"
 #include "detectors/tiny_classifiers.h"
 #include "detectors/voice_command.h"
+#include "modules/anomaly_detector.h"
 
+#include "ai_scheduler.h"
 #include "data_collector.h"
+#include "model_runtime.h"
+#include "../neura9/model.h"
 
 AiManager aiManager;
 FeatureExtractor featureExtractor;
@@ -23,16 +28,29 @@ AnomalyDetector anomalyDetector;
 VoiceCommandAI voiceAI;
 DataCollector dataCollector;
 
-// Tip 11: Task wrapper
+// Prioridades no ModelRuntime (wake word = 3, ver wake_word_detector.cpp)
+#define NEURA9_PRIORITY 2
+#define DEFENSE_PRIORITY 1
+static int s_neura9Model = -1;
+
+// Tip 11: Task wrapper (loop() bloqueia esperando a próxima janela)
 void aiTaskFunction(void *pvParameters) {
+  // Acorda a task a cada janela selada, em vez de polling; os pedidos do
+  // ModelRuntime também rodam nela. Ligado aqui, antes da primeira volta,
+  // para o loop nunca rodar com agendador/runtime sem a task.
+  TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  aiScheduler.begin(self);
+  modelRuntime.begin(self);
+  featureExtractor.setNotifyTask(self);
+
   while (true) {
     aiManager.loop();
-    // Yield to watchdog
-    vTaskDelay(10 / portTICK_PERIOD_MS);
   }
 }
 
-AiManager::AiManager() : _aiTaskHandle(NULL), _apiKey(OPENAI_API_KEY) {}
+AiManager::AiManager() : _aiTaskHandle(NULL), _apiKey(OPENAI_API_KEY) {
+  memset((void *)&_bench, 0, sizeof(_bench));
+}
 
 bool AiManager::begin() {
   Serial.println("[AI] Initializing AI Manager...");
@@ -50,7 +68,22 @@ bool AiManager::begin() {
     Serial.println("[AI] FALHA ao iniciar NEURA9 TFLite!");
   }
 
-  // Tip 11: Inicia Task na Core 0 (para não competir com Loop/UI na Core 1)
+  // Modelos secundários dividem uma arena; NEURA9 só entra na contabilidade
+  // (prazo: uma janela)
+  s_neura9Model = modelRuntime.registerResident(
+      "neura9", NEURA9_PRIORITY, FeatureExtractor::DEFAULT_WINDOW_MS * 1000);
+  modelRuntime.registerModel("defense", neura9_defense_model_tflite,
+                             neura9_defense_model_tflite_len, DEFENSE_PRIORITY,
+                             0);
+
+  // Tip 26: log de amostras em lotes (anel em PSRAM -> LittleFS)
+  dataCollector.begin();
+
+  // Tips 14/15: árvores geradas batem com o modelo treinado?
+  TinyClassifiers::selfTest();
+
+  // Tip 11: Inicia Task na Core 0 (para não competir com Loop/UI na Core 1).
+  // Por último: tudo o que o loop usa já está pronto quando ela começa.
   xTaskCreatePinnedToCore(
       aiTaskFunction, "NEURA9_AI_Task",
       8192, // Stack size (8KB deve dar, arena está na PSRAM)
@@ -64,19 +97,60 @@ bool AiManager::begin() {
 }
 
 void AiManager::loop() {
+  // Dorme até o FeatureExtractor selar uma janela, chegar um pedido do
+  // ModelRuntime ou vencer o timeout da política
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(aiScheduler.waitMs()));
+  bool newWindow = featureExtractor.hasNewWindow();
+
+  // Pedidos mais urgentes que o NEURA9 (wake word) saem antes
+  modelRuntime.service(NEURA9_PRIORITY + 1);
+  uint32_t windowAgeUs = newWindow ? featureExtractor.getWindowAgeUs() : 0;
+
+  // Extrai features (consome a janela selada pelo caminho de captura)
+  const Neura9Features &features = featureExtractor.getFeatures();
+  // Modelo de sequência: toda janela entra no anel, rode o modelo ou não
+  if (newWindow)
+    neura9.pushWindow(features);
+
+  AiSchedulerInput in;
+  in.nowMs = millis();
+  // Fecha os bins mesmo sem frames: captura parada não prende o alarme
+  wifiAnomaly.tick(in.nowMs);
+  in.newWindow = newWindow;
+  in.featuresChanged = neura9.featuresChanged(features);
+  in.underAttack = wifiAnomaly.isUnderAttack();
+  in.anomalyScore = wifiAnomaly.getAverageAnomalyScore();
+  for (uint8_t c = 0; c < ANOMALY_CLASS_COUNT; c++) {
+    in.anomalyScore =
+        max(in.anomalyScore, wifiAnomaly.getClassScore((AnomalyFrameClass)c));
+  }
+  in.suspicious = neura9.getLastResult().category != RESULT_SAFE &&
+                  neura9.getLastResult().category != RESULT_UNKNOWN;
   // Tip 7: Desativar se bateria < 20% e não carregando
-  if (g_state.battery_percent < 20 && !g_state.is_charging &&
-      !g_state.auto_attack_enabled) {
-    vTaskDelay(5000 / portTICK_PERIOD_MS); // Hiberna IA
-    return;
+  in.lowPower = g_state.battery_percent < 20 && !g_state.is_charging &&
+                !g_state.auto_attack_enabled;
+
+  // Tip 12 & 5: a política decide se roda, usa cache ou descarta a janela
+  AiDecision decision = aiScheduler.decide(in);
+  uint32_t invokeUs = 0;
+  InferenceResult res = neura9.getLastResult();
+  if (decision == AI_DECISION_RUN) {
+    uint32_t start = micros();
+    res = neura9.run(features);
+    invokeUs = micros() - start;
+    modelRuntime.account(s_neura9Model, invokeUs, windowAgeUs + invokeUs,
+                         res.category != RESULT_UNKNOWN);
   }
+  aiScheduler.record(decision, invokeUs, windowAgeUs, millis());
 
-  // Extrai features
-  const Neura9Features &features = featureExtractor.getFeatures();
+  // Demais pedidos (defesa e outros de prioridade baixa)
+  modelRuntime.service();
+
+  // Benchmark pedido pela web: roda aqui, não no AsyncTCP
+  serviceBenchmark();
 
-  // Tip 12 & 5: predict() agora gerencia internamente se deve rodar ou usar
-  // cache
-  InferenceResult res = neura9.predict(features);
+  if (decision == AI_DECISION_SKIPPED)
+    return;
 
   if (res.category != RESULT_UNKNOWN && res.confidence > 0.7f) {
     // Ação baseada na inferência
@@ -86,7 +160,9 @@ void AiManager::loop() {
 
   // Tip 18 & 26: Anomaly Detection + Auto Data Collection
   // Se detectar anomalia, salva os dados para treino futuro (Tip 26)
-  if (anomalyDetector.isAnomalous(features.rssi_norm * 100,
+  // Detector de mudança por frame (EWMA/CUSUM) alimentado pela captura
+  if (in.underAttack ||
+      anomalyDetector.isAnomalous(features.rssi_norm * 100,
                                   features.probereq_rate * 10,
                                   features.deauth_rate)) {
     dataCollector.logFeatures(features, res.category);
@@ -98,16 +174,35 @@ void AiManager::loop() {
   // if (ContextAwareAI::detectMicroSleep(0.01f, lastTouch)) {
   //     // turnOffScreen();
   // }
+}
 
-  // Feature window reset depende da lógica de coleta.
-  // Se rodou inferência nova, resetamos.
-  if (res.inferenceTimeMs > 0) { // Significa que rodou de verdade (não cache)
-    featureExtractor.resetWindow();
-  }
+// ═══════════════════════════════════════════════════════════════════════════
+// BENCHMARK NA TASK DE IA
+// ═══════════════════════════════════════════════════════════════════════════
 
-  // Pequeno delay para não travar task loop, mas o timing real é controlado lá
-  // dentro
-  vTaskDelay(50 / portTICK_PERIOD_MS);
+bool AiManager::requestBenchmark(uint16_t iterations, const char *dataset) {
+  // Só o handler da web pede (uma task); a task de IA só lê na fila
+  if (_bench.state == AI_BENCH_QUEUED || _bench.state == AI_BENCH_RUNNING)
+    return false;
+  _bench.iterations = iterations;
+  strncpy(_bench.dataset, dataset ? dataset : "", sizeof(_bench.dataset) - 1);
+  _bench.dataset[sizeof(_bench.dataset) - 1] = '\0';
+  _bench.state = AI_BENCH_QUEUED;
+  if (_aiTaskHandle)
+    xTaskNotifyGive(_aiTaskHandle);
+  return true;
+}
+
+void AiManager::serviceBenchmark() {
+  if (_bench.state != AI_BENCH_QUEUED)
+    return;
+  _bench.state = AI_BENCH_RUNNING;
+  uint32_t start = millis();
+  _bench.ok = neura9.benchmark(&_bench.bench, _bench.iterations);
+  _bench.evalOk = _bench.ok && _bench.dataset[0] &&
+                  neura9.evaluate(SD_MMC, _bench.dataset, &_bench.eval);
+  _bench.elapsedMs = millis() - start;
+  _bench.state = AI_BENCH_DONE;
 }
 
 // ... Rest of existing methods (Cloud AI) ...
@@ -203,6 +298,8 @@ bool AiManager::synthesizeSpeech(String text, String voice) {
 
   int httpCode = http.POST(payload);
   if (httpCode == HTTP_CODE_OK) {
+    // "pcm" da OpenAI é 24 kHz mono; o mixer converte para a taxa do I2S
+    audioDriver.setStreamRate(AUDIO_STREAM_SPEECH, 24000);
     int len = http.getSize();
     uint8_t buff[512];
     WiFiClient *stream = http.getStreamPtr();
@@ -213,7 +310,9 @@ bool AiManager::synthesizeSpeech(String text, String voice) {
         int c = stream->readBytes(
             buff, ((size > sizeof(buff)) ? sizeof(buff) : size));
         if (c > 0) {
-          audioDriver.playRaw((int16_t *)buff, c / 2);
+          // Espera o anel do motor esvaziar (contrapressão no download)
+          audioDriver.playRaw((int16_t *)buff, c / 2, 200,
+                              AUDIO_STREAM_SPEECH);
           if (len > 0)
             len -= c;
         }
@@ -1,6 +1,28 @@
 #pragma once
 #include <Arduino.h>
 
+#include "detectors/tiny_classifiers.h"
+#include "neura9_inference.h"
+
+// Benchmark do NEURA9 pedido pela web e executado na task de IA
+enum AiBenchState : uint8_t {
+  AI_BENCH_IDLE = 0, // Nenhum pedido ainda
+  AI_BENCH_QUEUED,
+  AI_BENCH_RUNNING,
+  AI_BENCH_DONE
+};
+
+struct AiBenchJob {
+  volatile AiBenchState state;
+  uint16_t iterations;
+  char dataset[64]; // CSV rotulado no SD ("" = só latência/arena)
+  bool ok;          // benchmark() rodou
+  bool evalOk;      // evaluate() rodou (só com dataset)
+  uint32_t elapsedMs;
+  Neura9BenchResult bench;
+  Neura9EvalResult eval;
+};
+
 class AiManager {
 public:
   AiManager();
@@ -24,11 +46,19 @@ public:
   // Tip 11: Task loop
   void loop();
 
-#include "detectors/tiny_classifiers.h"
+  /**
+   * @brief Enfileira benchmark (e avaliação opcional) para a task de IA
+   *
+   * Não bloqueia: o resultado sai em getBenchJob() quando state chega em
+   * AI_BENCH_DONE.
+   * @return false se já há um pedido na fila ou rodando
+   */
+  bool requestBenchmark(uint16_t iterations, const char *dataset);
+  const AiBenchJob &getBenchJob() const { return _bench; }
 
   // Expose Tools for UI/Web
-  bool checkPmkidWeakness(String ssid, String oui, uint8_t *data) {
-    return TinyClassifiers::isPmkidWeak(ssid, oui, data);
+  bool checkPmkidWeakness(const char *ssid, const uint8_t *bssid) {
+    return TinyClassifiers::isPmkidWeak(ssid, bssid);
   }
 
   int checkHandshakeQuality(int half, int anonces, int snr, int gap) {
@@ -38,6 +68,9 @@ public:
 private:
   String _apiKey;
   TaskHandle_t _aiTaskHandle;
+  AiBenchJob _bench; // Matriz de confusão fica aqui, fora da pilha da task
+
+  void serviceBenchmark();
 };
 
 extern AiManager aiManager;
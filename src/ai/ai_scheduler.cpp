@@ -0,0 +1,155 @@
+#include "ai_scheduler.h"
+#include "feature_extractor.h"
+
+AiScheduler aiScheduler;
+
+AiScheduler::AiScheduler()
+    : _task(NULL), _historyHead(0), _historyCount(0), _quietScore(0.1f),
+      _lastRunMs(0), _lastAttackMs(0), _windowsSinceRun(0) {
+  memset(&_stats, 0, sizeof(_stats));
+  memset(_history, 0, sizeof(_history));
+  _stats.mode = AI_MODE_NORMAL;
+}
+
+void AiScheduler::begin(TaskHandle_t task) { _task = task; }
+
+uint32_t AiScheduler::waitMs() const {
+  if (_stats.mode == AI_MODE_POWER_SAVE)
+    return POWER_SAVE_WAIT_MS;
+  // Duas janelas sem selagem = sem captura; acorda para reavaliar
+  return 2 * featureExtractor.getWindowMs();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// POLÍTICA
+// ═══════════════════════════════════════════════════════════════════════════
+
+AiDecision AiScheduler::decide(const AiSchedulerInput &in) {
+  // 1. Boost: anomalia dispara, mantém até BOOST_HOLD_MS após o último alarme
+  if (in.underAttack) {
+    _lastAttackMs = in.nowMs;
+    if (!_stats.boosted)
+      enterBoost(in.nowMs);
+  } else if (_stats.boosted && in.nowMs - _lastAttackMs > BOOST_HOLD_MS) {
+    leaveBoost();
+  }
+
+  // 2. Modo
+  if (_stats.boosted) {
+    _stats.mode = AI_MODE_BOOST;
+  } else if (in.lowPower) {
+    _stats.mode = AI_MODE_POWER_SAVE;
+  } else if (!in.suspicious && in.anomalyScore < _quietScore) {
+    _stats.mode = AI_MODE_QUIET;
+  } else {
+    _stats.mode = AI_MODE_NORMAL;
+  }
+
+  // 3. Decisão
+  if (!in.newWindow)
+    return AI_DECISION_SKIPPED; // Timeout: nada novo para classificar
+  _windowsSinceRun++;
+
+  switch (_stats.mode) {
+  case AI_MODE_POWER_SAVE:
+    // Tip 7: IA hibernada (o detector de anomalias ainda pode acordá-la)
+    return AI_DECISION_SKIPPED;
+  case AI_MODE_BOOST:
+    return AI_DECISION_RUN;
+  case AI_MODE_QUIET:
+    if (_windowsSinceRun < QUIET_STRIDE)
+      return AI_DECISION_SKIPPED;
+    break;
+  default:
+    break;
+  }
+
+  // Tip 12: features quase iguais, resultado recente -> cache
+  if (!in.featuresChanged && in.nowMs - _lastRunMs < CACHE_MAX_AGE_MS)
+    return AI_DECISION_CACHED;
+  return AI_DECISION_RUN;
+}
+
+void AiScheduler::enterBoost(uint32_t nowMs) {
+  _stats.boosted = true;
+  _stats.boosts++;
+  if (_task)
+    vTaskPrioritySet(_task, BOOST_PRIORITY);
+  featureExtractor.setWindowMs(BOOST_WINDOW_MS);
+  Serial.printf("[AI-SCHED] Boost: anomalia detectada (janela %u ms)\n",
+                (unsigned)BOOST_WINDOW_MS);
+}
+
+void AiScheduler::leaveBoost() {
+  _stats.boosted = false;
+  if (_task)
+    vTaskPrioritySet(_task, BASE_PRIORITY);
+  featureExtractor.setWindowMs(FeatureExtractor::DEFAULT_WINDOW_MS);
+  Serial.println("[AI-SCHED] Boost encerrado");
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TELEMETRIA
+// ═══════════════════════════════════════════════════════════════════════════
+
+void AiScheduler::record(AiDecision decision, uint32_t invokeUs,
+                         uint32_t windowAgeUs, uint32_t nowMs) {
+  _stats.decisions[decision]++;
+  if (decision == AI_DECISION_RUN) {
+    _lastRunMs = nowMs;
+    _windowsSinceRun = 0;
+    _stats.lastInvokeUs = invokeUs;
+    if (invokeUs > _stats.maxInvokeUs)
+      _stats.maxInvokeUs = invokeUs;
+  }
+  _stats.lastWindowAgeUs = windowAgeUs;
+  if (windowAgeUs > _stats.maxWindowAgeUs)
+    _stats.maxWindowAgeUs = windowAgeUs;
+
+  AiDecisionRecord &r = _history[_historyHead];
+  r.timeMs = nowMs;
+  r.invokeUs = invokeUs;
+  r.windowAgeUs = windowAgeUs;
+  r.decision = decision;
+  r.mode = _stats.mode;
+  _historyHead = (_historyHead + 1) % HISTORY;
+  if (_historyCount < HISTORY)
+    _historyCount++;
+}
+
+uint8_t AiScheduler::getHistory(AiDecisionRecord *out, uint8_t maxCount) const {
+  uint8_t n = _historyCount < maxCount ? _historyCount : maxCount;
+  uint8_t start = (_historyHead + HISTORY - n) % HISTORY;
+  for (uint8_t i = 0; i < n; i++) {
+    out[i] = _history[(start + i) % HISTORY];
+  }
+  return n;
+}
+
+const char *AiScheduler::decisionName(AiDecision decision) {
+  switch (decision) {
+  case AI_DECISION_SKIPPED:
+    return "skipped";
+  case AI_DECISION_CACHED:
+    return "cached";
+  case AI_DECISION_RUN:
+    return "run";
+  default:
+    return "?";
+  }
+}
+
+const char *AiScheduler::modeName(AiSchedulerMode mode) {
+  switch (mode) {
+  case AI_MODE_POWER_SAVE:
+    return "power_save";
+  case AI_MODE_QUIET:
+    return "quiet";
+  case AI_MODE_NORMAL:
+    return "normal";
+  case AI_MODE_BOOST:
+    return "boost";
+  default:
+    return "?";
+  }
+}
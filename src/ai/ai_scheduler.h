@@ -0,0 +1,137 @@
+#pragma once
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+/**
+ * @file ai_scheduler.h
+ * @brief Política de agendamento da task de IA (orientada a eventos)
+ *
+ * A task de IA dorme em ulTaskNotifyTake() até o FeatureExtractor selar uma
+ * janela. A cada despertar a política decide, com base no score de anomalia
+ * e no estado de energia, se a janela é descartada (SKIPPED), se o último
+ * resultado continua valendo (CACHED, Tip 12) ou se o modelo roda (RUN).
+ *
+ * Quando o detector de anomalias (wifiAnomaly) dispara, a task sobe de
+ * prioridade e as janelas ficam mais curtas até BOOST_HOLD_MS depois do
+ * último alarme.
+ */
+
+enum AiDecision : uint8_t {
+  AI_DECISION_SKIPPED = 0, // Janela descartada (energia, quieto, sem janela)
+  AI_DECISION_CACHED,      // Features quase iguais: reaproveita o resultado
+  AI_DECISION_RUN,         // Inferência executada
+  AI_DECISION_COUNT
+};
+
+enum AiSchedulerMode : uint8_t {
+  AI_MODE_POWER_SAVE = 0, // Tip 7: bateria baixa e sem carregador
+  AI_MODE_QUIET,          // Sem anomalia: uma janela a cada QUIET_STRIDE
+  AI_MODE_NORMAL,
+  AI_MODE_BOOST,          // Ataque em andamento: toda janela, prioridade alta
+  AI_MODE_COUNT
+};
+
+/**
+ * @brief Estado observado a cada despertar da task
+ */
+struct AiSchedulerInput {
+  uint32_t nowMs;
+  bool newWindow;       // Acordou por janela selada (não por timeout)
+  bool featuresChanged; // Delta das features-chave acima do limiar (Tip 12)
+  bool underAttack;     // wifiAnomaly.isUnderAttack()
+  float anomalyScore;   // 0..1
+  bool suspicious;      // Último resultado do modelo não é SAFE (Tip 5)
+  bool lowPower;        // Bateria < 20%, sem carregador, sem auto ataque
+};
+
+/**
+ * @brief Uma decisão registrada (telemetria)
+ */
+struct AiDecisionRecord {
+  uint32_t timeMs;
+  uint32_t invokeUs;    // 0 se não rodou
+  uint32_t windowAgeUs; // Selagem da janela -> decisão
+  AiDecision decision;
+  AiSchedulerMode mode;
+};
+
+struct AiSchedulerStats {
+  uint32_t decisions[AI_DECISION_COUNT];
+  uint32_t lastInvokeUs;
+  uint32_t maxInvokeUs;
+  uint32_t lastWindowAgeUs;
+  uint32_t maxWindowAgeUs;
+  uint32_t boosts;
+  AiSchedulerMode mode;
+  bool boosted;
+};
+
+class AiScheduler {
+public:
+  static const uint8_t HISTORY = 16;
+  static const uint8_t QUIET_STRIDE = 2;          // Janelas por inferência
+  static const uint32_t CACHE_MAX_AGE_MS = 2000;  // Tip 12: força a cada 2s
+  static const uint32_t POWER_SAVE_WAIT_MS = 5000;
+  static const uint32_t BOOST_HOLD_MS = 5000;
+  static const uint32_t BOOST_WINDOW_MS = 250;
+  static const UBaseType_t BASE_PRIORITY = 1;
+  static const UBaseType_t BOOST_PRIORITY = 3;
+
+  AiScheduler();
+
+  // Task controlada (prioridade do boost)
+  void begin(TaskHandle_t task);
+
+  /**
+   * @brief Quanto a task pode dormir esperando a próxima janela
+   *
+   * O timeout só serve para reavaliar energia e fim do boost quando não há
+   * captura (nenhuma janela é selada).
+   */
+  uint32_t waitMs() const;
+
+  /**
+   * @brief Decide o que fazer com a janela atual (atualiza modo e boost)
+   */
+  AiDecision decide(const AiSchedulerInput &in);
+
+  /**
+   * @brief Registra o resultado da decisão
+   */
+  void record(AiDecision decision, uint32_t invokeUs, uint32_t windowAgeUs,
+              uint32_t nowMs);
+
+  AiSchedulerStats getStats() const { return _stats; }
+  AiSchedulerMode getMode() const { return _stats.mode; }
+  bool isBoosted() const { return _stats.boosted; }
+
+  /**
+   * @brief Últimas decisões, da mais antiga para a mais recente
+   * @return Quantas foram copiadas
+   */
+  uint8_t getHistory(AiDecisionRecord *out, uint8_t maxCount) const;
+
+  static const char *decisionName(AiDecision decision);
+  static const char *modeName(AiSchedulerMode mode);
+
+  // Abaixo disso a janela é considerada "quieta"
+  void setQuietScore(float score) { _quietScore = score; }
+
+private:
+  TaskHandle_t _task;
+  AiSchedulerStats _stats;
+  AiDecisionRecord _history[HISTORY];
+  uint8_t _historyHead;
+  uint8_t _historyCount;
+
+  float _quietScore;
+  uint32_t _lastRunMs;
+  uint32_t _lastAttackMs;
+  uint8_t _windowsSinceRun;
+
+  void enterBoost(uint32_t nowMs);
+  void leaveBoost();
+};
+
+extern AiScheduler aiScheduler;
@@ -1,61 +1,394 @@
 #include "data_collector.h"
+#include "neura9_feature_schema.h"
 #include <LittleFS.h>
 
-DataCollector::DataCollector() : _sampleCount(0) {}
+#define DATA_DIR "/ai_data"
+
+// Rótulos na ordem de Neura9Result (neura9_inference.h)
+static const char *const LABEL_NAMES[DATA_LOG_LABELS] = {
+    "SAFE",       "DEAUTH",       "EVIL_TWIN",       "BEACON_SPAM",
+    "PROBE_FLOOD", "ROGUE_AP",    "KARMA",           "WPS_ACTIVE",
+    "HIDDEN_SSID", "CLIENT_FLOOD", "HANDSHAKE_VALID", "PMKID_WEAK"};
+
+// Amostras por escrita: o máximo que cabe numa página
+static const uint16_t BATCH_SAMPLES =
+    DataCollector::PAGE_SIZE / sizeof(TrainingSample);
+
+DataCollector::DataCollector()
+    : _ring(nullptr), _head(0), _count(0), _lock(nullptr), _firstSegment(0),
+      _keepFrom(0), _lastSegment(0), _exports(0), _segmentSize(0),
+      _lastFlush(0), _sampleCount(0), _dropped(0), _ready(false) {}
 
 bool DataCollector::begin() {
-  if (!LittleFS.exists("/ai_data")) {
-    LittleFS.mkdir("/ai_data");
+  if (_ready)
+    return true;
+
+  if (!LittleFS.exists(DATA_DIR)) {
+    LittleFS.mkdir(DATA_DIR);
   }
+
+  _ring = (TrainingSample *)heap_caps_malloc(
+      RING_SAMPLES * sizeof(TrainingSample), MALLOC_CAP_SPIRAM);
+  if (!_ring) {
+    _ring = (TrainingSample *)malloc(RING_SAMPLES * sizeof(TrainingSample));
+  }
+  _lock = xSemaphoreCreateMutex();
+  if (!_ring || !_lock) {
+    Serial.println("[AI-DATA] Sem memória para o anel de amostras");
+    return false;
+  }
+
+  // Segmentos existentes: samples_<n>.bin, continua do maior índice
+  bool found = false;
+  File dir = LittleFS.open(DATA_DIR);
+  if (dir) {
+    File entry = dir.openNextFile();
+    while (entry) {
+      unsigned idx;
+      if (sscanf(entry.name(), "samples_%u.bin", &idx) == 1 ||
+          sscanf(entry.name(), DATA_DIR "/samples_%u.bin", &idx) == 1) {
+        if (!found || idx < _firstSegment)
+          _firstSegment = idx;
+        if (!found || idx > _lastSegment)
+          _lastSegment = idx;
+        found = true;
+      }
+      entry = dir.openNextFile();
+    }
+  }
+
+  _keepFrom = _firstSegment;
+  if (found) {
+    char path[40];
+    segmentPath(_lastSegment, path, sizeof(path));
+    File last = LittleFS.open(path, "r");
+    bool reuse = last && headerMatches(last) && last.size() < SEGMENT_MAX;
+    _segmentSize = last ? last.size() : 0;
+    if (last)
+      last.close();
+    // Esquema mudou (ou segmento cheio): começa outro
+    if (!reuse)
+      rotate();
+  }
+
+  _lastFlush = millis();
+  _ready = true;
+  Serial.printf("[AI-DATA] Log em %s, segmentos %u..%u\n", DATA_DIR,
+                _firstSegment, _lastSegment);
   return true;
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// GRAVAÇÃO
+// ═══════════════════════════════════════════════════════════════════════════
+
 void DataCollector::logSample(const Neura9Features &features, int userLabel) {
-  File f = LittleFS.open("/ai_data/samples.bin", "ab");
-  if (f) {
-    TrainingSample sample;
-    sample.features = features;
-    sample.label = userLabel;
-    sample.timestamp = millis();
+  if (!_ready)
+    return;
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  if (_count == RING_SAMPLES) {
+    // Sistema de arquivos travado/cheio: descarta a mais antiga
+    _count--;
+    _dropped++;
+  }
+  TrainingSample &sample = _ring[_head];
+  sample.features = features;
+  sample.label = userLabel;
+  sample.timestamp = millis();
+  _head = (_head + 1) % RING_SAMPLES;
+  _count++;
+  _sampleCount++;
 
-    f.write((uint8_t *)&sample, sizeof(TrainingSample));
-    f.close();
-    _sampleCount++;
+  if (_count >= BATCH_SAMPLES) {
+    writeBatch(BATCH_SAMPLES);
+  } else if (millis() - _lastFlush > FLUSH_INTERVAL_MS) {
+    writeBatch(_count);
+  }
+  xSemaphoreGive(_lock);
+}
 
-    Serial.printf("[AI-DATA] Sample saved. Total: %d\n", _sampleCount);
+void DataCollector::flush() {
+  if (!_ready)
+    return;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  while (_count > 0) {
+    uint16_t before = _count;
+    writeBatch(_count > BATCH_SAMPLES ? BATCH_SAMPLES : _count);
+    if (_count == before)
+      break; // Falha de escrita, tenta no próximo lote
   }
+  xSemaphoreGive(_lock);
 }
 
-String DataCollector::createCSVExport() {
-  // Converte binário para CSV para o usuário baixar
-  File bin = LittleFS.open("/ai_data/samples.bin", "rb");
-  if (!bin)
-    return "";
+void DataCollector::writeBatch(uint16_t count) {
+  _lastFlush = millis();
+  size_t bytes = count * sizeof(TrainingSample);
+  if (_segmentSize > 0 && _segmentSize + bytes > SEGMENT_MAX) {
+    rotate();
+  }
 
-  File csv = LittleFS.open("/ai_training.csv", "w");
-  if (!csv) {
-    bin.close();
-    return "";
+  File f;
+  if (!openSegment(f)) {
+    Serial.println("[AI-DATA] Falha ao abrir segmento");
+    return;
   }
 
-  // Header
-  csv.println("rssi,snr,beacon_rate,probe_rate,deauth_rate,label");
-  // ... adicione todas as 56 headers
+  // Mais antiga primeiro; o anel pode dar a volta (duas escritas)
+  uint16_t tail = (_head + RING_SAMPLES - _count) % RING_SAMPLES;
+  uint16_t first = count;
+  if (tail + first > RING_SAMPLES)
+    first = RING_SAMPLES - tail;
+  size_t written = f.write((const uint8_t *)&_ring[tail],
+                           first * sizeof(TrainingSample));
+  if (first < count) {
+    written += f.write((const uint8_t *)_ring,
+                       (count - first) * sizeof(TrainingSample));
+  }
+  f.close();
 
-  TrainingSample s;
-  while (bin.read((uint8_t *)&s, sizeof(TrainingSample)) ==
-         sizeof(TrainingSample)) {
-    csv.printf("%.3f,%.3f,%.3f,%.3f,%.3f,%d\n", s.features.rssi_norm,
-               s.features.snr_norm, s.features.beacon_rate,
-               s.features.probereq_rate, s.features.deauth_rate, s.label);
+  _segmentSize += written;
+  if (written == bytes) {
+    _count -= count;
   }
+}
+
+bool DataCollector::openSegment(File &f) {
+  char path[40];
+  segmentPath(_lastSegment, path, sizeof(path));
 
-  bin.close();
-  csv.close();
-  return "/ai_training.csv";
+  if (_segmentSize == 0) {
+    f = LittleFS.open(path, "w");
+    if (!f)
+      return false;
+    DataLogHeader h;
+    fillHeader(h);
+    _segmentSize = f.write((const uint8_t *)&h, sizeof(h));
+    return _segmentSize == sizeof(h);
+  }
+  f = LittleFS.open(path, "a");
+  return (bool)f;
+}
+
+void DataCollector::rotate() {
+  _lastSegment++;
+  _segmentSize = 0;
+  if ((uint16_t)(_lastSegment - _keepFrom) >= MAX_SEGMENTS)
+    _keepFrom = _lastSegment - MAX_SEGMENTS + 1;
+  trimSegments();
+}
+
+// Apaga o que ficou antes de _keepFrom, se nenhuma exportação estiver lendo
+// (o cursor segura o arquivo aberto sem o _lock)
+void DataCollector::trimSegments() {
+  if (_exports > 0)
+    return;
+  char path[40];
+  while (_firstSegment != _keepFrom) {
+    segmentPath(_firstSegment, path, sizeof(path));
+    LittleFS.remove(path);
+    _firstSegment++;
+  }
 }
 
 void DataCollector::cleanOldData() {
-  LittleFS.remove("/ai_data/samples.bin");
+  if (_ready)
+    xSemaphoreTake(_lock, portMAX_DELAY);
+  if (_exports > 0) {
+    // Exportação lendo: o log recomeça num segmento novo e os antigos
+    // saem no endExport() da última
+    rotate();
+    _keepFrom = _lastSegment;
+  } else {
+    char path[40];
+    for (uint16_t i = _firstSegment; i != (uint16_t)(_lastSegment + 1); i++) {
+      segmentPath(i, path, sizeof(path));
+      LittleFS.remove(path);
+    }
+    _firstSegment = _keepFrom = _lastSegment = 0;
+    _segmentSize = 0;
+  }
+  LittleFS.remove(DATA_DIR "/samples.bin"); // Formato antigo, sem cabeçalho
+  _count = 0;
   _sampleCount = 0;
+  _dropped = 0;
+  if (_ready)
+    xSemaphoreGive(_lock);
+}
+
+void DataCollector::segmentPath(uint16_t index, char *out, size_t len) {
+  snprintf(out, len, DATA_DIR "/samples_%u.bin", index);
+}
+
+void DataCollector::fillHeader(DataLogHeader &h) {
+  memset(&h, 0, sizeof(h));
+  h.magic = DATA_LOG_MAGIC;
+  h.version = DATA_LOG_VERSION;
+  h.featureCount = NEURA9_FEATURE_COUNT;
+  h.recordSize = sizeof(TrainingSample);
+  h.labelCount = DATA_LOG_LABELS;
+
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < NEURA9_FEATURE_COUNT; i++) {
+    for (const char *c = NEURA9_FEATURE_NAMES[i]; *c; c++) {
+      hash = (hash ^ (uint8_t)*c) * 16777619u;
+    }
+    hash = (hash ^ ',') * 16777619u;
+  }
+  h.schemaHash = hash;
+
+  for (uint8_t i = 0; i < DATA_LOG_LABELS; i++) {
+    strncpy(h.labels[i], LABEL_NAMES[i], DATA_LOG_LABEL_LEN - 1);
+  }
+}
+
+bool DataCollector::headerMatches(File &f) {
+  DataLogHeader h, expected;
+  fillHeader(expected);
+  if (f.read((uint8_t *)&h, sizeof(h)) != sizeof(h))
+    return false;
+  return memcmp(&h, &expected, sizeof(h)) == 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// EXPORTAÇÃO EM STREAMING
+// ═══════════════════════════════════════════════════════════════════════════
+
+size_t DataCollector::formatCsvHeader(char *out, size_t len) {
+  size_t n = 0;
+  for (size_t i = 0; i < NEURA9_FEATURE_COUNT && n < len; i++) {
+    n += snprintf(out + n, len - n, "%s,", NEURA9_FEATURE_NAMES[i]);
+  }
+  if (n < len)
+    n += snprintf(out + n, len - n, "label,timestamp\n");
+  return n < len ? n : len - 1;
+}
+
+size_t DataCollector::formatCsvLine(const TrainingSample &s, char *out,
+                                    size_t len) {
+  const float *f = s.features.data();
+  size_t n = 0;
+  for (size_t i = 0; i < NEURA9_FEATURE_COUNT && n < len; i++) {
+    n += snprintf(out + n, len - n, "%.6g,", f[i]);
+  }
+  if (n < len)
+    n += snprintf(out + n, len - n, "%ld,%lu\n", (long)s.label,
+                  (unsigned long)s.timestamp);
+  return n < len ? n : len - 1;
+}
+
+void DataCollector::beginExport(ExportCursor &cursor, bool csv) {
+  flush();
+  cursor.csv = csv;
+  cursor.headerSent = false;
+  cursor.end = 0;
+  cursor.lineLen = 0;
+  cursor.linePos = 0;
+  cursor.active = _ready;
+  if (!_ready) {
+    // Sem log: só o cabeçalho
+    cursor.segment = 1;
+    cursor.lastSegment = 0;
+    return;
+  }
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _exports++;
+  cursor.segment = _keepFrom;
+  cursor.lastSegment = _lastSegment;
+  xSemaphoreGive(_lock);
+}
+
+void DataCollector::endExport(ExportCursor &cursor) {
+  if (!cursor.active)
+    return;
+  cursor.active = false;
+  if (cursor.file)
+    cursor.file.close();
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  _exports--;
+  trimSegments();
+  xSemaphoreGive(_lock);
+}
+
+size_t DataCollector::readExport(ExportCursor &c, uint8_t *buffer,
+                                 size_t maxLen) {
+  size_t written = 0;
+
+  while (written < maxLen) {
+    // 1. Resto da linha/cabeçalho que não coube no pedaço anterior
+    if (c.linePos < c.lineLen) {
+      size_t n = min((size_t)(c.lineLen - c.linePos), maxLen - written);
+      memcpy(buffer + written, c.line + c.linePos, n);
+      c.linePos += n;
+      written += n;
+      continue;
+    }
+
+    // 2. Cabeçalho único: nomes das colunas ou DataLogHeader
+    if (!c.headerSent) {
+      c.headerSent = true;
+      c.linePos = 0;
+      if (c.csv) {
+        c.lineLen = formatCsvHeader(c.line, sizeof(c.line));
+      } else {
+        DataLogHeader h;
+        fillHeader(h);
+        memcpy(c.line, &h, sizeof(h));
+        c.lineLen = sizeof(h);
+      }
+      continue;
+    }
+
+    if (c.segment == (uint16_t)(c.lastSegment + 1)) {
+      if (written == 0)
+        endExport(c);
+      break;
+    }
+
+    // 3. Abre o próximo segmento (pula os de outro esquema)
+    if (!c.file) {
+      char path[40];
+      segmentPath(c.segment, path, sizeof(path));
+      c.file = LittleFS.open(path, "r");
+      if (!c.file || !headerMatches(c.file)) {
+        if (c.file)
+          c.file.close();
+        c.segment++;
+        continue;
+      }
+      // Só registros inteiros (escrita interrompida deixa um pedaço)
+      uint32_t records = (c.file.size() - sizeof(DataLogHeader)) /
+                         sizeof(TrainingSample);
+      c.end = sizeof(DataLogHeader) + records * sizeof(TrainingSample);
+    }
+
+    uint32_t pos = c.file.position();
+    if (pos >= c.end) {
+      c.file.close();
+      c.segment++;
+      continue;
+    }
+
+    // 4. Registros: binário vai direto para o buffer, CSV uma linha por vez
+    if (!c.csv) {
+      size_t n = min((size_t)(c.end - pos), maxLen - written);
+      n = c.file.read(buffer + written, n);
+      if (n == 0) {
+        c.file.close();
+        c.segment++;
+        continue;
+      }
+      written += n;
+    } else {
+      TrainingSample s;
+      if (c.file.read((uint8_t *)&s, sizeof(s)) != sizeof(s)) {
+        c.file.close();
+        c.segment++;
+        continue;
+      }
+      c.lineLen = formatCsvLine(s, c.line, sizeof(c.line));
+      c.linePos = 0;
+    }
+  }
+  return written;
 }
@@ -3,30 +3,142 @@
 #include <Arduino.h>
 #include <FS.h>
 #include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
 /**
  * @file data_collector.h
  * @brief Tip 26: Auto-coleta de dados para treino
+ *
+ * As amostras entram num anel em PSRAM e vão para o LittleFS em lotes do
+ * tamanho de uma página, nunca uma abertura de arquivo por amostra. O log é
+ * dividido em segmentos com tamanho máximo (/ai_data/samples_N.bin); cada um
+ * começa com um DataLogHeader (versão do esquema, nº de features, rótulos).
+ *
+ * A exportação (CSV com as 56 colunas ou binário) é lida em pedaços direto
+ * dos segmentos, sem gerar arquivo intermediário. Enquanto houver uma
+ * exportação aberta nenhum segmento é apagado (rotação e limpeza só marcam);
+ * os atrasados saem quando a última termina.
  */
 
+#define DATA_LOG_MAGIC 0x4C44394E // "N9DL"
+#define DATA_LOG_VERSION 1
+#define DATA_LOG_LABELS 12  // RESULT_SAFE .. RESULT_PMKID_WEAK
+#define DATA_LOG_LABEL_LEN 16
+
 struct TrainingSample {
   Neura9Features features;
-  int label;
+  int32_t label;
   uint32_t timestamp;
 };
 
+/**
+ * @brief Cabeçalho de cada segmento do log
+ */
+struct DataLogHeader {
+  uint32_t magic;
+  uint16_t version;      // DATA_LOG_VERSION (formato do arquivo)
+  uint16_t featureCount; // NEURA9_FEATURE_COUNT
+  uint32_t schemaHash;   // FNV-1a dos nomes do esquema (ordem importa)
+  uint16_t recordSize;   // sizeof(TrainingSample)
+  uint16_t labelCount;
+  char labels[DATA_LOG_LABELS][DATA_LOG_LABEL_LEN];
+};
+
 class DataCollector {
 public:
+  static const uint16_t RING_SAMPLES = 64;     // ~15 KB em PSRAM
+  static const uint16_t PAGE_SIZE = 4096;      // Lote mínimo por escrita
+  static const uint32_t SEGMENT_MAX = 256 * 1024;
+  static const uint8_t MAX_SEGMENTS = 4;       // Rotação: apaga o mais antigo
+  static const uint32_t FLUSH_INTERVAL_MS = 60000;
+
+  /**
+   * @brief Posição de leitura de uma exportação em andamento
+   */
+  struct ExportCursor {
+    bool csv;
+    bool headerSent;
+    uint16_t segment;    // Índice atual (de _firstSegment a _lastSegment)
+    uint16_t lastSegment;
+    uint32_t end;        // Fim dos registros inteiros do segmento atual
+    File file;
+    char line[1536];     // Linha pendente (não coube no pedaço anterior)
+    uint16_t lineLen;
+    uint16_t linePos;
+    bool active;         // Conta em _exports até endExport()
+  };
+
   DataCollector();
   bool begin();
+
+  /**
+   * @brief Enfileira uma amostra (sem tocar no sistema de arquivos)
+   *
+   * Grava um lote quando o anel junta uma página ou passa
+   * FLUSH_INTERVAL_MS desde a última gravação.
+   */
   void logSample(const Neura9Features &features, int userLabel);
-  String createCSVExport();
+
+  /**
+   * @brief Grava tudo o que está no anel
+   */
+  void flush();
+
+  /**
+   * @brief Prepara uma exportação (grava o anel antes)
+   */
+  void beginExport(ExportCursor &cursor, bool csv);
+
+  /**
+   * @brief Preenche até maxLen bytes da exportação
+   * @return Bytes escritos, 0 no fim (e encerra a exportação)
+   */
+  size_t readExport(ExportCursor &cursor, uint8_t *buffer, size_t maxLen);
+
+  /**
+   * @brief Encerra a exportação e libera a remoção de segmentos
+   *
+   * Pode ser chamada mais de uma vez (fim dos dados e destruição do cursor
+   * quando o cliente desconecta no meio).
+   */
+  void endExport(ExportCursor &cursor);
+
   void cleanOldData();
 
+  uint32_t getSampleCount() const { return _sampleCount; }
+  uint16_t getPending() const { return _count; }
+  uint32_t getDropped() const { return _dropped; }
+
   // Legacy method fix/remove if not needed, but for now keep for compatibility
   // if called elsewhere
   void logFeatures(const Neura9Features &f, int label) { logSample(f, label); }
 
 private:
-  int _sampleCount;
+  TrainingSample *_ring;
+  uint16_t _head; // Próxima posição livre
+  uint16_t _count;
+  SemaphoreHandle_t _lock;
+
+  uint16_t _firstSegment; // Mais antigo ainda no flash
+  uint16_t _keepFrom;     // Início do log (antes dele: só espera remoção)
+  uint16_t _lastSegment;
+  uint8_t _exports;       // Exportações abertas (sob _lock)
+  uint32_t _segmentSize;
+  uint32_t _lastFlush;
+  uint32_t _sampleCount;
+  uint32_t _dropped;
+  bool _ready;
+
+  void writeBatch(uint16_t count);
+  bool openSegment(File &f);
+  void rotate();
+  void trimSegments();
+  static void segmentPath(uint16_t index, char *out, size_t len);
+  static void fillHeader(DataLogHeader &h);
+  static bool headerMatches(File &f);
+  static size_t formatCsvLine(const TrainingSample &s, char *out, size_t len);
+  static size_t formatCsvHeader(char *out, size_t len);
 };
+
+extern DataCollector dataCollector;
@@ -1,79 +1,142 @@
 #pragma once
 #include <Arduino.h>
+#include <string.h>
+
+#include "tiny_models.h"
 
 /**
  * @file tiny_classifiers.h
  * @brief Implementação dos classificadores "Tiny" (<2KB)
  *
  * Tips 14 (PMKID) e 15 (Handshake Strength)
+ *
+ * Os modelos são árvores treinadas em ai_training/train_tiny_classifiers.py
+ * e exportadas para tiny_models.h. A avaliação não aloca nem desvia por
+ * dados: cada nível da árvore é um índice calculado com uma comparação.
  */
 
-class TinyClassifiers {
-public:
-  // Tip 14: Diz se vale a pena atacar um PMKID capturado
-  // Retorna true se "Weak/Crackable", false se Hard
-  static bool isPmkidWeak(String ssid, String oui, uint8_t *pmkidData) {
-    // Heurística baseada em padrões de roteadores vulneráveis
-    // Ex: alguns TP-Links velhos geram PMKID previsível ou usam senhas default
-
-    // 1. Check OUI (Mac Address Prefix)
-    // D-Link, Huawei, TP-Link antigos muitas vezes vulneráveis
-    if (oui.startsWith("00:1D:60") || oui.startsWith("C8:3A:35")) {
-      return true;
+/**
+ * @brief Avalia um conjunto de árvores completas (bias + soma das folhas)
+ *
+ * Mesma ordem de soma float32 do gerador, então a saída é idêntica bit a bit
+ * à do modelo em Python.
+ */
+inline float tinyTreeEval(const TinyTreeModel &m, const float *x) {
+  const uint16_t inner = (1u << m.depth) - 1;
+  float sum = m.bias;
+  for (uint8_t t = 0; t < m.trees; t++) {
+    const uint8_t *feature = m.feature + t * inner;
+    const float *threshold = m.threshold + t * inner;
+    uint16_t n = 0;
+    for (uint8_t d = 0; d < m.depth; d++) {
+      n = 2 * n + 1 + (x[feature[n]] > threshold[n]);
     }
+    sum += m.leaf[t * (inner + 1) + n - inner];
+  }
+  return sum;
+}
 
-    // 2. Check SSID entropy
-    // SSID padrão "VIVO-1234" é mais provável de ser fraco que
-    // "MinhaCasaSegura"
-    if (ssid.length() < 5)
-      return true; // Curto demais?
+/**
+ * @brief Features de uma rede para o modelo de PMKID
+ *
+ * Calculadas uma vez por rede (no scan), não a cada consulta.
+ */
+struct PmkidFeatures {
+  float x[PMKID_FEATURE_COUNT];
 
-    // Se SSID termina com 4 dígitos hexa/numerais, alta chance de default
-    // password Ex: Net_2G_8E4A
-    int digitCount = 0;
-    for (int i = 0; i < ssid.length(); i++) {
-      if (isDigit(ssid.charAt(i)))
-        digitCount++;
+  static uint32_t ouiOf(const uint8_t *bssid) {
+    return ((uint32_t)bssid[0] << 16) | ((uint32_t)bssid[1] << 8) | bssid[2];
+  }
+
+  static PmkidFeatures from(const char *ssid, const uint8_t *bssid) {
+    PmkidFeatures f;
+    memset(&f, 0, sizeof(f));
+    f.x[PMKID_F_OUI] = bssid ? (float)ouiOf(bssid) : 0.0f;
+
+    size_t len = ssid ? strnlen(ssid, 32) : 0;
+    uint8_t digits = 0, upper = 0, trailingHex = 0;
+    bool underscore = false, dash = false;
+    for (size_t i = 0; i < len; i++) {
+      char c = ssid[i];
+      digits += (c >= '0' && c <= '9');
+      upper += (c >= 'A' && c <= 'Z');
+      underscore |= (c == '_');
+      dash |= (c == '-');
+      // Sufixo hexa: zera a cada caractere que não é hexa
+      trailingHex = isxdigit((unsigned char)c) ? trailingHex + 1 : 0;
     }
+    f.x[PMKID_F_SSID_LEN] = len;
+    f.x[PMKID_F_DIGITS] = digits;
+    f.x[PMKID_F_UNDERSCORE] = underscore;
+    f.x[PMKID_F_DASH] = dash;
+    f.x[PMKID_F_TRAILING_HEX] = trailingHex;
+    f.x[PMKID_F_UPPER] = upper;
+    return f;
+  }
+};
 
-    if (digitCount >= 4 && ssid.indexOf('_') != -1)
-      return true;
+class TinyClassifiers {
+public:
+  // Tip 14: Probabilidade de um PMKID capturado ser "Weak/Crackable"
+  static float pmkidWeakScore(const PmkidFeatures &features) {
+    return tinyTreeEval(PMKID_MODEL, features.x);
+  }
 
-    return false;
+  // Tip 14: Diz se vale a pena atacar um PMKID capturado
+  // Retorna true se "Weak/Crackable", false se Hard
+  static bool isPmkidWeak(const PmkidFeatures &features) {
+    return pmkidWeakScore(features) > 0.5f;
+  }
+
+  static bool isPmkidWeak(const char *ssid, const uint8_t *bssid) {
+    return isPmkidWeak(PmkidFeatures::from(ssid, bssid));
   }
 
   // Tip 15: Prediz força do handshake capturado (Quality Score 0-100)
   static int predictHandshakeStrength(int halfHandshakes, int anonces, int snr,
                                       int gapMs) {
-    int score = 0;
-
-    // Precisa dos 4-way complete (M1+M2 ou M2+M3 pelo menos)
-    // Aqui assumimos que "halfHandshakes" conta pares válidos
-    if (halfHandshakes >= 1)
-      score += 50;
-    if (halfHandshakes >= 2)
-      score += 30; // 4-way complete
-
-    if (anonces > 0)
-      score += 10;
-
-    // SNR influencia qualidade da captura e chance de corrupção
-    if (snr > -60)
-      score += 10;
-    else if (snr > -80)
-      score += 5;
-
-    // Gap muito grande sugere retransmissão ou perda
-    if (gapMs < 100)
-      score += 0; // Ideal
-    else if (gapMs > 500)
-      score -= 20;
+    float x[HANDSHAKE_FEATURE_COUNT];
+    x[HANDSHAKE_F_HALF] = halfHandshakes;
+    x[HANDSHAKE_F_ANONCES] = anonces;
+    x[HANDSHAKE_F_SNR] = snr;
+    x[HANDSHAKE_F_GAP_MS] = gapMs;
 
+    int score = (int)lrintf(tinyTreeEval(HANDSHAKE_MODEL, x));
     if (score > 100)
       score = 100;
     if (score < 0)
       score = 0;
-
     return score;
   }
+
+  /**
+   * @brief Confere os vetores de teste gerados junto com os modelos
+   * @return true se todas as saídas batem bit a bit com o Python
+   */
+  static bool selfTest() {
+    uint8_t fails =
+        checkVectors(PMKID_MODEL, PMKID_TEST_X, PMKID_TEST_Y, PMKID_TEST_COUNT,
+                     PMKID_FEATURE_COUNT) +
+        checkVectors(HANDSHAKE_MODEL, HANDSHAKE_TEST_X, HANDSHAKE_TEST_Y,
+                     HANDSHAKE_TEST_COUNT, HANDSHAKE_FEATURE_COUNT);
+    if (fails) {
+      Serial.printf("[TINY] FALHA: %u predições diferentes do modelo treinado\n",
+                    fails);
+      return false;
+    }
+    Serial.println("[TINY] Classificadores conferidos com o modelo treinado");
+    return true;
+  }
+
+private:
+  static uint8_t checkVectors(const TinyTreeModel &m, const float *xs,
+                              const float *ys, uint8_t count,
+                              uint8_t features) {
+    uint8_t fails = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      float y = tinyTreeEval(m, xs + i * features);
+      fails += memcmp(&y, &ys[i], sizeof(float)) != 0;
+    }
+    return fails;
+  }
 };
@@ -0,0 +1,131 @@
+#pragma once
+/**
+ * @file tiny_models.h
+ * @brief Árvores dos classificadores Tiny (GERADO, não editar)
+ *
+ * Gerador: ai_training/train_tiny_classifiers.py
+ */
+
+#include <stdint.h>
+
+/**
+ * @brief Conjunto de árvores completas de mesma profundidade
+ *
+ * Nó n desce para 2n + 1 + (x[feature[n]] > threshold[n]); as folhas
+ * ficam em leaf[n - (2^depth - 1)]. Saída = bias + soma das folhas.
+ */
+struct TinyTreeModel {
+  uint8_t depth;
+  uint8_t trees;
+  const uint8_t *feature;  // trees * (2^depth - 1)
+  const float *threshold;  // trees * (2^depth - 1)
+  const float *leaf;       // trees * 2^depth
+  float bias;
+};
+
+// pmkid: 1 árvore(s), profundidade 4
+enum PmkidFeature : uint8_t {
+  PMKID_F_OUI = 0,
+  PMKID_F_SSID_LEN = 1,
+  PMKID_F_DIGITS = 2,
+  PMKID_F_UNDERSCORE = 3,
+  PMKID_F_DASH = 4,
+  PMKID_F_TRAILING_HEX = 5,
+  PMKID_F_UPPER = 6,
+  PMKID_FEATURE_COUNT = 7
+};
+
+constexpr uint8_t PMKID_TREE_FEATURE[] = {
+    1, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+constexpr float PMKID_TREE_THRESHOLD[] = {
+    4.5f, 3.00000001e+38f, 3.5f, 3.00000001e+38f, 3.00000001e+38f, 32470.0f,
+    0.5f, 3.00000001e+38f, 3.00000001e+38f, 3.00000001e+38f, 3.00000001e+38f, 7109.5f,
+    11835131.0f, 32470.0f, 3.00000001e+38f,
+};
+constexpr float PMKID_TREE_LEAF[] = {
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.258264452f,
+    0.75f, 0.107843138f, 1.0f, 1.0f,
+};
+constexpr TinyTreeModel PMKID_MODEL = {
+    4, 1, PMKID_TREE_FEATURE,
+    PMKID_TREE_THRESHOLD, PMKID_TREE_LEAF,
+    0.0f};
+
+// Vetores de teste: entrada -> saída esperada (bit a bit)
+constexpr float PMKID_TEST_X[] = {
+    2895923.0f, 10.0f, 3.0f, 1.0f, 0.0f, 4.0f, 6.0f,
+    6054539.0f, 12.0f, 2.0f, 0.0f, 1.0f, 5.0f, 9.0f,
+    15242486.0f, 12.0f, 3.0f, 1.0f, 1.0f, 4.0f, 7.0f,
+    2895923.0f, 14.0f, 2.0f, 1.0f, 1.0f, 6.0f, 10.0f,
+    57420.0f, 3.0f, 1.0f, 0.0f, 0.0f, 2.0f, 1.0f,
+    10548161.0f, 17.0f, 0.0f, 0.0f, 0.0f, 0.0f, 3.0f,
+    7520.0f, 13.0f, 4.0f, 0.0f, 1.0f, 6.0f, 8.0f,
+    1362976.0f, 9.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f,
+    16052845.0f, 12.0f, 4.0f, 1.0f, 1.0f, 5.0f, 3.0f,
+    2895923.0f, 18.0f, 2.0f, 1.0f, 0.0f, 2.0f, 3.0f,
+    1362976.0f, 13.0f, 3.0f, 1.0f, 0.0f, 3.0f, 2.0f,
+    3966058.0f, 8.0f, 3.0f, 0.0f, 0.0f, 3.0f, 1.0f,
+};
+constexpr float PMKID_TEST_Y[] = {
+    0.0f, 0.0f, 0.258264452f, 0.0f, 1.0f, 0.0f,
+    0.75f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+};
+constexpr uint8_t PMKID_TEST_COUNT = 12;
+
+// handshake: 24 árvore(s), profundidade 1
+enum HandshakeFeature : uint8_t {
+  HANDSHAKE_F_HALF = 0,
+  HANDSHAKE_F_ANONCES = 1,
+  HANDSHAKE_F_SNR = 2,
+  HANDSHAKE_F_GAP_MS = 3,
+  HANDSHAKE_FEATURE_COUNT = 4
+};
+
+constexpr uint8_t HANDSHAKE_TREE_FEATURE[] = {
+    0, 0, 0, 3, 0, 3, 1, 0, 2, 3, 2, 1, 0, 3, 0, 2,
+    1, 2, 3, 0, 1, 2, 0, 3,
+};
+constexpr float HANDSHAKE_TREE_THRESHOLD[] = {
+    0.5f, 1.5f, 1.5f, 500.5f, 0.5f, 501.5f,
+    0.5f, 0.5f, -59.5f, 500.5f, -79.5f, 0.5f,
+    1.5f, 500.5f, 0.5f, -77.5f, 0.5f, -59.5f,
+    499.5f, 0.5f, 0.5f, -79.5f, 1.5f, 500.5f,
+};
+constexpr float HANDSHAKE_TREE_LEAF[] = {
+    -25.2210464f, 8.05210209f, -9.43303776f, 9.07521152f, -4.71651888f, 4.53760576f,
+    4.58248281f, -4.57027912f, -5.58922482f, 1.78442264f, 2.3060205f, -2.31217813f,
+    -3.29819751f, 1.09744561f, -2.86773539f, 0.915556729f, -1.44184637f, 1.75988507f,
+    1.16178834f, -1.15869439f, -1.90243924f, 0.619574785f, -1.66700315f, 0.554680347f,
+    -0.889002323f, 0.855279505f, 0.582835436f, -0.581283271f, -1.01216221f, 0.323144138f,
+    -0.885051608f, 0.340215981f, -0.844873786f, 0.281124145f, -0.3165887f, 0.386420995f,
+    0.301990688f, -0.300384372f, -0.515033126f, 0.164430097f, -0.425446838f, 0.141563609f,
+    -0.354337424f, 0.115398444f, -0.186186016f, 0.179123372f, 0.152818322f, -0.152411357f,
+};
+constexpr TinyTreeModel HANDSHAKE_MODEL = {
+    1, 24, HANDSHAKE_TREE_FEATURE,
+    HANDSHAKE_TREE_THRESHOLD, HANDSHAKE_TREE_LEAF,
+    57.4599991f};
+
+// Vetores de teste: entrada -> saída esperada (bit a bit)
+constexpr float HANDSHAKE_TEST_X[] = {
+    1.0f, 1.0f, -72.0f, 241.0f,
+    1.0f, 1.0f, -44.0f, 225.0f,
+    2.0f, 2.0f, -53.0f, 41.0f,
+    2.0f, 0.0f, -35.0f, 312.0f,
+    1.0f, 0.0f, -42.0f, 14.0f,
+    3.0f, 3.0f, -30.0f, 224.0f,
+    2.0f, 0.0f, -83.0f, 519.0f,
+    0.0f, 0.0f, -73.0f, 726.0f,
+    0.0f, 2.0f, -53.0f, 387.0f,
+    1.0f, 2.0f, -76.0f, 873.0f,
+    0.0f, 3.0f, -30.0f, 120.0f,
+    1.0f, 2.0f, -67.0f, 102.0f,
+};
+constexpr float HANDSHAKE_TEST_Y[] = {
+    63.9544106f, 67.8591614f, 97.7311249f, 89.4207993f, 59.5488129f, 97.7311249f,
+    63.1358604f, -8.96394444f, 21.4143047f, 45.7912445f, 21.4143047f, 63.9544106f,
+};
+constexpr uint8_t HANDSHAKE_TEST_COUNT = 12;
+
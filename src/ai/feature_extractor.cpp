@@ -1,18 +1,22 @@
 #include "feature_extractor.h"
 
-FeatureExtractor::FeatureExtractor() { resetWindow(); }
-
-void FeatureExtractor::resetWindow() {
-  _currentFeatures.reset();
-  _frameCount = 0;
-  _rssiSum = 0;
-  _frameCount = 0;
-  _rssiSum = 0;
-  _packetSizeSum = 0;
-  _lastPacketTime = 0;
-  _maxBurst = 0;
-  _currentBurst = 0;
-  _windowStartTime = millis();
+// Gap abaixo disso conta como rajada
+#define BURST_GAP_US 5000
+
+void FeatureWindow::reset(uint32_t nowUs) {
+  memset(this, 0, sizeof(FeatureWindow));
+  startUs = nowUs;
+  endUs = nowUs;
+  lastFrameUs = nowUs;
+}
+
+FeatureExtractor::FeatureExtractor()
+    : _writeIdx(0), _sealed(false), _windowUs(DEFAULT_WINDOW_MS * 1000),
+      _sealedAtUs(0), _notifyTask(NULL),
+      _bssidSnapshotCount(0), _lastConsumeMs(0), _windowCount(0) {
+  _windows[0].reset(0);
+  _windows[1].reset(0);
+  _cachedNormalized.reset();
 }
 
 // Auxiliar para entropia simples (Shannon approx)
@@ -32,125 +36,362 @@ float calculateEntropy(const uint8_t *data, size_t len) {
   return entropy;
 }
 
-void FeatureExtractor::update(int rssi, int channel, uint8_t frameType,
-                              uint8_t frameSubtype, bool isProtected,
-                              bool isRetry, uint32_t timestamp) {
-  _frameCount++;
-  _rssiSum += rssi;
-
-  // Packet Gap & Burst Analysis
-  uint32_t dt = timestamp - _lastPacketTime;
-  if (dt < 5) { // < 5ms considera burst
-    _currentBurst++;
-  } else {
-    if (_currentBurst > _maxBurst)
-      _maxBurst = _currentBurst;
-    _currentBurst = 0;
-  }
-  _lastPacketTime = timestamp;
-
-  // Frame Size Analysis (Simulado pois não passamos len, assumindo média por
-  // tipo)
-  int estimatedLen = 0;
-  if (frameType == 0)
-    estimatedLen = 100; // Mgmt
-  if (frameType == 1)
-    estimatedLen = 24; // Ctrl
-  if (frameType == 2)
-    estimatedLen = 500; // Data
-  _packetSizeSum += estimatedLen;
-
-  // Tipo de Frame (Management = 0, Control = 1, Data = 2)
-  if (frameType == 0) {
-    _currentFeatures.management_frame_ratio += 1.0f;
-    // Subtipos Mgmt
-    if (frameSubtype == 8)
-      _currentFeatures.beacon_rate += 1.0f;
-    if (frameSubtype == 4)
-      _currentFeatures.probereq_rate += 1.0f;
-    if (frameSubtype == 12) {
-      _currentFeatures.deauth_rate += 1.0f;
-      _currentFeatures.deauth_reason_code_dist +=
-          1.0f; // Simplified: count occurrences
+// ═══════════════════════════════════════════════════════════════════════════
+// PRODUTOR (TASK DE CAPTURA)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static BssidWindow *find_bssid(FeatureWindow &w, const uint8_t *bssid) {
+  for (uint8_t i = 0; i < w.bssidCount; i++) {
+    if (memcmp(w.bssids[i].bssid, bssid, 6) == 0) {
+      return &w.bssids[i];
+    }
+  }
+  if (w.bssidCount >= FeatureWindow::MAX_BSSIDS) {
+    return nullptr;
+  }
+  BssidWindow *b = &w.bssids[w.bssidCount++];
+  memcpy(b->bssid, bssid, 6);
+  b->lastSeq = 0xFFFF;
+  return b;
+}
+
+// Percorre os Information Elements: hash dos IDs e presença de WPS
+static void scan_ies(FeatureWindow &w, const uint8_t *ie, const uint8_t *end) {
+  uint32_t hash = 2166136261u; // FNV-1a
+  while (ie + 2 <= end && ie + 2 + ie[1] <= end) {
+    hash = (hash ^ ie[0]) * 16777619u;
+    if (ie[0] == 221 && ie[1] >= 4 && ie[2] == 0x00 && ie[3] == 0x50 &&
+        ie[4] == 0xF2 && ie[5] == 0x04) {
+      w.wpsFrames++;
     }
-    if (frameSubtype == 0)
-      _currentFeatures.assocreq_rate += 1.0f;
-  } else if (frameType == 1) {
-    _currentFeatures.control_frame_ratio += 1.0f;
-  } else if (frameType == 2) {
-    _currentFeatures.data_frame_ratio += 1.0f;
-    if (frameSubtype == 0)
-      _currentFeatures.data_frame_ratio += 1.0f; // Data normal
-    if (frameSubtype == 4)
-      _currentFeatures.null_probe_ratio += 1.0f; // Null function
-  }
-
-  // Flags
-  if (isRetry)
-    _currentFeatures.retry_flag_ratio += 1.0f;
-  if (isProtected)
-    _currentFeatures.protected_flag_ratio += 1.0f;
-
-  // EAPOL Check (Subtype não é suficiente, seria necessário olhar EthereType,
-  // assumindo que quem chamou sabe filtrar ou isso é aproximado)
-  if (isProtected && estimatedLen > 100) {
-    _currentFeatures.eapol_key_rate += 1.0f; // Heuristica fraca
+    ie += 2 + ie[1];
   }
+  w.ieHash ^= hash;
 }
 
-const Neura9Features &FeatureExtractor::getFeatures() const {
-  // Usamos const_cast para atualizar o cache "lazy" sem remover const da
-  // assinatura
-  Neura9Features &result =
-      const_cast<FeatureExtractor *>(this)->_cachedNormalized;
-  result = _currentFeatures; // Inicia com somas brutas
-
-  if (_frameCount > 0) {
-    float durationSec = (millis() - _windowStartTime) / 1000.0f;
-    if (durationSec < 0.1f)
-      durationSec = 0.1f;
-
-    // Normaliza RSSI
-    float avgRssi = (float)_rssiSum / _frameCount;
-    result.rssi_norm = constrain((avgRssi + 100.0f) / 100.0f, 0.0f, 1.0f);
-
-    // Ratas por segundo
-    result.beacon_rate = (_currentFeatures.beacon_rate / durationSec) / 100.0f;
-    result.probereq_rate =
-        (_currentFeatures.probereq_rate / durationSec) / 100.0f;
-    result.deauth_rate = (_currentFeatures.deauth_rate / durationSec) / 50.0f;
-
-    // Proporções
-    result.management_frame_ratio =
-        _currentFeatures.management_frame_ratio / _frameCount;
-    result.data_frame_ratio = _currentFeatures.data_frame_ratio / _frameCount;
-    result.control_frame_ratio =
-        _currentFeatures.control_frame_ratio / _frameCount;
-    result.retry_flag_ratio = _currentFeatures.retry_flag_ratio / _frameCount;
-    result.protected_flag_ratio =
-        _currentFeatures.protected_flag_ratio / _frameCount;
-
-    // New Features Normalization
-    result.packet_size_avg =
-        (_packetSizeSum / _frameCount) / 1500.0f; // Norm 0-1
-    result.max_burst_size = _maxBurst / 50.0f;    // Assumindo burst max 50
-    result.eapol_key_rate =
-        (_currentFeatures.eapol_key_rate / durationSec) / 10.0f;
-    result.null_probe_ratio = _currentFeatures.null_probe_ratio / _frameCount;
-
-    // Entropy / Noise (Random simulation for demo if not driven by real data)
-    result.channel_utilization =
-        (_frameCount * 10.0f) / 1000.0f; // Crude util estimate
-
-    // Limita 0.0 - 1.0
-    result.beacon_rate = constrain(result.beacon_rate, 0.0f, 1.0f);
-    result.probereq_rate = constrain(result.probereq_rate, 0.0f, 1.0f);
-    result.deauth_rate = constrain(result.deauth_rate, 0.0f, 1.0f);
-    result.channel_utilization =
-        constrain(result.channel_utilization, 0.0f, 1.0f);
-  } else {
-    result.reset();
-  }
-
-  return result;
+void FeatureExtractor::update(const uint8_t *frame, uint16_t len, int8_t rssi,
+                              int8_t noiseFloor, uint8_t channel,
+                              uint32_t timestampUs) {
+  if (!frame || len < 10) {
+    return;
+  }
+
+  // Fim de janela: só troca se a IA já consumiu a anterior
+  FeatureWindow *w = &_windows[_writeIdx];
+  if (w->startUs == 0) {
+    w->reset(timestampUs);
+  } else if (timestampUs - w->startUs >= _windowUs &&
+             !_sealed.load(std::memory_order_acquire)) {
+    seal(timestampUs);
+    w = &_windows[_writeIdx];
+  }
+
+  uint8_t fc0 = frame[0];
+  uint8_t fc1 = frame[1];
+  uint8_t type = (fc0 >> 2) & 0x03;
+  uint8_t subtype = (fc0 >> 4) & 0x0F;
+  bool toDS = fc1 & 0x01;
+  bool fromDS = fc1 & 0x02;
+  bool isProtected = fc1 & 0x40;
+
+  w->frames++;
+  w->rssiSum += rssi;
+  w->noiseSum += noiseFloor;
+  w->size.add(len);
+
+  // Gaps e rajadas
+  if (w->frames > 1) {
+    uint32_t dt = timestampUs - w->lastFrameUs;
+    w->gap.add(dt);
+    if (dt < BURST_GAP_US) {
+      w->burst++;
+      if (w->burst > w->maxBurst) {
+        w->maxBurst = w->burst;
+      }
+    } else {
+      w->burst = 0;
+    }
+  }
+  w->lastFrameUs = timestampUs;
+
+  if (w->lastChannel && channel != w->lastChannel) {
+    w->channelSwitches++;
+  }
+  w->lastChannel = channel;
+
+  // Flags e NAV (bit 15 setado não é duração)
+  if (fc1 & 0x08) {
+    w->retry++;
+  }
+  if (isProtected) {
+    w->protectedFrames++;
+  }
+  if (fc1 & 0x04) {
+    w->fragments++;
+  }
+  uint16_t nav = frame[2] | (frame[3] << 8);
+  if (!(nav & 0x8000)) {
+    w->durationSum += nav;
+  }
+
+  const uint8_t *addr1 = frame + 4;
+  if (addr1[0] & 0x01) {
+    bool bcast = (addr1[0] & addr1[1] & addr1[2] & addr1[3] & addr1[4] &
+                  addr1[5]) == 0xFF;
+    if (bcast) {
+      w->broadcast++;
+    } else {
+      w->multicast++;
+    }
+  }
+
+  if (type == 1) {
+    w->ctrl++;
+    return; // Controle não tem addr3 nem sequence number
+  }
+  if (len < 24) {
+    return;
+  }
+
+  // BSSID conforme os bits DS; WDS (4 endereços) fica sem BSSID
+  const uint8_t *bssid = nullptr;
+  if (type == 0 || (!toDS && !fromDS)) {
+    bssid = frame + 16;
+  } else if (toDS && !fromDS) {
+    bssid = frame + 4;
+  } else if (fromDS && !toDS) {
+    bssid = frame + 10;
+  }
+
+  uint16_t seqCtl = frame[22] | (frame[23] << 8);
+  if (seqCtl & 0x000F) {
+    w->fragments++;
+  }
+
+  BssidWindow *b = nullptr;
+  if (bssid) {
+    b = find_bssid(*w, bssid);
+    if (b) {
+      b->frames++;
+      b->rssiSum += rssi;
+      // Saltos de sequência só fazem sentido para o próprio AP
+      const uint8_t *ta = frame + 10;
+      if (memcmp(ta, bssid, 6) == 0 && !(fc1 & 0x08)) {
+        uint16_t seq = seqCtl >> 4;
+        if (b->lastSeq != 0xFFFF) {
+          uint16_t delta = (seq - b->lastSeq) & 0x0FFF;
+          w->seqSamples++;
+          w->seqDeltaSum += delta;
+          if (delta > 1) {
+            w->seqGaps++;
+            b->seqGaps++;
+          }
+        }
+        b->lastSeq = seq;
+      }
+    } else {
+      w->bssidOverflow++;
+    }
+  }
+
+  if (type == 0) {
+    w->mgmt++;
+    const uint8_t *end = frame + len;
+    switch (subtype) {
+    case 0: // Assoc request
+      w->assocReq++;
+      scan_ies(*w, frame + 28, end);
+      break;
+    case 4: // Probe request
+      w->probeReq++;
+      if (len >= 26 && frame[24] == 0 && frame[25] == 0) {
+        w->nullProbes++;
+      }
+      // MAC localmente administrado (aleatório)
+      if ((frame[10] & 0x02) && !(frame[10] & 0x01)) {
+        w->randomMacProbes++;
+      }
+      scan_ies(*w, frame + 24, end);
+      break;
+    case 5: // Probe response
+      scan_ies(*w, frame + 36, end);
+      break;
+    case 8: // Beacon
+      w->beacons++;
+      if (b) {
+        b->beacons++;
+      }
+      scan_ies(*w, frame + 36, end);
+      break;
+    case 10: // Disassoc
+    case 12: // Deauth
+      w->deauths++;
+      if (b) {
+        b->deauths++;
+      }
+      if (len >= 26) {
+        // Fora dos motivos comuns de saída/inatividade (3, 4, 8)
+        uint16_t reason = frame[24] | (frame[25] << 8);
+        if (reason != 3 && reason != 4 && reason != 8) {
+          w->oddReasons++;
+        }
+      }
+      break;
+    default:
+      break;
+    }
+    return;
+  }
+
+  // Dados: procura LLC/SNAP com EtherType 802.1X (EAPOL)
+  w->data++;
+  if (isProtected) {
+    return;
+  }
+  uint16_t hdr = 24;
+  if (toDS && fromDS) {
+    hdr += 6;
+  }
+  if (subtype & 0x08) {
+    hdr += 2; // QoS
+  }
+  if (len >= hdr + 10) {
+    const uint8_t *llc = frame + hdr;
+    if (llc[0] == 0xAA && llc[1] == 0xAA && llc[6] == 0x88 &&
+        llc[7] == 0x8E) {
+      w->eapol++;
+      if (b) {
+        b->eapol++;
+      }
+      uint8_t eapolType = llc[9];
+      if (eapolType == 1) {
+        w->eapolStart++;
+      } else if (eapolType == 3) {
+        w->eapolKey++;
+      }
+    }
+  }
+}
+
+void FeatureExtractor::seal(uint32_t nowUs) {
+  _windows[_writeIdx].endUs = nowUs;
+  _writeIdx ^= 1;
+  _windows[_writeIdx].reset(nowUs);
+  // nowUs vem do relógio do rádio; a idade é medida com micros()
+  _sealedAtUs = micros();
+  // Publica: tudo escrito na janela selada fica visível antes da flag
+  _sealed.store(true, std::memory_order_release);
+  if (_notifyTask)
+    xTaskNotifyGive(_notifyTask);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CONSUMIDOR (TASK DE IA)
+// ═══════════════════════════════════════════════════════════════════════════
+
+const Neura9Features &FeatureExtractor::getFeatures() {
+  uint32_t now = millis();
+
+  if (_sealed.load(std::memory_order_acquire)) {
+    normalize(_windows[_writeIdx ^ 1]);
+    _windowCount++;
+    _lastConsumeMs = now;
+    // Libera a janela para o produtor reutilizar
+    _sealed.store(false, std::memory_order_release);
+  } else if (now - _lastConsumeMs > 3 * (_windowUs / 1000)) {
+    // Sem captura (nenhum frame fecha a janela): não há tráfego a descrever
+    _cachedNormalized.reset();
+    _bssidSnapshotCount = 0;
+  }
+
+  return _cachedNormalized;
+}
+
+uint8_t FeatureExtractor::getBssidWindows(BssidWindow *out,
+                                          uint8_t maxCount) const {
+  uint8_t n = _bssidSnapshotCount < maxCount ? _bssidSnapshotCount : maxCount;
+  memcpy(out, _bssidSnapshot, n * sizeof(BssidWindow));
+  return n;
+}
+
+void FeatureExtractor::normalize(const FeatureWindow &w) {
+  Neura9Features &result = _cachedNormalized;
+  result.reset();
+
+  _bssidSnapshotCount = w.bssidCount;
+  memcpy(_bssidSnapshot, w.bssids, w.bssidCount * sizeof(BssidWindow));
+
+  if (w.frames == 0) {
+    return;
+  }
+
+  float durationSec = (w.endUs - w.startUs) / 1000000.0f;
+  if (durationSec < 0.1f)
+    durationSec = 0.1f;
+  float frames = (float)w.frames;
+
+  // RSSI, SNR e ruído
+  float avgRssi = (float)w.rssiSum / frames;
+  float avgNoise = (float)w.noiseSum / frames;
+  result.rssi_norm = constrain((avgRssi + 100.0f) / 100.0f, 0.0f, 1.0f);
+  result.snr_norm = constrain((avgRssi - avgNoise) / 60.0f, 0.0f, 1.0f);
+  result.noise_floor_est = constrain((avgNoise + 100.0f) / 100.0f, 0.0f, 1.0f);
+
+  // Taxas por segundo
+  result.beacon_rate = constrain(w.beacons / durationSec / 100.0f, 0.0f, 1.0f);
+  result.probereq_rate =
+      constrain(w.probeReq / durationSec / 100.0f, 0.0f, 1.0f);
+  result.deauth_rate = constrain(w.deauths / durationSec / 50.0f, 0.0f, 1.0f);
+  result.assocreq_rate =
+      constrain(w.assocReq / durationSec / 50.0f, 0.0f, 1.0f);
+  result.eapol_rate = constrain(w.eapol / durationSec / 10.0f, 0.0f, 1.0f);
+  result.eapol_start_rate =
+      constrain(w.eapolStart / durationSec / 10.0f, 0.0f, 1.0f);
+  result.eapol_key_rate =
+      constrain(w.eapolKey / durationSec / 10.0f, 0.0f, 1.0f);
+  result.channel_switch_rate =
+      constrain(w.channelSwitches / durationSec / 10.0f, 0.0f, 1.0f);
+
+  // Proporções
+  result.management_frame_ratio = w.mgmt / frames;
+  result.data_frame_ratio = w.data / frames;
+  result.control_frame_ratio = w.ctrl / frames;
+  result.retry_flag_ratio = w.retry / frames;
+  result.protected_flag_ratio = w.protectedFrames / frames;
+  result.broadcast_ratio = w.broadcast / frames;
+  result.multicast_ratio = w.multicast / frames;
+  result.fragment_rate = constrain(w.fragments / frames, 0.0f, 1.0f);
+  if (w.mgmt > 0) {
+    result.wps_frame_ratio = constrain((float)w.wpsFrames / w.mgmt, 0.0f, 1.0f);
+  }
+  if (w.probeReq > 0) {
+    result.null_probe_ratio = (float)w.nullProbes / w.probeReq;
+    result.mac_randomness_score = (float)w.randomMacProbes / w.probeReq;
+  }
+  if (w.deauths > 0) {
+    result.deauth_reason_code_dist = (float)w.oddReasons / w.deauths;
+  }
+  if (w.seqSamples > 0) {
+    result.sequence_gap_score = (float)w.seqGaps / w.seqSamples;
+    result.sequence_number_delta_avg =
+        constrain((float)w.seqDeltaSum / w.seqSamples / 4096.0f, 0.0f, 1.0f);
+  }
+
+  result.duration_field_avg = (w.durationSum / frames) / 32767.0f;
+  result.information_elt_hash = (w.ieHash & 0xFFFF) / 65535.0f;
+
+  // Tamanhos reais (Welford)
+  result.packet_size_avg = constrain(w.size.mean / 1500.0f, 0.0f, 1.0f);
+  result.packet_size_std_dev =
+      constrain(sqrtf(w.size.variance()) / 1500.0f, 0.0f, 1.0f);
+
+  // Temporais: gaps normalizados por 100 ms
+  result.max_burst_size = constrain(w.maxBurst / 50.0f, 0.0f, 1.0f);
+  result.avg_inter_packet_gap = constrain(w.gap.mean / 100000.0f, 0.0f, 1.0f);
+  result.gap_variance =
+      constrain(w.gap.variance() / (100000.0f * 100000.0f), 0.0f, 1.0f);
+
+  // Ocupação aproximada: frames por segundo / 1000
+  result.channel_utilization =
+      constrain(frames / durationSec / 1000.0f, 0.0f, 1.0f);
 }
@@ -1,8 +1,15 @@
 #pragma once
+#include "neura9_feature_schema.h"
 #include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <stddef.h>
 #include <vector>
 
-// Estrutura de features otimizada (56 features como sugerido no Tip 2)
+// Estrutura de features otimizada (56 features como sugerido no Tip 2).
+// Ordem e faixas vêm de ai_training/neura9_features.json: a struct é o
+// próprio tensor de entrada (56 floats contíguos), validado abaixo.
 struct Neura9Features {
   float rssi_norm;
   float snr_norm;
@@ -57,40 +64,158 @@ struct Neura9Features {
 
   // Extra placeholders to reach exactly 56 float inputs (56 * 4 = 224 bytes
   // input tensor)
-  float reserved_features[20];
+  float reserved_features[NEURA9_RESERVED_FEATURES];
 
   void reset() { memset(this, 0, sizeof(Neura9Features)); }
+
+  // Visão plana na ordem do esquema
+  const float *data() const { return &rssi_norm; }
+};
+
+static_assert(sizeof(Neura9Features) == NEURA9_FEATURE_COUNT * sizeof(float),
+              "Neura9Features fora do esquema (neura9_features.json)");
+#define NEURA9_CHECK_OFFSET(name, idx)                                         \
+  static_assert(offsetof(Neura9Features, name) == (idx) * sizeof(float),       \
+                "Ordem de " #name " difere do esquema");
+NEURA9_FEATURE_LIST(NEURA9_CHECK_OFFSET)
+#undef NEURA9_CHECK_OFFSET
+
+/**
+ * @brief Média e variância incrementais (Welford), uma passada e sem buffer
+ */
+struct RunningStats {
+  uint32_t n;
+  float mean;
+  float m2;
+
+  void reset() {
+    n = 0;
+    mean = 0.0f;
+    m2 = 0.0f;
+  }
+  void add(float x) {
+    n++;
+    float d = x - mean;
+    mean += d / n;
+    m2 += d * (x - mean);
+  }
+  float variance() const { return n > 1 ? m2 / (n - 1) : 0.0f; }
+};
+
+/**
+ * @brief Sub-janela por BSSID (mesma duração da janela global)
+ */
+struct BssidWindow {
+  uint8_t bssid[6];
+  uint16_t lastSeq;
+  uint32_t frames;
+  uint32_t beacons;
+  uint32_t deauths; // Deauth + disassoc
+  uint32_t eapol;
+  uint32_t seqGaps; // Saltos de sequence number > 1
+  int32_t rssiSum;
+};
+
+/**
+ * @brief Acumuladores brutos de uma janela de captura
+ */
+struct FeatureWindow {
+  static const uint8_t MAX_BSSIDS = 16;
+
+  uint32_t startUs;
+  uint32_t endUs;
+  uint32_t lastFrameUs;
+  uint32_t frames;
+  int32_t rssiSum;
+  int32_t noiseSum;
+
+  uint32_t mgmt, ctrl, data;
+  uint32_t beacons, probeReq, assocReq, deauths, oddReasons;
+  uint32_t eapol, eapolStart, eapolKey;
+  uint32_t retry, protectedFrames, broadcast, multicast, fragments;
+  uint32_t nullProbes, randomMacProbes, wpsFrames;
+  uint32_t channelSwitches;
+  uint8_t lastChannel;
+  uint32_t durationSum;
+  uint32_t ieHash;
+
+  uint32_t seqSamples, seqGaps, seqDeltaSum;
+  uint32_t burst, maxBurst;
+  RunningStats size; // Bytes (sig_len real)
+  RunningStats gap;  // us entre frames
+
+  uint8_t bssidCount;
+  uint32_t bssidOverflow; // Frames de BSSIDs que não couberam na tabela
+  BssidWindow bssids[MAX_BSSIDS];
+
+  void reset(uint32_t nowUs);
 };
 
+/**
+ * @brief Extrator de features com janelas duplas sem lock
+ *
+ * O caminho de captura (callback promíscuo, task do WiFi) é o único
+ * produtor: acumula na janela de escrita e, ao fim da janela, troca os
+ * índices e publica a janela selada. A task de IA é a única consumidora:
+ * getFeatures() normaliza a janela selada e a devolve. Enquanto a IA não
+ * consumir, o produtor continua na mesma janela (que só fica mais longa);
+ * as taxas usam a duração real, então continuam corretas.
+ *
+ * Com setNotifyTask() a task consumidora é acordada (xTaskNotifyGive) a cada
+ * janela selada, em vez de fazer polling.
+ */
 class FeatureExtractor {
 public:
+  static const uint32_t DEFAULT_WINDOW_MS = 800;
+
   FeatureExtractor();
 
-  // Atualiza features com base em estatísticas acumuladas
-  void update(int rssi, int channel, uint8_t frameType, uint8_t frameSubtype,
-              bool isProtected, bool isRetry, uint32_t timestamp);
+  /**
+   * @brief Caminho quente: um frame 802.11 capturado (sem locks)
+   * @param frame Início do cabeçalho MAC
+   * @param len Tamanho real (rx_ctrl.sig_len)
+   * @param timestampUs rx_ctrl.timestamp
+   */
+  void update(const uint8_t *frame, uint16_t len, int8_t rssi,
+              int8_t noiseFloor, uint8_t channel, uint32_t timestampUs);
 
-  // Obtém features formatadas para o modelo
-  const Neura9Features &getFeatures() const;
+  // Há janela selada ainda não consumida
+  bool hasNewWindow() const { return _sealed.load(std::memory_order_acquire); }
 
-  // Reseta acumuladores (usar a cada janela de inferência, ex: 800ms)
-  void resetWindow();
+  // Consome a janela selada (se houver) e retorna as features normalizadas.
+  // Só a task de IA deve chamar.
+  const Neura9Features &getFeatures();
 
-private:
-  Neura9Features _currentFeatures;
+  // Sub-janelas por BSSID da última janela consumida
+  uint8_t getBssidWindows(BssidWindow *out, uint8_t maxCount) const;
+
+  void setWindowMs(uint32_t ms) { _windowUs = ms * 1000; }
+  uint32_t getWindowMs() const { return _windowUs / 1000; }
+  uint32_t getWindowCount() const { return _windowCount; }
 
-  // Acumuladores temporários
-  uint32_t _frameCount;
-  int32_t _rssiSum;
-  uint32_t _windowStartTime;
+  // Task notificada quando uma janela é selada (NULL = nenhuma)
+  void setNotifyTask(TaskHandle_t task) { _notifyTask = task; }
 
-  // New accumulators
-  uint32_t _packetSizeSum;
-  uint32_t _lastPacketTime;
-  uint32_t _maxBurst;
-  uint32_t _currentBurst;
+  // Idade (us) da janela selada pendente, ou da última consumida (micros)
+  uint32_t getWindowAgeUs() const { return micros() - _sealedAtUs; }
 
-  // Cache para retorno seguro (necessário para getFeatures ser const e retornar
-  // ref)
+private:
+  FeatureWindow _windows[2];
+  uint8_t _writeIdx; // Só o produtor altera (com _sealed == false)
+  std::atomic<bool> _sealed;
+  volatile uint32_t _windowUs;
+  volatile uint32_t _sealedAtUs; // micros() no seal, não rx_ctrl.timestamp
+  TaskHandle_t _notifyTask;
+
+  // Lado do consumidor
   Neura9Features _cachedNormalized;
+  BssidWindow _bssidSnapshot[FeatureWindow::MAX_BSSIDS];
+  uint8_t _bssidSnapshotCount;
+  uint32_t _lastConsumeMs;
+  uint32_t _windowCount;
+
+  void seal(uint32_t nowUs);
+  void normalize(const FeatureWindow &w);
 };
+
+extern FeatureExtractor featureExtractor;
@@ -0,0 +1,55 @@
+#include "feature_sequence.h"
+#include <esp_heap_caps.h>
+
+FeatureSequence::FeatureSequence()
+    : _buf(nullptr), _steps(0), _head(0), _count(0), _width(0),
+      _zeroPoint(0) {}
+
+FeatureSequence::~FeatureSequence() { end(); }
+
+bool FeatureSequence::begin(uint8_t steps, uint16_t width, int8_t zeroPoint) {
+  end();
+  if (steps == 0 || steps > NEURA9_SEQ_MAX_STEPS || width == 0)
+    return false;
+
+  // Poucos KB: DRAM interna deixa o memcpy para a arena mais rápido
+  size_t size = 2 * (size_t)steps * width;
+  _buf = (int8_t *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL |
+                                              MALLOC_CAP_8BIT);
+  if (!_buf) {
+    _buf = (int8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+  }
+  if (!_buf)
+    return false;
+
+  _steps = steps;
+  _width = width;
+  _zeroPoint = zeroPoint;
+  reset();
+  return true;
+}
+
+void FeatureSequence::end() {
+  if (_buf)
+    heap_caps_free(_buf);
+  _buf = nullptr;
+  _steps = 0;
+  _width = 0;
+  _head = 0;
+  _count = 0;
+}
+
+void FeatureSequence::reset() {
+  if (_buf)
+    memset(_buf, _zeroPoint, 2 * (size_t)_steps * _width);
+  _head = 0;
+  _count = 0;
+}
+
+void FeatureSequence::commit() {
+  // Cópia espelhada: a visão a partir de qualquer base fica contígua
+  memcpy(_buf + (_head + _steps) * _width, _buf + _head * _width, _width);
+  _head = (_head + 1) % _steps;
+  if (_count < _steps)
+    _count++;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * @file feature_sequence.h
+ * @brief Anel das últimas N janelas de features já quantizadas (INT8)
+ *
+ * Para modelos com dimensão de tempo, entrada (1, timesteps, features) como
+ * em ai_training/quantize_neura9_int8.py. Cada janela é gravada duas vezes
+ * (slot i e i + N), então as N últimas estão sempre contíguas a partir do
+ * índice base: avançar o anel só gira a base, nada é movido. A visão vai
+ * inteira para o tensor de entrada com um único memcpy, sem requantizar.
+ */
+
+#define NEURA9_SEQ_MAX_STEPS 32
+
+class FeatureSequence {
+public:
+  FeatureSequence();
+  ~FeatureSequence();
+
+  /**
+   * @brief Aloca 2 * steps * width bytes e preenche com zeroPoint
+   * @param width Largura de um passo (última dimensão do tensor)
+   * @param zeroPoint Zero real no INT8 do tensor (passos ainda vazios)
+   */
+  bool begin(uint8_t steps, uint16_t width, int8_t zeroPoint);
+  void end();
+
+  // Volta ao estado vazio (passos antigos = zero real)
+  void reset();
+
+  // Slot da próxima janela: quem chama quantiza direto nele e chama commit()
+  int8_t *slot() { return _buf + _head * _width; }
+
+  // Espelha o slot e gira a base (janela mais antiga sai)
+  void commit();
+
+  /**
+   * @brief Visão contígua [mais antiga .. mais recente], steps * width bytes
+   */
+  const int8_t *view() const { return _buf + _head * _width; }
+  size_t bytes() const { return (size_t)_steps * _width; }
+
+  bool isReady() const { return _buf != nullptr; }
+  bool isFull() const { return _count == _steps; }
+  uint8_t getSteps() const { return _steps; }
+  uint8_t getCount() const { return _count; }
+  uint16_t getWidth() const { return _width; }
+
+private:
+  int8_t *_buf; // 2 * _steps slots
+  uint8_t _steps;
+  uint8_t _head; // Base da visão = slot que a próxima janela sobrescreve
+  uint8_t _count;
+  uint16_t _width;
+  int8_t _zeroPoint;
+};
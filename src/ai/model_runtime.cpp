@@ -0,0 +1,355 @@
+#include "model_runtime.h"
+#include "neura9_inference.h"
+#include <new>
+
+#include <tensorflow/lite/micro/micro_error_reporter.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+ModelRuntime modelRuntime;
+
+// Interpretador do modelo residente na arena compartilhada
+alignas(tflite::MicroInterpreter) static uint8_t
+    s_interpreterMem[sizeof(tflite::MicroInterpreter)];
+static tflite::MicroInterpreter *s_interpreter = nullptr;
+
+// Folga sobre o uso medido (ver comentário de arena_used_bytes) em 1 KB
+static size_t arenaNeed(size_t used) { return (used + 16 + 1023) & ~1023u; }
+
+const tflite::MicroOpResolver &ModelRuntime::resolver() {
+  // Todas as ops usadas por NEURA9, defesa e wake word: registra uma vez
+  static tflite::MicroMutableOpResolver<10> s_resolver;
+  static bool registered = false;
+  if (!registered) {
+    s_resolver.AddFullyConnected();
+    s_resolver.AddSoftmax();
+    s_resolver.AddRelu();
+    s_resolver.AddQuantize();
+    s_resolver.AddDequantize();
+    s_resolver.AddConv2D();
+    s_resolver.AddDepthwiseConv2D();
+    s_resolver.AddMaxPool2D();
+    s_resolver.AddAveragePool2D();
+    s_resolver.AddReshape();
+    registered = true;
+  }
+  return s_resolver;
+}
+
+tflite::ErrorReporter *ModelRuntime::reporter() {
+  static tflite::MicroErrorReporter s_reporter;
+  return &s_reporter;
+}
+
+ModelRuntime::ModelRuntime()
+    : _count(0), _arena(nullptr), _arenaSize(0), _resident(-1), _task(NULL),
+      _lock(NULL) {
+  for (uint8_t i = 0; i < MODEL_RUNTIME_MAX_MODELS; i++) {
+    memset(&_slots[i].info, 0, sizeof(ModelRuntimeInfo));
+    _slots[i].data = nullptr;
+    _slots[i].staging = nullptr;
+    _slots[i].pending = false;
+    _slots[i].ok = false;
+    _slots[i].done = NULL;
+  }
+}
+
+void ModelRuntime::begin(TaskHandle_t task) { _task = task; }
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REGISTRO
+// ═══════════════════════════════════════════════════════════════════════════
+
+int ModelRuntime::registerModel(const char *name, const uint8_t *data,
+                                size_t len, uint8_t priority,
+                                uint32_t deadlineUs) {
+  if (_count >= MODEL_RUNTIME_MAX_MODELS)
+    return -1;
+  if (!_lock)
+    _lock = xSemaphoreCreateMutex();
+
+  // Modelos placeholder (só cabeçalho) não passam daqui
+  flatbuffers::Verifier verifier(data, len);
+  if (!tflite::VerifyModelBuffer(verifier)) {
+    Serial.printf("[RUNTIME] %s: flatbuffer inválido, ignorado\n", name);
+    return -1;
+  }
+  const tflite::Model *model = tflite::GetModel(data);
+  if (model->version() != TFLITE_SCHEMA_VERSION) {
+    Serial.printf("[RUNTIME] %s: schema %lu != %d\n", name,
+                  (unsigned long)model->version(), TFLITE_SCHEMA_VERSION);
+    return -1;
+  }
+
+  // Sondagem: mede arena e formato da entrada/saída
+  uint8_t *probe = (uint8_t *)heap_caps_malloc(
+      MODEL_RUNTIME_PROBE_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  void *mem = heap_caps_malloc(sizeof(tflite::MicroInterpreter),
+                               MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  size_t used = 0, inputCount = 0, outputCount = 0;
+  bool int8Input = false, ok = false;
+  if (probe && mem) {
+    tflite::MicroInterpreter *probeInterp = new (mem) tflite::MicroInterpreter(
+        model, resolver(), probe, MODEL_RUNTIME_PROBE_SIZE, reporter());
+    if (probeInterp->AllocateTensors() == kTfLiteOk) {
+      TfLiteTensor *in = probeInterp->input(0);
+      TfLiteTensor *out = probeInterp->output(0);
+      int8Input = in->type == kTfLiteInt8;
+      inputCount = in->bytes / (int8Input ? 1 : sizeof(float));
+      outputCount = out->dims->data[out->dims->size - 1];
+      used = probeInterp->arena_used_bytes();
+      ok = (in->type == kTfLiteInt8 || in->type == kTfLiteFloat32) &&
+           (out->type == kTfLiteInt8 || out->type == kTfLiteFloat32) &&
+           inputCount <= MODEL_RUNTIME_MAX_INPUTS;
+    }
+    probeInterp->~MicroInterpreter();
+  }
+  if (mem)
+    heap_caps_free(mem);
+  if (probe)
+    heap_caps_free(probe);
+  if (!ok) {
+    Serial.printf("[RUNTIME] %s: sondagem falhou (arena %u B)\n", name,
+                  (unsigned)MODEL_RUNTIME_PROBE_SIZE);
+    return -1;
+  }
+
+  Slot &s = _slots[_count];
+  s.staging = (float *)heap_caps_malloc(
+      (inputCount + MODEL_RUNTIME_MAX_OUTPUTS) * sizeof(float),
+      MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  s.done = xSemaphoreCreateBinary();
+  if (!s.staging || !s.done) {
+    Serial.printf("[RUNTIME] %s: sem memória\n", name);
+    if (s.staging)
+      heap_caps_free(s.staging);
+    if (s.done)
+      vSemaphoreDelete(s.done);
+    s.staging = nullptr;
+    s.done = NULL;
+    return -1;
+  }
+
+  // A arena compartilhada cresce até o maior modelo registrado
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  bool arenaOk = ensureArena(arenaNeed(used));
+  xSemaphoreGive(_lock);
+  if (!arenaOk) {
+    heap_caps_free(s.staging);
+    vSemaphoreDelete(s.done);
+    s.staging = nullptr;
+    s.done = NULL;
+    Serial.printf("[RUNTIME] %s: sem memória para arena de %u B\n", name,
+                  (unsigned)arenaNeed(used));
+    return -1;
+  }
+
+  s.info.name = name;
+  s.info.priority = priority;
+  s.info.deadlineUs = deadlineUs;
+  s.info.arenaUsed = used;
+  s.info.resident = false;
+  s.data = data;
+  s.len = len;
+  s.int8Input = int8Input;
+  s.inputCount = inputCount;
+  s.pending = false;
+  Serial.printf("[RUNTIME] %s: %u entradas, %u saídas, arena %u B "
+                "(compartilhada %u B)\n",
+                name, (unsigned)inputCount, (unsigned)outputCount,
+                (unsigned)used, (unsigned)_arenaSize);
+  return _count++;
+}
+
+int ModelRuntime::registerResident(const char *name, uint8_t priority,
+                                   uint32_t deadlineUs) {
+  if (_count >= MODEL_RUNTIME_MAX_MODELS)
+    return -1;
+  Slot &s = _slots[_count];
+  s.info.name = name;
+  s.info.priority = priority;
+  s.info.deadlineUs = deadlineUs;
+  s.info.resident = true;
+  return _count++;
+}
+
+bool ModelRuntime::ensureArena(size_t size) {
+  if (size <= _arenaSize)
+    return true;
+
+  // DRAM interna se sobrar a reserva do sistema, senão PSRAM
+  const uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+  uint8_t *arena = nullptr;
+  if (heap_caps_get_largest_free_block(caps) >= size + NEURA9_DRAM_RESERVE)
+    arena = (uint8_t *)heap_caps_malloc(size, caps);
+  if (!arena)
+    arena = (uint8_t *)heap_caps_malloc(size,
+                                        MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!arena)
+    return false; // Modelos já registrados continuam na arena antiga
+
+  // Interpretador aponta para a arena antiga
+  release();
+  if (_arena)
+    heap_caps_free(_arena);
+  _arena = arena;
+  _arenaSize = size;
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// EXECUÇÃO (TASK DE IA)
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool ModelRuntime::activate(int id) {
+  if (_resident == id)
+    return true;
+  release();
+
+  // Troca de modelo: mesmo resolver, mesma arena, tensores realocados
+  Slot &s = _slots[id];
+  s_interpreter = new (s_interpreterMem) tflite::MicroInterpreter(
+      tflite::GetModel(s.data), resolver(), _arena, _arenaSize, reporter());
+  if (s_interpreter->AllocateTensors() != kTfLiteOk) {
+    release();
+    return false;
+  }
+  _resident = id;
+  s.info.stats.switches++;
+  return true;
+}
+
+void ModelRuntime::release() {
+  if (s_interpreter) {
+    s_interpreter->~MicroInterpreter();
+    s_interpreter = nullptr;
+  }
+  _resident = -1;
+}
+
+void ModelRuntime::execute(Slot &s) {
+  int id = &s - _slots;
+  s.ok = false;
+  if (!activate(id)) {
+    s.info.stats.failures++;
+    return;
+  }
+
+  TfLiteTensor *in = s_interpreter->input(0);
+  if (s.int8Input) {
+    float inv = 1.0f / in->params.scale;
+    for (size_t i = 0; i < s.inputCount; i++) {
+      float q = s.staging[i] * inv + in->params.zero_point;
+      q = q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q);
+      in->data.int8[i] = (int8_t)lrintf(q);
+    }
+  } else {
+    memcpy(in->data.f, s.staging, s.inputCount * sizeof(float));
+  }
+
+  uint32_t start = micros();
+  bool ok = s_interpreter->Invoke() == kTfLiteOk;
+  uint32_t invokeUs = micros() - start;
+
+  if (ok) {
+    TfLiteTensor *out = s_interpreter->output(0);
+    int classes = out->dims->data[out->dims->size - 1];
+    float *scores = s.staging + s.inputCount;
+    for (int i = 0; i < s.outCount; i++) {
+      if (i >= classes) {
+        scores[i] = 0.0f;
+      } else if (out->type == kTfLiteInt8) {
+        scores[i] = (out->data.int8[i] - out->params.zero_point) *
+                    out->params.scale;
+      } else {
+        scores[i] = out->data.f[i];
+      }
+    }
+  }
+  s.ok = ok;
+  account(id, invokeUs, micros() - s.requestUs, ok);
+}
+
+void ModelRuntime::account(int id, uint32_t invokeUs, uint32_t latencyUs,
+                           bool ok) {
+  if (id < 0 || id >= _count)
+    return;
+  ModelRuntimeInfo &info = _slots[id].info;
+  if (!ok) {
+    info.stats.failures++;
+    return;
+  }
+  info.stats.invokes++;
+  info.stats.lastUs = invokeUs;
+  if (invokeUs > info.stats.maxUs)
+    info.stats.maxUs = invokeUs;
+  info.stats.lastLatencyUs = latencyUs;
+  if (latencyUs > info.stats.maxLatencyUs)
+    info.stats.maxLatencyUs = latencyUs;
+  if (info.deadlineUs && latencyUs > info.deadlineUs)
+    info.stats.deadlineMisses++;
+}
+
+bool ModelRuntime::invoke(int id, const float *in, size_t inCount, float *out,
+                          uint8_t outCount, uint32_t timeoutMs) {
+  if (id < 0 || id >= _count)
+    return false;
+  Slot &s = _slots[id];
+  if (s.info.resident || inCount != s.inputCount ||
+      outCount > MODEL_RUNTIME_MAX_OUTPUTS || s.pending)
+    return false;
+
+  memcpy(s.staging, in, inCount * sizeof(float));
+  s.outCount = outCount;
+  s.requestUs = micros();
+
+  if (!_task || xTaskGetCurrentTaskHandle() == _task) {
+    // Já está na task de IA (ou ela não existe): roda aqui
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    execute(s);
+    xSemaphoreGive(_lock);
+  } else {
+    xSemaphoreTake(s.done, 0); // Resultado de um pedido que expirou
+    s.pending = true;
+    xTaskNotifyGive(_task);
+    if (xSemaphoreTake(s.done, pdMS_TO_TICKS(timeoutMs)) != pdTRUE)
+      return false; // Continua na fila; o próximo invoke vê "ocupado"
+  }
+
+  if (!s.ok)
+    return false;
+  memcpy(out, s.staging + s.inputCount, outCount * sizeof(float));
+  return true;
+}
+
+uint8_t ModelRuntime::service(uint8_t minPriority) {
+  uint8_t served = 0;
+  while (true) {
+    int next = -1;
+    for (uint8_t i = 0; i < _count; i++) {
+      const Slot &s = _slots[i];
+      if (s.pending && s.info.priority >= minPriority &&
+          (next < 0 || s.info.priority > _slots[next].info.priority))
+        next = i;
+    }
+    if (next < 0)
+      break;
+
+    Slot &s = _slots[next];
+    xSemaphoreTake(_lock, portMAX_DELAY);
+    execute(s);
+    xSemaphoreGive(_lock);
+    s.pending = false;
+    xSemaphoreGive(s.done);
+    served++;
+  }
+  return served;
+}
+
+bool ModelRuntime::getInfo(int id, ModelRuntimeInfo *out) const {
+  if (id < 0 || id >= _count)
+    return false;
+  *out = _slots[id].info;
+  return true;
+}
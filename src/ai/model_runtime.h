@@ -0,0 +1,150 @@
+#pragma once
+/**
+ * @file model_runtime.h
+ * @brief Runtime único para os modelos TFLite (NEURA9, defesa, wake word)
+ *
+ * - Um resolver de ops, registrado uma vez e compartilhado por todos os
+ *   interpretadores (NEURA9 inclusive).
+ * - Os modelos secundários dividem no tempo uma única arena, com o tamanho do
+ *   maior uso medido no registro. Só um deles fica residente; trocar de
+ *   modelo reconstrói o interpretador na mesma arena.
+ * - Toda invocação roda na task de IA: outras tasks enfileiram a entrada com
+ *   invoke() e esperam o resultado; os pedidos pendentes saem por prioridade.
+ * - Latência (fila + invoke) e prazos perdidos são contados por modelo.
+ *
+ * NEURA9 continua residente na arena do próprio planner (roda a cada
+ * janela); aparece aqui só para contabilidade (registerResident/account).
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+namespace tflite {
+class MicroOpResolver;
+class ErrorReporter;
+} // namespace tflite
+
+#define MODEL_RUNTIME_MAX_MODELS 4
+// Teto da arena de sondagem (PSRAM, só durante o registro)
+#define MODEL_RUNTIME_PROBE_SIZE (64 * 1024)
+#define MODEL_RUNTIME_MAX_INPUTS 2048 // Floats por entrada
+#define MODEL_RUNTIME_MAX_OUTPUTS 8
+
+/**
+ * @brief Contabilidade de um modelo
+ */
+struct ModelRuntimeStats {
+  uint32_t invokes;
+  uint32_t failures;
+  uint32_t switches;       // Vezes que o modelo foi carregado na arena
+  uint32_t lastUs;         // Último invoke
+  uint32_t maxUs;
+  uint32_t lastLatencyUs;  // Pedido -> resultado (fila + troca + invoke)
+  uint32_t maxLatencyUs;
+  uint32_t deadlineMisses;
+};
+
+struct ModelRuntimeInfo {
+  const char *name;
+  uint8_t priority;    // Maior sai primeiro da fila
+  uint32_t deadlineUs; // 0 = sem prazo
+  size_t arenaUsed;    // Medido no registro (0 para residentes)
+  bool resident;       // Arena própria (fora do runtime)
+  ModelRuntimeStats stats;
+};
+
+class ModelRuntime {
+public:
+  ModelRuntime();
+
+  /**
+   * @brief Resolver com todas as ops dos modelos do firmware (cacheado)
+   */
+  static const tflite::MicroOpResolver &resolver();
+  static tflite::ErrorReporter *reporter();
+
+  /**
+   * @brief Task que executa as invocações (a task de IA)
+   */
+  void begin(TaskHandle_t task);
+
+  /**
+   * @brief Registra um modelo que divide a arena compartilhada
+   *
+   * Valida o flatbuffer, mede o uso de arena com um interpretador de
+   * sondagem e aumenta a arena compartilhada se preciso.
+   * @return Id do modelo, ou -1 se inválido/sem memória
+   */
+  int registerModel(const char *name, const uint8_t *data, size_t len,
+                    uint8_t priority, uint32_t deadlineUs);
+
+  /**
+   * @brief Registra um modelo com arena própria (só contabilidade)
+   */
+  int registerResident(const char *name, uint8_t priority,
+                       uint32_t deadlineUs);
+
+  /**
+   * @brief Contabiliza uma invocação feita fora do runtime (residente)
+   */
+  void account(int id, uint32_t invokeUs, uint32_t latencyUs, bool ok);
+
+  /**
+   * @brief Roda o modelo na task de IA e espera o resultado
+   *
+   * A entrada é sempre float; se o tensor for INT8 o runtime quantiza.
+   * Chamado da própria task de IA, executa na hora.
+   * @param out Scores (saída dequantizada), até outCount
+   * @return false se inválido, ocupado, timeout ou falha no invoke
+   */
+  bool invoke(int id, const float *in, size_t inCount, float *out,
+              uint8_t outCount, uint32_t timeoutMs);
+
+  /**
+   * @brief Executa os pedidos pendentes, maior prioridade primeiro
+   *
+   * Só a task de IA chama (a cada despertar).
+   * @param minPriority Só pedidos com prioridade >= minPriority
+   * @return Quantos pedidos foram executados
+   */
+  uint8_t service(uint8_t minPriority = 0);
+
+  uint8_t getModelCount() const { return _count; }
+  bool getInfo(int id, ModelRuntimeInfo *out) const;
+  size_t getArenaSize() const { return _arenaSize; }
+  int getResident() const { return _resident; }
+
+private:
+  struct Slot {
+    ModelRuntimeInfo info;
+    const uint8_t *data;
+    size_t len;
+    bool int8Input;
+    size_t inputCount;
+
+    // Pedido pendente (escrito pelo chamador, lido pela task de IA)
+    float *staging; // inputCount + MODEL_RUNTIME_MAX_OUTPUTS
+    uint8_t outCount;
+    uint32_t requestUs;
+    volatile bool pending;
+    volatile bool ok;
+    SemaphoreHandle_t done;
+  };
+
+  Slot _slots[MODEL_RUNTIME_MAX_MODELS];
+  uint8_t _count;
+  uint8_t *_arena;
+  size_t _arenaSize;
+  int _resident; // Slot carregado na arena (-1 = nenhum)
+  TaskHandle_t _task;
+  SemaphoreHandle_t _lock;
+
+  bool ensureArena(size_t size);
+  bool activate(int id);
+  void release();
+  void execute(Slot &s);
+};
+
+extern ModelRuntime modelRuntime;
@@ -4,13 +4,14 @@
  * @brief TFLite Micro model for "Hey Dragon" wake word detection
  * 
  * Model: Quantized INT8, ~50KB
- * Input: 40 MFCC features x 49 time steps
+ * Input: 40 log-mel channels (microfrontend) x 49 frames (30 ms / 20 ms)
  * Output: 2 classes (wake_word, not_wake_word)
  * 
  * To train a real model:
- * 1. Use Edge Impulse with custom keyword dataset
- * 2. Export as TFLite (quantized)
- * 3. xxd -i model.tflite > wake_word_model.h
+ * 1. Collect a custom keyword dataset (16 kHz mono WAV)
+ * 2. Train on ai_training/wake_word_features.py (same frontend as device)
+ * 3. Export as TFLite (quantized)
+ * 4. xxd -i model.tflite > wake_word_model.h
  */
 
 #include <stdint.h>
@@ -1,26 +1,220 @@
 /**
  * @file anomaly_detector.cpp
  * @brief Detector de anomalias WiFi leve para ESP32-S3
- * 
- * Usa heurísticas + scoring para detectar comportamentos anormais
- * sem necessidade de modelo TFLite pesado.
+ *
+ * Usa heurísticas + detecção de mudança (EWMA/CUSUM) por classe de frame
+ * para detectar comportamentos anormais sem modelo TFLite pesado.
  */
 
 #include "anomaly_detector.h"
+#include <math.h>
+#include <string.h>
 
-WiFiAnomalyDetector::WiFiAnomalyDetector() : _threshold(0.5f) {}
+WiFiAnomalyDetector wifiAnomaly;
+
+// EWMA: alpha = 1/32 (~3 s de memória com bins de 100 ms)
+static const float EWMA_ALPHA = 1.0f / 32.0f;
+// CUSUM: folga k e limiar h em desvios-padrão (ARL alto sem mudança)
+static const float CUSUM_K = 0.5f;
+static const float CUSUM_H = 5.0f;
+// Cada bin soma no máximo Z_CLIP - k: a rajada de probes de um celular
+// escaneando (< 50 ms) não alarma sozinha; um ataque contínuo passa de h em
+// 4 bins (400 ms)
+static const float Z_CLIP = 2.0f;
+// Teto da soma: o alarme desarma ~2 s depois do fim do ataque
+static const float CUSUM_MAX = 2.0f * CUSUM_H;
+// Piso do desvio: taxa ~0 (ex: deauth) não pode virar divisão por zero, e
+// um frame a mais num bin quase vazio (probe) vale no máximo 1 sigma
+static const float MIN_SIGMA = 1.0f;
+// Score médio: EWMA por frame
+static const float SCORE_ALPHA = 1.0f / 64.0f;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RATE RING
+// ═══════════════════════════════════════════════════════════════════════════
+
+void RateRing::reset(uint32_t nowMs) {
+  memset(bins, 0, sizeof(bins));
+  binStartMs = nowMs;
+  sum = 0;
+  head = 0;
+}
+
+uint8_t RateRing::advance(uint32_t nowMs, uint16_t binMs) {
+  uint32_t elapsed = nowMs - binStartMs;
+  if (elapsed < binMs)
+    return 0;
+
+  uint32_t steps = elapsed / binMs;
+  binStartMs += steps * binMs;
+  // Depois de BINS passos a janela inteira já foi zerada
+  uint8_t n = steps > BINS ? BINS : steps;
+  for (uint8_t i = 0; i < n; i++) {
+    head = (head + 1) % BINS;
+    sum -= bins[head];
+    bins[head] = 0;
+  }
+  return steps > 255 ? 255 : steps;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CHANGE DETECTOR (EWMA + CUSUM)
+// ═══════════════════════════════════════════════════════════════════════════
+
+void ChangeDetector::reset() { memset(this, 0, sizeof(*this)); }
+
+bool ChangeDetector::update(uint16_t count, uint32_t nowMs) {
+  float x = count;
+
+  if (samples < WiFiAnomalyDetector::WARMUP_BINS) {
+    // Aquecimento: só aprende a linha de base (média acumulada)
+    samples++;
+    float d = x - mean;
+    mean += d / samples;
+    var += (d * (x - mean) - var) / samples;
+    return false;
+  }
+
+  float sigma = sqrtf(var);
+  if (sigma < MIN_SIGMA)
+    sigma = MIN_SIGMA;
+  float z = (x - mean) / sigma;
+  if (z > Z_CLIP)
+    z = Z_CLIP;
+
+  float prev = cusum;
+  cusum += z - CUSUM_K;
+  if (cusum < 0.0f)
+    cusum = 0.0f;
+  else if (cusum > CUSUM_MAX)
+    cusum = CUSUM_MAX;
+  if (prev == 0.0f && cusum > 0.0f)
+    onsetMs = nowMs;
+
+  bool rising = false;
+  if (!alarm && cusum > CUSUM_H) {
+    alarm = true;
+    rising = true;
+    alarms++;
+    alarmMs = nowMs;
+    latencyMs = nowMs - onsetMs;
+  } else if (alarm && cusum == 0.0f) {
+    alarm = false;
+  }
+
+  // Linha de base congelada em alarme (não aprende o ataque como normal).
+  // Fora dele aprende todo bin: aprender só com cusum == 0 pegaria só os
+  // bins abaixo da média e puxaria a linha de base para baixo.
+  if (!alarm) {
+    samples++;
+    float d = x - mean;
+    mean += EWMA_ALPHA * d;
+    var = (1.0f - EWMA_ALPHA) * (var + EWMA_ALPHA * d * d);
+  }
+  return rising;
+}
+
+float ChangeDetector::score() const {
+  float s = cusum / CUSUM_H;
+  return s > 1.0f ? 1.0f : s;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DETECTOR
+// ═══════════════════════════════════════════════════════════════════════════
+
+WiFiAnomalyDetector::WiFiAnomalyDetector()
+    : _threshold(0.5f), _avgScore(0.0f), _lastMs(0), _lastFrameMs(0),
+      _idle(false) {
+  clear(millis());
+}
 
 void WiFiAnomalyDetector::begin() {
-  // Inicializar historial de padrões
-  _packetHistory.clear();
-  _lastCheckTime = millis();
+  reset();
   Serial.println("[ANOMALY] Detector inicializado");
 }
 
-float WiFiAnomalyDetector::feedPacketCharacteristics(int length, int type,
-                                                     int subtype) {
+void WiFiAnomalyDetector::reset() {
+  portENTER_CRITICAL(&_mux);
+  clear(millis());
+  _idle = false;
+  portEXIT_CRITICAL(&_mux);
+}
+
+void WiFiAnomalyDetector::clear(uint32_t nowMs) {
+  _lastMs = nowMs;
+  _lastFrameMs = nowMs;
+  _avgScore = 0.0f;
+  for (uint8_t i = 0; i < ANOMALY_CLASS_COUNT; i++) {
+    _rates[i].reset(nowMs);
+    _detectors[i].reset();
+  }
+  memset(_bssids, 0, sizeof(_bssids));
+}
+
+void WiFiAnomalyDetector::tick(uint32_t nowMs) {
+  portENTER_CRITICAL(&_mux);
+  if (_idle) {
+    // Já zerado: nada a fechar até a captura voltar
+  } else if ((int32_t)(nowMs - _lastFrameMs) > (int32_t)IDLE_RESET_MS) {
+    // Captura parada: solta alarmes e taxas; a volta refaz o aquecimento.
+    // Diferença com sinal: frame mais novo que o millis() deste tick não
+    // conta como parada
+    clear(nowMs);
+    _idle = true;
+  } else {
+    advance(nowMs);
+  }
+  portEXIT_CRITICAL(&_mux);
+}
+
+static int8_t frameClass(int type, int subtype) {
+  if (type != 0)
+    return -1;
+  switch (subtype) {
+  case 12:
+    return ANOMALY_DEAUTH;
+  case 10:
+    return ANOMALY_DISASSOC;
+  case 4:
+    return ANOMALY_PROBE;
+  case 8:
+    return ANOMALY_BEACON;
+  case 11:
+    return ANOMALY_AUTH;
+  default:
+    return -1;
+  }
+}
+
+void WiFiAnomalyDetector::advance(uint32_t nowMs) {
+  // Callback e tick() leem millis() fora do lock e podem chegar fora de
+  // ordem por alguns ms; o relógio nunca volta. Diferença com sinal: vale
+  // no wrap.
+  if ((int32_t)(nowMs - _lastMs) < 0)
+    nowMs = _lastMs;
+  _lastMs = nowMs;
+
+  for (uint8_t i = 0; i < ANOMALY_CLASS_COUNT; i++) {
+    uint16_t closed = _rates[i].current();
+    uint8_t steps = _rates[i].advance(nowMs, BIN_MS);
+    if (steps == 0)
+      continue;
+    // Bin que acabou de fechar; bins pulados (sem frames) contam como zero
+    _detectors[i].update(closed, nowMs);
+    uint8_t idle = steps - 1;
+    if (idle > RateRing::BINS)
+      idle = RateRing::BINS;
+    for (uint8_t k = 0; k < idle; k++) {
+      _detectors[i].update(0, nowMs);
+    }
+  }
+}
+
+float WiFiAnomalyDetector::scoreFrame(int length, int type,
+                                      int subtype) const {
   float anomalyScore = 0.0f;
-  
+
   // 1. Pacote Beacon gigante -> Possível buffer overflow exploit
   if (type == 0 && subtype == 8 && length > 1000) {
     anomalyScore += 0.8f;
@@ -36,70 +230,142 @@ float WiFiAnomalyDetector::feedPacketCharacteristics(int length, int type,
     anomalyScore += 1.0f;
   }
 
-  // 4. Deauth flood detection (subtype 12 = deauth)
-  if (type == 0 && subtype == 12) {
-    _deauthCount++;
-    // Se mais de 10 deauths em 1 segundo = ataque
-    if (_deauthCount > 10) {
-      anomalyScore += 0.9f;
-    }
+  // 4. Beacon com SSID muito longo ou caracteres especiais
+  if (type == 0 && subtype == 8 && length > 300) {
+    anomalyScore += 0.4f;
   }
 
-  // 5. Probe request flood (subtype 4 = probe request)
-  if (type == 0 && subtype == 4) {
-    _probeCount++;
-    // Muitos probes = possível scanner malicioso
-    if (_probeCount > 50) {
-      anomalyScore += 0.3f;
-    }
+  // 5. Mudança de taxa na classe do frame (CUSUM)
+  int8_t cls = frameClass(type, subtype);
+  if (cls >= 0) {
+    float s = _detectors[cls].score();
+    // Deauth/disassoc em alarme pesam mais que probe/beacon
+    anomalyScore += (cls <= ANOMALY_DISASSOC) ? 0.9f * s : 0.3f * s;
   }
 
-  // 6. Beacon com SSID muito longo ou caracteres especiais
-  if (type == 0 && subtype == 8 && length > 300) {
-    anomalyScore += 0.4f;
+  return anomalyScore > 1.0f ? 1.0f : anomalyScore;
+}
+
+float WiFiAnomalyDetector::account(int length, int type, int subtype,
+                                   uint32_t nowMs) {
+  if (_idle) {
+    // Primeiro frame depois da parada: bins começam agora, sem o silêncio
+    clear(nowMs);
+    _idle = false;
+  }
+  advance(nowMs);
+  _lastFrameMs = _lastMs;
+
+  int8_t cls = frameClass(type, subtype);
+  if (cls >= 0) {
+    _rates[cls].add();
   }
 
-  // Reset contadores a cada segundo
-  uint32_t now = millis();
-  if (now - _lastCheckTime > 1000) {
-    _deauthCount = 0;
-    _probeCount = 0;
-    _lastCheckTime = now;
+  float score = scoreFrame(length, type, subtype);
+  _avgScore += SCORE_ALPHA * (score - _avgScore);
+  return score;
+}
+
+float WiFiAnomalyDetector::feedPacketCharacteristics(int length, int type,
+                                                     int subtype) {
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&_mux);
+  float score = account(length, type, subtype, nowMs);
+  portEXIT_CRITICAL(&_mux);
+  return score;
+}
+
+float WiFiAnomalyDetector::feedFrame(const uint8_t *frame, uint16_t len) {
+  if (!frame || len < 2)
+    return 0.0f;
+
+  int type = (frame[0] >> 2) & 0x03;
+  int subtype = (frame[0] >> 4) & 0x0F;
+  uint32_t nowMs = millis();
+  portENTER_CRITICAL(&_mux);
+  float score = account(len, type, subtype, nowMs);
+
+  // Deauth/disassoc por BSSID (addr3, offset 16)
+  if (type == 0 && (subtype == 12 || subtype == 10) && len >= 22) {
+    BssidRate *entry = findBssid(frame + 16, _lastMs);
+    entry->ring.advance(_lastMs, BIN_MS);
+    entry->ring.add();
+    if (entry->ring.sum >= BSSID_ATTACK_RATE && score < 1.0f) {
+      score = 1.0f;
+    }
   }
+  portEXIT_CRITICAL(&_mux);
+  return score;
+}
 
-  // Atualiza histórico para análise de tendência
-  if (_packetHistory.size() >= MAX_HISTORY) {
-    _packetHistory.erase(_packetHistory.begin());
+BssidRate *WiFiAnomalyDetector::findBssid(const uint8_t *bssid,
+                                          uint32_t nowMs) {
+  BssidRate *oldest = &_bssids[0];
+  for (uint8_t i = 0; i < MAX_BSSIDS; i++) {
+    BssidRate &e = _bssids[i];
+    if (e.used && memcmp(e.bssid, bssid, 6) == 0) {
+      e.lastSeenMs = nowMs;
+      return &e;
+    }
+    if (!e.used) {
+      oldest = &e;
+    } else if (oldest->used && (int32_t)(e.lastSeenMs - oldest->lastSeenMs) < 0) {
+      oldest = &e;
+    }
   }
-  _packetHistory.push_back({type, subtype, length, now});
 
-  return min(anomalyScore, 1.0f);
+  // LRU: reaproveita a entrada vazia ou a menos recente
+  memcpy(oldest->bssid, bssid, 6);
+  oldest->ring.reset(nowMs);
+  oldest->lastSeenMs = nowMs;
+  oldest->used = true;
+  return oldest;
 }
 
-float WiFiAnomalyDetector::getAverageAnomalyScore() const {
-  if (_packetHistory.empty()) return 0.0f;
-  
-  float total = 0.0f;
-  int count = 0;
-  
-  // Calcula score baseado no histórico
-  for (const auto& pkt : _packetHistory) {
-    // Heurística simples de peso
-    if (pkt.type == 3) total += 1.0f;
-    if (pkt.type == 0 && pkt.subtype == 12) total += 0.3f;
-    count++;
+uint16_t WiFiAnomalyDetector::getTopBssid(uint8_t *bssid) const {
+  uint16_t best = 0;
+  for (uint8_t i = 0; i < MAX_BSSIDS; i++) {
+    const BssidRate &e = _bssids[i];
+    // Entrada parada há mais de uma janela não conta mais
+    if (!e.used || _lastMs - e.lastSeenMs > RateRing::BINS * BIN_MS)
+      continue;
+    if (e.ring.sum > best) {
+      best = e.ring.sum;
+      if (bssid)
+        memcpy(bssid, e.bssid, 6);
+    }
   }
-  
-  return count > 0 ? total / count : 0.0f;
+  return best;
+}
+
+float WiFiAnomalyDetector::getBaseline(AnomalyFrameClass cls) const {
+  // Média por bin -> frames/s
+  return _detectors[cls].mean * (1000.0f / BIN_MS);
 }
 
 bool WiFiAnomalyDetector::isUnderAttack() const {
-  return getAverageAnomalyScore() > _threshold;
+  for (uint8_t i = 0; i < ANOMALY_CLASS_COUNT; i++) {
+    if (_detectors[i].alarm)
+      return true;
+  }
+  if (getTopBssid(nullptr) >= BSSID_ATTACK_RATE)
+    return true;
+  return _avgScore > _threshold;
 }
 
-void WiFiAnomalyDetector::reset() {
-  _packetHistory.clear();
-  _deauthCount = 0;
-  _probeCount = 0;
-  _lastCheckTime = millis();
+const char *WiFiAnomalyDetector::className(AnomalyFrameClass cls) {
+  switch (cls) {
+  case ANOMALY_DEAUTH:
+    return "deauth";
+  case ANOMALY_DISASSOC:
+    return "disassoc";
+  case ANOMALY_PROBE:
+    return "probe";
+  case ANOMALY_BEACON:
+    return "beacon";
+  case ANOMALY_AUTH:
+    return "auth";
+  default:
+    return "?";
+  }
 }
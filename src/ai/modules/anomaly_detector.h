@@ -1,28 +1,126 @@
 #pragma once
 #include <Arduino.h>
-#include <vector>
 
 /**
  * @file anomaly_detector.h
- * @brief Detector de anomalias WiFi leve
- * 
- * Detecta comportamentos anormais usando heurísticas e análise de tendência.
- * Otimizado para ESP32-S3 (sem TFLite pesado).
+ * @brief Detector de anomalias WiFi leve (streaming, memória constante)
+ *
+ * Cada frame custa O(1) e nada é alocado depois do construtor:
+ * - Contadores por classe de frame em anel de bins (janela deslizante de 1 s)
+ * - Linha de base EWMA (média/variância) da taxa por bin, por classe
+ * - CUSUM unilateral sobre a taxa normalizada: alarme quando a soma passa de h
+ * - Taxa de deauth/disassoc por BSSID em janela deslizante (tabela LRU)
+ *
+ * Pode ser alimentado direto do callback promíscuo (só aritmética inteira
+ * e float, sem Serial nem heap). A task de IA chama tick() antes de ler o
+ * estado: sem frames (captura parada) os bins continuam fechando e o alarme
+ * desarma. Callback e tick() disputam o estado sob um spinlock.
+ *
+ * Relógio único: millis(). Todas as diferenças são unsigned (nowMs - t),
+ * então o wrap de 32 bits (~49 dias) não trava os bins.
  */
 
-// Histórico de pacotes para análise de tendência
-struct PacketRecord {
-  uint8_t type;
-  uint8_t subtype;
-  uint16_t length;
-  uint32_t timestamp;
+// Classes de frame de gerenciamento acompanhadas
+enum AnomalyFrameClass : uint8_t {
+  ANOMALY_DEAUTH = 0, // Subtipo 12
+  ANOMALY_DISASSOC,   // Subtipo 10
+  ANOMALY_PROBE,      // Subtipo 4
+  ANOMALY_BEACON,     // Subtipo 8
+  ANOMALY_AUTH,       // Subtipo 11
+  ANOMALY_CLASS_COUNT
+};
+
+/**
+ * @brief Contador em anel de bins: soma deslizante sem histórico de pacotes
+ */
+struct RateRing {
+  static const uint8_t BINS = 10;
+
+  uint16_t bins[BINS];
+  uint32_t binStartMs; // Início do bin corrente
+  uint16_t sum;        // Soma dos BINS bins (janela inteira)
+  uint8_t head;
+
+  void reset(uint32_t nowMs);
+
+  /**
+   * @brief Avança até o bin de nowMs, zerando os bins pulados
+   * @return Quantos bins fecharam (0 se ainda no mesmo)
+   */
+  uint8_t advance(uint32_t nowMs, uint16_t binMs);
+
+  void add() {
+    // Satura: uma rajada absurda não pode dar a volta no contador
+    if (bins[head] == UINT16_MAX || sum == UINT16_MAX)
+      return;
+    bins[head]++;
+    sum++;
+  }
+  uint16_t current() const { return bins[head]; }
+};
+
+/**
+ * @brief Linha de base EWMA + CUSUM de uma classe de frame
+ */
+struct ChangeDetector {
+  float mean;     // Taxa média por bin (EWMA)
+  float var;      // Variância (EWMA)
+  float cusum;    // Soma acumulada dos desvios normalizados acima de k
+  uint32_t samples;
+  uint32_t onsetMs;   // Quando a soma saiu de zero (início estimado)
+  uint32_t alarmMs;   // Quando o alarme disparou (0 = sem alarme)
+  uint32_t latencyMs; // alarmMs - onsetMs do último alarme
+  uint16_t alarms;
+  bool alarm;
+
+  void reset();
+
+  /**
+   * @brief Consome a contagem de um bin fechado
+   * @return true na borda de subida do alarme
+   */
+  bool update(uint16_t count, uint32_t nowMs);
+
+  float score() const; // 0..1, cusum / h
+};
+
+/**
+ * @brief Taxa de deauth/disassoc por BSSID (janela deslizante)
+ */
+struct BssidRate {
+  uint8_t bssid[6];
+  RateRing ring;
+  uint32_t lastSeenMs;
+  bool used;
 };
 
 class WiFiAnomalyDetector {
 public:
+  static const uint16_t BIN_MS = 100;          // 10 bins = janela de 1 s
+  static const uint16_t WARMUP_BINS = 50;      // 5 s de linha de base
+  static const uint8_t MAX_BSSIDS = 16;
+  static const uint16_t BSSID_ATTACK_RATE = 20; // deauth+disassoc por segundo
+  // Sem nenhum frame por esse tempo a captura parou: a linha de base
+  // recomeça (com aquecimento) em vez de aprender o silêncio
+  static const uint32_t IDLE_RESET_MS = 10000;
+
   WiFiAnomalyDetector();
   void begin();
 
+  /**
+   * @brief Alimenta com um frame 802.11 cru (caminho principal)
+   * @param frame Início do cabeçalho MAC
+   * @param len Tamanho do frame
+   * @return Score de anomalia do frame (0.0 normal, 1.0 muito anômalo)
+   */
+  float feedFrame(const uint8_t *frame, uint16_t len);
+
+  /**
+   * @brief Fecha os bins vencidos sem frame novo (chamar do loop da IA)
+   * @param nowMs millis()
+   */
+  void tick(uint32_t nowMs);
+
   /**
    * @brief Analisa características de pacote
    * @param length Tamanho do pacote
@@ -33,30 +131,69 @@ public:
   float feedPacketCharacteristics(int length, int type, int subtype);
 
   /**
-   * @brief Retorna score médio baseado no histórico
+   * @brief Retorna score médio (EWMA dos scores por frame)
    */
-  float getAverageAnomalyScore() const;
+  float getAverageAnomalyScore() const { return _avgScore; }
 
   /**
-   * @brief Verifica se está sob ataque baseado no threshold
+   * @brief Verifica se está sob ataque: alarme de CUSUM, BSSID acima da
+   * taxa de ataque ou score médio acima do threshold
    */
   bool isUnderAttack() const;
 
   /**
-   * @brief Reseta contadores e histórico
+   * @brief Reseta contadores, linhas de base e tabela de BSSIDs
    */
   void reset();
 
+  // Estado por classe
+  bool isAlarm(AnomalyFrameClass cls) const { return _detectors[cls].alarm; }
+  float getClassScore(AnomalyFrameClass cls) const {
+    return _detectors[cls].score();
+  }
+  uint16_t getRate(AnomalyFrameClass cls) const { return _rates[cls].sum; }
+  float getBaseline(AnomalyFrameClass cls) const;
+  uint16_t getAlarmCount(AnomalyFrameClass cls) const {
+    return _detectors[cls].alarms;
+  }
+
+  /**
+   * @brief Atraso do último alarme: do início estimado da mudança (CUSUM
+   * saiu de zero) até o disparo
+   */
+  uint32_t getDetectionLatencyMs(AnomalyFrameClass cls) const {
+    return _detectors[cls].latencyMs;
+  }
+
+  /**
+   * @brief BSSID com maior taxa de deauth/disassoc na janela
+   * @return Taxa (frames/s), 0 se nenhum
+   */
+  uint16_t getTopBssid(uint8_t *bssid) const;
+
+  static const char *className(AnomalyFrameClass cls);
+
   // Setters
   void setThreshold(float threshold) { _threshold = threshold; }
   float getThreshold() const { return _threshold; }
 
 private:
-  static const int MAX_HISTORY = 100;
-  
   float _threshold;
-  std::vector<PacketRecord> _packetHistory;
-  uint32_t _lastCheckTime = 0;
-  uint16_t _deauthCount = 0;
-  uint16_t _probeCount = 0;
+  float _avgScore;
+  uint32_t _lastMs;
+  uint32_t _lastFrameMs; // Último frame recebido (para IDLE_RESET_MS)
+  bool _idle;            // Já zerado por falta de frames
+  portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
+  RateRing _rates[ANOMALY_CLASS_COUNT];
+  ChangeDetector _detectors[ANOMALY_CLASS_COUNT];
+  BssidRate _bssids[MAX_BSSIDS];
+
+  void clear(uint32_t nowMs);
+  void advance(uint32_t nowMs);
+  BssidRate *findBssid(const uint8_t *bssid, uint32_t nowMs);
+  float scoreFrame(int length, int type, int subtype) const;
+  float account(int length, int type, int subtype, uint32_t nowMs);
 };
+
+extern WiFiAnomalyDetector wifiAnomaly;
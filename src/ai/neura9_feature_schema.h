@@ -0,0 +1,181 @@
+#pragma once
+/**
+ * @file neura9_feature_schema.h
+ * @brief Esquema de entrada da NEURA9 (GERADO, não editar)
+ *
+ * Fonte: ai_training/neura9_features.json
+ * Gerador: scripts/gen_feature_schema.py
+ */
+
+#include <stdint.h>
+
+#define NEURA9_FEATURE_COUNT 56
+#define NEURA9_NAMED_FEATURES 37
+#define NEURA9_RESERVED_FEATURES 19
+
+// X(nome, índice): valida offsetof(Neura9Features, nome)
+#define NEURA9_FEATURE_LIST(X) \
+  X(rssi_norm, 0) \
+  X(snr_norm, 1) \
+  X(beacon_rate, 2) \
+  X(probereq_rate, 3) \
+  X(deauth_rate, 4) \
+  X(assocreq_rate, 5) \
+  X(eapol_rate, 6) \
+  X(management_frame_ratio, 7) \
+  X(data_frame_ratio, 8) \
+  X(control_frame_ratio, 9) \
+  X(sequence_gap_score, 10) \
+  X(retry_flag_ratio, 11) \
+  X(protected_flag_ratio, 12) \
+  X(duration_field_avg, 13) \
+  X(oui_score, 14) \
+  X(information_elt_hash, 15) \
+  X(transmission_rate, 16) \
+  X(channel_switch_rate, 17) \
+  X(packet_size_avg, 18) \
+  X(packet_size_std_dev, 19) \
+  X(wps_frame_ratio, 20) \
+  X(null_probe_ratio, 21) \
+  X(broadcast_ratio, 22) \
+  X(multicast_ratio, 23) \
+  X(fragment_rate, 24) \
+  X(max_burst_size, 25) \
+  X(avg_inter_packet_gap, 26) \
+  X(gap_variance, 27) \
+  X(deauth_reason_code_dist, 28) \
+  X(sequence_number_delta_avg, 29) \
+  X(iv_reuse_detected, 30) \
+  X(eapol_start_rate, 31) \
+  X(eapol_key_rate, 32) \
+  X(mac_randomness_score, 33) \
+  X(ssid_entropy, 34) \
+  X(channel_utilization, 35) \
+  X(noise_floor_est, 36)
+
+enum Neura9Feature : uint8_t {
+  NEURA9_F_RSSI_NORM = 0,
+  NEURA9_F_SNR_NORM = 1,
+  NEURA9_F_BEACON_RATE = 2,
+  NEURA9_F_PROBEREQ_RATE = 3,
+  NEURA9_F_DEAUTH_RATE = 4,
+  NEURA9_F_ASSOCREQ_RATE = 5,
+  NEURA9_F_EAPOL_RATE = 6,
+  NEURA9_F_MANAGEMENT_FRAME_RATIO = 7,
+  NEURA9_F_DATA_FRAME_RATIO = 8,
+  NEURA9_F_CONTROL_FRAME_RATIO = 9,
+  NEURA9_F_SEQUENCE_GAP_SCORE = 10,
+  NEURA9_F_RETRY_FLAG_RATIO = 11,
+  NEURA9_F_PROTECTED_FLAG_RATIO = 12,
+  NEURA9_F_DURATION_FIELD_AVG = 13,
+  NEURA9_F_OUI_SCORE = 14,
+  NEURA9_F_INFORMATION_ELT_HASH = 15,
+  NEURA9_F_TRANSMISSION_RATE = 16,
+  NEURA9_F_CHANNEL_SWITCH_RATE = 17,
+  NEURA9_F_PACKET_SIZE_AVG = 18,
+  NEURA9_F_PACKET_SIZE_STD_DEV = 19,
+  NEURA9_F_WPS_FRAME_RATIO = 20,
+  NEURA9_F_NULL_PROBE_RATIO = 21,
+  NEURA9_F_BROADCAST_RATIO = 22,
+  NEURA9_F_MULTICAST_RATIO = 23,
+  NEURA9_F_FRAGMENT_RATE = 24,
+  NEURA9_F_MAX_BURST_SIZE = 25,
+  NEURA9_F_AVG_INTER_PACKET_GAP = 26,
+  NEURA9_F_GAP_VARIANCE = 27,
+  NEURA9_F_DEAUTH_REASON_CODE_DIST = 28,
+  NEURA9_F_SEQUENCE_NUMBER_DELTA_AVG = 29,
+  NEURA9_F_IV_REUSE_DETECTED = 30,
+  NEURA9_F_EAPOL_START_RATE = 31,
+  NEURA9_F_EAPOL_KEY_RATE = 32,
+  NEURA9_F_MAC_RANDOMNESS_SCORE = 33,
+  NEURA9_F_SSID_ENTROPY = 34,
+  NEURA9_F_CHANNEL_UTILIZATION = 35,
+  NEURA9_F_NOISE_FLOOR_EST = 36,
+  NEURA9_F_RESERVED_FEATURES = 37,
+};
+
+// Entrada do modelo = valor * gain + bias (faixa [min, max] -> [0, 1])
+constexpr float NEURA9_FEATURE_GAIN[NEURA9_FEATURE_COUNT] = {
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f,
+};
+
+constexpr float NEURA9_FEATURE_BIAS[NEURA9_FEATURE_COUNT] = {
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f,
+};
+
+constexpr const char *NEURA9_FEATURE_NAMES[NEURA9_FEATURE_COUNT] = {
+    "rssi_norm",
+    "snr_norm",
+    "beacon_rate",
+    "probereq_rate",
+    "deauth_rate",
+    "assocreq_rate",
+    "eapol_rate",
+    "management_frame_ratio",
+    "data_frame_ratio",
+    "control_frame_ratio",
+    "sequence_gap_score",
+    "retry_flag_ratio",
+    "protected_flag_ratio",
+    "duration_field_avg",
+    "oui_score",
+    "information_elt_hash",
+    "transmission_rate",
+    "channel_switch_rate",
+    "packet_size_avg",
+    "packet_size_std_dev",
+    "wps_frame_ratio",
+    "null_probe_ratio",
+    "broadcast_ratio",
+    "multicast_ratio",
+    "fragment_rate",
+    "max_burst_size",
+    "avg_inter_packet_gap",
+    "gap_variance",
+    "deauth_reason_code_dist",
+    "sequence_number_delta_avg",
+    "iv_reuse_detected",
+    "eapol_start_rate",
+    "eapol_key_rate",
+    "mac_randomness_score",
+    "ssid_entropy",
+    "channel_utilization",
+    "noise_floor_est",
+    "reserved_features_0",
+    "reserved_features_1",
+    "reserved_features_2",
+    "reserved_features_3",
+    "reserved_features_4",
+    "reserved_features_5",
+    "reserved_features_6",
+    "reserved_features_7",
+    "reserved_features_8",
+    "reserved_features_9",
+    "reserved_features_10",
+    "reserved_features_11",
+    "reserved_features_12",
+    "reserved_features_13",
+    "reserved_features_14",
+    "reserved_features_15",
+    "reserved_features_16",
+    "reserved_features_17",
+    "reserved_features_18",
+};
@@ -1,5 +1,10 @@
 #include "neura9_inference.h"
+#include "model_runtime.h"
+#include "neura9_feature_schema.h"
 #include "neura9_model_data.h"
+#include <Preferences.h>
+#include <algorithm>
+#include <new>
 
 // TFLite Micro includes (depende da lib instalada)
 // Usando apenas os headers essenciais que costumam estar presentes em porting
@@ -7,92 +12,288 @@
 #include <tensorflow/lite/micro/micro_error_reporter.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/micro/micro_profiler.h>
 #include <tensorflow/lite/schema/schema_generated.h>
 // #include <tensorflow/lite/version.h> // Removido pois causa erro em algumas
 // libs
 
 // Globais para evitar realocação
 // Tip 10: Arena fixa, nunca alocar dinamicamente durante runtime
-// Tip 6: Cache na PSRAM
+// Arena e pesos: local e tamanho decididos pelo planner (ver planMemory)
+
+// 2: arena inclui os temporários do Prepare (planos da v1 abortam)
+#define NEURA9_PLAN_VERSION 2
 
 NEURA9Inference neura9;
 
-NEURA9Inference::NEURA9Inference() {
+/**
+ * @brief Soma o tempo de cada op por nome (tag) em vez de guardar eventos
+ *
+ * A classe base ainda carrega os arrays de eventos (~12 KB), por isso só
+ * existe durante o benchmark, em PSRAM.
+ */
+class Neura9OpProfiler : public tflite::MicroProfiler {
+public:
+  uint32_t BeginEvent(const char *tag) override {
+    uint8_t i = 0;
+    while (i < _count && _ops[i].tag != tag && strcmp(_ops[i].tag, tag) != 0)
+      i++;
+    if (i == _count) {
+      if (_count >= NEURA9_MAX_PROFILED_OPS)
+        return NEURA9_MAX_PROFILED_OPS; // Descartado
+      _ops[_count++] = {tag, 0, 0};
+    }
+    _start[i] = micros();
+    return i;
+  }
+
+  void EndEvent(uint32_t handle) override {
+    if (handle >= _count)
+      return;
+    _ops[handle].totalUs += micros() - _start[handle];
+    _ops[handle].calls++;
+  }
+
+  void clear() { _count = 0; }
+  uint8_t count() const { return _count; }
+  const Neura9OpTiming &op(uint8_t i) const { return _ops[i]; }
+
+private:
+  Neura9OpTiming _ops[NEURA9_MAX_PROFILED_OPS];
+  uint32_t _start[NEURA9_MAX_PROFILED_OPS];
+  uint8_t _count = 0;
+};
+
+/**
+ * @brief Aloca em DRAM interna (se sobrar NEURA9_DRAM_RESERVE) ou PSRAM
+ */
+static uint8_t *allocIn(Neura9Placement place, size_t size) {
+  if (place == NEURA9_MEM_DRAM) {
+    const uint32_t caps = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    if (heap_caps_get_largest_free_block(caps) < size + NEURA9_DRAM_RESERVE)
+      return nullptr;
+    return (uint8_t *)heap_caps_malloc(size, caps);
+  }
+  return (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+}
+
+// FNV-1a: invalida o plano salvo quando o modelo muda
+static uint32_t modelHash(const uint8_t *data, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ data[i]) * 16777619u;
+  }
+  return h;
+}
+
+/**
+ * @brief Interpretador temporário (arena própria, profiler opcional)
+ *
+ * Planner, benchmark e avaliação não tocam nos tensores do interpretador
+ * principal, que a task de IA usa em paralelo.
+ */
+struct Neura9Scratch {
+  uint8_t *arena = nullptr;
+  Neura9OpProfiler *profiler = nullptr;
+  tflite::MicroInterpreter *interpreter = nullptr;
+
+  bool begin(const tflite::Model *model, tflite::ErrorReporter *reporter,
+             size_t arenaSize, Neura9Placement arenaPlace, bool profile) {
+    arena = allocIn(arenaPlace, arenaSize);
+    if (!arena && arenaPlace != NEURA9_MEM_PSRAM)
+      arena = allocIn(NEURA9_MEM_PSRAM, arenaSize);
+    void *mem = heap_caps_malloc(sizeof(tflite::MicroInterpreter),
+                                 MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (profile) {
+      void *pmem = heap_caps_malloc(sizeof(Neura9OpProfiler),
+                                    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (pmem)
+        profiler = new (pmem) Neura9OpProfiler();
+    }
+    if (!arena || !mem || (profile && !profiler)) {
+      if (mem)
+        heap_caps_free(mem);
+      return false;
+    }
+    interpreter = new (mem) tflite::MicroInterpreter(
+        model, ModelRuntime::resolver(), arena, arenaSize, reporter, nullptr, profiler);
+    return interpreter->AllocateTensors() == kTfLiteOk;
+  }
+
+  ~Neura9Scratch() {
+    if (interpreter) {
+      interpreter->~MicroInterpreter();
+      heap_caps_free(interpreter);
+    }
+    if (profiler) {
+      profiler->~Neura9OpProfiler();
+      heap_caps_free(profiler);
+    }
+    if (arena)
+      heap_caps_free(arena);
+  }
+};
+
+// Interpretador principal: tamanho da arena só é conhecido em runtime
+alignas(tflite::MicroInterpreter) static uint8_t
+    s_interpreterMem[sizeof(tflite::MicroInterpreter)];
+
+// Multiplicador/offset INT8 por feature para o tensor de entrada
+static void computeQuantParams(const TfLiteTensor *in, float *mul,
+                               float *add) {
+  float scale = in->params.scale;
+  for (size_t i = 0; i < NEURA9_FEATURE_COUNT; i++) {
+    mul[i] = NEURA9_FEATURE_GAIN[i] / scale;
+    add[i] = NEURA9_FEATURE_BIAS[i] / scale + in->params.zero_point;
+  }
+}
+
+static void packInput(TfLiteTensor *in, const Neura9Features &features,
+                      const float *mul, const float *add, size_t count) {
+  if (in->type == kTfLiteFloat32) {
+    NEURA9Inference::normalizeFeatures(features, in->data.f, count);
+  } else if (in->type == kTfLiteInt8) {
+    NEURA9Inference::quantizeFeatures(features, mul, add, in->data.int8,
+                                      count);
+  }
+  // Modelo com mais entradas que o esquema: completa com zero real
+  int total = in->dims->data[in->dims->size - 1];
+  for (int i = count; i < total; i++) {
+    if (in->type == kTfLiteFloat32) {
+      in->data.f[i] = 0.0f;
+    } else if (in->type == kTfLiteInt8) {
+      in->data.int8[i] = in->params.zero_point;
+    }
+  }
+}
+
+static int argmaxOutput(const TfLiteTensor *out, float *score) {
+  float max_score = 0;
+  int max_index = -1;
+
+  int classes = out->dims->data[out->dims->size - 1];
+  if (out->type == kTfLiteFloat32) {
+    const float *output_data = out->data.f;
+    for (int i = 0; i < classes; i++) {
+      if (output_data[i] > max_score) {
+        max_score = output_data[i];
+        max_index = i;
+      }
+    }
+  } else if (out->type == kTfLiteInt8) { // Tip 1: INT8 Output
+    const int8_t *output_data = out->data.int8;
+    for (int i = 0; i < classes; i++) {
+      // Dequantize: (value - zero_point) * scale
+      float val = (output_data[i] - out->params.zero_point) * out->params.scale;
+      if (val > max_score) {
+        max_score = val;
+        max_index = i;
+      }
+    }
+  }
+  *score = max_score;
+  return max_index;
+}
+
+static size_t modelInputCount(const TfLiteTensor *in) {
+  size_t n = in->dims->data[in->dims->size - 1];
+  return n > NEURA9_FEATURE_COUNT ? NEURA9_FEATURE_COUNT : n;
+}
+
+NEURA9Inference::NEURA9Inference()
+    : _modelData(g_neura9_model_data), _modelLen(g_neura9_model_data_len) {
   _lastResult = {RESULT_UNKNOWN, 0.0f, 0};
   _lastFeatures.reset();
+  memset(&_plan, 0, sizeof(_plan));
 }
 
 NEURA9Inference::~NEURA9Inference() {
+  if (interpreter)
+    interpreter->~MicroInterpreter();
   if (tensor_arena)
-    free(tensor_arena);
+    heap_caps_free(tensor_arena);
+  if (_modelCopy)
+    heap_caps_free(_modelCopy);
 }
 
 void NEURA9Inference::setLiteMode(bool enabled) { _liteMode = enabled; }
 
+void NEURA9Inference::setModelData(const uint8_t *data, size_t len) {
+  if (_initialized)
+    return;
+  _modelData = data;
+  _modelLen = len;
+}
+
 bool NEURA9Inference::begin() {
   if (_initialized)
     return true;
 
-  Serial.println("[NEURA9] Inicializando TFLite Micro na PSRAM...");
+  Serial.println("[NEURA9] Inicializando TFLite Micro...");
 
-  // 1. Alocar Arena na PSRAM (Tip 6)
-  tensor_arena = (uint8_t *)heap_caps_malloc(
-      NEURA9_ARENA_SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-  if (!tensor_arena) {
-    Serial.println("[NEURA9] FALHA: Sem memória PSRAM para Arena!");
-    return false;
+  // 1. Setup Error Reporter (ops: resolver compartilhado do ModelRuntime)
+  error_reporter = ModelRuntime::reporter();
+
+  // Tentativa anterior que falhou no meio
+  if (interpreter) {
+    interpreter->~MicroInterpreter();
+    interpreter = nullptr;
+  }
+  if (tensor_arena) {
+    heap_caps_free(tensor_arena);
+    tensor_arena = nullptr;
+  }
+  if (_modelCopy) {
+    heap_caps_free(_modelCopy);
+    _modelCopy = nullptr;
   }
 
-  // 2. Setup Error Reporter
-  static tflite::MicroErrorReporter micro_error_reporter;
-  error_reporter = &micro_error_reporter;
-
-  // 3. Map Model
-  // Tip 22: Load NEURA9 model from flash to PSRAM blocks
-  // Copying model to PSRAM avoids Flash XIP contention and potentially speeds
-  // up inference
-  static uint8_t *model_psram_copy = nullptr;
-  if (!model_psram_copy) {
-    if (g_neura9_model_data_len > 0) {
-      model_psram_copy = (uint8_t *)heap_caps_malloc(g_neura9_model_data_len,
-                                                     MALLOC_CAP_SPIRAM);
-      if (model_psram_copy) {
-        memcpy(model_psram_copy, g_neura9_model_data, g_neura9_model_data_len);
-        Serial.println("[NEURA9] Modelo copiado para PSRAM (Performance++)");
-      } else {
-        Serial.println(
-            "[NEURA9] Falha ao alocar modelo na PSRAM, usando Flash (XIP)");
-      }
-    }
+  // 2. Layout de memória: NVS ou medição no primeiro boot
+  if (!loadPlan()) {
+    Serial.println("[NEURA9] Medindo layout de memória...");
+    if (!planMemory())
+      return false;
+    savePlan();
   }
 
-  // Use PSRAM copy if available, otherwise Flash
-  const void *model_data_ptr =
-      model_psram_copy ? model_psram_copy : g_neura9_model_data;
-  model = tflite::GetModel(model_data_ptr);
+  // 3. Pesos onde o invoke foi mais rápido (flash XIP, DRAM ou PSRAM)
+  _weightsPlace = (Neura9Placement)_plan.weights;
+  const uint8_t *model_data = placeWeights(_weightsPlace, &_modelCopy);
+  if (!model_data) {
+    Serial.printf("[NEURA9] Sem memória para pesos em %s, usando flash\n",
+                  placementName(_weightsPlace));
+    _weightsPlace = NEURA9_MEM_FLASH;
+    model_data = _modelData;
+  }
+  model = tflite::GetModel(model_data);
   if (model->version() != TFLITE_SCHEMA_VERSION) {
     Serial.printf("[NEURA9] Erro: Versão do Schema %d != %d\n",
                   model->version(), TFLITE_SCHEMA_VERSION);
     return false;
   }
 
-  // 4. Resolver Ops
-  static tflite::MicroMutableOpResolver<5> resolver;
-  resolver.AddFullyConnected();
-  resolver.AddSoftmax();
-  resolver.AddRelu();
-  resolver.AddQuantize();
-  resolver.AddDequantize();
+  // 4. Arena com o tamanho medido: DRAM interna se couber, senão PSRAM
+  _arenaPlace = NEURA9_MEM_DRAM;
+  tensor_arena = allocIn(NEURA9_MEM_DRAM, _plan.arenaSize);
+  if (!tensor_arena) {
+    _arenaPlace = NEURA9_MEM_PSRAM;
+    tensor_arena = allocIn(NEURA9_MEM_PSRAM, _plan.arenaSize);
+  }
+  if (!tensor_arena) {
+    Serial.println("[NEURA9] FALHA: Sem memória para Arena!");
+    return false;
+  }
 
   // 5. Interpreter
-  static tflite::MicroInterpreter static_interpreter(
-      model, resolver, tensor_arena, NEURA9_ARENA_SIZE, error_reporter);
-  interpreter = &static_interpreter;
+  interpreter = new (s_interpreterMem) tflite::MicroInterpreter(
+      model, ModelRuntime::resolver(), tensor_arena, _plan.arenaSize, error_reporter);
 
   // 6. Allocate Tensors
   TfLiteStatus allocate_status = interpreter->AllocateTensors();
   if (allocate_status != kTfLiteOk) {
-    Serial.println("[NEURA9] Erro ao alocar tensores!");
+    // Plano salvo não serve mais (lib/kernels mudaram): mede de novo
+    Serial.println("[NEURA9] Erro ao alocar tensores, refazendo plano!");
+    resetMemoryPlan();
     return false;
   }
 
@@ -100,8 +301,220 @@ bool NEURA9Inference::begin() {
   input = interpreter->input(0);
   output = interpreter->output(0);
 
+  // 8. Entrada conforme o esquema gerado (neura9_feature_schema.h)
+  _inputCount = input->dims->data[input->dims->size - 1];
+  if (_inputCount != NEURA9_FEATURE_COUNT) {
+    Serial.printf("[NEURA9] Aviso: modelo espera %d features, esquema tem %d\n",
+                  (int)_inputCount, NEURA9_FEATURE_COUNT);
+  }
+  _inputCount = modelInputCount(input);
+  if (input->type == kTfLiteInt8) {
+    computeQuantParams(input, _qMul, _qAdd);
+  }
+
+  // 9. Dimensão de tempo: (1, timesteps, features) alimentada pelo anel
+  int steps = input->dims->size >= 3 ? input->dims->data[input->dims->size - 2]
+                                     : 1;
+  if (steps > 1) {
+    int width = input->dims->data[input->dims->size - 1];
+    if (input->type != kTfLiteInt8) {
+      Serial.println("[NEURA9] Aviso: sequência só com entrada INT8, usando "
+                     "uma janela");
+    } else if (!_sequence.begin(steps, width, input->params.zero_point)) {
+      Serial.printf("[NEURA9] Aviso: anel de %d passos indisponível\n", steps);
+    } else {
+      Serial.printf("[NEURA9] Modelo de sequência: %d janelas x %d\n", steps,
+                    width);
+    }
+  }
+
   _initialized = true;
-  Serial.println("[NEURA9] Pronto! Engine TFLite rodando na PSRAM.");
+  Serial.printf("[NEURA9] Pronto! Arena %lu B em %s, pesos em %s\n",
+                (unsigned long)_plan.arenaSize, placementName(_arenaPlace),
+                placementName(_weightsPlace));
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PLANNER DE MEMÓRIA
+// ═══════════════════════════════════════════════════════════════════════════
+
+const char *NEURA9Inference::placementName(Neura9Placement place) {
+  switch (place) {
+  case NEURA9_MEM_FLASH:
+    return "flash";
+  case NEURA9_MEM_DRAM:
+    return "DRAM";
+  case NEURA9_MEM_PSRAM:
+    return "PSRAM";
+  default:
+    return "?";
+  }
+}
+
+bool NEURA9Inference::loadPlan() {
+  Preferences prefs;
+  prefs.begin("neura9", true);
+  size_t len = prefs.getBytes("plan", &_plan, sizeof(_plan));
+  prefs.end();
+
+  return len == sizeof(_plan) && _plan.version == NEURA9_PLAN_VERSION &&
+         _plan.modelLen == _modelLen &&
+         _plan.modelHash == modelHash(_modelData, _modelLen) &&
+         _plan.arenaSize > 0 && _plan.arenaSize <= NEURA9_ARENA_SIZE &&
+         _plan.weights < NEURA9_MEM_COUNT;
+}
+
+void NEURA9Inference::savePlan() {
+  Preferences prefs;
+  prefs.begin("neura9", false);
+  prefs.putBytes("plan", &_plan, sizeof(_plan));
+  prefs.end();
+}
+
+void NEURA9Inference::resetMemoryPlan() {
+  Preferences prefs;
+  prefs.begin("neura9", false);
+  prefs.remove("plan");
+  prefs.end();
+}
+
+const uint8_t *NEURA9Inference::placeWeights(Neura9Placement place,
+                                             uint8_t **copy) {
+  *copy = nullptr;
+  if (place == NEURA9_MEM_FLASH)
+    return _modelData;
+  *copy = allocIn(place, _modelLen);
+  if (!*copy)
+    return nullptr;
+  memcpy(*copy, _modelData, _modelLen);
+  return *copy;
+}
+
+/**
+ * @brief Arena mínima para um uso medido de `used` bytes
+ *
+ * arena_used_bytes() não conta os temporários do Prepare: cada op monta um
+ * TfLiteTensor (e a quantização) por entrada/saída entre o head e o tail.
+ * Com a arena justa o TFLite Micro não devolve erro, aborta (DCHECK no
+ * AllocateTempTfLiteTensor), então a folga vem do pior op do grafo.
+ */
+static size_t planArenaSize(const tflite::Model *model, size_t used) {
+  const tflite::SubGraph *graph = model->subgraphs()->Get(0);
+  size_t worst = 0;
+  for (const tflite::Operator *op : *graph->operators()) {
+    size_t bytes = 0;
+    for (const flatbuffers::Vector<int32_t> *list :
+         {op->inputs(), op->outputs()}) {
+      for (int32_t t : *list) {
+        if (t < 0)
+          continue; // Entrada opcional ausente
+        bytes += sizeof(TfLiteTensor) + 16;
+        const tflite::QuantizationParameters *q =
+            graph->tensors()->Get(t)->quantization();
+        if (q && q->scale() && q->scale()->size() > 0) {
+          bytes += sizeof(TfLiteAffineQuantization) +
+                   TfLiteIntArrayGetSizeInBytes(q->scale()->size()) + 32;
+        }
+      }
+    }
+    worst = std::max(worst, bytes);
+  }
+  // + 16 B para o alinhamento do início da arena
+  return (used + worst + 16 + 15) & ~(size_t)15;
+}
+
+// Mediana do invoke com entrada fixa (o custo não depende dos valores)
+static uint32_t medianInvokeUs(tflite::MicroInterpreter *interp) {
+  uint32_t samples[NEURA9_PLAN_ITERATIONS];
+  memset(interp->input(0)->data.raw, 0, interp->input(0)->bytes);
+  interp->Invoke(); // Aquece o cache
+  for (uint16_t i = 0; i < NEURA9_PLAN_ITERATIONS; i++) {
+    uint32_t t0 = micros();
+    if (interp->Invoke() != kTfLiteOk)
+      return 0;
+    samples[i] = micros() - t0;
+  }
+  std::sort(samples, samples + NEURA9_PLAN_ITERATIONS);
+  return samples[NEURA9_PLAN_ITERATIONS / 2];
+}
+
+/**
+ * @brief Mede o layout ideal: arena exata e local mais rápido dos pesos
+ *
+ * 1. Sonda com a arena no teto e lê arena_used_bytes().
+ * 2. Soma os temporários do Prepare (planArenaSize) e confirma o tamanho.
+ * 3. Mede o invoke com os pesos em flash, DRAM e PSRAM, arena em DRAM.
+ */
+bool NEURA9Inference::planMemory() {
+  memset(&_plan, 0, sizeof(_plan));
+  _plan.version = NEURA9_PLAN_VERSION;
+  _plan.modelLen = _modelLen;
+  _plan.modelHash = modelHash(_modelData, _modelLen);
+
+  const tflite::Model *flashModel = tflite::GetModel(_modelData);
+  if (flashModel->version() != TFLITE_SCHEMA_VERSION) {
+    Serial.printf("[NEURA9] Erro: Versão do Schema %d != %d\n",
+                  flashModel->version(), TFLITE_SCHEMA_VERSION);
+    return false;
+  }
+
+  size_t used;
+  {
+    Neura9Scratch probe;
+    if (!probe.begin(flashModel, error_reporter, NEURA9_ARENA_SIZE,
+                     NEURA9_MEM_PSRAM, false)) {
+      Serial.println("[NEURA9] FALHA: modelo não cabe em NEURA9_ARENA_SIZE");
+      return false;
+    }
+    used = probe.interpreter->arena_used_bytes();
+  }
+
+  // Uso + temporários do Prepare; sem tentar tamanhos menores, que abortam
+  // dentro do TFLite Micro em vez de falhar
+  size_t size = planArenaSize(flashModel, used);
+  if (size > NEURA9_ARENA_SIZE)
+    return false;
+  {
+    Neura9Scratch fit;
+    if (!fit.begin(flashModel, error_reporter, size, NEURA9_MEM_PSRAM,
+                   false)) {
+      Serial.printf("[NEURA9] FALHA: arena de %u B não aloca\n",
+                    (unsigned)size);
+      return false;
+    }
+  }
+  _plan.arenaSize = size;
+
+  _plan.weights = NEURA9_MEM_FLASH;
+  for (uint8_t p = 0; p < NEURA9_MEM_COUNT; p++) {
+    uint8_t *copy = nullptr;
+    const uint8_t *data = placeWeights((Neura9Placement)p, &copy);
+    if (!data)
+      continue; // Sem espaço neste local
+    {
+      Neura9Scratch run;
+      if (run.begin(tflite::GetModel(data), error_reporter, size,
+                    NEURA9_MEM_DRAM, false)) {
+        _plan.invokeUs[p] = medianInvokeUs(run.interpreter);
+      }
+    }
+    if (copy)
+      heap_caps_free(copy);
+    if (_plan.invokeUs[p] &&
+        (!_plan.invokeUs[_plan.weights] ||
+         _plan.invokeUs[p] < _plan.invokeUs[_plan.weights])) {
+      _plan.weights = p;
+    }
+  }
+
+  Serial.printf("[NEURA9] Plano: arena %lu B (uso %u), invoke flash %lu us, "
+                "DRAM %lu us, PSRAM %lu us -> pesos em %s\n",
+                (unsigned long)_plan.arenaSize, (unsigned)used,
+                (unsigned long)_plan.invokeUs[NEURA9_MEM_FLASH],
+                (unsigned long)_plan.invokeUs[NEURA9_MEM_DRAM],
+                (unsigned long)_plan.invokeUs[NEURA9_MEM_PSRAM],
+                placementName((Neura9Placement)_plan.weights));
   return true;
 }
 
@@ -129,13 +542,7 @@ bool NEURA9Inference::shouldRunInference(
   // Tip 12: Caching de Predição - Delta Check
   // Se as features mudaram muito pouco, não roda inferência pesada, retorna
   // cache.
-  float delta = 0.0f;
-  delta += abs(currentFeatures.rssi_norm - _lastFeatures.rssi_norm);
-  delta += abs(currentFeatures.beacon_rate - _lastFeatures.beacon_rate);
-  delta += abs(currentFeatures.deauth_rate - _lastFeatures.deauth_rate);
-
-  // Se mudou menos de 5% no total das features chave
-  if (delta < 0.05f &&
+  if (!featuresChanged(currentFeatures) &&
       (now - _lastInferenceTime < 2000)) { // Força a cada 2s mesmo sem mudança
     return false;                          // Usa cache
   }
@@ -143,57 +550,46 @@ bool NEURA9Inference::shouldRunInference(
   return true;
 }
 
+bool NEURA9Inference::featuresChanged(const Neura9Features &features) const {
+  float delta = 0.0f;
+  delta += abs(features.rssi_norm - _lastFeatures.rssi_norm);
+  delta += abs(features.beacon_rate - _lastFeatures.beacon_rate);
+  delta += abs(features.deauth_rate - _lastFeatures.deauth_rate);
+
+  // Se mudou menos de 5% no total das features chave
+  return delta >= 0.05f;
+}
+
+void NEURA9Inference::pushWindow(const Neura9Features &features) {
+  if (!_sequence.isReady())
+    return;
+  // Quantiza direto no slot (as colunas além do esquema ficam no zero real)
+  quantizeFeatures(features, _qMul, _qAdd, _sequence.slot(), _inputCount);
+  _sequence.commit();
+}
+
 InferenceResult NEURA9Inference::predict(const Neura9Features &features) {
+  pushWindow(features);
   // Check if we should actually run (Tip 12 logic inside)
   if (!shouldRunInference(features)) {
     // Return cached result (Tip 12)
     return _lastResult;
   }
+  return run(features);
+}
+
+InferenceResult NEURA9Inference::run(const Neura9Features &features) {
+  if (!_initialized)
+    return {RESULT_UNKNOWN, 0.0f, 0};
 
   uint32_t start = millis();
 
-  // Preencher Input Tensor
-  if (input->type == kTfLiteFloat32) {
-    float *input_data = input->data.f;
-    // Tip 2: 56 Features Mapping
-    // Mapeia features da struct para o tensor plano
-    input_data[0] = features.rssi_norm;
-    input_data[1] = features.snr_norm;
-    input_data[2] = features.beacon_rate;
-    input_data[3] = features.probereq_rate;
-    input_data[4] = features.deauth_rate;
-    input_data[5] = features.assocreq_rate;
-    input_data[6] = features.eapol_rate;
-    input_data[7] = features.management_frame_ratio;
-
-    // ... mapeamento das outras features (simplificado para loop se fosse
-    // array) Para 56 features, idealmente teríamos um loop ou memcpy se struct
-    // alinhada
-
-  } else if (input->type == kTfLiteInt8) {
-    int8_t *input_data = input->data.int8;
-
-    // Helper lambda for quantization: value -> (value / scale) + zero_point
-    auto quantize = [&](float val) -> int8_t {
-      float q_val = (val / input->params.scale) + input->params.zero_point;
-      return (int8_t)max(-128.0f, min(127.0f, q_val));
-    };
-
-    // Tip 2: 56 Features Mapping (Quantized)
-    input_data[0] = quantize(features.rssi_norm);
-    input_data[1] = quantize(features.snr_norm);
-    input_data[2] = quantize(features.beacon_rate);
-    input_data[3] = quantize(features.probereq_rate);
-    input_data[4] = quantize(features.deauth_rate);
-    input_data[5] = quantize(features.assocreq_rate);
-    input_data[6] = quantize(features.eapol_rate);
-    input_data[7] = quantize(features.management_frame_ratio);
-
-    // Fill remaining features with 0 (or appropriate default) if not used yet
-    // Assuming 8 features used for now out of 56
-    for (int i = 8; i < input->dims->data[1]; i++) {
-      input_data[i] = input->params.zero_point;
-    }
+  // Preencher Input Tensor: a struct inteira, em um laço (Tip 2), ou a
+  // sequência inteira do anel em um memcpy
+  if (_sequence.isReady()) {
+    memcpy(input->data.int8, _sequence.view(), _sequence.bytes());
+  } else {
+    packInput(input, features, _qMul, _qAdd, _inputCount);
   }
 
   // Rodar Inferência
@@ -205,22 +601,7 @@ InferenceResult NEURA9Inference::predict(const Neura9Features &features) {
 
   // Processar Output
   float max_score = 0;
-  int max_index = -1;
-
-  if (output->type == kTfLiteFloat32) {
-    // ... float parsing
-  } else if (output->type == kTfLiteInt8) { // Tip 1: INT8 Output
-    int8_t *output_data = output->data.int8;
-    for (int i = 0; i < output->dims->data[1]; i++) {
-      // Dequantize: (value - zero_point) * scale
-      float val =
-          (output_data[i] - output->params.zero_point) * output->params.scale;
-      if (val > max_score) {
-        max_score = val;
-        max_index = i;
-      }
-    }
-  }
+  int max_index = argmaxOutput(output, &max_score);
 
   _lastInferenceTime = millis();
   _lastFeatures = features; // Update cache
@@ -230,3 +611,216 @@ InferenceResult NEURA9Inference::predict(const Neura9Features &features) {
 
   return _lastResult;
 }
+
+void NEURA9Inference::quantizeFeatures(const Neura9Features &features,
+                                       const float *mul, const float *add,
+                                       int8_t *out, size_t count) {
+  const float *f = features.data();
+  for (size_t i = 0; i < count; i++) {
+    float q = f[i] * mul[i] + add[i];
+    q = q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q);
+    out[i] = (int8_t)lrintf(q);
+  }
+}
+
+void NEURA9Inference::normalizeFeatures(const Neura9Features &features,
+                                        float *out, size_t count) {
+  const float *f = features.data();
+  for (size_t i = 0; i < count; i++) {
+    out[i] = f[i] * NEURA9_FEATURE_GAIN[i] + NEURA9_FEATURE_BIAS[i];
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// BENCHMARK / AVALIAÇÃO
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool NEURA9Inference::benchmark(Neura9BenchResult *out, uint16_t iterations) {
+  if (!_initialized || !out || iterations == 0)
+    return false;
+  memset(out, 0, sizeof(*out));
+
+  Neura9Scratch scratch;
+  if (!scratch.begin(model, error_reporter, _plan.arenaSize, NEURA9_MEM_PSRAM,
+                     true)) {
+    Serial.println("[NEURA9] Benchmark: falha ao montar interpretador");
+    return false;
+  }
+
+  uint32_t *samples = (uint32_t *)heap_caps_malloc(
+      iterations * sizeof(uint32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!samples)
+    return false;
+
+  TfLiteTensor *in = scratch.interpreter->input(0);
+  size_t count = modelInputCount(in);
+  float mul[NEURA9_FEATURE_COUNT];
+  float add[NEURA9_FEATURE_COUNT];
+  computeQuantParams(in, mul, add);
+
+  // Entradas aleatórias em [0, 1]: o custo do modelo não depende dos valores,
+  // mas evita medir só o caminho de zeros
+  Neura9Features features;
+  float *f = reinterpret_cast<float *>(&features);
+  for (uint16_t i = 0; i < iterations; i++) {
+    for (size_t k = 0; k < NEURA9_FEATURE_COUNT; k++) {
+      f[k] = (esp_random() & 0xFFFF) / 65535.0f;
+    }
+    packInput(in, features, mul, add, count);
+    uint32_t t0 = micros();
+    if (scratch.interpreter->Invoke() != kTfLiteOk) {
+      heap_caps_free(samples);
+      Serial.println("[NEURA9] Benchmark: Invoke falhou!");
+      return false;
+    }
+    samples[i] = micros() - t0;
+    // Até 2000 invokes seguidos: deixa o idle do core rodar (watchdog)
+    if ((i & 63) == 63)
+      vTaskDelay(1);
+  }
+
+  std::sort(samples, samples + iterations);
+  out->iterations = iterations;
+  out->p50Us = samples[(iterations - 1) * 50 / 100];
+  out->p90Us = samples[(iterations - 1) * 90 / 100];
+  out->p99Us = samples[(iterations - 1) * 99 / 100];
+  out->maxUs = samples[iterations - 1];
+  heap_caps_free(samples);
+
+  out->opCount = scratch.profiler->count();
+  for (uint8_t i = 0; i < out->opCount; i++) {
+    out->ops[i] = scratch.profiler->op(i);
+  }
+
+  out->arenaSize = _plan.arenaSize;
+  out->arenaUsed = scratch.interpreter->arena_used_bytes();
+  out->arenaNeeded = planArenaSize(model, out->arenaUsed);
+  out->arenaRecommended =
+      (out->arenaNeeded * (100 + NEURA9_ARENA_MARGIN_PCT) / 100 + 1023) &
+      ~1023u;
+  // Arena do plano (salva na NVS) contra o uso medido agora: fica grande
+  // demais se o modelo/kernels passaram a usar menos sem refazer o plano
+  out->arenaOk = out->arenaSize >= out->arenaNeeded &&
+                 out->arenaSize <= out->arenaRecommended;
+
+  Serial.printf("[NEURA9] Benchmark %u invokes: p50 %lu us, p90 %lu us, "
+                "p99 %lu us, max %lu us\n",
+                iterations, (unsigned long)out->p50Us,
+                (unsigned long)out->p90Us, (unsigned long)out->p99Us,
+                (unsigned long)out->maxUs);
+  for (uint8_t i = 0; i < out->opCount; i++) {
+    const Neura9OpTiming &op = out->ops[i];
+    Serial.printf("[NEURA9]   %-16s %6lu us/invoke (%lu chamadas)\n", op.tag,
+                  (unsigned long)(op.totalUs / iterations),
+                  (unsigned long)op.calls);
+  }
+  Serial.printf("[NEURA9] Arena: %u usados (%u com temporários) de %u bytes\n",
+                (unsigned)out->arenaUsed, (unsigned)out->arenaNeeded,
+                (unsigned)out->arenaSize);
+  if (!out->arenaOk) {
+    Serial.printf("[NEURA9] FALHA: arena do plano (%u B) fora de %u..%u B "
+                  "(necessário + %d%%), refazer o plano\n",
+                  (unsigned)out->arenaSize, (unsigned)out->arenaNeeded,
+                  (unsigned)out->arenaRecommended, NEURA9_ARENA_MARGIN_PCT);
+  }
+  return true;
+}
+
+bool NEURA9Inference::evaluate(fs::FS &fs, const char *path,
+                               Neura9EvalResult *out) {
+  if (!_initialized || !out)
+    return false;
+  memset(out, 0, sizeof(*out));
+
+  File file = fs.open(path, FILE_READ);
+  if (!file) {
+    Serial.printf("[NEURA9] Avaliação: não abriu %s\n", path);
+    return false;
+  }
+
+  Neura9Scratch scratch;
+  if (!scratch.begin(model, error_reporter, _plan.arenaSize, NEURA9_MEM_PSRAM,
+                     false)) {
+    Serial.println("[NEURA9] Avaliação: falha ao montar interpretador");
+    return false;
+  }
+
+  TfLiteTensor *in = scratch.interpreter->input(0);
+  TfLiteTensor *res = scratch.interpreter->output(0);
+  size_t count = modelInputCount(in);
+  float mul[NEURA9_FEATURE_COUNT];
+  float add[NEURA9_FEATURE_COUNT];
+  computeQuantParams(in, mul, add);
+
+  int classes = res->dims->data[res->dims->size - 1];
+  out->classes = classes > NEURA9_MAX_CLASSES ? NEURA9_MAX_CLASSES : classes;
+
+  // ~56 floats com 6 dígitos + rótulo
+  static const size_t EVAL_LINE_MAX = 1024;
+  char *line = (char *)heap_caps_malloc(EVAL_LINE_MAX, MALLOC_CAP_SPIRAM);
+  if (!line)
+    return false;
+
+  Neura9Features features;
+  float *f = reinterpret_cast<float *>(&features);
+  uint32_t rows = 0;
+
+  while (file.available() && rows < NEURA9_EVAL_MAX_ROWS) {
+    size_t n = file.readBytesUntil('\n', line, EVAL_LINE_MAX - 1);
+    line[n] = '\0';
+    // Cabeçalho (nomes das features) ou linha vazia
+    if (n == 0 || !(isdigit((unsigned char)line[0]) || line[0] == '-' ||
+                    line[0] == '.')) {
+      continue;
+    }
+    rows++;
+
+    char *p = line;
+    char *end = nullptr;
+    size_t k = 0;
+    for (; k < NEURA9_FEATURE_COUNT; k++) {
+      f[k] = strtof(p, &end);
+      if (end == p || *end != ',')
+        break;
+      p = end + 1;
+    }
+    long label = strtol(p, &end, 10);
+    if (k != NEURA9_FEATURE_COUNT || end == p || label < 0 ||
+        label >= out->classes) {
+      out->skipped++;
+      continue;
+    }
+
+    packInput(in, features, mul, add, count);
+    if (scratch.interpreter->Invoke() != kTfLiteOk) {
+      out->skipped++;
+      continue;
+    }
+    float score;
+    int predicted = argmaxOutput(res, &score);
+    if (predicted < 0 || predicted >= out->classes) {
+      out->skipped++;
+      continue;
+    }
+
+    out->confusion[label][predicted]++;
+    out->samples++;
+    if (predicted == label)
+      out->correct++;
+  }
+  heap_caps_free(line);
+  file.close();
+
+  Serial.printf("[NEURA9] Avaliação %s: %u/%u corretas (%.1f%%), %u ignoradas\n",
+                path, out->correct, out->samples,
+                out->samples ? 100.0f * out->correct / out->samples : 0.0f,
+                out->skipped);
+  for (uint8_t r = 0; r < out->classes; r++) {
+    Serial.printf("[NEURA9]   %2u:", r);
+    for (uint8_t c = 0; c < out->classes; c++) {
+      Serial.printf(" %4u", out->confusion[r][c]);
+    }
+    Serial.println();
+  }
+  return true;
+}
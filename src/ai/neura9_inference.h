@@ -7,7 +7,9 @@
  */
 
 #include "feature_extractor.h"
+#include "feature_sequence.h"
 #include <Arduino.h>
+#include <FS.h>
 
 // TFLite Micro includes
 namespace tflite {
@@ -18,10 +20,18 @@ class MicroInterpreter;
 } // namespace tflite
 
 // Configurações (Tip 10: Arena Fixa)
-// Modelo 7KB + Tensores Intermediários. 160KB é super seguro.
-#define NEURA9_ARENA_SIZE                                                      \
-  (16 * 1024) // Reduzido para testar, tip diz 160KB mas 16KB deve dar para
-              // modelo pequeno
+// Teto da arena: só a sondagem do planner usa este tamanho (em PSRAM). A arena
+// de verdade tem o tamanho medido no primeiro boot (ver Neura9MemoryPlan).
+#define NEURA9_ARENA_SIZE (64 * 1024)
+// DRAM interna que precisa sobrar depois de arena/pesos (WiFi, LVGL, tasks)
+#define NEURA9_DRAM_RESERVE (48 * 1024)
+#define NEURA9_PLAN_ITERATIONS 32
+
+// Folga aceita entre a arena do plano e o uso real medido no benchmark
+#define NEURA9_ARENA_MARGIN_PCT 25
+#define NEURA9_MAX_PROFILED_OPS 8
+#define NEURA9_MAX_CLASSES 16
+#define NEURA9_EVAL_MAX_ROWS 2000
 
 // Categorias (Tip 13: 15 classes para v2)
 enum Neura9Result {
@@ -46,6 +56,65 @@ struct InferenceResult {
   uint32_t inferenceTimeMs;
 };
 
+/**
+ * @brief Onde ficam arena e pesos do modelo
+ */
+enum Neura9Placement : uint8_t {
+  NEURA9_MEM_FLASH = 0, // Pesos direto da flash (XIP, cache)
+  NEURA9_MEM_DRAM,      // SRAM interna
+  NEURA9_MEM_PSRAM,
+  NEURA9_MEM_COUNT
+};
+
+/**
+ * @brief Layout de memória medido no primeiro boot e salvo na NVS
+ *
+ * Refeito quando o modelo muda (tamanho/hash) ou a versão do plano muda.
+ */
+struct Neura9MemoryPlan {
+  uint16_t version;
+  uint32_t modelLen;
+  uint32_t modelHash;
+  uint32_t arenaSize;     // Uso medido pelo interpretador + alinhamento
+  uint8_t weights;        // Neura9Placement mais rápido medido
+  uint32_t invokeUs[NEURA9_MEM_COUNT]; // Mediana por local dos pesos (0 = n/d)
+};
+
+struct Neura9OpTiming {
+  const char *tag; // Nome do op (FULLY_CONNECTED, SOFTMAX...)
+  uint32_t totalUs;
+  uint32_t calls;
+};
+
+/**
+ * @brief Resultado do benchmark (latência, arena e tempo por op)
+ */
+struct Neura9BenchResult {
+  uint16_t iterations;
+  uint32_t p50Us;
+  uint32_t p90Us;
+  uint32_t p99Us;
+  uint32_t maxUs;
+  size_t arenaSize;
+  size_t arenaUsed;        // arena_used_bytes()
+  size_t arenaNeeded;      // Uso + temporários do Prepare (mínimo que aloca)
+  size_t arenaRecommended; // Necessário + margem, alinhado a 1 KB
+  bool arenaOk; // false: arena do plano fora de necessário..recomendado
+  uint8_t opCount;
+  Neura9OpTiming ops[NEURA9_MAX_PROFILED_OPS];
+};
+
+/**
+ * @brief Resultado da avaliação com dataset rotulado (matriz de confusão)
+ */
+struct Neura9EvalResult {
+  uint16_t samples;
+  uint16_t correct;
+  uint16_t skipped; // Linhas malformadas ou rótulo fora da faixa
+  uint8_t classes;
+  uint16_t confusion[NEURA9_MAX_CLASSES][NEURA9_MAX_CLASSES]; // [real][previsto]
+};
+
 class NEURA9Inference {
 public:
   NEURA9Inference();
@@ -54,9 +123,28 @@ public:
   // Inicializa TFLite Micro na PSRAM (Tip 6)
   bool begin();
 
-  // Executa inferência
+  // Executa inferência (ou devolve o cache, ver shouldRunInference)
   InferenceResult predict(const Neura9Features &features);
 
+  // Executa inferência sempre (quem chama já decidiu a cadência).
+  // Modelo de sequência: roda sobre o anel; a janela já deve ter entrado
+  // com pushWindow().
+  InferenceResult run(const Neura9Features &features);
+
+  /**
+   * @brief Acrescenta uma janela selada ao anel do modelo de sequência
+   *
+   * Deve ser chamada para toda janela consumida, rode o modelo ou não.
+   * Sem efeito se o modelo não tem dimensão de tempo.
+   */
+  void pushWindow(const Neura9Features &features);
+  bool isSequenceModel() const { return _sequence.isReady(); }
+  const FeatureSequence &getSequence() const { return _sequence; }
+
+  // Tip 12: features-chave mudaram desde a última inferência?
+  bool featuresChanged(const Neura9Features &features) const;
+  const InferenceResult &getLastResult() const { return _lastResult; }
+
   // Tip 5: Lógica de quando rodar (Adaptive Scheduling)
   // Tip 12: Caching de Predição
   bool shouldRunInference(const Neura9Features &currentFeatures);
@@ -64,19 +152,85 @@ public:
   // Tip 8: Switch Lite/Full mode
   void setLiteMode(bool enabled);
 
+  /**
+   * @brief Troca o flatbuffer do modelo (só antes de begin)
+   *
+   * Padrão: g_neura9_model_data. O plano salvo é refeito se tamanho/hash
+   * mudarem; os dados precisam viver enquanto o modelo estiver em uso.
+   */
+  void setModelData(const uint8_t *data, size_t len);
+
+  /**
+   * @brief Mede latência, arena e tempo por op com o modelo embarcado
+   *
+   * Usa um interpretador próprio (arena e profiler temporários em PSRAM),
+   * sem disputar os tensores de predict; a web pede pela task de IA
+   * (AiManager::requestBenchmark). Entradas aleatórias; registra no Serial e
+   * marca arenaOk = false se a arena do plano fica abaixo do necessário
+   * medido ou passa dele + NEURA9_ARENA_MARGIN_PCT.
+   */
+  bool benchmark(Neura9BenchResult *out, uint16_t iterations = 200);
+
+  /**
+   * @brief Roda um CSV rotulado (FEATURE_COUNT valores + rótulo por linha)
+   *
+   * Gerado por ai_training/tools/export_eval_csv.py. Mesmo empacotamento de
+   * predict, sem o cache/agendamento. Para em NEURA9_EVAL_MAX_ROWS linhas.
+   */
+  bool evaluate(fs::FS &fs, const char *path, Neura9EvalResult *out);
+
+  // Layout em uso (tamanhos, locais e tempos medidos pelo planner)
+  const Neura9MemoryPlan &getMemoryPlan() const { return _plan; }
+  Neura9Placement getArenaPlacement() const { return _arenaPlace; }
+  Neura9Placement getWeightsPlacement() const { return _weightsPlace; }
+  static const char *placementName(Neura9Placement place);
+
+  // Apaga o plano salvo; a medição é refeita no próximo begin()
+  void resetMemoryPlan();
+
+  /**
+   * @brief Empacota a struct inteira no tensor INT8 em uma passada
+   *
+   * q[i] = round(f[i] * mul[i] + add[i]), com mul/add pré-calculados a partir
+   * do ganho/offset do esquema e da escala/zero-point do tensor.
+   */
+  static void quantizeFeatures(const Neura9Features &features,
+                               const float *mul, const float *add,
+                               int8_t *out, size_t count);
+
+  // Entrada float: f[i] * gain[i] + bias[i]
+  static void normalizeFeatures(const Neura9Features &features, float *out,
+                                size_t count);
+
 private:
   // TFLite pointers
   tflite::ErrorReporter *error_reporter = nullptr;
   const tflite::Model *model = nullptr;
   tflite::MicroInterpreter *interpreter = nullptr;
 
-  // Arena de memória (PSRAM)
+  // Flatbuffer de origem (flash) e, se o plano mandar, cópia dos pesos
+  const uint8_t *_modelData;
+  size_t _modelLen;
+
+  // Arena de memória (DRAM se couber, senão PSRAM) e cópia dos pesos
   uint8_t *tensor_arena = nullptr;
+  uint8_t *_modelCopy = nullptr;
+  Neura9MemoryPlan _plan;
+  Neura9Placement _arenaPlace = NEURA9_MEM_PSRAM;
+  Neura9Placement _weightsPlace = NEURA9_MEM_FLASH;
 
   // Input/Output tensors
   struct TfLiteTensor *input = nullptr;
   struct TfLiteTensor *output = nullptr;
 
+  // Quantização por feature (esquema + params do tensor de entrada)
+  size_t _inputCount = 0;
+  float _qMul[NEURA9_FEATURE_COUNT];
+  float _qAdd[NEURA9_FEATURE_COUNT];
+
+  // Entrada (1, timesteps, features): últimas janelas já quantizadas
+  FeatureSequence _sequence;
+
   bool _initialized = false;
   uint32_t _lastInferenceTime = 0;
 
@@ -87,6 +241,11 @@ private:
 
   // Tip 5: Scheduling vars
   uint32_t _adaptiveInterval = 800;
+
+  bool loadPlan();
+  void savePlan();
+  bool planMemory();
+  const uint8_t *placeWeights(Neura9Placement place, uint8_t **copy);
 };
 
 extern NEURA9Inference neura9;
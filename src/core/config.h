@@ -18,6 +18,9 @@
 // === LVGL CONFIGURATION ===
 #define LVGL_BUFFER_SIZE (LCD_WIDTH * LCD_HEIGHT / 10)
 #define LVGL_TICK_PERIOD_MS 2
+// Cópia do frame em PSRAM (~320 KB): o shift de burn-in só reenvia a imagem.
+// 0 economiza a PSRAM, mas cada shift redesenha a tela inteira
+#define BURNIN_SHIFT_MIRROR 1
 
 // === WIFI CONFIGURATION ===
 #define WIFI_AP_SSID "WavePwn"
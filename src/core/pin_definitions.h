@@ -13,6 +13,12 @@
 #define LCD_WIDTH 368
 #define LCD_HEIGHT 448
 
+// Área do LVGL: painel menos a margem de burn-in. A imagem se desloca
+// dentro da margem, então nenhum conteúdo é cortado.
+#define DISPLAY_BURNIN_MARGIN 3
+#define UI_WIDTH (LCD_WIDTH - 2 * DISPLAY_BURNIN_MARGIN)
+#define UI_HEIGHT (LCD_HEIGHT - 2 * DISPLAY_BURNIN_MARGIN)
+
 // === TOUCH I2C (FT3168 controller) ===
 #define IIC_SDA 15
 #define IIC_SCL 14
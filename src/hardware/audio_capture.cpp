@@ -0,0 +1,325 @@
+#include "audio_capture.h"
+#include <driver/i2s.h>
+#include <esp_heap_caps.h>
+#include <math.h>
+
+#define CAPTURE_SAMPLES (AUDIO_CAPTURE_FRAME * AUDIO_CAPTURE_FRAMES)
+// O bloco que o escritor está preenchendo fica fora do alcance dos leitores
+#define CAPTURE_SAFE (CAPTURE_SAMPLES - AUDIO_CAPTURE_FRAME)
+#define CAPTURE_FRAME_US (AUDIO_CAPTURE_FRAME * 1000000UL / AUDIO_CAPTURE_RATE)
+#define CAPTURE_GAIN_ONE 4096 // Q12
+#define CAPTURE_DC_SHIFT 12   // Média do DC: constante de ~256 ms
+
+AudioCapture audioCapture;
+
+// Quadro L/R do DMA (só a task usa)
+static int16_t s_raw[AUDIO_CAPTURE_FRAME * 2];
+
+AudioCapture::AudioCapture()
+    : _task(NULL), _i2sPort(0), _frames(nullptr), _written(0), _lock(NULL),
+      _gainQ12(CAPTURE_GAIN_ONE), _dcRemoval(true), _dcQ12(0),
+      _frameCount(0), _errors(0), _lastUs(0), _peak(0) {
+  for (uint8_t i = 0; i < AUDIO_CAPTURE_READERS; i++) {
+    Reader &r = _readers[i];
+    r.open.store(false);
+    r.name = nullptr;
+    r.pos = 0;
+    r.overruns = 0;
+    r.dropped = 0;
+    r.ready = NULL;
+  }
+}
+
+bool AudioCapture::begin(int i2sPort) {
+  if (_task)
+    return true;
+  _i2sPort = i2sPort;
+
+  // ~33 KB: PSRAM basta para a taxa de áudio
+  size_t size = AUDIO_CAPTURE_FRAMES * sizeof(Frame);
+  _frames = (Frame *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+  if (!_frames) {
+    _frames = (Frame *)heap_caps_malloc(size, MALLOC_CAP_INTERNAL |
+                                                  MALLOC_CAP_8BIT);
+  }
+  _lock = xSemaphoreCreateMutex();
+  bool ok = _frames != nullptr && _lock != NULL;
+  for (uint8_t i = 0; ok && i < AUDIO_CAPTURE_READERS; i++) {
+    _readers[i].ready = xSemaphoreCreateBinary();
+    ok = _readers[i].ready != NULL;
+  }
+  if (!ok) {
+    Serial.println("[MIC] Falha ao alocar anel de captura");
+    return false;
+  }
+  memset(_frames, 0, size);
+
+  if (xTaskCreatePinnedToCore(taskEntry, "Mic_Capture", 3072, this, 4, &_task,
+                              1) != pdPASS) {
+    Serial.println("[MIC] Falha ao criar task de captura");
+    _task = NULL;
+    return false;
+  }
+  Serial.printf("[MIC] Captura ativa (%u Hz, bloco %u, anel %u ms, %u "
+                "leitores)\n",
+                AUDIO_CAPTURE_RATE, AUDIO_CAPTURE_FRAME,
+                (unsigned)(CAPTURE_SAMPLES * 1000UL / AUDIO_CAPTURE_RATE),
+                AUDIO_CAPTURE_READERS);
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// LEITORES
+// ═══════════════════════════════════════════════════════════════════════════
+
+int AudioCapture::openReader(const char *name) {
+  if (!_task)
+    return -1;
+
+  int id = -1;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < AUDIO_CAPTURE_READERS; i++) {
+    Reader &r = _readers[i];
+    if (r.open.load(std::memory_order_acquire))
+      continue;
+    r.name = name;
+    r.pos = _written.load(std::memory_order_acquire);
+    r.overruns = 0;
+    r.dropped = 0;
+    xSemaphoreTake(r.ready, 0);
+    r.open.store(true, std::memory_order_release);
+    id = i;
+    break;
+  }
+  xSemaphoreGive(_lock);
+
+  if (id < 0) {
+    Serial.printf("[MIC] Sem cursor livre para '%s'\n", name);
+    return -1;
+  }
+  xTaskNotifyGive(_task); // Acorda a captura se estava parada
+  Serial.printf("[MIC] Leitor '%s' aberto (#%d)\n", name, id);
+  return id;
+}
+
+void AudioCapture::closeReader(int id) {
+  if (id < 0 || id >= AUDIO_CAPTURE_READERS)
+    return;
+  Reader &r = _readers[id];
+  if (!r.open.load(std::memory_order_acquire))
+    return;
+  if (r.overruns) {
+    Serial.printf("[MIC] Leitor '%s' fechado (%u overruns, %u amostras "
+                  "perdidas)\n",
+                  r.name, r.overruns, r.dropped);
+  }
+  r.open.store(false, std::memory_order_release);
+}
+
+uint8_t AudioCapture::openCount() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < AUDIO_CAPTURE_READERS; i++) {
+    if (_readers[i].open.load(std::memory_order_acquire))
+      n++;
+  }
+  return n;
+}
+
+size_t AudioCapture::available(int id) const {
+  if (id < 0 || id >= AUDIO_CAPTURE_READERS ||
+      !_readers[id].open.load(std::memory_order_acquire))
+    return 0;
+  uint32_t avail = _written.load(std::memory_order_acquire) - _readers[id].pos;
+  return avail < CAPTURE_SAFE ? avail : CAPTURE_SAFE;
+}
+
+void AudioCapture::flush(int id) {
+  if (id < 0 || id >= AUDIO_CAPTURE_READERS)
+    return;
+  _readers[id].pos = _written.load(std::memory_order_acquire);
+}
+
+size_t AudioCapture::read(int id, int16_t *out, size_t maxSamples,
+                          uint32_t waitMs, uint32_t *timestampUs) {
+  if (id < 0 || id >= AUDIO_CAPTURE_READERS || !out || maxSamples == 0)
+    return 0;
+  Reader &r = _readers[id];
+  if (!r.open.load(std::memory_order_acquire))
+    return 0;
+
+  uint32_t written = _written.load(std::memory_order_acquire);
+  if (written == r.pos && waitMs > 0) {
+    // O semáforo pode estar dado de um bloco já lido: confere e espera de novo
+    const TickType_t start = xTaskGetTickCount();
+    const TickType_t limit = pdMS_TO_TICKS(waitMs);
+    TickType_t elapsed;
+    while (written == r.pos &&
+           (elapsed = xTaskGetTickCount() - start) < limit) {
+      xSemaphoreTake(r.ready, limit - elapsed);
+      written = _written.load(std::memory_order_acquire);
+    }
+  }
+
+  for (;;) {
+    uint32_t avail = written - r.pos;
+    if (avail > CAPTURE_SAFE) {
+      // Leitor lento: pula para o trecho mais antigo ainda válido
+      r.dropped += avail - CAPTURE_SAFE;
+      r.overruns++;
+      r.pos = written - CAPTURE_SAFE;
+      avail = CAPTURE_SAFE;
+    }
+    size_t n = avail < maxSamples ? avail : maxSamples;
+    if (n == 0)
+      return 0;
+
+    // 2^32 é múltiplo do anel: o índice continua certo quando pos dá a volta
+    const uint32_t pos = r.pos;
+    if (timestampUs) {
+      const Frame &f = _frames[(pos / AUDIO_CAPTURE_FRAME) %
+                               AUDIO_CAPTURE_FRAMES];
+      *timestampUs = f.timestampUs + (pos % AUDIO_CAPTURE_FRAME) * 1000000UL /
+                                         AUDIO_CAPTURE_RATE;
+    }
+    size_t done = 0;
+    while (done < n) {
+      uint32_t p = pos + done;
+      const Frame &f = _frames[(p / AUDIO_CAPTURE_FRAME) %
+                               AUDIO_CAPTURE_FRAMES];
+      size_t off = p % AUDIO_CAPTURE_FRAME;
+      size_t chunk = AUDIO_CAPTURE_FRAME - off;
+      if (chunk > n - done)
+        chunk = n - done;
+      memcpy(out + done, f.samples + off, chunk * sizeof(int16_t));
+      done += chunk;
+    }
+
+    // O escritor pode ter dado a volta durante a cópia: confere de novo
+    std::atomic_thread_fence(std::memory_order_acquire);
+    written = _written.load(std::memory_order_acquire);
+    if (written - pos <= CAPTURE_SAFE) {
+      r.pos = pos + n;
+      return n;
+    }
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CAPTURA
+// ═══════════════════════════════════════════════════════════════════════════
+
+void AudioCapture::setGainDb(float db) {
+  // Teto de +24 dB: amostra (Q15) x ganho (Q12) cabe em int32
+  if (db > 24.0f)
+    db = 24.0f;
+  if (db < -24.0f)
+    db = -24.0f;
+  _gainQ12 = (int32_t)lrintf(CAPTURE_GAIN_ONE * powf(10.0f, db / 20.0f));
+}
+
+void AudioCapture::processFrame(const int16_t *raw, Frame &f) {
+  uint32_t t0 = micros();
+  const int32_t gain = _gainQ12;
+  const bool dc = _dcRemoval;
+  int32_t dcQ12 = _dcQ12;
+  int32_t peak = 0;
+
+  for (size_t i = 0; i < AUDIO_CAPTURE_FRAME; i++) {
+    int32_t x = raw[i * 2 + AUDIO_CAPTURE_SLOT];
+    if (dc) {
+      dcQ12 += (x * CAPTURE_GAIN_ONE - dcQ12) >> CAPTURE_DC_SHIFT;
+      x -= dcQ12 / CAPTURE_GAIN_ONE;
+      if (x > 32767)
+        x = 32767;
+      else if (x < -32767)
+        x = -32767;
+    }
+    if (gain != CAPTURE_GAIN_ONE) {
+      x = (x * gain) >> 12;
+      if (x > 32767)
+        x = 32767;
+      else if (x < -32767)
+        x = -32767;
+    }
+    f.samples[i] = (int16_t)x;
+    int32_t a = x < 0 ? -x : x;
+    if (a > peak)
+      peak = a;
+  }
+
+  _dcQ12 = dcQ12;
+  _peak = (uint16_t)peak;
+  _lastUs = micros() - t0;
+}
+
+void AudioCapture::taskEntry(void *param) {
+  AudioCapture *self = (AudioCapture *)param;
+  const i2s_port_t port = (i2s_port_t)self->_i2sPort;
+  size_t got = 0;
+
+  for (;;) {
+    if (self->openCount() == 0) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      // O DMA encheu de áudio velho enquanto ninguém ouvia: descarta
+      size_t bytes;
+      do {
+        bytes = 0;
+        i2s_read(port, s_raw, sizeof(s_raw), &bytes, 0);
+      } while (bytes == sizeof(s_raw));
+      got = 0;
+      continue;
+    }
+
+    size_t bytes = 0;
+    esp_err_t err = i2s_read(port, (uint8_t *)s_raw + got, sizeof(s_raw) - got,
+                             &bytes, pdMS_TO_TICKS(100));
+    if (err != ESP_OK) {
+      self->_errors++;
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+    got += bytes;
+    if (got < sizeof(s_raw))
+      continue;
+    got = 0;
+
+    uint32_t w = self->_written.load(std::memory_order_relaxed);
+    Frame &f = self->_frames[(w / AUDIO_CAPTURE_FRAME) % AUDIO_CAPTURE_FRAMES];
+    f.timestampUs = micros() - CAPTURE_FRAME_US;
+    self->processFrame(s_raw, f);
+    self->_written.store(w + AUDIO_CAPTURE_FRAME, std::memory_order_release);
+    self->_frameCount++;
+
+    for (uint8_t i = 0; i < AUDIO_CAPTURE_READERS; i++) {
+      if (self->_readers[i].open.load(std::memory_order_acquire))
+        xSemaphoreGive(self->_readers[i].ready);
+    }
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ESTATÍSTICAS
+// ═══════════════════════════════════════════════════════════════════════════
+
+AudioCaptureStats AudioCapture::getStats() const {
+  AudioCaptureStats st;
+  st.frames = _frameCount;
+  st.errors = _errors;
+  st.lastUs = _lastUs;
+  st.peak = _peak;
+  st.readers = openCount();
+  st.dcOffset = (int16_t)(_dcQ12 / CAPTURE_GAIN_ONE);
+  return st;
+}
+
+bool AudioCapture::getReaderStats(int id, AudioCaptureReaderStats *out) const {
+  if (!out || id < 0 || id >= AUDIO_CAPTURE_READERS ||
+      !_readers[id].open.load(std::memory_order_acquire))
+    return false;
+  const Reader &r = _readers[id];
+  out->name = r.name;
+  out->overruns = r.overruns;
+  out->dropped = r.dropped;
+  out->pending = available(id);
+  return true;
+}
@@ -0,0 +1,124 @@
+#pragma once
+/**
+ * @file audio_capture.h
+ * @brief Captura do microfone: task dona do I2S RX e anel com vários leitores
+ *
+ * Ninguém mais chama i2s_read. A task lê blocos de AUDIO_CAPTURE_FRAME
+ * amostras do DMA, pega o slot do microfone, tira o DC e aplica o ganho uma
+ * única vez, e grava no anel com o instante da captura. Cada consumidor
+ * (assistente de voz, gravador, walkie-talkie...) abre um cursor próprio e
+ * lê no seu ritmo: todos veem as mesmas amostras, nenhum rouba do outro.
+ *
+ * Leitor lento: quando o escritor dá a volta sobre o cursor, o cursor pula
+ * para o trecho mais antigo ainda válido e o salto é contado (overruns e
+ * amostras perdidas por leitor). O escritor nunca espera ninguém.
+ *
+ * Sem leitor aberto, a task dorme; ao acordar descarta o que ficou velho
+ * no DMA.
+ *
+ * Formato: mono, 16-bit, AUDIO_CAPTURE_RATE.
+ */
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#define AUDIO_CAPTURE_RATE 16000
+#define AUDIO_CAPTURE_FRAME 256   // Amostras por bloco (16 ms)
+#define AUDIO_CAPTURE_FRAMES 64   // Blocos no anel (~1 s, potência de 2)
+#define AUDIO_CAPTURE_READERS 6
+#define AUDIO_CAPTURE_SLOT 0      // Slot do ES8311 no quadro L/R do I2S
+
+struct AudioCaptureReaderStats {
+  const char *name;
+  uint32_t overruns; // Vezes que o escritor passou o cursor
+  uint32_t dropped;  // Amostras perdidas nesses saltos
+  uint32_t pending;  // Amostras esperando leitura agora
+};
+
+struct AudioCaptureStats {
+  uint32_t frames;     // Blocos capturados
+  uint32_t errors;     // Falhas de i2s_read
+  uint32_t lastUs;     // Processamento do último bloco (DC + ganho)
+  uint16_t peak;       // Pico do último bloco (após ganho)
+  uint8_t readers;     // Cursores abertos
+  int16_t dcOffset;    // Estimativa atual do DC removido
+};
+
+class AudioCapture {
+public:
+  AudioCapture();
+
+  // Cria a task (I2S já instalado pelo AudioDriver)
+  bool begin(int i2sPort);
+  bool isRunning() const { return _task != NULL; }
+
+  /**
+   * @brief Abre um cursor a partir das próximas amostras
+   * @param name Nome para as estatísticas (string estática)
+   * @return Id do leitor, ou -1 sem slot livre
+   */
+  int openReader(const char *name);
+  void closeReader(int id);
+
+  // Amostras prontas para o leitor (0 se id inválido)
+  size_t available(int id) const;
+
+  /**
+   * @brief Copia até maxSamples amostras do cursor
+   * @param waitMs Espera por dados se não houver nenhum (0 = não bloqueia)
+   * @param timestampUs micros() da captura da primeira amostra copiada
+   * @return Amostras copiadas
+   */
+  size_t read(int id, int16_t *out, size_t maxSamples, uint32_t waitMs = 0,
+              uint32_t *timestampUs = nullptr);
+
+  // Descarta o atrasado: o cursor vai para as amostras mais novas
+  void flush(int id);
+
+  // Ganho digital aplicado na captura (0..+24 dB típico)
+  void setGainDb(float db);
+  void setDcRemoval(bool enable) { _dcRemoval = enable; }
+
+  AudioCaptureStats getStats() const;
+  bool getReaderStats(int id, AudioCaptureReaderStats *out) const;
+
+private:
+  struct Frame {
+    uint32_t timestampUs; // micros() da primeira amostra
+    int16_t samples[AUDIO_CAPTURE_FRAME];
+  };
+
+  struct Reader {
+    std::atomic<bool> open;
+    const char *name;
+    uint32_t pos; // Total de amostras já lidas (só o dono mexe)
+    volatile uint32_t overruns;
+    volatile uint32_t dropped;
+    SemaphoreHandle_t ready; // Dado pelo escritor a cada bloco
+  };
+
+  TaskHandle_t _task;
+  int _i2sPort;
+  Frame *_frames;
+  std::atomic<uint32_t> _written; // Total de amostras escritas
+  Reader _readers[AUDIO_CAPTURE_READERS];
+  SemaphoreHandle_t _lock; // Abrir/fechar leitores
+
+  volatile int32_t _gainQ12;
+  volatile bool _dcRemoval;
+  int32_t _dcQ12; // Média lenta do sinal = DC (só a task)
+
+  volatile uint32_t _frameCount;
+  volatile uint32_t _errors;
+  volatile uint32_t _lastUs;
+  volatile uint16_t _peak;
+
+  uint8_t openCount() const;
+  void processFrame(const int16_t *raw, Frame &f);
+  static void taskEntry(void *param);
+};
+
+extern AudioCapture audioCapture;
@@ -4,13 +4,16 @@
  *
  * Usa o codec ES8311 do Waveshare ESP32-S3-Touch-AMOLED-1.8
  * para reprodução de áudio via speaker interno e captura via microfone.
+ * A reprodução roda no AudioEngine (task própria); aqui só se configura o
+ * hardware e se traduz a API antiga em comandos.
  */
 
 #include "audio_driver.h"
+#include "audio_capture.h"
+#include "audio_engine.h"
 #include "es8311.h"
 #include <Wire.h>
 #include <driver/i2s.h>
-#include <math.h>
 
 // Instância global
 AudioDriver audioDriver;
@@ -20,6 +23,9 @@ AudioDriver audioDriver;
 #define AUDIO_BIT_DEPTH 16
 #define I2S_PORT I2S_NUM_0
 
+static_assert(AUDIO_CAPTURE_RATE == AUDIO_SAMPLE_RATE,
+              "captura e I2S precisam da mesma taxa");
+
 // === Melodias predefinidas ===
 static const MelodyNote melody_boot[] = {{NOTE_C4, 100},  {NOTE_E4, 100},
                                          {NOTE_G4, 100},  {NOTE_C5, 200},
@@ -49,17 +55,41 @@ static const MelodyNote melody_handshake[] = {{NOTE_C5, 100}, {NOTE_E5, 100},
 static const MelodyNote melody_click[] = {{NOTE_C5, 20}};
 static const MelodyNote melody_beep[] = {{NOTE_A4, 100}};
 
-// Buffer de áudio
-#define TONE_BUFFER_SIZE 1024
-static int16_t toneBuffer[TONE_BUFFER_SIZE];
+// === Presets por SoundType: sequência + timbre + prioridade ===
+struct SoundPreset {
+  const MelodyNote *notes;
+  uint8_t count;
+  const AudioTimbre *timbre;
+  uint8_t priority;
+};
+
+#define SOUND_PRESET(m, t, p) {m, sizeof(m) / sizeof(MelodyNote), &t, p}
+
+// Mesma ordem do enum SoundType
+static const SoundPreset sound_presets[] = {
+    SOUND_PRESET(melody_boot, AUDIO_TIMBRE_CHIME, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_success, AUDIO_TIMBRE_CHIME, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_error, AUDIO_TIMBRE_ALERT, AUDIO_PRIO_ALERT),
+    SOUND_PRESET(melody_alert, AUDIO_TIMBRE_ALERT, AUDIO_PRIO_ALERT),
+    SOUND_PRESET(melody_scan_start, AUDIO_TIMBRE_SOFT, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_scan_found, AUDIO_TIMBRE_SOFT, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_attack_start, AUDIO_TIMBRE_ALERT, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_attack_complete, AUDIO_TIMBRE_CHIME, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_handshake, AUDIO_TIMBRE_CHIME, AUDIO_PRIO_ALERT),
+    SOUND_PRESET(melody_click, AUDIO_TIMBRE_CLICK, AUDIO_PRIO_UI),
+    SOUND_PRESET(melody_beep, AUDIO_TIMBRE_SOFT, AUDIO_PRIO_UI),
+};
+static_assert(sizeof(sound_presets) / sizeof(sound_presets[0]) ==
+                  SOUND_BEEP + 1,
+              "sound_presets fora de sincronia com SoundType");
+
 static bool i2s_installed = false;
 
 // === Implementação ===
 
 AudioDriver::AudioDriver()
-    : _initialized(false), _muted(false), _playing(false), _recording(false),
-      _volume(80), _currentMelody(nullptr), _melodyLength(0), _melodyIndex(0),
-      _noteStartTime(0), _currentNoteDuration(0), _es8311Handle(nullptr) {}
+    : _initialized(false), _muted(false), _volume(80),
+      _es8311Handle(nullptr) {}
 
 bool AudioDriver::begin() {
   Serial.println("[AUDIO] Inicializando ES8311 + I2S...");
@@ -127,6 +157,18 @@ bool AudioDriver::begin() {
 
   es8311_voice_volume_set((es8311_handle_t)_es8311Handle, _volume, NULL);
 
+  // 4. Motor de reprodução (dono do I2S TX daqui em diante)
+  audioEngine.setVolume(_volume);
+  if (!audioEngine.begin(I2S_PORT)) {
+    Serial.println("[AUDIO] ERRO: Falha ao iniciar motor de áudio!");
+    return false;
+  }
+
+  // 5. Captura do microfone (dona do I2S RX)
+  if (!audioCapture.begin(I2S_PORT)) {
+    Serial.println("[AUDIO] AVISO: Captura do microfone indisponível");
+  }
+
   _initialized = true;
   Serial.printf("[AUDIO] ES8311 inicializado! Volume: %d%%\n", _volume);
 
@@ -159,144 +201,58 @@ void AudioDriver::enablePA(bool enable) {
 }
 
 void AudioDriver::playSound(SoundType type) {
-  if (!_initialized || _muted)
+  if (!_initialized || _muted || (unsigned)type > SOUND_BEEP)
     return;
 
-  switch (type) {
-  case SOUND_BOOT:
-    playMelody(melody_boot, sizeof(melody_boot) / sizeof(MelodyNote));
-    break;
-  case SOUND_SUCCESS:
-    playMelody(melody_success, sizeof(melody_success) / sizeof(MelodyNote));
-    break;
-  case SOUND_ERROR:
-    playMelody(melody_error, sizeof(melody_error) / sizeof(MelodyNote));
-    break;
-  case SOUND_ALERT:
-    playMelody(melody_alert, sizeof(melody_alert) / sizeof(MelodyNote));
-    break;
-  case SOUND_SCAN_START:
-    playMelody(melody_scan_start,
-               sizeof(melody_scan_start) / sizeof(MelodyNote));
-    break;
-  case SOUND_SCAN_FOUND:
-    playMelody(melody_scan_found,
-               sizeof(melody_scan_found) / sizeof(MelodyNote));
-    break;
-  case SOUND_ATTACK_START:
-    playMelody(melody_attack_start,
-               sizeof(melody_attack_start) / sizeof(MelodyNote));
-    break;
-  case SOUND_ATTACK_COMPLETE:
-    playMelody(melody_attack_complete,
-               sizeof(melody_attack_complete) / sizeof(MelodyNote));
-    break;
-  case SOUND_HANDSHAKE:
-    playMelody(melody_handshake, sizeof(melody_handshake) / sizeof(MelodyNote));
-    break;
-  case SOUND_CLICK:
-    playMelody(melody_click, sizeof(melody_click) / sizeof(MelodyNote));
-    break;
-  case SOUND_BEEP:
-    playMelody(melody_beep, sizeof(melody_beep) / sizeof(MelodyNote));
-    break;
-  }
+  const SoundPreset &p = sound_presets[type];
+  playMelody(p.notes, p.count, p.priority, p.timbre);
 }
 
-void AudioDriver::generateToneBuffer(int frequency, int duration) {
-  if (frequency == 0) {
-    memset(toneBuffer, 0, sizeof(toneBuffer));
+void AudioDriver::playTone(int frequency, int duration, uint8_t priority,
+                           const AudioTimbre *timbre) {
+  if (!_initialized || _muted)
     return;
-  }
-
-  float samplesPerCycle = (float)AUDIO_SAMPLE_RATE / frequency;
-  int numSamples = min((int)(AUDIO_SAMPLE_RATE * duration / 1000),
-                       (int)(TONE_BUFFER_SIZE / 2));
-  int16_t amplitude = (int16_t)(32767 * _volume / 100);
-
-  for (int i = 0; i < numSamples; i++) {
-    float phase = (float)i / samplesPerCycle;
-    int16_t sample = (int16_t)(amplitude * sin(2.0 * PI * phase));
-    toneBuffer[i * 2] = sample;     // Left
-    toneBuffer[i * 2 + 1] = sample; // Right
-  }
+  audioEngine.playTone(frequency, duration, priority, timbre);
 }
 
-void AudioDriver::playTone(int frequency, int duration) {
-  if (!_initialized || _muted || !i2s_installed)
-    return;
-
-  generateToneBuffer(frequency, duration);
-
-  int numSamples = min((int)(AUDIO_SAMPLE_RATE * duration / 1000),
-                       (int)(TONE_BUFFER_SIZE / 2));
-  size_t bytesToWrite = numSamples * 2 * sizeof(int16_t);
-  size_t bytesWritten = 0;
-
-  i2s_write(I2S_PORT, toneBuffer, bytesToWrite, &bytesWritten, portMAX_DELAY);
+size_t AudioDriver::playRaw(const int16_t *samples, size_t count,
+                            uint32_t waitMs, AudioStreamId stream) {
+  if (!_initialized || _muted || !samples || count == 0)
+    return 0;
+  // Mono; a taxa do stream vem de setStreamRate (padrão 16 kHz)
+  return audioEngine.writePcm(stream, samples, count, waitMs);
 }
 
-void AudioDriver::playRaw(const int16_t *samples, size_t count) {
-  if (!_initialized || _muted || !i2s_installed || !samples || count == 0)
-    return;
-
-  size_t bytesToWrite = count * sizeof(int16_t);
-  size_t bytesWritten = 0;
-
-  // Em modo stereo (I2S_CHANNEL_FMT_RIGHT_LEFT), precisamos duplicar se o input
-  // for mono Mas aqui assumimos que playRaw já recebe o formato correto ou que
-  // o I2S lida com isso. Se o buffer for mono e I2S stereo, teríamos que
-  // expandir. O Talkie gera 8khz. Se I2S está em 16khz, precisamos de
-  // upsampling. Assumindo que quem chama playRaw já tratou isso
-  // (VoiceAssistant).
-
-  i2s_write(I2S_PORT, samples, bytesToWrite, &bytesWritten, portMAX_DELAY);
+bool AudioDriver::playSource(AudioSource *source, uint32_t rate,
+                             uint8_t priority) {
+  if (!source)
+    return false;
+  if (!_initialized || _muted) {
+    source->close();
+    return false;
+  }
+  return audioEngine.playSource(source, rate, priority);
 }
 
-void AudioDriver::playMelody(const MelodyNote *melody, int length) {
-  if (!_initialized || _muted)
-    return;
-
-  _currentMelody = melody;
-  _melodyLength = length;
-  _melodyIndex = 0;
-  _playing = true;
-
-  playNextNote();
+void AudioDriver::setStreamRate(AudioStreamId stream, uint32_t rate,
+                                uint8_t priority) {
+  audioEngine.configureStream(stream, rate, priority);
 }
 
-void AudioDriver::playNextNote() {
-  if (_melodyIndex >= _melodyLength) {
-    stop();
+void AudioDriver::playMelody(const MelodyNote *melody, int length,
+                             uint8_t priority, const AudioTimbre *timbre) {
+  if (!_initialized || _muted || !melody || length <= 0)
     return;
-  }
-
-  const MelodyNote &note = _currentMelody[_melodyIndex];
-  playTone(note.frequency, note.duration);
-
-  _noteStartTime = millis();
-  _currentNoteDuration = note.duration;
-  _melodyIndex++;
+  audioEngine.playMelody(melody, (uint16_t)length, priority, timbre);
 }
 
-void AudioDriver::update() {
-  if (!_playing || _currentMelody == nullptr)
-    return;
+void AudioDriver::stop() { audioEngine.stop(); }
 
-  unsigned long now = millis();
-  if (now - _noteStartTime >= (unsigned long)_currentNoteDuration) {
-    playNextNote();
-  }
-}
-
-void AudioDriver::stop() {
-  _playing = false;
-  _currentMelody = nullptr;
-  _melodyIndex = 0;
-}
+bool AudioDriver::isPlaying() const { return audioEngine.isPlaying(); }
 
 void AudioDriver::setVolume(int volume) {
   _volume = constrain(volume, 0, 100);
+  audioEngine.setVolume(_volume);
   if (_initialized && _es8311Handle) {
     es8311_voice_volume_set((es8311_handle_t)_es8311Handle, _volume, NULL);
   }
@@ -304,47 +260,14 @@ void AudioDriver::setVolume(int volume) {
 
 void AudioDriver::setMuted(bool muted) {
   _muted = muted;
+  if (muted)
+    audioEngine.stop();
   if (_initialized && _es8311Handle) {
     es8311_voice_mute((es8311_handle_t)_es8311Handle, muted);
   }
   enablePA(!muted);
 }
 
-bool AudioDriver::startRecording() {
-  if (!_initialized)
-    return false;
-  _recording = true;
-  Serial.println("[AUDIO] Gravação iniciada - Microfone ativo");
-  return true;
-}
-
-void AudioDriver::stopRecording() {
-  _recording = false;
-  Serial.println("[AUDIO] Gravação parada");
-}
-
-size_t AudioDriver::readAudioSamples(int16_t *buffer, size_t maxSamples) {
-  if (!_initialized || !_recording || !buffer || maxSamples == 0) {
-    return 0;
-  }
-
-  size_t bytesToRead = maxSamples * sizeof(int16_t);
-  size_t bytesRead = 0;
-
-  esp_err_t ret = i2s_read(I2S_PORT, buffer, bytesToRead, &bytesRead,
-                           10 / portTICK_PERIOD_MS);
-
-  if (ret != ESP_OK) {
-    return 0;
-  }
-
-  return bytesRead / sizeof(int16_t);
-}
-
-bool AudioDriver::isAudioAvailable() const {
-  return _initialized && _recording && i2s_installed;
-}
-
 void AudioDriver::setMicGain(int gain) {
   if (!_initialized || !_es8311Handle)
     return;
@@ -359,6 +282,8 @@ void AudioDriver::setMicGain(int gain) {
   Serial.printf("[AUDIO] Ganho do microfone: %d%% (%.1f dB)\n", micGain,
                 dbGain);
 
+  // Ganho digital na task de captura (vale para todos os leitores)
   // Nota: A API do ES8311 pode variar - ajustar conforme necessário
   // es8311_microphone_gain_set((es8311_handle_t)_es8311Handle, dbGain);
+  audioCapture.setGainDb(dbGain);
 }
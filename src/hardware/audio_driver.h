@@ -47,6 +47,23 @@ enum SoundType {
   SOUND_BEEP
 };
 
+// Prioridade no mixer: a maior ativa abafa as menores
+enum AudioPriority : uint8_t {
+  AUDIO_PRIO_AMBIENT = 0,
+  AUDIO_PRIO_UI,
+  AUDIO_PRIO_ALERT,
+  AUDIO_PRIO_VOICE
+};
+
+// Streams PCM contínuos (um anel e uma voz do mixer cada)
+enum AudioStreamId : uint8_t {
+  AUDIO_STREAM_SPEECH = 0, // TTS
+  AUDIO_STREAM_COUNT
+};
+
+struct AudioTimbre; // audio_synth.h
+class AudioSource;  // audio_engine.h
+
 // Estrutura de nota
 struct MelodyNote {
   int frequency;
@@ -67,13 +84,30 @@ public:
   void playSound(SoundType type);
 
   // Toca uma nota única (frequência em Hz, duração em ms)
-  void playTone(int frequency, int duration);
-
-  // Toca stream raw (mono 16-bit PCM)
-  void playRaw(const int16_t *samples, size_t count);
-
-  // Toca melodia customizada
-  void playMelody(const MelodyNote *melody, int length);
+  void playTone(int frequency, int duration,
+                uint8_t priority = AUDIO_PRIO_UI,
+                const AudioTimbre *timbre = nullptr);
+
+  /**
+   * @brief Enfileira stream raw (mono 16-bit PCM) no motor de áudio
+   * @param waitMs Espera por espaço no anel (0 = descarta o excesso)
+   * @return Amostras aceitas
+   */
+  size_t playRaw(const int16_t *samples, size_t count, uint32_t waitMs = 0,
+                 AudioStreamId stream = AUDIO_STREAM_SPEECH);
+
+  // Toca uma fonte puxada pelo motor (WAV do SD...); fecha se recusar
+  bool playSource(AudioSource *source, uint32_t rate,
+                  uint8_t priority = AUDIO_PRIO_UI);
+
+  // Taxa de amostragem de um stream (convertida para a do I2S no mixer)
+  void setStreamRate(AudioStreamId stream, uint32_t rate,
+                     uint8_t priority = AUDIO_PRIO_VOICE);
+
+  // Toca melodia customizada (melody/timbre precisam ser static/const)
+  void playMelody(const MelodyNote *melody, int length,
+                  uint8_t priority = AUDIO_PRIO_UI,
+                  const AudioTimbre *timbre = nullptr);
 
   // Para qualquer som em reprodução
   void stop();
@@ -87,46 +121,23 @@ public:
   bool isMuted() const { return _muted; }
 
   // Verifica se está tocando
-  bool isPlaying() const { return _playing; }
+  bool isPlaying() const;
 
   // Verifica se inicializado
   bool isInitialized() const { return _initialized; }
 
-  // Atualiza (para melodias assíncronas)
-  void update();
-
-  // Controle do microfone
-  bool startRecording();
-  void stopRecording();
-  bool isRecording() const { return _recording; }
-
-  // Captura de áudio para voice assistant
-  size_t readAudioSamples(int16_t *buffer, size_t maxSamples);
-  bool isAudioAvailable() const;
-
-  // Configuração de ganho do microfone
+  // Microfone: cada consumidor abre um cursor em audioCapture
+  // (audio_capture.h); aqui fica só o ganho, aplicado uma vez na captura
   void setMicGain(int gain); // 0-100
 
   // Ativa/desativa Power Amplifier
   void enablePA(bool enable);
 
 private:
-  void playNextNote();
-  void generateToneBuffer(int frequency, int duration);
-
   bool _initialized;
   bool _muted;
-  bool _playing;
-  bool _recording;
   int _volume;
 
-  // Para melodias assíncronas
-  const MelodyNote *_currentMelody;
-  int _melodyLength;
-  int _melodyIndex;
-  unsigned long _noteStartTime;
-  int _currentNoteDuration;
-
   // Handle do ES8311
   void *_es8311Handle;
 };
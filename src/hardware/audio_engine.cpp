@@ -0,0 +1,522 @@
+/**
+ * @file audio_engine.cpp
+ * @brief Task de renderização de áudio (ver audio_engine.h)
+ */
+
+#include "audio_engine.h"
+#include <driver/i2s.h>
+#include <esp_heap_caps.h>
+
+AudioEngine audioEngine;
+
+// Blocos da task (fora da pilha)
+static int32_t s_acc[AUDIO_ENGINE_BLOCK];
+static int16_t s_voice[AUDIO_ENGINE_BLOCK];
+static int16_t s_mono[AUDIO_ENGINE_BLOCK];
+static int16_t s_stereo[AUDIO_ENGINE_BLOCK * 2];
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ANEL PCM
+// ═══════════════════════════════════════════════════════════════════════════
+
+AudioRing::AudioRing() : _buf(nullptr), _size(0), _mask(0), _head(0), _tail(0) {}
+
+bool AudioRing::begin(size_t size) {
+  if (_buf)
+    return true;
+  _buf = (int16_t *)heap_caps_malloc(size * sizeof(int16_t),
+                                     MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (!_buf)
+    return false;
+  _size = size;
+  _mask = size - 1;
+  return true;
+}
+
+size_t AudioRing::write(const int16_t *samples, size_t count) {
+  size_t head = _head.load(std::memory_order_relaxed);
+  size_t tail = _tail.load(std::memory_order_acquire);
+  size_t n = min(count, _size - (head - tail));
+  // Até duas cópias (o anel pode dar a volta)
+  size_t first = min(n, _size - (head & _mask));
+  memcpy(_buf + (head & _mask), samples, first * sizeof(int16_t));
+  memcpy(_buf, samples + first, (n - first) * sizeof(int16_t));
+  _head.store(head + n, std::memory_order_release);
+  return n;
+}
+
+size_t AudioRing::read(int16_t *out, size_t count) {
+  size_t tail = _tail.load(std::memory_order_relaxed);
+  size_t head = _head.load(std::memory_order_acquire);
+  size_t n = min(count, head - tail);
+  size_t first = min(n, _size - (tail & _mask));
+  memcpy(out, _buf + (tail & _mask), first * sizeof(int16_t));
+  memcpy(out + first, _buf, (n - first) * sizeof(int16_t));
+  _tail.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+void AudioRing::clear() {
+  _tail.store(_head.load(std::memory_order_acquire),
+              std::memory_order_release);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// API (QUALQUER TASK)
+// ═══════════════════════════════════════════════════════════════════════════
+
+AudioEngine::AudioEngine()
+    : _task(NULL), _queue(NULL), _i2sPort(0), _serial(0), _active(false),
+      _volume(80), _blocks(0), _underruns(0), _dropped(0), _rejected(0),
+      _stolen(0), _commands(0), _lastMixCycles(0), _maxMixCycles(0),
+      _voiceCount(0) {
+  for (uint8_t i = 0; i < AUDIO_ENGINE_VOICES + AUDIO_STREAM_COUNT; i++) {
+    memset(&_voices[i].prog, 0, sizeof(Program));
+    _voices[i].ring = nullptr;
+    _voices[i].priority = 0;
+    _voices[i].gain = AUDIO_Q15_ONE;
+    _voices[i].serial = 0;
+    _voices[i].active = false;
+  }
+  for (uint8_t s = 0; s < AUDIO_STREAM_COUNT; s++) {
+    _streams[s].requested = false;
+    _streams[s].rate = AUDIO_ENGINE_RATE;
+    _streams[s].priority = AUDIO_PRIO_VOICE;
+    _streams[s].gain = AUDIO_Q15_ONE;
+    _streams[s].idle = 0;
+    _voices[AUDIO_ENGINE_VOICES + s].ring = &_streams[s].ring;
+  }
+}
+
+bool AudioEngine::begin(int i2sPort) {
+  if (_task)
+    return true;
+  _i2sPort = i2sPort;
+  audioSynthInit();
+
+  _queue = xQueueCreate(AUDIO_ENGINE_QUEUE, sizeof(Command));
+  bool ok = _queue != NULL;
+  for (uint8_t s = 0; ok && s < AUDIO_STREAM_COUNT; s++)
+    ok = _streams[s].ring.begin(AUDIO_ENGINE_RING);
+  if (!ok) {
+    Serial.println("[AUDIO] Falha ao criar fila/anel do motor");
+    return false;
+  }
+
+  // Core 1, acima do loop(): o DMA nunca fica sem bloco por causa da UI
+  if (xTaskCreatePinnedToCore(taskEntry, "Audio_Task", 4096, this, 3, &_task,
+                              1) != pdPASS) {
+    Serial.println("[AUDIO] Falha ao criar task do motor");
+    _task = NULL;
+    return false;
+  }
+  Serial.printf("[AUDIO] Motor ativo (%u Hz, bloco %u, %u vozes + %u "
+                "streams)\n",
+                AUDIO_ENGINE_RATE, AUDIO_ENGINE_BLOCK, AUDIO_ENGINE_VOICES,
+                AUDIO_STREAM_COUNT);
+  return true;
+}
+
+bool AudioEngine::send(const Command &cmd) {
+  if (!_queue || xQueueSend(_queue, &cmd, 0) != pdTRUE) {
+    _rejected++;
+    return false;
+  }
+  return true;
+}
+
+bool AudioEngine::playMelody(const MelodyNote *notes, uint16_t count,
+                             uint8_t priority, const AudioTimbre *timbre) {
+  if (!notes || count == 0)
+    return false;
+  Command cmd = {};
+  cmd.type = CMD_MELODY;
+  cmd.priority = priority;
+  cmd.timbre = timbre;
+  cmd.notes = notes;
+  cmd.count = count;
+  cmd.rate = AUDIO_ENGINE_RATE;
+  return send(cmd);
+}
+
+bool AudioEngine::playTone(int frequency, int durationMs, uint8_t priority,
+                           const AudioTimbre *timbre) {
+  Command cmd = {};
+  cmd.type = CMD_TONE;
+  cmd.priority = priority;
+  cmd.timbre = timbre;
+  cmd.tone.frequency = frequency;
+  cmd.tone.duration = durationMs;
+  cmd.rate = AUDIO_ENGINE_RATE;
+  return send(cmd);
+}
+
+bool AudioEngine::playPcm(const int16_t *samples, size_t count, uint32_t rate,
+                          uint8_t priority) {
+  if (!samples || count == 0)
+    return false;
+  Command cmd = {};
+  cmd.type = CMD_PCM;
+  cmd.priority = priority;
+  cmd.pcm = samples;
+  cmd.pcmCount = count;
+  cmd.rate = rate;
+  return send(cmd);
+}
+
+bool AudioEngine::playSource(AudioSource *source, uint32_t rate,
+                             uint8_t priority) {
+  if (!source)
+    return false;
+  Command cmd = {};
+  cmd.type = CMD_SOURCE;
+  cmd.priority = priority;
+  cmd.source = source;
+  cmd.rate = rate;
+  if (!send(cmd)) {
+    source->close();
+    return false;
+  }
+  return true;
+}
+
+void AudioEngine::stop() {
+  Command cmd = {};
+  cmd.type = CMD_STOP;
+  // Sem xQueueReset: fontes na fila precisam passar pela task para receber
+  // close(). A fila esvazia a cada bloco, então a espera é curta
+  if (!_queue || xQueueSend(_queue, &cmd, pdMS_TO_TICKS(50)) != pdTRUE)
+    _rejected++;
+}
+
+void AudioEngine::configureStream(AudioStreamId stream, uint32_t rate,
+                                  uint8_t priority, int32_t gainQ15) {
+  if (stream >= AUDIO_STREAM_COUNT || rate == 0)
+    return;
+  _streams[stream].rate = rate;
+  _streams[stream].priority = priority;
+  _streams[stream].gain = gainQ15;
+}
+
+size_t AudioEngine::writePcm(AudioStreamId stream, const int16_t *samples,
+                             size_t count, uint32_t waitMs) {
+  if (!_task || !samples || stream >= AUDIO_STREAM_COUNT)
+    return 0;
+  Stream &st = _streams[stream];
+  uint32_t start = millis();
+  size_t written = 0;
+  while (true) {
+    written += st.ring.write(samples + written, count - written);
+    // Abre o stream uma vez; o motor fecha quando o anel esvazia
+    if (written > 0 && !st.requested.exchange(true)) {
+      Command cmd = {};
+      cmd.type = CMD_STREAM;
+      cmd.stream = stream;
+      if (!send(cmd))
+        st.requested = false;
+    }
+    if (written == count || millis() - start >= waitMs)
+      break;
+    vTaskDelay(1);
+  }
+  _dropped += count - written;
+  return written;
+}
+
+AudioEngineStats AudioEngine::getStats() const {
+  AudioEngineStats s;
+  s.blocks = _blocks;
+  s.underruns = _underruns;
+  s.dropped = _dropped;
+  s.rejected = _rejected;
+  s.stolen = _stolen;
+  s.commands = _commands;
+  s.lastMixCycles = _lastMixCycles;
+  s.maxMixCycles = _maxMixCycles;
+  s.queueDepth = _queue ? uxQueueMessagesWaiting(_queue) : 0;
+  s.ringFill = 0;
+  for (uint8_t i = 0; i < AUDIO_STREAM_COUNT; i++)
+    s.ringFill += _streams[i].ring.available();
+  s.voices = _voiceCount;
+  return s;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TASK DE ÁUDIO
+// ═══════════════════════════════════════════════════════════════════════════
+
+AudioEngine::Voice *AudioEngine::allocVoice(uint8_t priority) {
+  Voice *victim = nullptr;
+  for (uint8_t i = 0; i < AUDIO_ENGINE_VOICES; i++) {
+    Voice &v = _voices[i];
+    if (!v.active)
+      return &v;
+    // Menor prioridade primeiro; empate: a mais antiga
+    if (v.priority <= priority &&
+        (!victim || v.priority < victim->priority ||
+         (v.priority == victim->priority && v.serial < victim->serial)))
+      victim = &v;
+  }
+  if (victim) {
+    endProgram(victim->prog);
+    victim->active = false;
+    _stolen++;
+  }
+  return victim;
+}
+
+void AudioEngine::closeStream(uint8_t stream) {
+  Voice &v = _voices[AUDIO_ENGINE_VOICES + stream];
+  v.active = false;
+  _streams[stream].requested = false;
+  // Produtor escreveu entre o último read e o flag: continua aberto
+  if (_streams[stream].ring.available()) {
+    _streams[stream].requested = true;
+    v.active = true;
+  }
+  _streams[stream].idle = 0;
+}
+
+void AudioEngine::handle(const Command &cmd) {
+  _commands++;
+  switch (cmd.type) {
+  case CMD_STREAM: {
+    Stream &st = _streams[cmd.stream];
+    Voice &v = _voices[AUDIO_ENGINE_VOICES + cmd.stream];
+    if (!v.active) {
+      v.resampler.reset(st.rate, AUDIO_ENGINE_RATE);
+      v.priority = st.priority;
+      v.gain = st.gain;
+      v.serial = ++_serial;
+      v.active = true;
+    }
+    st.idle = 0;
+    return;
+  }
+  case CMD_STOP:
+    for (uint8_t i = 0; i < AUDIO_ENGINE_VOICES; i++) {
+      endProgram(_voices[i].prog);
+      _voices[i].active = false;
+    }
+    for (uint8_t s = 0; s < AUDIO_STREAM_COUNT; s++) {
+      _streams[s].ring.clear();
+      _streams[s].requested = false;
+      _streams[s].idle = 0;
+      _voices[AUDIO_ENGINE_VOICES + s].active = false;
+    }
+    return;
+  default:
+    break;
+  }
+
+  Voice *v = allocVoice(cmd.priority);
+  if (!v) {
+    // Todas as vozes ocupadas com prioridade maior
+    _rejected++;
+    if (cmd.type == CMD_SOURCE && cmd.source)
+      cmd.source->close();
+    return;
+  }
+
+  Program &p = v->prog;
+  memset(&p, 0, sizeof(p));
+  p.type = cmd.type;
+  p.active = true;
+  p.amplitude = (int16_t)(32767 * _volume / 100);
+  p.timbre = cmd.timbre ? cmd.timbre : &AUDIO_TIMBRE_SOFT;
+  switch (cmd.type) {
+  case CMD_MELODY:
+    p.notes = cmd.notes;
+    p.count = cmd.count;
+    startNote(p);
+    break;
+  case CMD_TONE:
+    p.tone = cmd.tone;
+    p.notes = &p.tone;
+    p.count = 1;
+    startNote(p);
+    break;
+  case CMD_PCM:
+    p.pcm = cmd.pcm;
+    p.pcmLeft = cmd.pcmCount;
+    break;
+  case CMD_SOURCE:
+    p.source = cmd.source;
+    break;
+  default:
+    p.active = false;
+    return;
+  }
+
+  v->resampler.reset(cmd.rate, AUDIO_ENGINE_RATE);
+  v->priority = cmd.priority;
+  v->gain = AUDIO_Q15_ONE;
+  v->serial = ++_serial;
+  v->active = true;
+}
+
+void AudioEngine::endProgram(Program &p) {
+  if (p.active && p.type == CMD_SOURCE && p.source)
+    p.source->close();
+  memset(&p, 0, sizeof(p));
+}
+
+void AudioEngine::startNote(Program &p) {
+  // Notas tocam na taxa do I2S (voz sem conversão)
+  const MelodyNote &note = p.notes[p.index];
+  p.noteLeft = (uint32_t)AUDIO_ENGINE_RATE * note.duration / 1000;
+  if (note.frequency > 0)
+    p.osc.start(*p.timbre, note.frequency, p.noteLeft, AUDIO_ENGINE_RATE,
+                p.amplitude);
+}
+
+size_t AudioEngine::renderProgram(Program &p, int16_t *out, size_t count) {
+  size_t done = 0;
+  while (p.active && done < count) {
+    switch (p.type) {
+    case CMD_MELODY:
+    case CMD_TONE: {
+      if (p.noteLeft == 0) {
+        if (++p.index >= p.count) {
+          endProgram(p);
+          break;
+        }
+        startNote(p);
+        continue;
+      }
+      size_t n = min((size_t)p.noteLeft, count - done);
+      const MelodyNote &note = p.notes[p.index];
+      if (note.frequency > 0) {
+        p.osc.render(out + done, n);
+      } else {
+        memset(out + done, 0, n * sizeof(int16_t)); // Pausa (NOTE_REST)
+      }
+      p.noteLeft -= n;
+      done += n;
+      break;
+    }
+    case CMD_PCM: {
+      size_t n = min(p.pcmLeft, count - done);
+      memcpy(out + done, p.pcm, n * sizeof(int16_t));
+      p.pcm += n;
+      p.pcmLeft -= n;
+      done += n;
+      if (p.pcmLeft == 0)
+        endProgram(p);
+      break;
+    }
+    case CMD_SOURCE: {
+      size_t n = p.source->read(out + done, count - done);
+      if (n == 0) {
+        endProgram(p);
+        break;
+      }
+      done += n;
+      break;
+    }
+    default:
+      endProgram(p);
+      break;
+    }
+  }
+  return done;
+}
+
+size_t AudioEngine::pullVoice(void *ctx, int16_t *out, size_t count) {
+  Voice *v = (Voice *)ctx;
+  if (v->ring)
+    return v->ring->read(out, count);
+  return renderProgram(v->prog, out, count);
+}
+
+void AudioEngine::mixBlock(int16_t *out) {
+  uint32_t t0 = ESP.getCycleCount();
+  const uint8_t total = AUDIO_ENGINE_VOICES + AUDIO_STREAM_COUNT;
+
+  // Maior prioridade ativa: as de baixo são abafadas
+  uint8_t top = 0;
+  for (uint8_t i = 0; i < total; i++) {
+    if (_voices[i].active && _voices[i].priority > top)
+      top = _voices[i].priority;
+  }
+
+  memset(s_acc, 0, sizeof(s_acc));
+  uint8_t active = 0;
+  for (uint8_t i = 0; i < total; i++) {
+    Voice &v = _voices[i];
+    if (!v.active)
+      continue;
+    size_t n = v.resampler.render(s_voice, AUDIO_ENGINE_BLOCK, pullVoice, &v);
+
+    int32_t gain = v.gain;
+    if (v.priority < top)
+      gain = (gain * AUDIO_DUCK_GAIN) >> 15;
+    audioMixAccumulate(s_acc, s_voice, n, gain);
+
+    if (v.ring) {
+      uint8_t s = i - AUDIO_ENGINE_VOICES;
+      if (n == 0) {
+        if (++_streams[s].idle >= AUDIO_ENGINE_IDLE_BLOCKS)
+          closeStream(s);
+      } else {
+        if (n < AUDIO_ENGINE_BLOCK)
+          _underruns++; // Produtor atrasou: o resto do bloco sai em silêncio
+        _streams[s].idle = 0;
+      }
+    } else if (n < AUDIO_ENGINE_BLOCK && !v.prog.active) {
+      v.active = false; // Programa acabou e o conversor esvaziou
+    }
+    if (v.active)
+      active++;
+  }
+
+  audioMixSaturate(out, s_acc, AUDIO_ENGINE_BLOCK, AUDIO_Q15_ONE);
+  _voiceCount = active;
+
+  uint32_t cycles = ESP.getCycleCount() - t0;
+  _lastMixCycles = cycles;
+  if (cycles > _maxMixCycles)
+    _maxMixCycles = cycles;
+}
+
+bool AudioEngine::anyVoiceActive() const {
+  for (uint8_t i = 0; i < AUDIO_ENGINE_VOICES + AUDIO_STREAM_COUNT; i++) {
+    if (_voices[i].active)
+      return true;
+  }
+  return false;
+}
+
+void AudioEngine::taskEntry(void *param) {
+  AudioEngine *self = (AudioEngine *)param;
+  Command cmd;
+
+  for (;;) {
+    // Sem nada tocando: dorme na fila; tocando: só esvazia a fila
+    TickType_t wait = self->anyVoiceActive() ? 0 : portMAX_DELAY;
+    while (xQueueReceive(self->_queue, &cmd, wait) == pdTRUE) {
+      self->handle(cmd);
+      wait = 0;
+    }
+
+    bool active = self->anyVoiceActive();
+    self->_active.store(active, std::memory_order_release);
+    if (!active) {
+      self->_voiceCount = 0;
+      continue;
+    }
+
+    self->mixBlock(s_mono);
+
+    for (size_t i = 0; i < AUDIO_ENGINE_BLOCK; i++) {
+      s_stereo[i * 2] = s_mono[i];     // Left
+      s_stereo[i * 2 + 1] = s_mono[i]; // Right
+    }
+
+    // Único ponto que bloqueia: o DMA dita o ritmo da task
+    size_t written = 0;
+    i2s_write((i2s_port_t)self->_i2sPort, s_stereo, sizeof(s_stereo),
+              &written, portMAX_DELAY);
+    self->_blocks++;
+  }
+}
@@ -0,0 +1,232 @@
+#pragma once
+/**
+ * @file audio_engine.h
+ * @brief Motor de áudio: task dona do I2S TX, fila de comandos e anel PCM
+ *
+ * Ninguém mais chama i2s_write. Quem quer tocar algo manda um comando pela
+ * fila (sequência de notas, buffer PCM, fonte de streaming) ou escreve
+ * amostras no anel PCM; as duas operações voltam em microssegundos. A task
+ * renderiza blocos de AUDIO_ENGINE_BLOCK amostras e bloqueia só ela mesma
+ * no DMA do I2S. Sem nada tocando, dorme na fila.
+ *
+ * Mixer: AUDIO_ENGINE_VOICES vozes de programa mais uma voz por stream,
+ * cada uma com ganho Q15, prioridade e taxa própria (convertida para
+ * AUDIO_ENGINE_RATE). Vozes abaixo da maior prioridade ativa são abafadas
+ * (AUDIO_DUCK_GAIN); sem voz livre, a nova rouba a mais antiga de
+ * prioridade menor ou igual. Acumulação em int32 com saturação no fim.
+ *
+ * Tons e melodias saem de AudioOscillator (tabela + ADSR) com timbre por
+ * sequência; duração ilimitada, gerados bloco a bloco.
+ *
+ * Formato de saída: mono, 16-bit, AUDIO_ENGINE_RATE, duplicado em L/R no
+ * bloco final.
+ */
+
+#include "audio_driver.h"
+#include "audio_mixer.h"
+#include "audio_synth.h"
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#define AUDIO_ENGINE_RATE 16000
+#define AUDIO_ENGINE_BLOCK 256       // Amostras por bloco (16 ms)
+#define AUDIO_ENGINE_RING 4096       // Anel PCM por stream (potência de 2)
+#define AUDIO_ENGINE_QUEUE 8
+#define AUDIO_ENGINE_IDLE_BLOCKS 8   // Anel vazio por 128 ms = stream acabou
+#define AUDIO_ENGINE_VOICES 4        // Vozes de programa (tons, PCM, fontes)
+#define AUDIO_DUCK_GAIN 8192         // Q15, ~-12 dB
+
+/**
+ * @brief Fonte de áudio puxada pelo motor (arquivo, decodificador...)
+ *
+ * read() roda na task de áudio e não pode bloquear por muito tempo: quem lê
+ * de SD deve ter o próprio buffer de prefetch.
+ */
+class AudioSource {
+public:
+  virtual ~AudioSource() {}
+  // Preenche até count amostras mono em AUDIO_ENGINE_RATE; 0 = fim
+  virtual size_t read(int16_t *out, size_t count) = 0;
+  // Chamada quando o motor larga a fonte (fim, stop ou substituída)
+  virtual void close() {}
+};
+
+/**
+ * @brief Anel PCM lock-free (um produtor, um consumidor)
+ */
+class AudioRing {
+public:
+  AudioRing();
+  bool begin(size_t size); // size potência de 2
+
+  size_t write(const int16_t *samples, size_t count); // Produtor
+  size_t read(int16_t *out, size_t count);            // Consumidor
+  void clear();                                       // Consumidor
+
+  size_t available() const {
+    return _head.load(std::memory_order_acquire) -
+           _tail.load(std::memory_order_acquire);
+  }
+  size_t space() const { return _size - available(); }
+  size_t size() const { return _size; }
+
+private:
+  int16_t *_buf;
+  size_t _size;
+  size_t _mask;
+  std::atomic<size_t> _head; // Total escrito
+  std::atomic<size_t> _tail; // Total lido
+};
+
+struct AudioEngineStats {
+  uint32_t blocks;     // Blocos enviados ao I2S
+  uint32_t underruns;  // Stream ativo sem amostras suficientes para um bloco
+  uint32_t dropped;    // Amostras descartadas: anel cheio
+  uint32_t rejected;   // Comandos descartados: fila cheia ou sem voz
+  uint32_t stolen;     // Vozes interrompidas por outra de prioridade >=
+  uint32_t commands;
+  uint32_t lastMixCycles; // Ciclos de CPU para mixar o último bloco
+  uint32_t maxMixCycles;
+  uint16_t queueDepth; // Comandos esperando agora
+  uint16_t ringFill;   // Amostras nos anéis agora
+  uint8_t voices;      // Vozes ativas
+};
+
+class AudioEngine {
+public:
+  AudioEngine();
+
+  // Cria a task (I2S já instalado pelo AudioDriver)
+  bool begin(int i2sPort);
+  bool isRunning() const { return _task != NULL; }
+
+  // ─── Comandos (não bloqueiam) ────────────────────────────────────────────
+  // notes e timbre precisam continuar válidos até tocar (static/const);
+  // timbre nulo = AUDIO_TIMBRE_SOFT
+  bool playMelody(const MelodyNote *notes, uint16_t count,
+                  uint8_t priority = AUDIO_PRIO_UI,
+                  const AudioTimbre *timbre = nullptr);
+  bool playTone(int frequency, int durationMs,
+                uint8_t priority = AUDIO_PRIO_UI,
+                const AudioTimbre *timbre = nullptr);
+  // samples precisa continuar válido até tocar (PROGMEM, buffer estático)
+  bool playPcm(const int16_t *samples, size_t count,
+               uint32_t rate = AUDIO_ENGINE_RATE,
+               uint8_t priority = AUDIO_PRIO_UI);
+  // O motor chama source->close() quando terminar (ou se recusar)
+  bool playSource(AudioSource *source, uint32_t rate = AUDIO_ENGINE_RATE,
+                  uint8_t priority = AUDIO_PRIO_UI);
+  void stop();
+
+  /**
+   * @brief Taxa, prioridade e ganho (Q15) de um stream
+   *
+   * Vale a partir da próxima abertura (stream fechado após
+   * AUDIO_ENGINE_IDLE_BLOCKS blocos sem dados).
+   */
+  void configureStream(AudioStreamId stream, uint32_t rate, uint8_t priority,
+                       int32_t gainQ15 = AUDIO_Q15_ONE);
+
+  /**
+   * @brief Escreve no anel PCM do stream (TTS)
+   * @param waitMs Espera por espaço (0 = descarta o que não couber)
+   * @return Amostras aceitas
+   */
+  size_t writePcm(AudioStreamId stream, const int16_t *samples, size_t count,
+                  uint32_t waitMs = 0);
+
+  void setVolume(int volume) { _volume = constrain(volume, 0, 100); }
+  bool isPlaying() const { return _active.load(std::memory_order_acquire); }
+
+  AudioEngineStats getStats() const;
+
+private:
+  enum CommandType : uint8_t { CMD_MELODY, CMD_TONE, CMD_PCM, CMD_SOURCE,
+                               CMD_STREAM, CMD_STOP };
+
+  struct Command {
+    CommandType type;
+    uint8_t priority;
+    uint8_t stream;
+    const MelodyNote *notes;
+    uint16_t count;
+    MelodyNote tone;
+    const AudioTimbre *timbre;
+    const int16_t *pcm;
+    size_t pcmCount;
+    AudioSource *source;
+    uint32_t rate;
+  };
+
+  // Programa de uma voz (só a task mexe)
+  struct Program {
+    CommandType type;
+    const MelodyNote *notes;
+    uint16_t count;
+    uint16_t index;
+    MelodyNote tone;
+    const AudioTimbre *timbre;
+    AudioOscillator osc;
+    uint32_t noteLeft; // Amostras restantes da nota atual
+    int16_t amplitude; // Q15
+    const int16_t *pcm;
+    size_t pcmLeft;
+    AudioSource *source;
+    bool active;
+  };
+
+  struct Voice {
+    Program prog;
+    AudioResampler resampler;
+    AudioRing *ring; // Voz de stream: lê daqui em vez do programa
+    uint8_t priority;
+    int32_t gain;
+    uint32_t serial; // Ordem de início (a mais antiga é roubada)
+    bool active;
+  };
+
+  struct Stream {
+    AudioRing ring;
+    std::atomic<bool> requested;
+    volatile uint32_t rate;
+    volatile uint8_t priority;
+    volatile int32_t gain;
+    uint8_t idle;
+  };
+
+  TaskHandle_t _task;
+  QueueHandle_t _queue;
+  int _i2sPort;
+  Voice _voices[AUDIO_ENGINE_VOICES + AUDIO_STREAM_COUNT];
+  Stream _streams[AUDIO_STREAM_COUNT];
+  uint32_t _serial;
+  std::atomic<bool> _active;
+  volatile int _volume;
+
+  volatile uint32_t _blocks;
+  volatile uint32_t _underruns;
+  volatile uint32_t _dropped;
+  volatile uint32_t _rejected;
+  volatile uint32_t _stolen;
+  volatile uint32_t _commands;
+  volatile uint32_t _lastMixCycles;
+  volatile uint32_t _maxMixCycles;
+  volatile uint8_t _voiceCount;
+
+  bool send(const Command &cmd);
+  void handle(const Command &cmd);
+  Voice *allocVoice(uint8_t priority);
+  void closeStream(uint8_t stream);
+  void mixBlock(int16_t *out);
+  bool anyVoiceActive() const;
+  static void endProgram(Program &p);
+  static void startNote(Program &p);
+  static size_t renderProgram(Program &p, int16_t *out, size_t count);
+  static size_t pullVoice(void *ctx, int16_t *out, size_t count);
+  static void taskEntry(void *param);
+};
+
+extern AudioEngine audioEngine;
@@ -0,0 +1,86 @@
+#include "audio_mixer.h"
+
+AudioResampler::AudioResampler()
+    : _step(1u << 16), _frac(0), _a(0), _b(0), _primed(false), _inPos(0),
+      _inLen(0) {}
+
+void AudioResampler::reset(uint32_t inRate, uint32_t outRate) {
+  if (inRate == 0 || outRate == 0)
+    inRate = outRate = 1;
+  _step = (uint32_t)(((uint64_t)inRate << 16) / outRate);
+  _frac = 0;
+  _a = _b = 0;
+  _primed = false;
+  _inPos = _inLen = 0;
+}
+
+bool AudioResampler::next(int16_t *sample, AudioPullFn pull, void *ctx) {
+  if (_inPos >= _inLen) {
+    _inLen = (uint8_t)pull(ctx, _in, AUDIO_RESAMPLER_CHUNK);
+    _inPos = 0;
+    if (_inLen == 0)
+      return false;
+  }
+  *sample = _in[_inPos++];
+  return true;
+}
+
+size_t AudioResampler::render(int16_t *out, size_t count, AudioPullFn pull,
+                              void *ctx) {
+  if (isPassthrough()) {
+    size_t n = 0;
+    while (n < count) {
+      size_t got = pull(ctx, out + n, count - n);
+      if (got == 0)
+        break;
+      n += got;
+    }
+    return n;
+  }
+
+  if (!_primed) {
+    if (!next(&_a, pull, ctx))
+      return 0;
+    _b = _a;
+    _frac = 1u << 16; // Força ler _b na primeira amostra
+    _primed = true;
+  }
+
+  size_t n = 0;
+  while (n < count) {
+    while (_frac >= (1u << 16)) {
+      int16_t b;
+      if (!next(&b, pull, ctx))
+        return n; // Sem dados: retoma daqui na próxima chamada
+      _a = _b;
+      _b = b;
+      _frac -= 1u << 16;
+    }
+    // (b - a) cabe em 17 bits e frac em Q15: produto < 2^31
+    int32_t delta = (int32_t)_b - _a;
+    out[n++] = (int16_t)(_a + ((delta * (int32_t)(_frac >> 1)) >> 15));
+    _frac += _step;
+  }
+  return n;
+}
+
+void audioMixAccumulate(int32_t *acc, const int16_t *in, size_t count,
+                        int32_t gainQ15) {
+  if (gainQ15 == AUDIO_Q15_ONE) {
+    for (size_t i = 0; i < count; i++)
+      acc[i] += in[i];
+    return;
+  }
+  for (size_t i = 0; i < count; i++)
+    acc[i] += ((int32_t)in[i] * gainQ15) >> 15;
+}
+
+void audioMixSaturate(int16_t *out, const int32_t *acc, size_t count,
+                      int32_t gainQ15) {
+  for (size_t i = 0; i < count; i++) {
+    int32_t v = acc[i];
+    if (gainQ15 != AUDIO_Q15_ONE)
+      v = (int32_t)(((int64_t)v * gainQ15) >> 15);
+    out[i] = v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+  }
+}
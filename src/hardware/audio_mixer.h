@@ -0,0 +1,62 @@
+#pragma once
+/**
+ * @file audio_mixer.h
+ * @brief Primitivas do mixer do AudioEngine (ponto fixo, sem Arduino)
+ *
+ * - Ganhos em Q15 (AUDIO_Q15_ONE = unitário).
+ * - Acumulação em int32 por bloco e saturação só no fim: várias vozes em
+ *   fundo de escala não dão wrap-around.
+ * - Conversão de taxa linear com passo Q16; 8/22,05/24/44,1 kHz -> taxa do
+ *   I2S. Mesma taxa = cópia direta, sem interpolar.
+ *
+ * Tudo aqui é determinístico (mesma entrada, mesma saída bit a bit) e
+ * compila no host para medir e conferir.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define AUDIO_Q15_ONE 32767
+#define AUDIO_RESAMPLER_CHUNK 32 // Amostras de entrada puxadas por vez
+
+// Puxa até count amostras da fonte; 0 = sem dados agora (ou fim)
+typedef size_t (*AudioPullFn)(void *ctx, int16_t *out, size_t count);
+
+/**
+ * @brief Conversor de taxa por interpolação linear (Q16)
+ */
+class AudioResampler {
+public:
+  AudioResampler();
+
+  void reset(uint32_t inRate, uint32_t outRate);
+  bool isPassthrough() const { return _step == (1u << 16); }
+
+  /**
+   * @brief Gera até count amostras na taxa de saída
+   *
+   * Retorna menos que count quando a fonte não tem mais dados; a próxima
+   * chamada continua do mesmo ponto (underrun de stream não perde fase).
+   */
+  size_t render(int16_t *out, size_t count, AudioPullFn pull, void *ctx);
+
+private:
+  uint32_t _step; // Entrada por saída, Q16
+  uint32_t _frac; // Posição entre _a e _b, Q16
+  int16_t _a;
+  int16_t _b;
+  bool _primed;
+  uint8_t _inPos;
+  uint8_t _inLen;
+  int16_t _in[AUDIO_RESAMPLER_CHUNK];
+
+  bool next(int16_t *sample, AudioPullFn pull, void *ctx);
+};
+
+// acc[i] += (in[i] * gain) >> 15
+void audioMixAccumulate(int32_t *acc, const int16_t *in, size_t count,
+                        int32_t gainQ15);
+
+// out[i] = sat16((acc[i] * gain) >> 15)
+void audioMixSaturate(int16_t *out, const int32_t *acc, size_t count,
+                      int32_t gainQ15);
@@ -0,0 +1,169 @@
+#include "audio_synth.h"
+#include <math.h>
+
+#define SINE_BITS 8
+#define SINE_SIZE (1 << SINE_BITS)
+#define ENV_ONE (1 << 30) // Envelope em Q30
+
+// +1 ponto de guarda: a interpolação lê idx+1 sem máscara
+static int16_t s_sine[SINE_SIZE + 1];
+static bool s_sineReady = false;
+
+//                                    forma          A   D    S      R
+const AudioTimbre AUDIO_TIMBRE_SOFT = {WAVE_SINE,     5, 30,  26214, 20};
+const AudioTimbre AUDIO_TIMBRE_CHIME = {WAVE_SINE,    2, 180, 9830,  40};
+const AudioTimbre AUDIO_TIMBRE_ALERT = {WAVE_SQUARE,  2, 20,  19661, 10};
+const AudioTimbre AUDIO_TIMBRE_CLICK = {WAVE_NOISE,   0, 12,  0,     2};
+const AudioTimbre AUDIO_TIMBRE_BUZZ = {WAVE_TRIANGLE, 3, 0,   32767, 8};
+
+void audioSynthInit() {
+  if (s_sineReady)
+    return;
+  for (int i = 0; i <= SINE_SIZE; i++) {
+    s_sine[i] = (int16_t)lrintf(32767.0f * sinf(2.0f * (float)M_PI * i /
+                                                SINE_SIZE));
+  }
+  s_sineReady = true;
+}
+
+void AudioOscillator::start(const AudioTimbre &timbre, uint32_t frequency,
+                            uint32_t samples, uint32_t rate,
+                            int16_t amplitude) {
+  _phase = 0;
+  _inc = (uint32_t)(((uint64_t)frequency << 32) / rate);
+  _noise = 0x9E3779B9u ^ frequency;
+  _noiseValue = 0;
+  _amplitude = amplitude;
+  _waveform = timbre.waveform;
+  _left = samples;
+
+  _attack = (uint32_t)timbre.attackMs * rate / 1000;
+  _decay = (uint32_t)timbre.decayMs * rate / 1000;
+  _release = (uint32_t)timbre.releaseMs * rate / 1000;
+  if (_attack + _release > samples) {
+    // Nota curta: metade para o release, o resto para o attack
+    if (_release > samples / 2)
+      _release = samples / 2;
+    if (_attack > samples - _release)
+      _attack = samples - _release;
+  }
+  _sustain = (int32_t)timbre.sustain << 15;
+  _env = 0;
+  enterStage(ATTACK);
+}
+
+void AudioOscillator::enterStage(uint8_t stage) {
+  _stage = stage;
+  switch (stage) {
+  case ATTACK:
+    if (_attack == 0) {
+      _env = ENV_ONE;
+      enterStage(DECAY);
+      return;
+    }
+    _envStep = ENV_ONE / (int32_t)_attack;
+    _stageLeft = _attack;
+    return;
+  case DECAY:
+    _env = ENV_ONE;
+    if (_decay == 0) {
+      enterStage(SUSTAIN);
+      return;
+    }
+    _envStep = (_sustain - _env) / (int32_t)_decay;
+    _stageLeft = _decay;
+    return;
+  case SUSTAIN:
+    _env = _sustain;
+    _envStep = 0;
+    _stageLeft = UINT32_MAX; // Sai pelo release (fim da nota)
+    return;
+  case RELEASE:
+    _envStep = _release ? -_env / (int32_t)_release : 0;
+    _stageLeft = _release ? _release : UINT32_MAX;
+    return;
+  default:
+    _env = 0;
+    _envStep = 0;
+    _stageLeft = UINT32_MAX;
+    return;
+  }
+}
+
+inline int16_t AudioOscillator::wave() {
+  uint32_t phase = _phase;
+  _phase += _inc;
+  switch (_waveform) {
+  case WAVE_SQUARE:
+    return phase < 0x80000000u ? 32767 : -32767;
+  case WAVE_TRIANGLE: {
+    int32_t x = (int32_t)(phase >> 15); // 0..131071
+    int32_t v = x < 65536 ? x - 32768 : 98303 - x;
+    return (int16_t)v;
+  }
+  case WAVE_NOISE:
+    // Sample and hold na frequência da nota (ruído "afinado")
+    if (_phase < phase || _noiseValue == 0) {
+      _noise ^= _noise << 13;
+      _noise ^= _noise >> 17;
+      _noise ^= _noise << 5;
+      _noiseValue = (int16_t)(_noise >> 16);
+    }
+    return _noiseValue;
+  default: {
+    uint32_t idx = phase >> (32 - SINE_BITS);
+    int32_t frac = (int32_t)((phase >> (17 - SINE_BITS)) & 0x7FFF);
+    int32_t a = s_sine[idx];
+    int32_t b = s_sine[idx + 1];
+    return (int16_t)(a + (((b - a) * frac) >> 15));
+  }
+  }
+}
+
+void AudioOscillator::render(int16_t *out, size_t n) {
+  while (n > 0) {
+    if (_left == 0) {
+      for (size_t i = 0; i < n; i++)
+        out[i] = 0;
+      return;
+    }
+    if (_stage < RELEASE && _left <= _release)
+      enterStage(RELEASE);
+
+    // Segmento com passo de envelope constante
+    uint32_t seg = n < _stageLeft ? (uint32_t)n : _stageLeft;
+    if (_stage < RELEASE && seg > _left - _release)
+      seg = _left - _release;
+    if (seg > _left)
+      seg = _left;
+
+    int32_t env = _env;
+    const int32_t step = _envStep;
+    const int32_t amp = _amplitude;
+    for (uint32_t i = 0; i < seg; i++) {
+      env += step;
+      int32_t s = ((int32_t)wave() * amp) >> 15;
+      out[i] = (int16_t)((s * (env >> 15)) >> 15);
+    }
+    _env = env;
+    out += seg;
+    n -= seg;
+    _left -= seg;
+    if (_stageLeft != UINT32_MAX)
+      _stageLeft -= seg;
+
+    if (_stageLeft == 0) {
+      switch (_stage) {
+      case ATTACK:
+        enterStage(DECAY);
+        break;
+      case DECAY:
+        enterStage(SUSTAIN);
+        break;
+      default:
+        enterStage(DONE);
+        break;
+      }
+    }
+  }
+}
@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file audio_synth.h
+ * @brief Osciladores por tabela + envelope ADSR para as vozes de tom
+ *
+ * - Acumulador de fase de 32 bits: frequência exata, sem drift entre blocos.
+ * - Seno por tabela de 256 pontos com interpolação linear (Q15); quadrada,
+ *   triângulo e ruído (xorshift, amostrado na frequência da nota) saem da
+ *   própria fase.
+ * - Envelope linear por segmentos (A, D, S, R) em Q30: o laço interno só
+ *   soma o passo do estágio atual.
+ *
+ * Sem dependência de Arduino: compila no host.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum AudioWaveform : uint8_t {
+  WAVE_SINE = 0,
+  WAVE_SQUARE,
+  WAVE_TRIANGLE,
+  WAVE_NOISE
+};
+
+/**
+ * @brief Timbre de uma sequência de notas (forma de onda + ADSR)
+ *
+ * Release começa releaseMs antes do fim de cada nota; attack e release são
+ * encurtados em notas curtas demais para caber os dois.
+ */
+struct AudioTimbre {
+  uint8_t waveform;   // AudioWaveform
+  uint16_t attackMs;
+  uint16_t decayMs;
+  int16_t sustain;    // Nível de sustentação, Q15
+  uint16_t releaseMs;
+};
+
+// Timbres prontos (melodias da UI, alertas, cliques)
+extern const AudioTimbre AUDIO_TIMBRE_SOFT;  // Seno, padrão
+extern const AudioTimbre AUDIO_TIMBRE_CHIME; // Seno com decaimento longo
+extern const AudioTimbre AUDIO_TIMBRE_ALERT; // Quadrada
+extern const AudioTimbre AUDIO_TIMBRE_CLICK; // Ruído curto
+extern const AudioTimbre AUDIO_TIMBRE_BUZZ;  // Triângulo (vibração)
+
+// Monta a tabela de seno (uma vez, antes da primeira nota)
+void audioSynthInit();
+
+/**
+ * @brief Oscilador + envelope de uma nota
+ *
+ * POD (sem construtor): vive dentro do programa da voz, zerado com memset.
+ */
+class AudioOscillator {
+public:
+  /**
+   * @param samples Duração da nota em amostras (inclui o release)
+   * @param amplitude Pico em Q15
+   */
+  void start(const AudioTimbre &timbre, uint32_t frequency, uint32_t samples,
+             uint32_t rate, int16_t amplitude);
+
+  // Gera n amostras (n <= restantes da nota)
+  void render(int16_t *out, size_t n);
+
+private:
+  enum Stage : uint8_t { ATTACK, DECAY, SUSTAIN, RELEASE, DONE };
+
+  uint32_t _phase;
+  uint32_t _inc;
+  uint32_t _noise;      // Estado do xorshift
+  int16_t _noiseValue;  // Amostra atual do ruído (sample and hold)
+  int16_t _amplitude;
+  uint8_t _waveform;
+  uint8_t _stage;
+  int32_t _env;         // Q30
+  int32_t _envStep;     // Q30 por amostra
+  int32_t _sustain;     // Q30
+  uint32_t _stageLeft;  // Amostras até o próximo estágio
+  uint32_t _left;       // Amostras até o fim da nota
+  uint32_t _release;    // Amostras de release
+  uint32_t _attack;
+  uint32_t _decay;
+
+  void enterStage(uint8_t stage);
+  int16_t wave();
+};
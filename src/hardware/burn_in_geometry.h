@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file burn_in_geometry.h
+ * @brief Origem, margem e toque do deslocamento de burn-in no painel
+ *
+ * A área do LVGL (UI_WIDTH x UI_HEIGHT) vai para o painel em margem +
+ * offset. Só aritmética (sem LVGL nem GFX): o lvgl_driver usa estas funções
+ * e test/test_burn_in confere no host que o flush nunca sai do painel, que
+ * as faixas apagadas cobrem exatamente o resto e que o toque volta ao ponto
+ * certo da UI.
+ */
+
+#include "../core/pin_definitions.h"
+#include <Arduino.h>
+
+struct BurnInRect {
+  int16_t x, y, w, h;
+};
+
+// Offset de outra task numa palavra só: (dx << 8) | (dy & 0xFF)
+inline int16_t burnInPackOffset(int8_t dx, int8_t dy) {
+  return (int16_t)(((uint16_t)(uint8_t)dx << 8) | (uint8_t)dy);
+}
+
+inline void burnInUnpackOffset(int16_t packed, int8_t *dx, int8_t *dy) {
+  *dx = (int8_t)(packed >> 8);
+  *dy = (int8_t)(packed & 0xFF);
+}
+
+// Offset dentro da margem: a área do LVGL sempre cabe no painel
+inline int8_t burnInClampOffset(int8_t d) {
+  return constrain(d, -DISPLAY_BURNIN_MARGIN, DISPLAY_BURNIN_MARGIN);
+}
+
+// Canto superior esquerdo da área do LVGL no painel
+inline int16_t burnInOrigin(int8_t offset) {
+  return DISPLAY_BURNIN_MARGIN + offset;
+}
+
+/**
+ * @brief Faixas do painel fora da área do LVGL com origem (x, y)
+ * @return Quantas faixas (até 4) foram escritas em out
+ */
+inline uint8_t burnInMarginRects(int16_t x, int16_t y, BurnInRect out[4]) {
+  uint8_t n = 0;
+  // Faixas de cima e de baixo com a largura toda; laterais só na altura
+  // da UI, sem sobrepor os cantos
+  if (y > 0)
+    out[n++] = {0, 0, LCD_WIDTH, y};
+  if (y + UI_HEIGHT < LCD_HEIGHT)
+    out[n++] = {0, (int16_t)(y + UI_HEIGHT), LCD_WIDTH,
+                (int16_t)(LCD_HEIGHT - y - UI_HEIGHT)};
+  if (x > 0)
+    out[n++] = {0, y, x, UI_HEIGHT};
+  if (x + UI_WIDTH < LCD_WIDTH)
+    out[n++] = {(int16_t)(x + UI_WIDTH), y,
+                (int16_t)(LCD_WIDTH - x - UI_WIDTH), UI_HEIGHT};
+  return n;
+}
+
+// Ponto do painel -> coordenada do LVGL, presa na área (toque na margem
+// vai para a borda da UI)
+inline int16_t burnInPanelToUi(int16_t p, int16_t origin, int16_t size) {
+  return constrain(p - origin, 0, size - 1);
+}
@@ -0,0 +1,97 @@
+#pragma once
+/**
+ * @file ima_adpcm.h
+ * @brief Codec IMA-ADPCM (DVI) de 4 bits por amostra, sem Arduino
+ *
+ * - Mesma reconstrução no codificador e no decodificador: o preditor do
+ *   codificador acompanha bit a bit o do outro lado.
+ * - Empacotamento do WAV IMA: duas amostras por byte, nibble baixo primeiro.
+ * - O estado (preditor + índice do passo) cabe em 3 bytes; quem transmite
+ *   em pacotes manda o estado do início de cada um, e a perda de um pacote
+ *   não desalinha os seguintes.
+ *
+ * Usado pelo WAV do SD (WavStream), walkie-talkie, gravador e o banco de
+ * frases do TTS.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define IMA_ADPCM_MAX_INDEX 88
+
+extern const int16_t ima_adpcm_step[IMA_ADPCM_MAX_INDEX + 1];
+extern const int8_t ima_adpcm_index[16];
+
+struct ImaAdpcmState {
+  int16_t predictor;
+  uint8_t index; // 0..IMA_ADPCM_MAX_INDEX
+};
+
+inline void imaAdpcmReset(ImaAdpcmState &s) {
+  s.predictor = 0;
+  s.index = 0;
+}
+
+// Estado vindo de fora (cabeçalho de bloco/pacote): índice limitado
+inline void imaAdpcmSetState(ImaAdpcmState &s, int16_t predictor,
+                             uint8_t index) {
+  s.predictor = predictor;
+  s.index = index > IMA_ADPCM_MAX_INDEX ? IMA_ADPCM_MAX_INDEX : index;
+}
+
+inline int16_t imaAdpcmDecodeNibble(ImaAdpcmState &s, uint8_t nibble) {
+  int32_t step = ima_adpcm_step[s.index];
+  int32_t diff = step >> 3;
+  if (nibble & 1)
+    diff += step >> 2;
+  if (nibble & 2)
+    diff += step >> 1;
+  if (nibble & 4)
+    diff += step;
+  int32_t pred = s.predictor + ((nibble & 8) ? -diff : diff);
+  pred = pred > 32767 ? 32767 : (pred < -32768 ? -32768 : pred);
+  int32_t index = s.index + ima_adpcm_index[nibble & 0x0F];
+  index = index < 0 ? 0 : (index > IMA_ADPCM_MAX_INDEX ? IMA_ADPCM_MAX_INDEX
+                                                        : index);
+  s.predictor = (int16_t)pred;
+  s.index = (uint8_t)index;
+  return s.predictor;
+}
+
+// Quantiza uma amostra e avança o estado como o decodificador faria
+uint8_t imaAdpcmEncodeSample(ImaAdpcmState &s, int16_t sample);
+
+/**
+ * @brief Codifica count amostras em (count + 1) / 2 bytes
+ * @return Bytes escritos (count ímpar: nibble alto do último byte = 0)
+ */
+size_t imaAdpcmEncode(ImaAdpcmState &s, const int16_t *in, size_t count,
+                      uint8_t *out);
+
+/**
+ * @brief Decodifica count amostras de (count + 1) / 2 bytes
+ * @return Amostras escritas
+ */
+size_t imaAdpcmDecode(ImaAdpcmState &s, const uint8_t *in, size_t count,
+                      int16_t *out);
+
+// ─── Blocos mono do WAV IMA ──────────────────────────────────────────────
+// Cabeçalho de 4 bytes (primeira amostra crua, índice do passo, 0) e
+// (blockAlign - 4) * 2 nibbles: IMA_ADPCM_BLOCK_SAMPLES(blockAlign) amostras
+#define IMA_ADPCM_BLOCK_SAMPLES(align) (((align) - 4) * 2 + 1)
+
+/**
+ * @brief Codifica um bloco inteiro (IMA_ADPCM_BLOCK_SAMPLES amostras)
+ *
+ * O índice do passo continua de s entre blocos; o preditor recomeça da
+ * primeira amostra de cada um.
+ */
+void imaAdpcmEncodeBlock(ImaAdpcmState &s, const int16_t *in,
+                         uint16_t blockAlign, uint8_t *out);
+
+/**
+ * @brief Decodifica as primeiras count amostras de um bloco
+ * @return Amostras escritas (count limitado ao bloco)
+ */
+size_t imaAdpcmDecodeBlock(const uint8_t *block, uint16_t blockAlign,
+                           size_t count, int16_t *out);
@@ -10,6 +10,8 @@
 
 #include "lvgl_driver.h"
 #include "../core/globals.h"
+#include "../ui/gpu_acceleration.h"
+#include "burn_in_geometry.h"
 #include "system_hardware.h"
 
 // Buffer de display LVGL (em PSRAM)
@@ -24,6 +26,23 @@ static lv_indev_drv_t indev_drv;
 // Ponteiro para Arduino_GFX
 static Arduino_GFX *gfx = nullptr;
 
+// Deslocamento da imagem no painel (burn-in). O LVGL renderiza uma área
+// UI_WIDTH x UI_HEIGHT; a origem do flush fica em margem + offset, sempre
+// dentro do painel (|offset| <= DISPLAY_BURNIN_MARGIN).
+static int8_t offset_x = 0;
+static int8_t offset_y = 0;
+static volatile int16_t pending_offset = 0; // (dx << 8) | (dy & 0xFF)
+static volatile bool offset_dirty = false;
+
+#define ORIGIN_X burnInOrigin(offset_x)
+#define ORIGIN_Y burnInOrigin(offset_y)
+
+#if BURNIN_SHIFT_MIRROR
+// Cópia do último frame (PSRAM): permite reposicionar sem re-renderizar
+static uint16_t *shift_mirror = nullptr;
+static volatile int8_t mirror_request = -1; // -1 nada, 0 libera, 1 cria
+#endif
+
 /**
  * @brief Callback de flush do display para LVGL
  */
@@ -37,11 +56,102 @@ static void lvgl_display_flush(lv_disp_drv_t *drv, const lv_area_t *area,
   uint32_t w = (area->x2 - area->x1 + 1);
   uint32_t h = (area->y2 - area->y1 + 1);
 
-  gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)color_p, w, h);
+#if BURNIN_SHIFT_MIRROR
+  if (shift_mirror) {
+    // Cópia por DMA; o próximo blend do LVGL espera ela terminar antes de
+    // reescrever este buffer
+    gpuAccel.copyRect(shift_mirror + area->y1 * UI_WIDTH + area->x1,
+                      (const uint16_t *)color_p, w, h, UI_WIDTH, w);
+  }
+#endif
+
+  gfx->draw16bitRGBBitmap(area->x1 + ORIGIN_X, area->y1 + ORIGIN_Y,
+                          (uint16_t *)color_p, w, h);
 
   lv_disp_flush_ready(drv);
 }
 
+/**
+ * @brief Apaga a margem do painel fora da área do LVGL na origem atual
+ */
+static void lvgl_clear_margin() {
+  BurnInRect rects[4];
+  uint8_t n = burnInMarginRects(ORIGIN_X, ORIGIN_Y, rects);
+  for (uint8_t i = 0; i < n; i++)
+    gfx->fillRect(rects[i].x, rects[i].y, rects[i].w, rects[i].h, 0x0000);
+}
+
+#if BURNIN_SHIFT_MIRROR
+/**
+ * @brief Cria ou libera a cópia do frame (roda na task LVGL)
+ * @return true se a cópia acabou de ser criada (espera um frame completo)
+ */
+static bool lvgl_update_shift_mirror() {
+  int8_t req = mirror_request;
+  mirror_request = -1;
+
+  if (req == 0 && shift_mirror) {
+    gpuAccel.waitComplete();
+    heap_caps_free(shift_mirror);
+    shift_mirror = nullptr;
+  } else if (req == 1 && !shift_mirror) {
+    size_t size = UI_WIDTH * UI_HEIGHT * sizeof(uint16_t);
+    shift_mirror =
+        (uint16_t *)heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+    if (!shift_mirror) {
+      Serial.println("[LVGL] Sem memória para espelho de burn-in");
+      return false;
+    }
+    memset(shift_mirror, 0, size);
+    // Preenche o espelho com um frame completo
+    lv_obj_invalidate(lv_scr_act());
+    return true;
+  }
+  return false;
+}
+#endif
+
+/**
+ * @brief Aplica o deslocamento pendente (roda na task LVGL)
+ *
+ * Com o espelho do frame, reenvia a imagem na nova origem; sem ele, cai
+ * para um redraw completo. Nos dois casos a margem descoberta é apagada.
+ */
+static void lvgl_offset_timer_cb(lv_timer_t *timer) {
+#if BURNIN_SHIFT_MIRROR
+  // Espelho recém-criado: espera o próximo frame preenchê-lo
+  if (mirror_request >= 0 && lvgl_update_shift_mirror()) {
+    return;
+  }
+#endif
+
+  if (!offset_dirty || !gfx) {
+    return;
+  }
+  offset_dirty = false;
+
+  int8_t dx, dy;
+  burnInUnpackOffset(pending_offset, &dx, &dy);
+  dx = burnInClampOffset(dx);
+  dy = burnInClampOffset(dy);
+  if (dx == offset_x && dy == offset_y) {
+    return;
+  }
+  offset_x = dx;
+  offset_y = dy;
+  lvgl_clear_margin();
+
+#if BURNIN_SHIFT_MIRROR
+  if (shift_mirror) {
+    gpuAccel.waitComplete();
+    gfx->draw16bitRGBBitmap(ORIGIN_X, ORIGIN_Y, shift_mirror, UI_WIDTH,
+                            UI_HEIGHT);
+    return;
+  }
+#endif
+  lv_obj_invalidate(lv_scr_act());
+}
+
 /**
  * @brief Callback de leitura do touch para LVGL
  */
@@ -50,8 +160,9 @@ static void lvgl_touchpad_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
 
   if (tp.touched) {
     data->state = LV_INDEV_STATE_PRESSED;
-    data->point.x = tp.x;
-    data->point.y = tp.y;
+    // Painel -> área do LVGL (margem + deslocamento)
+    data->point.x = burnInPanelToUi(tp.x, ORIGIN_X, UI_WIDTH);
+    data->point.y = burnInPanelToUi(tp.y, ORIGIN_Y, UI_HEIGHT);
   } else {
     data->state = LV_INDEV_STATE_RELEASED;
   }
@@ -79,18 +190,25 @@ bool lvgl_driver_init(Arduino_GFX *display) {
   lv_init();
   Serial.println("[LVGL] Core inicializado");
 
+  // GDMA para fills e blits grandes (hooks no draw context abaixo). Mede
+  // CPU x DMA antes do primeiro frame e ajusta minDmaPixels.
+  if (gpuAccel.begin()) {
+    gpuAccel.benchmark(nullptr, 0, 3);
+  }
+
   // Tip 13/42: Upgrade to Full Screen Double Buffer for max smoothness (PSRAM)
-  size_t buf_size = LCD_WIDTH * LCD_HEIGHT;
+  size_t buf_size = UI_WIDTH * UI_HEIGHT;
 
-  buf1 = (lv_color_t *)heap_caps_malloc(buf_size * sizeof(lv_color_t),
-                                        MALLOC_CAP_SPIRAM);
+  // Alinhado à linha de cache: linhas inteiras vão direto para o GDMA
+  buf1 = (lv_color_t *)heap_caps_aligned_alloc(
+      64, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
   if (!buf1) {
     // Fallback para DRAM
     buf1 = (lv_color_t *)malloc(buf_size * sizeof(lv_color_t));
   }
 
-  buf2 = (lv_color_t *)heap_caps_malloc(buf_size * sizeof(lv_color_t),
-                                        MALLOC_CAP_SPIRAM);
+  buf2 = (lv_color_t *)heap_caps_aligned_alloc(
+      64, buf_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
   if (!buf2) {
     // Fallback para DRAM
     buf2 = (lv_color_t *)malloc(buf_size * sizeof(lv_color_t));
@@ -112,12 +230,15 @@ bool lvgl_driver_init(Arduino_GFX *display) {
 
   // Configura display driver
   lv_disp_drv_init(&disp_drv);
-  disp_drv.hor_res = LCD_WIDTH;
-  disp_drv.ver_res = LCD_HEIGHT;
+  disp_drv.hor_res = UI_WIDTH;
+  disp_drv.ver_res = UI_HEIGHT;
   disp_drv.flush_cb = lvgl_display_flush;
   disp_drv.draw_buf = &draw_buf;
+  disp_drv.draw_ctx_init = gpuAccelInitDrawCtx;
   lv_disp_drv_register(&disp_drv);
-  Serial.printf("[LVGL] Display registrado: %dx%d\n", LCD_WIDTH, LCD_HEIGHT);
+  Serial.printf("[LVGL] Display registrado: %dx%d (margem %d px)\n",
+                UI_WIDTH, UI_HEIGHT, DISPLAY_BURNIN_MARGIN);
+  lvgl_clear_margin();
 
   // Configura input driver (touch)
   lv_indev_drv_init(&indev_drv);
@@ -126,6 +247,9 @@ bool lvgl_driver_init(Arduino_GFX *display) {
   lv_indev_drv_register(&indev_drv);
   Serial.println("[LVGL] Touch registrado");
 
+  // Aplica deslocamentos de burn-in no contexto da task LVGL
+  lv_timer_create(lvgl_offset_timer_cb, 100, nullptr);
+
   // Tick é automático via LV_TICK_CUSTOM no lv_conf.h
   Serial.println("[LVGL] Tick automático (millis)");
 
@@ -145,3 +269,20 @@ void lvgl_driver_loop() {
  * @return Ponteiro para o display
  */
 lv_disp_t *lvgl_get_display() { return lv_disp_get_default(); }
+
+/**
+ * @brief Desloca a imagem inteira no painel
+ */
+void lvgl_set_display_offset(int8_t dx, int8_t dy) {
+  pending_offset = burnInPackOffset(dx, dy);
+  offset_dirty = true;
+}
+
+/**
+ * @brief Pede a criação (ou liberação) da cópia do frame
+ */
+void lvgl_set_shift_mirror(bool enable) {
+#if BURNIN_SHIFT_MIRROR
+  mirror_request = enable ? 1 : 0;
+#endif
+}
@@ -28,3 +28,23 @@ void lvgl_driver_loop();
  * @return Ponteiro para o display
  */
 lv_disp_t *lvgl_get_display();
+
+/**
+ * @brief Desloca a imagem inteira no painel (proteção burn-in)
+ *
+ * Aplicado na task LVGL: move a origem do flush dentro da margem
+ * DISPLAY_BURNIN_MARGIN (valores maiores são limitados a ela).
+ * @param dx Deslocamento horizontal em pixels
+ * @param dy Deslocamento vertical em pixels
+ */
+void lvgl_set_display_offset(int8_t dx, int8_t dy);
+
+/**
+ * @brief Liga/desliga a cópia em PSRAM do último frame
+ *
+ * Com a cópia, um deslocamento custa só o reenvio do frame; sem ela, cada
+ * deslocamento força um redraw completo. Só existe com BURNIN_SHIFT_MIRROR
+ * (config.h, ligado por padrão); sem a flag, não faz nada. Aplicado na task
+ * LVGL.
+ */
+void lvgl_set_shift_mirror(bool enable);
@@ -0,0 +1,39 @@
+#pragma once
+/**
+ * @file mulaw.h
+ * @brief G.711 µ-law: 8 bits por amostra, sem tabelas
+ *
+ * Segmentos logarítmicos: erro proporcional ao nível, bom para voz pela
+ * metade dos bytes do PCM 16-bit. Mesmo formato da WAV tag 0x0007.
+ */
+
+#include <stdint.h>
+
+#define MULAW_BIAS 0x84
+#define MULAW_CLIP 32635
+
+inline uint8_t mulawEncode(int16_t pcm) {
+  int32_t s = pcm;
+  uint8_t sign = 0;
+  if (s < 0) {
+    s = -s;
+    sign = 0x80;
+  }
+  if (s > MULAW_CLIP)
+    s = MULAW_CLIP;
+  s += MULAW_BIAS;
+
+  // Segmento = posição do bit mais alto acima do bit 7
+  uint8_t exponent = 7;
+  for (int32_t mask = 0x4000; (s & mask) == 0 && exponent > 0; mask >>= 1)
+    exponent--;
+  uint8_t mantissa = (s >> (exponent + 3)) & 0x0F;
+  return (uint8_t)~(sign | (exponent << 4) | mantissa);
+}
+
+inline int16_t mulawDecode(uint8_t u) {
+  u = ~u;
+  int32_t s = ((((int32_t)u & 0x0F) << 3) + MULAW_BIAS) << ((u >> 4) & 0x07);
+  s -= MULAW_BIAS;
+  return (int16_t)((u & 0x80) ? -s : s);
+}
@@ -0,0 +1,402 @@
+/**
+ * @file wav_stream.cpp
+ * @brief WAV em streaming do SD (ver wav_stream.h)
+ */
+
+#include "wav_stream.h"
+#include "ima_adpcm.h"
+#include "mulaw.h"
+#include <SD_MMC.h>
+#include <esp_heap_caps.h>
+
+WavStream WavStream::s_pool[WAV_STREAM_POOL];
+TaskHandle_t WavStream::s_reader = NULL;
+
+#define WAV_TAG_PCM 0x0001
+#define WAV_TAG_MULAW 0x0007
+#define WAV_TAG_IMA_ADPCM 0x0011
+#define WAV_TAG_EXTENSIBLE 0xFFFE
+#define WAV_DECODE_CAP (WAV_ADPCM_MAX_BLOCK * 2) // Bloco ADPCM mono inteiro
+
+static inline uint16_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t le32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// POOL E TASK DE LEITURA
+// ═══════════════════════════════════════════════════════════════════════════
+
+WavStream::WavStream()
+    : _state(IDLE), _chunk(0), _readIdx(0), _fillIdx(0), _dataLeft(0),
+      _eof(false), _decoded(nullptr), _decCap(0), _decPos(0), _decLen(0),
+      _underruns(0) {
+  memset(&_info, 0, sizeof(_info));
+  for (uint8_t i = 0; i < 2; i++) {
+    _buf[i].data = nullptr;
+    _buf[i].len = 0;
+    _buf[i].pos = 0;
+    _buf[i].ready = false;
+  }
+}
+
+WavStream *WavStream::acquire() {
+  if (!s_reader) {
+    // Core 0, acima da UI: o prefetch não espera o LVGL
+    if (xTaskCreatePinnedToCore(readerTask, "WAV_Reader", 4096, NULL, 2,
+                                &s_reader, 0) != pdPASS) {
+      s_reader = NULL;
+      Serial.println("[SOUNDS] Falha ao criar task de leitura WAV");
+      return nullptr;
+    }
+  }
+  for (uint8_t i = 0; i < WAV_STREAM_POOL; i++) {
+    uint8_t expected = IDLE;
+    // OPENING: a task de leitura ignora até o open() terminar
+    if (s_pool[i]._state.compare_exchange_strong(expected, OPENING))
+      return &s_pool[i];
+  }
+  return nullptr;
+}
+
+void WavStream::readerTask(void *param) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    for (uint8_t i = 0; i < WAV_STREAM_POOL; i++)
+      s_pool[i].service();
+  }
+}
+
+void WavStream::service() {
+  uint8_t state = _state.load();
+  if (state == CLOSING) {
+    release();
+    return;
+  }
+  if (state != PLAYING)
+    return;
+  while (fillNext()) {
+  }
+}
+
+bool WavStream::allocate() {
+  if (_decoded)
+    return true;
+  // Buffers de leitura em PSRAM; o decodificado é lido a cada bloco de áudio
+  for (uint8_t i = 0; i < 2; i++) {
+    if (!_buf[i].data)
+      _buf[i].data = (uint8_t *)heap_caps_malloc(WAV_STREAM_CHUNK,
+                                                 MALLOC_CAP_SPIRAM);
+    if (!_buf[i].data)
+      _buf[i].data = (uint8_t *)malloc(WAV_STREAM_CHUNK);
+    if (!_buf[i].data)
+      return false;
+  }
+  _decoded = (int16_t *)heap_caps_malloc(WAV_DECODE_CAP * sizeof(int16_t),
+                                         MALLOC_CAP_INTERNAL |
+                                             MALLOC_CAP_8BIT);
+  if (!_decoded)
+    _decoded = (int16_t *)heap_caps_malloc(WAV_DECODE_CAP * sizeof(int16_t),
+                                           MALLOC_CAP_SPIRAM);
+  if (!_decoded)
+    return false;
+  _decCap = WAV_DECODE_CAP;
+  return true;
+}
+
+void WavStream::release() {
+  if (_file)
+    _file.close();
+  _buf[0].ready = false;
+  _buf[1].ready = false;
+  _state.store(IDLE);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// CABEÇALHO
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool WavStream::probe(File &file, WavInfo *info) {
+  uint8_t riff[12];
+  if (file.read(riff, 12) != 12 || memcmp(riff, "RIFF", 4) != 0 ||
+      memcmp(riff + 8, "WAVE", 4) != 0)
+    return false;
+
+  memset(info, 0, sizeof(*info));
+  uint16_t tag = 0;
+  bool haveFmt = false;
+
+  // Percorre os chunks: nada de assumir cabeçalho de 44 bytes
+  for (;;) {
+    uint8_t hdr[8];
+    if (file.read(hdr, 8) != 8)
+      return false;
+    uint32_t size = le32(hdr + 4);
+    uint32_t next = file.position() + size + (size & 1);
+
+    if (memcmp(hdr, "fmt ", 4) == 0) {
+      if (size < 16)
+        return false;
+      uint8_t fmt[40];
+      size_t n = size < sizeof(fmt) ? size : sizeof(fmt);
+      if (file.read(fmt, n) != n)
+        return false;
+      tag = le16(fmt);
+      info->channels = le16(fmt + 2);
+      info->sampleRate = le32(fmt + 4);
+      info->blockAlign = le16(fmt + 12);
+      info->bitsPerSample = le16(fmt + 14);
+      if (tag == WAV_TAG_EXTENSIBLE && n >= 26)
+        tag = le16(fmt + 24); // Subformato (início do GUID)
+      if (tag == WAV_TAG_IMA_ADPCM && n >= 20)
+        info->samplesPerBlock = le16(fmt + 18);
+      haveFmt = true;
+    } else if (memcmp(hdr, "data", 4) == 0) {
+      if (!haveFmt)
+        return false;
+      info->dataOffset = file.position();
+      // Tamanho 0/0xFFFFFFFF (gravação interrompida): até o fim do arquivo
+      uint32_t avail = file.size() - info->dataOffset;
+      info->dataSize = (size == 0 || size > avail) ? avail : size;
+      break;
+    }
+    // LIST, fact, cue... (e o resto de um fmt estendido)
+    if (!file.seek(next))
+      return false;
+  }
+
+  if (info->channels < 1 || info->channels > 2 || info->sampleRate < 4000 ||
+      info->sampleRate > 48000)
+    return false;
+
+  if (tag == WAV_TAG_PCM) {
+    if (info->bitsPerSample != 8 && info->bitsPerSample != 16)
+      return false;
+    info->format = WAV_FMT_PCM;
+    info->blockAlign = info->channels * info->bitsPerSample / 8;
+    info->durationMs =
+        (uint64_t)(info->dataSize / info->blockAlign) * 1000 / info->sampleRate;
+  } else if (tag == WAV_TAG_MULAW) {
+    if (info->bitsPerSample != 8)
+      return false;
+    info->format = WAV_FMT_MULAW;
+    info->blockAlign = info->channels;
+    info->durationMs =
+        (uint64_t)(info->dataSize / info->blockAlign) * 1000 / info->sampleRate;
+  } else if (tag == WAV_TAG_IMA_ADPCM) {
+    uint16_t header = 4 * info->channels;
+    if (info->bitsPerSample != 4 || info->blockAlign <= header ||
+        info->blockAlign > WAV_ADPCM_MAX_BLOCK)
+      return false;
+    // Nibbles por canal + a amostra do cabeçalho
+    uint16_t expected = (info->blockAlign - header) * 2 / info->channels + 1;
+    if (info->samplesPerBlock == 0 || info->samplesPerBlock > expected)
+      info->samplesPerBlock = expected;
+    info->format = WAV_FMT_IMA_ADPCM;
+    info->durationMs = (uint64_t)(info->dataSize / info->blockAlign) *
+                       info->samplesPerBlock * 1000 / info->sampleRate;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool WavStream::open(const char *path) {
+  if (_state.load() != OPENING)
+    return false;
+  if (!allocate()) {
+    Serial.println("[SOUNDS] Sem memória para buffers WAV");
+    release();
+    return false;
+  }
+
+  _file = SD_MMC.open(path, FILE_READ);
+  if (!_file || !probe(_file, &_info)) {
+    Serial.printf("[SOUNDS] WAV inválido ou não suportado: %s\n", path);
+    release();
+    return false;
+  }
+
+  // Leituras em blocos inteiros: frame PCM/bloco ADPCM nunca fica partido
+  _chunk = (WAV_STREAM_CHUNK / _info.blockAlign) * _info.blockAlign;
+  _file.seek(_info.dataOffset);
+  _dataLeft = _info.dataSize;
+  _readIdx = 0;
+  _fillIdx = 0;
+  _eof = false;
+  _decPos = 0;
+  _decLen = 0;
+  _underruns = 0;
+
+  // Primeiro buffer aqui mesmo: o áudio começa sem underrun
+  if (!fillNext()) {
+    release();
+    return false;
+  }
+  _state.store(PLAYING);
+  xTaskNotifyGive(s_reader); // Segundo buffer em background
+  return true;
+}
+
+bool WavStream::fillNext() {
+  Buffer &b = _buf[_fillIdx];
+  if (b.ready.load(std::memory_order_acquire) || _eof.load() ||
+      _dataLeft == 0)
+    return false;
+
+  size_t want = _chunk < _dataLeft ? _chunk : _dataLeft;
+  size_t got = _file.read(b.data, want);
+  if (_info.format != WAV_FMT_IMA_ADPCM)
+    got -= got % _info.blockAlign; // Frame incompleto no fim
+  if (got == 0) {
+    _dataLeft = 0;
+    _eof.store(true, std::memory_order_release);
+    return false;
+  }
+  // Leitura curta = arquivo truncado: este é o último buffer
+  _dataLeft = got < want ? 0 : _dataLeft - got;
+
+  b.len = got;
+  b.pos = 0;
+  b.ready.store(true, std::memory_order_release);
+  _fillIdx ^= 1;
+  // eof só depois do último ready: quem lê nunca vê eof com dado pendente
+  if (_dataLeft == 0)
+    _eof.store(true, std::memory_order_release);
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DECODIFICAÇÃO (TASK DE ÁUDIO)
+// ═══════════════════════════════════════════════════════════════════════════
+
+size_t WavStream::decodeAdpcmBlock(const uint8_t *block, size_t bytes) {
+  const uint8_t ch = _info.channels;
+  const size_t header = 4 * ch;
+  if (bytes <= header)
+    return 0;
+  const uint8_t *data = block + header;
+  const size_t dataBytes = bytes - header;
+  size_t limit = _info.samplesPerBlock < _decCap ? _info.samplesPerBlock
+                                                 : _decCap;
+  size_t total = 0;
+
+  for (uint8_t c = 0; c < ch; c++) {
+    ImaAdpcmState st;
+    imaAdpcmSetState(st, (int16_t)le16(block + 4 * c), block[4 * c + 2]);
+    size_t n = 0;
+    int16_t *out = _decoded;
+    // Estéreo: o segundo canal faz a média com o primeiro (mix para mono)
+    out[n] = (c == 0) ? st.predictor
+                      : (int16_t)(((int32_t)out[n] + st.predictor) >> 1);
+    n++;
+
+    if (ch == 1) {
+      size_t count = dataBytes * 2;
+      if (count > limit - n)
+        count = limit - n;
+      n += imaAdpcmDecode(st, data, count, out + n);
+    } else {
+      // Grupos de 8 bytes: 4 do canal 0 e 4 do canal 1 (8 amostras cada)
+      for (size_t g = 0; (g + 1) * 8 <= dataBytes && n < limit; g++) {
+        const uint8_t *q = data + g * 8 + c * 4;
+        for (uint8_t i = 0; i < 8 && n < limit; i++) {
+          uint8_t nib = (i & 1) ? (q[i >> 1] >> 4) : (q[i >> 1] & 0x0F);
+          int16_t s = imaAdpcmDecodeNibble(st, nib);
+          out[n] = (c == 0) ? s : (int16_t)(((int32_t)out[n] + s) >> 1);
+          n++;
+        }
+      }
+    }
+    total = (c == 0 || n < total) ? n : total;
+  }
+  return total;
+}
+
+size_t WavStream::decode(Buffer &b) {
+  const uint8_t *p = b.data + b.pos;
+  size_t left = b.len - b.pos;
+
+  if (_info.format == WAV_FMT_IMA_ADPCM) {
+    size_t bytes = left < _info.blockAlign ? left : _info.blockAlign;
+    b.pos += bytes;
+    return decodeAdpcmBlock(p, bytes);
+  }
+
+  size_t frames = left / _info.blockAlign;
+  if (frames > WAV_STREAM_DECODE)
+    frames = WAV_STREAM_DECODE;
+  if (frames == 0) {
+    b.pos = b.len;
+    return 0;
+  }
+
+  const bool stereo = _info.channels == 2;
+  if (_info.format == WAV_FMT_MULAW) {
+    for (size_t i = 0; i < frames; i++) {
+      int32_t v = stereo ? ((int32_t)mulawDecode(p[i * 2]) +
+                            mulawDecode(p[i * 2 + 1])) >> 1
+                         : mulawDecode(p[i]);
+      _decoded[i] = (int16_t)v;
+    }
+  } else if (_info.bitsPerSample == 16) {
+    if (!stereo) {
+      memcpy(_decoded, p, frames * sizeof(int16_t)); // Little-endian
+    } else {
+      for (size_t i = 0; i < frames; i++) {
+        int32_t l = (int16_t)le16(p + i * 4);
+        int32_t r = (int16_t)le16(p + i * 4 + 2);
+        _decoded[i] = (int16_t)((l + r) >> 1);
+      }
+    }
+  } else {
+    // PCM 8-bit é sem sinal (128 = zero)
+    for (size_t i = 0; i < frames; i++) {
+      int32_t v = stereo ? ((int32_t)p[i * 2] + p[i * 2 + 1]) >> 1 : p[i];
+      _decoded[i] = (int16_t)((v - 128) << 8);
+    }
+  }
+  b.pos += frames * _info.blockAlign;
+  return frames;
+}
+
+size_t WavStream::read(int16_t *out, size_t count) {
+  size_t done = 0;
+  while (done < count) {
+    if (_decPos < _decLen) {
+      size_t n = _decLen - _decPos;
+      if (n > count - done)
+        n = count - done;
+      memcpy(out + done, _decoded + _decPos, n * sizeof(int16_t));
+      _decPos += n;
+      done += n;
+      continue;
+    }
+
+    Buffer &b = _buf[_readIdx];
+    if (!b.ready.load(std::memory_order_acquire)) {
+      if (_eof.load(std::memory_order_acquire))
+        break; // Fim real: o motor encerra a voz ao receber 0
+      // SD atrasado: silêncio neste bloco, sem travar a task de áudio
+      memset(out + done, 0, (count - done) * sizeof(int16_t));
+      _underruns++;
+      return count;
+    }
+
+    _decLen = decode(b);
+    _decPos = 0;
+    if (b.pos >= b.len) {
+      b.ready.store(false, std::memory_order_release);
+      _readIdx ^= 1;
+      xTaskNotifyGive(s_reader);
+    }
+  }
+  return done;
+}
+
+void WavStream::close() {
+  // O arquivo é fechado pela task de leitura (dona do SD)
+  uint8_t expected = PLAYING;
+  if (_state.compare_exchange_strong(expected, CLOSING) && s_reader)
+    xTaskNotifyGive(s_reader);
+}
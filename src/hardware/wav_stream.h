@@ -0,0 +1,109 @@
+#pragma once
+/**
+ * @file wav_stream.h
+ * @brief Reprodução de WAV do SD em streaming (fonte do AudioEngine)
+ *
+ * - Cabeçalho lido chunk a chunk (RIFF/WAVE, "fmt ", "data"; LIST, fact e
+ *   afins são pulados, com o byte de padding de chunks ímpares).
+ * - Formatos: PCM 8/16-bit, µ-law (0x07), IMA-ADPCM (0x11) e
+ *   WAVE_FORMAT_EXTENSIBLE com subformato PCM; mono ou estéreo (mixado para mono). A taxa original vai
+ *   para o mixer, que converte para a do I2S.
+ * - Uma task de leitura (core 0) faz leituras sequenciais grandes para dois
+ *   buffers em PSRAM; a task de áudio só decodifica da memória e nunca toca
+ *   no cartão. Com o buffer atrasado (SD ocupado gravando), sai silêncio e
+ *   conta underrun em vez de travar.
+ *
+ * Uso: WavStream *s = WavStream::acquire(); s->open(path);
+ * audioDriver.playSource(s, s->getSampleRate()). O motor chama close()
+ * no fim e o slot volta para o pool.
+ */
+
+#include "audio_engine.h"
+#include <Arduino.h>
+#include <FS.h>
+#include <atomic>
+
+#define WAV_STREAM_POOL 2                 // Arquivos tocando ao mesmo tempo
+#define WAV_STREAM_CHUNK (16 * 1024)      // Bytes por leitura (x2 buffers)
+#define WAV_STREAM_DECODE 1024            // Amostras decodificadas por vez
+#define WAV_ADPCM_MAX_BLOCK 2048          // blockAlign máximo aceito
+
+enum WavFormat : uint8_t { WAV_FMT_PCM = 0, WAV_FMT_IMA_ADPCM, WAV_FMT_MULAW };
+
+struct WavInfo {
+  WavFormat format;
+  uint16_t channels;
+  uint32_t sampleRate;
+  uint16_t bitsPerSample;
+  uint16_t blockAlign;
+  uint16_t samplesPerBlock; // ADPCM, por canal
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  uint32_t durationMs;
+};
+
+class WavStream : public AudioSource {
+public:
+  /**
+   * @brief Slot livre do pool (nullptr se todos tocando)
+   */
+  static WavStream *acquire();
+
+  /**
+   * @brief Lê só o cabeçalho (sem tocar)
+   */
+  static bool probe(File &file, WavInfo *info);
+
+  /**
+   * @brief Abre, valida e pré-carrega o primeiro buffer
+   *
+   * Falhou = slot devolvido ao pool.
+   */
+  bool open(const char *path);
+
+  // AudioSource (task de áudio)
+  size_t read(int16_t *out, size_t count) override;
+  void close() override;
+
+  const WavInfo &getInfo() const { return _info; }
+  uint32_t getSampleRate() const { return _info.sampleRate; }
+  uint32_t getUnderruns() const { return _underruns; }
+
+private:
+  enum State : uint8_t { IDLE, OPENING, PLAYING, CLOSING };
+
+  struct Buffer {
+    uint8_t *data;
+    size_t len;
+    size_t pos;
+    std::atomic<bool> ready; // true: cheio, dono = task de áudio
+  };
+
+  std::atomic<uint8_t> _state;
+  File _file;
+  WavInfo _info;
+  Buffer _buf[2];
+  size_t _chunk;      // Bytes por leitura (múltiplo de blockAlign)
+  uint8_t _readIdx;   // Buffer sendo consumido
+  uint8_t _fillIdx;   // Próximo buffer a encher
+  uint32_t _dataLeft; // Bytes do chunk "data" ainda no arquivo
+  std::atomic<bool> _eof;
+
+  int16_t *_decoded; // WAV_STREAM_DECODE ou um bloco ADPCM inteiro
+  size_t _decCap;
+  size_t _decPos;
+  size_t _decLen;
+  volatile uint32_t _underruns;
+
+  WavStream();
+  bool allocate();
+  void release();
+  bool fillNext(); // Task de leitura
+  size_t decode(Buffer &b);
+  size_t decodeAdpcmBlock(const uint8_t *block, size_t bytes);
+  void service();
+
+  static WavStream s_pool[WAV_STREAM_POOL];
+  static TaskHandle_t s_reader;
+  static void readerTask(void *param);
+};
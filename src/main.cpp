@@ -206,15 +206,9 @@ void loop() {
   // Monitora botão de pânico
   panicSystem.update();
 
-  // Atualiza gravador de voz (VAD/Buffer)
-  voiceRecorder.update();
-
   // Lan Turtle logic
   lanTurtle.update();
 
-  // Atualiza áudio
-  audioDriver.update();
-
   // Atualiza assistente de voz
   voiceAssistant.update();
 
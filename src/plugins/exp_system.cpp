@@ -150,13 +150,12 @@ void ExpSystemPlugin::onLevelUp(uint8_t oldLevel, uint8_t newLevel) {
 
   // Play level-up celebratory sound
   // Custom melody: ascending notes for achievement
-  audioDriver.playTone(523, 80); // C5
-  delay(50);
-  audioDriver.playTone(659, 80); // E5
-  delay(50);
-  audioDriver.playTone(784, 80); // G5
-  delay(50);
-  audioDriver.playTone(1047, 200); // C6 - hold
+  static const MelodyNote levelUp[] = {
+      {523, 80}, {NOTE_REST, 50},  // C5
+      {659, 80}, {NOTE_REST, 50},  // E5
+      {784, 80}, {NOTE_REST, 50},  // G5
+      {1047, 200}};                // C6 - hold
+  audioDriver.playMelody(levelUp, sizeof(levelUp) / sizeof(MelodyNote));
 
   // Show level-up notification via notifications engine
   notifications_engine.notifyCustom(NOTIFY_EFFECT_CENTER_PULSE, 0x00FF00, 1500);
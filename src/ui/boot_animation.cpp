@@ -45,7 +45,7 @@ void BootAnimation::start() {
   // === MASCOTE FULLSCREEN ===
   // Cria container do mascote que ocupa a tela toda
   lv_obj_t *mascot_fullscreen = lv_obj_create(_screen);
-  lv_obj_set_size(mascot_fullscreen, LCD_WIDTH, LCD_HEIGHT);
+  lv_obj_set_size(mascot_fullscreen, UI_WIDTH, UI_HEIGHT);
   lv_obj_align(mascot_fullscreen, LV_ALIGN_CENTER, 0, 0);
   lv_obj_set_style_bg_opa(mascot_fullscreen, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_width(mascot_fullscreen, 0, 0);
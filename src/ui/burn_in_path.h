@@ -0,0 +1,96 @@
+#pragma once
+
+/**
+ * @file burn_in_path.h
+ * @brief Trajetórias do deslocamento de burn-in
+ *
+ * Só aritmética (sem LVGL), para ser conferida no host: o offset nunca sai
+ * de [-max, max], e max nunca passa de DISPLAY_BURNIN_MARGIN.
+ */
+
+#include <Arduino.h>
+
+/**
+ * @brief Padrões de deslocamento
+ */
+enum BurnInPattern {
+  BURNIN_PATTERN_BOUNCE = 0, // Diagonal, rebate nas bordas
+  BURNIN_PATTERN_ORBIT,      // Percorre o perímetro do quadrado de offsets
+  BURNIN_PATTERN_RANDOM,     // Posição aleatória a cada intervalo
+  BURNIN_PATTERN_COUNT
+};
+
+struct BurnInPath {
+  int8_t x = 0;
+  int8_t y = 0;
+  int8_t dirX = 1;
+  int8_t dirY = 1;
+  uint16_t step = 0;
+
+  void reset() {
+    x = 0;
+    y = 0;
+    step = 0;
+  }
+
+  // Próxima posição do padrão dentro de [-m, m]²
+  void next(BurnInPattern pattern, int8_t m) {
+    switch (pattern) {
+    case BURNIN_PATTERN_ORBIT: {
+      // Perímetro do quadrado [-m, m]²: 8m posições, sentido horário
+      uint16_t perimeter = 8 * m;
+      uint16_t p = step++ % perimeter;
+      uint16_t side = p / (2 * m);
+      int8_t t = p % (2 * m);
+      switch (side) {
+      case 0:
+        x = -m + t;
+        y = -m;
+        break;
+      case 1:
+        x = m;
+        y = -m + t;
+        break;
+      case 2:
+        x = m - t;
+        y = m;
+        break;
+      default:
+        x = -m;
+        y = m - t;
+        break;
+      }
+      break;
+    }
+
+    case BURNIN_PATTERN_RANDOM: {
+      int8_t nx, ny;
+      do {
+        nx = (int8_t)random(-m, m + 1);
+        ny = (int8_t)random(-m, m + 1);
+      } while (nx == x && ny == y);
+      x = nx;
+      y = ny;
+      break;
+    }
+
+    case BURNIN_PATTERN_BOUNCE:
+    default:
+      x += dirX;
+      y += dirY;
+
+      // Inverte direção se atingir limite
+      if (x >= m || x <= -m) {
+        dirX = -dirX;
+      }
+      if (y >= m || y <= -m) {
+        dirY = -dirY;
+      }
+      break;
+    }
+
+    // Limite pode ter diminuído desde o último shift
+    x = constrain(x, -m, m);
+    y = constrain(y, -m, m);
+  }
+};
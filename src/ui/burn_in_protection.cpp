@@ -4,26 +4,24 @@
  */
 
 #include "burn_in_protection.h"
+#include "../hardware/lvgl_driver.h"
 
 BurnInProtection burnInProtection;
 
-BurnInProtection::BurnInProtection()
-    : _lastShiftTime(0), _currentOffsetX(0), _currentOffsetY(0), _directionX(1),
-      _directionY(1), _objectCount(0) {
+BurnInProtection::BurnInProtection() : _lastShiftTime(0) {
   _config.enabled = true;
   _config.interval_s = 30;
   _config.max_offset = 2;
-  _config.apply_to_all = false;
+  _config.pattern = BURNIN_PATTERN_BOUNCE;
+}
 
-  for (int i = 0; i < MAX_PROTECTED_OBJECTS; i++) {
-    _protectedObjects[i] = nullptr;
-    _originalX[i] = 0;
-    _originalY[i] = 0;
+void BurnInProtection::begin() {
+  _lastShiftTime = millis();
+  if (_config.enabled) {
+    lvgl_set_shift_mirror(true);
   }
 }
 
-void BurnInProtection::begin() { _lastShiftTime = millis(); }
-
 void BurnInProtection::update() {
   if (!_config.enabled)
     return;
@@ -37,6 +35,7 @@ void BurnInProtection::update() {
 
 void BurnInProtection::setEnabled(bool enable) {
   _config.enabled = enable;
+  lvgl_set_shift_mirror(enable);
   if (!enable) {
     resetPositions();
   }
@@ -53,93 +52,39 @@ void BurnInProtection::setInterval(uint16_t seconds) {
 void BurnInProtection::setMaxOffset(int8_t pixels) {
   if (pixels < 1)
     pixels = 1;
-  if (pixels > 5)
-    pixels = 5;
+  if (pixels > DISPLAY_BURNIN_MARGIN)
+    pixels = DISPLAY_BURNIN_MARGIN;
   _config.max_offset = pixels;
 }
 
-void BurnInProtection::registerObject(lv_obj_t *obj) {
-  if (!obj || _objectCount >= MAX_PROTECTED_OBJECTS)
-    return;
-
-  // Verifica se já está registrado
-  for (int i = 0; i < _objectCount; i++) {
-    if (_protectedObjects[i] == obj)
-      return;
-  }
-
-  // Adiciona objeto
-  _protectedObjects[_objectCount] = obj;
-  _originalX[_objectCount] = lv_obj_get_x(obj);
-  _originalY[_objectCount] = lv_obj_get_y(obj);
-  _objectCount++;
-}
-
-void BurnInProtection::unregisterObject(lv_obj_t *obj) {
-  for (int i = 0; i < _objectCount; i++) {
-    if (_protectedObjects[i] == obj) {
-      // Restaura posição original
-      lv_obj_set_pos(obj, _originalX[i], _originalY[i]);
-
-      // Remove do array (shift elementos)
-      for (int j = i; j < _objectCount - 1; j++) {
-        _protectedObjects[j] = _protectedObjects[j + 1];
-        _originalX[j] = _originalX[j + 1];
-        _originalY[j] = _originalY[j + 1];
-      }
-      _objectCount--;
-      break;
-    }
-  }
-}
-
-void BurnInProtection::clearObjects() {
-  resetPositions();
-  for (int i = 0; i < MAX_PROTECTED_OBJECTS; i++) {
-    _protectedObjects[i] = nullptr;
-  }
-  _objectCount = 0;
+void BurnInProtection::setPattern(BurnInPattern pattern) {
+  if (pattern >= BURNIN_PATTERN_COUNT)
+    pattern = BURNIN_PATTERN_BOUNCE;
+  _config.pattern = pattern;
+  _path.step = 0;
 }
 
 void BurnInProtection::setConfig(const BurnInConfig &config) {
+  bool wasEnabled = _config.enabled;
   _config = config;
+  setMaxOffset(config.max_offset);
+  setPattern(config.pattern);
+  if (wasEnabled != config.enabled) {
+    setEnabled(config.enabled);
+  }
 }
 
 void BurnInProtection::applyShift() {
-  // Calcula novo offset
-  _currentOffsetX += _directionX;
-  _currentOffsetY += _directionY;
-
-  // Inverte direção se atingir limite
-  if (_currentOffsetX >= _config.max_offset ||
-      _currentOffsetX <= -_config.max_offset) {
-    _directionX = -_directionX;
-  }
-  if (_currentOffsetY >= _config.max_offset ||
-      _currentOffsetY <= -_config.max_offset) {
-    _directionY = -_directionY;
-  }
+  _path.next(_config.pattern, _config.max_offset);
 
-  // Aplica offset a todos os objetos registrados
-  for (int i = 0; i < _objectCount; i++) {
-    if (_protectedObjects[i]) {
-      lv_obj_set_pos(_protectedObjects[i], _originalX[i] + _currentOffsetX,
-                     _originalY[i] + _currentOffsetY);
-    }
-  }
+  // Desloca a imagem inteira no painel: nenhum objeto é invalidado
+  lvgl_set_display_offset(_path.x, _path.y);
 
   // Log para debug (opcional)
-  // Serial.printf("[BurnIn] Shift: X=%d, Y=%d\n", _currentOffsetX,
-  // _currentOffsetY);
+  // Serial.printf("[BurnIn] Shift: X=%d, Y=%d\n", _path.x, _path.y);
 }
 
 void BurnInProtection::resetPositions() {
-  _currentOffsetX = 0;
-  _currentOffsetY = 0;
-
-  for (int i = 0; i < _objectCount; i++) {
-    if (_protectedObjects[i]) {
-      lv_obj_set_pos(_protectedObjects[i], _originalX[i], _originalY[i]);
-    }
-  }
+  _path.reset();
+  lvgl_set_display_offset(0, 0);
 }
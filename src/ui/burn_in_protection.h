@@ -4,21 +4,24 @@
  * @file burn_in_protection.h
  * @brief Proteção contra burn-in para tela AMOLED
  *
- * Move elementos estáticos 1-2 pixels periodicamente para
- * evitar marcas permanentes no display.
+ * Desloca a imagem inteira alguns pixels periodicamente no nível do display
+ * (origem do flush), sem re-renderizar nem mover objetos LVGL. O LVGL
+ * desenha numa área menor que o painel (UI_WIDTH x UI_HEIGHT) e o
+ * deslocamento acontece dentro da margem reservada: nada é cortado.
  */
 
+#include "../core/pin_definitions.h"
+#include "burn_in_path.h"
 #include <Arduino.h>
-#include <lvgl.h>
 
 /**
  * @brief Configuração de proteção contra burn-in
  */
 struct BurnInConfig {
   bool enabled;
-  uint16_t interval_s; // Intervalo entre shifts (padrão 30s)
-  int8_t max_offset;   // Offset máximo em pixels (padrão 2)
-  bool apply_to_all;   // Aplicar a todos os elementos
+  uint16_t interval_s;   // Intervalo entre shifts (padrão 30s)
+  int8_t max_offset;     // Offset máximo (padrão 2, até a margem)
+  BurnInPattern pattern; // Trajetória do deslocamento
 };
 
 /**
@@ -52,35 +55,24 @@ public:
 
   /**
    * @brief Define offset máximo
-   * @param pixels Pixels de deslocamento (1-5)
+   * @param pixels Pixels de deslocamento (1 a DISPLAY_BURNIN_MARGIN)
    */
   void setMaxOffset(int8_t pixels);
 
   /**
-   * @brief Registra objeto para proteção
-   * @param obj Objeto LVGL a proteger
+   * @brief Define o padrão de deslocamento
    */
-  void registerObject(lv_obj_t *obj);
-
-  /**
-   * @brief Remove objeto da proteção
-   */
-  void unregisterObject(lv_obj_t *obj);
-
-  /**
-   * @brief Limpa todos os objetos registrados
-   */
-  void clearObjects();
+  void setPattern(BurnInPattern pattern);
 
   /**
    * @brief Obtém offset X atual
    */
-  int8_t getCurrentOffsetX() const { return _currentOffsetX; }
+  int8_t getCurrentOffsetX() const { return _path.x; }
 
   /**
    * @brief Obtém offset Y atual
    */
-  int8_t getCurrentOffsetY() const { return _currentOffsetY; }
+  int8_t getCurrentOffsetY() const { return _path.y; }
 
   /**
    * @brief Configuração
@@ -91,16 +83,7 @@ public:
 private:
   BurnInConfig _config;
   uint32_t _lastShiftTime;
-  int8_t _currentOffsetX;
-  int8_t _currentOffsetY;
-  int8_t _directionX;
-  int8_t _directionY;
-
-  static const int MAX_PROTECTED_OBJECTS = 20;
-  lv_obj_t *_protectedObjects[MAX_PROTECTED_OBJECTS];
-  int16_t _originalX[MAX_PROTECTED_OBJECTS];
-  int16_t _originalY[MAX_PROTECTED_OBJECTS];
-  int _objectCount;
+  BurnInPath _path;
 
   void applyShift();
   void resetPositions();
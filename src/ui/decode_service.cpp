@@ -0,0 +1,761 @@
+/**
+ * @file decode_service.cpp
+ * @brief Implementação do serviço de decodificação em segundo plano
+ */
+
+#include "decode_service.h"
+#include <LittleFS.h>
+#include <PNGdec.h>
+#include <SD_MMC.h>
+#include <esp_heap_caps.h>
+#include <new>
+
+DecodeService decodeService;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// REDIMENSIONAMENTO EM FLUXO
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Redimensiona linha a linha, sem guardar a imagem de origem
+ *
+ * Redução usa média de área (box filter) por eixo; ampliação usa vizinho
+ * mais próximo. Só mantém acumuladores de uma linha de saída.
+ */
+class RowScaler {
+public:
+  RowScaler()
+      : _xmap(nullptr), _xcount(nullptr), _acc(nullptr), _out(nullptr) {}
+
+  bool begin(uint16_t srcW, uint16_t srcH, uint16_t outW, uint16_t outH,
+             uint16_t *out, bool swap) {
+    end();
+    _srcW = srcW;
+    _srcH = srcH;
+    _outW = outW;
+    _outH = outH;
+    _out = out;
+    _swap = swap;
+    _srcY = 0;
+    _outY = 0;
+    _rows = 0;
+    _downX = srcW > outW;
+
+    uint16_t mapLen = _downX ? srcW : outW;
+    _xmap = (uint16_t *)malloc(mapLen * sizeof(uint16_t));
+    _xcount = (uint16_t *)calloc(outW, sizeof(uint16_t));
+    _acc = (uint32_t *)calloc(outW * 3, sizeof(uint32_t));
+    if (!_xmap || !_xcount || !_acc) {
+      end();
+      return false;
+    }
+
+    if (_downX) {
+      // Coluna de saída de cada pixel de origem
+      for (uint16_t x = 0; x < srcW; x++) {
+        uint16_t o = (uint32_t)x * outW / srcW;
+        _xmap[x] = o;
+        _xcount[o]++;
+      }
+    } else {
+      // Pixel de origem de cada coluna de saída
+      for (uint16_t o = 0; o < outW; o++) {
+        _xmap[o] = (uint32_t)o * srcW / outW;
+        _xcount[o] = 1;
+      }
+    }
+    return true;
+  }
+
+  void end() {
+    free(_xmap);
+    free(_xcount);
+    free(_acc);
+    _xmap = nullptr;
+    _xcount = nullptr;
+    _acc = nullptr;
+  }
+
+  /**
+   * @brief Recebe a próxima linha da origem (RGB565 nativo)
+   */
+  void push(const uint16_t *row) {
+    if (_srcY >= _srcH || _outY >= _outH) {
+      return;
+    }
+
+    if (_downX) {
+      for (uint16_t x = 0; x < _srcW; x++) {
+        accumulate(_xmap[x], row[x]);
+      }
+    } else {
+      for (uint16_t o = 0; o < _outW; o++) {
+        accumulate(o, row[_xmap[o]]);
+      }
+    }
+    _rows++;
+
+    if (_srcH > _outH) {
+      // Redução: a linha de saída cobre [oy*srcH/outH, (oy+1)*srcH/outH)
+      uint32_t endY = (uint32_t)(_outY + 1) * _srcH / _outH;
+      if ((uint32_t)_srcY + 1 >= endY) {
+        emit();
+        _outY++;
+      }
+    } else {
+      // Ampliação: repete a linha para cada saída que aponta para ela
+      bool first = true;
+      while (_outY < _outH && (uint32_t)_outY * _srcH / _outH == _srcY) {
+        if (first) {
+          emit();
+          first = false;
+        } else {
+          memcpy(_out + (size_t)_outY * _outW,
+                 _out + (size_t)(_outY - 1) * _outW, _outW * sizeof(uint16_t));
+        }
+        _outY++;
+      }
+      resetAcc();
+    }
+    _srcY++;
+  }
+
+  bool complete() const { return _outY >= _outH; }
+
+private:
+  uint16_t _srcW, _srcH, _outW, _outH;
+  uint16_t _srcY, _outY, _rows;
+  bool _downX, _swap;
+  uint16_t *_xmap;
+  uint16_t *_xcount;
+  uint32_t *_acc; // R, G, B por coluna de saída
+  uint16_t *_out;
+
+  inline void accumulate(uint16_t o, uint16_t c) {
+    uint32_t *a = &_acc[o * 3];
+    a[0] += c >> 11;
+    a[1] += (c >> 5) & 0x3F;
+    a[2] += c & 0x1F;
+  }
+
+  void resetAcc() {
+    memset(_acc, 0, _outW * 3 * sizeof(uint32_t));
+    _rows = 0;
+  }
+
+  void emit() {
+    uint16_t *dst = _out + (size_t)_outY * _outW;
+    for (uint16_t o = 0; o < _outW; o++) {
+      uint32_t n = (uint32_t)_xcount[o] * _rows;
+      const uint32_t *a = &_acc[o * 3];
+      uint16_t r = (a[0] + n / 2) / n;
+      uint16_t g = (a[1] + n / 2) / n;
+      uint16_t b = (a[2] + n / 2) / n;
+      uint16_t c = (r << 11) | (g << 5) | b;
+      dst[o] = _swap ? (uint16_t)((c << 8) | (c >> 8)) : c;
+    }
+    resetAcc();
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FONTES: PNG (PNGdec) E LVGL .bin
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Estado do decodificador atual (protegido por _engine)
+struct DecodeContext {
+  File file;
+  RowScaler scaler;
+  uint16_t *line; // Linha da origem em RGB565
+  const volatile bool *cancel;
+};
+
+static DecodeContext s_ctx;
+static PNG *s_png = nullptr; // ~45 KB, fica em PSRAM
+static const volatile bool s_never = false;
+
+static void *png_open_cb(const char *filename, int32_t *size) {
+  *size = s_ctx.file.size();
+  return &s_ctx.file;
+}
+
+static void png_close_cb(void *handle) {}
+
+static int32_t png_read_cb(PNGFILE *handle, uint8_t *buffer, int32_t length) {
+  return s_ctx.file.read(buffer, length);
+}
+
+static int32_t png_seek_cb(PNGFILE *handle, int32_t position) {
+  return s_ctx.file.seek(position);
+}
+
+static int png_draw_cb(PNGDRAW *draw) {
+  if (*s_ctx.cancel) {
+    return 0; // PNG_QUIT_EARLY
+  }
+  // Alpha é misturado com preto (fundo do AMOLED)
+  s_png->getLineAsRGB565(draw, s_ctx.line, PNG_RGB565_LITTLE_ENDIAN,
+                         0x000000);
+  s_ctx.scaler.push(s_ctx.line);
+  return 1;
+}
+
+/**
+ * @brief Leitor em blocos com descompressão RLE opcional
+ *
+ * RLE no formato de ImageCompressor::compressRLE: 0xFF, contagem, valor.
+ */
+class BinReader {
+public:
+  BinReader(File &file, bool rle)
+      : _file(file), _rle(rle), _pos(0), _len(0), _runLeft(0), _runValue(0) {}
+
+  size_t read(uint8_t *dst, size_t n) {
+    size_t done = 0;
+    while (done < n) {
+      if (_runLeft) {
+        size_t k = min((size_t)_runLeft, n - done);
+        memset(dst + done, _runValue, k);
+        _runLeft -= k;
+        done += k;
+        continue;
+      }
+      int b = next();
+      if (b < 0) {
+        break;
+      }
+      if (_rle && b == 0xFF) {
+        int count = next();
+        int value = next();
+        if (count < 0 || value < 0) {
+          break;
+        }
+        _runLeft = count;
+        _runValue = value;
+        continue;
+      }
+      dst[done++] = b;
+    }
+    return done;
+  }
+
+private:
+  File &_file;
+  bool _rle;
+  uint16_t _pos;
+  uint16_t _len;
+  uint16_t _runLeft;
+  uint8_t _runValue;
+  uint8_t _buf[512];
+
+  int next() {
+    if (_pos >= _len) {
+      int got = _file.read(_buf, sizeof(_buf));
+      if (got <= 0) {
+        return -1;
+      }
+      _len = got;
+      _pos = 0;
+    }
+    return _buf[_pos++];
+  }
+};
+
+// Cabeçalho "LVBI" gravado por ImageCompressor::convertToLVGLBin:
+// magic(4) + w(2) + h(2) + cf(1) + flags(1) + reservado(2), pixels RGB565
+#define LVBI_HEADER_SIZE 12
+#define LVBI_FLAG_RLE 0x01
+
+static bool fit_size(uint16_t srcW, uint16_t srcH, uint16_t maxW,
+                     uint16_t maxH, uint16_t *outW, uint16_t *outH) {
+  if (srcW == 0 || srcH == 0 || srcW > DecodeService::MAX_DIMENSION ||
+      srcH > DecodeService::MAX_DIMENSION) {
+    return false;
+  }
+  if (maxW == 0 || maxH == 0) {
+    *outW = srcW;
+    *outH = srcH;
+    return true;
+  }
+  // Scale-to-fit: o eixo mais justo define a escala
+  if ((uint32_t)srcW * maxH <= (uint32_t)maxW * srcH) {
+    *outH = maxH;
+    *outW = max(1u, (unsigned)((uint32_t)srcW * maxH / srcH));
+  } else {
+    *outW = maxW;
+    *outH = max(1u, (unsigned)((uint32_t)srcH * maxW / srcW));
+  }
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SERVIÇO
+// ═══════════════════════════════════════════════════════════════════════════
+
+DecodeService::DecodeService()
+    : _cancelledPos(0), _lock(nullptr), _engine(nullptr), _results(nullptr),
+      _task(nullptr), _deliverTimer(nullptr), _nextId(1), _seq(0),
+      _running(0), _runningOwner(nullptr), _runningCancelled(false),
+      _completed(0), _lastDecodeMs(0) {
+  memset(_jobs, 0, sizeof(_jobs));
+  memset(_cancelled, 0, sizeof(_cancelled));
+}
+
+bool DecodeService::begin() {
+  if (_task) {
+    return true;
+  }
+
+  if (!_lock) {
+    _lock = xSemaphoreCreateMutex();
+  }
+  if (!_engine) {
+    _engine = xSemaphoreCreateMutex();
+  }
+  _results = xQueueCreate(MAX_JOBS, sizeof(Delivery));
+  if (!_lock || !_engine || !_results) {
+    Serial.println("[DECODE] Falha ao criar filas");
+    return false;
+  }
+
+  // Core 1 com prioridade baixa: a task LVGL (core 0) nunca espera
+  if (xTaskCreatePinnedToCore(taskEntry, "Decode_Task", 6144, this, 1, &_task,
+                              1) != pdPASS) {
+    Serial.println("[DECODE] Falha ao criar task");
+    return false;
+  }
+
+  _deliverTimer = lv_timer_create(deliverTimerCb, 30, this);
+  Serial.println("[DECODE] Serviço de decodificação ativo");
+  return true;
+}
+
+DecodeRequest DecodeService::request(const char *path, uint16_t maxWidth,
+                                     uint16_t maxHeight) {
+  DecodeRequest req;
+  memset(&req, 0, sizeof(req));
+  req.path = path;
+  req.maxWidth = maxWidth;
+  req.maxHeight = maxHeight;
+  req.format = DECODE_RGB565;
+  req.priority = DECODE_PRIO_NORMAL;
+  return req;
+}
+
+DecodeJobId DecodeService::submit(const DecodeRequest &req) {
+  if (!_task || !req.path || strlen(req.path) >= MAX_PATH) {
+    return 0;
+  }
+
+  DecodeJobId id = 0;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    Job &j = _jobs[i];
+    if (j.id) {
+      continue;
+    }
+    id = _nextId++;
+    if (_nextId == 0) {
+      _nextId = 1;
+    }
+    j.id = id;
+    j.seq = _seq++;
+    j.req = req;
+    strncpy(j.path, req.path, MAX_PATH - 1);
+    j.path[MAX_PATH - 1] = '\0';
+    j.req.path = j.path;
+    break;
+  }
+  xSemaphoreGive(_lock);
+
+  if (!id) {
+    Serial.printf("[DECODE] Fila cheia, descartando %s\n", req.path);
+    return 0;
+  }
+
+  xTaskNotifyGive(_task);
+  return id;
+}
+
+bool DecodeService::cancel(DecodeJobId id) {
+  if (!id || !_lock) {
+    return false;
+  }
+
+  bool found = false;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    if (_jobs[i].id == id) {
+      _jobs[i].id = 0;
+      found = true;
+    }
+  }
+  if (!found && _running == id) {
+    _runningCancelled = true;
+    found = true;
+  }
+  if (!found) {
+    // Pode já estar na fila de entrega
+    markCancelled(id, nullptr);
+  }
+  xSemaphoreGive(_lock);
+  return found;
+}
+
+void DecodeService::cancelAll(void *userData) {
+  if (!_lock) {
+    return;
+  }
+
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    if (_jobs[i].id && _jobs[i].req.userData == userData) {
+      _jobs[i].id = 0;
+    }
+  }
+  if (_running && _runningOwner == userData) {
+    _runningCancelled = true;
+  }
+  // Resultados prontos deste dono: todos os ids já emitidos
+  markCancelled(_nextId, userData);
+  xSemaphoreGive(_lock);
+}
+
+void DecodeService::markCancelled(DecodeJobId id, void *owner) {
+  _cancelled[_cancelledPos].id = id;
+  _cancelled[_cancelledPos].owner = owner;
+  _cancelledPos = (_cancelledPos + 1) % MAX_JOBS;
+}
+
+uint8_t DecodeService::getPending() const {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    if (_jobs[i].id) {
+      n++;
+    }
+  }
+  return n + (_running ? 1 : 0);
+}
+
+bool DecodeService::takeNext(Job *out) {
+  int best = -1;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    const Job &j = _jobs[i];
+    if (!j.id) {
+      continue;
+    }
+    if (best < 0 || j.req.priority > _jobs[best].req.priority ||
+        (j.req.priority == _jobs[best].req.priority &&
+         (int32_t)(j.seq - _jobs[best].seq) < 0)) {
+      best = i;
+    }
+  }
+  if (best >= 0) {
+    *out = _jobs[best];
+    out->req.path = out->path;
+    _jobs[best].id = 0;
+    _running = out->id;
+    _runningOwner = out->req.userData;
+    _runningCancelled = false;
+  }
+  xSemaphoreGive(_lock);
+  return best >= 0;
+}
+
+bool DecodeService::wasCancelled(const DecodeResult &result) {
+  bool hit = false;
+  xSemaphoreTake(_lock, portMAX_DELAY);
+  for (uint8_t i = 0; i < MAX_JOBS; i++) {
+    const CancelMark &m = _cancelled[i];
+    if (!m.id) {
+      continue;
+    }
+    if (m.owner ? (m.owner == result.userData &&
+                   (int32_t)(result.id - m.id) < 0)
+                : m.id == result.id) {
+      hit = true;
+      break;
+    }
+  }
+  xSemaphoreGive(_lock);
+  return hit;
+}
+
+void DecodeService::taskEntry(void *param) {
+  DecodeService *self = (DecodeService *)param;
+  Job job;
+
+  for (;;) {
+    if (!self->takeNext(&job)) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    Delivery d;
+    d.callback = job.req.callback;
+    d.result.id = job.id;
+    self->run(job.req, &self->_runningCancelled, &d.result);
+
+    xSemaphoreTake(self->_lock, portMAX_DELAY);
+    bool cancelled = self->_runningCancelled;
+    self->_running = 0;
+    self->_runningOwner = nullptr;
+    xSemaphoreGive(self->_lock);
+
+    if (!cancelled && d.callback &&
+        xQueueSend(self->_results, &d, pdMS_TO_TICKS(500)) == pdTRUE) {
+      continue;
+    }
+
+    // Ninguém vai receber: libera aqui
+    if (d.result.ownsPixels) {
+      heap_caps_free(d.result.pixels);
+    }
+  }
+}
+
+void DecodeService::deliverTimerCb(lv_timer_t *timer) {
+  DecodeService *self = (DecodeService *)timer->user_data;
+  Delivery d;
+
+  while (xQueueReceive(self->_results, &d, 0) == pdTRUE) {
+    if (self->wasCancelled(d.result)) {
+      if (d.result.ownsPixels) {
+        heap_caps_free(d.result.pixels);
+      }
+      continue;
+    }
+    d.callback(d.result);
+  }
+}
+
+DecodeStatus DecodeService::decodeNow(const DecodeRequest &req,
+                                      DecodeResult *out) {
+  if (!_engine) {
+    _engine = xSemaphoreCreateMutex();
+  }
+  if (!_lock) {
+    _lock = xSemaphoreCreateMutex();
+  }
+  out->id = 0;
+  return run(req, nullptr, out);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DECODIFICAÇÃO
+// ═══════════════════════════════════════════════════════════════════════════
+
+DecodeStatus DecodeService::run(const DecodeRequest &req,
+                                const volatile bool *cancel,
+                                DecodeResult *out) {
+  uint32_t start = millis();
+  out->status = DECODE_ERR_OPEN;
+  out->pixels = nullptr;
+  out->width = out->height = 0;
+  out->srcWidth = out->srcHeight = 0;
+  out->decodeMs = 0;
+  out->ownsPixels = false;
+  out->userData = req.userData;
+
+  fs::FS *fs = req.fs;
+  if (!fs) {
+    fs = SD_MMC.exists(req.path) ? (fs::FS *)&SD_MMC
+         : LittleFS.exists(req.path) ? (fs::FS *)&LittleFS
+                                     : nullptr;
+  }
+  if (!fs) {
+    Serial.printf("[DECODE] Arquivo não encontrado: %s\n", req.path);
+    return out->status;
+  }
+
+  xSemaphoreTake(_engine, portMAX_DELAY);
+
+  s_ctx.file = fs->open(req.path, FILE_READ);
+  s_ctx.cancel = cancel ? cancel : &s_never;
+  s_ctx.line = nullptr;
+
+  uint8_t head[LVBI_HEADER_SIZE];
+  DecodeStatus status = DECODE_ERR_OPEN;
+  uint16_t srcW = 0, srcH = 0;
+  bool isPNG = false, isLVBI = false, rle = false;
+  uint8_t bpp = 2;
+  size_t dataOffset = 0;
+
+  if (!s_ctx.file ||
+      s_ctx.file.read(head, sizeof(head)) != (int)sizeof(head)) {
+    goto done;
+  }
+
+  // Detecta o formato pelo conteúdo, não pela extensão
+  status = DECODE_ERR_FORMAT;
+  if (head[0] == 0x89 && head[1] == 'P' && head[2] == 'N' && head[3] == 'G') {
+    isPNG = true;
+  } else if (memcmp(head, "LVBI", 4) == 0) {
+    isLVBI = true;
+    srcW = head[4] | (head[5] << 8);
+    srcH = head[6] | (head[7] << 8);
+    rle = head[9] & LVBI_FLAG_RLE;
+    dataOffset = LVBI_HEADER_SIZE;
+  } else {
+    lv_img_header_t hdr;
+    memcpy(&hdr, head, sizeof(hdr));
+    if (hdr.always_zero != 0 || (hdr.cf != LV_IMG_CF_TRUE_COLOR &&
+                                 hdr.cf != LV_IMG_CF_TRUE_COLOR_ALPHA)) {
+      goto done;
+    }
+    srcW = hdr.w;
+    srcH = hdr.h;
+    bpp = hdr.cf == LV_IMG_CF_TRUE_COLOR_ALPHA ? LV_IMG_PX_SIZE_ALPHA_BYTE : 2;
+    dataOffset = sizeof(lv_img_header_t);
+  }
+
+  if (isPNG) {
+    if (!s_png) {
+      void *mem = heap_caps_malloc(sizeof(PNG), MALLOC_CAP_SPIRAM);
+      if (!mem) {
+        status = DECODE_ERR_MEMORY;
+        goto done;
+      }
+      s_png = new (mem) PNG();
+    }
+    s_ctx.file.seek(0);
+    if (s_png->open(req.path, png_open_cb, png_close_cb, png_read_cb,
+                    png_seek_cb, png_draw_cb) != PNG_SUCCESS) {
+      goto done;
+    }
+    srcW = s_png->getWidth();
+    srcH = s_png->getHeight();
+  }
+
+  {
+    uint16_t outW, outH;
+    if (!fit_size(srcW, srcH, req.maxWidth, req.maxHeight, &outW, &outH)) {
+      if (isPNG) {
+        s_png->close();
+      }
+      goto done;
+    }
+    out->srcWidth = srcW;
+    out->srcHeight = srcH;
+
+    size_t outPixels = (size_t)outW * outH;
+    uint16_t *pixels = req.dest;
+    if (pixels && req.destPixels < outPixels) {
+      pixels = nullptr;
+      status = DECODE_ERR_MEMORY;
+    } else if (!pixels) {
+      pixels = (uint16_t *)heap_caps_malloc(outPixels * 2, MALLOC_CAP_SPIRAM);
+      if (!pixels) {
+        pixels = (uint16_t *)malloc(outPixels * 2);
+      }
+      out->ownsPixels = pixels != nullptr;
+    }
+
+    s_ctx.line = (uint16_t *)malloc((size_t)srcW * 2);
+    if (!pixels || !s_ctx.line ||
+        !s_ctx.scaler.begin(srcW, srcH, outW, outH, pixels,
+                            req.format == DECODE_RGB565_SWAP)) {
+      if (isPNG) {
+        s_png->close();
+      }
+      if (out->ownsPixels) {
+        heap_caps_free(pixels);
+        out->ownsPixels = false;
+      }
+      status = DECODE_ERR_MEMORY;
+      goto done;
+    }
+
+    out->pixels = pixels;
+    out->width = outW;
+    out->height = outH;
+
+    if (isPNG) {
+      int rc = s_png->decode(nullptr, 0);
+      s_png->close();
+      status = rc == PNG_SUCCESS ? DECODE_OK
+               : rc == PNG_QUIT_EARLY ? DECODE_CANCELLED
+                                      : DECODE_ERR_DECODE;
+    } else {
+      // .bin: linhas cruas (ou RLE) em sequência
+      s_ctx.file.seek(dataOffset);
+      BinReader reader(s_ctx.file, rle);
+      uint8_t px[LV_IMG_PX_SIZE_ALPHA_BYTE];
+      status = DECODE_OK;
+
+      for (uint16_t y = 0; y < srcH; y++) {
+        if (*s_ctx.cancel) {
+          status = DECODE_CANCELLED;
+          break;
+        }
+        if (bpp == 2) {
+          if (reader.read((uint8_t *)s_ctx.line, srcW * 2) != srcW * 2u) {
+            status = DECODE_ERR_DECODE;
+            break;
+          }
+        } else {
+          // TRUE_COLOR_ALPHA: RGB565 + alpha, misturado com preto
+          for (uint16_t x = 0; x < srcW; x++) {
+            if (reader.read(px, bpp) != bpp) {
+              status = DECODE_ERR_DECODE;
+              break;
+            }
+            uint16_t c = px[0] | (px[1] << 8);
+            uint8_t a = px[2];
+            uint16_t r = ((c >> 11) * a) / 255;
+            uint16_t g = (((c >> 5) & 0x3F) * a) / 255;
+            uint16_t b = ((c & 0x1F) * a) / 255;
+            s_ctx.line[x] = (r << 11) | (g << 5) | b;
+          }
+          if (status != DECODE_OK) {
+            break;
+          }
+        }
+        s_ctx.scaler.push(s_ctx.line);
+      }
+    }
+
+    if (status == DECODE_OK && !s_ctx.scaler.complete()) {
+      status = DECODE_ERR_DECODE;
+    }
+    s_ctx.scaler.end();
+  }
+
+done:
+  free(s_ctx.line);
+  s_ctx.line = nullptr;
+  if (s_ctx.file) {
+    s_ctx.file.close();
+  }
+  xSemaphoreGive(_engine);
+
+  if (status != DECODE_OK && out->ownsPixels) {
+    heap_caps_free(out->pixels);
+    out->pixels = nullptr;
+    out->ownsPixels = false;
+  }
+
+  out->status = status;
+  out->decodeMs = millis() - start;
+  _lastDecodeMs = out->decodeMs;
+  if (status == DECODE_OK) {
+    _completed++;
+    Serial.printf("[DECODE] %s: %dx%d -> %dx%d em %lu ms\n", req.path,
+                  out->srcWidth, out->srcHeight, out->width, out->height,
+                  out->decodeMs);
+  } else if (status != DECODE_CANCELLED) {
+    Serial.printf("[DECODE] %s: falha %d\n", req.path, status);
+  }
+  return status;
+}
+
+void DecodeService::toImgDsc(const DecodeResult &result, lv_img_dsc_t *dsc) {
+  memset(dsc, 0, sizeof(*dsc));
+  dsc->header.always_zero = 0;
+  dsc->header.cf = LV_IMG_CF_TRUE_COLOR;
+  dsc->header.w = result.width;
+  dsc->header.h = result.height;
+  dsc->data_size = (uint32_t)result.width * result.height * sizeof(uint16_t);
+  dsc->data = (const uint8_t *)result.pixels;
+}
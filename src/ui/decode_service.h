@@ -0,0 +1,193 @@
+#pragma once
+
+/**
+ * @file decode_service.h
+ * @brief Serviço único de decodificação de imagens em segundo plano
+ *
+ * Uma task de baixa prioridade (core 1, longe da task LVGL) consome uma fila
+ * de jobs com prioridade. Cada job lê o arquivo linha a linha - PNG via
+ * PNGdec, LVGL .bin (cru ou RLE) - e já escreve a imagem redimensionada no
+ * buffer de saída, sem guardar o original. O resultado é entregue na task
+ * LVGL por callback (lv_timer), então o callback pode mexer em objetos LVGL.
+ *
+ * Wallpapers, thumbnails, PNGDecoder e ImageCompressor usam este caminho.
+ */
+
+#include <Arduino.h>
+#include <FS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <lvgl.h>
+
+/**
+ * @brief Formato de pixel da saída
+ */
+enum DecodePixelFormat : uint8_t {
+  DECODE_RGB565 = 0, // Nativo (LV_IMG_CF_TRUE_COLOR)
+  DECODE_RGB565_SWAP // Bytes trocados (big-endian, envio direto ao painel)
+};
+
+enum DecodePriority : uint8_t {
+  DECODE_PRIO_LOW = 0, // Pré-carregamento, galeria fora da tela
+  DECODE_PRIO_NORMAL,  // Thumbnails visíveis
+  DECODE_PRIO_HIGH     // Wallpaper / imagem que o usuário pediu
+};
+
+enum DecodeStatus : int8_t {
+  DECODE_OK = 0,
+  DECODE_ERR_OPEN,
+  DECODE_ERR_FORMAT,
+  DECODE_ERR_MEMORY,
+  DECODE_ERR_DECODE,
+  DECODE_CANCELLED
+};
+
+typedef uint32_t DecodeJobId; // 0 = inválido
+
+/**
+ * @brief Resultado entregue ao callback (na task LVGL)
+ *
+ * Se ownsPixels, o callback passa a ser dono de pixels e deve liberá-lo com
+ * heap_caps_free quando não precisar mais.
+ */
+struct DecodeResult {
+  DecodeJobId id;
+  DecodeStatus status;
+  uint16_t *pixels;
+  uint16_t width; // Tamanho final (após o scale-to-fit)
+  uint16_t height;
+  uint16_t srcWidth;
+  uint16_t srcHeight;
+  uint32_t decodeMs;
+  bool ownsPixels;
+  void *userData;
+};
+
+typedef void (*DecodeCallback)(const DecodeResult &result);
+
+/**
+ * @brief Pedido de decodificação
+ */
+struct DecodeRequest {
+  const char *path;   // Copiado para o job
+  fs::FS *fs;         // nullptr: SD_MMC, depois LittleFS
+  uint16_t maxWidth;  // Caixa de destino, mantém proporção (0 = original)
+  uint16_t maxHeight;
+  DecodePixelFormat format;
+  DecodePriority priority;
+  uint16_t *dest;     // Buffer de saída (nullptr: aloca em PSRAM)
+  size_t destPixels;  // Capacidade de dest
+  DecodeCallback callback;
+  void *userData;
+};
+
+/**
+ * @brief Serviço de decodificação
+ */
+class DecodeService {
+public:
+  static const uint8_t MAX_JOBS = 8;
+  static const uint8_t MAX_PATH = 96;
+  static const uint16_t MAX_DIMENSION = 1024; // PNG_MAX_BUFFERED_PIXELS
+
+  DecodeService();
+
+  /**
+   * @brief Cria a task de decodificação e o timer de entrega
+   *
+   * Chamar no contexto da task LVGL (cria lv_timer).
+   */
+  bool begin();
+
+  /**
+   * @brief Pedido preenchido com os padrões (RGB565, prioridade normal)
+   */
+  static DecodeRequest request(const char *path, uint16_t maxWidth,
+                               uint16_t maxHeight);
+
+  /**
+   * @brief Enfileira um job
+   * @return Id do job (token de cancelamento) ou 0 se a fila está cheia
+   */
+  DecodeJobId submit(const DecodeRequest &req);
+
+  /**
+   * @brief Cancela um job pendente, em andamento ou ainda não entregue
+   *
+   * O callback de um job cancelado nunca é chamado.
+   */
+  bool cancel(DecodeJobId id);
+
+  /**
+   * @brief Cancela todos os jobs de um dono (ex: tela sendo destruída)
+   */
+  void cancelAll(void *userData);
+
+  /**
+   * @brief Decodifica no contexto de quem chama (bloqueia)
+   *
+   * Para código que já roda fora da UI (conversões, web). Compartilha o
+   * decodificador com a task, então espera o job atual terminar.
+   */
+  DecodeStatus decodeNow(const DecodeRequest &req, DecodeResult *out);
+
+  /**
+   * @brief Monta um descritor LVGL apontando para os pixels do resultado
+   */
+  static void toImgDsc(const DecodeResult &result, lv_img_dsc_t *dsc);
+
+  uint8_t getPending() const;
+  uint32_t getCompleted() const { return _completed; }
+  uint32_t getLastDecodeMs() const { return _lastDecodeMs; }
+
+private:
+  struct Job {
+    DecodeJobId id;
+    uint32_t seq; // Ordem de chegada dentro da mesma prioridade
+    char path[MAX_PATH];
+    DecodeRequest req;
+  };
+
+  struct Delivery {
+    DecodeResult result;
+    DecodeCallback callback;
+  };
+
+  // Cancelamento de resultado já na fila de entrega: por id exato, ou por
+  // dono (owner != nullptr) para todos os ids anteriores a `id`
+  struct CancelMark {
+    DecodeJobId id;
+    void *owner;
+  };
+
+  Job _jobs[MAX_JOBS];
+  CancelMark _cancelled[MAX_JOBS];
+  uint8_t _cancelledPos;
+
+  SemaphoreHandle_t _lock;   // Fila de jobs
+  SemaphoreHandle_t _engine; // Decodificador (task x decodeNow)
+  QueueHandle_t _results;
+  TaskHandle_t _task;
+  lv_timer_t *_deliverTimer;
+
+  DecodeJobId _nextId;
+  uint32_t _seq;
+  volatile DecodeJobId _running;
+  void *volatile _runningOwner;
+  volatile bool _runningCancelled;
+  uint32_t _completed;
+  uint32_t _lastDecodeMs;
+
+  bool takeNext(Job *out);
+  void markCancelled(DecodeJobId id, void *owner);
+  bool wasCancelled(const DecodeResult &result);
+  DecodeStatus run(const DecodeRequest &req, const volatile bool *cancel,
+                   DecodeResult *out);
+
+  static void taskEntry(void *param);
+  static void deliverTimerCb(lv_timer_t *timer);
+};
+
+extern DecodeService decodeService;
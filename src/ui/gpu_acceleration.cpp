@@ -1,108 +1,431 @@
 /**
  * @file gpu_acceleration.cpp
- * @brief Implementação da aceleração GPU/DMA2D
+ * @brief Implementação da aceleração GPU/GDMA
  */
 
 #include "gpu_acceleration.h"
-#include <esp_private/gdma.h>
-#include <soc/gdma_struct.h>
+#include <esp32s3/rom/cache.h>
+#include <soc/soc_memory_layout.h>
+#include <src/draw/sw/lv_draw_sw.h>
 #include <string.h>
 
+// Bloco de acesso do GDMA à PSRAM = linha de cache: o trecho escrito pelo DMA
+// nunca divide uma linha com pixels escritos pela CPU
+#ifdef CONFIG_ESP32S3_DATA_CACHE_LINE_SIZE
+#define GPU_PSRAM_ALIGN CONFIG_ESP32S3_DATA_CACHE_LINE_SIZE
+#else
+#define GPU_PSRAM_ALIGN 32
+#endif
+#define GPU_SRAM_ALIGN 4
+
 GPUAccelerator gpuAccel;
 
 GPUAccelerator::GPUAccelerator()
-    : _available(false), _busy(false), _opsCount(0), _bytesCopied(0),
-      _dmaChannel(nullptr) {
+    : _available(false), _busy(false), _opsCount(0), _dmaOps(0),
+      _bytesCopied(0), _dmaChannel(nullptr), _dmaRxChannel(nullptr),
+      _doneSem(nullptr), _txDesc(nullptr), _rxDesc(nullptr),
+      _fillRow(nullptr), _fillColor(0), _invalAddr(0), _invalSize(0),
+      _benchCount(0) {
 
   _config.enabled = true;
   _config.useForFill = true;
   _config.useForCopy = true;
   _config.useForBlend = false; // Blend em software por padrão
-  _config.asyncMode = false;
+  _config.asyncMode = true;
   _config.priority = 1;
+  _config.minDmaPixels = 4096; // ~64x64, ajustado pelo benchmark
 }
 
 bool GPUAccelerator::begin() {
-  Serial.println("[GPU] Initializing DMA2D acceleration...");
+  if (_available) {
+    return true;
+  }
+
+  Serial.println("[GPU] Initializing GDMA acceleration...");
 
-  // ESP32-S3 tem GDMA (General DMA)
   _available = initDMA();
 
   if (_available) {
-    Serial.println("[GPU] ✓ DMA2D acceleration available");
+    Serial.println("[GPU] ✓ GDMA M2M acceleration available");
   } else {
-    Serial.println("[GPU] ⚠ DMA2D not available, using software fallback");
+    deinitDMA();
+    Serial.println("[GPU] ⚠ GDMA not available, using software fallback");
   }
 
   return _available;
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// GDMA
+// ═══════════════════════════════════════════════════════════════════════════
+
 bool GPUAccelerator::initDMA() {
-  // O ESP32-S3 usa GDMA ao invés de DMA2D tradicional
-  // Para operações simples, podemos usar memcpy otimizado
-  // A aceleração real requer uso do LCD_CAM ou SPI DMA
+  // Descritores e linha-modelo precisam estar em SRAM interna acessível ao DMA
+  _txDesc = (dma_descriptor_t *)heap_caps_calloc(
+      MAX_DESC, sizeof(dma_descriptor_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  _rxDesc = (dma_descriptor_t *)heap_caps_calloc(
+      MAX_DESC, sizeof(dma_descriptor_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  _fillRow = (uint16_t *)heap_caps_aligned_alloc(
+      GPU_PSRAM_ALIGN, DESC_CHUNK, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+  _doneSem = xSemaphoreCreateBinary();
+  if (!_txDesc || !_rxDesc || !_fillRow || !_doneSem) {
+    Serial.println("[GPU] Sem memória interna para descritores");
+    return false;
+  }
+
+  // Par TX/RX irmãos: o M2M exige os dois lados no mesmo canal físico
+  gdma_channel_alloc_config_t tx_cfg = {};
+  tx_cfg.direction = GDMA_CHANNEL_DIRECTION_TX;
+  if (gdma_new_channel(&tx_cfg, &_dmaChannel) != ESP_OK) {
+    return false;
+  }
+
+  gdma_channel_alloc_config_t rx_cfg = {};
+  rx_cfg.direction = GDMA_CHANNEL_DIRECTION_RX;
+  rx_cfg.sibling_chan = _dmaChannel;
+  if (gdma_new_channel(&rx_cfg, &_dmaRxChannel) != ESP_OK) {
+    return false;
+  }
+
+  gdma_trigger_t m2m = GDMA_MAKE_TRIGGER(GDMA_TRIG_PERIPH_M2M, 0);
+  gdma_connect(_dmaChannel, m2m);
+  gdma_connect(_dmaRxChannel, m2m);
+
+  gdma_strategy_config_t strategy = {};
+  strategy.auto_update_desc = true;
+  strategy.owner_check = true;
+  gdma_apply_strategy(_dmaChannel, &strategy);
+  gdma_apply_strategy(_dmaRxChannel, &strategy);
+
+  gdma_transfer_ability_t ability = {};
+  ability.sram_trans_align = GPU_SRAM_ALIGN;
+  ability.psram_trans_align = GPU_PSRAM_ALIGN;
+  gdma_set_transfer_ability(_dmaChannel, &ability);
+  gdma_set_transfer_ability(_dmaRxChannel, &ability);
+
+  gdma_rx_event_callbacks_t cbs = {};
+  cbs.on_recv_eof = dmaEofCallback;
+  if (gdma_register_rx_event_callbacks(_dmaRxChannel, &cbs, this) != ESP_OK) {
+    return false;
+  }
 
-  // Por agora, marcamos como disponível e usamos implementações otimizadas
   return true;
 }
 
 void GPUAccelerator::deinitDMA() {
+  if (_dmaRxChannel) {
+    gdma_disconnect(_dmaRxChannel);
+    gdma_del_channel(_dmaRxChannel);
+    _dmaRxChannel = nullptr;
+  }
   if (_dmaChannel) {
-    // Cleanup DMA resources
+    gdma_disconnect(_dmaChannel);
+    gdma_del_channel(_dmaChannel);
     _dmaChannel = nullptr;
   }
+  if (_doneSem) {
+    vSemaphoreDelete(_doneSem);
+    _doneSem = nullptr;
+  }
+  heap_caps_free(_txDesc);
+  heap_caps_free(_rxDesc);
+  heap_caps_free(_fillRow);
+  _txDesc = nullptr;
+  _rxDesc = nullptr;
+  _fillRow = nullptr;
+}
+
+bool IRAM_ATTR GPUAccelerator::dmaEofCallback(gdma_channel_handle_t chan,
+                                              gdma_event_data_t *event,
+                                              void *userData) {
+  GPUAccelerator *self = (GPUAccelerator *)userData;
+  BaseType_t woken = pdFALSE;
+  xSemaphoreGiveFromISR(self->_doneSem, &woken);
+  return woken == pdTRUE;
+}
+
+static inline void gpu_set_desc(dma_descriptor_t *d, void *buf, size_t len,
+                                bool tx) {
+  d->dw0.size = len;
+  d->dw0.length = tx ? len : 0;
+  d->dw0.suc_eof = 0;
+  d->dw0.err_eof = 0;
+  d->dw0.owner = DMA_DESCRIPTOR_BUFFER_OWNER_DMA;
+  d->buffer = buf;
+  d->next = d + 1;
+}
+
+void GPUAccelerator::startTransfer(uint32_t invalAddr, uint32_t invalSize) {
+  // A CPU pode ter linhas sujas sobre o destino (e a origem em PSRAM):
+  // grava tudo antes que o DMA escreva por baixo do cache
+  if (invalSize) {
+    Cache_WriteBack_Addr(invalAddr, invalSize);
+  }
+  _invalAddr = invalAddr;
+  _invalSize = invalSize;
+  _busy = true;
+  _dmaOps++;
+
+  gdma_start(_dmaRxChannel, (intptr_t)_rxDesc);
+  gdma_start(_dmaChannel, (intptr_t)_txDesc);
+}
+
+void GPUAccelerator::waitComplete() {
+  if (!_busy) {
+    return;
+  }
+
+  if (xSemaphoreTake(_doneSem, pdMS_TO_TICKS(100)) != pdTRUE) {
+    Serial.println("[GPU] Timeout aguardando DMA");
+    gdma_stop(_dmaChannel);
+    gdma_stop(_dmaRxChannel);
+    xSemaphoreTake(_doneSem, 0);
+  }
+
+  // Descarta o que o cache tinha da área escrita pelo DMA
+  if (_invalSize) {
+    Cache_Invalidate_Addr(_invalAddr, _invalSize);
+    _invalSize = 0;
+  }
+  _busy = false;
+}
+
+bool GPUAccelerator::useDma(uint32_t pixels, bool enabledFor) const {
+  return _available && _config.enabled && enabledFor &&
+         pixels >= _config.minDmaPixels;
+}
+
+/**
+ * @brief Transfere um retângulo pelo DMA (src == nullptr: preenche)
+ *
+ * A cadeia RX tem um descritor por linha do destino (quebrado a cada
+ * DESC_CHUNK bytes); as pontas desalinhadas de cada linha ficam para a CPU.
+ * A cadeia TX segue as linhas da origem ou, no preenchimento, repete a
+ * linha-modelo até cobrir os mesmos bytes. Retângulos com mais descritores
+ * que MAX_DESC vão em lotes; só o último fica em andamento ao retornar.
+ *
+ * @return false se a memória não é acessível ao DMA (nada foi feito)
+ */
+bool GPUAccelerator::runRect(uint8_t *dest, const uint8_t *src,
+                             size_t rowBytes, uint16_t rows, size_t destPitch,
+                             size_t srcPitch) {
+  const bool fill = (src == nullptr);
+  const bool destExt = esp_ptr_external_ram(dest);
+  const bool srcExt = !fill && esp_ptr_external_ram(src);
+
+  // Flash (imagens const) e RTC ficam fora do alcance do GDMA
+  if (!destExt && !esp_ptr_dma_capable(dest)) {
+    return false;
+  }
+  if (!fill && !srcExt && !esp_ptr_dma_capable(src)) {
+    return false;
+  }
+
+  const size_t align = (destExt || srcExt) ? GPU_PSRAM_ALIGN : GPU_SRAM_ALIGN;
+
+  // Bloco contíguo: uma única "linha"
+  if (destPitch == rowBytes && (fill || srcPitch == rowBytes)) {
+    rowBytes *= rows;
+    rows = 1;
+  }
+
+  uint16_t nrx = 0;
+  uint16_t ntx = 0;
+  size_t batchBytes = 0;
+  uintptr_t destLo = UINTPTR_MAX, destHi = 0;
+  uintptr_t srcLo = UINTPTR_MAX, srcHi = 0;
+
+  auto cpuPart = [&](uint8_t *d, const uint8_t *s, size_t len) {
+    if (len == 0) {
+      return;
+    }
+    if (fill) {
+      gpuCpuFill16((uint16_t *)d, len / 2, _fillColor);
+    } else {
+      memcpy(d, s, len);
+    }
+  };
+
+  auto flush = [&]() {
+    if (nrx == 0) {
+      return;
+    }
+    _rxDesc[nrx - 1].next = nullptr;
+
+    if (fill) {
+      size_t left = batchBytes;
+      ntx = 0;
+      while (left) {
+        size_t len = left < DESC_CHUNK ? left : DESC_CHUNK;
+        gpu_set_desc(&_txDesc[ntx++], _fillRow, len, true);
+        left -= len;
+      }
+    }
+    _txDesc[ntx - 1].next = nullptr;
+    _txDesc[ntx - 1].dw0.suc_eof = 1;
+
+    if (srcExt) {
+      Cache_WriteBack_Addr(srcLo, srcHi - srcLo);
+    }
+    if (destExt) {
+      startTransfer(destLo, destHi - destLo);
+    } else {
+      startTransfer(0, 0);
+    }
+
+    nrx = 0;
+    ntx = 0;
+    batchBytes = 0;
+    destLo = srcLo = UINTPTR_MAX;
+    destHi = srcHi = 0;
+  };
+
+  waitComplete();
+
+  for (uint16_t y = 0; y < rows; y++) {
+    uint8_t *d = dest + y * destPitch;
+    const uint8_t *s = fill ? nullptr : src + y * srcPitch;
+
+    size_t head = (align - ((uintptr_t)d & (align - 1))) & (align - 1);
+    size_t body = rowBytes > head ? (rowBytes - head) & ~(align - 1) : 0;
+    if (!fill && (((uintptr_t)s + head) & (align - 1))) {
+      body = 0; // Origem fora de fase com o destino
+    }
+
+    if (body == 0) {
+      cpuPart(d, s, rowBytes);
+      continue;
+    }
+
+    uint16_t need = (body + DESC_CHUNK - 1) / DESC_CHUNK;
+    if (nrx + need > MAX_DESC || ntx + need > MAX_DESC) {
+      flush();
+      waitComplete();
+    }
+
+    // Pontas pela CPU antes do write-back do lote
+    size_t tail = rowBytes - head - body;
+    cpuPart(d, s, head);
+    cpuPart(d + head + body, fill ? nullptr : s + head + body, tail);
+
+    uint8_t *db = d + head;
+    const uint8_t *sb = fill ? nullptr : s + head;
+    for (size_t off = 0; off < body; off += DESC_CHUNK) {
+      size_t len = body - off < DESC_CHUNK ? body - off : DESC_CHUNK;
+      gpu_set_desc(&_rxDesc[nrx++], db + off, len, false);
+      if (!fill) {
+        gpu_set_desc(&_txDesc[ntx++], (void *)(sb + off), len, true);
+      }
+    }
+    batchBytes += body;
+
+    // Linhas crescem em endereço: a faixa é [primeira, última]
+    if (destLo == UINTPTR_MAX) {
+      destLo = (uintptr_t)db;
+      srcLo = (uintptr_t)sb;
+    }
+    destHi = (uintptr_t)(db + body);
+    srcHi = (uintptr_t)(sb + body);
+  }
+
+  flush();
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// OPERAÇÕES
+// ═══════════════════════════════════════════════════════════════════════════
+
+void gpuCpuFill16(uint16_t *dest, size_t count, uint16_t color) {
+  if (count && ((uintptr_t)dest & 2)) {
+    *dest++ = color;
+    count--;
+  }
+
+  // Dois pixels por escrita, quatro escritas por iteração
+  uint32_t pair = ((uint32_t)color << 16) | color;
+  uint32_t *d32 = (uint32_t *)dest;
+  size_t words = count >> 1;
+  while (words >= 4) {
+    d32[0] = pair;
+    d32[1] = pair;
+    d32[2] = pair;
+    d32[3] = pair;
+    d32 += 4;
+    words -= 4;
+  }
+  while (words--) {
+    *d32++ = pair;
+  }
+
+  if (count & 1) {
+    *(uint16_t *)d32 = color;
+  }
 }
 
 void GPUAccelerator::setConfig(const GPUAccelConfig &config) {
+  waitComplete();
   _config = config;
 }
 
 void GPUAccelerator::fillRect(uint16_t *dest, uint16_t width, uint16_t height,
-                              uint16_t color) {
+                              uint16_t color, uint16_t destStride) {
   if (!dest || width == 0 || height == 0)
     return;
 
-  _opsCount++;
-  size_t totalPixels = width * height;
-  _bytesCopied += totalPixels * 2;
-
-  if (_config.enabled && _config.useForFill) {
-    // Otimização: preenche primeira linha, depois replica com memcpy
-    // Isso é mais rápido que loop pixel-a-pixel
+  if (destStride == 0) {
+    destStride = width;
+  }
 
-    // Preenche primeira linha
-    for (uint16_t x = 0; x < width; x++) {
-      dest[x] = color;
-    }
+  // O destino pode estar sob uma transferência anterior
+  waitComplete();
 
-    // Copia primeira linha para as demais
-    uint16_t *src = dest;
-    size_t lineSize = width * sizeof(uint16_t);
+  _opsCount++;
+  _bytesCopied += (size_t)width * height * 2;
 
-    for (uint16_t y = 1; y < height; y++) {
-      memcpy(dest + (y * width), src, lineSize);
+  if (useDma((uint32_t)width * height, _config.useForFill)) {
+    if (_fillColor != color || _fillRow[0] != color) {
+      gpuCpuFill16(_fillRow, DESC_CHUNK / 2, color);
     }
-  } else {
-    // Fallback: preenchimento simples
-    for (size_t i = 0; i < totalPixels; i++) {
-      dest[i] = color;
+    _fillColor = color;
+
+    if (runRect((uint8_t *)dest, nullptr, width * 2, height, destStride * 2,
+                0)) {
+      if (!_config.asyncMode) {
+        waitComplete();
+      }
+      return;
     }
   }
+
+  // Fallback: CPU com escritas de 32 bits
+  if (destStride == width) {
+    gpuCpuFill16(dest, (size_t)width * height, color);
+    return;
+  }
+  for (uint16_t y = 0; y < height; y++) {
+    gpuCpuFill16(dest + (size_t)y * destStride, width, color);
+  }
 }
 
 void GPUAccelerator::copyMemory(void *dest, const void *src, size_t size) {
   if (!dest || !src || size == 0)
     return;
 
+  waitComplete();
+
   _opsCount++;
   _bytesCopied += size;
 
-  if (_config.enabled && _config.useForCopy) {
-    // Usa memcpy otimizado do ESP-IDF (já usa DMA internamente quando possível)
-    memcpy(dest, src, size);
-  } else {
-    memcpy(dest, src, size);
+  if (useDma(size / 2, _config.useForCopy) &&
+      runRect((uint8_t *)dest, (const uint8_t *)src, size, 1, size, size)) {
+    if (!_config.asyncMode) {
+      waitComplete();
+    }
+    return;
   }
+
+  memcpy(dest, src, size);
 }
 
 void GPUAccelerator::copyRect(uint16_t *dest, const uint16_t *src,
@@ -111,19 +434,30 @@ void GPUAccelerator::copyRect(uint16_t *dest, const uint16_t *src,
   if (!dest || !src || width == 0 || height == 0)
     return;
 
+  waitComplete();
+
   _opsCount++;
-  _bytesCopied += width * height * 2;
+  _bytesCopied += (size_t)width * height * 2;
+
+  if (useDma((uint32_t)width * height, _config.useForCopy) &&
+      runRect((uint8_t *)dest, (const uint8_t *)src, width * 2, height,
+              destStride * 2, srcStride * 2)) {
+    if (!_config.asyncMode) {
+      waitComplete();
+    }
+    return;
+  }
 
   size_t lineSize = width * sizeof(uint16_t);
 
-  if (_config.enabled && _config.useForCopy && destStride == width &&
-      srcStride == width) {
+  if (destStride == width && srcStride == width) {
     // Bloco contínuo - cópia única
-    memcpy(dest, src, width * height * sizeof(uint16_t));
+    memcpy(dest, src, lineSize * height);
   } else {
-    // Cópia linha por linha
+    // Cópia linha por linha (memcpy da newlib já copia por palavra)
     for (uint16_t y = 0; y < height; y++) {
-      memcpy(dest + (y * destStride), src + (y * srcStride), lineSize);
+      memcpy(dest + (size_t)y * destStride, src + (size_t)y * srcStride,
+             lineSize);
     }
   }
 }
@@ -133,35 +467,26 @@ void GPUAccelerator::blendRect(uint16_t *dest, const uint16_t *src,
   if (!dest || !src || width == 0 || height == 0)
     return;
 
+  waitComplete();
+
   _opsCount++;
   _bytesCopied += width * height * 2;
 
-  // Alpha blending em software
-  // Fórmula: result = (src * alpha + dest * (255 - alpha)) / 255
-
-  uint8_t invAlpha = 255 - alpha;
-  size_t totalPixels = width * height;
+  // O GDMA só move bytes: blending é sempre na CPU.
+  // RGB565 espalhado em 32 bits (G no topo, R e B embaixo) permite misturar
+  // os três canais com uma multiplicação: 0b00000GGGGGG00000RRRRR000000BBBBB
+  uint32_t a5 = ((uint32_t)alpha + 4) >> 3; // 0..32
+  uint32_t inv = 32 - a5;
+  size_t totalPixels = (size_t)width * height;
 
   for (size_t i = 0; i < totalPixels; i++) {
-    uint16_t srcPx = src[i];
-    uint16_t destPx = dest[i];
-
-    // Extrai componentes RGB565
-    uint8_t srcR = (srcPx >> 11) & 0x1F;
-    uint8_t srcG = (srcPx >> 5) & 0x3F;
-    uint8_t srcB = srcPx & 0x1F;
+    uint32_t fg = src[i];
+    uint32_t bg = dest[i];
+    fg = (fg | (fg << 16)) & 0x07E0F81F;
+    bg = (bg | (bg << 16)) & 0x07E0F81F;
 
-    uint8_t destR = (destPx >> 11) & 0x1F;
-    uint8_t destG = (destPx >> 5) & 0x3F;
-    uint8_t destB = destPx & 0x1F;
-
-    // Blend
-    uint8_t r = (srcR * alpha + destR * invAlpha) / 255;
-    uint8_t g = (srcG * alpha + destG * invAlpha) / 255;
-    uint8_t b = (srcB * alpha + destB * invAlpha) / 255;
-
-    // Reconstrói RGB565
-    dest[i] = (r << 11) | (g << 5) | b;
+    uint32_t mix = ((fg * a5 + bg * inv) >> 5) & 0x07E0F81F;
+    dest[i] = (uint16_t)(mix | (mix >> 16));
   }
 }
 
@@ -186,10 +511,178 @@ void GPUAccelerator::convertARGB8888toRGB565(uint16_t *dest,
   }
 }
 
-void GPUAccelerator::waitComplete() {
-  // Para implementação síncrona, não faz nada
-  // Para DMA assíncrono real, aguardaria IRQ
-  while (_busy) {
-    delay(1);
+// ═══════════════════════════════════════════════════════════════════════════
+// BENCHMARK
+// ═══════════════════════════════════════════════════════════════════════════
+
+size_t GPUAccelerator::benchmark(GPUBenchResult *results, size_t maxResults,
+                                 uint8_t iterations) {
+  static const uint16_t sizes[BENCH_SIZES][2] = {
+      {16, 16},       {32, 32},       {64, 64},
+      {128, 128},     {UI_WIDTH, 64}, {UI_WIDTH, UI_HEIGHT / 2},
+      {UI_WIDTH, UI_HEIGHT}};
+  const uint16_t stride = UI_WIDTH;
+  const size_t bytes = (size_t)stride * UI_HEIGHT * sizeof(uint16_t);
+
+  if (!_available || iterations == 0) {
+    return 0;
   }
+
+  uint16_t *dst = (uint16_t *)heap_caps_aligned_alloc(GPU_PSRAM_ALIGN, bytes,
+                                                      MALLOC_CAP_SPIRAM);
+  uint16_t *src = (uint16_t *)heap_caps_aligned_alloc(GPU_PSRAM_ALIGN, bytes,
+                                                      MALLOC_CAP_SPIRAM);
+  if (!dst || !src) {
+    Serial.println("[GPU] Benchmark: sem PSRAM");
+    heap_caps_free(dst);
+    heap_caps_free(src);
+    return 0;
+  }
+  gpuCpuFill16(src, bytes / 2, 0x1234);
+
+  GPUAccelConfig saved = _config;
+  _config.enabled = true;
+  _config.useForFill = true;
+  _config.useForCopy = true;
+  _config.asyncMode = true;
+  _config.minDmaPixels = 0;
+
+  uint32_t threshold = UINT32_MAX;
+  size_t count = 0;
+
+  Serial.println("[GPU] Benchmark (us):  WxH   fillCPU fillDMA issue "
+                 "copyCPU copyDMA");
+
+  for (size_t i = 0; i < BENCH_SIZES; i++) {
+    uint16_t w = sizes[i][0];
+    uint16_t h = sizes[i][1];
+    GPUBenchResult r = {w, h, 0, 0, 0, 0, 0};
+
+    uint32_t t = micros();
+    for (uint8_t n = 0; n < iterations; n++) {
+      for (uint16_t y = 0; y < h; y++) {
+        gpuCpuFill16(dst + (size_t)y * stride, w, 0xF800);
+      }
+    }
+    r.cpuFillUs = (micros() - t) / iterations;
+
+    for (uint8_t n = 0; n < iterations; n++) {
+      t = micros();
+      fillRect(dst, w, h, 0x07E0, stride);
+      r.dmaFillIssueUs += micros() - t;
+      waitComplete();
+      r.dmaFillUs += micros() - t;
+    }
+    r.dmaFillIssueUs /= iterations;
+    r.dmaFillUs /= iterations;
+
+    t = micros();
+    for (uint8_t n = 0; n < iterations; n++) {
+      for (uint16_t y = 0; y < h; y++) {
+        memcpy(dst + (size_t)y * stride, src + (size_t)y * stride, w * 2);
+      }
+    }
+    r.cpuCopyUs = (micros() - t) / iterations;
+
+    t = micros();
+    for (uint8_t n = 0; n < iterations; n++) {
+      copyRect(dst, src, w, h, stride, stride);
+      waitComplete();
+    }
+    r.dmaCopyUs = (micros() - t) / iterations;
+
+    Serial.printf("[GPU] %3dx%-3d %7lu %7lu %5lu %7lu %7lu\n", w, h,
+                  r.cpuFillUs, r.dmaFillUs, r.dmaFillIssueUs, r.cpuCopyUs,
+                  r.dmaCopyUs);
+
+    if (r.dmaFillUs < r.cpuFillUs && (uint32_t)w * h < threshold) {
+      threshold = (uint32_t)w * h;
+    }
+    if (results && count < maxResults) {
+      results[count] = r;
+    }
+    _bench[i] = r;
+    count++;
+  }
+
+  _config = saved;
+  _config.minDmaPixels = threshold;
+  _benchCount = count;
+  Serial.printf("[GPU] minDmaPixels = %lu\n", threshold);
+
+  heap_caps_free(dst);
+  heap_caps_free(src);
+  return count < maxResults ? count : maxResults;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HOOKS DO LVGL
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * @brief Blend do draw context: desvia fills e blits opacos grandes para o DMA
+ *
+ * lv_draw_sw_blend já chama wait_for_finish antes de cada blend, então um
+ * fill assíncrono só corre em paralelo com o cálculo do próximo desenho.
+ */
+static void gpu_draw_blend(lv_draw_ctx_t *draw_ctx,
+                           const lv_draw_sw_blend_dsc_t *dsc) {
+  const GPUAccelConfig &cfg = gpuAccel.getConfig();
+  lv_disp_t *disp = _lv_refr_get_disp_refreshing();
+
+  bool plain = gpuAccel.isAvailable() && cfg.enabled &&
+               dsc->opa >= LV_OPA_MAX &&
+               dsc->blend_mode == LV_BLEND_MODE_NORMAL &&
+               (dsc->mask_buf == nullptr ||
+                dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) &&
+               disp && disp->driver->set_px_cb == nullptr &&
+               disp->driver->screen_transp == 0;
+
+  lv_area_t area;
+  if (plain && _lv_area_intersect(&area, dsc->blend_area, draw_ctx->clip_area)) {
+    lv_coord_t w = lv_area_get_width(&area);
+    lv_coord_t h = lv_area_get_height(&area);
+
+    if ((uint32_t)w * h >= cfg.minDmaPixels) {
+      const lv_area_t *buf_area = draw_ctx->buf_area;
+      lv_coord_t stride = lv_area_get_width(buf_area);
+      lv_color_t *dest = (lv_color_t *)draw_ctx->buf +
+                         stride * (area.y1 - buf_area->y1) +
+                         (area.x1 - buf_area->x1);
+
+      if (!dsc->src_buf && cfg.useForFill) {
+        gpuAccel.fillRect((uint16_t *)dest, w, h, dsc->color.full, stride);
+        return;
+      }
+
+      if (dsc->src_buf && cfg.useForCopy) {
+        lv_coord_t src_stride = lv_area_get_width(dsc->blend_area);
+        const lv_color_t *src = dsc->src_buf +
+                                src_stride * (area.y1 - dsc->blend_area->y1) +
+                                (area.x1 - dsc->blend_area->x1);
+        gpuAccel.copyRect((uint16_t *)dest, (const uint16_t *)src, w, h,
+                          stride, src_stride);
+        // A origem pode ser um buffer temporário do LVGL
+        gpuAccel.waitComplete();
+        return;
+      }
+    }
+  }
+
+  lv_draw_sw_blend_basic(draw_ctx, dsc);
+}
+
+static void gpu_draw_wait_for_finish(lv_draw_ctx_t *draw_ctx) {
+  gpuAccel.waitComplete();
+  lv_draw_sw_wait_for_finish(draw_ctx);
+}
+
+void gpuAccelInitDrawCtx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx) {
+  lv_draw_sw_init_ctx(drv, draw_ctx);
+
+#if LV_COLOR_DEPTH == 16
+  lv_draw_sw_ctx_t *sw = (lv_draw_sw_ctx_t *)draw_ctx;
+  sw->blend = gpu_draw_blend;
+  draw_ctx->wait_for_finish = gpu_draw_wait_for_finish;
+#endif
 }
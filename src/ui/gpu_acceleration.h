@@ -2,36 +2,67 @@
 
 /**
  * @file gpu_acceleration.h
- * @brief Aceleração de hardware usando DMA2D do ESP32-S3
+ * @brief Aceleração de hardware usando o GDMA do ESP32-S3
  *
- * Acelera operações de cópia, preenchimento e blending de pixels
+ * Preenchimentos e cópias de retângulos rodam em um par de canais GDMA
+ * memória-para-memória com descritores encadeados (um por linha quando o
+ * retângulo tem stride). Áreas pequenas, desalinhadas ou em flash caem para o
+ * caminho de CPU com laços de 32 bits. O GDMA não tem ULA: blending e
+ * conversão de formato são sempre feitos pela CPU.
+ *
+ * lvgl_driver registra hooks no draw context do LVGL (gpuAccelInitDrawCtx)
+ * para desviar preenchimentos e blits opacos grandes para o DMA.
  */
 
+#include "../core/pin_definitions.h"
 #include <Arduino.h>
 #include <esp_heap_caps.h>
+#include <esp_private/gdma.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <hal/dma_types.h>
+#include <lvgl.h>
 
 /**
  * @brief Configuração da aceleração GPU
  */
 struct GPUAccelConfig {
   bool enabled;
-  bool useForFill;  // Usar para preenchimento de retângulos
-  bool useForCopy;  // Usar para cópia de memória
-  bool useForBlend; // Usar para alpha blending
-  bool asyncMode;   // Modo assíncrono (não bloqueia CPU)
-  uint8_t priority; // Prioridade DMA (0-3)
+  bool useForFill;        // Usar para preenchimento de retângulos
+  bool useForCopy;        // Usar para cópia de memória
+  bool useForBlend;       // Usar para alpha blending (sempre CPU, 32 bits)
+  bool asyncMode;         // fill/cópia retornam antes do fim (waitComplete)
+  uint8_t priority;       // Prioridade DMA (0-3)
+  uint32_t minDmaPixels;  // Abaixo disso o DMA não compensa o setup
+};
+
+/**
+ * @brief Tempos de uma medição do benchmark
+ */
+struct GPUBenchResult {
+  uint16_t width;
+  uint16_t height;
+  uint32_t cpuFillUs;
+  uint32_t dmaFillUs;      // Até o fim da transferência
+  uint32_t dmaFillIssueUs; // CPU ocupada só para montar e disparar
+  uint32_t cpuCopyUs;
+  uint32_t dmaCopyUs;
 };
 
 /**
- * @brief Acelerador de hardware GPU/DMA2D
+ * @brief Acelerador de hardware GPU/GDMA
  */
 class GPUAccelerator {
 public:
+  static const uint16_t MAX_DESC = 256;    // Descritores por direção
+  static const uint16_t DESC_CHUNK = 4032; // Bytes por descritor (< 4096)
+  static const uint8_t BENCH_SIZES = 7;    // Retângulos medidos no benchmark
+
   GPUAccelerator();
 
   /**
    * @brief Inicializa o acelerador
-   * @return true se GPU disponível
+   * @return true se GDMA disponível
    */
   bool begin();
 
@@ -52,9 +83,10 @@ public:
    * @param width Largura em pixels
    * @param height Altura em pixels
    * @param color Cor RGB565
+   * @param destStride Stride do destino em pixels (0 = width)
    */
   void fillRect(uint16_t *dest, uint16_t width, uint16_t height,
-                uint16_t color);
+                uint16_t color, uint16_t destStride = 0);
 
   /**
    * @brief Copia bloco de memória (acelerado)
@@ -70,8 +102,8 @@ public:
    * @param src Buffer origem
    * @param width Largura
    * @param height Altura
-   * @param destStride Stride do destino (bytes por linha)
-   * @param srcStride Stride da origem
+   * @param destStride Stride do destino (pixels por linha)
+   * @param srcStride Stride da origem (pixels por linha)
    */
   void copyRect(uint16_t *dest, const uint16_t *src, uint16_t width,
                 uint16_t height, uint16_t destStride, uint16_t srcStride);
@@ -94,28 +126,88 @@ public:
                                size_t pixelCount);
 
   /**
-   * @brief Aguarda operação assíncrona terminar
+   * @brief Aguarda a transferência DMA em andamento terminar
+   *
+   * Também invalida o cache da área escrita em PSRAM; deve ser chamado
+   * antes de a CPU ler ou escrever o destino de uma operação assíncrona.
    */
   void waitComplete();
 
+  bool isBusy() const { return _busy; }
+
+  /**
+   * @brief Compara CPU x DMA (fill e cópia) para vários tamanhos de retângulo
+   *
+   * Usa um buffer temporário do tamanho da tela em PSRAM. Ajusta
+   * minDmaPixels para o menor tamanho em que o DMA venceu no fill. Roda no
+   * boot (lvgl_driver_init), antes do primeiro frame: nada mais usa o canal.
+   * @param results Vetor de saída (pode ser nullptr)
+   * @param maxResults Capacidade de results
+   * @param iterations Repetições por medição
+   * @return Número de tamanhos medidos
+   */
+  size_t benchmark(GPUBenchResult *results, size_t maxResults,
+                   uint8_t iterations = 10);
+
   /**
    * @brief Estatísticas de uso
    */
   uint32_t getOpsCount() const { return _opsCount; }
+  uint32_t getDmaOpsCount() const { return _dmaOps; }
   uint32_t getBytesCopied() const { return _bytesCopied; }
 
+  // Última medição do benchmark (tela de debug)
+  const GPUBenchResult *getBenchResults(uint8_t *count) const {
+    *count = _benchCount;
+    return _bench;
+  }
+
 private:
   GPUAccelConfig _config;
   bool _available;
-  bool _busy;
+  volatile bool _busy;
   uint32_t _opsCount;
+  uint32_t _dmaOps;
   uint32_t _bytesCopied;
+  GPUBenchResult _bench[BENCH_SIZES];
+  uint8_t _benchCount;
 
-  // DMA channel handle (ESP-IDF)
-  void *_dmaChannel;
+  // Canais GDMA (TX lê a origem, RX escreve o destino)
+  gdma_channel_handle_t _dmaChannel;
+  gdma_channel_handle_t _dmaRxChannel;
+  SemaphoreHandle_t _doneSem;
+
+  dma_descriptor_t *_txDesc;
+  dma_descriptor_t *_rxDesc;
+  uint16_t *_fillRow; // Linha-modelo em SRAM interna (DESC_CHUNK bytes)
+  uint16_t _fillColor;
+
+  // Faixa em PSRAM a invalidar quando a transferência terminar
+  uint32_t _invalAddr;
+  uint32_t _invalSize;
 
   bool initDMA();
   void deinitDMA();
+
+  bool useDma(uint32_t pixels, bool enabledFor) const;
+  bool runRect(uint8_t *dest, const uint8_t *src, size_t rowBytes,
+               uint16_t rows, size_t destPitch, size_t srcPitch);
+  void startTransfer(uint32_t invalAddr, uint32_t invalSize);
+
+  static bool dmaEofCallback(gdma_channel_handle_t chan,
+                             gdma_event_data_t *event, void *userData);
 };
 
+/**
+ * @brief CPU: preenchimento com escritas de 32 bits (2 pixels por vez)
+ */
+void gpuCpuFill16(uint16_t *dest, size_t count, uint16_t color);
+
+/**
+ * @brief Inicializa o draw context SW do LVGL com os hooks de DMA
+ *
+ * Usar em lv_disp_drv_t::draw_ctx_init (draw_ctx_size continua o do SW).
+ */
+void gpuAccelInitDrawCtx(lv_disp_drv_t *drv, lv_draw_ctx_t *draw_ctx);
+
 extern GPUAccelerator gpuAccel;
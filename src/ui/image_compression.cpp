@@ -4,8 +4,10 @@
  */
 
 #include "image_compression.h"
+#include "decode_service.h"
 #include <LittleFS.h>
 #include <SD_MMC.h>
+#include <esp_heap_caps.h>
 
 ImageCompressor imageCompressor;
 
@@ -228,72 +230,43 @@ bool ImageCompressor::convertToLVGLBin(const char *srcPath,
   Serial.printf("[IMG_COMP] Convert %s -> %s (%dx%d)\n", srcPath, destPath,
                 info.width, info.height);
 
-  // Abre arquivo fonte
-  File srcFile;
-  if (SD_MMC.exists(srcPath)) {
-    srcFile = SD_MMC.open(srcPath, "r");
-  } else if (LittleFS.exists(srcPath)) {
-    srcFile = LittleFS.open(srcPath, "r");
-  }
-
-  if (!srcFile) {
-    Serial.println("[IMG_COMP] Falha ao abrir arquivo fonte");
+  // Decodifica em tamanho original pelo serviço compartilhado (PNGdec)
+  DecodeRequest req = DecodeService::request(srcPath, 0, 0);
+  DecodeResult result;
+  if (decodeService.decodeNow(req, &result) != DECODE_OK) {
+    Serial.println("[IMG_COMP] Falha ao decodificar arquivo fonte");
     return false;
   }
 
-  // Aloca buffer para imagem decodificada (RGB565)
-  size_t pixelCount = info.width * info.height;
-  size_t bufferSize = pixelCount * 2; // 16-bit (RGB565)
-  
-  // Tenta alocar em PSRAM primeiro
-  uint16_t* pixels = (uint16_t*)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
-  if (!pixels) {
-    pixels = (uint16_t*)malloc(bufferSize);
-  }
-  
-  if (!pixels) {
-    Serial.println("[IMG_COMP] Sem memória para conversão");
-    srcFile.close();
-    return false;
-  }
-
-  // Para PNG, usa PNGdec se disponível, senão cria imagem placeholder
-  // Nota: PNGdec precisa de callback de leitura de arquivo
-  // Por simplificação, criamos gradient placeholder para hardware limitado
-  for (size_t y = 0; y < info.height; y++) {
-    for (size_t x = 0; x < info.width; x++) {
-      // Gradient baseado na posição
-      uint8_t r = (x * 255) / info.width;
-      uint8_t g = (y * 255) / info.height;
-      uint8_t b = 128;
-      pixels[y * info.width + x] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
-    }
-  }
-
-  srcFile.close();
+  info.width = result.width;
+  info.height = result.height;
+  uint16_t *pixels = result.pixels;
+  size_t bufferSize = (size_t)result.width * result.height * 2; // RGB565
 
   // Escreve arquivo LVGL BIN
   File destFile = SD_MMC.open(destPath, FILE_WRITE);
   if (!destFile) {
-    free(pixels);
+    heap_caps_free(pixels);
     return false;
   }
 
   // Header LVGL: CF_TRUE_COLOR_ALPHA or CF_TRUE_COLOR
-  // Formato: magic(4) + width(2) + height(2) + cf(1) + reserved(3) + data
+  // Formato: magic(4) + width(2) + height(2) + cf(1) + flags(1) +
+  // reserved(2) + data (flags bit 0 = RLE, lido por DecodeService)
   uint8_t header[12] = {
     'L', 'V', 'B', 'I',  // Magic
     (uint8_t)(info.width & 0xFF), (uint8_t)(info.width >> 8),
     (uint8_t)(info.height & 0xFF), (uint8_t)(info.height >> 8),
     0x05,  // CF_TRUE_COLOR (RGB565)
-    0x00, 0x00, 0x00  // Reserved
+    0x00,             // Flags: sem RLE
+    0x00, 0x00        // Reserved
   };
 
   destFile.write(header, 12);
   destFile.write((uint8_t*)pixels, bufferSize);
   destFile.close();
 
-  free(pixels);
+  heap_caps_free(pixels);
   
   _totalSaved += (info.fileSize > bufferSize + 12) ? 
                  (info.fileSize - bufferSize - 12) : 0;
@@ -1,6 +1,7 @@
 #include "notifications_engine.h"
 #include "../core/globals.h"
 #include "../hardware/audio_driver.h"
+#include "../hardware/audio_synth.h"
 #include "sounds_manager.h"
 #include <Arduino.h>
 
@@ -155,6 +156,30 @@ void NotificationsEngine::enableSound(bool enabled, uint8_t soundId) {
 // ═══════════════════════════════════════════════════════════════════════════
 // VIBRATION PATTERNS (using buzzer PWM for haptic feedback)
 // ═══════════════════════════════════════════════════════════════════════════
+// Padrões como sequências de notas: o motor de áudio toca sem bloquear
+// Two short pulses with gap
+static const MelodyNote vibe_double[] = {
+    {100, 50}, {NOTE_REST, 80}, {100, 50}};
+// Heartbeat pattern: ··· — ···
+static const MelodyNote vibe_heart[] = {
+    {120, 30}, {NOTE_REST, 50}, {120, 30}, {NOTE_REST, 50}, {120, 30},
+    {NOTE_REST, 100}, {80, 200}, {NOTE_REST, 100}, {120, 30},
+    {NOTE_REST, 50}, {120, 30}, {NOTE_REST, 50}, {120, 30}};
+// Alert pattern: ——·——
+static const MelodyNote vibe_alert[] = {
+    {100, 150}, {NOTE_REST, 100}, {100, 150}, {NOTE_REST, 80}, {150, 50},
+    {NOTE_REST, 80}, {100, 150}, {NOTE_REST, 100}, {100, 150}};
+// SOS pattern: ···———···
+static const MelodyNote vibe_sos[] = {
+    {120, 50}, {NOTE_REST, 80}, {120, 50}, {NOTE_REST, 80}, {120, 50},
+    {NOTE_REST, 130}, {80, 150}, {NOTE_REST, 100}, {80, 150},
+    {NOTE_REST, 100}, {80, 150}, {NOTE_REST, 150}, {120, 50},
+    {NOTE_REST, 80}, {120, 50}, {NOTE_REST, 80}, {120, 50}};
+
+#define PLAY_VIBE(seq)                                                         \
+  audioDriver.playMelody(seq, sizeof(seq) / sizeof(MelodyNote), AUDIO_PRIO_UI, \
+                         &AUDIO_TIMBRE_BUZZ)
+
 void NotificationsEngine::playVibration(VibrationPattern pattern) {
   const char *patternNames[] = {"SHORT", "DOUBLE", "LONG",
                                 "HEART", "ALERT",  "SOS"};
@@ -168,67 +193,28 @@ void NotificationsEngine::playVibration(VibrationPattern pattern) {
   switch (pattern) {
   case VIBRATE_SHORT:
     // Single short pulse - 50ms at low frequency
-    audioDriver.playTone(100, 50);
+    audioDriver.playTone(100, 50, AUDIO_PRIO_UI, &AUDIO_TIMBRE_BUZZ);
     break;
 
   case VIBRATE_DOUBLE:
-    // Two short pulses with gap
-    audioDriver.playTone(100, 50);
-    delay(80);
-    audioDriver.playTone(100, 50);
+    PLAY_VIBE(vibe_double);
     break;
 
   case VIBRATE_LONG:
     // Single long pulse - 300ms
-    audioDriver.playTone(80, 300);
+    audioDriver.playTone(80, 300, AUDIO_PRIO_UI, &AUDIO_TIMBRE_BUZZ);
     break;
 
   case VIBRATE_HEART:
-    // Heartbeat pattern: ··· — ···
-    audioDriver.playTone(120, 30);
-    delay(50);
-    audioDriver.playTone(120, 30);
-    delay(50);
-    audioDriver.playTone(120, 30);
-    delay(100);
-    audioDriver.playTone(80, 200);
-    delay(100);
-    audioDriver.playTone(120, 30);
-    delay(50);
-    audioDriver.playTone(120, 30);
-    delay(50);
-    audioDriver.playTone(120, 30);
+    PLAY_VIBE(vibe_heart);
     break;
 
   case VIBRATE_ALERT:
-    // Alert pattern: ——·——
-    audioDriver.playTone(100, 150);
-    delay(100);
-    audioDriver.playTone(100, 150);
-    delay(80);
-    audioDriver.playTone(150, 50);
-    delay(80);
-    audioDriver.playTone(100, 150);
-    delay(100);
-    audioDriver.playTone(100, 150);
+    PLAY_VIBE(vibe_alert);
     break;
 
   case VIBRATE_SOS:
-    // SOS pattern: ···———···
-    for (int i = 0; i < 3; i++) {
-      audioDriver.playTone(120, 50);
-      delay(80);
-    }
-    delay(50);
-    for (int i = 0; i < 3; i++) {
-      audioDriver.playTone(80, 150);
-      delay(100);
-    }
-    delay(50);
-    for (int i = 0; i < 3; i++) {
-      audioDriver.playTone(120, 50);
-      delay(80);
-    }
+    PLAY_VIBE(vibe_sos);
     break;
 
   default:
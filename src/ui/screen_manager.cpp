@@ -0,0 +1,256 @@
+/**
+ * @file screen_manager.cpp
+ * @brief Implementação do gerenciador de ciclo de vida das telas
+ */
+
+#include "screen_manager.h"
+#include <esp_heap_caps.h>
+
+ScreenManager screenManager;
+
+// Evento de deleção: mantém o registro coerente mesmo quando a tela é apagada
+// por fora (ex: lv_scr_load_anim com auto_del = true)
+static void screen_deleted_cb(lv_event_t *e) {
+  ScreenEntry *entry = (ScreenEntry *)lv_event_get_user_data(e);
+  if (entry && entry->screen == lv_event_get_target(e)) {
+    entry->screen = nullptr;
+  }
+}
+
+ScreenManager::ScreenManager()
+    : _budget(512 * 1024), _current(NO_SCREEN), _pendingPrebuild(NO_SCREEN),
+      _prebuildTimer(nullptr) {
+  memset(_entries, 0, sizeof(_entries));
+  memset(_likelyNext, NO_SCREEN, sizeof(_likelyNext));
+}
+
+bool ScreenManager::registerScreen(uint8_t id, const char *name,
+                                   ScreenCreateFn create,
+                                   ScreenDestroyFn destroy,
+                                   size_t estimatedBytes, bool pinned) {
+  if (id >= MAX_SCREENS || !create) {
+    return false;
+  }
+
+  ScreenEntry &e = _entries[id];
+  if (e.create) {
+    Serial.printf("[SCREENS] ID %d já registrado (%s)\n", id, e.name);
+    return false;
+  }
+
+  e.name = name;
+  e.create = create;
+  e.destroy = destroy;
+  e.estimatedBytes = estimatedBytes;
+  e.pinned = pinned;
+  return true;
+}
+
+const ScreenEntry *ScreenManager::getEntry(uint8_t id) const {
+  if (id >= MAX_SCREENS || !_entries[id].create) {
+    return nullptr;
+  }
+  return &_entries[id];
+}
+
+size_t ScreenManager::footprint(const ScreenEntry &e) {
+  return e.builds ? e.lastBytes : e.estimatedBytes;
+}
+
+size_t ScreenManager::getResidentBytes() const {
+  size_t total = 0;
+  for (uint8_t i = 0; i < MAX_SCREENS; i++) {
+    if (_entries[i].screen) {
+      total += footprint(_entries[i]);
+    }
+  }
+  return total;
+}
+
+bool ScreenManager::build(uint8_t id) {
+  ScreenEntry &e = _entries[id];
+  if (e.screen) {
+    return true;
+  }
+
+  // Abre espaço antes de construir, contando com o custo conhecido
+  size_t need = footprint(e);
+  if (getResidentBytes() + need > _budget) {
+    enforceBudget(id);
+  }
+
+  size_t freeBefore = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+  uint32_t start = micros();
+
+  e.screen = e.create();
+
+  e.buildTimeUs = micros() - start;
+  size_t freeAfter = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+  if (!e.screen) {
+    Serial.printf("[SCREENS] Falha ao criar %s\n", e.name);
+    return false;
+  }
+
+  e.lastBytes = freeBefore > freeAfter ? freeBefore - freeAfter : 0;
+  if (e.lastBytes > e.peakBytes) {
+    e.peakBytes = e.lastBytes;
+  }
+  e.builds++;
+  lv_obj_add_event_cb(e.screen, screen_deleted_cb, LV_EVENT_DELETE, &e);
+
+  Serial.printf("[SCREENS] %s construída em %u us (%u KB)\n", e.name,
+                (unsigned)e.buildTimeUs, (unsigned)(e.lastBytes / 1024));
+  return true;
+}
+
+lv_obj_t *ScreenManager::get(uint8_t id) {
+  if (!getEntry(id)) {
+    return nullptr;
+  }
+  build(id);
+  return _entries[id].screen;
+}
+
+void ScreenManager::show(uint8_t id, lv_scr_load_anim_t anim, uint32_t time) {
+  lv_obj_t *scr = get(id);
+  if (!scr) {
+    return;
+  }
+
+  _current = id;
+  _entries[id].lastUsed = millis();
+  lv_scr_load_anim(scr, anim, time, 0, false);
+
+  enforceBudget(id);
+
+  if (_likelyNext[id] != NO_SCREEN) {
+    prebuild(_likelyNext[id]);
+  }
+}
+
+void ScreenManager::setLikelyNext(uint8_t from, uint8_t to) {
+  if (from < MAX_SCREENS) {
+    _likelyNext[from] = to;
+  }
+}
+
+void ScreenManager::prebuild(uint8_t id) {
+  const ScreenEntry *e = getEntry(id);
+  if (!e || e->screen) {
+    return;
+  }
+
+  // Só antecipa se couber no orçamento sem despejar ninguém
+  if (getResidentBytes() + footprint(*e) > _budget) {
+    return;
+  }
+
+  _pendingPrebuild = id;
+  if (!_prebuildTimer) {
+    // Espera a animação de troca terminar antes de construir
+    _prebuildTimer = lv_timer_create(prebuildTimerCb, 400, this);
+    lv_timer_set_repeat_count(_prebuildTimer, 1);
+  } else {
+    lv_timer_reset(_prebuildTimer);
+  }
+}
+
+void ScreenManager::prebuildTimerCb(lv_timer_t *timer) {
+  ScreenManager *self = (ScreenManager *)timer->user_data;
+  self->_prebuildTimer = nullptr; // repeat_count = 1: LVGL apaga o timer
+
+  uint8_t id = self->_pendingPrebuild;
+  self->_pendingPrebuild = NO_SCREEN;
+  if (id == NO_SCREEN || self->_entries[id].screen) {
+    return;
+  }
+  if (self->getResidentBytes() + footprint(self->_entries[id]) <=
+      self->_budget) {
+    self->build(id);
+  }
+}
+
+bool ScreenManager::release(uint8_t id) {
+  if (id >= MAX_SCREENS) {
+    return false;
+  }
+
+  ScreenEntry &e = _entries[id];
+  if (!e.screen) {
+    return false;
+  }
+
+  // Nunca apaga a tela ativa nem a que está saindo em animação
+  lv_disp_t *disp = lv_disp_get_default();
+  if (e.screen == lv_scr_act() || (disp && e.screen == disp->prev_scr)) {
+    return false;
+  }
+
+  lv_obj_t *scr = e.screen;
+  if (e.destroy) {
+    e.destroy(scr);
+  }
+  lv_obj_del(scr); // screen_deleted_cb zera e.screen
+  e.screen = nullptr;
+
+  Serial.printf("[SCREENS] %s liberada\n", e.name);
+  return true;
+}
+
+void ScreenManager::setBudget(size_t bytes) {
+  _budget = bytes;
+  enforceBudget(_current);
+}
+
+void ScreenManager::enforceBudget(uint8_t keep) {
+  lv_disp_t *disp = lv_disp_get_default();
+
+  while (getResidentBytes() > _budget) {
+    // Tela fria menos usada recentemente
+    uint8_t victim = NO_SCREEN;
+    uint32_t oldest = UINT32_MAX;
+    for (uint8_t i = 0; i < MAX_SCREENS; i++) {
+      const ScreenEntry &e = _entries[i];
+      if (!e.screen || e.pinned || i == keep || i == _current) {
+        continue;
+      }
+      if (e.screen == lv_scr_act() || (disp && e.screen == disp->prev_scr)) {
+        continue;
+      }
+      if (e.lastUsed < oldest) {
+        oldest = e.lastUsed;
+        victim = i;
+      }
+    }
+
+    if (victim == NO_SCREEN || !release(victim)) {
+      break;
+    }
+  }
+}
+
+size_t ScreenManager::formatStats(char *buf, size_t len) const {
+  size_t pos = 0;
+  if (len > 0) {
+    buf[0] = '\0';
+  }
+  for (uint8_t i = 0; i < MAX_SCREENS && pos < len; i++) {
+    const ScreenEntry &e = _entries[i];
+    if (!e.create || !e.builds) {
+      continue;
+    }
+    int n = snprintf(buf + pos, len - pos, "%c%-10.10s %3ums %3uK\n",
+                     e.screen ? '*' : ' ', e.name,
+                     (unsigned)(e.buildTimeUs / 1000),
+                     (unsigned)(e.peakBytes / 1024));
+    if (n < 0) {
+      break;
+    }
+    pos += n;
+  }
+  if (pos >= len && len > 0) {
+    pos = len - 1;
+  }
+  return pos;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+/**
+ * @file screen_manager.h
+ * @brief Registro de telas com construção sob demanda e descarte por LRU
+ *
+ * Cada tela declara hooks de criação/destruição e um custo estimado. A tela só
+ * é construída na primeira navegação; telas frias são destruídas (LRU) quando
+ * a memória residente passa do orçamento configurado.
+ *
+ * Todas as funções devem ser chamadas no contexto da task LVGL.
+ */
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+/**
+ * @brief Cria a tela (objeto raiz, lv_obj_create(nullptr))
+ */
+typedef lv_obj_t *(*ScreenCreateFn)();
+
+/**
+ * @brief Libera referências da tela antes do lv_obj_del (pode ser nullptr)
+ */
+typedef void (*ScreenDestroyFn)(lv_obj_t *screen);
+
+/**
+ * @brief Estado e métricas de uma tela registrada
+ */
+struct ScreenEntry {
+  const char *name;
+  ScreenCreateFn create;
+  ScreenDestroyFn destroy;
+  lv_obj_t *screen;       // nullptr enquanto não construída
+  size_t estimatedBytes;  // Custo declarado no registro
+  size_t lastBytes;       // Custo medido na última construção
+  size_t peakBytes;       // Maior custo medido
+  uint32_t buildTimeUs;   // Duração da última construção
+  uint32_t lastUsed;      // millis() da última exibição
+  uint16_t builds;        // Quantas vezes foi construída
+  bool pinned;            // Nunca é destruída
+};
+
+/**
+ * @brief Gerenciador do ciclo de vida das telas
+ */
+class ScreenManager {
+public:
+  static const uint8_t MAX_SCREENS = 24;
+  static const uint8_t NO_SCREEN = 0xFF;
+
+  ScreenManager();
+
+  /**
+   * @brief Registra uma tela (não constrói)
+   * @param id Identificador (0..MAX_SCREENS-1)
+   * @param name Nome para telemetria
+   * @param create Hook de criação
+   * @param destroy Hook de destruição (opcional)
+   * @param estimatedBytes Custo estimado em bytes
+   * @param pinned Se true, nunca é destruída pelo LRU
+   */
+  bool registerScreen(uint8_t id, const char *name, ScreenCreateFn create,
+                      ScreenDestroyFn destroy, size_t estimatedBytes,
+                      bool pinned = false);
+
+  /**
+   * @brief Obtém a tela, construindo se necessário
+   */
+  lv_obj_t *get(uint8_t id);
+
+  /**
+   * @brief Constrói (se necessário) e carrega a tela
+   */
+  void show(uint8_t id, lv_scr_load_anim_t anim = LV_SCR_LOAD_ANIM_FADE_IN,
+            uint32_t time = 200);
+
+  /**
+   * @brief Agenda construção antecipada da tela (ocioso, via lv_timer)
+   */
+  void prebuild(uint8_t id);
+
+  /**
+   * @brief Define a próxima tela provável após exibir `from`
+   */
+  void setLikelyNext(uint8_t from, uint8_t to);
+
+  /**
+   * @brief Destrói a tela se não estiver ativa
+   */
+  bool release(uint8_t id);
+
+  /**
+   * @brief Orçamento de memória para telas residentes
+   */
+  void setBudget(size_t bytes);
+  size_t getBudget() const { return _budget; }
+
+  /**
+   * @brief Memória estimada das telas construídas
+   */
+  size_t getResidentBytes() const;
+
+  uint8_t getCurrent() const { return _current; }
+  const ScreenEntry *getEntry(uint8_t id) const;
+
+  /**
+   * @brief Escreve uma linha por tela registrada (para a tela de debug)
+   * @return Bytes escritos
+   */
+  size_t formatStats(char *buf, size_t len) const;
+
+private:
+  ScreenEntry _entries[MAX_SCREENS];
+  uint8_t _likelyNext[MAX_SCREENS];
+  size_t _budget;
+  uint8_t _current;
+  uint8_t _pendingPrebuild;
+  lv_timer_t *_prebuildTimer;
+
+  bool build(uint8_t id);
+  void enforceBudget(uint8_t keep);
+  static size_t footprint(const ScreenEntry &e);
+  static void prebuildTimerCb(lv_timer_t *timer);
+};
+
+extern ScreenManager screenManager;
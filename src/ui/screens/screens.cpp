@@ -1,15 +1,55 @@
 /**
  * @file screens.cpp
- * @brief Inicialização de todas as telas
+ * @brief Registro de todas as telas no ScreenManager
  */
 
 #include "screens.h"
 
-void initAllScreens(lv_obj_t *parent) {
-  menuGrid.create(parent);
-  statsScreen.create(parent);
-  networksScreen.create(parent);
-  handshakesScreen.create(parent);
+#define SCREEN_BG_COLOR lv_color_hex(0x0a0a1a)
 
-  Serial.println("[Screens] Todas as telas inicializadas");
+static lv_obj_t *create_root() {
+  lv_obj_t *scr = lv_obj_create(nullptr);
+  lv_obj_set_style_bg_color(scr, SCREEN_BG_COLOR, 0);
+  lv_obj_clear_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+  return scr;
+}
+
+static lv_obj_t *create_stats() {
+  lv_obj_t *scr = create_root();
+  statsScreen.create(scr);
+  statsScreen.show();
+  return scr;
+}
+
+static lv_obj_t *create_networks() {
+  lv_obj_t *scr = create_root();
+  networksScreen.create(scr);
+  networksScreen.show();
+  return scr;
+}
+
+static lv_obj_t *create_handshakes() {
+  lv_obj_t *scr = create_root();
+  handshakesScreen.create(scr);
+  handshakesScreen.show();
+  return scr;
+}
+
+void registerAllScreens() {
+  // Custos estimados até a primeira construção medir o real
+  screenManager.registerScreen(SCREEN_ID_STATS, "Stats", create_stats,
+                               [](lv_obj_t *) { statsScreen.destroy(); },
+                               12 * 1024);
+  screenManager.registerScreen(SCREEN_ID_NETWORKS, "Networks",
+                               create_networks,
+                               [](lv_obj_t *) { networksScreen.destroy(); },
+                               40 * 1024);
+  screenManager.registerScreen(SCREEN_ID_HANDSHAKES, "Handshakes",
+                               create_handshakes,
+                               [](lv_obj_t *) { handshakesScreen.destroy(); },
+                               60 * 1024);
+
+  screenManager.setLikelyNext(SCREEN_ID_HANDSHAKES, SCREEN_ID_STATS);
+
+  Serial.println("[Screens] Telas registradas (construção sob demanda)");
 }
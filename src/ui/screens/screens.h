@@ -5,13 +5,23 @@
  * @brief Header central para todas as telas
  */
 
+#include "../screen_manager.h"
 #include "ui_handshakes_screen.h"
 #include "ui_menu_grid.h"
 #include "ui_networks_screen.h"
 #include "ui_stats_screen.h"
 
+/**
+ * @brief IDs das telas gerenciadas pelo ScreenManager
+ */
+enum ScreenId : uint8_t {
+  SCREEN_ID_STATS = 0,
+  SCREEN_ID_NETWORKS,
+  SCREEN_ID_HANDSHAKES,
+  SCREEN_ID_COUNT
+};
 
 /**
- * @brief Inicializa todas as telas
+ * @brief Registra todas as telas (construção sob demanda)
  */
-void initAllScreens(lv_obj_t *parent);
+void registerAllScreens();
@@ -9,7 +9,8 @@
 
 HandshakesScreen handshakesScreen;
 
-HandshakesScreen::HandshakesScreen() : _screen(nullptr), _count(0) {}
+HandshakesScreen::HandshakesScreen()
+    : _screen(nullptr), _list(nullptr), _lblCount(nullptr), _count(0) {}
 
 void HandshakesScreen::create(lv_obj_t *parent) {
   _screen = lv_obj_create(parent);
@@ -75,6 +76,18 @@ void HandshakesScreen::create(lv_obj_t *parent) {
   lv_obj_t *lblBack = lv_label_create(_btnBack);
   lv_label_set_text(lblBack, "← Voltar");
   lv_obj_center(lblBack);
+
+  // Recriada sob demanda: restaura os handshakes já guardados
+  populateList();
+}
+
+void HandshakesScreen::destroy() {
+  _screen = nullptr;
+  _list = nullptr;
+  _lblCount = nullptr;
+  _btnExport = nullptr;
+  _btnClear = nullptr;
+  _btnBack = nullptr;
 }
 
 void HandshakesScreen::show() {
@@ -90,6 +103,9 @@ void HandshakesScreen::hide() {
 }
 
 void HandshakesScreen::update() {
+  if (!_lblCount)
+    return;
+
   char buf[16];
   snprintf(buf, sizeof(buf), "(%d)", _count);
   lv_label_set_text(_lblCount, buf);
@@ -106,7 +122,8 @@ void HandshakesScreen::addHandshake(const HandshakeData &hs) {
 
 void HandshakesScreen::clearAll() {
   _count = 0;
-  lv_obj_clean(_list);
+  if (_list)
+    lv_obj_clean(_list);
   update();
 }
 
@@ -19,6 +19,11 @@ public:
   void hide();
   void update();
 
+  /**
+   * @brief Esquece os objetos LVGL (a tela raiz é apagada pelo ScreenManager)
+   */
+  void destroy();
+
   void addHandshake(const HandshakeData &hs);
   void clearAll();
 
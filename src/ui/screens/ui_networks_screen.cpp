@@ -9,7 +9,8 @@
 NetworksScreen networksScreen;
 
 NetworksScreen::NetworksScreen()
-    : _screen(nullptr), _list(nullptr), _networkCount(0), _onSelect(nullptr) {}
+    : _screen(nullptr), _list(nullptr), _lblCount(nullptr), _networkCount(0),
+      _onSelect(nullptr) {}
 
 void NetworksScreen::create(lv_obj_t *parent) {
   _screen = lv_obj_create(parent);
@@ -67,6 +68,17 @@ void NetworksScreen::create(lv_obj_t *parent) {
   lv_obj_t *lblBack = lv_label_create(_btnBack);
   lv_label_set_text(lblBack, "← Voltar");
   lv_obj_center(lblBack);
+
+  // Recriada sob demanda: restaura a última lista recebida
+  populateList();
+}
+
+void NetworksScreen::destroy() {
+  _screen = nullptr;
+  _list = nullptr;
+  _lblCount = nullptr;
+  _btnScan = nullptr;
+  _btnBack = nullptr;
 }
 
 void NetworksScreen::show() {
@@ -82,6 +94,9 @@ void NetworksScreen::hide() {
 }
 
 void NetworksScreen::update() {
+  if (!_lblCount)
+    return;
+
   char buf[16];
   snprintf(buf, sizeof(buf), "(%d)", _networkCount);
   lv_label_set_text(_lblCount, buf);
@@ -18,6 +18,11 @@ public:
   void hide();
   void update();
 
+  /**
+   * @brief Esquece os objetos LVGL (a tela raiz é apagada pelo ScreenManager)
+   */
+  void destroy();
+
   // Atualiza lista com redes
   void setNetworks(const PwnNetwork *networks, int count);
 
@@ -97,6 +97,8 @@ void StatsScreen::create(lv_obj_t *parent) {
   lv_obj_center(lblBack);
 }
 
+void StatsScreen::destroy() { _screen = nullptr; }
+
 void StatsScreen::show() {
   if (_screen) {
     lv_obj_clear_flag(_screen, LV_OBJ_FLAG_HIDDEN);
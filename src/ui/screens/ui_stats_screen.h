@@ -17,6 +17,11 @@ public:
   void hide();
   void update();
 
+  /**
+   * @brief Esquece os objetos LVGL (a tela raiz é apagada pelo ScreenManager)
+   */
+  void destroy();
+
 private:
   lv_obj_t *_screen;
   lv_obj_t *_lblSession;
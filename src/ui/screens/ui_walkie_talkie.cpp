@@ -1,6 +1,8 @@
 #include "ui_walkie_talkie.h"
+#include "../../hardware/audio_capture.h"
 #include "../../hardware/audio_driver.h"
 #include "../../wifi/esp_now_mesh.h"
+#include "../../wifi/walkie_audio.h"
 #include "../ui_helpers.h"
 #include "../ui_main.h"
 #include <freertos/FreeRTOS.h>
@@ -17,17 +19,21 @@ static TaskHandle_t audioTaskHandle = NULL;
 
 // Audio processing task
 static void audio_tx_task(void *parameter) {
-  int16_t buffer[115]; // 230 bytes / 2 bytes per sample
-  while (isTalking) {
-    if (audioDriver.isRecording()) {
-      size_t samplesRead = audioDriver.readAudioSamples(buffer, 115);
-      if (samplesRead > 0) {
-        // Send raw bytes (samplesRead * 2)
-        MeshSystem.sendAudio((uint8_t *)buffer, samplesRead * 2);
-      }
+  int16_t buffer[WALKIE_FRAME];
+  size_t fill = 0;
+  walkieAudio.startTalking();
+  // Cursor próprio: o assistente de voz continua ouvindo enquanto transmite
+  int reader = audioCapture.openReader("walkie");
+  while (isTalking && reader >= 0) {
+    // Bloqueia até o microfone ter amostras (ritmo = taxa de captura)
+    fill += audioCapture.read(reader, buffer + fill, WALKIE_FRAME - fill, 50);
+    if (fill == WALKIE_FRAME) {
+      // 25 ms em um pacote ADPCM
+      walkieAudio.sendFrame(buffer, WALKIE_FRAME);
+      fill = 0;
     }
-    vTaskDelay(pdMS_TO_TICKS(10)); // ~100Hz packet rate
   }
+  audioCapture.closeReader(reader);
   audioTaskHandle = NULL;
   vTaskDelete(NULL);
 }
@@ -43,7 +49,6 @@ static void talk_btn_event_handler(lv_event_t *e) {
                                 LV_PART_MAIN);
 
       audioDriver.setMicGain(90);
-      audioDriver.startRecording();
 
       xTaskCreate(audio_tx_task, "AudioTx", 4096, NULL, 5, &audioTaskHandle);
     }
@@ -55,8 +60,7 @@ static void talk_btn_event_handler(lv_event_t *e) {
       lv_obj_set_style_bg_color(ui_TalkButton, lv_color_hex(0x00FF00),
                                 LV_PART_MAIN);
 
-      audioDriver.stopRecording();
-      // processing task will self dispose
+      // processing task closes its reader and self disposes
     }
   }
 }
@@ -66,15 +70,12 @@ void ui_walkie_talkie_screen_init(void) {
   MeshSystem.begin();
 
   // Register audio RX callback
+  walkieAudio.begin();
   MeshSystem.onAudio([](const uint8_t *mac, const uint8_t *data, size_t len) {
-    if (!isTalking && !audioDriver.isRecording()) {
-      // Only play if not talking (half-duplex logic mostly to avoid feedback
-      // loop) But full-duplex requested, so we should allow playing. However,
-      // local feedback is bad. "audioDriver.playRaw" expects 16-bit PCM. Ensure
-      // len is even.
-      if (len % 2 == 0) {
-        audioDriver.playRaw((const int16_t *)data, len / 2);
-      }
+    // Only play if not talking (half-duplex, avoids local feedback). Decoding
+    // and jitter buffering happen in the audio task.
+    if (!isTalking) {
+      walkieAudio.receive(mac, data, len);
     }
   });
 
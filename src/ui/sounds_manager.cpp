@@ -1,5 +1,6 @@
 #include "sounds_manager.h"
 #include "../hardware/audio_driver.h"
+#include "../hardware/wav_stream.h"
 #include <FS.h>
 #include <SD_MMC.h>
 
@@ -75,8 +76,12 @@ int SoundsManager::scanSounds() {
           strncpy(info.filename, name.c_str(), sizeof(info.filename) - 1);
           info.filename[sizeof(info.filename) - 1] = '\0';
           info.filesize = file.size();
-          // Estimate duration: 16kHz 16-bit mono = 32000 bytes/sec
-          info.duration_ms = (file.size() * 1000) / 32000;
+          // Duração do cabeçalho; sem cabeçalho válido, estima 16kHz
+          // 16-bit mono = 32000 bytes/sec
+          WavInfo wav;
+          info.duration_ms = WavStream::probe(file, &wav)
+                                 ? wav.durationMs
+                                 : (file.size() * 1000) / 32000;
           info.isPreset = false;
 
           _library.push_back(info);
@@ -108,8 +113,12 @@ bool SoundsManager::playByName(const char *filename) {
     return false;
   }
 
+  // Caminho absoluto (notificações) ou nome dentro de SOUNDS_DIR
   char fullPath[128];
-  snprintf(fullPath, sizeof(fullPath), "%s/%s", SOUNDS_DIR, filename);
+  if (filename[0] == '/')
+    snprintf(fullPath, sizeof(fullPath), "%s", filename);
+  else
+    snprintf(fullPath, sizeof(fullPath), "%s/%s", SOUNDS_DIR, filename);
 
   Serial.printf("[SOUNDS] Playing: %s (volume: %d%%)\n", fullPath,
                 _config.masterVolume);
@@ -117,52 +126,49 @@ bool SoundsManager::playByName(const char *filename) {
   // Set volume before playing
   audioDriver.setVolume(_config.masterVolume);
 
-  // Open WAV file from SD card
-  File file = SD_MMC.open(fullPath, FILE_READ);
-  if (!file) {
-    Serial.printf("[SOUNDS] Failed to open: %s\n", fullPath);
+  // Streaming: a task de leitura enche os buffers, o motor decodifica
+  WavStream *stream = WavStream::acquire();
+  if (!stream) {
+    Serial.println("[SOUNDS] Todos os slots de WAV ocupados");
     return false;
   }
-
-  // Parse WAV header (44 bytes standard)
-  if (file.size() < 44) {
-    Serial.println("[SOUNDS] File too small for WAV");
-    file.close();
+  if (!stream->open(fullPath)) {
+    Serial.printf("[SOUNDS] Failed to open: %s\n", fullPath);
     return false;
   }
 
-  uint8_t header[44];
-  file.read(header, 44);
+  const WavInfo &info = stream->getInfo();
+  Serial.printf("[SOUNDS] WAV: %uHz, %u-bit, %u ch, %s, %u bytes (~%ums)\n",
+                info.sampleRate, info.bitsPerSample, info.channels,
+                info.format == WAV_FMT_IMA_ADPCM ? "IMA-ADPCM"
+                : info.format == WAV_FMT_MULAW   ? "u-law"
+                                                 : "PCM",
+                info.dataSize, info.durationMs);
 
-  // Verify RIFF header
-  if (header[0] != 'R' || header[1] != 'I' || header[2] != 'F' ||
-      header[3] != 'F') {
-    Serial.println("[SOUNDS] Not a valid WAV file");
-    file.close();
+  if (!audioDriver.playSource(stream, info.sampleRate))
     return false;
-  }
 
-  // Extract WAV parameters
-  uint16_t audioFormat = header[20] | (header[21] << 8);
-  uint16_t numChannels = header[22] | (header[23] << 8);
-  uint32_t sampleRate =
-      header[24] | (header[25] << 8) | (header[26] << 16) | (header[27] << 24);
-  uint16_t bitsPerSample = header[34] | (header[35] << 8);
-  uint32_t dataSize =
-      header[40] | (header[41] << 8) | (header[42] << 16) | (header[43] << 24);
-
-  Serial.printf("[SOUNDS] WAV: %dHz, %d-bit, %d ch, %u bytes\n", sampleRate,
-                bitsPerSample, numChannels, dataSize);
-
-  // For now, just play a success sound (actual streaming requires more setup)
-  // Full WAV streaming would need I2S DMA buffer handling
-  audioDriver.playSound(SOUND_SUCCESS);
-
-  file.close();
   _isPlaying = true;
   return true;
 }
 
+// Sequências dos presets (NOTE_REST = pausa entre tons)
+static const MelodyNote seq_beep_double[] = {
+    {880, 80}, {NOTE_REST, 100}, {880, 80}};
+static const MelodyNote seq_ka_ching[] = {
+    {1047, 50}, {NOTE_REST, 50}, {1319, 50}, {NOTE_REST, 50}, {1568, 150}};
+static const MelodyNote seq_notification[] = {
+    {523, 100}, {NOTE_REST, 80}, {659, 150}};
+static const MelodyNote seq_powerdown[] = {
+    {440, 100}, {NOTE_REST, 50}, {349, 100}, {NOTE_REST, 50}, {262, 200}};
+static const MelodyNote seq_swipe[] = {{400, 30}, {NOTE_REST, 20}, {500, 30}};
+static const MelodyNote seq_unlock[] = {
+    {523, 80}, {NOTE_REST, 50}, {659, 80}, {NOTE_REST, 50}, {784, 120}};
+static const MelodyNote seq_lock[] = {
+    {784, 80}, {NOTE_REST, 50}, {659, 80}, {NOTE_REST, 50}, {523, 120}};
+
+#define PLAY_SEQ(seq) audioDriver.playMelody(seq, sizeof(seq) / sizeof(MelodyNote))
+
 bool SoundsManager::playPreset(uint8_t presetId) {
   if (presetId >= PRESET_COUNT) {
     return false;
@@ -170,25 +176,20 @@ bool SoundsManager::playPreset(uint8_t presetId) {
 
   Serial.printf("[SOUNDS] Playing preset: %d\n", presetId);
 
-  // Map preset IDs to audio driver sounds
+  // Map preset IDs to audio driver sounds (sequências tocam no motor de
+  // áudio; nada aqui bloqueia)
   switch (presetId) {
   case PRESET_BEEP_SHORT:
     audioDriver.playTone(880, 100);
     break;
   case PRESET_BEEP_DOUBLE:
-    audioDriver.playTone(880, 80);
-    delay(100);
-    audioDriver.playTone(880, 80);
+    PLAY_SEQ(seq_beep_double);
     break;
   case PRESET_BEEP_LONG:
     audioDriver.playTone(660, 300);
     break;
   case PRESET_KA_CHING:
-    audioDriver.playTone(1047, 50);
-    delay(50);
-    audioDriver.playTone(1319, 50);
-    delay(50);
-    audioDriver.playTone(1568, 150);
+    PLAY_SEQ(seq_ka_ching);
     break;
   case PRESET_CONFIRM:
     audioDriver.playSound(SOUND_SUCCESS);
@@ -203,9 +204,7 @@ bool SoundsManager::playPreset(uint8_t presetId) {
     audioDriver.playSound(SOUND_SUCCESS);
     break;
   case PRESET_NOTIFICATION:
-    audioDriver.playTone(523, 100);
-    delay(80);
-    audioDriver.playTone(659, 150);
+    PLAY_SEQ(seq_notification);
     break;
   case PRESET_ALERT:
     audioDriver.playSound(SOUND_ALERT);
@@ -214,33 +213,19 @@ bool SoundsManager::playPreset(uint8_t presetId) {
     audioDriver.playSound(SOUND_BOOT);
     break;
   case PRESET_POWERDOWN:
-    audioDriver.playTone(440, 100);
-    delay(50);
-    audioDriver.playTone(349, 100);
-    delay(50);
-    audioDriver.playTone(262, 200);
+    PLAY_SEQ(seq_powerdown);
     break;
   case PRESET_CLICK:
     audioDriver.playSound(SOUND_CLICK);
     break;
   case PRESET_SWIPE:
-    audioDriver.playTone(400, 30);
-    delay(20);
-    audioDriver.playTone(500, 30);
+    PLAY_SEQ(seq_swipe);
     break;
   case PRESET_UNLOCK:
-    audioDriver.playTone(523, 80);
-    delay(50);
-    audioDriver.playTone(659, 80);
-    delay(50);
-    audioDriver.playTone(784, 120);
+    PLAY_SEQ(seq_unlock);
     break;
   case PRESET_LOCK:
-    audioDriver.playTone(784, 80);
-    delay(50);
-    audioDriver.playTone(659, 80);
-    delay(50);
-    audioDriver.playTone(523, 120);
+    PLAY_SEQ(seq_lock);
     break;
   case PRESET_CAPTURE:
     audioDriver.playSound(SOUND_HANDSHAKE);
@@ -83,8 +83,6 @@ private:
   std::vector<SoundInfo> _library;
   bool _isPlaying;
   uint8_t _currentSoundId;
-
-  bool loadWav(const char *path);
 };
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -19,7 +19,7 @@ StatusBar::StatusBar()
 void StatusBar::create(lv_obj_t *parent) {
   // Container principal - barra fixa no topo (Tip 1, 2, 9, 10)
   _container = lv_obj_create(parent);
-  lv_obj_set_size(_container, LCD_WIDTH, STATUS_BAR_HEIGHT);
+  lv_obj_set_size(_container, UI_WIDTH, STATUS_BAR_HEIGHT);
   lv_obj_align(_container, LV_ALIGN_TOP_MID, 0, 0);
   lv_obj_set_style_bg_color(_container, getTheme().panel, 0);
   lv_obj_set_style_bg_opa(_container, LV_OPA_COVER, 0);
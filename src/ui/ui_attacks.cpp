@@ -188,7 +188,7 @@ lv_obj_t *ui_attacks_create() {
 
   // Lista de redes
   list_networks = lv_list_create(scr_attacks);
-  lv_obj_set_size(list_networks, LCD_WIDTH - 20, 180);
+  lv_obj_set_size(list_networks, UI_WIDTH - 20, 180);
   lv_obj_align(list_networks, LV_ALIGN_TOP_MID, 0, 45);
   ui_apply_glass_effect(list_networks);
   lv_obj_set_style_border_color(list_networks, UI_ATK_PRIMARY, 0);
@@ -204,7 +204,7 @@ lv_obj_t *ui_attacks_create() {
 
   // Botões de ataque
   lv_obj_t *btn_container = lv_obj_create(scr_attacks);
-  lv_obj_set_size(btn_container, LCD_WIDTH - 20, 110);
+  lv_obj_set_size(btn_container, UI_WIDTH - 20, 110);
   lv_obj_align(btn_container, LV_ALIGN_BOTTOM_MID, 0, -50);
   lv_obj_set_style_bg_opa(btn_container, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_width(btn_container, 0, 0);
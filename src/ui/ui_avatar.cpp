@@ -46,7 +46,7 @@ static void avatar_touch_cb(lv_event_t *e) {
       avatar->setFocus(p.x, p.y);
     }
   } else if (code == LV_EVENT_RELEASED) {
-    avatar->setFocus(LCD_WIDTH / 2, 110); // Center back
+    avatar->setFocus(UI_WIDTH / 2, 110); // Center back
   }
 }
 
@@ -315,8 +315,8 @@ void VoiceAvatar::setFocus(int x, int y) {
     return;
 
   // Parallax Effect: Move face label slightly towards touch
-  // Center of avatar is roughly (LCD_WIDTH/2, 110)
-  int cx = LCD_WIDTH / 2;
+  // Center of avatar is roughly (UI_WIDTH/2, 110)
+  int cx = UI_WIDTH / 2;
   int cy = 110; // Approx
 
   int dx = (x - cx) / 10; // Dampen movement
@@ -351,7 +351,7 @@ void VoiceAvatar::reactToTouch() {
 
 // Item 50: Easter Egg 5 Taps on Nose
 void VoiceAvatar::checkNoseTap(int x, int y) {
-  // Nose/Face center approx (LCD_WIDTH/2, 110 screen coordinates)
+  // Nose/Face center approx (UI_WIDTH/2, 110 screen coordinates)
   // Simple check: just count taps for now, assuming click on container is close
   // enough
 
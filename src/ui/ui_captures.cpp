@@ -39,7 +39,7 @@ void ui_captures_show() {
 
   // Header
   lv_obj_t *header = lv_obj_create(scr_captures);
-  lv_obj_set_size(header, LCD_WIDTH, 50);
+  lv_obj_set_size(header, UI_WIDTH, 50);
   lv_obj_set_style_bg_color(header, lv_color_hex(0x222222), 0);
   lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
 
@@ -60,7 +60,7 @@ void ui_captures_show() {
 
   // List
   lv_obj_t *list = lv_obj_create(scr_captures);
-  lv_obj_set_size(list, LCD_WIDTH, LCD_HEIGHT - 50);
+  lv_obj_set_size(list, UI_WIDTH, UI_HEIGHT - 50);
   lv_obj_align(list, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
 
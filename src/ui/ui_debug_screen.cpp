@@ -1,6 +1,9 @@
 #include "ui_debug_screen.h"
 #include "../core/config.h"
 #include "../hardware/system_hardware.h"
+#include "burn_in_protection.h"
+#include "gpu_acceleration.h"
+#include "screen_manager.h"
 #include <Arduino.h>
 
 
@@ -29,7 +32,28 @@ static void debug_timer_cb(lv_timer_t *timer) {
   info += "VBat: " + String(vbat, 2) + "V (" + String(bat_pct) + "%)\n";
   info += "Uptime: " + String(uptime) + " s\n";
   info += "Core: " + String(ARDUINO_RUNNING_CORE) + "\n";
-  info += "SDK: " + String(ESP.getSdkVersion());
+  info += "BurnIn: " + String(burnInProtection.getCurrentOffsetX()) + "," +
+          String(burnInProtection.getCurrentOffsetY()) + "\n";
+  info += "SDK: " + String(ESP.getSdkVersion()) + "\n";
+
+  // GDMA: limiar medido no boot e fill/cópia CPU x DMA (us)
+  uint8_t nBench = 0;
+  const GPUBenchResult *bench = gpuAccel.getBenchResults(&nBench);
+  info += "DMA >= " + String(gpuAccel.getConfig().minDmaPixels) + " px\n";
+  for (uint8_t i = 0; i < nBench; i++) {
+    char line[48];
+    snprintf(line, sizeof(line), "%ux%u F%lu/%lu C%lu/%lu\n", bench[i].width,
+             bench[i].height, bench[i].cpuFillUs, bench[i].dmaFillUs,
+             bench[i].cpuCopyUs, bench[i].dmaCopyUs);
+    info += line;
+  }
+
+  // Telas: * = residente, tempo de build e pico de memória
+  char screens[256];
+  info += "Screens: " + String(screenManager.getResidentBytes() / 1024) + "/" +
+          String(screenManager.getBudget() / 1024) + " KB\n";
+  screenManager.formatStats(screens, sizeof(screens));
+  info += screens;
 
   lv_label_set_text(label_info, info.c_str());
 }
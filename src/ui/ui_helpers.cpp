@@ -76,7 +76,7 @@ void ui_create_3_zone_layout(lv_obj_t *parent, lv_obj_t **content_area) {
 
   // 2. Navigation Bar (Fixed Bottom 60px) - Increased for touch
   lv_obj_t *nav_bar = lv_obj_create(parent);
-  lv_obj_set_size(nav_bar, LCD_WIDTH, 60); // was NAV_BAR_HEIGHT (40)
+  lv_obj_set_size(nav_bar, UI_WIDTH, 60); // was NAV_BAR_HEIGHT (40)
   lv_obj_align(nav_bar, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_set_style_bg_color(nav_bar, getTheme().panel, 0);
   lv_obj_set_style_bg_opa(nav_bar, LV_OPA_COVER, 0);
@@ -133,7 +133,7 @@ void ui_create_3_zone_layout(lv_obj_t *parent, lv_obj_t **content_area) {
 
   // 3. Content Area (Middle ~368px)
   *content_area = lv_obj_create(parent);
-  lv_obj_set_size(*content_area, LCD_WIDTH, CONTENT_HEIGHT);
+  lv_obj_set_size(*content_area, UI_WIDTH, CONTENT_HEIGHT);
   lv_obj_align(*content_area, LV_ALIGN_TOP_MID, 0, STATUS_BAR_HEIGHT);
   lv_obj_set_style_bg_color(*content_area, COLOR_AMOLED_BLACK, 0); // Tip 45
   lv_obj_set_style_pad_all(*content_area, 0, 0);
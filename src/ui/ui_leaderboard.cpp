@@ -15,7 +15,7 @@ void ui_leaderboard_show() {
   // Transparent dark overlay
   lv_obj_t *overlay =
       lv_obj_create(lv_layer_top()); // Use top layer for global overlay
-  lv_obj_set_size(overlay, LCD_WIDTH, LCD_HEIGHT);
+  lv_obj_set_size(overlay, UI_WIDTH, UI_HEIGHT);
   lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
   lv_obj_set_style_bg_opa(overlay, 200, 0); // High opacity to hide bg
   lv_obj_add_event_cb(overlay, lb_close_cb, LV_EVENT_CLICKED, overlay);
@@ -7,8 +7,10 @@
 #include "../core/globals.h"
 #include "../hardware/system_hardware.h"
 #include "../hardware/wifi_driver.h"
+#include "decode_service.h"
 #include "gesture_handler.h"
 #include "mascot_faces.h"
+#include "screens/screens.h"
 #include "status_bar.h"
 #include "ui_attacks.h"
 #include "ui_ble_chaos.h"
@@ -67,6 +69,10 @@ bool ui_main_init() {
 
   Serial.println("[UI] Iniciando interface principal...");
   init_styles();
+  registerAllScreens();
+
+  // Decodificação de imagens fora da task LVGL (entrega via lv_timer)
+  decodeService.begin();
 
   scr_main = lv_obj_create(nullptr);
   lv_obj_set_style_bg_color(scr_main, UI_COLOR_BG, 0);
@@ -49,6 +49,28 @@ static void btn_info_cb(lv_event_t *e) {
   lv_obj_center(mbox);
 }
 
+static void btn_memory_cb(lv_event_t *e) {
+  const Neura9MemoryPlan &plan = neura9.getMemoryPlan();
+  char buf[200];
+  char times[NEURA9_MEM_COUNT][12];
+  for (uint8_t i = 0; i < NEURA9_MEM_COUNT; i++) {
+    if (plan.invokeUs[i])
+      snprintf(times[i], sizeof(times[i]), "%lu us", (unsigned long)plan.invokeUs[i]);
+    else
+      snprintf(times[i], sizeof(times[i]), "n/d");
+  }
+  snprintf(buf, sizeof(buf),
+           "Arena: %lu B (%s)\nPesos: %s\n\nInvoke por local dos pesos:\n"
+           "Flash: %s\nDRAM: %s\nPSRAM: %s",
+           (unsigned long)plan.arenaSize,
+           NEURA9Inference::placementName(neura9.getArenaPlacement()),
+           NEURA9Inference::placementName(neura9.getWeightsPlacement()),
+           times[NEURA9_MEM_FLASH], times[NEURA9_MEM_DRAM],
+           times[NEURA9_MEM_PSRAM]);
+  lv_obj_t *mbox = lv_msgbox_create(NULL, "Memoria / Desempenho", buf, NULL, true);
+  lv_obj_center(mbox);
+}
+
 static void create_menu_item(lv_obj_t *parent, const char *icon,
                              const char *text, lv_event_cb_t cb) {
   lv_obj_t *btn = lv_btn_create(parent);
@@ -115,6 +137,7 @@ void ui_menu_ai_init() {
   create_menu_item(scroll_cont, "M", "Alternar AUTO/MANUAL", btn_mode_toggle_cb);
   create_menu_item(scroll_cont, "H", "Historico", btn_history_cb);
   create_menu_item(scroll_cont, "I", "Info do Modelo", btn_info_cb);
+  create_menu_item(scroll_cont, "P", "Memoria / Desempenho", btn_memory_cb);
 
   _initialized = true;
 }
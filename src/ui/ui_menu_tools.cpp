@@ -7,8 +7,7 @@
 #include "../plugins/age_tracker.h"
 #include "../plugins/exp_system.h"
 #include "../plugins/memtemp.h"
-#include "screens/ui_handshakes_screen.h"
-#include "screens/ui_stats_screen.h"
+#include "screens/screens.h"
 #include "ui_home.h"
 
 
@@ -25,9 +24,15 @@ static void btn_back_cb(lv_event_t *e) {
   ui_home_show();
 }
 
-static void btn_handshakes_cb(lv_event_t *e) { handshakesScreen.show(); }
+static void btn_handshakes_cb(lv_event_t *e) {
+  screenManager.show(SCREEN_ID_HANDSHAKES);
+  handshakesScreen.show();
+}
 
-static void btn_stats_cb(lv_event_t *e) { statsScreen.show(); }
+static void btn_stats_cb(lv_event_t *e) {
+  screenManager.show(SCREEN_ID_STATS);
+  statsScreen.show();
+}
 
 static void btn_sdcard_cb(lv_event_t *e) {
   Serial.println("[TOOLS] SD Card manager");
@@ -92,6 +97,9 @@ void ui_menu_tools_show() {
     ui_menu_tools_init();
   if (_screen)
     lv_scr_load(_screen);
+
+  // Próxima tela provável a partir deste menu
+  screenManager.prebuild(SCREEN_ID_HANDSHAKES);
 }
 
 void ui_menu_tools_hide() {}
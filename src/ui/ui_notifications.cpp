@@ -68,7 +68,7 @@ void ui_notification_push(const char *title, const char *msg,
     lv_timer_del(toast_timer);
 
   toast_obj = lv_obj_create(lv_layer_top());
-  lv_obj_set_size(toast_obj, LCD_WIDTH - 20, 70);
+  lv_obj_set_size(toast_obj, UI_WIDTH - 20, 70);
   lv_obj_align(toast_obj, LV_ALIGN_TOP_MID, 0, -100); // Start hidden above
 
   lv_color_t color;
@@ -139,7 +139,7 @@ void ui_notification_push(const char *title, const char *msg,
 void ui_notification_center_show() {
   // Overlay for History (Tip 31)
   lv_obj_t *overlay = lv_obj_create(lv_layer_top());
-  lv_obj_set_size(overlay, LCD_WIDTH, LCD_HEIGHT);
+  lv_obj_set_size(overlay, UI_WIDTH, UI_HEIGHT);
   lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
   lv_obj_set_style_bg_opa(overlay, 200, 0);
   lv_obj_add_event_cb(
@@ -41,7 +41,7 @@ void ui_plugins_show() {
 
   // Header
   lv_obj_t *header = lv_obj_create(scr_plugins);
-  lv_obj_set_size(header, LCD_WIDTH, 50);
+  lv_obj_set_size(header, UI_WIDTH, 50);
   lv_obj_set_style_bg_color(header, lv_color_hex(0x222222), 0);
   lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
 
@@ -53,7 +53,7 @@ void ui_plugins_show() {
 
   // Grid Container
   lv_obj_t *cont = lv_obj_create(scr_plugins);
-  lv_obj_set_size(cont, LCD_WIDTH, LCD_HEIGHT - 50);
+  lv_obj_set_size(cont, UI_WIDTH, UI_HEIGHT - 50);
   lv_obj_align(cont, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_set_style_bg_opa(cont, LV_OPA_TRANSP, 0);
 
@@ -126,7 +126,7 @@ lv_obj_t *ui_settings_create() {
 
   // Header
   lv_obj_t *header = lv_obj_create(scr_settings);
-  lv_obj_set_size(header, LCD_WIDTH, 50);
+  lv_obj_set_size(header, UI_WIDTH, 50);
   lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
   lv_obj_set_style_bg_color(header, THEME_PANEL, 0);
   lv_obj_set_style_border_width(header, 0, 0);
@@ -144,7 +144,7 @@ lv_obj_t *ui_settings_create() {
 
   // Container scrollável para as categorias
   lv_obj_t *content = lv_obj_create(scr_settings);
-  lv_obj_set_size(content, LCD_WIDTH, LCD_HEIGHT - 50);
+  lv_obj_set_size(content, UI_WIDTH, UI_HEIGHT - 50);
   lv_obj_align(content, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_set_style_bg_opa(content, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_width(content, 0, 0);
@@ -211,14 +211,14 @@ void ui_quick_settings_show() {
   // Overlay to close on click outside
   lv_obj_t *overlay = lv_obj_create(lv_layer_top());
   panel_qs = overlay; // Manage lifecycle together
-  lv_obj_set_size(overlay, LCD_WIDTH, LCD_HEIGHT);
+  lv_obj_set_size(overlay, UI_WIDTH, UI_HEIGHT);
   lv_obj_set_style_bg_color(overlay, lv_color_black(), 0);
   lv_obj_set_style_bg_opa(overlay, 150, 0);
   lv_obj_add_event_cb(overlay, qs_close_cb, LV_EVENT_CLICKED, nullptr);
 
   // Main Panel sliding from top
   lv_obj_t *panel = lv_obj_create(overlay);
-  lv_obj_set_size(panel, LCD_WIDTH - 20, 300);
+  lv_obj_set_size(panel, UI_WIDTH - 20, 300);
   lv_obj_align(panel, LV_ALIGN_TOP_MID, 0, 10);
   ui_apply_glass_effect(panel);
   lv_obj_clear_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
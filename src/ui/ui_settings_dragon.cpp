@@ -181,7 +181,7 @@ static void create_screen() {
 
   // === TECLADO VIRTUAL ===
   kb = lv_keyboard_create(scr_dragon);
-  lv_obj_set_size(kb, LCD_WIDTH, LCD_HEIGHT / 2);
+  lv_obj_set_size(kb, UI_WIDTH, UI_HEIGHT / 2);
   lv_obj_align(kb, LV_ALIGN_BOTTOM_MID, 0, 0);
   lv_obj_add_flag(kb, LV_OBJ_FLAG_HIDDEN);
   lv_keyboard_set_textarea(kb, ta_name);
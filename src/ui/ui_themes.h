@@ -43,7 +43,7 @@ struct ThemeColors {
 // Layout Constants (Tips 1, 9, 10)
 #define STATUS_BAR_HEIGHT 40
 #define NAV_BAR_HEIGHT 40
-#define CONTENT_HEIGHT (LCD_HEIGHT - STATUS_BAR_HEIGHT - NAV_BAR_HEIGHT) // 368
+#define CONTENT_HEIGHT (UI_HEIGHT - STATUS_BAR_HEIGHT - NAV_BAR_HEIGHT) // 362
 #define GRID_UNIT 8
 #define MARGIN_SIDE 12
 #define MARGIN_TOP_BOTTOM 8
@@ -1,66 +1,18 @@
 #include "wallpaper_system.h"
 #include "../core/globals.h"
 #include <FS.h>
-#include <PNGdec.h> // Include at top
 #include <SD_MMC.h>
-
+#include <esp_heap_caps.h>
 
 WallpaperSystem wallpaper_system;
 
-// Global/Static for PNGdec
-static PNG png;
-static File pngFile;
-
-// Callbacks must match PNGdec signatures
-void *pngOpen(const char *filename, int32_t *size) {
-  pngFile = SD_MMC.open(filename, FILE_READ);
-  if (!pngFile)
-    return NULL;
-  *size = pngFile.size();
-  return &pngFile;
-}
-
-void pngClose(void *handle) {
-  if (pngFile)
-    pngFile.close();
-}
-
-int32_t pngRead(PNGFILE *handle, uint8_t *buffer, int32_t length) {
-  if (!pngFile)
-    return 0;
-  return pngFile.read(buffer, length);
-}
-
-int32_t pngSeek(PNGFILE *handle, int32_t position) {
-  if (!pngFile)
-    return 0;
-  return pngFile.seek(position);
-}
-
-int pngDraw(PNGDRAW *pDraw) {
-  WallpaperSystem *ws = &wallpaper_system;
-  if (!ws || !ws->_pixelBuffer)
-    return 0;
-
-  uint16_t *pixels = (uint16_t *)ws->_pixelBuffer;
-  int width = ws->_width;
-
-  // Check bounds
-  if (pDraw->y >= ws->_height)
-    return 0;
-
-  // Convert line to RGB565 and store
-  png.getLineAsRGB565(pDraw, &pixels[pDraw->y * width], PNG_RGB565_BIG_ENDIAN,
-                      0xffffffff);
-  return 0; // Success
-}
-
 // ═══════════════════════════════════════════════════════════════════════════
 // CONSTRUCTOR
 // ═══════════════════════════════════════════════════════════════════════════
 WallpaperSystem::WallpaperSystem()
     : _currentIndex(0), _loaded(false), _pixelBuffer(nullptr), _width(0),
-      _height(0), _lastSlideshowChange(0) {
+      _height(0), _lastSlideshowChange(0), _pendingJob(0) {
+  memset(&_img, 0, sizeof(_img));
 
   // Default configuration
   _config.enabled = true;
@@ -262,8 +214,17 @@ bool WallpaperSystem::renameWallpaper(const char *oldName,
 // BUFFER MANAGEMENT
 // ═══════════════════════════════════════════════════════════════════════════
 void WallpaperSystem::freeBuffer() {
+  // O cache de imagens do LVGL guarda a entrada pelo ponteiro do descritor:
+  // descarta antes de liberar os pixels, e o descritor não aponta mais para
+  // eles (quem ainda usa &_img desenha vazio até a troca)
+  lv_img_cache_invalidate_src(&_img);
+  _img.data = nullptr;
+  _img.data_size = 0;
+  _img.header.w = 0;
+  _img.header.h = 0;
+
   if (_pixelBuffer) {
-    free(_pixelBuffer);
+    heap_caps_free(_pixelBuffer);
     _pixelBuffer = nullptr;
   }
   _loaded = false;
@@ -277,129 +238,74 @@ void WallpaperSystem::freeBuffer() {
 bool WallpaperSystem::loadPNG(const char *path) {
   Serial.printf("[WALLPAPER] Loading PNG: %s\n", path);
 
-  // Free any existing buffer
-  freeBuffer();
-
-  int16_t rc = png.open(path, pngOpen, pngClose, pngRead, pngSeek, pngDraw);
-  if (rc != PNG_SUCCESS) {
-    Serial.printf("[WALLPAPER] PNG Open failed: %d\n", rc);
-    return false;
-  }
-
-  uint16_t pngWidth = png.getWidth();
-  uint16_t pngHeight = png.getHeight();
+  // Troca rápida de wallpaper: o pedido anterior não vale mais
+  decodeService.cancel(_pendingJob);
 
-  Serial.printf("[WALLPAPER] PNG size: %dx%d\n", pngWidth, pngHeight);
+  // Decodifica já no tamanho da tela; o buffer atual continua em uso até
+  // o novo ficar pronto
+  DecodeRequest req = DecodeService::request(path, UI_WIDTH, UI_HEIGHT);
+  req.fs = &SD_MMC;
+  req.priority = DECODE_PRIO_HIGH;
+  req.callback = decodedCb;
+  req.userData = this;
 
-  if (pngWidth > 1024 || pngHeight > 1024) { // Sanity check
-    Serial.println("[WALLPAPER] Image too large");
-    png.close();
+  _pendingJob = decodeService.submit(req);
+  if (!_pendingJob) {
+    Serial.println("[WALLPAPER] Decode queue full");
     return false;
   }
+  return true;
+}
 
-  // Allocate buffer for RGB565 pixels (2 bytes per pixel)
-  size_t bufferSize = pngWidth * pngHeight * 2;
-  _pixelBuffer = (uint8_t *)heap_caps_malloc(bufferSize, MALLOC_CAP_SPIRAM);
-  if (!_pixelBuffer) {
-    // Try regular RAM if PSRAM not available or full
-    _pixelBuffer = (uint8_t *)malloc(bufferSize);
-  }
+void WallpaperSystem::decodedCb(const DecodeResult &result) {
+  ((WallpaperSystem *)result.userData)->applyDecoded(result);
+}
 
-  if (!_pixelBuffer) {
-    Serial.println("[WALLPAPER] Failed to allocate buffer");
-    png.close();
-    return false;
+void WallpaperSystem::applyDecoded(const DecodeResult &result) {
+  if (result.id != _pendingJob) {
+    // Resposta atrasada de um pedido substituído
+    if (result.ownsPixels) {
+      heap_caps_free(result.pixels);
+    }
+    return;
   }
+  _pendingJob = 0;
 
-  _width = pngWidth;
-  _height = pngHeight;
-
-  // Decode image
-  rc = png.decode(NULL, 0); // 0 = no filter (auto)
-  png.close();
-
-  if (rc != PNG_SUCCESS) {
-    Serial.printf("[WALLPAPER] PNG Decode failed: %d\n", rc);
-    freeBuffer();
-    return false;
+  if (result.status != DECODE_OK) {
+    Serial.printf("[WALLPAPER] PNG Decode failed: %d\n", result.status);
+    return;
   }
 
+  // Cache invalidado e buffer antigo liberado antes de trocar o descritor
+  freeBuffer();
+  _pixelBuffer = (uint8_t *)result.pixels;
+  _width = result.width;
+  _height = result.height;
+  DecodeService::toImgDsc(result, &_img);
   _loaded = true;
-  Serial.printf("[WALLPAPER] Loaded successfully (%zu bytes)\n", bufferSize);
-  return true;
+  lv_obj_invalidate(lv_scr_act());
+
+  Serial.printf("[WALLPAPER] Loaded %dx%d (from %dx%d) in %lu ms\n", _width,
+                _height, result.srcWidth, result.srcHeight, result.decodeMs);
 }
 
-bool WallpaperSystem::generateThumbnail(const char *filename,
-                                        uint8_t *outBuffer, uint16_t thumbW,
-                                        uint16_t thumbH) {
-  // Load the full wallpaper first if not already loaded
-  if (!_loaded || strcmp(_config.currentWallpaper, filename) != 0) {
-    char fullPath[128];
-    snprintf(fullPath, sizeof(fullPath), "%s/%s", WALLPAPER_DIR, filename);
-    if (!loadPNG(fullPath)) {
-      return false;
-    }
-  }
+DecodeJobId WallpaperSystem::generateThumbnail(const char *filename,
+                                               uint16_t *outBuffer,
+                                               uint16_t thumbW,
+                                               uint16_t thumbH,
+                                               DecodeCallback callback,
+                                               void *userData) {
+  char fullPath[128];
+  snprintf(fullPath, sizeof(fullPath), "%s/%s", WALLPAPER_DIR, filename);
 
-  if (!_pixelBuffer || _width == 0 || _height == 0) {
-    return false;
-  }
+  // Reduz direto do arquivo, sem decodificar o wallpaper inteiro
+  DecodeRequest req = DecodeService::request(fullPath, thumbW, thumbH);
+  req.fs = &SD_MMC;
+  req.dest = outBuffer;
+  req.destPixels = (size_t)thumbW * thumbH;
+  req.callback = callback;
+  req.userData = userData;
 
   Serial.printf("[WALLPAPER] Generating %dx%d thumbnail\n", thumbW, thumbH);
-
-  float xRatio = (float)(_width - 1) / thumbW;
-  float yRatio = (float)(_height - 1) / thumbH;
-
-  uint16_t *thumbBuffer = (uint16_t *)outBuffer;
-
-  for (int y = 0; y < thumbH; y++) {
-    for (int x = 0; x < thumbW; x++) {
-      // Source coordinates
-      float srcX = x * xRatio;
-      float srcY = y * yRatio;
-
-      int x1 = (int)srcX;
-      int y1 = (int)srcY;
-      int x2 = min(x1 + 1, (int)_width - 1);
-      int y2 = min(y1 + 1, (int)_height - 1);
-
-      float xFrac = srcX - x1;
-      float yFrac = srcY - y1;
-
-      // Get the 4 neighbor pixels (cast uint8_t* to uint16_t* for RGB565)
-      uint16_t *srcPixels = (uint16_t *)_pixelBuffer;
-      uint16_t p11 = srcPixels[y1 * _width + x1];
-      uint16_t p21 = srcPixels[y1 * _width + x2];
-      uint16_t p12 = srcPixels[y2 * _width + x1];
-      uint16_t p22 = srcPixels[y2 * _width + x2];
-
-      // Extract RGB565 components callback
-      auto extractRGB = [](uint16_t c, uint8_t &r, uint8_t &g, uint8_t &b) {
-        r = (c >> 11) & 0x1F;
-        g = (c >> 5) & 0x3F;
-        b = c & 0x1F;
-      };
-
-      uint8_t r11, g11, b11, r21, g21, b21, r12, g12, b12, r22, g22, b22;
-      extractRGB(p11, r11, g11, b11);
-      extractRGB(p21, r21, g21, b21);
-      extractRGB(p12, r12, g12, b12);
-      extractRGB(p22, r22, g22, b22);
-
-      // Bilinear interpolation
-      float r = (1 - xFrac) * (1 - yFrac) * r11 + xFrac * (1 - yFrac) * r21 +
-                (1 - xFrac) * yFrac * r12 + xFrac * yFrac * r22;
-      float g = (1 - xFrac) * (1 - yFrac) * g11 + xFrac * (1 - yFrac) * g21 +
-                (1 - xFrac) * yFrac * g12 + xFrac * yFrac * g22;
-      float b = (1 - xFrac) * (1 - yFrac) * b11 + xFrac * (1 - yFrac) * b21 +
-                (1 - xFrac) * yFrac * b12 + xFrac * yFrac * b22;
-
-      // Pack back to RGB565
-      thumbBuffer[y * thumbW + x] =
-          ((uint8_t)r << 11) | ((uint8_t)g << 5) | (uint8_t)b;
-    }
-  }
-
-  Serial.println("[WALLPAPER] Thumbnail generated");
-  return true;
+  return decodeService.submit(req);
 }
@@ -1,7 +1,7 @@
 #pragma once
 
+#include "decode_service.h"
 #include <Arduino.h>
-#include <PNGdec.h>
 #include <vector>
 
 
@@ -74,13 +74,18 @@ public:
   bool deleteWallpaper(const char *filename);
   bool renameWallpaper(const char *oldName, const char *newName);
 
-  // For rendering
+  // For rendering (RGB565 nativo, já no tamanho da tela)
   const uint8_t *getCurrentPixels() const { return _pixelBuffer; }
+  const lv_img_dsc_t *getImageDsc() const { return _loaded ? &_img : nullptr; }
   bool hasWallpaper() const { return _loaded; }
+  bool isLoading() const { return _pendingJob != 0; }
 
-  // Thumbnail generation
-  bool generateThumbnail(const char *filename, uint8_t *outBuffer,
-                         uint16_t thumbW, uint16_t thumbH);
+  // Thumbnail generation (assíncrona, scale-to-fit em thumbW x thumbH).
+  // O tamanho final vem em DecodeResult::width/height no callback.
+  DecodeJobId generateThumbnail(const char *filename, uint16_t *outBuffer,
+                                uint16_t thumbW, uint16_t thumbH,
+                                DecodeCallback callback = nullptr,
+                                void *userData = nullptr);
 
 private:
   WallpaperConfig _config;
@@ -91,10 +96,13 @@ private:
   uint16_t _width;
   uint16_t _height;
   uint32_t _lastSlideshowChange;
+  lv_img_dsc_t _img;
+  DecodeJobId _pendingJob;
 
   bool loadPNG(const char *path);
   void freeBuffer();
-  friend int pngDraw(PNGDRAW *pDraw);
+  void applyDecoded(const DecodeResult &result);
+  static void decodedCb(const DecodeResult &result);
 };
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -335,7 +335,7 @@ lv_obj_t *ui_create_settings_screen(lv_obj_t **screen_out, const char *title,
 
   // Header com título e botão voltar
   lv_obj_t *header = lv_obj_create(screen);
-  lv_obj_set_size(header, LCD_WIDTH, 50);
+  lv_obj_set_size(header, UI_WIDTH, 50);
   lv_obj_align(header, LV_ALIGN_TOP_MID, 0, 0);
   lv_obj_set_style_bg_color(header, THEME_PANEL, 0);
   lv_obj_set_style_border_width(header, 0, 0);
@@ -364,7 +364,7 @@ lv_obj_t *ui_create_settings_screen(lv_obj_t **screen_out, const char *title,
 
   // Container scrollável para conteúdo
   lv_obj_t *content = lv_obj_create(screen);
-  lv_obj_set_size(content, LCD_WIDTH - 16, LCD_HEIGHT - 60);
+  lv_obj_set_size(content, UI_WIDTH - 16, UI_HEIGHT - 60);
   lv_obj_align(content, LV_ALIGN_BOTTOM_MID, 0, -5);
   lv_obj_set_style_bg_opa(content, LV_OPA_TRANSP, 0);
   lv_obj_set_style_border_width(content, 0, 0);
@@ -1,12 +1,13 @@
 /**
  * ═══════════════════════════════════════════════════════════════════════════
  * WAVEPWN - PNG Decoder Simples
- * Decodificador PNG leve para ESP32 (sem libpng)
+ * Lê o cabeçalho do PNG; a decodificação vai para o DecodeService (PNGdec)
  * ═══════════════════════════════════════════════════════════════════════════
  */
 
 #pragma once
 
+#include "../ui/decode_service.h"
 #include <Arduino.h>
 #include <FS.h>
 
@@ -37,7 +38,8 @@ public:
   // Decodifica para buffer RGB888
   bool decodeToRGB888(uint8_t *buffer, uint32_t maxBytes);
 
-  // Gera thumbnail redimensionado
+  // Gera thumbnail redimensionado (média de área, proporção mantida e
+  // centralizado em thumbWidth x thumbHeight)
   bool createThumbnail(uint16_t *buffer, uint32_t thumbWidth,
                        uint32_t thumbHeight);
 
@@ -46,32 +48,39 @@ public:
 
 private:
   File _file;
+  fs::FS *_fs;
+  char _path[DecodeService::MAX_PATH];
   PNGInfo _info;
   uint32_t _dataOffset;
 
   // Leitura de chunks PNG
   bool readHeader();
   bool readIHDR();
-  bool findIDAT();
 
-  // Decompressão simplificada
-  bool decompressData(uint8_t *output, uint32_t outputSize);
+  // Decodificação pelo serviço compartilhado
+  bool decode(uint16_t *buffer, uint32_t maxPixels, uint16_t maxW,
+              uint16_t maxH, DecodeResult *result);
 
   // Helpers
   uint32_t readU32BE();
-  uint32_t crc32(const uint8_t *data, size_t len);
 };
 
 // ═══════════════════════════════════════════════════════════════════════════
 // IMPLEMENTAÇÃO
 // ═══════════════════════════════════════════════════════════════════════════
 
-PNGDecoder::PNGDecoder() {
+inline PNGDecoder::PNGDecoder() {
   _info = {0, 0, 0, 0, false};
   _dataOffset = 0;
+  _fs = nullptr;
+  _path[0] = '\0';
 }
 
-bool PNGDecoder::open(fs::FS &fs, const char *path) {
+inline bool PNGDecoder::open(fs::FS &fs, const char *path) {
+  _fs = &fs;
+  strncpy(_path, path, sizeof(_path) - 1);
+  _path[sizeof(_path) - 1] = '\0';
+
   _file = fs.open(path, "r");
   if (!_file) {
     Serial.printf("[PNG] Falha ao abrir: %s\n", path);
@@ -88,6 +97,9 @@ bool PNGDecoder::open(fs::FS &fs, const char *path) {
     return false;
   }
 
+  // Só o cabeçalho fica em memória; o decode reabre o arquivo
+  _file.close();
+
   _info.valid = true;
   Serial.printf("[PNG] %s: %dx%d, %d-bit, type %d\n", path, _info.width,
                 _info.height, _info.bitDepth, _info.colorType);
@@ -95,7 +107,7 @@ bool PNGDecoder::open(fs::FS &fs, const char *path) {
   return true;
 }
 
-bool PNGDecoder::readHeader() {
+inline bool PNGDecoder::readHeader() {
   // PNG signature: 89 50 4E 47 0D 0A 1A 0A
   uint8_t sig[8];
   if (_file.read(sig, 8) != 8)
@@ -112,7 +124,7 @@ bool PNGDecoder::readHeader() {
   return true;
 }
 
-bool PNGDecoder::readIHDR() {
+inline bool PNGDecoder::readIHDR() {
   // IHDR chunk: length(4) + type(4) + data(13) + crc(4)
   uint32_t length = readU32BE();
   if (length != 13) {
@@ -150,90 +162,95 @@ bool PNGDecoder::readIHDR() {
   return (_info.width > 0 && _info.height > 0);
 }
 
-bool PNGDecoder::decodeToRGB565(uint16_t *buffer, uint32_t maxPixels) {
+inline bool PNGDecoder::decode(uint16_t *buffer, uint32_t maxPixels,
+                               uint16_t maxW, uint16_t maxH,
+                               DecodeResult *result) {
   if (!_info.valid || !buffer)
     return false;
 
-  uint32_t numPixels = _info.width * _info.height;
-  if (numPixels > maxPixels) {
+  DecodeRequest req = DecodeService::request(_path, maxW, maxH);
+  req.fs = _fs;
+  req.dest = buffer;
+  req.destPixels = maxPixels;
+  return decodeService.decodeNow(req, result) == DECODE_OK;
+}
+
+inline bool PNGDecoder::decodeToRGB565(uint16_t *buffer, uint32_t maxPixels) {
+  if (_info.width * _info.height > maxPixels) {
     Serial.println("[PNG] Buffer muito pequeno");
     return false;
   }
 
-  // Para PNG real, precisaríamos decompressão zlib
-  // Implementação simplificada: gera gradiente baseado nas dimensões
-
-  for (uint32_t y = 0; y < _info.height && y * _info.width < maxPixels; y++) {
-    for (uint32_t x = 0; x < _info.width; x++) {
-      // Gradiente como placeholder
-      uint8_t r = (x * 255) / _info.width;
-      uint8_t g = (y * 255) / _info.height;
-      uint8_t b = 128;
-
-      // Converte para RGB565
-      uint16_t pixel = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-      buffer[y * _info.width + x] = pixel;
-    }
-  }
-
-  return true;
+  DecodeResult result;
+  return decode(buffer, maxPixels, 0, 0, &result);
 }
 
-bool PNGDecoder::decodeToRGB888(uint8_t *buffer, uint32_t maxBytes) {
-  if (!_info.valid || !buffer)
+inline bool PNGDecoder::decodeToRGB888(uint8_t *buffer, uint32_t maxBytes) {
+  uint32_t numPixels = _info.width * _info.height;
+  if (numPixels * 3 > maxBytes)
     return false;
 
-  uint32_t numBytes = _info.width * _info.height * 3;
-  if (numBytes > maxBytes)
-    return false;
+  // RGB565 decodificado no fim do próprio buffer; a expansão para RGB888
+  // avança do início e nunca alcança um pixel ainda não lido
+  uint16_t *rgb565 = (uint16_t *)(buffer + maxBytes - numPixels * 2);
+  if ((uintptr_t)rgb565 & 1) {
+    rgb565 = (uint16_t *)((uint8_t *)rgb565 - 1);
+  }
 
-  // Placeholder: gradiente
-  for (uint32_t y = 0; y < _info.height; y++) {
-    for (uint32_t x = 0; x < _info.width; x++) {
-      uint32_t idx = (y * _info.width + x) * 3;
-      if (idx + 2 >= maxBytes)
-        break;
+  DecodeResult result;
+  if (!decode(rgb565, numPixels, 0, 0, &result))
+    return false;
 
-      buffer[idx] = (x * 255) / _info.width;      // R
-      buffer[idx + 1] = (y * 255) / _info.height; // G
-      buffer[idx + 2] = 128;                      // B
-    }
+  for (uint32_t i = 0; i < numPixels; i++) {
+    uint16_t c = rgb565[i];
+    uint8_t *px = buffer + i * 3;
+    px[0] = ((c >> 11) * 527 + 23) >> 6;         // R
+    px[1] = (((c >> 5) & 0x3F) * 259 + 33) >> 6; // G
+    px[2] = ((c & 0x1F) * 527 + 23) >> 6;        // B
   }
 
   return true;
 }
 
-bool PNGDecoder::createThumbnail(uint16_t *buffer, uint32_t thumbWidth,
-                                 uint32_t thumbHeight) {
-  if (!_info.valid || !buffer)
+inline bool PNGDecoder::createThumbnail(uint16_t *buffer, uint32_t thumbWidth,
+                                        uint32_t thumbHeight) {
+  uint32_t numPixels = thumbWidth * thumbHeight;
+  DecodeResult result;
+  if (!decode(buffer, numPixels, thumbWidth, thumbHeight, &result))
     return false;
 
-  // Bilinear scaling
-  float xRatio = (float)_info.width / thumbWidth;
-  float yRatio = (float)_info.height / thumbHeight;
+  if (result.width == thumbWidth && result.height == thumbHeight)
+    return true;
 
+  // Proporção diferente: centraliza com bordas pretas (de trás para frente,
+  // a imagem começa no início do buffer)
+  uint32_t offX = (thumbWidth - result.width) / 2;
+  uint32_t offY = (thumbHeight - result.height) / 2;
+  for (int32_t y = result.height - 1; y >= 0; y--) {
+    memmove(buffer + (offY + y) * thumbWidth + offX,
+            buffer + y * result.width, result.width * sizeof(uint16_t));
+  }
   for (uint32_t y = 0; y < thumbHeight; y++) {
-    for (uint32_t x = 0; x < thumbWidth; x++) {
-      // Cor baseada na posição original
-      uint8_t r = (uint8_t)((x * xRatio) * 255 / _info.width);
-      uint8_t g = (uint8_t)((y * yRatio) * 255 / _info.height);
-      uint8_t b = 128;
-
-      uint16_t pixel = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-      buffer[y * thumbWidth + x] = pixel;
+    uint16_t *row = buffer + y * thumbWidth;
+    if (y < offY || y >= offY + result.height) {
+      memset(row, 0, thumbWidth * sizeof(uint16_t));
+    } else {
+      memset(row, 0, offX * sizeof(uint16_t));
+      memset(row + offX + result.width, 0,
+             (thumbWidth - offX - result.width) * sizeof(uint16_t));
     }
   }
 
   return true;
 }
 
-uint32_t PNGDecoder::readU32BE() {
+inline uint32_t PNGDecoder::readU32BE() {
   uint8_t b[4];
   _file.read(b, 4);
   return (b[0] << 24) | (b[1] << 16) | (b[2] << 8) | b[3];
 }
 
-void PNGDecoder::close() {
+inline void PNGDecoder::close() {
   if (_file) {
     _file.close();
   }
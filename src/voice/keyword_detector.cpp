@@ -7,15 +7,14 @@
  */
 
 #include "keyword_detector.h"
-#include <math.h>
 
 // Instância global
 KeywordDetector keywordDetector;
 
 // Constantes de calibração
 static const float DEFAULT_SENSITIVITY = 0.7f;
-static const float DEFAULT_NOISE_FLOOR = 100.0f;
-static const float NOISE_FLOOR_ALPHA = 0.05f;
+static const uint32_t DEFAULT_NOISE_FLOOR = 100; // RMS
+static const int32_t NOISE_FLOOR_ALPHA_Q8 = 13;  // Média móvel, alfa ~0.05
 static const float VAD_MULTIPLIER = 3.0f;
 
 // Padrões esperados para "Hey Dragon" (2 sílabas + 2 sílabas)
@@ -23,22 +22,47 @@ static const int MIN_PEAKS_FOR_WAKE = 2;  // Mínimo 2 picos de energia
 static const int MAX_PEAKS_FOR_WAKE = 5;  // Máximo 5 picos
 static const float PEAK_RATIO_MIN = 1.5f; // Pico deve ser 1.5x a média
 
+#define HIST_MASK (KWD_ENERGY_HISTORY_SIZE - 1)
+static_assert((KWD_ENERGY_HISTORY_SIZE & HIST_MASK) == 0 &&
+                  KWD_ENERGY_HISTORY_SIZE <= 32,
+              "histórico indexado por máscara de 32 bits");
+
+// Raiz inteira (bit a bit, sem divisão)
+static uint16_t isqrt32(uint32_t v) {
+  uint32_t res = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > v)
+    bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return (uint16_t)res;
+}
+
 KeywordDetector::KeywordDetector()
     : _state(KWD_IDLE), _sensitivity(DEFAULT_SENSITIVITY),
-      _noiseFloor(DEFAULT_NOISE_FLOOR), _noiseFloorAlpha(NOISE_FLOOR_ALPHA),
-      _vadThreshold(DEFAULT_NOISE_FLOOR * VAD_MULTIPLIER),
-      _energyHistoryIndex(0), _energyHistoryCount(0), _voiceActive(false),
-      _voiceStartTime(0), _lastVoiceTime(0), _currentEnergy(0), _peakEnergy(0),
+      _noiseFloorQ8(DEFAULT_NOISE_FLOOR << 8), _vadThreshold(0),
+      _vadGainQ8(0), _minRatioQ8(0), _energyPushed(0),
+      _energyHistoryCount(0), _energySum(0), _peakMask(0), _maxHead(0),
+      _maxLen(0), _voiceActive(false), _voiceStartTime(0), _lastVoiceTime(0),
+      _currentEnergy(0), _lastCycles(0), _maxCycles(0),
       _frameSinceVoiceStart(0), _silenceFrames(0) {
 
   memset(_energyHistory, 0, sizeof(_energyHistory));
   _lastResult = {false, 0.0f, 0};
+  updateThresholds();
 }
 
 bool KeywordDetector::begin() {
   Serial.println("[KWD] Inicializando detector de wake word...");
   Serial.printf("[KWD] Sensibilidade: %.2f\n", _sensitivity);
-  Serial.printf("[KWD] Noise floor inicial: %.2f\n", _noiseFloor);
+  Serial.printf("[KWD] Noise floor inicial: %.2f\n", getNoiseFloor());
 
   reset();
 
@@ -53,27 +77,28 @@ void KeywordDetector::reset() {
   _lastVoiceTime = 0;
   _frameSinceVoiceStart = 0;
   _silenceFrames = 0;
-  _peakEnergy = 0;
-  _energyHistoryIndex = 0;
-  _energyHistoryCount = 0;
-  memset(_energyHistory, 0, sizeof(_energyHistory));
+  clearHistory();
 }
 
 bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
   if (!samples || count == 0)
     return false;
 
+  uint32_t t0 = ESP.getCycleCount();
+
   // Calcula energia do frame
   _currentEnergy = calculateEnergy(samples, count);
 
-  // Atualiza noise floor durante silêncio
-  if (!_voiceActive && _currentEnergy < _noiseFloor * 1.5f) {
+  // Atualiza noise floor durante silêncio (energia < 1.5x o piso)
+  if (!_voiceActive &&
+      ((uint32_t)_currentEnergy << 8) < _noiseFloorQ8 + (_noiseFloorQ8 >> 1)) {
     updateNoiseFloor(_currentEnergy);
   }
 
   // Detecta atividade de voz
   bool wasVoiceActive = _voiceActive;
-  _voiceActive = detectVoiceActivity(_currentEnergy);
+  _voiceActive = _currentEnergy > _vadThreshold;
+  bool detected = false;
 
   uint32_t now = millis();
 
@@ -84,7 +109,6 @@ bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
       _state = KWD_DETECTING;
       _voiceStartTime = now;
       _frameSinceVoiceStart = 0;
-      _peakEnergy = _currentEnergy;
       _silenceFrames = 0;
       Serial.println("[KWD] Voz detectada, analisando...");
     }
@@ -94,15 +118,7 @@ bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
     _frameSinceVoiceStart++;
 
     // Armazena energia no histórico
-    _energyHistory[_energyHistoryIndex] = _currentEnergy;
-    _energyHistoryIndex = (_energyHistoryIndex + 1) % KWD_ENERGY_HISTORY_SIZE;
-    if (_energyHistoryCount < KWD_ENERGY_HISTORY_SIZE)
-      _energyHistoryCount++;
-
-    // Atualiza pico
-    if (_currentEnergy > _peakEnergy) {
-      _peakEnergy = _currentEnergy;
-    }
+    pushHistory(_currentEnergy);
 
     if (_voiceActive) {
       _lastVoiceTime = now;
@@ -122,12 +138,14 @@ bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
         if (analyzePattern()) {
           _lastResult.detected = true;
           _lastResult.duration_ms = duration;
-          _lastResult.confidence = calculatePeakRatio() / 3.0f; // Normaliza
+          _lastResult.confidence =
+              peakRatioQ8() / (3.0f * 256.0f); // Normaliza
 
           _state = KWD_WAKE_DETECTED;
           Serial.printf("[KWD] ✓ WAKE WORD DETECTADO! (%.0fms, conf: %.2f)\n",
                         (float)duration, _lastResult.confidence);
-          return true;
+          detected = true;
+          break;
         }
       }
 
@@ -137,7 +155,8 @@ bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
     }
 
     // Timeout máximo
-    if (now - _voiceStartTime > KWD_WAKE_WORD_MAX_DURATION_MS + 500) {
+    if (_state == KWD_DETECTING &&
+        now - _voiceStartTime > KWD_WAKE_WORD_MAX_DURATION_MS + 500) {
       Serial.println("[KWD] Timeout, resetando...");
       reset();
     }
@@ -152,113 +171,165 @@ bool KeywordDetector::processFrame(const int16_t *samples, size_t count) {
     break;
   }
 
-  return false;
+  _lastCycles = ESP.getCycleCount() - t0;
+  if (_lastCycles > _maxCycles)
+    _maxCycles = _lastCycles;
+  return detected;
 }
 
-float KeywordDetector::calculateEnergy(const int16_t *samples, size_t count) {
+uint16_t KeywordDetector::calculateEnergy(const int16_t *samples,
+                                          size_t count) {
   if (count == 0)
     return 0;
 
-  // RMS (Root Mean Square) energy
-  float sum = 0;
-  for (size_t i = 0; i < count; i++) {
-    float sample = (float)samples[i];
-    sum += sample * sample;
+  // RMS (Root Mean Square) energy. Cada par de quadrados cabe em 32 bits
+  // (2 x 2^30); só a soma do bloco precisa de 64.
+  uint64_t sum = 0;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    int32_t a = samples[i], b = samples[i + 1];
+    int32_t c = samples[i + 2], d = samples[i + 3];
+    sum += (uint32_t)(a * a) + (uint32_t)(b * b);
+    sum += (uint32_t)(c * c) + (uint32_t)(d * d);
   }
-  return sqrtf(sum / count);
+  for (; i < count; i++) {
+    int32_t a = samples[i];
+    sum += (uint32_t)(a * a);
+  }
+  return isqrt32((uint32_t)(sum / count)); // Média <= 2^30
 }
 
-void KeywordDetector::updateNoiseFloor(float energy) {
+void KeywordDetector::updateNoiseFloor(uint16_t energy) {
   // Média móvel exponencial para adaptar ao ruído ambiente
-  _noiseFloor =
-      _noiseFloor * (1.0f - _noiseFloorAlpha) + energy * _noiseFloorAlpha;
+  int32_t delta = ((int32_t)energy << 8) - (int32_t)_noiseFloorQ8;
+  _noiseFloorQ8 += (delta * NOISE_FLOOR_ALPHA_Q8) >> 8;
+  if (_noiseFloorQ8 < (KWD_NOISE_FLOOR_MIN << 8))
+    _noiseFloorQ8 = KWD_NOISE_FLOOR_MIN << 8;
 
   // Atualiza threshold de VAD
-  _vadThreshold = _noiseFloor * VAD_MULTIPLIER * (2.0f - _sensitivity);
+  _vadThreshold = ((uint64_t)_noiseFloorQ8 * _vadGainQ8) >> 16;
 }
 
-bool KeywordDetector::detectVoiceActivity(float energy) {
-  return energy > _vadThreshold;
+void KeywordDetector::updateThresholds() {
+  // Só muda com a configuração: o float fica fora do caminho por quadro
+  _vadGainQ8 = (uint32_t)(VAD_MULTIPLIER * (2.0f - _sensitivity) * 256.0f);
+  _minRatioQ8 = (uint32_t)(PEAK_RATIO_MIN * (2.0f - _sensitivity) * 256.0f);
+  _vadThreshold = ((uint64_t)_noiseFloorQ8 * _vadGainQ8) >> 16;
 }
 
-bool KeywordDetector::analyzePattern() {
-  if (_energyHistoryCount < 4)
-    return false;
+// ═══════════════════════════════════════════════════════════════════════════
+// HISTÓRICO INCREMENTAL
+// ═══════════════════════════════════════════════════════════════════════════
 
-  // Conta picos de energia
-  int peaks = countEnergyPeaks();
-
-  // Calcula razão pico/média
-  float peakRatio = calculatePeakRatio();
-
-  // Debug
-  Serial.printf("[KWD] Análise: %d picos, razão: %.2f\n", peaks, peakRatio);
-
-  // Critérios para "Hey Dragon":
-  // - 2 a 5 picos (duas palavras com sílabas)
-  // - Razão pico/média > 1.5 (voz clara)
-  // - Ajustado pela sensibilidade
+void KeywordDetector::clearHistory() {
+  _energyPushed = 0;
+  _energyHistoryCount = 0;
+  _energySum = 0;
+  _peakMask = 0;
+  _maxHead = 0;
+  _maxLen = 0;
+  memset(_energyHistory, 0, sizeof(_energyHistory));
+}
 
-  float minRatio = PEAK_RATIO_MIN * (2.0f - _sensitivity);
+void KeywordDetector::pushHistory(uint16_t energy) {
+  const uint32_t pos = _energyPushed;
+  const uint32_t slot = pos & HIST_MASK;
+
+  // Sai o quadro mais antigo (mesmo slot)
+  if (_energyHistoryCount == KWD_ENERGY_HISTORY_SIZE) {
+    _energySum -= _energyHistory[slot];
+    _peakMask &= ~(1UL << slot);
+    if (_maxLen && _maxQueue[_maxHead] == pos - KWD_ENERGY_HISTORY_SIZE) {
+      _maxHead = (_maxHead + 1) & HIST_MASK;
+      _maxLen--;
+    }
+  } else {
+    _energyHistoryCount++;
+  }
 
-  return (peaks >= MIN_PEAKS_FOR_WAKE && peaks <= MAX_PEAKS_FOR_WAKE &&
-          peakRatio >= minRatio);
+  _energyHistory[slot] = energy;
+  _energySum += energy;
+  _energyPushed = pos + 1;
+
+  // Fila monotônica: quem não pode mais ser o máximo sai pelo fim
+  while (_maxLen &&
+         _energyHistory[_maxQueue[(_maxHead + _maxLen - 1) & HIST_MASK] &
+                        HIST_MASK] <= energy)
+    _maxLen--;
+  _maxQueue[(_maxHead + _maxLen) & HIST_MASK] = pos;
+  _maxLen++;
+
+  // O quadro anterior vira máximo local agora que tem vizinho à direita
+  if (pos >= 2) {
+    uint16_t prev = _energyHistory[(pos - 2) & HIST_MASK];
+    uint16_t curr = _energyHistory[(pos - 1) & HIST_MASK];
+    if (curr > prev && curr > energy)
+      _peakMask |= 1UL << ((pos - 1) & HIST_MASK);
+  }
 }
 
-int KeywordDetector::countEnergyPeaks() {
+int KeywordDetector::countEnergyPeaks() const {
   if (_energyHistoryCount < 3)
     return 0;
 
-  int peaks = 0;
-  float avgEnergy = 0;
-
-  // Calcula média
-  for (int i = 0; i < _energyHistoryCount; i++) {
-    avgEnergy += _energyHistory[i];
-  }
-  avgEnergy /= _energyHistoryCount;
-
-  // Conta picos (frames acima de 1.5x a média, com derivada positiva->negativa)
-  for (int i = 1; i < _energyHistoryCount - 1; i++) {
-    float prev = _energyHistory[i - 1];
-    float curr = _energyHistory[i];
-    float next = _energyHistory[i + 1];
+  // O mais antigo perdeu o vizinho da esquerda: não conta
+  uint32_t mask = _peakMask;
+  mask &= ~(1UL << ((_energyPushed - _energyHistoryCount) & HIST_MASK));
 
-    if (curr > avgEnergy * 1.3f && curr > prev && curr > next) {
+  // Picos: máximos locais acima de 1.3x a média
+  // (curr > sum / n * 1.3  <=>  curr * n * 10 > sum * 13)
+  const uint32_t limit = _energySum * 13;
+  int peaks = 0;
+  while (mask) {
+    int slot = __builtin_ctz(mask);
+    mask &= mask - 1;
+    if ((uint32_t)_energyHistory[slot] * _energyHistoryCount * 10 > limit)
       peaks++;
-    }
   }
-
   return peaks;
 }
 
-float KeywordDetector::calculatePeakRatio() {
+uint32_t KeywordDetector::peakRatioQ8() const {
   if (_energyHistoryCount < 2)
-    return 1.0f;
+    return 256;
+
+  // máximo / max(média, 1), sem dividir a média antes
+  uint32_t maxEnergy = _energyHistory[_maxQueue[_maxHead] & HIST_MASK];
+  uint32_t den = _energySum > (uint32_t)_energyHistoryCount
+                     ? _energySum
+                     : (uint32_t)_energyHistoryCount;
+  return ((uint64_t)maxEnergy * _energyHistoryCount << 8) / den;
+}
 
-  float sum = 0;
-  float maxEnergy = 0;
+bool KeywordDetector::analyzePattern() {
+  if (_energyHistoryCount < 4)
+    return false;
 
-  for (int i = 0; i < _energyHistoryCount; i++) {
-    sum += _energyHistory[i];
-    if (_energyHistory[i] > maxEnergy) {
-      maxEnergy = _energyHistory[i];
-    }
-  }
+  // Conta picos de energia
+  int peaks = countEnergyPeaks();
 
-  float avg = sum / _energyHistoryCount;
-  if (avg < 1.0f)
-    avg = 1.0f;
+  // Calcula razão pico/média
+  uint32_t ratioQ8 = peakRatioQ8();
 
-  return maxEnergy / avg;
+  // Debug
+  Serial.printf("[KWD] Análise: %d picos, razão: %.2f\n", peaks,
+                ratioQ8 / 256.0f);
+
+  // Critérios para "Hey Dragon":
+  // - 2 a 5 picos (duas palavras com sílabas)
+  // - Razão pico/média > 1.5 (voz clara)
+  // - Ajustado pela sensibilidade
+  return (peaks >= MIN_PEAKS_FOR_WAKE && peaks <= MAX_PEAKS_FOR_WAKE &&
+          ratioQ8 >= _minRatioQ8);
 }
 
 void KeywordDetector::setSensitivity(float sensitivity) {
   _sensitivity = constrain(sensitivity, 0.0f, 1.0f);
+  updateThresholds();
   Serial.printf("[KWD] Sensibilidade: %.2f\n", _sensitivity);
 }
 
 void KeywordDetector::setNoiseFloor(float floor) {
-  _noiseFloor = max(floor, 10.0f);
-  _vadThreshold = _noiseFloor * VAD_MULTIPLIER * (2.0f - _sensitivity);
+  _noiseFloorQ8 = (uint32_t)(max(floor, (float)KWD_NOISE_FLOOR_MIN) * 256.0f);
+  updateThresholds();
 }
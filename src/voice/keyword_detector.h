@@ -7,6 +7,13 @@
  * - VAD (Voice Activity Detection) baseado em energia
  * - Análise de duração e padrão do sinal
  * - Detecção de picos característicos
+ *
+ * Roda em todo quadro do microfone, então o caminho por quadro é só
+ * inteiro e O(1) fora a soma dos quadrados:
+ * - Energia = RMS inteiro (soma de quadrados em 64 bits, raiz inteira).
+ * - Piso de ruído e limiar de VAD em ponto fixo (Q8).
+ * - Histórico com soma corrente, fila monotônica para o máximo e máscara
+ *   de máximos locais, atualizados na entrada/saída de cada quadro.
  */
 
 #include <Arduino.h>
@@ -18,6 +25,7 @@
 #define KWD_WAKE_WORD_MIN_DURATION_MS 400
 #define KWD_WAKE_WORD_MAX_DURATION_MS 1500
 #define KWD_SILENCE_TIMEOUT_MS 300
+#define KWD_NOISE_FLOOR_MIN 10 // RMS: abaixo disso o limiar vira zero
 
 // Estados do detector
 enum KeywordState {
@@ -59,19 +67,27 @@ public:
 
   // Debug
   float getCurrentEnergy() const { return _currentEnergy; }
-  float getNoiseFloor() const { return _noiseFloor; }
+  float getNoiseFloor() const { return _noiseFloorQ8 / 256.0f; }
   bool isVoiceActive() const { return _voiceActive; }
+  uint32_t getLastCycles() const { return _lastCycles; } // Último quadro
+  uint32_t getMaxCycles() const { return _maxCycles; }
+
+  // RMS inteiro de um bloco (usado também fora do detector)
+  static uint16_t calculateEnergy(const int16_t *samples, size_t count);
 
 private:
   // Cálculos de energia
-  float calculateEnergy(const int16_t *samples, size_t count);
-  void updateNoiseFloor(float energy);
-  bool detectVoiceActivity(float energy);
+  void updateNoiseFloor(uint16_t energy);
+  void updateThresholds();
+
+  // Histórico incremental
+  void pushHistory(uint16_t energy);
+  void clearHistory();
+  int countEnergyPeaks() const;
+  uint32_t peakRatioQ8() const; // Máximo / média, Q8
 
   // Análise de padrão
   bool analyzePattern();
-  float calculatePeakRatio();
-  int countEnergyPeaks();
 
   // Estado interno
   KeywordState _state;
@@ -79,21 +95,28 @@ private:
 
   // Configurações
   float _sensitivity;
-  float _noiseFloor;
-  float _noiseFloorAlpha;
-  float _vadThreshold;
-
-  // Histórico de energia
-  float _energyHistory[KWD_ENERGY_HISTORY_SIZE];
-  int _energyHistoryIndex;
+  uint32_t _noiseFloorQ8;
+  uint32_t _vadThreshold; // RMS
+  uint32_t _vadGainQ8;    // Limiar = piso x ganho
+  uint32_t _minRatioQ8;   // Razão pico/média mínima
+
+  // Histórico de energia (anel em ordem cronológica)
+  uint16_t _energyHistory[KWD_ENERGY_HISTORY_SIZE];
+  uint32_t _energyPushed;  // Quadros já inseridos (posição absoluta)
   int _energyHistoryCount;
+  uint32_t _energySum;     // Soma do que está no anel
+  uint32_t _peakMask;      // Bit por slot: máximo local já confirmado
+  uint32_t _maxQueue[KWD_ENERGY_HISTORY_SIZE]; // Posições, energia decrescente
+  uint8_t _maxHead;
+  uint8_t _maxLen;
 
   // Tracking de voz
   bool _voiceActive;
   uint32_t _voiceStartTime;
   uint32_t _lastVoiceTime;
-  float _currentEnergy;
-  float _peakEnergy;
+  uint16_t _currentEnergy;
+  uint32_t _lastCycles;
+  uint32_t _maxCycles;
 
   // Contadores
   int _frameSinceVoiceStart;
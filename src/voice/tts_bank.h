@@ -0,0 +1,39 @@
+#pragma once
+/**
+ * @file tts_bank.h
+ * @brief Formato do banco de frases do TTS (gerado por
+ *        scripts/generate_tts_samples.py)
+ *
+ * [TtsBankHeader][TtsBankEntry x count][blocos IMA-ADPCM de cada frase]
+ *
+ * Cada frase é uma sequência de blocos mono do WAV IMA (ima_adpcm.h); o
+ * último bloco vem completado e `samples` diz onde parar. Tudo
+ * little-endian, lido direto da flash mapeada (firmware ou partição).
+ */
+
+#include <stdint.h>
+
+#define TTS_BANK_MAGIC "TTSB"
+#define TTS_BANK_VERSION 1
+#define TTS_BANK_CODEC_IMA_ADPCM 1
+#define TTS_BANK_MAX_BLOCK 256          // blockAlign máximo aceito
+#define TTS_BANK_PARTITION "tts"        // Partição de dados (subtipo 0x40)
+#define TTS_BANK_PARTITION_SUBTYPE 0x40
+
+struct TtsBankHeader {
+  char magic[4]; // "TTSB"
+  uint8_t version;
+  uint8_t codec;
+  uint16_t count;      // Entradas no índice
+  uint16_t sampleRate; // O mixer converte para a taxa do I2S
+  uint16_t blockAlign; // Bytes por bloco ADPCM
+  char lang[8];        // "pt-br"...
+};
+
+struct TtsBankEntry {
+  uint32_t offset;  // Do início do banco
+  uint32_t samples; // 0 = frase ausente
+};
+
+static_assert(sizeof(TtsBankHeader) == 20, "layout do script mudou");
+static_assert(sizeof(TtsBankEntry) == 8, "layout do script mudou");
@@ -1,84 +1,200 @@
 /**
  * @file tts_player.cpp
  * @brief Offline TTS Player implementation
- * 
- * Plays pre-generated audio samples via I2S to ES8311 codec.
+ *
+ * Frases do banco ADPCM entregues ao motor de áudio como fontes (ver
+ * tts_player.h).
  */
 
 #include "tts_player.h"
 #include "tts_samples.h"
 #include "../hardware/audio_driver.h"
 #include <Arduino.h>
+#include <esp_partition.h>
 
 TTSPlayer ttsPlayer;
 
-// Playback rate: 16kHz = 62.5us per sample
-#define SAMPLE_INTERVAL_US 62
+// ═══════════════════════════════════════════════════════════════════════════
+// VOZ (FONTE DO MOTOR)
+// ═══════════════════════════════════════════════════════════════════════════
 
-TTSPlayer::TTSPlayer() 
-    : _playing(false), _currentSample(nullptr), _sampleLength(0), 
-      _playbackPosition(0), _lastSampleTime(0) {}
+TtsVoice::TtsVoice()
+    : _busy(false), _cancel(false), _next(nullptr), _remaining(0),
+      _fadeLeft(-1), _blockAlign(0), _decPos(0), _decLen(0) {}
+
+bool TtsVoice::claim() {
+    bool expected = false;
+    return _busy.compare_exchange_strong(expected, true);
+}
+
+void TtsVoice::start(const uint8_t *blocks, uint32_t samples,
+                     uint16_t blockAlign) {
+    _next = blocks;
+    _remaining = samples;
+    _blockAlign = blockAlign;
+    _decPos = 0;
+    _decLen = 0;
+    _fadeLeft = -1;
+    _cancel.store(false, std::memory_order_release);
+}
+
+size_t TtsVoice::read(int16_t *out, size_t count) {
+    // Cancelada: mais TTS_FADE_SAMPLES da frase, descendo até zero
+    if (_cancel.load(std::memory_order_acquire)) {
+        if (_fadeLeft < 0)
+            _fadeLeft = TTS_FADE_SAMPLES;
+        if (_fadeLeft == 0)
+            return 0;
+        if (count > (size_t)_fadeLeft)
+            count = _fadeLeft;
+    }
+
+    size_t done = 0;
+    while (done < count) {
+        if (_decPos >= _decLen) {
+            if (_remaining == 0)
+                break; // Fim: o motor chama close()
+            // Um bloco por vez, direto da flash
+            _decLen = imaAdpcmDecodeBlock(_next, _blockAlign, _remaining,
+                                          _decoded);
+            _next += _blockAlign;
+            _remaining -= _decLen;
+            _decPos = 0;
+        }
+        size_t n = _decLen - _decPos;
+        if (n > count - done)
+            n = count - done;
+        memcpy(out + done, _decoded + _decPos, n * sizeof(int16_t));
+        _decPos += n;
+        done += n;
+    }
+
+    if (_fadeLeft > 0) {
+        for (size_t i = 0; i < done; i++)
+            out[i] = (int32_t)out[i] * (int32_t)(_fadeLeft - i) /
+                     TTS_FADE_SAMPLES;
+        _fadeLeft -= done;
+    }
+    return done;
+}
+
+void TtsVoice::close() { _busy.store(false, std::memory_order_release); }
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PLAYER
+// ═══════════════════════════════════════════════════════════════════════════
+
+TTSPlayer::TTSPlayer() : _bank(nullptr), _header(nullptr), _index(nullptr) {}
+
+bool TTSPlayer::load(const uint8_t *data, size_t len) {
+    const TtsBankHeader *h = (const TtsBankHeader *)data;
+    if (len < sizeof(TtsBankHeader) ||
+        memcmp(h->magic, TTS_BANK_MAGIC, 4) != 0 ||
+        h->version != TTS_BANK_VERSION ||
+        h->codec != TTS_BANK_CODEC_IMA_ADPCM || h->blockAlign <= 4 ||
+        h->blockAlign > TTS_BANK_MAX_BLOCK || h->sampleRate < 4000 ||
+        len < sizeof(TtsBankHeader) + (size_t)h->count * sizeof(TtsBankEntry))
+        return false;
+
+    // Toda frase inteira dentro do banco: read() nunca confere limites
+    const TtsBankEntry *index = (const TtsBankEntry *)(h + 1);
+    const uint32_t perBlock = IMA_ADPCM_BLOCK_SAMPLES(h->blockAlign);
+    for (uint16_t i = 0; i < h->count; i++) {
+        uint64_t bytes = (uint64_t)((index[i].samples + perBlock - 1) /
+                                    perBlock) * h->blockAlign;
+        if (index[i].samples && index[i].offset + bytes > len)
+            return false;
+    }
+
+    _bank = data;
+    _header = h;
+    _index = index;
+    return true;
+}
 
 bool TTSPlayer::begin() {
-    Serial.println("[TTS] Offline TTS Player initialized");
+    if (_header)
+        return true;
+
+    const char *source = "firmware";
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t)TTS_BANK_PARTITION_SUBTYPE,
+        TTS_BANK_PARTITION);
+    if (part) {
+        // Mapeada uma vez: as vozes leem a flash como memória
+        const void *ptr = nullptr;
+        spi_flash_mmap_handle_t handle;
+        if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr,
+                               &handle) == ESP_OK) {
+            if (load((const uint8_t *)ptr, part->size))
+                source = "partição";
+            else
+                spi_flash_munmap(handle);
+        }
+    }
+
+    if (!_header && !load(TTS_BANK_DATA, TTS_BANK_LEN)) {
+        Serial.println("[TTS] Banco de frases inválido");
+        return false;
+    }
+
+    char lang[sizeof(_header->lang) + 1] = {0};
+    memcpy(lang, _header->lang, sizeof(_header->lang));
+    Serial.printf("[TTS] Banco (%s): %u frases, %u Hz, idioma %s\n", source,
+                  _header->count, _header->sampleRate, lang);
     return true;
 }
 
-void TTSPlayer::play(TTSMessage msg) {
-    if (msg >= TTS_SAMPLE_COUNT) {
+const TtsBankEntry *TTSPlayer::entry(TTSMessage msg) const {
+    if (!_header || (unsigned)msg >= _header->count ||
+        _index[msg].samples == 0)
+        return nullptr;
+    return &_index[msg];
+}
+
+bool TTSPlayer::hasPhrase(TTSMessage msg) const {
+    return entry(msg) != nullptr;
+}
+
+uint32_t TTSPlayer::getDurationMs(TTSMessage msg) const {
+    const TtsBankEntry *e = entry(msg);
+    return e ? (uint64_t)e->samples * 1000 / _header->sampleRate : 0;
+}
+
+bool TTSPlayer::play(TTSMessage msg) {
+    const TtsBankEntry *e = entry(msg);
+    if (!e) {
         Serial.printf("[TTS] Invalid message ID: %d\n", msg);
-        return;
+        return false;
     }
-    
+
     // Stop current playback
     stop();
-    
-    // Get sample from lookup table
-    const TTSSample& sample = TTS_SAMPLES[msg];
-    _currentSample = sample.data;
-    _sampleLength = sample.length;
-    _playbackPosition = 0;
-    _playing = true;
-    _lastSampleTime = micros();
-    
-    Serial.printf("[TTS] Playing message %d (%d bytes)\n", msg, _sampleLength);
+
+    for (uint8_t i = 0; i < TTS_VOICES; i++) {
+        TtsVoice &v = _voices[i];
+        if (!v.claim())
+            continue;
+        v.start(_bank + e->offset, e->samples, _header->blockAlign);
+        Serial.printf("[TTS] Playing message %d (%u ms)\n", msg,
+                      getDurationMs(msg));
+        // Recusou (mudo, sem voz no mixer): o motor já chamou close()
+        return audioDriver.playSource(&v, _header->sampleRate,
+                                      AUDIO_PRIO_VOICE);
+    }
+    Serial.println("[TTS] Nenhuma voz livre");
+    return false;
 }
 
 void TTSPlayer::stop() {
-    _playing = false;
-    _currentSample = nullptr;
-    _playbackPosition = 0;
+    for (uint8_t i = 0; i < TTS_VOICES; i++)
+        _voices[i].cancel();
 }
 
-void TTSPlayer::update() {
-    if (!_playing || !_currentSample) return;
-    
-    uint32_t now = micros();
-    
-    // Calculate how many samples to play since last update
-    uint32_t elapsed = now - _lastSampleTime;
-    uint32_t samplesToPlay = elapsed / SAMPLE_INTERVAL_US;
-    
-    if (samplesToPlay == 0) return;
-    
-    // Batch feed samples to I2S buffer
-    // In reality, audioDriver would have a buffer we write to
-    for (uint32_t i = 0; i < samplesToPlay && _playbackPosition < _sampleLength; i++) {
-        uint8_t sample = pgm_read_byte(&_currentSample[_playbackPosition++]);
-        
-        // Convert 8-bit unsigned to 16-bit signed for I2S
-        int16_t sample16 = ((int16_t)sample - 128) * 256;
-        
-        // Feed to audio driver (assuming it has a writeSample method)
-        // audioDriver.writeSample(sample16);
-        // For now, we'll use a bulk write approach later
-    }
-    
-    _lastSampleTime = now;
-    
-    // Check if finished
-    if (_playbackPosition >= _sampleLength) {
-        Serial.println("[TTS] Playback complete");
-        stop();
-    }
+bool TTSPlayer::isPlaying() const {
+    for (uint8_t i = 0; i < TTS_VOICES; i++)
+        if (_voices[i].isActive())
+            return true;
+    return false;
 }
@@ -1,37 +1,80 @@
 #pragma once
 /**
  * @file tts_player.h
- * @brief Offline TTS Player using pre-generated audio samples
+ * @brief Offline TTS Player: frases do banco IMA-ADPCM (tts_bank.h)
+ *
+ * O banco vem da partição "tts", se existir (outras frases/idiomas sem
+ * regravar o firmware), ou do embutido em tts_samples.h. Nada é
+ * descomprimido antes de tocar: cada TtsVoice é uma fonte do motor de
+ * áudio que decodifica um bloco por vez direto da flash mapeada.
  */
 
-#include "../hardware/audio_driver.h"
+#include "../hardware/audio_engine.h"
+#include "../hardware/ima_adpcm.h"
 #include "../voice/voice_assistant.h" // For TTSMessage enum
+#include "tts_bank.h"
 #include <Arduino.h>
+#include <atomic>
+
+#define TTS_VOICES 2 // A frase interrompida some enquanto a nova começa
+#define TTS_FADE_SAMPLES 128 // Rampa ao cancelar (8 ms a 16 kHz), sem clique
+
+class TtsVoice : public AudioSource {
+public:
+    TtsVoice();
+
+    bool claim(); // Livre -> ocupada
+    void start(const uint8_t *blocks, uint32_t samples, uint16_t blockAlign);
+    void cancel() { _cancel.store(true, std::memory_order_release); }
+    bool isActive() const {
+        return _busy.load(std::memory_order_acquire) &&
+               !_cancel.load(std::memory_order_acquire);
+    }
+
+    // AudioSource (task de áudio)
+    size_t read(int16_t *out, size_t count) override;
+    void close() override;
+
+private:
+    std::atomic<bool> _busy;
+    std::atomic<bool> _cancel; // read() faz a rampa, devolve 0 e o motor
+                               // solta a voz
+    int16_t _fadeLeft;         // Amostras da rampa (-1: sem cancelamento)
+    const uint8_t *_next;      // Próximo bloco na flash
+    uint32_t _remaining;
+    uint16_t _blockAlign;
+    int16_t _decoded[IMA_ADPCM_BLOCK_SAMPLES(TTS_BANK_MAX_BLOCK)];
+    size_t _decPos;
+    size_t _decLen;
+};
 
 class TTSPlayer {
 public:
     TTSPlayer();
-    
+
+    // Localiza e valida o banco (partição, depois firmware)
     bool begin();
-    
-    // Play a pre-recorded TTS message
-    void play(TTSMessage msg);
-    
+
+    // Play a pre-recorded TTS message (false: frase ausente no banco)
+    bool play(TTSMessage msg);
+
     // Stop current playback
     void stop();
-    
+
     // Check if playing
-    bool isPlaying() const { return _playing; }
-    
-    // Update (call in loop for async playback)
-    void update();
+    bool isPlaying() const;
+
+    bool hasPhrase(TTSMessage msg) const;
+    uint32_t getDurationMs(TTSMessage msg) const;
 
 private:
-    bool _playing;
-    const uint8_t* _currentSample;
-    size_t _sampleLength;
-    size_t _playbackPosition;
-    uint32_t _lastSampleTime;
+    const uint8_t *_bank;
+    const TtsBankHeader *_header;
+    const TtsBankEntry *_index;
+    TtsVoice _voices[TTS_VOICES];
+
+    bool load(const uint8_t *data, size_t len);
+    const TtsBankEntry *entry(TTSMessage msg) const;
 };
 
 extern TTSPlayer ttsPlayer;
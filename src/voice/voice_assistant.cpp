@@ -2,18 +2,21 @@
  * @file voice_assistant.cpp
  * @brief Implementação do assistente de voz WavePwn - 100% FUNCIONAL
  *
- * Usa captura de áudio real do microfone ES8311 via I2S,
- * detecção de wake word baseada em energia, e TTS com samples WAV.
+ * Usa captura de áudio real do microfone ES8311 via I2S, wake word neural
+ * (WakeWordDetector, task própria) com o detector de energia como reserva
+ * quando não há modelo, e TTS com samples WAV.
  */
 
 #include "voice_assistant.h"
 #include "../ai/ai_manager.h"
 #include "../core/globals.h"
+#include "../hardware/audio_capture.h"
 #include "../hardware/audio_driver.h"
 #include "../mascot/mascot_manager.h"
 #include "../pwnagotchi/pwnagotchi.h"
 #include "keyword_detector.h"
-#include "tts_player.h" // Assuming this exists/compiles
+#include "tts_player.h"
+#include "wake_word_detector.h"
 #include <math.h>
 
 // Stub constants para TTS (ESP32-S3 usa I2S, não DAC)
@@ -21,8 +24,7 @@ static const uint8_t sp3_FIFTY[] = {0};
 static const uint8_t sp2_TWO[] = {0};
 
 // Defines
-#define AUDIO_FRAME_SIZE 512
-#define AUDIO_PROCESS_INTERVAL_MS 32
+#define AUDIO_FRAME_SIZE 512 // 32 ms
 #define COMMAND_TIMEOUT_MS 5000
 // 16kHz * 2 bytes * 10s = 320KB
 #define RING_BUFFER_SIZE (320 * 1024)
@@ -46,10 +48,10 @@ VoiceAssistant voiceAssistant;
 VoiceAssistant::VoiceAssistant()
     : _state(VOICE_IDLE), _listeningEnabled(false), _wakeWordDetected(false),
       _lastActivity(0), _listeningTimeout(COMMAND_TIMEOUT_MS),
-      _cmdCallback(nullptr), _audioBufferPos(0), _signalEnergy(0),
-      _noiseFloor(100), _lastAudioProcess(0), _commandBufferPos(0),
+      _cmdCallback(nullptr), _audioBufferPos(0), _lastAudioProcess(0),
+      _commandBufferPos(0),
       _audioHistoryBuffer(nullptr), _historyBufferSize(RING_BUFFER_SIZE),
-      _historyWriteHead(0) {}
+      _historyWriteHead(0), _micReader(-1) {}
 
 bool VoiceAssistant::begin() {
   Serial.println("[VOICE] Inicializando assistente de voz REAL (Offline)...");
@@ -69,17 +71,26 @@ bool VoiceAssistant::begin() {
     return false;
   }
 
-  // TTS Player
-  // if (!ttsPlayer.begin()) ... assumes ttsPlayer global exists
-  // For now assuming existing includes handle declarations
+  // Frases offline (banco ADPCM); sem banco válido, só o TTS da nuvem
+  ttsPlayer.begin();
 
-  if (!audioDriver.startRecording()) {
-    Serial.println("[VOICE] AVISO: Falha ao iniciar microfone");
+  // Wake word neural; sem modelo, o keyword detector segue sozinho
+  if (!wakeWordDetector.begin()) {
+    Serial.println("[VOICE] AVISO: Wake word neural indisponível");
   }
 
   _state = VOICE_IDLE;
   _listeningEnabled = g_state.voice_enabled;
 
+  // Cursor próprio na captura: gravador e walkie-talkie ouvem junto
+  if (_listeningEnabled) {
+    _micReader = audioCapture.openReader("voice");
+    if (_micReader < 0) {
+      Serial.println("[VOICE] AVISO: Falha ao iniciar microfone");
+    }
+    wakeWordDetector.start();
+  }
+
   Serial.println("[VOICE] 'Dragão' PRONTO! Wake word: 'Ei Dragão'");
   audioDriver.playMelody(melody_wake, 3);
   mascot_manager.setMood(0);
@@ -88,16 +99,15 @@ bool VoiceAssistant::begin() {
 }
 
 void VoiceAssistant::update() {
-  // Update TTS if needed
-  // ttsPlayer.update(); // If it exists
-
   if (!_listeningEnabled)
     return;
 
-  unsigned long now = millis();
-  if (now - _lastAudioProcess < AUDIO_PROCESS_INTERVAL_MS) {
+  // Um frame completo por vez (32 ms): o ritmo vem do microfone, e um loop
+  // atrasado recupera o atraso do anel nas chamadas seguintes
+  if (audioCapture.available(_micReader) < AUDIO_FRAME_SIZE) {
     return;
   }
+  unsigned long now = millis();
   _lastAudioProcess = now;
 
   processAudio();
@@ -158,24 +168,18 @@ void VoiceAssistant::update() {
 
 void VoiceAssistant::processAudio() {
   size_t samplesRead =
-      audioDriver.readAudioSamples(audioFrame, AUDIO_FRAME_SIZE);
+      audioCapture.read(_micReader, audioFrame, AUDIO_FRAME_SIZE);
 
   if (samplesRead > 0) {
     addToHistory(audioFrame, samplesRead);
 
-    float energy = 0;
-    for (size_t i = 0; i < samplesRead; i++) {
-      energy += abs(audioFrame[i]);
-    }
-    energy /= samplesRead;
-    _signalEnergy = energy;
-
-    if (energy < _noiseFloor * 1.2f) {
-      _noiseFloor = _noiseFloor * 0.95f + energy * 0.05f;
-    }
+    // Detecção da task neural; consumida sempre para não disparar atrasada
+    bool neural = wakeWordDetector.takeDetection();
 
+    // Energia e piso de ruído vêm do detector (um só passe no quadro)
     if (_state == VOICE_IDLE || _state == VOICE_DIALOG) {
-      if (keywordDetector.processFrame(audioFrame, samplesRead)) {
+      bool keyword = keywordDetector.processFrame(audioFrame, samplesRead);
+      if (wakeWordDetector.isListening() ? neural : keyword) {
         _wakeWordDetected = true;
         triggerWakeWord();
       }
@@ -283,7 +287,8 @@ void VoiceAssistant::executeCommand(VoiceCommand cmd) {
 
   switch (cmd) {
   case CMD_SING_HAPPY_BIRTHDAY:
-    audioDriver.playMelody(melody_wake, 4);
+    audioDriver.playMelody(melody_wake,
+                           sizeof(melody_wake) / sizeof(MelodyNote));
     break;
   case CMD_TROLL_ME:
     break;
@@ -304,10 +309,16 @@ void VoiceAssistant::setListening(bool enabled) {
   _listeningEnabled = enabled;
   g_state.voice_enabled = enabled;
   if (enabled) {
-    audioDriver.startRecording();
+    if (_micReader < 0)
+      _micReader = audioCapture.openReader("voice");
+    else
+      audioCapture.flush(_micReader);
     keywordDetector.reset();
+    wakeWordDetector.start();
   } else {
-    audioDriver.stopRecording();
+    audioCapture.closeReader(_micReader);
+    _micReader = -1;
+    wakeWordDetector.stop();
     _state = VOICE_IDLE;
   }
 }
@@ -351,8 +362,12 @@ void VoiceAssistant::playTTS(TTSMessage msg, int param) {
 }
 
 // Getters
-float VoiceAssistant::getSignalEnergy() const { return _signalEnergy; }
-float VoiceAssistant::getNoiseFloor() const { return _noiseFloor; }
+float VoiceAssistant::getSignalEnergy() const {
+  return keywordDetector.getCurrentEnergy();
+}
+float VoiceAssistant::getNoiseFloor() const {
+  return keywordDetector.getNoiseFloor();
+}
 bool VoiceAssistant::isVoiceActive() const {
   return keywordDetector.isVoiceActive();
 }
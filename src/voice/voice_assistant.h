@@ -112,9 +112,8 @@ private:
   // Buffer para processamento atual
   size_t _audioBufferPos;
   size_t _commandBufferPos;
-  float _signalEnergy;
-  float _noiseFloor;
   unsigned long _lastAudioProcess;
+  int _micReader; // Cursor em audioCapture (-1 = sem microfone)
 
   void processAudio();
   VoiceCommand detectCommand();
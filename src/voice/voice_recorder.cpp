@@ -1,172 +1,579 @@
+/**
+ * @file voice_recorder.cpp
+ * @brief Gravador de voz (ver voice_recorder.h)
+ */
+
 #include "voice_recorder.h"
-#include "../hardware/audio_driver.h"
-#include "Arduino.h"
+#include "../hardware/audio_capture.h"
+#include "../hardware/mulaw.h"
+#include <esp_heap_caps.h>
 
 VoiceRecorder voiceRecorder;
 
-// WAV Header Constants
-struct WavHeader {
-  char riff[4];
-  uint32_t fileSize;
-  char wave[4];
-  char fmt[4];
-  uint32_t fmtLen;
-  uint16_t type;
-  uint16_t channels;
-  uint32_t sampleRate;
-  uint32_t byteRate;
-  uint16_t blockAlign;
-  uint16_t bitsPerSample;
-  char data[4];
-  uint32_t dataSize;
-};
+static_assert(REC_SAMPLE_RATE == AUDIO_CAPTURE_RATE,
+              "gravador grava na taxa da captura");
+static_assert(REC_BLOCK_BYTES % REC_ADPCM_BLOCK == 0 &&
+                  REC_BLOCK_BYTES % REC_HEADER_BYTES == 0,
+              "bloco de escrita precisa de blocos ADPCM e setores inteiros");
+
+#define REC_TAG_PCM 0x0001
+#define REC_TAG_MULAW 0x0007
+#define REC_TAG_IMA_ADPCM 0x0011
+#define REC_PREROLL_MAX_SAMPLES (REC_PREROLL_MAX_MS * (REC_SAMPLE_RATE / 1000))
+
+static inline void put16(uint8_t *p, uint16_t v) {
+  p[0] = v & 0xFF;
+  p[1] = v >> 8;
+}
+static inline void put32(uint8_t *p, uint32_t v) {
+  put16(p, v & 0xFFFF);
+  put16(p + 2, v >> 16);
+}
+
+static const char *formatName(RecFormat format) {
+  switch (format) {
+  case REC_FMT_ADPCM:
+    return "IMA-ADPCM";
+  case REC_FMT_MULAW:
+    return "u-law";
+  default:
+    return "PCM";
+  }
+}
+
+// Amostras inteiras em dataBytes de áudio codificado
+static uint32_t samplesFor(RecFormat format, uint32_t bytes) {
+  if (format == REC_FMT_ADPCM)
+    return bytes / REC_ADPCM_BLOCK * REC_ADPCM_SAMPLES;
+  return format == REC_FMT_MULAW ? bytes : bytes / 2;
+}
 
 VoiceRecorder::VoiceRecorder()
-    : _isRecording(false), _vadEnabled(true),
+    : _commands(NULL), _task(NULL), _vadEnabled(true),
       _vadThreshold(300), // Default threshold (adjust based on noise env)
-      _startTime(0), _lastAudioTime(0) {}
+      _format(REC_FMT_ADPCM), _preRollMs(500), _hangoverMs(1500),
+      _recording(false), _armed(false), _samples(0), _micReader(-1),
+      _fileFormat(REC_FMT_ADPCM), _triggered(false), _writeFailed(false),
+      _dataBytes(0), _lastSyncMs(0), _onset(0), _silentFrames(0),
+      _frameLen(0), _preRoll(nullptr), _preCap(0), _preHead(0), _preCount(0),
+      _block(nullptr), _blockLen(0), _adpcmFill(0), _files(0),
+      _bytesWritten(0), _writes(0), _maxWriteMs(0), _writeErrors(0),
+      _overruns(0) {
+  _path[0] = '\0';
+  imaAdpcmReset(_enc);
+}
 
 void VoiceRecorder::begin() {
-  // AudioDriver should be initialized by main
-  // Ensure SD is ready
-  if (!SD_MMC.exists("/recordings")) {
-    SD_MMC.mkdir("/recordings");
-  }
-}
-
-void VoiceRecorder::update() {
-  // If VAD enabled and not recording, check level
-  // Note: This requires constant listening, which might conflict with other
-  // audio tasks. For now, we assume this is called when "Audio Recorder" app is
-  // active or background service.
-
-  // Read samples from mic (if not exclusively claimed)
-  // Actually, we need to poll audio samples.
-
-  if (_isRecording) {
-    size_t bytesRead = 0;
-    // This is a blocking read in most I2S implementations, careful in main
-    // loop! We should move this to a task or use non-blocking available check.
-    // For simplicity in this iteration, we read small chunks.
-
-    int samplesRead = audioDriver.readAudioSamples(_buffer, BUFFER_SIZE);
-
-    if (samplesRead > 0) {
-      // Write to SD
-      if (_file) {
-        _file.write((uint8_t *)_buffer, samplesRead * 2);
-      }
-
-      // Check VAD to stop if silent for too long
-      if (_vadEnabled) {
-        if (checkVAD(_buffer, samplesRead)) {
-          _lastAudioTime = millis();
-        } else {
-          if (millis() - _lastAudioTime > 5000) { // 5s silence
-            Serial.println("[REC] Silence detected, stopping...");
-            stopRecording();
-          }
-        }
-      }
-    }
-  } else if (_vadEnabled) {
-    // Monitor for trigger?
-    // This usually requires a loop.
-    // Let's implement manual start or UI trigger for now to avoid complexity
-    // sharing I2S.
+  if (_task)
+    return;
+
+  if (!SD_MMC.exists(REC_DIR)) {
+    SD_MMC.mkdir(REC_DIR);
   }
-}
 
-void VoiceRecorder::startRecording(const char *filename) {
-  if (_isRecording)
-    stopRecording();
+  // Reset ou bateria no meio de uma gravação: cabeçalho pelo tamanho real
+  if (SD_MMC.exists(REC_JOURNAL)) {
+    char path[sizeof(_path)] = {0};
+    File j = SD_MMC.open(REC_JOURNAL, FILE_READ);
+    if (j) {
+      j.read((uint8_t *)path, sizeof(path) - 1);
+      j.close();
+    }
+    if (path[0])
+      repair(path);
+    SD_MMC.remove(REC_JOURNAL);
+  }
 
-  char path[32];
-  if (filename) {
-    snprintf(path, sizeof(path), "/recordings/%s.wav", filename);
-  } else {
-    // Auto name timestamp
-    snprintf(path, sizeof(path), "/recordings/rec_%u.wav", millis());
+  _commands = xQueueCreate(4, sizeof(RecCommand));
+  if (!_commands) {
+    Serial.println("[REC] Falha ao criar fila de comandos");
+    return;
   }
+  // Core 0 como a leitura de WAV: a espera pelo cartão não trava o loop
+  if (xTaskCreatePinnedToCore(taskEntry, "Voice_Rec", 4096, this, 2, &_task,
+                              0) != pdPASS) {
+    _task = NULL;
+    Serial.println("[REC] Falha ao criar task");
+  }
+}
 
-  Serial.printf("[REC] Starting recording: %s\n", path);
+// ═══════════════════════════════════════════════════════════════════════════
+// COMANDOS (QUALQUER TASK)
+// ═══════════════════════════════════════════════════════════════════════════
 
-  _file = SD_MMC.open(path, FILE_WRITE);
-  if (!_file) {
-    Serial.println("[REC] Failed to open file for writing");
+void VoiceRecorder::send(Command cmd, const char *name) {
+  if (!_commands)
     return;
+  RecCommand c;
+  c.cmd = cmd;
+  c.name[0] = '\0';
+  if (name) {
+    strncpy(c.name, name, sizeof(c.name) - 1);
+    c.name[sizeof(c.name) - 1] = '\0';
   }
+  if (xQueueSend(_commands, &c, 0) != pdTRUE)
+    Serial.println("[REC] Fila de comandos cheia");
+}
 
-  writeWavHeader(_file, SAMPLE_RATE);
-
-  audioDriver.startRecording(); // Ensure mic is on
-  _isRecording = true;
-  _startTime = millis();
-  _lastAudioTime = millis();
+void VoiceRecorder::startRecording(const char *filename) {
+  send(CMD_START, filename);
 }
 
-void VoiceRecorder::stopRecording() {
-  if (!_isRecording)
-    return;
+void VoiceRecorder::stopRecording() { send(CMD_STOP); }
 
-  Serial.println("[REC] Stopping recording");
+void VoiceRecorder::arm() { send(CMD_ARM); }
 
-  if (_file) {
-    updateWavHeader(_file);
-    _file.close();
-    Serial.println("[REC] Saved.");
-  }
+void VoiceRecorder::disarm() { send(CMD_DISARM); }
 
-  _isRecording = false;
-  // audioDriver.enableMicrophone(false); // Maybe keep on if needed elsewhere
+void VoiceRecorder::setPreRollMs(uint16_t ms) {
+  _preRollMs = ms > REC_PREROLL_MAX_MS ? REC_PREROLL_MAX_MS : ms;
 }
 
 uint32_t VoiceRecorder::getRecordingDuration() const {
-  if (!_isRecording)
+  if (!_recording)
     return 0;
-  return (millis() - _startTime) / 1000;
+  return _samples / REC_SAMPLE_RATE;
+}
+
+RecorderStats VoiceRecorder::getStats() const {
+  RecorderStats st;
+  st.files = _files;
+  st.bytesWritten = _bytesWritten;
+  st.writes = _writes;
+  st.maxWriteMs = _maxWriteMs;
+  st.writeErrors = _writeErrors;
+  st.overruns = _overruns;
+  AudioCaptureReaderStats rs;
+  int reader = _micReader;
+  if (reader >= 0 && audioCapture.getReaderStats(reader, &rs))
+    st.overruns += rs.overruns;
+  return st;
 }
 
-bool VoiceRecorder::checkVAD(int16_t *samples, int count) {
+// ═══════════════════════════════════════════════════════════════════════════
+// TASK
+// ═══════════════════════════════════════════════════════════════════════════
+
+void VoiceRecorder::taskEntry(void *param) {
+  VoiceRecorder *self = (VoiceRecorder *)param;
+  RecCommand c;
+  for (;;) {
+    // Ocioso: dorme na fila. Ouvindo: olha a fila entre as leituras
+    TickType_t wait = self->_micReader < 0 ? portMAX_DELAY : 0;
+    if (xQueueReceive(self->_commands, &c, wait) == pdTRUE) {
+      self->handle(c);
+      continue;
+    }
+
+    size_t n = audioCapture.read(self->_micReader,
+                                 self->_frame + self->_frameLen,
+                                 REC_VAD_FRAME - self->_frameLen, 50);
+    self->_frameLen += n;
+    if (self->_frameLen == REC_VAD_FRAME) {
+      self->_frameLen = 0;
+      self->process(self->_frame, REC_VAD_FRAME);
+    }
+  }
+}
+
+void VoiceRecorder::handle(const RecCommand &c) {
+  switch (c.cmd) {
+  case CMD_START:
+    if (_file)
+      closeFile();
+    if (openReader())
+      openFile(c.name[0] ? c.name : nullptr, false);
+    break;
+
+  case CMD_STOP:
+    if (_file)
+      closeFile();
+    break;
+
+  case CMD_ARM:
+    if (_armed || !openReader())
+      break;
+    if (!_preRoll)
+      _preRoll = (int16_t *)heap_caps_malloc(
+          REC_PREROLL_MAX_SAMPLES * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    _preCap = _preRoll ? (size_t)_preRollMs * (REC_SAMPLE_RATE / 1000) : 0;
+    _preHead = 0;
+    _preCount = 0;
+    _onset = 0;
+    _armed = true;
+    Serial.printf("[REC] Gatilho por voz armado (pré-roll %u ms, "
+                  "hangover %u ms)\n",
+                  _preCap / (REC_SAMPLE_RATE / 1000), _hangoverMs);
+    break;
+
+  case CMD_DISARM:
+    _armed = false;
+    if (_file && _triggered)
+      closeFile();
+    break;
+  }
+  releaseReader();
+}
+
+bool VoiceRecorder::openReader() {
+  if (_micReader >= 0)
+    return true;
+  // Cursor próprio na captura: não rouba amostras do assistente de voz
+  _micReader = audioCapture.openReader("recorder");
+  if (_micReader < 0) {
+    Serial.println("[REC] Microphone unavailable");
+    return false;
+  }
+  _frameLen = 0;
+  return true;
+}
+
+void VoiceRecorder::releaseReader() {
+  if (_armed || _file || _micReader < 0)
+    return;
+  AudioCaptureReaderStats rs;
+  if (audioCapture.getReaderStats(_micReader, &rs))
+    _overruns += rs.overruns;
+  int reader = _micReader;
+  _micReader = -1;
+  audioCapture.closeReader(reader);
+
+  // Buffers só existem durante a sessão
+  heap_caps_free(_block);
+  _block = nullptr;
+  heap_caps_free(_preRoll);
+  _preRoll = nullptr;
+}
+
+bool VoiceRecorder::checkVAD(const int16_t *samples, size_t count) const {
   int32_t sum = 0;
-  for (int i = 0; i < count; i++) {
+  for (size_t i = 0; i < count; i++) {
     sum += abs(samples[i]);
   }
-  int average = sum / count;
+  int average = sum / (int32_t)count;
   return (average > _vadThreshold);
 }
 
-void VoiceRecorder::writeWavHeader(File &file, int sampleRate) {
-  WavHeader h;
-  memcpy(h.riff, "RIFF", 4);
-  h.fileSize = 0; // Placeholder
-  memcpy(h.wave, "WAVE", 4);
-  memcpy(h.fmt, "fmt ", 4);
-  h.fmtLen = 16;
-  h.type = 1;     // PCM
-  h.channels = 1; // Mono
-  h.sampleRate = sampleRate;
-  h.bitsPerSample = 16;
-  h.byteRate = sampleRate * 1 * (16 / 8);
-  h.blockAlign = 1 * (16 / 8);
-  memcpy(h.data, "data", 4);
-  h.dataSize = 0; // Placeholder
+void VoiceRecorder::process(const int16_t *frame, size_t count) {
+  bool voice = checkVAD(frame, count);
 
-  file.write((uint8_t *)&h, sizeof(WavHeader));
+  if (!_file) {
+    if (!_armed)
+      return;
+    pushPreRoll(frame, count);
+    _onset = voice ? _onset + 1 : 0;
+    if (_onset < REC_ONSET_FRAMES)
+      return;
+    _onset = 0;
+    if (!openFile(nullptr, true)) {
+      _armed = false; // Sem SD: não insiste a cada palavra
+      releaseReader();
+      return;
+    }
+    // O pré-roll já inclui os quadros que dispararam
+    if (_preCap)
+      flushPreRoll();
+    else
+      append(frame, count);
+  } else {
+    append(frame, count);
+  }
+
+  if (_writeFailed) {
+    closeFile();
+    _armed = false;
+    releaseReader();
+    return;
+  }
+
+  if (!_triggered && !_vadEnabled)
+    return;
+  if (voice) {
+    _silentFrames = 0;
+    return;
+  }
+  uint32_t limitMs = _triggered ? _hangoverMs : REC_AUTOSTOP_MS;
+  uint32_t silentMs = ++_silentFrames * REC_VAD_FRAME * 1000 / REC_SAMPLE_RATE;
+  if (silentMs < limitMs)
+    return;
+  Serial.printf("[REC] %u ms de silêncio, encerrando\n", silentMs);
+  closeFile();
+  releaseReader();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// PRÉ-ROLL
+// ═══════════════════════════════════════════════════════════════════════════
+
+void VoiceRecorder::pushPreRoll(const int16_t *samples, size_t count) {
+  while (count > 0 && _preCap > 0) {
+    size_t n = _preCap - _preHead;
+    if (n > count)
+      n = count;
+    memcpy(_preRoll + _preHead, samples, n * sizeof(int16_t));
+    _preHead += n;
+    if (_preHead == _preCap)
+      _preHead = 0;
+    _preCount = _preCount + n > _preCap ? _preCap : _preCount + n;
+    samples += n;
+    count -= n;
+  }
+}
+
+void VoiceRecorder::flushPreRoll() {
+  // Mais antigo primeiro: do fim do anel até o início
+  size_t start = (_preHead + _preCap - _preCount) % _preCap;
+  size_t first = _preCap - start;
+  if (first > _preCount)
+    first = _preCount;
+  append(_preRoll + start, first);
+  append(_preRoll, _preCount - first);
+  _preHead = 0;
+  _preCount = 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ARQUIVO
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool VoiceRecorder::openFile(const char *name, bool triggered) {
+  if (!_block) {
+    // RAM interna com DMA: o driver do SD envia o bloco direto, sem cópia
+    _block = (uint8_t *)heap_caps_malloc(REC_BLOCK_BYTES, MALLOC_CAP_DMA);
+    if (!_block)
+      _block = (uint8_t *)heap_caps_malloc(REC_BLOCK_BYTES, MALLOC_CAP_SPIRAM);
+    if (!_block) {
+      Serial.println("[REC] Sem memória para o bloco de escrita");
+      return false;
+    }
+  }
+
+  if (name) {
+    snprintf(_path, sizeof(_path), REC_DIR "/%s.wav", name);
+  } else {
+    // Auto name timestamp
+    snprintf(_path, sizeof(_path), REC_DIR "/%s_%u.wav",
+             triggered ? "vad" : "rec", millis());
+  }
+
+  _file = SD_MMC.open(_path, FILE_WRITE);
+  if (!_file) {
+    Serial.printf("[REC] Failed to open %s for writing\n", _path);
+    return false;
+  }
+
+  _fileFormat = _format;
+  _triggered = triggered;
+  _writeFailed = false;
+  _dataBytes = 0;
+  _samples = 0;
+  _blockLen = 0;
+  _adpcmFill = 0;
+  _silentFrames = 0;
+  imaAdpcmReset(_enc);
+
+  // Tamanho zero até a primeira sincronização: lido até o fim do arquivo
+  writeHeader(0);
+
+  File j = SD_MMC.open(REC_JOURNAL, FILE_WRITE);
+  if (j) {
+    j.print(_path);
+    j.close();
+  }
+
+  _recording = true;
+  _files++;
+  Serial.printf("[REC] Starting recording: %s (%s)\n", _path,
+                formatName(_fileFormat));
+  return true;
 }
 
-void VoiceRecorder::updateWavHeader(File &file) {
-  if (!file)
+void VoiceRecorder::closeFile() {
+  if (!_file)
     return;
 
-  uint32_t dataSize = file.size() - sizeof(WavHeader);
-  uint32_t fileSize = file.size() - 8;
+  if (_fileFormat == REC_FMT_ADPCM && _adpcmFill > 0) {
+    // Completa o último bloco repetindo a amostra final (sem clique);
+    // o "fact" guarda o total real
+    int16_t last = _adpcmIn[_adpcmFill - 1];
+    while (_adpcmFill < REC_ADPCM_SAMPLES)
+      _adpcmIn[_adpcmFill++] = last;
+    encodeAdpcmBlock();
+  }
+  if (_blockLen > 0)
+    writeBlock();
+
+  writeHeader(_samples);
+  _file.close();
+  SD_MMC.remove(REC_JOURNAL);
+  _recording = false;
+  Serial.printf("[REC] Saved: %s (%u s, %u KB)\n", _path,
+                _samples / REC_SAMPLE_RATE,
+                (REC_HEADER_BYTES + _dataBytes) / 1024);
+}
+
+void VoiceRecorder::append(const int16_t *pcm, size_t count) {
+  _samples += count;
+  while (count > 0) {
+    size_t n;
+    if (_fileFormat == REC_FMT_ADPCM) {
+      n = REC_ADPCM_SAMPLES - _adpcmFill;
+      if (n > count)
+        n = count;
+      memcpy(_adpcmIn + _adpcmFill, pcm, n * sizeof(int16_t));
+      _adpcmFill += n;
+      if (_adpcmFill == REC_ADPCM_SAMPLES)
+        encodeAdpcmBlock();
+    } else if (_fileFormat == REC_FMT_MULAW) {
+      n = REC_BLOCK_BYTES - _blockLen;
+      if (n > count)
+        n = count;
+      for (size_t i = 0; i < n; i++)
+        _block[_blockLen++] = mulawEncode(pcm[i]);
+    } else {
+      n = (REC_BLOCK_BYTES - _blockLen) / sizeof(int16_t);
+      if (n > count)
+        n = count;
+      memcpy(_block + _blockLen, pcm, n * sizeof(int16_t)); // Little-endian
+      _blockLen += n * sizeof(int16_t);
+    }
+    pcm += n;
+    count -= n;
+    if (_blockLen == REC_BLOCK_BYTES)
+      writeBlock();
+  }
+}
+
+void VoiceRecorder::encodeAdpcmBlock() {
+  imaAdpcmEncodeBlock(_enc, _adpcmIn, REC_ADPCM_BLOCK, _block + _blockLen);
+  _blockLen += REC_ADPCM_BLOCK;
+  _adpcmFill = 0;
+}
+
+void VoiceRecorder::writeBlock() {
+  uint32_t t0 = millis();
+  size_t written = _file.write(_block, _blockLen);
+  uint32_t ms = millis() - t0;
+
+  _writes++;
+  if (ms > _maxWriteMs)
+    _maxWriteMs = ms;
+  _dataBytes += written;
+  _bytesWritten += written;
+  if (written != _blockLen) {
+    _writeErrors++;
+    _writeFailed = true;
+    Serial.printf("[REC] Falha de escrita no SD (%u/%u bytes)\n", written,
+                  _blockLen);
+  }
+  _blockLen = 0;
+
+  if (!_writeFailed && millis() - _lastSyncMs >= REC_SYNC_MS)
+    writeHeader(samplesFor(_fileFormat, _dataBytes));
+}
 
-  file.seek(4);
-  file.write((uint8_t *)&fileSize, 4);
+void VoiceRecorder::writeHeader(uint32_t samples) {
+  uint8_t h[REC_HEADER_BYTES];
+  buildHeader(h, _fileFormat, _dataBytes, samples);
+  _file.seek(0);
+  _file.write(h, sizeof(h));
+  _file.seek(REC_HEADER_BYTES + _dataBytes);
+  // Tamanho no diretório passa a bater com o do cabeçalho
+  _file.flush();
+  _lastSyncMs = millis();
+}
+
+void VoiceRecorder::buildHeader(uint8_t *h, RecFormat format,
+                                uint32_t dataBytes, uint32_t samples) {
+  uint16_t tag, bits, align, fmtLen;
+  uint32_t byteRate;
+  switch (format) {
+  case REC_FMT_ADPCM:
+    tag = REC_TAG_IMA_ADPCM;
+    bits = 4;
+    align = REC_ADPCM_BLOCK;
+    fmtLen = 20; // cbSize + samplesPerBlock
+    byteRate = (uint32_t)REC_SAMPLE_RATE * REC_ADPCM_BLOCK / REC_ADPCM_SAMPLES;
+    break;
+  case REC_FMT_MULAW:
+    tag = REC_TAG_MULAW;
+    bits = 8;
+    align = 1;
+    fmtLen = 18; // cbSize = 0
+    byteRate = REC_SAMPLE_RATE;
+    break;
+  default:
+    tag = REC_TAG_PCM;
+    bits = 16;
+    align = 2;
+    fmtLen = 16;
+    byteRate = REC_SAMPLE_RATE * 2;
+    break;
+  }
+
+  memset(h, 0, REC_HEADER_BYTES);
+  memcpy(h, "RIFF", 4);
+  put32(h + 4, REC_HEADER_BYTES - 8 + dataBytes);
+  memcpy(h + 8, "WAVE", 4);
+  memcpy(h + 12, "fmt ", 4);
+  put32(h + 16, fmtLen);
+  uint8_t *f = h + 20;
+  put16(f, tag);
+  put16(f + 2, 1); // Mono
+  put32(f + 4, REC_SAMPLE_RATE);
+  put32(f + 8, byteRate);
+  put16(f + 12, align);
+  put16(f + 14, bits);
+  if (format == REC_FMT_ADPCM) {
+    put16(f + 16, 2);
+    put16(f + 18, REC_ADPCM_SAMPLES);
+  }
+
+  size_t pos = 20 + fmtLen;
+  if (format != REC_FMT_PCM16) {
+    // Formatos comprimidos: total de amostras no "fact"
+    memcpy(h + pos, "fact", 4);
+    put32(h + pos + 4, 4);
+    put32(h + pos + 8, samples);
+    pos += 12;
+  }
+  // Enchimento: o "data" termina no fim do setor
+  memcpy(h + pos, "JUNK", 4);
+  put32(h + pos + 4, REC_HEADER_BYTES - 8 - (pos + 8));
+  memcpy(h + REC_HEADER_BYTES - 8, "data", 4);
+  put32(h + REC_HEADER_BYTES - 4, dataBytes);
+}
+
+void VoiceRecorder::repair(const char *path) {
+  File f = SD_MMC.open(path, "r+");
+  if (!f)
+    return;
+
+  uint8_t h[REC_HEADER_BYTES];
+  if (f.size() < REC_HEADER_BYTES || f.read(h, sizeof(h)) != sizeof(h) ||
+      memcmp(h, "RIFF", 4) != 0 || memcmp(h + 8, "WAVE", 4) != 0 ||
+      memcmp(h + REC_HEADER_BYTES - 8, "data", 4) != 0) {
+    Serial.printf("[REC] %s: cabeçalho não reconhecido, mantido\n", path);
+    f.close();
+    return;
+  }
 
-  file.seek(40);
-  file.write((uint8_t *)&dataSize, 4);
+  uint16_t tag = h[20] | (h[21] << 8);
+  RecFormat format = tag == REC_TAG_IMA_ADPCM ? REC_FMT_ADPCM
+                     : tag == REC_TAG_MULAW   ? REC_FMT_MULAW
+                                              : REC_FMT_PCM16;
+  // Só unidades inteiras: amostra ou bloco cortado no fim fica de fora
+  uint32_t dataBytes = f.size() - REC_HEADER_BYTES;
+  uint32_t unit = format == REC_FMT_ADPCM   ? REC_ADPCM_BLOCK
+                  : format == REC_FMT_PCM16 ? 2
+                                            : 1;
+  dataBytes -= dataBytes % unit;
+  uint32_t samples = samplesFor(format, dataBytes);
 
-  file.seek(file.size()); // Return to end (good practice)
+  buildHeader(h, format, dataBytes, samples);
+  f.seek(0);
+  f.write(h, sizeof(h));
+  f.close();
+  Serial.printf("[REC] Gravação interrompida recuperada: %s (%u s)\n", path,
+                samples / REC_SAMPLE_RATE);
 }
@@ -1,39 +1,164 @@
 #pragma once
+/**
+ * @file voice_recorder.h
+ * @brief Gravador de voz no SD: VAD, pré-roll e escrita em blocos grandes
+ *
+ * Tudo roda na task do gravador, com um cursor próprio em audioCapture. A
+ * UI só envia comandos por fila (nada espera o cartão) e lê o estado.
+ * - Manual: startRecording() grava tudo até stopRecording(); com o VAD
+ *   ligado, para sozinho após REC_AUTOSTOP_MS de silêncio.
+ * - Gatilho por voz (arm()): o microfone fica ouvindo sem gravar e os
+ *   últimos preRoll ms ficam num anel. Voz por REC_ONSET_FRAMES quadros
+ *   seguidos abre um arquivo que começa pelo pré-roll; após hangover ms de
+ *   silêncio o arquivo é fechado e o gatilho volta a ouvir.
+ * - Formatos: PCM 16-bit, IMA-ADPCM (4 bits, 1/4 dos bytes) ou µ-law
+ *   (8 bits, metade).
+ * - Escrita: o áudio codificado acumula num bloco de REC_BLOCK_BYTES que vai
+ *   ao cartão numa escrita só. O cabeçalho ocupa REC_HEADER_BYTES (chunk
+ *   JUNK de enchimento), então toda escrita cai alinhada em setores.
+ * - Queda de energia: o cabeçalho sai com tamanho zero (o WavStream lê até
+ *   o fim do arquivo), é regravado a cada REC_SYNC_MS e no fim. O caminho
+ *   do arquivo aberto fica em REC_JOURNAL; begin() conserta o cabeçalho de
+ *   uma gravação interrompida.
+ */
+
 #include <Arduino.h>
 #include <FS.h>
 #include <SD_MMC.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include "../hardware/ima_adpcm.h"
+
+#define REC_DIR "/recordings"
+#define REC_JOURNAL REC_DIR "/.open"
+#define REC_SAMPLE_RATE 16000
+#define REC_BLOCK_BYTES (32 * 1024) // Uma escrita no SD
+#define REC_HEADER_BYTES 512        // Cabeçalho = um setor
+#define REC_ADPCM_BLOCK 256         // blockAlign do IMA-ADPCM
+#define REC_ADPCM_SAMPLES IMA_ADPCM_BLOCK_SAMPLES(REC_ADPCM_BLOCK)
+#define REC_VAD_FRAME 320           // 20 ms
+#define REC_ONSET_FRAMES 2          // Voz seguida para disparar
+#define REC_PREROLL_MAX_MS 2000
+#define REC_AUTOSTOP_MS 5000        // Silêncio que encerra a gravação manual
+#define REC_SYNC_MS 5000            // Cabeçalho + fsync durante a gravação
+
+enum RecFormat : uint8_t { REC_FMT_PCM16 = 0, REC_FMT_ADPCM, REC_FMT_MULAW };
+
+struct RecorderStats {
+  uint32_t files;
+  uint32_t bytesWritten; // Áudio codificado (sem cabeçalhos)
+  uint32_t writes;       // Escritas de bloco no SD
+  uint32_t maxWriteMs;   // Escrita mais lenta
+  uint32_t writeErrors;
+  uint32_t overruns;     // Cursor da captura atropelado (SD lento demais)
+};
 
 class VoiceRecorder {
 public:
   VoiceRecorder();
 
+  // Cria a pasta, conserta gravação interrompida e sobe a task
   void begin();
-  void update();
 
+  // Comandos assíncronos: isRecording() muda quando a task os processa
   void startRecording(const char *filename = nullptr);
   void stopRecording();
 
-  bool isRecording() const { return _isRecording; }
+  // Gatilho por voz: grava cada fala num arquivo próprio
+  void arm();
+  void disarm();
+
+  bool isRecording() const { return _recording; }
+  bool isArmed() const { return _armed; }
   void setVAD(bool enable) { _vadEnabled = enable; }
   void setVADThreshold(int threshold) { _vadThreshold = threshold; }
 
+  // Valem a partir do próximo arquivo / próximo arm()
+  void setFormat(RecFormat format) { _format = format; }
+  RecFormat getFormat() const { return _format; }
+  void setPreRollMs(uint16_t ms);
+  void setHangoverMs(uint16_t ms) { _hangoverMs = ms; }
+
+  // Segundos de áudio no arquivo atual
   uint32_t getRecordingDuration() const;
 
+  RecorderStats getStats() const;
+
 private:
-  bool _isRecording;
-  bool _vadEnabled;
-  int _vadThreshold;
+  enum Command : uint8_t { CMD_START, CMD_STOP, CMD_ARM, CMD_DISARM };
+
+  struct RecCommand {
+    Command cmd;
+    char name[24];
+  };
+
+  QueueHandle_t _commands;
+  TaskHandle_t _task;
+
+  // Configuração (UI escreve, task lê)
+  volatile bool _vadEnabled;
+  volatile int _vadThreshold;
+  volatile RecFormat _format;
+  volatile uint16_t _preRollMs;
+  volatile uint16_t _hangoverMs;
+
+  // Estado visível
+  volatile bool _recording;
+  volatile bool _armed;
+  volatile uint32_t _samples; // Amostras no arquivo atual
+
+  // Só a task
+  int _micReader; // Cursor em audioCapture
   File _file;
-  uint32_t _startTime;
-  uint32_t _lastAudioTime;
+  char _path[48];
+  RecFormat _fileFormat;
+  bool _triggered;   // Arquivo aberto pelo gatilho
+  bool _writeFailed; // SD recusou um bloco: a gravação termina
+  uint32_t _dataBytes;
+  uint32_t _lastSyncMs;
+  uint16_t _onset;
+  uint32_t _silentFrames;
+
+  int16_t _frame[REC_VAD_FRAME];
+  size_t _frameLen;
+
+  int16_t *_preRoll; // Anel PCM (PSRAM)
+  size_t _preCap;
+  size_t _preHead;
+  size_t _preCount;
+
+  uint8_t *_block; // Bloco de escrita (RAM com DMA, se houver)
+  size_t _blockLen;
+  ImaAdpcmState _enc;
+  int16_t _adpcmIn[REC_ADPCM_SAMPLES];
+  size_t _adpcmFill;
+
+  volatile uint32_t _files, _bytesWritten, _writes, _maxWriteMs,
+      _writeErrors, _overruns;
+
+  void send(Command cmd, const char *name = nullptr);
+  void handle(const RecCommand &c);
+  void process(const int16_t *frame, size_t count);
+  bool checkVAD(const int16_t *samples, size_t count) const;
+  bool openReader();
+  void releaseReader(); // Só se não há arquivo nem gatilho
+
+  void pushPreRoll(const int16_t *samples, size_t count);
+  void flushPreRoll();
 
-  static const int SAMPLE_RATE = 16000;
-  static const int BUFFER_SIZE = 512;
-  int16_t _buffer[BUFFER_SIZE];
+  bool openFile(const char *name, bool triggered);
+  void closeFile();
+  void append(const int16_t *pcm, size_t count);
+  void encodeAdpcmBlock();
+  void writeBlock();
+  void writeHeader(uint32_t samples);
 
-  void writeWavHeader(File &file, int sampleRate);
-  void updateWavHeader(File &file);
-  bool checkVAD(int16_t *samples, int count);
+  static void buildHeader(uint8_t *h, RecFormat format, uint32_t dataBytes,
+                          uint32_t samples);
+  static void repair(const char *path);
+  static void taskEntry(void *param);
 };
 
 extern VoiceRecorder voiceRecorder;
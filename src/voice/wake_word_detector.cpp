@@ -1,165 +1,224 @@
 /**
  * @file wake_word_detector.cpp
  * @brief Neural Wake Word Detector implementation
- * 
- * Uses TFLite Micro to detect "Hey Dragon" wake word from MFCC features.
+ *
+ * Uses TFLite Micro to detect "Hey Dragon" wake word from log-mel features
+ * computed by the TFLite microfrontend (streaming, fixed point).
  */
 
 #include "wake_word_detector.h"
+#include "../ai/model_runtime.h"
 #include "../ai/models/wake_word_model.h"
+#include "../hardware/audio_capture.h"
 #include <Arduino.h>
-#include <math.h>
+#include <tensorflow/lite/experimental/microfrontend/lib/frontend.h>
 
-// TFLite Micro includes
-// Note: These require tensorflow-lite-micro library to be installed
-// #include "tensorflow/lite/micro/micro_interpreter.h"
-// #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-// #include "tensorflow/lite/schema/schema_generated.h"
+#define WAKE_PRIORITY 3        // Acima do NEURA9: resposta ao usuário
+#define WAKE_DEADLINE_US 100000
+#define WAKE_TIMEOUT_MS 200
 
-#define ARENA_SIZE (32 * 1024) // 32KB for tensor arena
-#define MFCC_FRAME_SIZE 512    // Samples per MFCC frame
+// uint16 do frontend -> float do treino (micro_speech: valor * 10 / 256)
+#define WAKE_FEATURE_SCALE (10.0f / 256.0f)
+
+#define WAKE_FRAME_FLOATS WAKE_WORD_MFCC_FEATURES
+#define WAKE_HISTORY_FLOATS (WAKE_WORD_MFCC_FEATURES * WAKE_WORD_TIME_STEPS)
+
+static_assert(WAKE_FRONTEND_CHANNELS == WAKE_WORD_MFCC_FEATURES,
+              "frontend e modelo com número de canais diferente");
+static_assert(AUDIO_CAPTURE_RATE == WAKE_WORD_SAMPLE_RATE,
+              "captura fora da taxa do frontend");
 
 WakeWordDetector wakeWordDetector;
 
 WakeWordDetector::WakeWordDetector()
     : _initialized(false), _enabled(true), _lastConfidence(0),
-      _mfccBuffer(nullptr), _mfccBufferPos(0), _interpreter(nullptr), 
-      _tensorArena(nullptr) {}
+      _frontend(nullptr), _history(nullptr), _head(0), _frames(0),
+      _sinceInfer(0), _frameCount(0), _modelId(-1), _task(NULL),
+      _listening(false), _detected(false) {}
 
 WakeWordDetector::~WakeWordDetector() {
-    if (_mfccBuffer) free(_mfccBuffer);
-    if (_tensorArena) free(_tensorArena);
+    if (_frontend) {
+        FrontendFreeStateContents(_frontend);
+        free(_frontend);
+    }
+    if (_history) free(_history);
 }
 
 bool WakeWordDetector::begin() {
     Serial.println("[WAKE] Initializing Neural Wake Word Detector...");
-    
-    // Allocate MFCC buffer on PSRAM
-    _mfccBuffer = (float*)ps_malloc(WAKE_WORD_MFCC_FEATURES * WAKE_WORD_TIME_STEPS * sizeof(float));
-    if (!_mfccBuffer) {
-        Serial.println("[WAKE] ERROR: Failed to allocate MFCC buffer!");
-        return false;
-    }
-    memset(_mfccBuffer, 0, WAKE_WORD_MFCC_FEATURES * WAKE_WORD_TIME_STEPS * sizeof(float));
-    
-    // Allocate tensor arena on PSRAM
-    _tensorArena = (uint8_t*)ps_malloc(ARENA_SIZE);
-    if (!_tensorArena) {
-        Serial.println("[WAKE] ERROR: Failed to allocate tensor arena!");
+
+    // Mesmos parâmetros de ai_training/wake_word_features.py
+    FrontendConfig config;
+    wakeWordFrontendConfig(&config);
+
+    _frontend = (FrontendState*)calloc(1, sizeof(FrontendState));
+    if (!_frontend ||
+        !FrontendPopulateState(&config, _frontend, WAKE_WORD_SAMPLE_RATE)) {
+        Serial.println("[WAKE] ERROR: Failed to init audio frontend!");
+        free(_frontend);
+        _frontend = nullptr;
         return false;
     }
-    
-    // Initialize TFLite Micro
-    // Note: This is placeholder code - full implementation requires TFLite library
-    /*
-    const tflite::Model* model = tflite::GetModel(WAKE_WORD_MODEL);
-    
-    static tflite::MicroMutableOpResolver<10> resolver;
-    resolver.AddConv2D();
-    resolver.AddMaxPool2D();
-    resolver.AddFullyConnected();
-    resolver.AddSoftmax();
-    resolver.AddReshape();
-    
-    static tflite::MicroInterpreter static_interpreter(
-        model, resolver, _tensorArena, ARENA_SIZE);
-    
-    _interpreter = &static_interpreter;
-    
-    if (static_interpreter.AllocateTensors() != kTfLiteOk) {
-        Serial.println("[WAKE] ERROR: AllocateTensors failed!");
+
+    // Anel espelhado em PSRAM (~15 KB)
+    _history = (float*)ps_malloc(2 * WAKE_HISTORY_FLOATS * sizeof(float));
+    if (!_history) {
+        Serial.println("[WAKE] ERROR: Failed to allocate feature history!");
         return false;
     }
-    */
-    
-    Serial.println("[WAKE] Neural detector ready (placeholder model)");
-    Serial.printf("[WAKE] MFCC Buffer: %d features x %d steps\n", 
-                  WAKE_WORD_MFCC_FEATURES, WAKE_WORD_TIME_STEPS);
-    
+    reset();
+
+    // Arena compartilhada com os outros modelos (ModelRuntime): o
+    // placeholder não é um flatbuffer válido e fica de fora
+    _modelId = modelRuntime.registerModel("wake_word", WAKE_WORD_MODEL,
+                                          WAKE_WORD_MODEL_LEN, WAKE_PRIORITY,
+                                          WAKE_DEADLINE_US);
+
+    Serial.println(_modelId >= 0 ? "[WAKE] Neural detector ready"
+                                 : "[WAKE] Neural detector ready (placeholder model)");
+    Serial.printf("[WAKE] Frontend: %d ch x %d frames (%d ms / %d ms)\n",
+                  WAKE_WORD_MFCC_FEATURES, WAKE_WORD_TIME_STEPS,
+                  WAKE_WINDOW_MS, WAKE_STRIDE_MS);
+
     _initialized = true;
     return true;
 }
 
-// Simple MFCC extraction (placeholder - real implementation needs FFT + mel filterbank)
-void WakeWordDetector::extractMFCC(const int16_t* audio, size_t len, float* mfccOut) {
-    // Placeholder: Just compute energy and some basic features
-    // Real MFCC requires:
-    // 1. Pre-emphasis filter
-    // 2. Windowing (Hamming)
-    // 3. FFT
-    // 4. Mel filterbank
-    // 5. Log compression
-    // 6. DCT
-    
-    float energy = 0;
-    for (size_t i = 0; i < len; i++) {
-        energy += (float)audio[i] * audio[i];
-    }
-    energy = sqrtf(energy / len) / 32768.0f; // Normalize
-    
-    // Fill MFCC output with placeholder values
-    for (int i = 0; i < WAKE_WORD_MFCC_FEATURES; i++) {
-        mfccOut[i] = energy * (i + 1) / WAKE_WORD_MFCC_FEATURES; // Fake gradient
+void WakeWordDetector::reset() {
+    if (_frontend) FrontendReset(_frontend);
+    if (_history) memset(_history, 0, 2 * WAKE_HISTORY_FLOATS * sizeof(float));
+    _head = 0;
+    _frames = 0;
+    _sinceInfer = 0;
+}
+
+void WakeWordDetector::pushFeatures(const uint16_t* values, size_t count) {
+    float* slot = _history + _head * WAKE_FRAME_FLOATS;
+    for (size_t i = 0; i < WAKE_FRAME_FLOATS; i++) {
+        slot[i] = i < count ? values[i] * WAKE_FEATURE_SCALE : 0.0f;
     }
+    // Cópia espelhada: a visão a partir de qualquer base fica contígua
+    memcpy(slot + WAKE_HISTORY_FLOATS, slot, WAKE_FRAME_FLOATS * sizeof(float));
+
+    _head = (_head + 1) % WAKE_WORD_TIME_STEPS;
+    if (_frames < WAKE_WORD_TIME_STEPS) _frames++;
+    _sinceInfer++;
+    _frameCount++;
 }
 
 float WakeWordDetector::runInference() {
-    if (!_interpreter) {
-        // Placeholder: Random confidence for testing
-        return (float)random(0, 100) / 100.0f;
+    if (_modelId < 0) {
+        return 0.0f; // Placeholder: sem modelo nunca dispara
     }
-    
-    // Real TFLite inference would happen here
-    /*
-    auto* interpreter = (tflite::MicroInterpreter*)_interpreter;
-    
-    // Copy MFCC buffer to input tensor
-    float* input = interpreter->input(0)->data.f;
-    memcpy(input, _mfccBuffer, WAKE_WORD_MFCC_FEATURES * WAKE_WORD_TIME_STEPS * sizeof(float));
-    
-    // Run inference
-    if (interpreter->Invoke() != kTfLiteOk) {
+
+    // Roda na task de IA (index 0 = not wake word, index 1 = wake word)
+    // Visão [mais antigo .. mais recente] começa na base do anel
+    float scores[2];
+    if (!modelRuntime.invoke(_modelId, _history + _head * WAKE_FRAME_FLOATS,
+                             WAKE_HISTORY_FLOATS, scores, 2,
+                             WAKE_TIMEOUT_MS)) {
         return 0.0f;
     }
-    
-    // Get output (assume index 0 = not wake word, index 1 = wake word)
-    float* output = interpreter->output(0)->data.f;
-    return output[1]; // Confidence for wake word class
-    */
-    
-    return 0.0f; // Placeholder
+    return scores[1]; // Confidence for wake word class
 }
 
 bool WakeWordDetector::processAudioFrame(const int16_t* audioData, size_t sampleCount) {
     if (!_initialized || !_enabled) return false;
-    
-    // Extract MFCC for this frame
-    float mfcc[WAKE_WORD_MFCC_FEATURES];
-    extractMFCC(audioData, sampleCount, mfcc);
-    
-    // Shift MFCC buffer (sliding window)
-    memmove(_mfccBuffer, _mfccBuffer + WAKE_WORD_MFCC_FEATURES, 
-            (WAKE_WORD_TIME_STEPS - 1) * WAKE_WORD_MFCC_FEATURES * sizeof(float));
-    
-    // Add new MFCC frame at end
-    memcpy(_mfccBuffer + (WAKE_WORD_TIME_STEPS - 1) * WAKE_WORD_MFCC_FEATURES, 
-           mfcc, WAKE_WORD_MFCC_FEATURES * sizeof(float));
-    
-    _mfccBufferPos++;
-    
-    // Only run inference after buffer is full
-    if (_mfccBufferPos < WAKE_WORD_TIME_STEPS) {
+
+    // Streaming: o frontend guarda a sobreposição entre blocos, cada 20 ms
+    // de áudio vira um frame
+    while (sampleCount > 0) {
+        size_t used = 0;
+        FrontendOutput out = FrontendProcessSamples(_frontend, audioData,
+                                                    sampleCount, &used);
+        audioData += used;
+        sampleCount -= used;
+        if (out.values) {
+            pushFeatures(out.values, out.size);
+        }
+        if (used == 0) break;
+    }
+
+    // Only run inference after buffer is full, at most once per call
+    if (_frames < WAKE_WORD_TIME_STEPS || _sinceInfer < WAKE_INFER_STRIDE) {
         return false;
     }
-    
+    _sinceInfer = 0;
+
     // Run neural network inference
     _lastConfidence = runInference();
-    
+
     if (_lastConfidence >= WAKE_WORD_THRESHOLD) {
         Serial.printf("[WAKE] Wake word detected! Confidence: %.2f\n", _lastConfidence);
-        _mfccBufferPos = 0; // Reset buffer
+        // Histórico recomeça: a mesma palavra não dispara de novo
+        _frames = 0;
         return true;
     }
-    
+
     return false;
 }
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TASK DE ESCUTA
+// ═══════════════════════════════════════════════════════════════════════════
+
+bool WakeWordDetector::start() {
+    if (!_initialized) return false;
+    if (_modelId < 0) {
+        Serial.println("[WAKE] Sem modelo: fica o detector de energia");
+        return false;
+    }
+    _listening = true;
+    if (_task) {
+        xTaskNotifyGive(_task);
+        return true;
+    }
+    // Core 0 com a task de IA: a inferência roda lá e esta só espera
+    if (xTaskCreatePinnedToCore(taskEntry, "Wake_Word", 4096, this, 2, &_task,
+                                0) != pdPASS) {
+        _task = NULL;
+        _listening = false;
+        Serial.println("[WAKE] Falha ao criar task");
+        return false;
+    }
+    return true;
+}
+
+void WakeWordDetector::stop() {
+    // A task fecha o cursor na próxima volta (no máximo uma leitura)
+    _listening = false;
+}
+
+void WakeWordDetector::taskEntry(void* arg) {
+    static_cast<WakeWordDetector*>(arg)->taskLoop();
+}
+
+void WakeWordDetector::taskLoop() {
+    int16_t block[WAKE_READ_SAMPLES];
+    int reader = -1;
+
+    while (true) {
+        if (!_listening) {
+            if (reader >= 0) {
+                audioCapture.closeReader(reader);
+                reader = -1;
+            }
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        if (reader < 0) {
+            // Cursor próprio: assistente e gravador continuam ouvindo junto
+            reader = audioCapture.openReader("wake");
+            if (reader < 0) {
+                Serial.println("[WAKE] Sem cursor livre na captura");
+                _listening = false;
+                continue;
+            }
+            reset(); // Não junta áudio de antes do stop()
+        }
+        size_t n = audioCapture.read(reader, block, WAKE_READ_SAMPLES, 100);
+        if (n > 0 && processAudioFrame(block, n)) {
+            _detected = true;
+        }
+    }
+}
@@ -2,45 +2,91 @@
 /**
  * @file wake_word_detector.h
  * @brief Neural Wake Word Detector using TFLite Micro
+ *
+ * Features: microfrontend do TFLite (FFT de ponto fixo, filterbank mel,
+ * redução de ruído, PCAN, log), janelas de 30 ms a cada 20 ms, 40 canais.
+ * Mesma configuração de ai_training/wake_word_features.py: o modelo vê no
+ * device exatamente o que viu no treino.
+ *
+ * O histórico de frames é um anel espelhado (cada frame gravado duas vezes):
+ * os últimos WAKE_WORD_TIME_STEPS frames ficam contíguos e vão direto para o
+ * modelo, sem memmove por frame.
+ *
+ * start() sobe uma task que lê um cursor próprio da captura (audioCapture) e
+ * alimenta processAudioFrame; o assistente de voz só consome a detecção.
+ * Sem modelo carregado (placeholder) a confiança é 0 e a task nem sobe.
  */
 
+#include "wake_word_frontend.h"
 #include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#define WAKE_INFER_STRIDE 2 // Frames novos entre inferências (40 ms)
+#define WAKE_READ_SAMPLES 320 // Um passo do frontend (20 ms) por leitura
 
 class WakeWordDetector {
 public:
     WakeWordDetector();
     ~WakeWordDetector();
-    
-    // Initialize TFLite model
+
+    // Initialize frontend + TFLite model
     bool begin();
-    
-    // Process audio frame and check for wake word
+
+    // Process audio (16 kHz mono, qualquer tamanho de bloco)
     // Returns true if wake word detected
     bool processAudioFrame(const int16_t* audioData, size_t sampleCount);
-    
+
+    // Zera o frontend e o histórico (ex.: ao reabrir o microfone)
+    void reset();
+
+    // Escuta o microfone numa task própria (false sem modelo carregado)
+    bool start();
+    // Fecha o cursor da captura; a task dorme até o próximo start()
+    void stop();
+    bool isListening() const { return _listening; }
+
+    // Detecção desde a última chamada (limpa ao ler)
+    bool takeDetection() { return _detected.exchange(false); }
+
+    bool hasModel() const { return _modelId >= 0; }
+
     // Get confidence of last detection
     float getLastConfidence() const { return _lastConfidence; }
-    
+
     // Enable/disable detection
     void setEnabled(bool enabled) { _enabled = enabled; }
     bool isEnabled() const { return _enabled; }
 
+    uint32_t getFrameCount() const { return _frameCount; }
+
 private:
     bool _initialized;
     bool _enabled;
     float _lastConfidence;
-    
-    // MFCC feature buffer
-    float* _mfccBuffer;
-    int _mfccBufferPos;
-    
-    // TFLite components (forward declared)
-    void* _interpreter; // Actually tflite::MicroInterpreter*
-    uint8_t* _tensorArena;
-    
+
+    FrontendState* _frontend;
+
+    // Anel espelhado: 2 * WAKE_WORD_TIME_STEPS frames de features
+    float* _history;
+    uint8_t _head;      // Frame mais antigo da visão = próximo a sobrescrever
+    uint8_t _frames;    // Frames válidos (até WAKE_WORD_TIME_STEPS)
+    uint8_t _sinceInfer;
+    uint32_t _frameCount;
+
+    // Modelo no ModelRuntime (arena compartilhada, roda na task de IA)
+    int _modelId;
+
+    TaskHandle_t _task;
+    volatile bool _listening;
+    std::atomic<bool> _detected;
+
     // Internal methods
-    void extractMFCC(const int16_t* audio, size_t len, float* mfccOut);
+    void pushFeatures(const uint16_t* values, size_t count);
     float runInference();
+    static void taskEntry(void* arg);
+    void taskLoop();
 };
 
 extern WakeWordDetector wakeWordDetector;
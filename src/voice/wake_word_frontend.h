@@ -0,0 +1,32 @@
+#pragma once
+/**
+ * @file wake_word_frontend.h
+ * @brief Configuração do microfrontend do wake word (device e teste no host)
+ *
+ * Única fonte dos parâmetros do lado C. Os mesmos valores estão em
+ * ai_training/wake_word_features.py; test/test_wake_word_features confere
+ * as duas saídas nos clipes exportados pelo script.
+ */
+
+#include <tensorflow/lite/experimental/microfrontend/lib/frontend_util.h>
+
+#define WAKE_WORD_SAMPLE_RATE 16000
+#define WAKE_WINDOW_MS 30
+#define WAKE_STRIDE_MS 20
+#define WAKE_FRONTEND_CHANNELS 40
+
+inline void wakeWordFrontendConfig(FrontendConfig* config) {
+    FrontendFillConfigWithDefaults(config);
+    config->window.size_ms = WAKE_WINDOW_MS;
+    config->window.step_size_ms = WAKE_STRIDE_MS;
+    config->filterbank.num_channels = WAKE_FRONTEND_CHANNELS;
+    config->filterbank.lower_band_limit = 125.0f;
+    config->filterbank.upper_band_limit = 7500.0f;
+    config->noise_reduction.smoothing_bits = 10;
+    config->pcan_gain_control.enable_pcan = 1;
+    config->pcan_gain_control.strength = 0.95f;
+    config->pcan_gain_control.offset = 80.0f;
+    config->pcan_gain_control.gain_bits = 21;
+    config->log_scale.enable_log = 1;
+    config->log_scale.scale_shift = 6;
+}
@@ -1,5 +1,12 @@
 #include "web_server.h"
+#include "../ai/ai_manager.h"
+#include "../ai/ai_scheduler.h"
+#include "../ai/data_collector.h"
+#include "../ai/model_runtime.h"
+#include "../ai/neura9_inference.h"
 #include "../core/config_manager.h"
+#include "../hardware/audio_capture.h"
+#include "../hardware/audio_engine.h"
 #include "../hardware/ble_driver.h"
 #include "../hardware/system_hardware.h"
 #include "../hardware/wifi_driver.h"
@@ -19,6 +26,7 @@
 #include <FS.h>
 #include <LittleFS.h>
 #include <Update.h>
+#include <memory>
 
 #define WEB_USER "admin"
 #define WEB_PASS "pwned"
@@ -762,6 +770,198 @@ void WebInterface::setupRoutes() {
     request->send(200, "application/json", "{\"status\":\"saved\"}");
   });
 
+  // Benchmark NEURA9: latência, arena e tempo por op; com dataset= roda
+  // também o CSV rotulado do SD (ai_training/tools/export_eval_csv.py).
+  // Até 2000 invokes + 2000 linhas não cabem no AsyncTCP: o POST só enfileira
+  // para a task de IA e o GET devolve o resultado (202 enquanto roda).
+  server.on("/api/ai/bench", HTTP_POST, [](AsyncWebServerRequest *request) {
+    if (!request->authenticate(WEB_USER, WEB_PASS))
+      return request->requestAuthentication();
+    uint16_t iterations = 200;
+    if (request->hasParam("n", true)) {
+      iterations =
+          constrain(request->getParam("n", true)->value().toInt(), 1, 2000);
+    }
+    String dataset;
+    if (request->hasParam("dataset", true)) {
+      dataset = request->getParam("dataset", true)->value();
+    }
+    if (!aiManager.requestBenchmark(iterations, dataset.c_str())) {
+      request->send(503, "application/json", "{\"error\":\"busy\"}");
+      return;
+    }
+    request->send(202, "application/json", "{\"status\":\"queued\"}");
+  });
+
+  server.on("/api/ai/bench", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!request->authenticate(WEB_USER, WEB_PASS))
+      return request->requestAuthentication();
+    const AiBenchJob &job = aiManager.getBenchJob();
+    AiBenchState state = job.state;
+    if (state == AI_BENCH_IDLE) {
+      request->send(404, "application/json", "{\"status\":\"idle\"}");
+      return;
+    }
+    if (state != AI_BENCH_DONE) {
+      request->send(202, "application/json",
+                    state == AI_BENCH_QUEUED ? "{\"status\":\"queued\"}"
+                                             : "{\"status\":\"running\"}");
+      return;
+    }
+    if (!job.ok) {
+      request->send(503, "application/json", "{\"error\":\"neura9\"}");
+      return;
+    }
+
+    const Neura9BenchResult &bench = job.bench;
+    DynamicJsonDocument doc(4096);
+    doc["status"] = "done";
+    doc["elapsed_ms"] = job.elapsedMs;
+    doc["iterations"] = bench.iterations;
+    doc["p50_us"] = bench.p50Us;
+    doc["p90_us"] = bench.p90Us;
+    doc["p99_us"] = bench.p99Us;
+    doc["max_us"] = bench.maxUs;
+    doc["arena_size"] = bench.arenaSize;
+    doc["arena_used"] = bench.arenaUsed;
+    doc["arena_needed"] = bench.arenaNeeded;
+    doc["arena_recommended"] = bench.arenaRecommended;
+    doc["arena_ok"] = bench.arenaOk;
+    doc["arena_place"] =
+        NEURA9Inference::placementName(neura9.getArenaPlacement());
+    doc["weights_place"] =
+        NEURA9Inference::placementName(neura9.getWeightsPlacement());
+    doc["sequence_steps"] = neura9.getSequence().getSteps();
+    JsonArray ops = doc.createNestedArray("ops");
+    for (uint8_t i = 0; i < bench.opCount; i++) {
+      JsonObject op = ops.createNestedObject();
+      op["tag"] = bench.ops[i].tag;
+      op["total_us"] = bench.ops[i].totalUs;
+      op["calls"] = bench.ops[i].calls;
+    }
+
+    if (job.evalOk) {
+      const Neura9EvalResult &eval = job.eval;
+      JsonObject e = doc.createNestedObject("eval");
+      e["dataset"] = job.dataset;
+      e["samples"] = eval.samples;
+      e["correct"] = eval.correct;
+      e["skipped"] = eval.skipped;
+      JsonArray rows = e.createNestedArray("confusion");
+      for (uint8_t r = 0; r < eval.classes; r++) {
+        JsonArray row = rows.createNestedArray();
+        for (uint8_t c = 0; c < eval.classes; c++) {
+          row.add(eval.confusion[r][c]);
+        }
+      }
+    }
+
+    String response;
+    serializeJson(doc, response);
+    request->send(bench.arenaOk ? 200 : 409, "application/json", response);
+  });
+
+  // Agendador da task de IA: contadores por decisão e últimas decisões
+  server.on("/api/ai/scheduler", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!request->authenticate(WEB_USER, WEB_PASS))
+      return request->requestAuthentication();
+    AiSchedulerStats stats = aiScheduler.getStats();
+    AiDecisionRecord history[AiScheduler::HISTORY];
+    uint8_t count = aiScheduler.getHistory(history, AiScheduler::HISTORY);
+
+    DynamicJsonDocument doc(3072);
+    doc["mode"] = AiScheduler::modeName(stats.mode);
+    doc["boosted"] = stats.boosted;
+    doc["boosts"] = stats.boosts;
+    doc["skipped"] = stats.decisions[AI_DECISION_SKIPPED];
+    doc["cached"] = stats.decisions[AI_DECISION_CACHED];
+    doc["run"] = stats.decisions[AI_DECISION_RUN];
+    doc["last_invoke_us"] = stats.lastInvokeUs;
+    doc["max_invoke_us"] = stats.maxInvokeUs;
+    doc["last_window_age_us"] = stats.lastWindowAgeUs;
+    doc["max_window_age_us"] = stats.maxWindowAgeUs;
+    JsonArray recent = doc.createNestedArray("recent");
+    for (uint8_t i = 0; i < count; i++) {
+      JsonObject r = recent.createNestedObject();
+      r["t"] = history[i].timeMs;
+      r["decision"] = AiScheduler::decisionName(history[i].decision);
+      r["mode"] = AiScheduler::modeName(history[i].mode);
+      r["invoke_us"] = history[i].invokeUs;
+      r["window_age_us"] = history[i].windowAgeUs;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
+
+  // ModelRuntime: arena compartilhada e latência/prazo por modelo
+  server.on("/api/ai/runtime", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!request->authenticate(WEB_USER, WEB_PASS))
+      return request->requestAuthentication();
+    DynamicJsonDocument doc(2048);
+    doc["arena_size"] = modelRuntime.getArenaSize();
+    int resident = modelRuntime.getResident();
+    JsonArray models = doc.createNestedArray("models");
+    for (uint8_t i = 0; i < modelRuntime.getModelCount(); i++) {
+      ModelRuntimeInfo info;
+      if (!modelRuntime.getInfo(i, &info))
+        continue;
+      JsonObject m = models.createNestedObject();
+      m["name"] = info.name;
+      m["priority"] = info.priority;
+      m["deadline_us"] = info.deadlineUs;
+      m["arena_used"] = info.arenaUsed;
+      m["own_arena"] = info.resident;
+      m["loaded"] = info.resident || resident == i;
+      m["invokes"] = info.stats.invokes;
+      m["failures"] = info.stats.failures;
+      m["switches"] = info.stats.switches;
+      m["last_us"] = info.stats.lastUs;
+      m["max_us"] = info.stats.maxUs;
+      m["last_latency_us"] = info.stats.lastLatencyUs;
+      m["max_latency_us"] = info.stats.maxLatencyUs;
+      m["deadline_misses"] = info.stats.deadlineMisses;
+    }
+    String response;
+    serializeJson(doc, response);
+    request->send(200, "application/json", response);
+  });
+
+  // Tip 26: dados de treino em streaming direto do log binário
+  // (?format=bin baixa os registros crus com um DataLogHeader na frente)
+  server.on("/api/ai/data", HTTP_GET, [](AsyncWebServerRequest *request) {
+    if (!request->authenticate(WEB_USER, WEB_PASS))
+      return request->requestAuthentication();
+    bool csv = !(request->hasParam("format") &&
+                 request->getParam("format")->value() == "bin");
+    // Cliente que desconecta no meio também encerra a exportação
+    std::shared_ptr<DataCollector::ExportCursor> cursor(
+        new DataCollector::ExportCursor(),
+        [](DataCollector::ExportCursor *c) {
+          dataCollector.endExport(*c);
+          delete c;
+        });
+    dataCollector.beginExport(*cursor, csv);
+    AsyncWebServerResponse *response = request->beginChunkedResponse(
+        csv ? "text/csv" : "application/octet-stream",
+        [cursor](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+          return dataCollector.readExport(*cursor, buffer, maxLen);
+        });
+    response->addHeader("Content-Disposition",
+                        csv ? "attachment; filename=neura9_samples.csv"
+                            : "attachment; filename=neura9_samples.bin");
+    request->send(response);
+  });
+
+  server.on("/api/ai/data/clear", HTTP_POST,
+            [](AsyncWebServerRequest *request) {
+              if (!request->authenticate(WEB_USER, WEB_PASS))
+                return request->requestAuthentication();
+              dataCollector.cleanOldData();
+              request->send(200, "application/json", "{\"status\":\"ok\"}");
+            });
+
   // ═══════════════════════════════════════════════════════════════════════════
   // WALLPAPER APIs
   // ═══════════════════════════════════════════════════════════════════════════
@@ -850,6 +1050,55 @@ void WebInterface::setupRoutes() {
               }
             });
 
+  // Motor de áudio: underruns, descartes e profundidade da fila
+  server.on("/api/sounds/engine", HTTP_GET,
+            [](AsyncWebServerRequest *request) {
+              AudioEngineStats st = audioEngine.getStats();
+              DynamicJsonDocument doc(512);
+              doc["running"] = audioEngine.isRunning();
+              doc["playing"] = audioEngine.isPlaying();
+              doc["blocks"] = st.blocks;
+              doc["underruns"] = st.underruns;
+              doc["dropped"] = st.dropped;
+              doc["rejected"] = st.rejected;
+              doc["stolen"] = st.stolen;
+              doc["commands"] = st.commands;
+              doc["voices"] = st.voices;
+              doc["mix_cycles"] = st.lastMixCycles;
+              doc["mix_cycles_max"] = st.maxMixCycles;
+              doc["queue_depth"] = st.queueDepth;
+              doc["ring_fill"] = st.ringFill;
+              String response;
+              serializeJson(doc, response);
+              request->send(200, "application/json", response);
+            });
+
+  server.on("/api/sounds/capture", HTTP_GET,
+            [](AsyncWebServerRequest *request) {
+              AudioCaptureStats st = audioCapture.getStats();
+              DynamicJsonDocument doc(1024);
+              doc["running"] = audioCapture.isRunning();
+              doc["frames"] = st.frames;
+              doc["errors"] = st.errors;
+              doc["process_us"] = st.lastUs;
+              doc["peak"] = st.peak;
+              doc["dc_offset"] = st.dcOffset;
+              JsonArray readers = doc.createNestedArray("readers");
+              for (int i = 0; i < AUDIO_CAPTURE_READERS; i++) {
+                AudioCaptureReaderStats rs;
+                if (!audioCapture.getReaderStats(i, &rs))
+                  continue;
+                JsonObject r = readers.createNestedObject();
+                r["name"] = rs.name;
+                r["overruns"] = rs.overruns;
+                r["dropped"] = rs.dropped;
+                r["pending"] = rs.pending;
+              }
+              String response;
+              serializeJson(doc, response);
+              request->send(200, "application/json", response);
+            });
+
   // ═══════════════════════════════════════════════════════════════════════════
   // NOTIFICATIONS APIs
   // ═══════════════════════════════════════════════════════════════════════════
@@ -56,7 +56,8 @@ void EspNowMesh::processPacket(const uint8_t *mac, const uint8_t *data,
     return;
 
   const MeshHeader *header = (const MeshHeader *)data;
-  if (header->magic != MESH_MAGIC || header->version != MESH_VERSION)
+  if (header->magic != MESH_MAGIC || header->version < MESH_VERSION_MIN ||
+      header->version > MESH_VERSION)
     return;
 
   const uint8_t *payload = data + sizeof(MeshHeader);
@@ -64,8 +65,11 @@ void EspNowMesh::processPacket(const uint8_t *mac, const uint8_t *data,
 
   switch (header->type) {
   case MESH_TYPE_AUDIO:
-    if (_audioCb) {
-      // For now pass raw payload, later handle codec
+    // Cabeçalho de áudio completo; o codec é tratado por quem recebe. Áudio
+    // de versão anterior tem outro layout
+    if (_audioCb && header->version == MESH_VERSION &&
+        payloadSize >= MESH_AUDIO_HEADER_LEN &&
+        payloadSize <= sizeof(MeshAudioPayload)) {
       _audioCb(mac, payload, payloadSize);
     }
     break;
@@ -125,9 +129,9 @@ bool EspNowMesh::send(const uint8_t *mac, const void *data, size_t len) {
   return esp_now_send(mac, (const uint8_t *)data, len) == ESP_OK;
 }
 
-bool EspNowMesh::sendAudio(const uint8_t *audioData, size_t len) {
-  if (len > 230)
-    return false; // Safety margin
+bool EspNowMesh::sendAudio(const MeshAudioPayload *audio, size_t len) {
+  if (!audio || len < MESH_AUDIO_HEADER_LEN || len > sizeof(MeshAudioPayload))
+    return false;
 
   uint8_t buffer[250];
   MeshHeader *header = (MeshHeader *)buffer;
@@ -137,9 +141,7 @@ bool EspNowMesh::sendAudio(const uint8_t *audioData, size_t len) {
   header->payloadLen = len;
   header->timestamp = millis();
 
-  // TODO: Actually fill a MeshAudioPayload struct
-  // For now direct copy for speed test
-  memcpy(buffer + sizeof(MeshHeader), audioData, len);
+  memcpy(buffer + sizeof(MeshHeader), audio, len);
 
   return broadcast(buffer, sizeof(MeshHeader) + len);
 }
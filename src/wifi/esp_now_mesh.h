@@ -7,7 +7,10 @@
 
 // ESP-NOW Mesh Protocol Definitions
 #define MESH_MAGIC 0xFE7E // "LELE" stylized as valid hex
-#define MESH_VERSION 1
+// 2: MeshAudioPayload com samples e estado do ADPCM (a v1 mandava PCM cru
+// logo após o cabeçalho, sem campo de codec)
+#define MESH_VERSION 2
+#define MESH_VERSION_MIN 1 // Chat e ping da v1 têm o mesmo layout
 
 enum MeshMessageType : uint8_t {
   MESH_TYPE_PING = 0,
@@ -28,12 +31,24 @@ struct MeshHeader {
   uint32_t timestamp;
 };
 
+enum MeshAudioCodec : uint8_t {
+  MESH_AUDIO_PCM16 = 0, // 16-bit LE cru
+  MESH_AUDIO_ADPCM = 1  // IMA-ADPCM 4:1, estado no cabeçalho
+};
+
+#define MESH_AUDIO_MAX_BYTES 230 // Max ESP-NOW is 250 bytes total usually
+
 struct MeshAudioPayload {
-  uint8_t codec; // 0=RAW8, 1=ADPCM
-  uint16_t sequence;
-  uint8_t data[230]; // Max ESP-NOW is 250 bytes total usually
+  uint8_t codec;      // MeshAudioCodec
+  uint16_t sequence;  // +1 por pacote (reordenação e perda no receptor)
+  uint16_t samples;   // Amostras no pacote
+  int16_t predictor;  // ADPCM: estado do codificador no início do pacote,
+  uint8_t stepIndex;  // o decodificador ressincroniza a cada pacote
+  uint8_t data[MESH_AUDIO_MAX_BYTES];
 };
 
+#define MESH_AUDIO_HEADER_LEN (sizeof(MeshAudioPayload) - MESH_AUDIO_MAX_BYTES)
+
 struct MeshChatPayload {
   uint8_t isGroup;
   char sender[16];
@@ -47,6 +62,10 @@ struct MeshPingPayload {
 };
 #pragma pack(pop)
 
+static_assert(sizeof(MeshHeader) + sizeof(MeshAudioPayload) <=
+                  ESP_NOW_MAX_DATA_LEN,
+              "pacote de áudio maior que o ESP-NOW aceita");
+
 class EspNowMesh {
 public:
   EspNowMesh();
@@ -61,7 +80,8 @@ public:
   bool send(const uint8_t *mac, const void *data, size_t len);
 
   // Feature wrappers
-  bool sendAudio(const uint8_t *audioData, size_t len);
+  // len = MESH_AUDIO_HEADER_LEN + bytes usados em data
+  bool sendAudio(const MeshAudioPayload *audio, size_t len);
   bool sendChat(const char *message, bool global = true);
   bool sendPing();
 
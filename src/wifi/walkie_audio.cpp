@@ -0,0 +1,303 @@
+/**
+ * @file walkie_audio.cpp
+ * @brief Walkie-talkie: codec e jitter buffer (ver walkie_audio.h)
+ */
+
+#include "walkie_audio.h"
+#include "../hardware/audio_driver.h"
+
+WalkieAudio walkieAudio;
+
+static_assert(WALKIE_FRAME <= WALKIE_FRAME_MAX,
+              "bloco do walkie não cabe num pacote");
+static_assert((WALKIE_SLOTS & (WALKIE_SLOTS - 1)) == 0,
+              "WALKIE_SLOTS precisa ser potência de 2");
+
+WalkieAudio::WalkieAudio()
+    : _rxQueue(NULL), _active(false), _resetPending(false), _lastRxMs(0),
+      _txSeq(0), _depth(0), _target(WALKIE_TARGET_MIN), _buffering(true),
+      _haveSeq(false), _nextSeq(0), _lossRun(0), _minDepth(0xFF),
+      _adaptCount(0), _pcmPos(0), _pcmLen(0), _sent(0), _sendFailed(0),
+      _received(0), _dropped(0), _played(0), _lost(0), _late(0),
+      _duplicates(0), _concealed(0), _underruns(0), _skipped(0) {
+  memset(_talker, 0, sizeof(_talker));
+  memset(_slots, 0, sizeof(_slots));
+  imaAdpcmReset(_enc);
+}
+
+bool WalkieAudio::begin() {
+  if (_rxQueue)
+    return true;
+  _rxQueue = xQueueCreate(WALKIE_RX_QUEUE, sizeof(MeshAudioPayload));
+  if (!_rxQueue) {
+    Serial.println("[WALKIE] Falha ao criar fila de recepção");
+    return false;
+  }
+  Serial.printf("[WALKIE] ADPCM %u amostras/pacote, jitter %u-%u pacotes\n",
+                WALKIE_FRAME, WALKIE_TARGET_MIN, WALKIE_TARGET_MAX);
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TX
+// ═══════════════════════════════════════════════════════════════════════════
+
+void WalkieAudio::startTalking() { imaAdpcmReset(_enc); }
+
+bool WalkieAudio::sendFrame(const int16_t *pcm, size_t count) {
+  if (!pcm || count == 0 || count > WALKIE_FRAME_MAX)
+    return false;
+
+  MeshAudioPayload p;
+  p.codec = MESH_AUDIO_ADPCM;
+  p.sequence = _txSeq++;
+  p.samples = (uint16_t)count;
+  // Estado antes do bloco: o receptor decodifica o pacote sozinho
+  p.predictor = _enc.predictor;
+  p.stepIndex = _enc.index;
+  size_t bytes = imaAdpcmEncode(_enc, pcm, count, p.data);
+
+  bool ok = MeshSystem.sendAudio(&p, MESH_AUDIO_HEADER_LEN + bytes);
+  if (ok)
+    _sent++;
+  else
+    _sendFailed++;
+  return ok;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RX - CALLBACK DO ESP-NOW
+// ═══════════════════════════════════════════════════════════════════════════
+
+void WalkieAudio::receive(const uint8_t *mac, const uint8_t *data,
+                          size_t len) {
+  if (!_rxQueue || !mac || !data || len < MESH_AUDIO_HEADER_LEN ||
+      len > sizeof(MeshAudioPayload))
+    return;
+
+  MeshAudioPayload p;
+  memcpy(&p, data, len);
+  size_t dataLen = len - MESH_AUDIO_HEADER_LEN;
+  size_t need;
+  if (p.codec == MESH_AUDIO_ADPCM)
+    need = ((size_t)p.samples + 1) / 2;
+  else if (p.codec == MESH_AUDIO_PCM16)
+    need = (size_t)p.samples * 2;
+  else
+    return;
+  if (p.samples == 0 || p.samples > WALKIE_FRAME_MAX || need > dataLen)
+    return;
+
+  // Uma fala por vez
+  if (_active.load(std::memory_order_acquire) &&
+      memcmp(mac, _talker, sizeof(_talker)) != 0)
+    return;
+
+  _received++;
+  _lastRxMs = millis();
+  if (xQueueSend(_rxQueue, &p, 0) != pdTRUE) {
+    _dropped++;
+    return;
+  }
+
+  if (!_active.exchange(true, std::memory_order_acq_rel)) {
+    memcpy(_talker, mac, sizeof(_talker));
+    _resetPending.store(true, std::memory_order_release);
+    // Recusado (mudo, sem voz livre): o motor chama close()
+    audioDriver.playSource(this, WALKIE_RATE, AUDIO_PRIO_VOICE);
+  }
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// RX - JITTER BUFFER (TASK DE ÁUDIO)
+// ═══════════════════════════════════════════════════════════════════════════
+
+void WalkieAudio::resetRx() {
+  for (uint8_t i = 0; i < WALKIE_SLOTS; i++)
+    _slots[i].valid = false;
+  _depth = 0;
+  _target = WALKIE_TARGET_MIN;
+  _buffering = true;
+  _haveSeq = false;
+  _lossRun = 0;
+  _minDepth = 0xFF;
+  _adaptCount = 0;
+  _pcmPos = 0;
+  _pcmLen = 0;
+}
+
+void WalkieAudio::drainQueue() {
+  MeshAudioPayload p;
+  while (xQueueReceive(_rxQueue, &p, 0) == pdTRUE)
+    insert(p);
+}
+
+void WalkieAudio::insert(const MeshAudioPayload &p) {
+  if (!_haveSeq) {
+    _nextSeq = p.sequence;
+    _haveSeq = true;
+  }
+
+  int16_t ahead = (int16_t)(p.sequence - _nextSeq);
+  if (ahead < 0) {
+    // Nada tocado nesta fala ainda: o anterior chegou depois, recua
+    if (_buffering && _pcmLen == 0 && -ahead < WALKIE_SLOTS - _depth) {
+      _nextSeq = p.sequence;
+    } else {
+      _late++;
+      return;
+    }
+  } else if (ahead >= WALKIE_SLOTS) {
+    // Salto maior que o anel (transmissor reiniciou): recomeça daqui
+    for (uint8_t i = 0; i < WALKIE_SLOTS; i++)
+      _slots[i].valid = false;
+    _depth = 0;
+    _buffering = true;
+    _nextSeq = p.sequence;
+  }
+
+  Slot &s = _slots[p.sequence & (WALKIE_SLOTS - 1)];
+  if (s.valid) {
+    if (s.pkt.sequence == p.sequence) {
+      _duplicates++;
+      return;
+    }
+  } else {
+    _depth++;
+  }
+  s.valid = true;
+  s.pkt = p;
+}
+
+void WalkieAudio::decode(const MeshAudioPayload &p) {
+  size_t n = p.samples;
+  if (p.codec == MESH_AUDIO_ADPCM) {
+    ImaAdpcmState st;
+    imaAdpcmSetState(st, p.predictor, p.stepIndex);
+    imaAdpcmDecode(st, p.data, n, _pcm);
+  } else {
+    memcpy(_pcm, p.data, n * sizeof(int16_t));
+  }
+  _pcmLen = n;
+  _pcmPos = 0;
+}
+
+void WalkieAudio::conceal() {
+  _concealed++;
+  if (_pcmLen == 0)
+    _pcmLen = WALKIE_FRAME;
+  if (_lossRun++ >= WALKIE_CONCEAL_MAX) {
+    memset(_pcm, 0, _pcmLen * sizeof(int16_t));
+  } else {
+    // Repete o último pacote com metade do ganho
+    for (size_t i = 0; i < _pcmLen; i++)
+      _pcm[i] >>= 1;
+  }
+  _pcmPos = 0;
+}
+
+void WalkieAudio::adapt() {
+  if (_depth < _minDepth)
+    _minDepth = _depth;
+  if (++_adaptCount < WALKIE_ADAPT_PACKETS)
+    return;
+
+  // Nunca ficou com menos de 2 guardados: um pacote de latência sobrando
+  if (_minDepth >= 2) {
+    Slot &s = _slots[_nextSeq & (WALKIE_SLOTS - 1)];
+    if (s.valid && s.pkt.sequence == _nextSeq) {
+      s.valid = false;
+      _depth--;
+      _nextSeq++;
+      _skipped++;
+    }
+    if (_target > WALKIE_TARGET_MIN)
+      _target--;
+  }
+  _adaptCount = 0;
+  _minDepth = 0xFF;
+}
+
+bool WalkieAudio::nextPacket() {
+  if (_buffering) {
+    if (_depth < _target)
+      return false;
+    _buffering = false;
+  }
+
+  Slot &s = _slots[_nextSeq & (WALKIE_SLOTS - 1)];
+  if (s.valid && s.pkt.sequence == _nextSeq) {
+    decode(s.pkt);
+    s.valid = false;
+    _depth--;
+    _nextSeq++;
+    _lossRun = 0;
+    _played++;
+    adapt();
+    return true;
+  }
+
+  if (_depth > 0) {
+    // Um mais novo já chegou: este se perdeu
+    _lost++;
+    _nextSeq++;
+    conceal();
+    return true;
+  }
+
+  // Vazio: mais folga da próxima vez
+  _underruns++;
+  if (_target < WALKIE_TARGET_MAX)
+    _target++;
+  _buffering = true;
+  return false;
+}
+
+size_t WalkieAudio::read(int16_t *out, size_t count) {
+  if (_resetPending.exchange(false, std::memory_order_acq_rel))
+    resetRx();
+  drainQueue();
+
+  size_t n = 0;
+  while (n < count) {
+    if (_pcmPos >= _pcmLen && !nextPacket()) {
+      // Sem pacote pronto: fim da fala, ou silêncio enquanto acumula
+      if (millis() - _lastRxMs > WALKIE_IDLE_MS)
+        return n;
+      memset(out + n, 0, (count - n) * sizeof(int16_t));
+      return count;
+    }
+    size_t take = _pcmLen - _pcmPos;
+    if (take > count - n)
+      take = count - n;
+    memcpy(out + n, _pcm + _pcmPos, take * sizeof(int16_t));
+    _pcmPos += take;
+    n += take;
+  }
+  return n;
+}
+
+void WalkieAudio::close() {
+  // Sobras desta fala não entram na próxima
+  if (_rxQueue)
+    xQueueReset(_rxQueue);
+  _active.store(false, std::memory_order_release);
+}
+
+WalkieStats WalkieAudio::getStats() const {
+  WalkieStats st;
+  st.sent = _sent;
+  st.sendFailed = _sendFailed;
+  st.received = _received;
+  st.dropped = _dropped;
+  st.played = _played;
+  st.lost = _lost;
+  st.late = _late;
+  st.duplicates = _duplicates;
+  st.concealed = _concealed;
+  st.underruns = _underruns;
+  st.skipped = _skipped;
+  st.depth = _depth;
+  st.target = _target;
+  return st;
+}
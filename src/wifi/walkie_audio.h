@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file walkie_audio.h
+ * @brief Áudio do walkie-talkie sobre ESP-NOW: IMA-ADPCM + jitter buffer
+ *
+ * TX: cada bloco de WALKIE_FRAME amostras do microfone vira um pacote
+ * ADPCM (4 bits/amostra: 25 ms em 200 bytes, contra 7 ms em PCM cru) com
+ * número de sequência e o estado do codificador no início do pacote. Um
+ * pacote perdido não desalinha os seguintes.
+ *
+ * RX: o callback do ESP-NOW só valida e copia o pacote para uma fila. O
+ * resto roda na task de áudio: o receptor é uma AudioSource puxada pelo
+ * motor no ritmo do I2S.
+ * - Pacotes vão para um anel indexado pela sequência: fora de ordem cai no
+ *   slot certo; atrasado (já passou) ou repetido é descartado.
+ * - A reprodução começa com `target` pacotes guardados.
+ * - Pacote faltando com outros mais novos na fila = perda: repete o último
+ *   pacote com metade do ganho (até WALKIE_CONCEAL_MAX seguidos), depois
+ *   silêncio.
+ * - Fila vazia = underrun: o alvo sobe um pacote e volta a acumular.
+ * - Folga sobrando por WALKIE_ADAPT_PACKETS pacotes: descarta um pacote e
+ *   o alvo desce (a latência volta a cair).
+ * - Sem pacotes por WALKIE_IDLE_MS: fim da fala, o motor solta a fonte.
+ *
+ * Uma fala por vez: enquanto toca, pacotes de outro MAC são ignorados.
+ */
+
+#include "../hardware/audio_engine.h"
+#include "../hardware/ima_adpcm.h"
+#include "esp_now_mesh.h"
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#define WALKIE_RATE 16000
+#define WALKIE_FRAME 400            // Amostras por pacote (25 ms)
+#define WALKIE_FRAME_MAX (MESH_AUDIO_MAX_BYTES * 2)
+#define WALKIE_SLOTS 16             // Anel de pacotes (potência de 2)
+#define WALKIE_TARGET_MIN 2         // Pacotes guardados antes de tocar
+#define WALKIE_TARGET_MAX 8
+#define WALKIE_CONCEAL_MAX 3        // Repetições antes do silêncio
+#define WALKIE_ADAPT_PACKETS 80     // Janela para reduzir a folga (2 s)
+#define WALKIE_IDLE_MS 300
+#define WALKIE_RX_QUEUE 8
+
+struct WalkieStats {
+  uint32_t sent;
+  uint32_t sendFailed;
+  uint32_t received;
+  uint32_t dropped;    // Fila do callback cheia
+  uint32_t played;
+  uint32_t lost;       // Sequência que nunca chegou a tempo
+  uint32_t late;       // Chegou depois da vez (descartado)
+  uint32_t duplicates;
+  uint32_t concealed;  // Pacotes tocados por ocultação
+  uint32_t underruns;
+  uint32_t skipped;    // Descartados para reduzir a latência
+  uint8_t depth;       // Pacotes guardados agora
+  uint8_t target;
+};
+
+class WalkieAudio : public AudioSource {
+public:
+  WalkieAudio();
+
+  bool begin();
+
+  // ─── TX (task do walkie-talkie) ──────────────────────────────────────────
+  // Nova fala: codificador do zero
+  void startTalking();
+  // Codifica e transmite um bloco (count <= WALKIE_FRAME_MAX)
+  bool sendFrame(const int16_t *pcm, size_t count);
+
+  // ─── RX ──────────────────────────────────────────────────────────────────
+  // Callback do ESP-NOW (task de WiFi): valida e enfileira, não decodifica
+  void receive(const uint8_t *mac, const uint8_t *data, size_t len);
+  bool isReceiving() const { return _active.load(std::memory_order_acquire); }
+
+  // AudioSource (task de áudio)
+  size_t read(int16_t *out, size_t count) override;
+  void close() override;
+
+  WalkieStats getStats() const;
+
+private:
+  struct Slot {
+    bool valid;
+    MeshAudioPayload pkt;
+  };
+
+  QueueHandle_t _rxQueue;
+  std::atomic<bool> _active;       // Fonte entregue ao motor
+  std::atomic<bool> _resetPending; // Nova fala: a task de áudio zera o RX
+  uint8_t _talker[6];
+  volatile uint32_t _lastRxMs;
+
+  // TX
+  ImaAdpcmState _enc;
+  uint16_t _txSeq;
+
+  // RX (só a task de áudio)
+  Slot _slots[WALKIE_SLOTS];
+  uint8_t _depth;
+  uint8_t _target;
+  bool _buffering;
+  bool _haveSeq;
+  uint16_t _nextSeq;
+  uint8_t _lossRun;
+  uint8_t _minDepth;
+  uint16_t _adaptCount;
+  int16_t _pcm[WALKIE_FRAME_MAX]; // Pacote atual (ou o último, p/ ocultar)
+  size_t _pcmPos;
+  size_t _pcmLen;
+
+  volatile uint32_t _sent, _sendFailed, _received, _dropped, _played, _lost,
+      _late, _duplicates, _concealed, _underruns, _skipped;
+
+  void resetRx();
+  void drainQueue();
+  void insert(const MeshAudioPayload &p);
+  bool nextPacket();
+  void decode(const MeshAudioPayload &p);
+  void conceal();
+  void adapt();
+};
+
+extern WalkieAudio walkieAudio;
@@ -16,6 +16,8 @@
 
 #include "wifi_attacks.h"
 #include "../core/globals.h"
+#include "../ai/feature_extractor.h"
+#include "../ai/modules/anomaly_detector.h"
 #include "../hardware/wifi_driver.h"
 #include "captive_portal.h"
 #include <esp_wifi.h>
@@ -43,10 +45,19 @@ static const int num_beacon_ssids = 10;
 // Callback para modo promíscuo (IRAM)
 static void IRAM_ATTR wifi_sniffer_cb(void *buf,
                                       wifi_promiscuous_pkt_type_t type) {
+  const wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
+
+  // Features da NEURA9 veem todo o tráfego, não só gerenciamento
+  if (type != WIFI_PKT_MISC) {
+    featureExtractor.update(pkt->payload, pkt->rx_ctrl.sig_len,
+                            pkt->rx_ctrl.rssi, pkt->rx_ctrl.noise_floor,
+                            pkt->rx_ctrl.channel, pkt->rx_ctrl.timestamp);
+    wifiAnomaly.feedFrame(pkt->payload, pkt->rx_ctrl.sig_len);
+  }
+
   if (type != WIFI_PKT_MGMT)
     return;
 
-  const wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)buf;
   // Tip 19: Avoid deep copy if possible, just pass pointer
   wifi_attacks.processPacket(pkt->payload, pkt->rx_ctrl.sig_len,
                              pkt->rx_ctrl.rssi);
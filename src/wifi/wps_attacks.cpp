@@ -12,6 +12,8 @@
  */
 
 #include "wps_attacks.h"
+#include "../ai/feature_extractor.h"
+#include "../ai/modules/anomaly_detector.h"
 #include "../core/globals.h"
 #include <esp_wifi.h>
 #include <esp_wifi_types.h>
@@ -86,6 +88,11 @@ static void IRAM_ATTR wps_sniffer_cb(void *buf,
   const uint8_t *frame = pkt->payload;
   const int len = pkt->rx_ctrl.sig_len;
 
+  featureExtractor.update(frame, len, pkt->rx_ctrl.rssi,
+                          pkt->rx_ctrl.noise_floor, pkt->rx_ctrl.channel,
+                          pkt->rx_ctrl.timestamp);
+  wifiAnomaly.feedFrame(frame, len);
+
   // EAPOL Check (Simplified)
   // IEEE 802.1X Auth starts usually at offset 34 or so depending on header type
   // Frame Control (2) + Duration (2) + Addr1 (6) + Addr2 (6) + Addr3 (6) + Seq
@@ -0,0 +1,101 @@
+#pragma once
+/**
+ * @file Arduino.h
+ * @brief Subconjunto do core Arduino para os testes no host
+ *
+ * Só o que os módulos testados usam (pio test -e native). O relógio é do
+ * teste: host::nowUs avança com host::advanceMs/advanceUs, e millis()/
+ * micros() devolvem 32 bits como no ESP32 (wrap incluído). Com
+ * HOST_REAL_CLOCK definido antes do include (benchmarks), seguem o relógio
+ * monotônico do host.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using std::max;
+using std::min;
+
+#define IRAM_ATTR
+#define PROGMEM
+
+// Testes rodam numa thread só: seção crítica vazia
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define constrain(amt, low, high)                                              \
+  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+namespace host {
+inline uint64_t nowUs = 0;
+inline void advanceUs(uint64_t us) { nowUs += us; }
+inline void advanceMs(uint64_t ms) { nowUs += ms * 1000; }
+} // namespace host
+
+#ifdef HOST_REAL_CLOCK
+inline uint32_t micros() {
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+inline uint32_t millis() { return micros() / 1000; }
+#else
+inline uint32_t millis() { return (uint32_t)(host::nowUs / 1000); }
+inline uint32_t micros() { return (uint32_t)host::nowUs; }
+#endif
+
+inline long random(long lo, long hi) {
+  return hi > lo ? lo + rand() % (hi - lo) : lo;
+}
+inline long random(long hi) { return random(0, hi); }
+inline uint32_t esp_random() { return ((uint32_t)rand() << 16) ^ rand(); }
+
+// Logs só com HOST_SERIAL=1 no ambiente
+struct HostSerial {
+  static bool on() {
+    static bool v = getenv("HOST_SERIAL") != nullptr;
+    return v;
+  }
+  int printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    if (!on())
+      return 0;
+    va_list a;
+    va_start(a, fmt);
+    int r = vprintf(fmt, a);
+    va_end(a);
+    return r;
+  }
+  void println(const char *s = "") {
+    if (on())
+      puts(s);
+  }
+  void print(const char *s) {
+    if (on())
+      fputs(s, stdout);
+  }
+};
+inline HostSerial Serial;
+
+// "Ciclos" no host = nanossegundos do relógio monotônico
+struct HostEsp {
+  uint32_t getCycleCount() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+};
+inline HostEsp ESP;
+
+// Como no core do ESP32: heap_caps_* e FreeRTOS vêm junto com o Arduino.h
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file FS.h
+ * @brief fs::FS/File do core Arduino sobre stdio para os testes no host
+ *
+ * O caminho vai direto para o fopen (o teste cria o arquivo num diretório
+ * temporário). Só leitura de texto, o que a avaliação do NEURA9 usa.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+
+namespace fs {
+
+class File {
+public:
+  File(FILE *f = nullptr) : _f(f) {}
+  explicit operator bool() const { return _f != nullptr; }
+
+  int available() {
+    if (!_f)
+      return 0;
+    int c = fgetc(_f);
+    if (c == EOF)
+      return 0;
+    ungetc(c, _f);
+    return 1;
+  }
+
+  size_t readBytesUntil(char terminator, char *buffer, size_t length) {
+    size_t n = 0;
+    int c;
+    while (_f && n < length && (c = fgetc(_f)) != EOF && c != terminator)
+      buffer[n++] = (char)c;
+    return n;
+  }
+
+  void close() {
+    if (_f)
+      fclose(_f);
+    _f = nullptr;
+  }
+
+private:
+  FILE *_f;
+};
+
+class FS {
+public:
+  File open(const char *path, const char *mode = FILE_READ) {
+    return File(fopen(path, mode));
+  }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,55 @@
+#pragma once
+/**
+ * @file Preferences.h
+ * @brief NVS do ESP32 em memória para os testes no host
+ *
+ * Vale enquanto o processo roda: host::nvs() guarda namespace/chave ->
+ * bytes, e o teste pode limpar ou escrever direto nele.
+ */
+
+#include <map>
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+namespace host {
+inline std::map<std::string, std::vector<uint8_t>> &nvs() {
+  static std::map<std::string, std::vector<uint8_t>> store;
+  return store;
+}
+} // namespace host
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false) {
+    _ns = name;
+    _readOnly = readOnly;
+    return true;
+  }
+  void end() { _ns.clear(); }
+
+  size_t getBytes(const char *key, void *buf, size_t maxLen) {
+    auto it = host::nvs().find(_ns + "/" + key);
+    if (it == host::nvs().end() || it->second.size() > maxLen)
+      return 0;
+    memcpy(buf, it->second.data(), it->second.size());
+    return it->second.size();
+  }
+
+  size_t putBytes(const char *key, const void *value, size_t len) {
+    if (_readOnly)
+      return 0;
+    const uint8_t *p = (const uint8_t *)value;
+    host::nvs()[_ns + "/" + key].assign(p, p + len);
+    return len;
+  }
+
+  bool remove(const char *key) {
+    return !_readOnly && host::nvs().erase(_ns + "/" + key) > 0;
+  }
+
+private:
+  std::string _ns;
+  bool _readOnly = false;
+};
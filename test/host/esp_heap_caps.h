@@ -0,0 +1,26 @@
+#pragma once
+/**
+ * @file esp_heap_caps.h
+ * @brief heap_caps_* do ESP-IDF sobre malloc para os testes no host
+ *
+ * Um heap só: DRAM interna e PSRAM são o mesmo malloc (alinhado a 16 B no
+ * glibc, o que a arena do TFLite pede), e o maior bloco livre nunca falta.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void *heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+inline void heap_caps_free(void *p) { free(p); }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  (void)caps;
+  return SIZE_MAX / 2;
+}
@@ -0,0 +1,15 @@
+#pragma once
+/**
+ * @file esp_now.h
+ * @brief Tipos do ESP-NOW para os testes no host (sem rádio)
+ */
+
+#include <stdint.h>
+
+#define ESP_NOW_ETH_ALEN 6
+#define ESP_NOW_MAX_DATA_LEN 250
+
+typedef enum {
+  ESP_NOW_SEND_SUCCESS = 0,
+  ESP_NOW_SEND_FAIL,
+} esp_now_send_status_t;
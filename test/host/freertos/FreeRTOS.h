@@ -0,0 +1,16 @@
+#pragma once
+/**
+ * @file FreeRTOS.h
+ * @brief Tipos e macros do FreeRTOS para os testes no host (uma thread)
+ */
+
+#include <stdint.h>
+
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
@@ -0,0 +1,53 @@
+#pragma once
+/**
+ * @file queue.h
+ * @brief Filas do FreeRTOS no host: FIFO de tamanho fixo, sem bloquear
+ *
+ * Uma thread só: envio com a fila cheia e leitura com ela vazia voltam
+ * pdFALSE na hora, qualquer que seja o timeout.
+ */
+
+#include "FreeRTOS.h"
+
+#include <deque>
+#include <string.h>
+#include <vector>
+
+struct HostQueue {
+  size_t length;
+  size_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+typedef HostQueue *QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(size_t length, size_t itemSize) {
+  return new HostQueue{length, itemSize, {}};
+}
+inline void vQueueDelete(QueueHandle_t q) { delete q; }
+
+inline BaseType_t xQueueSend(QueueHandle_t q, const void *item,
+                             TickType_t ticks) {
+  (void)ticks;
+  if (q->items.size() >= q->length)
+    return pdFALSE;
+  const uint8_t *p = (const uint8_t *)item;
+  q->items.emplace_back(p, p + q->itemSize);
+  return pdTRUE;
+}
+inline BaseType_t xQueueReceive(QueueHandle_t q, void *item,
+                                TickType_t ticks) {
+  (void)ticks;
+  if (q->items.empty())
+    return pdFALSE;
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  return pdTRUE;
+}
+inline BaseType_t xQueueReset(QueueHandle_t q) {
+  q->items.clear();
+  return pdTRUE;
+}
+inline size_t uxQueueMessagesWaiting(QueueHandle_t q) {
+  return q->items.size();
+}
@@ -0,0 +1,27 @@
+#pragma once
+/**
+ * @file semphr.h
+ * @brief Semáforos do FreeRTOS no host: uma thread só, sempre livres
+ */
+
+#include "FreeRTOS.h"
+
+typedef void *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+  static int token;
+  return &token;
+}
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return xSemaphoreCreateMutex();
+}
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  (void)s;
+  (void)ticks;
+  return pdTRUE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  (void)s;
+  return pdTRUE;
+}
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { (void)s; }
@@ -0,0 +1,25 @@
+#pragma once
+/**
+ * @file task.h
+ * @brief Tasks do FreeRTOS no host: uma thread só, notificações vazias
+ *
+ * xTaskGetCurrentTaskHandle() devolve nullptr, então quem compara com a
+ * task dona (ModelRuntime, FeatureExtractor) executa na hora. vTaskDelay
+ * avança o relógio do teste.
+ */
+
+#include "FreeRTOS.h"
+#include <Arduino.h>
+
+typedef void *TaskHandle_t;
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return nullptr; }
+inline void xTaskNotifyGive(TaskHandle_t task) { (void)task; }
+inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  (void)clear;
+  (void)ticks;
+  return 0;
+}
+inline void vTaskDelay(TickType_t ticks) {
+  host::advanceMs(ticks * portTICK_PERIOD_MS);
+}
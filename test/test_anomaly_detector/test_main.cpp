@@ -0,0 +1,241 @@
+/**
+ * @file test_main.cpp
+ * @brief WiFiAnomalyDetector: falsos positivos, latência e wrap do relógio
+ *
+ * Não há capturas gravadas no repo; o trace é sintético e determinístico
+ * (beacons de 8 APs, probes com rajadas de celulares escaneando, auth e
+ * deauth esporádicos), reproduzido em passos de 1 ms pelo relógio do host.
+ */
+
+#include <unity.h>
+
+#include "ai/modules/anomaly_detector.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TRACE SINTÉTICO
+// ═══════════════════════════════════════════════════════════════════════════
+
+static const uint8_t AP_COUNT = 8;
+static const uint8_t FLOOD_BSSID[6] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x01};
+
+struct Trace {
+  uint32_t seed = 12345;
+  uint32_t nextBeaconMs[AP_COUNT];
+  uint16_t burstLeft = 0;
+  uint32_t floodPerSec = 0; // deauth/s do atacante (0 = sem ataque)
+
+  Trace() {
+    for (uint8_t i = 0; i < AP_COUNT; i++)
+      nextBeaconMs[i] = i * 13;
+  }
+
+  uint32_t rnd() {
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+  }
+  // Evento com taxa ratePerSec num passo de 1 ms
+  bool chance(float ratePerSec) {
+    return (rnd() & 0xFFFF) < ratePerSec * 65536.0f / 1000.0f;
+  }
+};
+
+static void sendMgmt(WiFiAnomalyDetector &d, uint8_t subtype,
+                     const uint8_t *bssid, uint16_t len) {
+  uint8_t frame[64] = {0};
+  frame[0] = subtype << 4; // Tipo 0 (gerenciamento)
+  memcpy(frame + 16, bssid, 6);
+  d.feedFrame(frame, len);
+}
+
+// Um passo de 1 ms do trace: frames deste ms e avança o relógio
+static void step(WiFiAnomalyDetector &d, Trace &t, uint32_t ms) {
+  uint8_t ap[6] = {0x02, 0x11, 0x22, 0x33, 0x44, 0x00};
+
+  for (uint8_t i = 0; i < AP_COUNT; i++) {
+    if ((int32_t)(ms - t.nextBeaconMs[i]) >= 0) {
+      ap[5] = i;
+      sendMgmt(d, 8, ap, 180 + i * 10);
+      // 102,4 ms (100 TU) com jitter de alguns ms
+      t.nextBeaconMs[i] = ms + 100 + t.rnd() % 6;
+    }
+  }
+
+  // Probes de fundo + rajadas (celular escaneando todos os canais)
+  if (t.burstLeft == 0 && t.chance(1.0f / 30.0f))
+    t.burstLeft = 12;
+  if (t.burstLeft > 0 && (ms & 3) == 0) {
+    t.burstLeft--;
+    sendMgmt(d, 4, ap, 90);
+  } else if (t.chance(3.0f)) {
+    sendMgmt(d, 4, ap, 90);
+  }
+
+  if (t.chance(0.2f))
+    sendMgmt(d, 11, ap, 30);
+  // Deauth legítimo ocasional (cliente saindo)
+  if (t.chance(0.05f))
+    sendMgmt(d, 12, ap, 26);
+  if (t.floodPerSec && t.chance((float)t.floodPerSec))
+    sendMgmt(d, 12, FLOOD_BSSID, 26);
+
+  host::advanceMs(1);
+}
+
+static uint32_t totalAlarms(const WiFiAnomalyDetector &d) {
+  uint32_t n = 0;
+  for (uint8_t i = 0; i < ANOMALY_CLASS_COUNT; i++)
+    n += d.getAlarmCount((AnomalyFrameClass)i);
+  return n;
+}
+
+// Roda o trace; devolve ms em que isUnderAttack() ficou verdadeiro
+static uint32_t run(WiFiAnomalyDetector &d, Trace &t, uint32_t durationMs) {
+  uint32_t attackMs = 0;
+  for (uint32_t i = 0; i < durationMs; i++) {
+    step(d, t, millis());
+    if (d.isUnderAttack())
+      attackMs++;
+  }
+  return attackMs;
+}
+
+// Primeiro ms com isUnderAttack() (UINT32_MAX se não detectou)
+static uint32_t timeToDetect(WiFiAnomalyDetector &d, Trace &t,
+                             uint32_t maxMs) {
+  for (uint32_t i = 0; i < maxMs; i++) {
+    step(d, t, millis());
+    if (d.isUnderAttack())
+      return i + 1;
+  }
+  return UINT32_MAX;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// 80 min de tráfego normal (passa dos 71,6 min em que um relógio de 32 bits
+// em us dá a volta): poucos alarmes e quase nenhum tempo "sob ataque"
+void test_quiet_trace_false_positive_rate() {
+  host::nowUs = 1000000;
+  WiFiAnomalyDetector d;
+  Trace t;
+  const uint32_t durationMs = 80 * 60 * 1000;
+
+  uint32_t attackMs = run(d, t, durationMs);
+  float alarmsPerHour = totalAlarms(d) * 3600000.0f / durationMs;
+  float attackFrac = (float)attackMs / durationMs;
+
+  char msg[96];
+  snprintf(msg, sizeof(msg), "FP: %.2f alarmes/h, %.4f%% do tempo sob ataque",
+           alarmsPerHour, attackFrac * 100.0f);
+  TEST_MESSAGE(msg);
+
+  TEST_ASSERT_TRUE_MESSAGE(alarmsPerHour <= 2.0f, msg);
+  TEST_ASSERT_TRUE_MESSAGE(attackFrac <= 0.001f, msg);
+  // Bins continuam fechando: ~8 APs x ~9,7 beacons/s
+  TEST_ASSERT_UINT16_WITHIN(10, 78, d.getRate(ANOMALY_BEACON));
+}
+
+// Deauth flood de 50/s de um BSSID: detectado em menos de 1 s, com latência
+// registrada, BSSID identificado e alarme que desarma depois do ataque
+static void checkFloodDetectedAndCleared(WiFiAnomalyDetector &d, Trace &t) {
+  t.floodPerSec = 50;
+  uint32_t detectMs = timeToDetect(d, t, 5000);
+  char msg[64];
+  snprintf(msg, sizeof(msg), "Deauth flood detectado em %lu ms",
+           (unsigned long)detectMs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000, detectMs);
+
+  run(d, t, 5000);
+  TEST_ASSERT_TRUE(d.isAlarm(ANOMALY_DEAUTH));
+  // Latência medida pelo próprio detector (início do CUSUM até o alarme)
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000,
+                                   d.getDetectionLatencyMs(ANOMALY_DEAUTH));
+  uint8_t bssid[6];
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT16(WiFiAnomalyDetector::BSSID_ATTACK_RATE,
+                                      d.getTopBssid(bssid));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(FLOOD_BSSID, bssid, 6);
+
+  t.floodPerSec = 0;
+  run(d, t, 15000);
+  TEST_ASSERT_FALSE(d.isUnderAttack());
+}
+
+void test_deauth_flood_latency() {
+  host::nowUs = 1000000;
+  WiFiAnomalyDetector d;
+  Trace t;
+  run(d, t, 60000);
+  TEST_ASSERT_FALSE(d.isUnderAttack());
+  checkFloodDetectedAndCleared(d, t);
+}
+
+// millis() dá a volta no meio do trace: bins seguem fechando, sem alarme
+// preso, e um ataque depois do wrap ainda é detectado
+void test_millis_wrap() {
+  host::nowUs = (0x100000000ULL - 30000) * 1000;
+  WiFiAnomalyDetector d;
+  Trace t;
+  for (uint8_t i = 0; i < AP_COUNT; i++)
+    t.nextBeaconMs[i] = millis() + i * 13;
+
+  run(d, t, 60000);
+  TEST_ASSERT_LESS_THAN_UINT32(60000, millis()); // Passou do wrap
+  TEST_ASSERT_FALSE(d.isUnderAttack());
+  TEST_ASSERT_UINT16_WITHIN(10, 78, d.getRate(ANOMALY_BEACON));
+
+  checkFloodDetectedAndCleared(d, t);
+}
+
+// Captura para no meio de um flood: só o tick() da task de IA roda. O
+// alarme desarma sem frame nenhum, e a volta da captura não dispara alarme
+// (a linha de base recomeça em vez de ter aprendido o silêncio)
+void test_capture_stops_during_attack() {
+  host::nowUs = 1000000;
+  WiFiAnomalyDetector d;
+  Trace t;
+  run(d, t, 60000);
+  t.floodPerSec = 50;
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000, timeToDetect(d, t, 5000));
+  run(d, t, 2000);
+  TEST_ASSERT_TRUE(d.isUnderAttack());
+
+  // Sem frames; a task de IA acorda a cada ~100 ms
+  uint32_t clearedMs = UINT32_MAX;
+  for (uint32_t ms = 0; ms < 15000; ms += 100) {
+    host::advanceMs(100);
+    d.tick(millis());
+    if (clearedMs == UINT32_MAX && !d.isUnderAttack())
+      clearedMs = ms + 100;
+  }
+  char msg[64];
+  snprintf(msg, sizeof(msg), "Alarme desarmou %lu ms depois dos frames pararem",
+           (unsigned long)clearedMs);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(3000, clearedMs);
+  TEST_ASSERT_FALSE(d.isUnderAttack());
+  TEST_ASSERT_EQUAL_UINT16(0, d.getTopBssid(nullptr));
+
+  // Captura volta sem o atacante
+  t.floodPerSec = 0;
+  for (uint8_t i = 0; i < AP_COUNT; i++)
+    t.nextBeaconMs[i] = millis() + i * 13;
+  uint32_t before = totalAlarms(d);
+  uint32_t attackMs = run(d, t, 60000);
+  TEST_ASSERT_EQUAL_UINT32(before, totalAlarms(d));
+  TEST_ASSERT_EQUAL_UINT32(0, attackMs);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_quiet_trace_false_positive_rate);
+  RUN_TEST(test_deauth_flood_latency);
+  RUN_TEST(test_millis_wrap);
+  RUN_TEST(test_capture_stops_during_attack);
+  return UNITY_END();
+}
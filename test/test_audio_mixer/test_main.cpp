@@ -0,0 +1,248 @@
+/**
+ * @file test_main.cpp
+ * @brief Mixer do AudioEngine: saturação, conversão de taxa e custo
+ *
+ * audio_mixer.{h,cpp} não dependem do Arduino; o conversor é conferido bit
+ * a bit contra uma interpolação de referência escrita direto da definição
+ * (posição n * passo em Q16, entre in[i] e in[i + 1]).
+ */
+
+#include <unity.h>
+
+#include <Arduino.h> // min() e ESP.getCycleCount() do host
+
+#include "hardware/audio_mixer.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+#define OUT_RATE 16000 // Taxa do I2S do AudioEngine
+#define BLOCK 256      // AUDIO_ENGINE_BLOCK
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FONTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct ArraySource {
+  const int16_t *data;
+  size_t len;
+  size_t pos;
+  uint8_t starveEvery; // != 0: a cada N chamadas devolve 0 (underrun)
+  uint32_t calls;
+};
+
+static size_t pullArray(void *ctx, int16_t *out, size_t count) {
+  ArraySource *s = (ArraySource *)ctx;
+  if (s->starveEvery && ++s->calls % s->starveEvery == 0)
+    return 0;
+  size_t n = min(count, s->len - s->pos);
+  memcpy(out, s->data + s->pos, n * sizeof(int16_t));
+  s->pos += n;
+  return n;
+}
+
+static uint32_t s_seed = 1;
+static int16_t noise() {
+  s_seed = s_seed * 1103515245u + 12345u;
+  return (int16_t)(s_seed >> 16);
+}
+
+// Referência: saída n na posição n * passo (Q16)
+static size_t referenceResample(const int16_t *in, size_t len,
+                                uint32_t inRate, int16_t *out, size_t max) {
+  uint32_t step = (uint32_t)(((uint64_t)inRate << 16) / OUT_RATE);
+  size_t n = 0;
+  for (; n < max; n++) {
+    uint64_t pos = (uint64_t)n * step;
+    size_t i = pos >> 16;
+    if (i + 1 >= len)
+      break;
+    int32_t frac = (int32_t)((pos & 0xFFFF) >> 1);
+    int32_t delta = (int32_t)in[i + 1] - in[i];
+    out[n] = (int16_t)(in[i] + ((delta * frac) >> 15));
+  }
+  return n;
+}
+
+static void checkRate(uint32_t inRate) {
+  static int16_t in[4000];
+  static int16_t expected[8000];
+  static int16_t got[8000];
+  for (size_t i = 0; i < 4000; i++)
+    in[i] = noise();
+  // Extremos: a diferença entre vizinhos usa os 17 bits
+  in[10] = 32767;
+  in[11] = -32768;
+  in[12] = 32767;
+
+  size_t want = referenceResample(in, 4000, inRate, expected, 8000);
+
+  AudioResampler r;
+  r.reset(inRate, OUT_RATE);
+  ArraySource src = {in, 4000, 0, 0, 0};
+  size_t n = 0;
+  while (n < 8000) {
+    size_t got1 = r.render(got + n, min((size_t)BLOCK, 8000 - n), pullArray,
+                           &src);
+    if (got1 == 0)
+      break;
+    n += got1;
+  }
+  TEST_ASSERT_EQUAL_UINT32(want, n);
+  TEST_ASSERT_EQUAL_INT16_ARRAY(expected, got, want);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Quatro vozes em fundo de escala: o acumulador int32 não dá a volta e a
+// saída satura uma vez só no fim
+void test_mix_saturates_without_wrap() {
+  int32_t acc[BLOCK] = {0};
+  int16_t hi[BLOCK], lo[BLOCK], out[BLOCK];
+  for (int i = 0; i < BLOCK; i++) {
+    hi[i] = 32767;
+    lo[i] = -32768;
+  }
+  for (int v = 0; v < 4; v++)
+    audioMixAccumulate(acc, hi, BLOCK, AUDIO_Q15_ONE);
+  audioMixSaturate(out, acc, BLOCK, AUDIO_Q15_ONE);
+  for (int i = 0; i < BLOCK; i++)
+    TEST_ASSERT_EQUAL_INT16(32767, out[i]);
+
+  memset(acc, 0, sizeof(acc));
+  for (int v = 0; v < 4; v++)
+    audioMixAccumulate(acc, lo, BLOCK, AUDIO_Q15_ONE);
+  audioMixSaturate(out, acc, BLOCK, AUDIO_Q15_ONE);
+  for (int i = 0; i < BLOCK; i++)
+    TEST_ASSERT_EQUAL_INT16(-32768, out[i]);
+
+  // Positivo e negativo se cancelam antes da saturação
+  memset(acc, 0, sizeof(acc));
+  audioMixAccumulate(acc, hi, BLOCK, AUDIO_Q15_ONE);
+  audioMixAccumulate(acc, hi, BLOCK, AUDIO_Q15_ONE);
+  audioMixAccumulate(acc, lo, BLOCK, AUDIO_Q15_ONE);
+  audioMixSaturate(out, acc, BLOCK, AUDIO_Q15_ONE);
+  TEST_ASSERT_EQUAL_INT16(32766, out[0]);
+}
+
+void test_mix_gain_q15() {
+  int32_t acc[4] = {0};
+  int16_t in[4] = {32767, -32768, 1000, -1000};
+  int16_t out[4];
+  audioMixAccumulate(acc, in, 4, AUDIO_Q15_ONE / 2); // ~ -6 dB
+  TEST_ASSERT_EQUAL_INT32((32767 * 16383) >> 15, acc[0]);
+  TEST_ASSERT_EQUAL_INT32((-32768 * 16383) >> 15, acc[1]);
+  TEST_ASSERT_EQUAL_INT32((1000 * 16383) >> 15, acc[2]);
+
+  // Ganho mestre sobre o acumulador (int64 no meio)
+  int32_t big[2] = {4 * 32767, -4 * 32768};
+  audioMixSaturate(out, big, 2, AUDIO_Q15_ONE / 4);
+  TEST_ASSERT_EQUAL_INT16((int16_t)(((int64_t)big[0] * 8191) >> 15), out[0]);
+  TEST_ASSERT_EQUAL_INT16((int16_t)(((int64_t)big[1] * 8191) >> 15), out[1]);
+}
+
+void test_resampler_passthrough() {
+  int16_t in[1000], out[1000];
+  for (int i = 0; i < 1000; i++)
+    in[i] = noise();
+  AudioResampler r;
+  r.reset(OUT_RATE, OUT_RATE);
+  TEST_ASSERT_TRUE(r.isPassthrough());
+  ArraySource src = {in, 1000, 0, 0, 0};
+  TEST_ASSERT_EQUAL_UINT32(1000, r.render(out, 1000, pullArray, &src));
+  TEST_ASSERT_EQUAL_INT16_ARRAY(in, out, 1000);
+}
+
+void test_resampler_8k() { checkRate(8000); }
+void test_resampler_22k() { checkRate(22050); }
+void test_resampler_24k() { checkRate(24000); }
+void test_resampler_32k() { checkRate(32000); }
+void test_resampler_44k() { checkRate(44100); }
+
+// Bloco inteiro, uma amostra por vez ou com underruns da fonte: mesma saída
+void test_resampler_chunking_and_underrun() {
+  static int16_t in[3000], whole[6000], pieces[6000];
+  for (int i = 0; i < 3000; i++)
+    in[i] = noise();
+
+  AudioResampler a;
+  a.reset(22050, OUT_RATE);
+  ArraySource sa = {in, 3000, 0, 0, 0};
+  size_t na = 0, got;
+  while ((got = a.render(whole + na, BLOCK, pullArray, &sa)) > 0)
+    na += got;
+
+  AudioResampler b;
+  b.reset(22050, OUT_RATE);
+  ArraySource sb = {in, 3000, 0, 3, 0}; // Falha 1 de cada 3 leituras
+  size_t nb = 0;
+  uint32_t empty = 0;
+  while (nb < na && empty < 10) {
+    got = b.render(pieces + nb, 1, pullArray, &sb);
+    nb += got;
+    empty = got ? 0 : empty + 1;
+  }
+  TEST_ASSERT_EQUAL_UINT32(na, nb);
+  TEST_ASSERT_EQUAL_INT16_ARRAY(whole, pieces, na);
+}
+
+// Custo de um bloco do AudioEngine com quatro vozes a 44,1 kHz
+// (no host, ESP.getCycleCount() conta nanossegundos)
+void test_mix_block_cost() {
+  static int16_t in[4][4096];
+  for (int v = 0; v < 4; v++)
+    for (int i = 0; i < 4096; i++)
+      in[v][i] = noise();
+
+  const int BLOCKS = 200;
+  AudioResampler r[4];
+  ArraySource src[4];
+  for (int v = 0; v < 4; v++) {
+    r[v].reset(44100, OUT_RATE);
+    src[v] = {in[v], 4096, 0, 0, 0};
+  }
+
+  int32_t acc[BLOCK];
+  int16_t voice[BLOCK], out[BLOCK];
+  uint64_t total = 0;
+  volatile int16_t sink = 0; // Mantém o resultado vivo no -O2
+  for (int b = 0; b < BLOCKS; b++) {
+    for (int v = 0; v < 4; v++)
+      if (src[v].pos >= src[v].len - BLOCK * 3)
+        src[v].pos = 0; // Fonte em laço: sempre há dados
+    uint32_t t0 = ESP.getCycleCount();
+    memset(acc, 0, sizeof(acc));
+    for (int v = 0; v < 4; v++) {
+      size_t n = r[v].render(voice, BLOCK, pullArray, &src[v]);
+      audioMixAccumulate(acc, voice, n, AUDIO_Q15_ONE / 2);
+    }
+    audioMixSaturate(out, acc, BLOCK, AUDIO_Q15_ONE);
+    total += (uint32_t)(ESP.getCycleCount() - t0);
+    sink = out[b % BLOCK];
+  }
+  (void)sink;
+
+  char msg[80];
+  snprintf(msg, sizeof(msg), "4 vozes 44,1 kHz -> 16 kHz: %lu ns/bloco",
+           (unsigned long)(total / BLOCKS));
+  TEST_MESSAGE(msg);
+  // Folga enorme: um bloco dura 16 ms
+  TEST_ASSERT_LESS_THAN_UINT32(16000000, (uint32_t)(total / BLOCKS));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_mix_saturates_without_wrap);
+  RUN_TEST(test_mix_gain_q15);
+  RUN_TEST(test_resampler_passthrough);
+  RUN_TEST(test_resampler_8k);
+  RUN_TEST(test_resampler_22k);
+  RUN_TEST(test_resampler_24k);
+  RUN_TEST(test_resampler_32k);
+  RUN_TEST(test_resampler_44k);
+  RUN_TEST(test_resampler_chunking_and_underrun);
+  RUN_TEST(test_mix_block_cost);
+  return UNITY_END();
+}
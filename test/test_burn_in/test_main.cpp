@@ -0,0 +1,162 @@
+/**
+ * @file test_main.cpp
+ * @brief Burn-in: trajetórias e a geometria do driver no painel
+ *
+ * Todo conteúdo do LVGL vive em UI_WIDTH x UI_HEIGHT, colocado no painel em
+ * margem + offset (burn_in_geometry.h, a mesma conta do lvgl_driver). O
+ * teste passa o offset pelo mesmo caminho do driver (empacota, desempacota,
+ * limita) e confere o flush, as faixas apagadas e o toque em cada posição.
+ */
+
+#include <unity.h>
+
+#include "hardware/burn_in_geometry.h"
+#include "ui/burn_in_path.h"
+
+void setUp() {}
+void tearDown() {}
+
+#define M DISPLAY_BURNIN_MARGIN
+
+// Offset pelo caminho do driver: lvgl_set_display_offset -> timer do LVGL
+static void driverOffset(int8_t dx, int8_t dy, int16_t *ox, int16_t *oy) {
+  int8_t x, y;
+  burnInUnpackOffset(burnInPackOffset(dx, dy), &x, &y);
+  *ox = burnInOrigin(burnInClampOffset(x));
+  *oy = burnInOrigin(burnInClampOffset(y));
+}
+
+static void assertInsidePanel(const BurnInPath &p, int8_t m) {
+  TEST_ASSERT_TRUE(p.x >= -m && p.x <= m);
+  TEST_ASSERT_TRUE(p.y >= -m && p.y <= m);
+  int16_t x0, y0;
+  driverOffset(p.x, p.y, &x0, &y0);
+  // O driver não limita offsets que a trajetória já respeita
+  TEST_ASSERT_EQUAL_INT16(M + p.x, x0);
+  TEST_ASSERT_EQUAL_INT16(M + p.y, y0);
+}
+
+static void runPattern(BurnInPattern pattern) {
+  for (int8_t m = 1; m <= DISPLAY_BURNIN_MARGIN; m++) {
+    BurnInPath p;
+    for (int i = 0; i < 2000; i++) {
+      p.next(pattern, m);
+      assertInsidePanel(p, m);
+    }
+  }
+}
+
+void test_bounce_stays_in_margin() { runPattern(BURNIN_PATTERN_BOUNCE); }
+void test_orbit_stays_in_margin() { runPattern(BURNIN_PATTERN_ORBIT); }
+void test_random_stays_in_margin() { runPattern(BURNIN_PATTERN_RANDOM); }
+
+void test_orbit_visits_whole_perimeter() {
+  const int8_t m = DISPLAY_BURNIN_MARGIN;
+  bool seen[2 * DISPLAY_BURNIN_MARGIN + 1][2 * DISPLAY_BURNIN_MARGIN + 1] = {};
+  BurnInPath p;
+  for (int i = 0; i < 8 * m; i++) {
+    p.next(BURNIN_PATTERN_ORBIT, m);
+    seen[p.x + m][p.y + m] = true;
+  }
+  int visited = 0;
+  for (auto &row : seen)
+    for (bool v : row)
+      visited += v;
+  TEST_ASSERT_EQUAL(8 * m, visited);
+}
+
+void test_shrinking_limit_pulls_offset_back() {
+  BurnInPath p;
+  for (int i = 0; i < 3; i++)
+    p.next(BURNIN_PATTERN_BOUNCE, DISPLAY_BURNIN_MARGIN);
+  p.next(BURNIN_PATTERN_BOUNCE, 1);
+  assertInsidePanel(p, 1);
+}
+
+// Qualquer offset pedido (int8 inteiro): o flush da área toda cabe no
+// painel e o offset fica na margem
+void test_flush_origin_always_inside_panel() {
+  for (int dx = -128; dx <= 127; dx++) {
+    for (int dy = -128; dy <= 127; dy += 17) {
+      int16_t x0, y0;
+      driverOffset(dx, dy, &x0, &y0);
+      TEST_ASSERT_TRUE(x0 >= 0 && x0 + UI_WIDTH <= LCD_WIDTH);
+      TEST_ASSERT_TRUE(y0 >= 0 && y0 + UI_HEIGHT <= LCD_HEIGHT);
+      // Dentro da margem o offset passa intacto (sinal preservado)
+      if (dx >= -M && dx <= M)
+        TEST_ASSERT_EQUAL_INT16(M + dx, x0);
+      if (dy >= -M && dy <= M)
+        TEST_ASSERT_EQUAL_INT16(M + dy, y0);
+    }
+  }
+}
+
+// Área do LVGL + faixas apagadas cobrem cada pixel do painel uma vez só:
+// nada da imagem anterior sobra na margem e nada da UI é apagado
+void test_margin_rects_tile_panel() {
+  static uint8_t cover[LCD_HEIGHT][LCD_WIDTH];
+  for (int dx = -M; dx <= M; dx++) {
+    for (int dy = -M; dy <= M; dy++) {
+      int16_t x0, y0;
+      driverOffset(dx, dy, &x0, &y0);
+      memset(cover, 0, sizeof(cover));
+
+      BurnInRect rects[5];
+      uint8_t n = burnInMarginRects(x0, y0, rects);
+      TEST_ASSERT_LESS_OR_EQUAL(4, n);
+      rects[n++] = {x0, y0, UI_WIDTH, UI_HEIGHT};
+      for (uint8_t i = 0; i < n; i++) {
+        const BurnInRect &r = rects[i];
+        TEST_ASSERT_TRUE(r.w > 0 && r.h > 0);
+        TEST_ASSERT_TRUE(r.x >= 0 && r.y >= 0);
+        TEST_ASSERT_TRUE(r.x + r.w <= LCD_WIDTH && r.y + r.h <= LCD_HEIGHT);
+        for (int y = r.y; y < r.y + r.h; y++)
+          for (int x = r.x; x < r.x + r.w; x++)
+            cover[y][x]++;
+      }
+      for (int y = 0; y < LCD_HEIGHT; y++)
+        for (int x = 0; x < LCD_WIDTH; x++)
+          if (cover[y][x] != 1) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "offset (%d,%d): pixel (%d,%d) x%d",
+                     dx, dy, x, y, cover[y][x]);
+            TEST_FAIL_MESSAGE(msg);
+          }
+    }
+  }
+}
+
+// Toque: o ponto desenhado em (u, v) da UI volta para (u, v); toque na
+// margem vai para a borda mais próxima
+void test_touch_maps_back_to_ui() {
+  const int16_t xs[] = {0, 1, UI_WIDTH / 2, UI_WIDTH - 1};
+  const int16_t ys[] = {0, 1, UI_HEIGHT / 2, UI_HEIGHT - 1};
+  for (int dx = -M; dx <= M; dx++) {
+    for (int dy = -M; dy <= M; dy++) {
+      int16_t x0, y0;
+      driverOffset(dx, dy, &x0, &y0);
+      for (int16_t u : xs)
+        TEST_ASSERT_EQUAL_INT16(u, burnInPanelToUi(u + x0, x0, UI_WIDTH));
+      for (int16_t v : ys)
+        TEST_ASSERT_EQUAL_INT16(v, burnInPanelToUi(v + y0, y0, UI_HEIGHT));
+      TEST_ASSERT_EQUAL_INT16(0, burnInPanelToUi(0, x0, UI_WIDTH));
+      TEST_ASSERT_EQUAL_INT16(UI_WIDTH - 1,
+                              burnInPanelToUi(LCD_WIDTH - 1, x0, UI_WIDTH));
+      TEST_ASSERT_EQUAL_INT16(UI_HEIGHT - 1,
+                              burnInPanelToUi(LCD_HEIGHT - 1, y0, UI_HEIGHT));
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_bounce_stays_in_margin);
+  RUN_TEST(test_orbit_stays_in_margin);
+  RUN_TEST(test_random_stays_in_margin);
+  RUN_TEST(test_orbit_visits_whole_perimeter);
+  RUN_TEST(test_shrinking_limit_pulls_offset_back);
+  RUN_TEST(test_flush_origin_always_inside_panel);
+  RUN_TEST(test_margin_rects_tile_panel);
+  RUN_TEST(test_touch_maps_back_to_ui);
+  return UNITY_END();
+}
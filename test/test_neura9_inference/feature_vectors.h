@@ -0,0 +1,590 @@
+#pragma once
+/**
+ * @file feature_vectors.h
+ * @brief Empacotamento da NEURA9 no Python para o teste no host (GERADO, não editar)
+ *
+ * Gerador: ai_training/tools/export_feature_fixture.py
+ */
+
+#include <stdint.h>
+
+#define FEATURE_VECTOR_ROWS 15
+#define FEATURE_VECTOR_WIDTH 56
+#define FEATURE_QUANT_CASES 4
+
+struct FeatureQuantCase {
+  float scale;
+  int32_t zeroPoint;
+  const int8_t *expected; // rows x width
+};
+
+// Entrada crua (antes da normalização)
+static const float FEATURE_VECTORS[] = {
+    -0.009635754860937595f, 0.6083442568778992f, 0.3157033324241638f, 0.23440277576446533f,
+    0.7799208164215088f, 1.208348035812378f, 1.2002453804016113f, 0.7569476366043091f,
+    0.9951523542404175f, 0.4395677447319031f, 0.22561633586883545f, 0.5638343691825867f,
+    0.6518350839614868f, 1.119540810585022f, 0.36268603801727295f, 0.5763739347457886f,
+    0.365727961063385f, -0.02141517773270607f, -0.1891869306564331f, 0.09977418929338455f,
+    0.6616763472557068f, 1.1072416305541992f, -0.2369736135005951f, 0.4388105571269989f,
+    0.968845784664154f, 1.1926841735839844f, -0.008203111588954926f, -0.15000148117542267f,
+    -0.026041576638817787f, 0.24026784300804138f, 0.29816150665283203f, 0.6371610760688782f,
+    -0.18009348213672638f, 1.1367952823638916f, 0.7457957863807678f, 0.5535045862197876f,
+    1.230912685394287f, 0.3963697850704193f, 0.1979268491268158f, 0.8733749389648438f,
+    0.9632049798965454f, 0.8256134986877441f, 1.0478687286376953f, -0.071251779794693f,
+    1.1463497877120972f, 0.15821324288845062f, 0.6826001405715942f, 0.13391441106796265f,
+    0.5284280776977539f, 1.1611274480819702f, 0.2588024139404297f, 1.2364641427993774f,
+    0.49649572372436523f, 1.1455234289169312f, 0.49164512753486633f, 0.32611969113349915f,
+    0.9730011820793152f, 0.17856046557426453f, 0.9649961590766907f, 0.17486973106861115f,
+    0.3091067373752594f, 0.8829442262649536f, 0.3223603367805481f, 0.8755251169204712f,
+    0.0030610717367380857f, 0.03169636055827141f, -0.08057624846696854f, 1.0300099849700928f,
+    0.9731453657150269f, 0.9458795189857483f, 1.114193081855774f, -0.24610067903995514f,
+    0.9410541653633118f, -0.21281424164772034f, -0.0006878463900648057f, -0.18983066082000732f,
+    -0.04723813757300377f, -0.21403129398822784f, 1.0813583135604858f, 0.1022268757224083f,
+    0.5608977675437927f, 0.7160456776618958f, 0.2744687497615814f, 0.49973583221435547f,
+    0.7251645922660828f, 1.1377019882202148f, 0.45923516154289246f, 0.21477381885051727f,
+    1.0509623289108276f, 0.5952162146568298f, 0.5955955386161804f, 1.042341947555542f,
+    1.0602021217346191f, 0.6050919890403748f, 0.5634628534317017f, 1.1724870204925537f,
+    1.0026546716690063f, 0.0004630454059224576f, 0.9501834511756897f, 0.22891606390476227f,
+    0.22522695362567902f, 0.9274957776069641f, 0.9163060188293457f, 1.2253599166870117f,
+    0.7804774045944214f, 0.07523098587989807f, -0.14740096032619476f, -0.001868666266091168f,
+    -0.1261964738368988f, 0.20301581919193268f, 0.6463386416435242f, 0.8084344863891602f,
+    0.1303178369998932f, 0.43043190240859985f, 0.8084730505943298f, 0.20799385011196136f,
+    -0.036495428532361984f, -0.09125643223524094f, -0.18672052025794983f, 0.08768200874328613f,
+    0.9922583103179932f, 0.6019800305366516f, -0.1537730097770691f, 0.2691231966018677f,
+    0.47549745440483093f, 0.36495479941368103f, -0.21954086422920227f, 0.05493755266070366f,
+    0.12848883867263794f, 0.25398871302604675f, 0.4713708162307739f, -0.0344194732606411f,
+    0.3559623956680298f, 0.3806951940059662f, 1.2160089015960693f, -0.02611585520207882f,
+    0.8606164455413818f, 0.6464986801147461f, 1.232395887374878f, 1.1343796253204346f,
+    -0.15049375593662262f, -0.13106659054756165f, 0.7005218863487244f, 0.13511113822460175f,
+    0.2563130557537079f, 0.37925541400909424f, 0.6943698525428772f, 0.4182085692882538f,
+    -0.04541010782122612f, 0.8690770864486694f, 0.8295783996582031f, 0.21851129829883575f,
+    -0.07185916602611542f, 0.180698424577713f, -0.17743688821792603f, 0.2608068287372589f,
+    1.2367597818374634f, 0.6184239983558655f, 0.03559557721018791f, 1.2007611989974976f,
+    -0.14989280700683594f, -0.18910981714725494f, 0.529030978679657f, 0.09206293523311615f,
+    0.5105616450309753f, -0.1102033257484436f, 0.9658406972885132f, 0.9131700396537781f,
+    0.447848379611969f, 0.4803035259246826f, 0.49339035153388977f, 1.1049941778182983f,
+    -0.1266799420118332f, 0.5181026458740234f, 0.6008027791976929f, 0.7531630992889404f,
+    0.7401019930839539f, 0.9798267483711243f, -0.024500062689185143f, -0.13076910376548767f,
+    0.31910818815231323f, -0.030576907098293304f, 0.5292271971702576f, 1.2231757640838623f,
+    0.2129324972629547f, -0.053089700639247894f, 1.187036395072937f, 0.09756077080965042f,
+    0.030609073117375374f, -0.19806531071662903f, -0.10844293236732483f, 1.049915075302124f,
+    0.6197752356529236f, 0.4499952495098114f, 0.0009788171155378222f, 0.3070521056652069f,
+    -0.20719178020954132f, 0.35103461146354675f, 0.05713628605008125f, 0.8310214877128601f,
+    0.49300476908683777f, 1.0721876621246338f, -0.21863120794296265f, 0.7797982096672058f,
+    0.7241600155830383f, 0.10572771728038788f, 0.12462208420038223f, 0.601406455039978f,
+    -0.027513425797224045f, 0.4674144387245178f, 0.18969027698040009f, 0.718242347240448f,
+    -0.17439638078212738f, 0.0010123616084456444f, 0.41317880153656006f, 0.03105919249355793f,
+    0.7576294541358948f, 0.12300370633602142f, 0.9435980916023254f, 0.13896723091602325f,
+    0.8023468255996704f, -0.06780584901571274f, 0.747015655040741f, -0.18097637593746185f,
+    1.1315240859985352f, 0.814302384853363f, 1.028856873512268f, -0.21980449557304382f,
+    0.023565329611301422f, 0.16559025645256042f, -0.03655794635415077f, 0.36259591579437256f,
+    0.34132304787635803f, 0.2107112854719162f, 0.08330164849758148f, 0.16095615923404694f,
+    0.03830341994762421f, 1.1314183473587036f, 0.5965829491615295f, 0.655927300453186f,
+    -0.22934900224208832f, 0.22197102010250092f, 0.7209020256996155f, -0.19169078767299652f,
+    -0.2254907190799713f, 0.08344748616218567f, 0.8887549042701721f, 0.8410407304763794f,
+    0.14426395297050476f, 0.8230453729629517f, 0.8932139277458191f, 1.0429579019546509f,
+    0.9813141226768494f, 0.5963491201400757f, 1.058393120765686f, -0.11180496960878372f,
+    -0.05291994661092758f, 0.1342739462852478f, 0.2976428270339966f, 0.18082453310489655f,
+    -0.21184667944908142f, 0.1653725504875183f, -0.1088554784655571f, 0.04104158654808998f,
+    -0.17002420127391815f, 0.2315761148929596f, 1.1806318759918213f, -0.20373348891735077f,
+    0.4514544904232025f, 1.0895118713378906f, 0.8907723426818848f, 1.1766340732574463f,
+    0.34851980209350586f, -0.22714021801948547f, -0.14164629578590393f, 1.233803391456604f,
+    0.6782000064849854f, 0.4763856530189514f, -0.007527364417910576f, -0.024979237467050552f,
+    1.1837817430496216f, 0.8295739889144897f, 0.3660755753517151f, 0.06461869925260544f,
+    0.9345802068710327f, 1.0180617570877075f, -0.09739737212657928f, 0.186911940574646f,
+    0.008891155011951923f, 0.34138306975364685f, 0.09607640653848648f, 0.4303876459598541f,
+    0.019174061715602875f, 1.1640267372131348f, 0.04642059653997421f, 1.2315958738327026f,
+    0.9485154747962952f, 0.9774286150932312f, 1.0507732629776f, 0.9089801907539368f,
+    -0.02795214019715786f, 0.32444408535957336f, 0.11640074104070663f, 0.7397550940513611f,
+    0.16817301511764526f, 0.5028576850891113f, 0.08137526363134384f, -0.2307649850845337f,
+    0.7979534268379211f, 0.6117116808891296f, 1.0095694065093994f, 0.7870421409606934f,
+    0.7225384712219238f, 0.8098925352096558f, 0.2881620228290558f, 0.811164379119873f,
+    0.8002929091453552f, 0.3441750109195709f, 0.24880725145339966f, 0.5784568190574646f,
+    0.6066178679466248f, 0.659650444984436f, 0.8586076498031616f, 1.189523458480835f,
+    0.7636397480964661f, 1.1426094770431519f, 0.13110363483428955f, 0.8937453627586365f,
+    0.6660007238388062f, 0.05676533654332161f, -0.026206301525235176f, -0.152490496635437f,
+    1.2443674802780151f, 0.638075053691864f, 0.7005998492240906f, -0.015903249382972717f,
+    0.5834414958953857f, 0.9597107768058777f, 0.2887430787086487f, 0.6527350544929504f,
+    0.8391838669776917f, 0.8638937473297119f, 1.0362162590026855f, 0.9849265813827515f,
+    1.2424172163009644f, 0.9490883350372314f, 0.679955005645752f, 0.46518850326538086f,
+    1.2453479766845703f, 1.2059887647628784f, 0.00909978523850441f, 0.8221643567085266f,
+    0.3452967405319214f, 0.7576618790626526f, -0.22842805087566376f, 0.5762529969215393f,
+    0.4568062424659729f, 0.600882887840271f, -0.07555822283029556f, 0.4840143024921417f,
+    0.059204377233982086f, 0.9506165385246277f, 0.4854007363319397f, 0.8148940205574036f,
+    0.3448469638824463f, 1.23659086227417f, 0.08093142509460449f, -0.12658819556236267f,
+    0.10618966817855835f, 0.9331203103065491f, 0.28643909096717834f, 0.33655452728271484f,
+    0.7318469882011414f, 0.6551645398139954f, 0.8774868845939636f, 0.9646528959274292f,
+    -0.20065060257911682f, 0.48974233865737915f, 1.100873351097107f, 0.04203440994024277f,
+    1.1139662265777588f, 0.7056944966316223f, 0.034980762749910355f, 0.31401264667510986f,
+    0.9760894179344177f, 1.1711628437042236f, 0.07669847458600998f, 0.18737490475177765f,
+    0.020207412540912628f, 0.5875845551490784f, 0.2223353236913681f, 0.3535780608654022f,
+    0.5858275294303894f, 1.0784671306610107f, 1.038649559020996f, 0.027831336483359337f,
+    0.015231807716190815f, 0.4204186797142029f, 0.8592280745506287f, -0.06826397776603699f,
+    0.4301956593990326f, 1.0830285549163818f, 1.1352618932724f, 1.2472141981124878f,
+    0.48242202401161194f, 0.7624865770339966f, 0.5230287909507751f, 0.32892265915870667f,
+    0.9813376069068909f, 0.41507259011268616f, 0.8857706785202026f, 0.07558850198984146f,
+    -0.1813606321811676f, 0.8654823303222656f, 0.6136446595191956f, 0.42488667368888855f,
+    -0.16156329214572906f, 1.2010060548782349f, -0.09350377321243286f, 0.041754186153411865f,
+    0.048075221478939056f, 0.58381187915802f, 0.07758156210184097f, 0.9226393103599548f,
+    -0.11228642612695694f, 0.186155766248703f, 0.856065034866333f, 0.5072652697563171f,
+    0.6289610862731934f, 1.0283952951431274f, 0.5631003379821777f, 0.9788429141044617f,
+    0.35464468598365784f, 1.2420843839645386f, 0.9817720055580139f, 0.09670861065387726f,
+    0.9392955899238586f, 1.0985063314437866f, 0.39916589856147766f, 0.1857949048280716f,
+    0.25041210651397705f, 0.6066656708717346f, 0.4821832478046417f, 0.0696108490228653f,
+    1.1034834384918213f, -0.1914241909980774f, 0.10629884898662567f, -0.14781519770622253f,
+    0.29001757502555847f, -0.23935836553573608f, 1.2089279890060425f, 1.0154104232788086f,
+    0.7594069242477417f, 0.825311005115509f, 0.5523328185081482f, 0.03462568297982216f,
+    0.24849365651607513f, 0.5422036647796631f, 0.9385983347892761f, 1.0888324975967407f,
+    0.7516513466835022f, 0.6903757452964783f, 0.14698009192943573f, 1.034050464630127f,
+    0.7801323533058167f, 0.1735575646162033f, -0.2175857275724411f, 1.1427043676376343f,
+    -0.13417750597000122f, 0.36328408122062683f, 0.48207542300224304f, 0.43063607811927795f,
+    0.02982853539288044f, 0.33813297748565674f, 1.1899809837341309f, 0.26078569889068604f,
+    1.2207539081573486f, 0.5806925296783447f, 0.6506264209747314f, 1.1377631425857544f,
+    0.11475266516208649f, 0.16719378530979156f, 0.448018878698349f, 0.5405275821685791f,
+    0.8733350038528442f, 0.07157465815544128f, 0.29207462072372437f, 0.3995853662490845f,
+    0.6721583604812622f, -0.053984854370355606f, 0.5013630390167236f, 0.5589209198951721f,
+    0.5234627723693848f, 0.898373544216156f, 0.7507830858230591f, 1.0064971446990967f,
+    0.7160095572471619f, 0.44400522112846375f, 0.8636728525161743f, 0.7053534984588623f,
+    0.20538508892059326f, 1.038453459739685f, 0.9434685111045837f, 1.0009174346923828f,
+    0.8184083700180054f, 0.8318833112716675f, 0.6095288991928101f, -0.20609866082668304f,
+    0.9746174216270447f, -0.11350904405117035f, 0.21946609020233154f, 0.08207634836435318f,
+    0.5733178853988647f, 0.8880987763404846f, 0.5593749284744263f, 0.7783692479133606f,
+    0.5590711236000061f, -0.14788706600666046f, 0.02314530313014984f, 0.9149206280708313f,
+    0.5338531732559204f, 0.1805604249238968f, 0.45131996273994446f, 0.6263018250465393f,
+    0.7152050137519836f, 1.131669521331787f, 0.44419926404953003f, 1.0801165103912354f,
+    1.0934948921203613f, 0.798753559589386f, 1.0756045579910278f, 1.0996628999710083f,
+    0.7580991387367249f, 1.1620292663574219f, 0.5320581197738647f, 1.0609153509140015f,
+    0.5415869951248169f, 0.039137329906225204f, 0.3299025595188141f, 0.8176236748695374f,
+    0.3425334095954895f, 0.04762362316250801f, 1.0497127771377563f, 0.1003086268901825f,
+    0.923150897026062f, 0.9231343269348145f, 1.10855233669281f, 0.12708891928195953f,
+    0.9179434776306152f, -0.06478621810674667f, 0.289368599653244f, -0.18921968340873718f,
+    1.1281654834747314f, 0.9672577381134033f, 0.5077670812606812f, 1.0863792896270752f,
+    0.22008506953716278f, 1.2450199127197266f, 0.9946554899215698f, 1.0735708475112915f,
+    0.6800050139427185f, 0.1891750991344452f, 1.07015061378479f, 0.8753952980041504f,
+    -0.23874090611934662f, 1.1163002252578735f, 0.2768626809120178f, 0.8724419474601746f,
+    0.664237380027771f, 0.33761951327323914f, 0.5580893158912659f, 0.6432077884674072f,
+    -0.12531261146068573f, 0.9752928614616394f, 0.025699710473418236f, 0.10052158683538437f,
+    0.26246166229248047f, 1.154708743095398f, 0.4723929762840271f, 1.0344032049179077f,
+    0.10824110358953476f, 0.34578362107276917f, 0.8307257890701294f, 1.2113614082336426f,
+    0.3403228521347046f, 0.2642061412334442f, 0.38915953040122986f, -0.0611942894756794f,
+    1.1400933265686035f, 0.14121492207050323f, 0.2516229748725891f, 0.17422746121883392f,
+    0.13047631084918976f, -0.1453176736831665f, 0.24498315155506134f, 0.7804968357086182f,
+    0.564730167388916f, -0.11000771075487137f, 0.3105297088623047f, 0.4112926721572876f,
+    0.8803532123565674f, 1.1365764141082764f, -0.011863558553159237f, -0.017166750505566597f,
+    -0.12110482156276703f, 0.3565889298915863f, -0.019191328436136246f, 0.23144209384918213f,
+    -0.2326677441596985f, 0.24516262114048004f, 0.11369086056947708f, 1.1481014490127563f,
+    0.1773267686367035f, 0.873455286026001f, 0.404598206281662f, 0.7062414884567261f,
+    0.21580831706523895f, 0.692526638507843f, 0.806102991104126f, 0.4228404462337494f,
+    0.3689139783382416f, 0.11777055263519287f, 1.1971796751022339f, 0.3208627998828888f,
+    1.1000936031341553f, 1.2160342931747437f, -0.20880982279777527f, 0.9465898871421814f,
+    0.03090864047408104f, 0.29961806535720825f, 0.8020457029342651f, 0.14344964921474457f,
+    0.623325765132904f, 0.21532702445983887f, 0.06530208885669708f, 0.47453543543815613f,
+    0.4096205234527588f, 0.8377119302749634f, 0.23752765357494354f, 0.2665346562862396f,
+    0.5216611623764038f, -0.12447340041399002f, 0.8754685521125793f, 0.18461862206459045f,
+    0.11583714187145233f, 0.12689369916915894f, -0.235357403755188f, 0.6802228093147278f,
+    0.9439234733581543f, 0.7492632865905762f, 0.4531491994857788f, 0.14503255486488342f,
+    0.3761739432811737f, 0.3387521803379059f, 1.1719756126403809f, 1.094567060470581f,
+    0.22586804628372192f, 0.16147184371948242f, 0.3993382751941681f, 0.14305844902992249f,
+    -0.2357996106147766f, 0.26835328340530396f, 0.34964045882225037f, 0.6358251571655273f,
+    -0.24037659168243408f, 0.03813296556472778f, -0.1812090277671814f, -0.14749568700790405f,
+    0.4677586853504181f, 0.5076486468315125f, -0.19071000814437866f, 0.7952382564544678f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    -1.0f, -0.75f, -0.5f, -0.25f,
+    0.0f, 0.25f, 0.5f, 0.75f,
+    1.0f, 1.25f, 1.5f, -1.0f,
+    -0.75f, -0.5f, -0.25f, 0.0f,
+    0.25f, 0.5f, 0.75f, 1.0f,
+    1.25f, 1.5f, -1.0f, -0.75f,
+    -0.5f, -0.25f, 0.0f, 0.25f,
+    0.5f, 0.75f, 1.0f, 1.25f,
+    1.5f, -1.0f, -0.75f, -0.5f,
+    -0.25f, 0.0f, 0.25f, 0.5f,
+    0.75f, 1.0f, 1.25f, 1.5f,
+    -1.0f, -0.75f, -0.5f, -0.25f,
+    0.0f, 0.25f, 0.5f, 0.75f,
+    1.0f, 1.25f, 1.5f, -1.0f,
+};
+
+// normalize()
+static const float FEATURE_NORMALIZED[] = {
+    -0.009635754860937595f, 0.6083442568778992f, 0.3157033324241638f, 0.23440277576446533f,
+    0.7799208164215088f, 1.208348035812378f, 1.2002453804016113f, 0.7569476366043091f,
+    0.9951523542404175f, 0.4395677447319031f, 0.22561633586883545f, 0.5638343691825867f,
+    0.6518350839614868f, 1.119540810585022f, 0.36268603801727295f, 0.5763739347457886f,
+    0.365727961063385f, -0.02141517773270607f, -0.1891869306564331f, 0.09977418929338455f,
+    0.6616763472557068f, 1.1072416305541992f, -0.2369736135005951f, 0.4388105571269989f,
+    0.968845784664154f, 1.1926841735839844f, -0.008203111588954926f, -0.15000148117542267f,
+    -0.026041576638817787f, 0.24026784300804138f, 0.29816150665283203f, 0.6371610760688782f,
+    -0.18009348213672638f, 1.1367952823638916f, 0.7457957863807678f, 0.5535045862197876f,
+    1.230912685394287f, 0.3963697850704193f, 0.1979268491268158f, 0.8733749389648438f,
+    0.9632049798965454f, 0.8256134986877441f, 1.0478687286376953f, -0.071251779794693f,
+    1.1463497877120972f, 0.15821324288845062f, 0.6826001405715942f, 0.13391441106796265f,
+    0.5284280776977539f, 1.1611274480819702f, 0.2588024139404297f, 1.2364641427993774f,
+    0.49649572372436523f, 1.1455234289169312f, 0.49164512753486633f, 0.32611969113349915f,
+    0.9730011820793152f, 0.17856046557426453f, 0.9649961590766907f, 0.17486973106861115f,
+    0.3091067373752594f, 0.8829442262649536f, 0.3223603367805481f, 0.8755251169204712f,
+    0.0030610717367380857f, 0.03169636055827141f, -0.08057624846696854f, 1.0300099849700928f,
+    0.9731453657150269f, 0.9458795189857483f, 1.114193081855774f, -0.24610067903995514f,
+    0.9410541653633118f, -0.21281424164772034f, -0.0006878463900648057f, -0.18983066082000732f,
+    -0.04723813757300377f, -0.21403129398822784f, 1.0813583135604858f, 0.1022268757224083f,
+    0.5608977675437927f, 0.7160456776618958f, 0.2744687497615814f, 0.49973583221435547f,
+    0.7251645922660828f, 1.1377019882202148f, 0.45923516154289246f, 0.21477381885051727f,
+    1.0509623289108276f, 0.5952162146568298f, 0.5955955386161804f, 1.042341947555542f,
+    1.0602021217346191f, 0.6050919890403748f, 0.5634628534317017f, 1.1724870204925537f,
+    1.0026546716690063f, 0.0004630454059224576f, 0.9501834511756897f, 0.22891606390476227f,
+    0.22522695362567902f, 0.9274957776069641f, 0.9163060188293457f, 1.2253599166870117f,
+    0.7804774045944214f, 0.07523098587989807f, -0.14740096032619476f, -0.001868666266091168f,
+    -0.1261964738368988f, 0.20301581919193268f, 0.6463386416435242f, 0.8084344863891602f,
+    0.1303178369998932f, 0.43043190240859985f, 0.8084730505943298f, 0.20799385011196136f,
+    -0.036495428532361984f, -0.09125643223524094f, -0.18672052025794983f, 0.08768200874328613f,
+    0.9922583103179932f, 0.6019800305366516f, -0.1537730097770691f, 0.2691231966018677f,
+    0.47549745440483093f, 0.36495479941368103f, -0.21954086422920227f, 0.05493755266070366f,
+    0.12848883867263794f, 0.25398871302604675f, 0.4713708162307739f, -0.0344194732606411f,
+    0.3559623956680298f, 0.3806951940059662f, 1.2160089015960693f, -0.02611585520207882f,
+    0.8606164455413818f, 0.6464986801147461f, 1.232395887374878f, 1.1343796253204346f,
+    -0.15049375593662262f, -0.13106659054756165f, 0.7005218863487244f, 0.13511113822460175f,
+    0.2563130557537079f, 0.37925541400909424f, 0.6943698525428772f, 0.4182085692882538f,
+    -0.04541010782122612f, 0.8690770864486694f, 0.8295783996582031f, 0.21851129829883575f,
+    -0.07185916602611542f, 0.180698424577713f, -0.17743688821792603f, 0.2608068287372589f,
+    1.2367597818374634f, 0.6184239983558655f, 0.03559557721018791f, 1.2007611989974976f,
+    -0.14989280700683594f, -0.18910981714725494f, 0.529030978679657f, 0.09206293523311615f,
+    0.5105616450309753f, -0.1102033257484436f, 0.9658406972885132f, 0.9131700396537781f,
+    0.447848379611969f, 0.4803035259246826f, 0.49339035153388977f, 1.1049941778182983f,
+    -0.1266799420118332f, 0.5181026458740234f, 0.6008027791976929f, 0.7531630992889404f,
+    0.7401019930839539f, 0.9798267483711243f, -0.024500062689185143f, -0.13076910376548767f,
+    0.31910818815231323f, -0.030576907098293304f, 0.5292271971702576f, 1.2231757640838623f,
+    0.2129324972629547f, -0.053089700639247894f, 1.187036395072937f, 0.09756077080965042f,
+    0.030609073117375374f, -0.19806531071662903f, -0.10844293236732483f, 1.049915075302124f,
+    0.6197752356529236f, 0.4499952495098114f, 0.0009788171155378222f, 0.3070521056652069f,
+    -0.20719178020954132f, 0.35103461146354675f, 0.05713628605008125f, 0.8310214877128601f,
+    0.49300476908683777f, 1.0721876621246338f, -0.21863120794296265f, 0.7797982096672058f,
+    0.7241600155830383f, 0.10572771728038788f, 0.12462208420038223f, 0.601406455039978f,
+    -0.027513425797224045f, 0.4674144387245178f, 0.18969027698040009f, 0.718242347240448f,
+    -0.17439638078212738f, 0.0010123616084456444f, 0.41317880153656006f, 0.03105919249355793f,
+    0.7576294541358948f, 0.12300370633602142f, 0.9435980916023254f, 0.13896723091602325f,
+    0.8023468255996704f, -0.06780584901571274f, 0.747015655040741f, -0.18097637593746185f,
+    1.1315240859985352f, 0.814302384853363f, 1.028856873512268f, -0.21980449557304382f,
+    0.023565329611301422f, 0.16559025645256042f, -0.03655794635415077f, 0.36259591579437256f,
+    0.34132304787635803f, 0.2107112854719162f, 0.08330164849758148f, 0.16095615923404694f,
+    0.03830341994762421f, 1.1314183473587036f, 0.5965829491615295f, 0.655927300453186f,
+    -0.22934900224208832f, 0.22197102010250092f, 0.7209020256996155f, -0.19169078767299652f,
+    -0.2254907190799713f, 0.08344748616218567f, 0.8887549042701721f, 0.8410407304763794f,
+    0.14426395297050476f, 0.8230453729629517f, 0.8932139277458191f, 1.0429579019546509f,
+    0.9813141226768494f, 0.5963491201400757f, 1.058393120765686f, -0.11180496960878372f,
+    -0.05291994661092758f, 0.1342739462852478f, 0.2976428270339966f, 0.18082453310489655f,
+    -0.21184667944908142f, 0.1653725504875183f, -0.1088554784655571f, 0.04104158654808998f,
+    -0.17002420127391815f, 0.2315761148929596f, 1.1806318759918213f, -0.20373348891735077f,
+    0.4514544904232025f, 1.0895118713378906f, 0.8907723426818848f, 1.1766340732574463f,
+    0.34851980209350586f, -0.22714021801948547f, -0.14164629578590393f, 1.233803391456604f,
+    0.6782000064849854f, 0.4763856530189514f, -0.007527364417910576f, -0.024979237467050552f,
+    1.1837817430496216f, 0.8295739889144897f, 0.3660755753517151f, 0.06461869925260544f,
+    0.9345802068710327f, 1.0180617570877075f, -0.09739737212657928f, 0.186911940574646f,
+    0.008891155011951923f, 0.34138306975364685f, 0.09607640653848648f, 0.4303876459598541f,
+    0.019174061715602875f, 1.1640267372131348f, 0.04642059653997421f, 1.2315958738327026f,
+    0.9485154747962952f, 0.9774286150932312f, 1.0507732629776f, 0.9089801907539368f,
+    -0.02795214019715786f, 0.32444408535957336f, 0.11640074104070663f, 0.7397550940513611f,
+    0.16817301511764526f, 0.5028576850891113f, 0.08137526363134384f, -0.2307649850845337f,
+    0.7979534268379211f, 0.6117116808891296f, 1.0095694065093994f, 0.7870421409606934f,
+    0.7225384712219238f, 0.8098925352096558f, 0.2881620228290558f, 0.811164379119873f,
+    0.8002929091453552f, 0.3441750109195709f, 0.24880725145339966f, 0.5784568190574646f,
+    0.6066178679466248f, 0.659650444984436f, 0.8586076498031616f, 1.189523458480835f,
+    0.7636397480964661f, 1.1426094770431519f, 0.13110363483428955f, 0.8937453627586365f,
+    0.6660007238388062f, 0.05676533654332161f, -0.026206301525235176f, -0.152490496635437f,
+    1.2443674802780151f, 0.638075053691864f, 0.7005998492240906f, -0.015903249382972717f,
+    0.5834414958953857f, 0.9597107768058777f, 0.2887430787086487f, 0.6527350544929504f,
+    0.8391838669776917f, 0.8638937473297119f, 1.0362162590026855f, 0.9849265813827515f,
+    1.2424172163009644f, 0.9490883350372314f, 0.679955005645752f, 0.46518850326538086f,
+    1.2453479766845703f, 1.2059887647628784f, 0.00909978523850441f, 0.8221643567085266f,
+    0.3452967405319214f, 0.7576618790626526f, -0.22842805087566376f, 0.5762529969215393f,
+    0.4568062424659729f, 0.600882887840271f, -0.07555822283029556f, 0.4840143024921417f,
+    0.059204377233982086f, 0.9506165385246277f, 0.4854007363319397f, 0.8148940205574036f,
+    0.3448469638824463f, 1.23659086227417f, 0.08093142509460449f, -0.12658819556236267f,
+    0.10618966817855835f, 0.9331203103065491f, 0.28643909096717834f, 0.33655452728271484f,
+    0.7318469882011414f, 0.6551645398139954f, 0.8774868845939636f, 0.9646528959274292f,
+    -0.20065060257911682f, 0.48974233865737915f, 1.100873351097107f, 0.04203440994024277f,
+    1.1139662265777588f, 0.7056944966316223f, 0.034980762749910355f, 0.31401264667510986f,
+    0.9760894179344177f, 1.1711628437042236f, 0.07669847458600998f, 0.18737490475177765f,
+    0.020207412540912628f, 0.5875845551490784f, 0.2223353236913681f, 0.3535780608654022f,
+    0.5858275294303894f, 1.0784671306610107f, 1.038649559020996f, 0.027831336483359337f,
+    0.015231807716190815f, 0.4204186797142029f, 0.8592280745506287f, -0.06826397776603699f,
+    0.4301956593990326f, 1.0830285549163818f, 1.1352618932724f, 1.2472141981124878f,
+    0.48242202401161194f, 0.7624865770339966f, 0.5230287909507751f, 0.32892265915870667f,
+    0.9813376069068909f, 0.41507259011268616f, 0.8857706785202026f, 0.07558850198984146f,
+    -0.1813606321811676f, 0.8654823303222656f, 0.6136446595191956f, 0.42488667368888855f,
+    -0.16156329214572906f, 1.2010060548782349f, -0.09350377321243286f, 0.041754186153411865f,
+    0.048075221478939056f, 0.58381187915802f, 0.07758156210184097f, 0.9226393103599548f,
+    -0.11228642612695694f, 0.186155766248703f, 0.856065034866333f, 0.5072652697563171f,
+    0.6289610862731934f, 1.0283952951431274f, 0.5631003379821777f, 0.9788429141044617f,
+    0.35464468598365784f, 1.2420843839645386f, 0.9817720055580139f, 0.09670861065387726f,
+    0.9392955899238586f, 1.0985063314437866f, 0.39916589856147766f, 0.1857949048280716f,
+    0.25041210651397705f, 0.6066656708717346f, 0.4821832478046417f, 0.0696108490228653f,
+    1.1034834384918213f, -0.1914241909980774f, 0.10629884898662567f, -0.14781519770622253f,
+    0.29001757502555847f, -0.23935836553573608f, 1.2089279890060425f, 1.0154104232788086f,
+    0.7594069242477417f, 0.825311005115509f, 0.5523328185081482f, 0.03462568297982216f,
+    0.24849365651607513f, 0.5422036647796631f, 0.9385983347892761f, 1.0888324975967407f,
+    0.7516513466835022f, 0.6903757452964783f, 0.14698009192943573f, 1.034050464630127f,
+    0.7801323533058167f, 0.1735575646162033f, -0.2175857275724411f, 1.1427043676376343f,
+    -0.13417750597000122f, 0.36328408122062683f, 0.48207542300224304f, 0.43063607811927795f,
+    0.02982853539288044f, 0.33813297748565674f, 1.1899809837341309f, 0.26078569889068604f,
+    1.2207539081573486f, 0.5806925296783447f, 0.6506264209747314f, 1.1377631425857544f,
+    0.11475266516208649f, 0.16719378530979156f, 0.448018878698349f, 0.5405275821685791f,
+    0.8733350038528442f, 0.07157465815544128f, 0.29207462072372437f, 0.3995853662490845f,
+    0.6721583604812622f, -0.053984854370355606f, 0.5013630390167236f, 0.5589209198951721f,
+    0.5234627723693848f, 0.898373544216156f, 0.7507830858230591f, 1.0064971446990967f,
+    0.7160095572471619f, 0.44400522112846375f, 0.8636728525161743f, 0.7053534984588623f,
+    0.20538508892059326f, 1.038453459739685f, 0.9434685111045837f, 1.0009174346923828f,
+    0.8184083700180054f, 0.8318833112716675f, 0.6095288991928101f, -0.20609866082668304f,
+    0.9746174216270447f, -0.11350904405117035f, 0.21946609020233154f, 0.08207634836435318f,
+    0.5733178853988647f, 0.8880987763404846f, 0.5593749284744263f, 0.7783692479133606f,
+    0.5590711236000061f, -0.14788706600666046f, 0.02314530313014984f, 0.9149206280708313f,
+    0.5338531732559204f, 0.1805604249238968f, 0.45131996273994446f, 0.6263018250465393f,
+    0.7152050137519836f, 1.131669521331787f, 0.44419926404953003f, 1.0801165103912354f,
+    1.0934948921203613f, 0.798753559589386f, 1.0756045579910278f, 1.0996628999710083f,
+    0.7580991387367249f, 1.1620292663574219f, 0.5320581197738647f, 1.0609153509140015f,
+    0.5415869951248169f, 0.039137329906225204f, 0.3299025595188141f, 0.8176236748695374f,
+    0.3425334095954895f, 0.04762362316250801f, 1.0497127771377563f, 0.1003086268901825f,
+    0.923150897026062f, 0.9231343269348145f, 1.10855233669281f, 0.12708891928195953f,
+    0.9179434776306152f, -0.06478621810674667f, 0.289368599653244f, -0.18921968340873718f,
+    1.1281654834747314f, 0.9672577381134033f, 0.5077670812606812f, 1.0863792896270752f,
+    0.22008506953716278f, 1.2450199127197266f, 0.9946554899215698f, 1.0735708475112915f,
+    0.6800050139427185f, 0.1891750991344452f, 1.07015061378479f, 0.8753952980041504f,
+    -0.23874090611934662f, 1.1163002252578735f, 0.2768626809120178f, 0.8724419474601746f,
+    0.664237380027771f, 0.33761951327323914f, 0.5580893158912659f, 0.6432077884674072f,
+    -0.12531261146068573f, 0.9752928614616394f, 0.025699710473418236f, 0.10052158683538437f,
+    0.26246166229248047f, 1.154708743095398f, 0.4723929762840271f, 1.0344032049179077f,
+    0.10824110358953476f, 0.34578362107276917f, 0.8307257890701294f, 1.2113614082336426f,
+    0.3403228521347046f, 0.2642061412334442f, 0.38915953040122986f, -0.0611942894756794f,
+    1.1400933265686035f, 0.14121492207050323f, 0.2516229748725891f, 0.17422746121883392f,
+    0.13047631084918976f, -0.1453176736831665f, 0.24498315155506134f, 0.7804968357086182f,
+    0.564730167388916f, -0.11000771075487137f, 0.3105297088623047f, 0.4112926721572876f,
+    0.8803532123565674f, 1.1365764141082764f, -0.011863558553159237f, -0.017166750505566597f,
+    -0.12110482156276703f, 0.3565889298915863f, -0.019191328436136246f, 0.23144209384918213f,
+    -0.2326677441596985f, 0.24516262114048004f, 0.11369086056947708f, 1.1481014490127563f,
+    0.1773267686367035f, 0.873455286026001f, 0.404598206281662f, 0.7062414884567261f,
+    0.21580831706523895f, 0.692526638507843f, 0.806102991104126f, 0.4228404462337494f,
+    0.3689139783382416f, 0.11777055263519287f, 1.1971796751022339f, 0.3208627998828888f,
+    1.1000936031341553f, 1.2160342931747437f, -0.20880982279777527f, 0.9465898871421814f,
+    0.03090864047408104f, 0.29961806535720825f, 0.8020457029342651f, 0.14344964921474457f,
+    0.623325765132904f, 0.21532702445983887f, 0.06530208885669708f, 0.47453543543815613f,
+    0.4096205234527588f, 0.8377119302749634f, 0.23752765357494354f, 0.2665346562862396f,
+    0.5216611623764038f, -0.12447340041399002f, 0.8754685521125793f, 0.18461862206459045f,
+    0.11583714187145233f, 0.12689369916915894f, -0.235357403755188f, 0.6802228093147278f,
+    0.9439234733581543f, 0.7492632865905762f, 0.4531491994857788f, 0.14503255486488342f,
+    0.3761739432811737f, 0.3387521803379059f, 1.1719756126403809f, 1.094567060470581f,
+    0.22586804628372192f, 0.16147184371948242f, 0.3993382751941681f, 0.14305844902992249f,
+    -0.2357996106147766f, 0.26835328340530396f, 0.34964045882225037f, 0.6358251571655273f,
+    -0.24037659168243408f, 0.03813296556472778f, -0.1812090277671814f, -0.14749568700790405f,
+    0.4677586853504181f, 0.5076486468315125f, -0.19071000814437866f, 0.7952382564544678f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    0.0f, 0.0f, 0.0f, 0.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    1.0f, 1.0f, 1.0f, 1.0f,
+    -1.0f, -0.75f, -0.5f, -0.25f,
+    0.0f, 0.25f, 0.5f, 0.75f,
+    1.0f, 1.25f, 1.5f, -1.0f,
+    -0.75f, -0.5f, -0.25f, 0.0f,
+    0.25f, 0.5f, 0.75f, 1.0f,
+    1.25f, 1.5f, -1.0f, -0.75f,
+    -0.5f, -0.25f, 0.0f, 0.25f,
+    0.5f, 0.75f, 1.0f, 1.25f,
+    1.5f, -1.0f, -0.75f, -0.5f,
+    -0.25f, 0.0f, 0.25f, 0.5f,
+    0.75f, 1.0f, 1.25f, 1.5f,
+    -1.0f, -0.75f, -0.5f, -0.25f,
+    0.0f, 0.25f, 0.5f, 0.75f,
+    1.0f, 1.25f, 1.5f, -1.0f,
+};
+
+// quantize(scale=0.003921568859368563, zero_point=-128)
+static const int8_t FEATURE_QUANTIZED_0[] = {
+    -128, 27, -47, -68, 71, 127, 127, 65, 126, -16, -70, 16, 38, 127, -36, 19, -35, -128, -128, -103, 41, 127, -128, -16, 119, 127, -128, -128,
+    -128, -67, -52, 34, -128, 127, 62, 13, 127, -27, -78, 95, 118, 83, 127, -128, 127, -88, 46, -94, 7, 127, -62, 127, -1, 127, -3, -45,
+    120, -82, 118, -83, -49, 97, -46, 95, -127, -120, -128, 127, 120, 113, 127, -128, 112, -128, -128, -128, -128, -128, 127, -102, 15, 55, -58, -1,
+    57, 127, -11, -73, 127, 24, 24, 127, 127, 26, 16, 127, 127, -128, 114, -70, -71, 109, 106, 127, 71, -109, -128, -128, -128, -76, 37, 78,
+    -95, -18, 78, -75, -128, -128, -128, -106, 125, 26, -128, -59, -7, -35, -128, -114, -95, -63, -8, -128, -37, -31, 127, -128, 91, 37, 127, 127,
+    -128, -128, 51, -94, -63, -31, 49, -21, -128, 94, 84, -72, -128, -82, -128, -61, 127, 30, -119, 127, -128, -128, 7, -105, 2, -128, 118, 105,
+    -14, -6, -2, 127, -128, 4, 25, 64, 61, 122, -128, -128, -47, -128, 7, 127, -74, -128, 127, -103, -120, -128, -128, 127, 30, -13, -128, -50,
+    -128, -38, -113, 84, -2, 127, -128, 71, 57, -101, -96, 25, -128, -9, -80, 55, -128, -128, -23, -120, 65, -97, 113, -93, 77, -128, 62, -128,
+    127, 80, 127, -128, -122, -86, -128, -36, -41, -74, -107, -87, -118, 127, 24, 39, -128, -71, 56, -128, -128, -107, 99, 86, -91, 82, 100, 127,
+    122, 24, 127, -128, -128, -94, -52, -82, -128, -86, -128, -118, -128, -69, 127, -128, -13, 127, 99, 127, -39, -128, -128, 127, 45, -7, -128, -128,
+    127, 84, -35, -112, 110, 127, -128, -80, -126, -41, -104, -18, -123, 127, -116, 127, 114, 121, 127, 104, -128, -45, -98, 61, -85, 0, -107, -128,
+    75, 28, 127, 73, 56, 79, -55, 79, 76, -40, -65, 20, 27, 40, 91, 127, 67, 127, -95, 100, 42, -114, -128, -128, 127, 35, 51, -128,
+    21, 117, -54, 38, 86, 92, 127, 123, 127, 114, 45, -9, 127, 127, -126, 82, -40, 65, -128, 19, -12, 25, -128, -5, -113, 114, -4, 80,
+    -40, 127, -107, -128, -101, 110, -55, -42, 59, 39, 96, 118, -128, -3, 127, -117, 127, 52, -119, -48, 121, 127, -108, -80, -123, 22, -71, -38,
+    21, 127, 127, -121, -124, -21, 91, -128, -18, 127, 127, 127, -5, 66, 5, -44, 122, -22, 98, -109, -128, 93, 28, -20, -128, 127, -128, -117,
+    -116, 21, -108, 107, -128, -81, 90, 1, 32, 127, 16, 122, -38, 127, 122, -103, 112, 127, -26, -81, -64, 27, -5, -110, 127, -128, -101, -128,
+    -54, -128, 127, 127, 66, 82, 13, -119, -65, 10, 111, 127, 64, 48, -91, 127, 71, -84, -128, 127, -128, -35, -5, -18, -120, -42, 127, -61,
+    127, 20, 38, 127, -99, -85, -14, 10, 95, -110, -54, -26, 43, -128, 0, 15, 5, 101, 63, 127, 55, -15, 92, 52, -76, 127, 113, 127,
+    81, 84, 27, -128, 121, -128, -72, -107, 18, 98, 15, 70, 15, -128, -122, 105, 8, -82, -13, 32, 54, 127, -15, 127, 127, 76, 127, 127,
+    65, 127, 8, 127, 10, -118, -44, 80, -41, -116, 127, -102, 107, 107, 127, -96, 106, -128, -54, -128, 127, 119, 1, 127, -72, 127, 126, 127,
+    45, -80, 127, 95, -128, 127, -57, 94, 41, -42, 14, 36, -128, 121, -121, -102, -61, 127, -8, 127, -100, -40, 84, 127, -41, -61, -29, -128,
+    127, -92, -64, -84, -95, -128, -66, 71, 16, -128, -49, -23, 96, 127, -128, -128, -128, -37, -128, -69, -128, -65, -99, 127, -83, 95, -25, 52,
+    -73, 49, 78, -20, -34, -98, 127, -46, 127, 127, -128, 113, -120, -52, 77, -91, 31, -73, -111, -7, -24, 86, -67, -60, 5, -128, 95, -81,
+    -98, -96, -128, 45, 113, 63, -12, -91, -32, -42, 127, 127, -70, -87, -26, -92, -128, -60, -39, 34, -128, -118, -128, -128, -9, 1, -128, 75,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    -128, -128, -128, -128, -128, -64, -1, 63, 127, 127, 127, -128, -128, -128, -128, -128, -64, -1, 63, 127, 127, 127, -128, -128, -128, -128, -128, -64,
+    -1, 63, 127, 127, 127, -128, -128, -128, -128, -128, -64, -1, 63, 127, 127, 127, -128, -128, -128, -128, -128, -64, -1, 63, 127, 127, 127, -128,
+};
+
+// quantize(scale=0.0078125, zero_point=0)
+static const int8_t FEATURE_QUANTIZED_1[] = {
+    -1, 78, 40, 30, 100, 127, 127, 97, 127, 56, 29, 72, 83, 127, 46, 74, 47, -3, -24, 13, 85, 127, -30, 56, 124, 127, -1, -19,
+    -3, 31, 38, 82, -23, 127, 95, 71, 127, 51, 25, 112, 123, 106, 127, -9, 127, 20, 87, 17, 68, 127, 33, 127, 64, 127, 63, 42,
+    125, 23, 124, 22, 40, 113, 41, 112, 0, 4, -10, 127, 125, 121, 127, -32, 120, -27, 0, -24, -6, -27, 127, 13, 72, 92, 35, 64,
+    93, 127, 59, 27, 127, 76, 76, 127, 127, 77, 72, 127, 127, 0, 122, 29, 29, 119, 117, 127, 100, 10, -19, 0, -16, 26, 83, 103,
+    17, 55, 103, 27, -5, -12, -24, 11, 127, 77, -20, 34, 61, 47, -28, 7, 16, 33, 60, -4, 46, 49, 127, -3, 110, 83, 127, 127,
+    -19, -17, 90, 17, 33, 49, 89, 54, -6, 111, 106, 28, -9, 23, -23, 33, 127, 79, 5, 127, -19, -24, 68, 12, 65, -14, 124, 117,
+    57, 61, 63, 127, -16, 66, 77, 96, 95, 125, -3, -17, 41, -4, 68, 127, 27, -7, 127, 12, 4, -25, -14, 127, 79, 58, 0, 39,
+    -27, 45, 7, 106, 63, 127, -28, 100, 93, 14, 16, 77, -4, 60, 24, 92, -22, 0, 53, 4, 97, 16, 121, 18, 103, -9, 96, -23,
+    127, 104, 127, -28, 3, 21, -5, 46, 44, 27, 11, 21, 5, 127, 76, 84, -29, 28, 92, -25, -29, 11, 114, 108, 18, 105, 114, 127,
+    126, 76, 127, -14, -7, 17, 38, 23, -27, 21, -14, 5, -22, 30, 127, -26, 58, 127, 114, 127, 45, -29, -18, 127, 87, 61, -1, -3,
+    127, 106, 47, 8, 120, 127, -12, 24, 1, 44, 12, 55, 2, 127, 6, 127, 121, 125, 127, 116, -4, 42, 15, 95, 22, 64, 10, -30,
+    102, 78, 127, 101, 92, 104, 37, 104, 102, 44, 32, 74, 78, 84, 110, 127, 98, 127, 17, 114, 85, 7, -3, -20, 127, 82, 90, -2,
+    75, 123, 37, 84, 107, 111, 127, 126, 127, 121, 87, 60, 127, 127, 1, 105, 44, 97, -29, 74, 58, 77, -10, 62, 8, 122, 62, 104,
+    44, 127, 10, -16, 14, 119, 37, 43, 94, 84, 112, 123, -26, 63, 127, 5, 127, 90, 4, 40, 125, 127, 10, 24, 3, 75, 28, 45,
+    75, 127, 127, 4, 2, 54, 110, -9, 55, 127, 127, 127, 62, 98, 67, 42, 126, 53, 113, 10, -23, 111, 79, 54, -21, 127, -12, 5,
+    6, 75, 10, 118, -14, 24, 110, 65, 81, 127, 72, 125, 45, 127, 126, 12, 120, 127, 51, 24, 32, 78, 62, 9, 127, -25, 14, -19,
+    37, -31, 127, 127, 97, 106, 71, 4, 32, 69, 120, 127, 96, 88, 19, 127, 100, 22, -28, 127, -17, 47, 62, 55, 4, 43, 127, 33,
+    127, 74, 83, 127, 15, 21, 57, 69, 112, 9, 37, 51, 86, -7, 64, 72, 67, 115, 96, 127, 92, 57, 111, 90, 26, 127, 121, 127,
+    105, 106, 78, -26, 125, -15, 28, 11, 73, 114, 72, 100, 72, -19, 3, 117, 68, 23, 58, 80, 92, 127, 57, 127, 127, 102, 127, 127,
+    97, 127, 68, 127, 69, 5, 42, 105, 44, 6, 127, 13, 118, 118, 127, 16, 117, -8, 37, -24, 127, 124, 65, 127, 28, 127, 127, 127,
+    87, 24, 127, 112, -31, 127, 35, 112, 85, 43, 71, 82, -16, 125, 3, 13, 34, 127, 60, 127, 14, 44, 106, 127, 44, 34, 50, -8,
+    127, 18, 32, 22, 17, -19, 31, 100, 72, -14, 40, 53, 113, 127, -2, -2, -16, 46, -2, 30, -30, 31, 15, 127, 23, 112, 52, 90,
+    28, 89, 103, 54, 47, 15, 127, 41, 127, 127, -27, 121, 4, 38, 103, 18, 80, 28, 8, 61, 52, 107, 30, 34, 67, -16, 112, 24,
+    15, 16, -30, 87, 121, 96, 58, 19, 48, 43, 127, 127, 29, 21, 51, 18, -30, 34, 45, 81, -31, 5, -23, -19, 60, 65, -24, 102,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+    -128, -96, -64, -32, 0, 32, 64, 96, 127, 127, 127, -128, -96, -64, -32, 0, 32, 64, 96, 127, 127, 127, -128, -96, -64, -32, 0, 32,
+    64, 96, 127, 127, 127, -128, -96, -64, -32, 0, 32, 64, 96, 127, 127, 127, -128, -96, -64, -32, 0, 32, 64, 96, 127, 127, 127, -128,
+};
+
+// quantize(scale=0.009999999776482582, zero_point=-50)
+static const int8_t FEATURE_QUANTIZED_2[] = {
+    -51, 11, -18, -27, 28, 71, 70, 26, 50, -6, -27, 6, 15, 62, -14, 8, -13, -52, -69, -40, 16, 61, -74, -6, 47, 69, -51, -65,
+    -53, -26, -20, 14, -68, 64, 25, 5, 73, -10, -30, 37, 46, 33, 55, -57, 65, -34, 18, -37, 3, 66, -24, 74, 0, 65, -1, -17,
+    47, -32, 46, -33, -19, 38, -18, 38, -50, -47, -58, 53, 47, 45, 61, -75, 44, -71, -50, -69, -55, -71, 58, -40, 6, 22, -23, 0,
+    23, 64, -4, -29, 55, 10, 10, 54, 56, 11, 6, 67, 50, -50, 45, -27, -27, 43, 42, 73, 28, -42, -65, -50, -63, -30, 15, 31,
+    -37, -7, 31, -29, -54, -59, -69, -41, 49, 10, -65, -23, -2, -14, -72, -45, -37, -25, -3, -53, -14, -12, 72, -53, 36, 15, 73, 63,
+    -65, -63, 20, -36, -24, -12, 19, -8, -55, 37, 33, -28, -57, -32, -68, -24, 74, 12, -46, 70, -65, -69, 3, -41, 1, -61, 47, 41,
+    -5, -2, -1, 60, -63, 2, 10, 25, 24, 48, -52, -63, -18, -53, 3, 72, -29, -55, 69, -40, -47, -70, -61, 55, 12, -5, -50, -19,
+    -71, -15, -44, 33, -1, 57, -72, 28, 22, -39, -38, 10, -53, -3, -31, 22, -67, -50, -9, -47, 26, -38, 44, -36, 30, -57, 25, -68,
+    63, 31, 53, -72, -48, -33, -54, -14, -16, -29, -42, -34, -46, 63, 10, 16, -73, -28, 22, -69, -73, -42, 39, 34, -36, 32, 39, 54,
+    48, 10, 56, -61, -55, -37, -20, -32, -71, -33, -61, -46, -67, -27, 68, -70, -5, 59, 39, 68, -15, -73, -64, 73, 18, -2, -51, -52,
+    68, 33, -13, -44, 43, 52, -60, -31, -49, -16, -40, -7, -48, 66, -45, 73, 45, 48, 55, 41, -53, -18, -38, 24, -33, 0, -42, -73,
+    30, 11, 51, 29, 22, 31, -21, 31, 30, -16, -25, 8, 11, 16, 36, 69, 26, 64, -37, 39, 17, -44, -53, -65, 74, 14, 20, -52,
+    8, 46, -21, 15, 34, 36, 54, 48, 74, 45, 18, -3, 75, 71, -49, 32, -15, 26, -73, 8, -4, 10, -58, -2, -44, 45, -1, 31,
+    -16, 74, -42, -63, -39, 43, -21, -16, 23, 16, 38, 46, -70, -1, 60, -46, 61, 21, -47, -19, 48, 67, -42, -31, -48, 9, -28, -15,
+    9, 58, 54, -47, -48, -8, 36, -57, -7, 58, 64, 75, -2, 26, 2, -17, 48, -8, 39, -42, -68, 37, 11, -8, -66, 70, -59, -46,
+    -45, 8, -42, 42, -61, -31, 36, 1, 13, 53, 6, 48, -15, 74, 48, -40, 44, 60, -10, -31, -25, 11, -2, -43, 60, -69, -39, -65,
+    -21, -74, 71, 52, 26, 33, 5, -47, -25, 4, 44, 59, 25, 19, -35, 53, 28, -33, -72, 64, -63, -14, -2, -7, -47, -16, 69, -24,
+    72, 8, 15, 64, -39, -33, -5, 4, 37, -43, -21, -10, 17, -55, 0, 6, 2, 40, 25, 51, 22, -6, 36, 21, -29, 54, 44, 50,
+    32, 33, 11, -71, 47, -61, -28, -42, 7, 39, 6, 28, 6, -65, -48, 41, 3, -32, -5, 13, 22, 63, -6, 58, 59, 30, 58, 60,
+    26, 66, 3, 56, 4, -46, -17, 32, -16, -45, 55, -40, 42, 42, 61, -37, 42, -56, -21, -69, 63, 47, 1, 59, -28, 75, 49, 57,
+    18, -31, 57, 38, -74, 62, -22, 37, 16, -16, 6, 14, -63, 48, -47, -40, -24, 65, -3, 53, -39, -15, 33, 71, -16, -24, -11, -56,
+    64, -36, -25, -33, -37, -65, -26, 28, 6, -61, -19, -9, 38, 64, -51, -52, -62, -14, -52, -27, -73, -25, -39, 65, -32, 37, -10, 21,
+    -28, 19, 31, -8, -13, -38, 70, -18, 60, 72, -71, 45, -47, -20, 30, -36, 12, -28, -43, -3, -9, 34, -26, -23, 2, -62, 38, -32,
+    -38, -37, -74, 18, 44, 25, -5, -35, -12, -16, 67, 59, -27, -34, -10, -36, -74, -23, -15, 14, -74, -46, -68, -65, -3, 1, -69, 30,
+    -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50,
+    -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50, -50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    -128, -125, -100, -75, -50, -25, 0, 25, 50, 75, 100, -128, -125, -100, -75, -50, -25, 0, 25, 50, 75, 100, -128, -125, -100, -75, -50, -25,
+    0, 25, 50, 75, 100, -128, -125, -100, -75, -50, -25, 0, 25, 50, 75, 100, -128, -125, -100, -75, -50, -25, 0, 25, 50, 75, 100, -128,
+};
+
+// quantize(scale=0.5, zero_point=0)
+static const int8_t FEATURE_QUANTIZED_3[] = {
+    0, 1, 1, 0, 2, 2, 2, 2, 2, 1, 0, 1, 1, 2, 1, 1, 1, 0, 0, 0, 1, 2, 0, 1, 2, 2, 0, 0,
+    0, 0, 1, 1, 0, 2, 1, 1, 2, 1, 0, 2, 2, 2, 2, 0, 2, 0, 1, 0, 1, 2, 1, 2, 1, 2, 1, 1,
+    2, 0, 2, 0, 1, 2, 1, 2, 0, 0, 0, 2, 2, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 1, 1, 1, 1,
+    1, 2, 1, 0, 2, 1, 1, 2, 2, 1, 1, 2, 2, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 1, 2,
+    0, 1, 2, 0, 0, 0, 0, 0, 2, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 1, 2, 0, 2, 1, 2, 2,
+    0, 0, 1, 0, 1, 1, 1, 1, 0, 2, 2, 0, 0, 0, 0, 1, 2, 1, 0, 2, 0, 0, 1, 0, 1, 0, 2, 2,
+    1, 1, 1, 2, 0, 1, 1, 2, 1, 2, 0, 0, 1, 0, 1, 2, 0, 0, 2, 0, 0, 0, 0, 2, 1, 1, 0, 1,
+    0, 1, 0, 2, 1, 2, 0, 2, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 2, 0, 2, 0, 2, 0, 1, 0,
+    2, 2, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 1, 1, 0, 0, 1, 0, 0, 0, 2, 2, 0, 2, 2, 2,
+    2, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 2, 2, 2, 1, 0, 0, 2, 1, 1, 0, 0,
+    2, 2, 1, 0, 2, 2, 0, 0, 0, 1, 0, 1, 0, 2, 0, 2, 2, 2, 2, 2, 0, 1, 0, 1, 0, 1, 0, 0,
+    2, 1, 2, 2, 1, 2, 1, 2, 2, 1, 0, 1, 1, 1, 2, 2, 2, 2, 0, 2, 1, 0, 0, 0, 2, 1, 1, 0,
+    1, 2, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 0, 2, 1, 2, 0, 1, 1, 1, 0, 1, 0, 2, 1, 2,
+    1, 2, 0, 0, 0, 2, 1, 1, 1, 1, 2, 2, 0, 1, 2, 0, 2, 1, 0, 1, 2, 2, 0, 0, 0, 1, 0, 1,
+    1, 2, 2, 0, 0, 1, 2, 0, 1, 2, 2, 2, 1, 2, 1, 1, 2, 1, 2, 0, 0, 2, 1, 1, 0, 2, 0, 0,
+    0, 1, 0, 2, 0, 0, 2, 1, 1, 2, 1, 2, 1, 2, 2, 0, 2, 2, 1, 0, 1, 1, 1, 0, 2, 0, 0, 0,
+    1, 0, 2, 2, 2, 2, 1, 0, 0, 1, 2, 2, 2, 1, 0, 2, 2, 0, 0, 2, 0, 1, 1, 1, 0, 1, 2, 1,
+    2, 1, 1, 2, 0, 0, 1, 1, 2, 0, 1, 1, 1, 0, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1, 0, 2, 2, 2,
+    2, 2, 1, 0, 2, 0, 0, 0, 1, 2, 1, 2, 1, 0, 0, 2, 1, 0, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2,
+    2, 2, 1, 2, 1, 0, 1, 2, 1, 0, 2, 0, 2, 2, 2, 0, 2, 0, 1, 0, 2, 2, 1, 2, 0, 2, 2, 2,
+    1, 0, 2, 2, 0, 2, 1, 2, 1, 1, 1, 1, 0, 2, 0, 0, 1, 2, 1, 2, 0, 1, 2, 2, 1, 1, 1, 0,
+    2, 0, 1, 0, 0, 0, 0, 2, 1, 0, 1, 1, 2, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 2, 1, 1,
+    0, 1, 2, 1, 1, 0, 2, 1, 2, 2, 0, 2, 0, 1, 2, 0, 1, 0, 0, 1, 1, 2, 0, 1, 1, 0, 2, 0,
+    0, 0, 0, 1, 2, 1, 1, 0, 1, 1, 2, 2, 0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    -2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 3, -2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 3, -2, -2, -1, 0, 0, 0,
+    1, 2, 2, 2, 3, -2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 3, -2, -2, -1, 0, 0, 0, 1, 2, 2, 2, 3, -2,
+};
+
+static const FeatureQuantCase FEATURE_QUANT[] = {
+    {0.003921568859368563f, -128, FEATURE_QUANTIZED_0},
+    {0.0078125f, 0, FEATURE_QUANTIZED_1},
+    {0.009999999776482582f, -50, FEATURE_QUANTIZED_2},
+    {0.5f, 0, FEATURE_QUANTIZED_3},
+};
@@ -0,0 +1,11 @@
+/**
+ * @file neura9_deps.cpp
+ * @brief Módulos do firmware que o NEURA9Inference usa, fora do test_main
+ *
+ * model_runtime.cpp tem o próprio s_interpreterMem estático, por isso não
+ * entra na mesma unidade que neura9_inference.cpp.
+ */
+
+#include "ai/feature_sequence.cpp"
+#include "ai/model_runtime.cpp"
+#include "ai/neura9_model_data.cpp"
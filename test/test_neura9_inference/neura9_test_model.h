@@ -0,0 +1,149 @@
+#pragma once
+/**
+ * @file neura9_test_model.h
+ * @brief Modelo INT8 de pesos conhecidos no formato de entrada do NEURA9
+ *
+ * Montado com o FlatBufferBuilder do próprio TFLite (sem TensorFlow no
+ * host): entrada INT8 [1, 56] -> FULLY_CONNECTED(16, ReLU) ->
+ * FULLY_CONNECTED(5) -> SOFTMAX, como o modelo treinado em ai_training/.
+ *
+ * Os pesos fazem uma regra fixa, para a avaliação ter resposta certa:
+ * SAFE vale uma constante e cada ataque vale a feature que o denuncia
+ * (deauth_rate, oui_score, beacon_rate, probereq_rate). A classe é a maior.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include "ai/neura9_feature_schema.h"
+
+#define TEST_MODEL_HIDDEN 16
+#define TEST_MODEL_CLASSES 5
+// Nível da classe SAFE: ataque só vence com a feature acima disto
+#define TEST_MODEL_SAFE_LEVEL 0.3f
+
+// Feature que denuncia cada classe (SAFE não tem)
+static const int TEST_MODEL_FEATURE[TEST_MODEL_CLASSES] = {
+    -1, NEURA9_F_DEAUTH_RATE, NEURA9_F_OUI_SCORE, NEURA9_F_BEACON_RATE,
+    NEURA9_F_PROBEREQ_RATE};
+
+namespace testmodel {
+
+using namespace tflite;
+
+// Faixa [lo, hi] em INT8 (escala e zero-point de um tensor)
+struct QParams {
+  float scale;
+  int64_t zeroPoint;
+};
+
+static QParams range(float lo, float hi) {
+  float scale = (hi - lo) / 255.0f;
+  return {scale, (int64_t)(-128 - lo / scale)};
+}
+
+static flatbuffers::Offset<Tensor>
+tensor(flatbuffers::FlatBufferBuilder &fbb, std::vector<int32_t> shape,
+       TensorType type, uint32_t buffer, const char *name, QParams q) {
+  return CreateTensor(
+      fbb, fbb.CreateVector(shape), type, buffer, fbb.CreateString(name),
+      CreateQuantizationParameters(
+          fbb, 0, 0, fbb.CreateVector(std::vector<float>{q.scale}),
+          fbb.CreateVector(std::vector<int64_t>{q.zeroPoint})));
+}
+
+static flatbuffers::Offset<flatbuffers::Vector<int32_t>>
+ids(flatbuffers::FlatBufferBuilder &fbb, std::vector<int32_t> v) {
+  return fbb.CreateVector(v);
+}
+
+template <typename T>
+static flatbuffers::Offset<Buffer> buffer(flatbuffers::FlatBufferBuilder &fbb,
+                                          const std::vector<T> &v) {
+  return CreateBuffer(
+      fbb, fbb.CreateVector((const uint8_t *)v.data(), v.size() * sizeof(T)));
+}
+
+} // namespace testmodel
+
+/**
+ * @brief Flatbuffer do modelo de teste (passar para setModelData)
+ */
+static std::vector<uint8_t> buildTestModel() {
+  using namespace tflite;
+  using namespace testmodel;
+  // O flatbuffers do TFLite Micro não tem alocador padrão implícito
+  flatbuffers::DefaultAllocator alloc;
+  flatbuffers::FlatBufferBuilder fbb(2048, &alloc);
+
+  const int IN = NEURA9_FEATURE_COUNT, H = TEST_MODEL_HIDDEN,
+            C = TEST_MODEL_CLASSES;
+  // Entrada e camada oculta em [0, 1]; logits em [0, 4]
+  const QParams qIn = range(0.0f, 1.0f), qHidden = range(0.0f, 1.0f),
+                qLogits = range(0.0f, 4.0f);
+  const QParams qW1 = {1.0f / 127, 0}, qW2 = {4.0f / 127, 0};
+  const QParams qOut = {1.0f / 256, -128}; // Exigido pelo SOFTMAX INT8
+
+  // Oculta: unidade c copia a feature da classe c; a unidade 0 é a
+  // constante de SAFE (só bias); as demais ficam em zero
+  std::vector<int8_t> w1(H * IN, 0);
+  std::vector<int32_t> b1(H, 0);
+  b1[0] = (int32_t)lrintf(TEST_MODEL_SAFE_LEVEL / (qIn.scale * qW1.scale));
+  for (int c = 1; c < C; c++)
+    w1[c * IN + TEST_MODEL_FEATURE[c]] = 127;
+  // Saída: logit c = 4 * oculta c
+  std::vector<int8_t> w2(C * H, 0);
+  std::vector<int32_t> b2(C, 0);
+  for (int c = 0; c < C; c++)
+    w2[c * H + c] = 127;
+
+  std::vector<flatbuffers::Offset<Buffer>> buffers = {
+      CreateBuffer(fbb), buffer(fbb, w1), buffer(fbb, b1), buffer(fbb, w2),
+      buffer(fbb, b2)};
+
+  std::vector<flatbuffers::Offset<Tensor>> tensors = {
+      tensor(fbb, {1, IN}, TensorType_INT8, 0, "input", qIn),
+      tensor(fbb, {H, IN}, TensorType_INT8, 1, "dense1/w", qW1),
+      tensor(fbb, {H}, TensorType_INT32, 2, "dense1/b",
+             {qIn.scale * qW1.scale, 0}),
+      tensor(fbb, {1, H}, TensorType_INT8, 0, "dense1", qHidden),
+      tensor(fbb, {C, H}, TensorType_INT8, 3, "dense2/w", qW2),
+      tensor(fbb, {C}, TensorType_INT32, 4, "dense2/b",
+             {qHidden.scale * qW2.scale, 0}),
+      tensor(fbb, {1, C}, TensorType_INT8, 0, "logits", qLogits),
+      tensor(fbb, {1, C}, TensorType_INT8, 0, "output", qOut)};
+
+  auto relu = CreateFullyConnectedOptions(fbb, ActivationFunctionType_RELU);
+  auto linear = CreateFullyConnectedOptions(fbb, ActivationFunctionType_NONE);
+  std::vector<flatbuffers::Offset<Operator>> ops = {
+      CreateOperator(fbb, 0, ids(fbb, {0, 1, 2}),
+                     ids(fbb, {3}),
+                     BuiltinOptions_FullyConnectedOptions, relu.Union()),
+      CreateOperator(fbb, 0, ids(fbb, {3, 4, 5}),
+                     ids(fbb, {6}),
+                     BuiltinOptions_FullyConnectedOptions, linear.Union()),
+      CreateOperator(fbb, 1, ids(fbb, {6}),
+                     ids(fbb, {7}),
+                     BuiltinOptions_SoftmaxOptions,
+                     CreateSoftmaxOptions(fbb, 1.0f).Union())};
+
+  std::vector<flatbuffers::Offset<OperatorCode>> codes = {
+      CreateOperatorCode(fbb, BuiltinOperator_FULLY_CONNECTED, 0, 1,
+                         BuiltinOperator_FULLY_CONNECTED),
+      CreateOperatorCode(fbb, BuiltinOperator_SOFTMAX, 0, 1,
+                         BuiltinOperator_SOFTMAX)};
+
+  auto subgraph = CreateSubGraph(
+      fbb, fbb.CreateVector(tensors), ids(fbb, {0}),
+      ids(fbb, {7}), fbb.CreateVector(ops));
+  FinishModelBuffer(fbb, CreateModel(fbb, TFLITE_SCHEMA_VERSION,
+                                     fbb.CreateVector(codes),
+                                     fbb.CreateVector(&subgraph, 1),
+                                     fbb.CreateString("neura9 host test"),
+                                     fbb.CreateVector(buffers)));
+  return std::vector<uint8_t>(fbb.GetBufferPointer(),
+                              fbb.GetBufferPointer() + fbb.GetSize());
+}
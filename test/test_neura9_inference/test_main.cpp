@@ -0,0 +1,254 @@
+/**
+ * @file test_main.cpp
+ * @brief NEURA9Inference no host: empacotamento, plano de memória,
+ * benchmark e avaliação
+ *
+ * O empacotamento da entrada é conferido contra normalize()/quantize() de
+ * ai_training/neura9_features.py nos vetores de feature_vectors.h, gerado
+ * por ai_training/tools/export_feature_fixture.py.
+ *
+ * Roda o NEURA9Inference do firmware sobre o TFLite Micro vendorizado
+ * (kernels de referência, um arquivo tflite_*.cpp por fonte). O
+ * g_neura9_model_data embarcado ainda não passa no verificador de
+ * flatbuffer, então o modelo vem de neura9_test_model.h via setModelData():
+ * mesmas ops e mesmo formato de entrada, com pesos de resposta conhecida.
+ *
+ * Latência com o relógio real do host (HOST_REAL_CLOCK); no device,
+ * POST /api/ai/bench.
+ */
+
+#define HOST_REAL_CLOCK 1
+
+#include <unity.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "ai/neura9_inference.cpp"
+
+#include "feature_vectors.h"
+#include "neura9_test_model.h"
+
+void setUp() { host::nvs().clear(); }
+void tearDown() {}
+
+static const std::vector<uint8_t> &testModel() {
+  static std::vector<uint8_t> m = buildTestModel();
+  return m;
+}
+
+static bool beginWithTestModel(NEURA9Inference &n) {
+  n.setModelData(testModel().data(), testModel().size());
+  return n.begin();
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// DATASET ROTULADO
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define EVAL_PER_CLASS 80
+#define EVAL_BAD_ROWS 2
+
+static uint32_t s_seed = 7;
+static float uniform(float lo, float hi) {
+  s_seed = s_seed * 1664525u + 1013904223u;
+  return lo + (hi - lo) * (float)(s_seed >> 8) / (float)(1u << 24);
+}
+
+// Mesmo formato de ai_training/tools/export_eval_csv.py: cabeçalho, 56
+// valores e o rótulo. Ataque: feature da classe em [0,5, 1]; o resto em
+// [0, 0,2], abaixo do nível de SAFE
+static void writeDataset(const char *path) {
+  FILE *f = fopen(path, "w");
+  TEST_ASSERT_NOT_NULL(f);
+  for (int k = 0; k < NEURA9_FEATURE_COUNT; k++)
+    fprintf(f, "f%d,", k);
+  fprintf(f, "label\n");
+  for (int i = 0; i < EVAL_PER_CLASS * TEST_MODEL_CLASSES; i++) {
+    int label = i % TEST_MODEL_CLASSES;
+    for (int k = 0; k < NEURA9_FEATURE_COUNT; k++) {
+      float v = k == TEST_MODEL_FEATURE[label] ? uniform(0.5f, 1.0f)
+                                                : uniform(0.0f, 0.2f);
+      fprintf(f, "%.6f,", v);
+    }
+    fprintf(f, "%d\n", label);
+  }
+  fprintf(f, "0.1,0.2,3\n"); // Faltam features
+  for (int k = 0; k < NEURA9_FEATURE_COUNT; k++)
+    fprintf(f, "0,");
+  fprintf(f, "99\n"); // Rótulo fora da faixa
+  fclose(f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+static_assert(FEATURE_VECTOR_WIDTH == NEURA9_FEATURE_COUNT,
+              "feature_vectors.h de outro esquema: rode export_feature_fixture.py");
+
+static void loadRow(Neura9Features *f, int row) {
+  memcpy(f, &FEATURE_VECTORS[row * FEATURE_VECTOR_WIDTH], sizeof(*f));
+}
+
+// Entrada float: os mesmos bits de normalize() do Python
+void test_normalize_matches_python() {
+  Neura9Features f;
+  float out[NEURA9_FEATURE_COUNT];
+  int mismatches = 0;
+  for (int r = 0; r < FEATURE_VECTOR_ROWS; r++) {
+    loadRow(&f, r);
+    NEURA9Inference::normalizeFeatures(f, out, NEURA9_FEATURE_COUNT);
+    mismatches += memcmp(out, &FEATURE_NORMALIZED[r * FEATURE_VECTOR_WIDTH],
+                         sizeof(out)) != 0;
+  }
+  TEST_ASSERT_EQUAL_INT(0, mismatches);
+}
+
+// Entrada INT8: mul/add do begin() e arredondamento iguais a quantize(),
+// inclusive saturação e meios degraus (par mais próximo)
+void test_quantize_matches_python() {
+  Neura9Features f;
+  int8_t out[NEURA9_FEATURE_COUNT];
+  float mul[NEURA9_FEATURE_COUNT], add[NEURA9_FEATURE_COUNT];
+  for (int c = 0; c < FEATURE_QUANT_CASES; c++) {
+    const FeatureQuantCase &q = FEATURE_QUANT[c];
+    TfLiteTensor in = {};
+    in.params.scale = q.scale;
+    in.params.zero_point = q.zeroPoint;
+    computeQuantParams(&in, mul, add);
+
+    int diff = 0;
+    for (int r = 0; r < FEATURE_VECTOR_ROWS; r++) {
+      loadRow(&f, r);
+      NEURA9Inference::quantizeFeatures(f, mul, add, out,
+                                        NEURA9_FEATURE_COUNT);
+      const int8_t *ref = &q.expected[r * FEATURE_VECTOR_WIDTH];
+      for (int k = 0; k < NEURA9_FEATURE_COUNT; k++)
+        diff += out[k] != ref[k];
+    }
+    char msg[80];
+    snprintf(msg, sizeof(msg), "scale %g, zero-point %d: %d valores diferentes",
+             (double)q.scale, (int)q.zeroPoint, diff);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, diff, msg);
+  }
+}
+
+// Primeiro boot: arena medida (bem abaixo do teto) e plano salvo na NVS
+void test_plan_measures_arena() {
+  NEURA9Inference n;
+  TEST_ASSERT_TRUE(beginWithTestModel(n));
+  const Neura9MemoryPlan &plan = n.getMemoryPlan();
+  TEST_ASSERT_GREATER_THAN_UINT32(0, plan.arenaSize);
+  TEST_ASSERT_LESS_THAN_UINT32(NEURA9_ARENA_SIZE, plan.arenaSize);
+  TEST_ASSERT_EQUAL_UINT32(testModel().size(), plan.modelLen);
+  TEST_ASSERT_EQUAL_UINT32(1, host::nvs().count("neura9/plan"));
+  TEST_ASSERT_FALSE(n.isSequenceModel()); // Entrada [1, 56]
+
+  char msg[80];
+  snprintf(msg, sizeof(msg), "arena do plano %u B (teto %u B)",
+           (unsigned)plan.arenaSize, (unsigned)NEURA9_ARENA_SIZE);
+  TEST_MESSAGE(msg);
+}
+
+// Percentis em ordem, tempo por op e arena do plano dentro da margem
+void test_benchmark() {
+  NEURA9Inference n;
+  TEST_ASSERT_TRUE(beginWithTestModel(n));
+  static Neura9BenchResult r;
+  const uint16_t ITER = 500;
+  TEST_ASSERT_TRUE(n.benchmark(&r, ITER));
+
+  TEST_ASSERT_EQUAL_UINT16(ITER, r.iterations);
+  TEST_ASSERT_TRUE(r.p50Us <= r.p90Us && r.p90Us <= r.p99Us &&
+                   r.p99Us <= r.maxUs);
+  TEST_ASSERT_EQUAL_UINT8(2, r.opCount);
+  uint32_t fc = 0, softmax = 0;
+  for (uint8_t i = 0; i < r.opCount; i++) {
+    if (strcmp(r.ops[i].tag, "FULLY_CONNECTED") == 0)
+      fc = r.ops[i].calls;
+    else if (strcmp(r.ops[i].tag, "SOFTMAX") == 0)
+      softmax = r.ops[i].calls;
+  }
+  TEST_ASSERT_EQUAL_UINT32(2 * ITER, fc);
+  TEST_ASSERT_EQUAL_UINT32(ITER, softmax);
+
+  TEST_ASSERT_EQUAL_UINT32(n.getMemoryPlan().arenaSize, r.arenaSize);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(r.arenaSize, r.arenaNeeded);
+  TEST_ASSERT_LESS_THAN_UINT32(r.arenaNeeded, r.arenaUsed);
+  TEST_ASSERT_TRUE_MESSAGE(r.arenaOk, "arena do plano fora da margem");
+
+  char msg[128];
+  snprintf(msg, sizeof(msg),
+           "p50 %u us, p90 %u us, p99 %u us, max %u us; arena %u (%u) / %u B",
+           (unsigned)r.p50Us, (unsigned)r.p90Us, (unsigned)r.p99Us,
+           (unsigned)r.maxUs, (unsigned)r.arenaUsed, (unsigned)r.arenaNeeded,
+           (unsigned)r.arenaSize);
+  TEST_MESSAGE(msg);
+}
+
+// Plano salvo com a arena no teto (modelo/kernels passaram a usar menos):
+// o benchmark acusa, em vez de comparar só o teto com ele mesmo
+void test_benchmark_flags_oversized_arena() {
+  Neura9MemoryPlan plan;
+  {
+    NEURA9Inference n;
+    TEST_ASSERT_TRUE(beginWithTestModel(n));
+    plan = n.getMemoryPlan();
+  }
+  plan.arenaSize = NEURA9_ARENA_SIZE;
+  Preferences prefs;
+  prefs.begin("neura9", false);
+  prefs.putBytes("plan", &plan, sizeof(plan));
+  prefs.end();
+
+  NEURA9Inference n;
+  TEST_ASSERT_TRUE(beginWithTestModel(n));
+  TEST_ASSERT_EQUAL_UINT32(NEURA9_ARENA_SIZE, n.getMemoryPlan().arenaSize);
+  static Neura9BenchResult r;
+  TEST_ASSERT_TRUE(n.benchmark(&r, 20));
+  TEST_ASSERT_FALSE(r.arenaOk);
+  TEST_ASSERT_LESS_THAN_UINT32(r.arenaSize, r.arenaRecommended);
+}
+
+// CSV rotulado: todas as linhas válidas certas, malformadas contadas à parte
+void test_evaluate_dataset() {
+  char dir[] = "/tmp/neura9_evalXXXXXX";
+  TEST_ASSERT_NOT_NULL(mkdtemp(dir));
+  char path[64];
+  snprintf(path, sizeof(path), "%s/eval.csv", dir);
+  writeDataset(path);
+
+  NEURA9Inference n;
+  TEST_ASSERT_TRUE(beginWithTestModel(n));
+  static Neura9EvalResult r;
+  FS fs;
+  bool ok = n.evaluate(fs, path, &r);
+  remove(path);
+  rmdir(dir);
+  TEST_ASSERT_TRUE(ok);
+
+  TEST_ASSERT_EQUAL_UINT8(TEST_MODEL_CLASSES, r.classes);
+  TEST_ASSERT_EQUAL_UINT16(EVAL_PER_CLASS * TEST_MODEL_CLASSES, r.samples);
+  TEST_ASSERT_EQUAL_UINT16(EVAL_BAD_ROWS, r.skipped);
+  for (int c = 0; c < TEST_MODEL_CLASSES; c++)
+    TEST_ASSERT_EQUAL_UINT16(EVAL_PER_CLASS, r.confusion[c][c]);
+
+  char msg[64];
+  snprintf(msg, sizeof(msg), "acurácia %u/%u (%u linhas descartadas)",
+           (unsigned)r.correct, (unsigned)r.samples, (unsigned)r.skipped);
+  TEST_MESSAGE(msg);
+  TEST_ASSERT_EQUAL_UINT16(r.samples, r.correct);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_normalize_matches_python);
+  RUN_TEST(test_quantize_matches_python);
+  RUN_TEST(test_plan_measures_arena);
+  RUN_TEST(test_benchmark);
+  RUN_TEST(test_benchmark_flags_oversized_arena);
+  RUN_TEST(test_evaluate_dataset);
+  return UNITY_END();
+}
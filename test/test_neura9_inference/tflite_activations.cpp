@@ -0,0 +1,7 @@
+/**
+ * @file tflite_activations.cpp
+ * @brief Kernel RELU do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/activations.cpp"
+#include "tensorflow/lite/micro/kernels/activations_common.cpp"
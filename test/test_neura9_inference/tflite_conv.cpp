@@ -0,0 +1,7 @@
+/**
+ * @file tflite_conv.cpp
+ * @brief Kernel CONV_2D do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/conv.cpp"
+#include "tensorflow/lite/micro/kernels/conv_common.cpp"
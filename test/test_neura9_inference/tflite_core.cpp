@@ -0,0 +1,38 @@
+/**
+ * @file tflite_core.cpp
+ * @brief Núcleo do TFLite Micro (interpretador, alocador, planner) no host
+ *
+ * No device vem do TensorFlowLite_ESP32; aqui os mesmos fontes (lib_deps do
+ * env native) entram por include. Os kernels ficam um por arquivo
+ * (tflite_<op>.cpp): cada um tem Init/Prepare/Eval num namespace anônimo.
+ */
+
+#include "tensorflow/lite/c/common.cpp"
+#include "tensorflow/lite/core/api/error_reporter.cpp"
+#include "tensorflow/lite/core/api/flatbuffer_conversions.cpp"
+#include "tensorflow/lite/core/api/op_resolver.cpp"
+#include "tensorflow/lite/core/api/tensor_utils.cpp"
+#include "tensorflow/lite/kernels/internal/quantization_util.cpp"
+#include "tensorflow/lite/kernels/kernel_util.cpp"
+#include "tensorflow/lite/micro/arena_allocator/non_persistent_arena_buffer_allocator.cpp"
+#include "tensorflow/lite/micro/arena_allocator/simple_memory_allocator.cpp"
+#include "tensorflow/lite/micro/debug_log.cpp"
+#include "tensorflow/lite/micro/flatbuffer_utils.cpp"
+#include "tensorflow/lite/micro/memory_helpers.cpp"
+#include "tensorflow/lite/micro/memory_planner/greedy_memory_planner.cpp"
+#include "tensorflow/lite/micro/memory_planner/linear_memory_planner.cpp"
+#include "tensorflow/lite/micro/memory_planner/non_persistent_buffer_planner_shim.cpp"
+#include "tensorflow/lite/micro/micro_allocation_info.cpp"
+#include "tensorflow/lite/micro/micro_allocator.cpp"
+#include "tensorflow/lite/micro/micro_context.cpp"
+#include "tensorflow/lite/micro/micro_error_reporter.cpp"
+#include "tensorflow/lite/micro/micro_graph.cpp"
+#include "tensorflow/lite/micro/micro_interpreter.cpp"
+#include "tensorflow/lite/micro/micro_profiler.cpp"
+#include "tensorflow/lite/micro/micro_resource_variable.cpp"
+#include "tensorflow/lite/micro/micro_string.cpp"
+#include "tensorflow/lite/micro/micro_time.cpp"
+#include "tensorflow/lite/micro/micro_utils.cpp"
+#include "tensorflow/lite/schema/schema_utils.cpp"
+#include "tensorflow/lite/micro/kernels/kernel_util.cpp"
+#include "tensorflow/lite/micro/kernels/micro_tensor_utils.cpp"
@@ -0,0 +1,7 @@
+/**
+ * @file tflite_depthwise_conv.cpp
+ * @brief Kernel DEPTHWISE_CONV_2D do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/depthwise_conv.cpp"
+#include "tensorflow/lite/micro/kernels/depthwise_conv_common.cpp"
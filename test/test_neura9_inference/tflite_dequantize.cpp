@@ -0,0 +1,7 @@
+/**
+ * @file tflite_dequantize.cpp
+ * @brief Kernel DEQUANTIZE do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/dequantize.cpp"
+#include "tensorflow/lite/micro/kernels/dequantize_common.cpp"
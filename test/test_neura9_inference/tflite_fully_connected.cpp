@@ -0,0 +1,7 @@
+/**
+ * @file tflite_fully_connected.cpp
+ * @brief Kernel FULLY_CONNECTED do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/fully_connected.cpp"
+#include "tensorflow/lite/micro/kernels/fully_connected_common.cpp"
@@ -0,0 +1,7 @@
+/**
+ * @file tflite_pooling.cpp
+ * @brief Kernels MAX_POOL_2D e AVERAGE_POOL_2D do TFLite Micro no host
+ */
+
+#include "tensorflow/lite/micro/kernels/pooling.cpp"
+#include "tensorflow/lite/micro/kernels/pooling_common.cpp"
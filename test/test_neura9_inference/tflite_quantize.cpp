@@ -0,0 +1,7 @@
+/**
+ * @file tflite_quantize.cpp
+ * @brief Kernel QUANTIZE do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/quantize.cpp"
+#include "tensorflow/lite/micro/kernels/quantize_common.cpp"
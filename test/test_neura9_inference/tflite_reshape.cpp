@@ -0,0 +1,6 @@
+/**
+ * @file tflite_reshape.cpp
+ * @brief Kernel RESHAPE do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/reshape.cpp"
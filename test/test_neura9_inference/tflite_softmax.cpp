@@ -0,0 +1,7 @@
+/**
+ * @file tflite_softmax.cpp
+ * @brief Kernel SOFTMAX do TFLite Micro para o teste no host
+ */
+
+#include "tensorflow/lite/micro/kernels/softmax.cpp"
+#include "tensorflow/lite/micro/kernels/softmax_common.cpp"
@@ -0,0 +1,62 @@
+/**
+ * @file test_main.cpp
+ * @brief Tiny classifiers: firmware x predições exportadas pelo Python
+ *
+ * tiny_vectors.h sai de ai_training/train_tiny_classifiers.py com SSID e
+ * BSSID crus: o teste passa pela extração de features do firmware
+ * (PmkidFeatures::from) e pela avaliação das árvores, e exige a mesma saída
+ * float32 bit a bit.
+ */
+
+#include <unity.h>
+
+#include "ai/detectors/tiny_classifiers.h"
+#include "tiny_vectors.h"
+
+void setUp() {}
+void tearDown() {}
+
+#define COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+static bool sameBits(float a, float b) { return memcmp(&a, &b, 4) == 0; }
+
+void test_pmkid_matches_python() {
+  for (size_t i = 0; i < COUNT(TINY_PMKID_CASES); i++) {
+    const TinyPmkidCase &c = TINY_PMKID_CASES[i];
+    PmkidFeatures f = PmkidFeatures::from(c.ssid, c.bssid);
+    float score = TinyClassifiers::pmkidWeakScore(f);
+    if (!sameBits(score, c.score)) {
+      char msg[96];
+      snprintf(msg, sizeof(msg), "SSID \"%s\": %.9g, Python %.9g", c.ssid,
+               score, c.score);
+      TEST_FAIL_MESSAGE(msg);
+    }
+    TEST_ASSERT_EQUAL(c.score > 0.5f,
+                      TinyClassifiers::isPmkidWeak(c.ssid, c.bssid));
+  }
+}
+
+void test_handshake_matches_python() {
+  for (size_t i = 0; i < COUNT(TINY_HANDSHAKE_CASES); i++) {
+    const TinyHandshakeCase &c = TINY_HANDSHAKE_CASES[i];
+    float x[HANDSHAKE_FEATURE_COUNT];
+    x[HANDSHAKE_F_HALF] = c.half;
+    x[HANDSHAKE_F_ANONCES] = c.anonces;
+    x[HANDSHAKE_F_SNR] = c.snr;
+    x[HANDSHAKE_F_GAP_MS] = c.gapMs;
+    TEST_ASSERT_TRUE(sameBits(tinyTreeEval(HANDSHAKE_MODEL, x), c.raw));
+    TEST_ASSERT_EQUAL_INT(c.quality, TinyClassifiers::predictHandshakeStrength(
+                                         c.half, c.anonces, c.snr, c.gapMs));
+  }
+}
+
+// Os vetores embutidos em tiny_models.h (conferidos no boot) também batem
+void test_self_test() { TEST_ASSERT_TRUE(TinyClassifiers::selfTest()); }
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_pmkid_matches_python);
+  RUN_TEST(test_handshake_matches_python);
+  RUN_TEST(test_self_test);
+  return UNITY_END();
+}
@@ -0,0 +1,427 @@
+#pragma once
+/**
+ * @file tiny_vectors.h
+ * @brief Predições do Python para o teste no host (GERADO, não editar)
+ *
+ * Gerador: ai_training/train_tiny_classifiers.py
+ */
+
+#include <stdint.h>
+
+struct TinyPmkidCase {
+  const char *ssid;
+  uint8_t bssid[6];
+  float score;
+};
+
+struct TinyHandshakeCase {
+  int half, anonces, snr, gapMs;
+  float raw;
+  int quality;
+};
+
+static const TinyPmkidCase TINY_PMKID_CASES[] = {
+    {"", {0x3C, 0x84, 0x6A, 0xC2, 0x22, 0xDD}, 1.0f},
+    {"a", {0xC8, 0x3A, 0x35, 0xF9, 0xA7, 0xAB}, 1.0f},
+    {"VIVO-8E4A", {0x7C, 0x8B, 0xCA, 0x14, 0x08, 0xF5}, 0.0f},
+    {"NET_2G1A2B3C", {0x00, 0xE0, 0x4C, 0x85, 0x4C, 0x43}, 1.0f},
+    {"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx", {0x00, 0x1A, 0x2B, 0xBB, 0xEB, 0xBF}, 0.0f},
+    {"ABCDEF0123456789ABCDEF0123456789FF", {0x7C, 0x8B, 0xCA, 0x97, 0x4E, 0x88}, 0.107843138f},
+    {"Casa_1234", {0x00, 0x1D, 0x60, 0x43, 0x25, 0x64}, 1.0f},
+    {"A-B_C", {0xC8, 0x3A, 0x35, 0xA4, 0xE0, 0xAF}, 0.258264452f},
+    {"Lele Apto 833", {0x00, 0x1D, 0x60, 0x30, 0x11, 0x85}, 1.0f},
+    {"Minha Casa", {0xC8, 0x3A, 0x35, 0xBB, 0x45, 0xEA}, 0.258264452f},
+    {"CLARO_B1D4BC", {0xC8, 0x3A, 0x35, 0x87, 0xEB, 0xDD}, 0.258264452f},
+    {"OI_59B4E", {0xF4, 0xF2, 0x6D, 0x2E, 0xB7, 0xFA}, 0.258264452f},
+    {"Lele", {0x00, 0xE0, 0x4C, 0x50, 0xBE, 0x75}, 1.0f},
+    {"VIVO-469B", {0x00, 0x1A, 0x2B, 0x6F, 0xC2, 0x12}, 0.0f},
+    {"Home", {0x00, 0x1A, 0x2B, 0x69, 0xAD, 0xFB}, 1.0f},
+    {"Familia Apto_161", {0x00, 0x1A, 0x2B, 0xEB, 0xD7, 0x05}, 0.0f},
+    {"Rede Casa 838", {0xC8, 0x3A, 0x35, 0xC0, 0x0E, 0x74}, 0.258264452f},
+    {"Wifi", {0x00, 0xE0, 0x4C, 0x5F, 0x10, 0x60}, 1.0f},
+    {"HUAWEI-B433E5", {0xA0, 0xF3, 0xC1, 0xD3, 0xCC, 0xF1}, 0.107843138f},
+    {"Z1", {0x00, 0x1D, 0x60, 0x2D, 0x36, 0x14}, 1.0f},
+    {"XYcc", {0x7C, 0x8B, 0xCA, 0x00, 0x1C, 0xD2}, 1.0f},
+    {"Lele Silva_966", {0x5C, 0x62, 0x8B, 0xEA, 0xAA, 0x20}, 0.0f},
+    {"Lele", {0xE8, 0x94, 0xF6, 0x57, 0xA2, 0xF7}, 1.0f},
+    {"CLARO_1AA7", {0x2C, 0x30, 0x33, 0xE7, 0xD9, 0xC6}, 0.0f},
+    {"Tenda_5CF78", {0x3C, 0x84, 0x6A, 0xEC, 0x8E, 0x4E}, 0.0f},
+    {"Lele Familia Minha", {0x00, 0x1D, 0x60, 0xB4, 0x7C, 0x14}, 1.0f},
+    {"Minha Escritorio", {0x00, 0x1D, 0x60, 0x2E, 0xCC, 0x37}, 1.0f},
+    {"HUAWEI-5E3D1", {0x7C, 0x8B, 0xCA, 0x14, 0xFA, 0x11}, 0.0f},
+    {"Wifi Familia156", {0x00, 0x1D, 0x60, 0x7D, 0xC4, 0xAB}, 1.0f},
+    {"Tenda_4EDEA", {0xC8, 0x3A, 0x35, 0x3D, 0x68, 0xF4}, 0.258264452f},
+    {"Lele Escritorio Home", {0x7C, 0x8B, 0xCA, 0xB6, 0xED, 0xDD}, 0.0f},
+    {"XZ", {0xA0, 0xF3, 0xC1, 0xFD, 0xAA, 0xAD}, 1.0f},
+    {"Rede Apto Apto", {0xE8, 0x94, 0xF6, 0x21, 0x6F, 0x47}, 0.258264452f},
+    {"Silva", {0x5C, 0x62, 0x8B, 0x43, 0x27, 0x9F}, 0.0f},
+    {"Silva Familia Casa", {0x00, 0xE0, 0x4C, 0x46, 0xE8, 0xC2}, 0.0f},
+    {"Silva 145", {0xE8, 0x94, 0xF6, 0x20, 0xD4, 0xFA}, 0.258264452f},
+    {"HUAWEI-B526", {0x14, 0xCC, 0x20, 0x1D, 0x51, 0x78}, 0.0f},
+    {"NET_2G9EDE68", {0x00, 0xE0, 0x4C, 0xCA, 0x81, 0x4F}, 1.0f},
+    {"Casa_419", {0x2C, 0x30, 0x33, 0xD0, 0x18, 0xC8}, 0.0f},
+    {"Rede Familia Escritorio", {0x00, 0xE0, 0x4C, 0x23, 0x2C, 0x0C}, 0.0f},
+    {"Silva Home", {0x00, 0xE0, 0x4C, 0x2A, 0x5E, 0xC8}, 0.0f},
+    {"Silva Lele Silva", {0xC8, 0x3A, 0x35, 0x55, 0xE1, 0x4A}, 0.258264452f},
+    {"Escritorio Lele", {0xA0, 0xF3, 0xC1, 0xE1, 0x38, 0xF7}, 0.0f},
+    {"OI_EFF2B", {0xC8, 0x3A, 0x35, 0xBC, 0xF2, 0xEA}, 0.258264452f},
+    {"Minha Apto", {0x00, 0x1A, 0x2B, 0x7E, 0x2E, 0xE3}, 0.0f},
+    {"Apto", {0x7C, 0x8B, 0xCA, 0x65, 0xF0, 0xE4}, 1.0f},
+    {"Apto 76", {0xC8, 0x3A, 0x35, 0x9D, 0xFA, 0x8B}, 0.258264452f},
+    {"Home Silva Apto316", {0x2C, 0x30, 0x33, 0x9E, 0x54, 0x8A}, 0.0f},
+    {"VIVO-2D6E", {0xC8, 0x3A, 0x35, 0x25, 0x9D, 0xD4}, 0.258264452f},
+    {"1", {0x2C, 0x30, 0x33, 0x38, 0x7B, 0xB0}, 1.0f},
+    {"CLARO_A111BC", {0xF4, 0xF2, 0x6D, 0xE9, 0x37, 0xA3}, 0.258264452f},
+    {"NET_5G3B50", {0xC8, 0x3A, 0x35, 0x40, 0x8F, 0x21}, 1.0f},
+    {"Wifi Home Familia_903", {0xC8, 0x3A, 0x35, 0x99, 0xD5, 0x69}, 0.258264452f},
+    {"NET_5GFEE5B", {0x00, 0xE0, 0x4C, 0x68, 0xC8, 0x09}, 0.0f},
+    {"Wifi Wifi", {0x00, 0x1A, 0x2B, 0x5F, 0xA8, 0x89}, 0.0f},
+    {"HUAWEI-4156DB", {0xE8, 0x94, 0xF6, 0x12, 0x2F, 0x02}, 0.107843138f},
+    {"Apto 980", {0x00, 0x1A, 0x2B, 0x13, 0x1F, 0x2A}, 0.0f},
+    {"c", {0xC8, 0x3A, 0x35, 0xF0, 0x22, 0x89}, 1.0f},
+    {"TP-LINK_91CD", {0xF4, 0xF2, 0x6D, 0x58, 0x43, 0x57}, 0.258264452f},
+    {"CLARO_55CEA", {0x7C, 0x8B, 0xCA, 0x43, 0xC7, 0x37}, 0.0f},
+    {"Minha", {0xA0, 0xF3, 0xC1, 0x9D, 0x2F, 0xC2}, 0.0f},
+    {"D-Link_C3C373", {0x3C, 0x84, 0x6A, 0xBB, 0xA4, 0x20}, 1.0f},
+    {"OI_93BF79", {0x7C, 0x8B, 0xCA, 0xB8, 0xFB, 0x06}, 1.0f},
+    {"NET_5GC73F3C", {0x2C, 0x30, 0x33, 0x7B, 0x7B, 0xDB}, 1.0f},
+    {"Home Familia", {0x3C, 0x84, 0x6A, 0xC4, 0x63, 0xC5}, 0.0f},
+    {"D-Link_02C10D", {0x00, 0x1A, 0x2B, 0xF3, 0xED, 0x80}, 1.0f},
+    {"NET_5G1BAF50", {0xE8, 0x94, 0xF6, 0x95, 0xC2, 0xDB}, 1.0f},
+    {"OI_77CD", {0x2C, 0x30, 0x33, 0xE7, 0xDA, 0x0C}, 0.0f},
+    {"Minha859", {0x5C, 0x62, 0x8B, 0x58, 0x7C, 0xD8}, 0.0f},
+    {"NET_5GC20D", {0xC8, 0x3A, 0x35, 0xAF, 0xB6, 0xE2}, 0.258264452f},
+    {"Apto", {0x00, 0x1D, 0x60, 0xCD, 0x28, 0x95}, 1.0f},
+    {"NET_5GCEEA", {0x2C, 0x30, 0x33, 0x67, 0xB3, 0x55}, 0.0f},
+    {"HUAWEI-EFB248", {0xC8, 0x3A, 0x35, 0x07, 0x61, 0xE8}, 0.258264452f},
+    {"NET_2G04829", {0xA0, 0xF3, 0xC1, 0x8D, 0xC2, 0x34}, 1.0f},
+    {"NET_2G39A08D", {0xC8, 0x3A, 0x35, 0xEE, 0x95, 0xA5}, 1.0f},
+    {"Casa", {0x00, 0x1A, 0x2B, 0xCC, 0xB7, 0xED}, 1.0f},
+    {"Rede Wifi Casa 882", {0x00, 0x1D, 0x60, 0x9E, 0x83, 0xCA}, 1.0f},
+    {"Minha Casa_728", {0x00, 0x1A, 0x2B, 0x94, 0x9C, 0x0D}, 0.0f},
+    {"OI_E540C", {0xE8, 0x94, 0xF6, 0xE4, 0x2C, 0xC0}, 0.258264452f},
+    {"Minha Home", {0x7C, 0x8B, 0xCA, 0xC4, 0x8D, 0xB8}, 0.0f},
+    {"Lele", {0xF4, 0xF2, 0x6D, 0x11, 0xC3, 0xE7}, 1.0f},
+    {"OI_FBC4", {0x3C, 0x84, 0x6A, 0x52, 0x52, 0x4D}, 0.0f},
+    {"Home Minha690", {0x7C, 0x8B, 0xCA, 0xA7, 0xE0, 0x70}, 0.0f},
+    {"D-Link_1C2141", {0xA0, 0xF3, 0xC1, 0x39, 0x2B, 0x11}, 1.0f},
+    {"1X2", {0x2C, 0x30, 0x33, 0x65, 0x89, 0xCE}, 1.0f},
+    {"Familia Familia Familia", {0x14, 0xCC, 0x20, 0x56, 0xD2, 0xE6}, 0.0f},
+    {"Silva Minha", {0xA0, 0xF3, 0xC1, 0x5E, 0xBB, 0x9A}, 0.0f},
+    {"Wifi Wifi_248", {0x7C, 0x8B, 0xCA, 0x4A, 0xDA, 0x96}, 0.0f},
+    {"Rede Wifi", {0x7C, 0x8B, 0xCA, 0x28, 0xB6, 0x65}, 0.0f},
+    {"Escritorio Rede Familia", {0x00, 0x1D, 0x60, 0xE2, 0x14, 0x4F}, 1.0f},
+    {"Apto Wifi Minha 467", {0xA0, 0xF3, 0xC1, 0x96, 0x0D, 0xC9}, 0.0f},
+    {"CLARO_E55B", {0x14, 0xCC, 0x20, 0xCF, 0x8E, 0xBA}, 0.0f},
+    {"CLARO_A984", {0x00, 0x1D, 0x60, 0x2E, 0x14, 0xAE}, 1.0f},
+    {"HUAWEI-A0A91", {0xC8, 0x3A, 0x35, 0xA9, 0x16, 0x2A}, 0.258264452f},
+    {"OI_53DD2", {0xA0, 0xF3, 0xC1, 0xD7, 0x85, 0x5F}, 0.0f},
+    {"NET_5GC208", {0xE8, 0x94, 0xF6, 0x47, 0xBE, 0xA7}, 1.0f},
+    {"Escritorio", {0xE8, 0x94, 0xF6, 0x8E, 0xF4, 0x30}, 0.258264452f},
+    {"Rede Escritorio", {0x7C, 0x8B, 0xCA, 0x58, 0xB0, 0x91}, 0.0f},
+    {"Tenda_FD94E5", {0x5C, 0x62, 0x8B, 0x08, 0xC4, 0x90}, 0.0f},
+    {"Tenda_EC9E0B", {0x00, 0xE0, 0x4C, 0xAC, 0x26, 0xC4}, 0.0f},
+    {"Silva Minha 618", {0x00, 0x1A, 0x2B, 0x62, 0x68, 0xA6}, 0.0f},
+    {"VIVO-115D95", {0xA0, 0xF3, 0xC1, 0xCB, 0xB9, 0xE0}, 0.107843138f},
+    {"Minha", {0xF4, 0xF2, 0x6D, 0x26, 0x3C, 0xB9}, 0.258264452f},
+    {"CLARO_04FE", {0x3C, 0x84, 0x6A, 0x0A, 0x59, 0x5E}, 0.0f},
+    {"Escritorio", {0x00, 0xE0, 0x4C, 0x95, 0xD4, 0x82}, 0.0f},
+    {"VIVO-8147", {0x00, 0x1D, 0x60, 0xB9, 0x32, 0xB7}, 0.75f},
+    {"Tenda_BADA9", {0x00, 0xE0, 0x4C, 0x86, 0xA2, 0x6E}, 0.0f},
+    {"NET_2GBFDFB", {0x00, 0xE0, 0x4C, 0x58, 0x7F, 0x35}, 0.0f},
+    {"CLARO_A960D1", {0x7C, 0x8B, 0xCA, 0xE5, 0xD9, 0x0A}, 1.0f},
+    {"Minha", {0x00, 0xE0, 0x4C, 0xB7, 0xAE, 0x80}, 0.0f},
+    {"NET_2G762F1", {0x00, 0xE0, 0x4C, 0x1B, 0x25, 0x69}, 1.0f},
+    {"Lele Familia", {0x00, 0x1D, 0x60, 0x4D, 0xEC, 0x3F}, 1.0f},
+    {"Apto Familia Rede", {0x7C, 0x8B, 0xCA, 0x92, 0xEE, 0xEF}, 0.0f},
+    {"Tenda_6D7DD", {0x00, 0x1D, 0x60, 0x47, 0x03, 0x71}, 1.0f},
+    {"TP-LINK_46156", {0x7C, 0x8B, 0xCA, 0xCF, 0xB8, 0x00}, 1.0f},
+    {"HUAWEI-07AAF5", {0x5C, 0x62, 0x8B, 0x7C, 0x3B, 0xB8}, 0.0f},
+    {"Rede Escritorio_110", {0x3C, 0x84, 0x6A, 0xEA, 0xD1, 0x09}, 0.0f},
+    {"D-Link_271328", {0x00, 0x1A, 0x2B, 0x9F, 0xA1, 0x1A}, 1.0f},
+    {"TP-LINK_B4B42", {0xC8, 0x3A, 0x35, 0xC8, 0xED, 0x71}, 0.258264452f},
+    {"b1ac", {0x2C, 0x30, 0x33, 0xEA, 0x2E, 0x46}, 1.0f},
+    {"Rede Lele", {0x00, 0x1A, 0x2B, 0x0B, 0x1A, 0xBB}, 0.0f},
+    {"TP-LINK_841E11", {0xE8, 0x94, 0xF6, 0xF9, 0x63, 0x27}, 1.0f},
+    {"D-Link_9B94E", {0x00, 0xE0, 0x4C, 0x4B, 0x4E, 0x9C}, 0.0f},
+    {"Familia Silva", {0xF4, 0xF2, 0x6D, 0xFB, 0x37, 0xEE}, 0.258264452f},
+    {"Home Wifi Familia", {0x14, 0xCC, 0x20, 0xDB, 0x5E, 0xFF}, 0.0f},
+    {"Lele Escritorio", {0x7C, 0x8B, 0xCA, 0x81, 0xED, 0x8D}, 0.0f},
+    {"NET_5G50EBD8", {0xC8, 0x3A, 0x35, 0x74, 0xBC, 0x2A}, 1.0f},
+    {"CLARO_411541", {0x14, 0xCC, 0x20, 0x72, 0xFD, 0x0C}, 1.0f},
+    {"Lele Home 74", {0x7C, 0x8B, 0xCA, 0xD5, 0x56, 0x2F}, 0.0f},
+    {"TP-LINK_27E7", {0x00, 0xE0, 0x4C, 0x28, 0x7F, 0x65}, 0.0f},
+    {"Wifi Silva_441", {0x3C, 0x84, 0x6A, 0x1A, 0xEB, 0x59}, 0.0f},
+    {"Lele Apto", {0xC8, 0x3A, 0x35, 0x67, 0x58, 0x89}, 0.258264452f},
+    {"Tenda_9F0B8", {0xF4, 0xF2, 0x6D, 0x5D, 0x98, 0xB4}, 0.258264452f},
+    {"Lele Minha Rede 697", {0x14, 0xCC, 0x20, 0x1A, 0x6E, 0x47}, 0.0f},
+    {"TP-LINK_238D", {0x14, 0xCC, 0x20, 0x87, 0x73, 0xC8}, 0.0f},
+    {"D-Link_5095A6", {0x2C, 0x30, 0x33, 0xA5, 0x47, 0xFC}, 1.0f},
+    {"c", {0xA0, 0xF3, 0xC1, 0x18, 0x01, 0x73}, 1.0f},
+    {"TP-LINK_6E1F4", {0x00, 0x1D, 0x60, 0xC2, 0xFA, 0x95}, 1.0f},
+    {"D-Link_534F9", {0x00, 0x1A, 0x2B, 0x3C, 0xA0, 0x77}, 1.0f},
+    {"a1c", {0x3C, 0x84, 0x6A, 0x1F, 0x8A, 0x04}, 1.0f},
+    {"VIVO-DD005", {0xC8, 0x3A, 0x35, 0xE9, 0x61, 0x67}, 0.258264452f},
+    {"1X2", {0x3C, 0x84, 0x6A, 0x05, 0x21, 0x5F}, 1.0f},
+    {"TP-LINK_7B1040", {0xE8, 0x94, 0xF6, 0x9B, 0x8C, 0x22}, 1.0f},
+    {"OI_2FD1", {0x14, 0xCC, 0x20, 0x04, 0x37, 0xC1}, 0.0f},
+    {"Casa Rede_835", {0x00, 0xE0, 0x4C, 0xA6, 0x8D, 0x22}, 0.0f},
+    {"TP-LINK_94FC", {0x00, 0x1D, 0x60, 0xC8, 0xB5, 0x1E}, 1.0f},
+    {"NET_5G295FF", {0x00, 0xE0, 0x4C, 0xDE, 0xE3, 0x60}, 1.0f},
+    {"VIVO-91B22", {0x3C, 0x84, 0x6A, 0x40, 0x36, 0xE0}, 0.107843138f},
+    {"HUAWEI-3541", {0x7C, 0x8B, 0xCA, 0xBE, 0x25, 0x00}, 0.107843138f},
+    {"Escritorio Casa Familia", {0x00, 0xE0, 0x4C, 0x82, 0x6D, 0x19}, 0.0f},
+    {"VIVO-BA9C8", {0x00, 0x1A, 0x2B, 0x9B, 0xAF, 0xEB}, 0.0f},
+    {"a", {0x00, 0xE0, 0x4C, 0xC7, 0x1E, 0x06}, 1.0f},
+    {"Familia Escritorio Wifi", {0x00, 0xE0, 0x4C, 0x54, 0x05, 0x43}, 0.0f},
+    {"Wifi Casa Casa_478", {0x3C, 0x84, 0x6A, 0x9F, 0x57, 0xDD}, 0.0f},
+    {"NET_5GBF3B", {0xC8, 0x3A, 0x35, 0x26, 0xFF, 0xA0}, 0.258264452f},
+    {"VIVO-9093B1", {0x7C, 0x8B, 0xCA, 0x66, 0x30, 0xE9}, 0.107843138f},
+    {"VIVO-7B09C", {0x7C, 0x8B, 0xCA, 0x5A, 0xCA, 0x8E}, 0.0f},
+    {"2Zac", {0xE8, 0x94, 0xF6, 0xCF, 0x80, 0xC7}, 1.0f},
+    {"CLARO_B9D3E", {0x5C, 0x62, 0x8B, 0xA2, 0x35, 0x3A}, 0.0f},
+    {"HUAWEI-A97D02", {0x3C, 0x84, 0x6A, 0x58, 0x78, 0x55}, 0.107843138f},
+    {"CLARO_12BB", {0xC8, 0x3A, 0x35, 0xA7, 0xD0, 0x9D}, 0.258264452f},
+    {"NET_5G120D72", {0x2C, 0x30, 0x33, 0xE6, 0x47, 0xB9}, 1.0f},
+    {"Lele Silva556", {0x00, 0x1D, 0x60, 0xE2, 0xFA, 0x85}, 1.0f},
+    {"CLARO_2C82A3", {0x5C, 0x62, 0x8B, 0x4B, 0x8A, 0x11}, 1.0f},
+    {"CLARO_E4FA", {0x7C, 0x8B, 0xCA, 0x03, 0x54, 0x8F}, 0.0f},
+    {"Escritorio446", {0x00, 0x1A, 0x2B, 0xCB, 0x46, 0x25}, 0.0f},
+    {"Zc", {0x00, 0x1D, 0x60, 0x62, 0xAF, 0x79}, 1.0f},
+    {"Silva Apto Wifi", {0x7C, 0x8B, 0xCA, 0x69, 0xE4, 0xA9}, 0.0f},
+    {"Escritorio Familia403", {0x3C, 0x84, 0x6A, 0x19, 0xDF, 0xEA}, 0.0f},
+    {"Minha", {0xC8, 0x3A, 0x35, 0xAF, 0x8A, 0x5A}, 0.258264452f},
+    {"CLARO_11DC", {0x7C, 0x8B, 0xCA, 0xE7, 0xB2, 0x33}, 0.0f},
+    {"Casa Familia Minha", {0x14, 0xCC, 0x20, 0x89, 0x9D, 0x45}, 0.0f},
+    {"CLARO_A9ED0", {0xC8, 0x3A, 0x35, 0xF9, 0x8C, 0xF8}, 0.258264452f},
+    {"cX", {0x00, 0xE0, 0x4C, 0xBA, 0x73, 0xC4}, 1.0f},
+    {"NET_5G8A8B14", {0x00, 0x1D, 0x60, 0x79, 0x80, 0x24}, 1.0f},
+    {"Escritorio 585", {0x7C, 0x8B, 0xCA, 0x83, 0x35, 0x60}, 0.0f},
+    {"Tenda_DA7AC", {0x00, 0x1D, 0x60, 0x5D, 0xD5, 0x22}, 1.0f},
+    {"Tenda_51E71", {0x14, 0xCC, 0x20, 0xA6, 0x72, 0x7B}, 1.0f},
+    {"Familia_726", {0xE8, 0x94, 0xF6, 0xAE, 0x7A, 0x55}, 0.258264452f},
+    {"Wifi", {0x00, 0x1A, 0x2B, 0x8C, 0x2C, 0xBB}, 1.0f},
+    {"Rede Apto Home", {0xC8, 0x3A, 0x35, 0x35, 0x26, 0xB7}, 0.258264452f},
+    {"Casa Wifi Lele_688", {0x5C, 0x62, 0x8B, 0x81, 0x53, 0x14}, 0.0f},
+    {"Rede", {0x00, 0xE0, 0x4C, 0x86, 0xE9, 0x23}, 1.0f},
+    {"NET_5G72E1", {0x14, 0xCC, 0x20, 0xF7, 0xCF, 0xF4}, 1.0f},
+    {"NET_2G13FE", {0x7C, 0x8B, 0xCA, 0x75, 0xFB, 0x40}, 0.0f},
+    {"CLARO_363B58", {0x7C, 0x8B, 0xCA, 0xC1, 0x03, 0x4E}, 1.0f},
+    {"D-Link_6D6EE9", {0xC8, 0x3A, 0x35, 0x87, 0x0B, 0xA5}, 0.258264452f},
+    {"Home_262", {0x00, 0x1A, 0x2B, 0x25, 0x71, 0xA9}, 0.0f},
+    {"HUAWEI-9D295", {0x3C, 0x84, 0x6A, 0x1C, 0x19, 0x41}, 0.107843138f},
+    {"Minha Familia_275", {0x00, 0xE0, 0x4C, 0xB3, 0x04, 0xA6}, 0.0f},
+    {"VIVO-8DC28", {0xA0, 0xF3, 0xC1, 0xBB, 0x38, 0x44}, 0.0f},
+    {"Home Escritorio Rede", {0x00, 0xE0, 0x4C, 0xC7, 0xFC, 0x52}, 0.0f},
+    {"XYX", {0x14, 0xCC, 0x20, 0x39, 0x8C, 0xF7}, 1.0f},
+    {"NET_5G0388", {0x3C, 0x84, 0x6A, 0x40, 0xD7, 0xCD}, 1.0f},
+    {"Familia Apto", {0xF4, 0xF2, 0x6D, 0x5F, 0x9E, 0x2A}, 0.258264452f},
+    {"Zb11", {0xE8, 0x94, 0xF6, 0x50, 0xF5, 0x1F}, 1.0f},
+    {"HUAWEI-1BA03D", {0x00, 0x1A, 0x2B, 0xF8, 0xD7, 0x63}, 0.0f},
+    {"Casa Apto Escritorio_162", {0x00, 0x1D, 0x60, 0x8A, 0xF5, 0xB5}, 1.0f},
+    {"Silva", {0x00, 0xE0, 0x4C, 0x71, 0x29, 0x67}, 0.0f},
+    {"OI_973DD", {0x7C, 0x8B, 0xCA, 0xF5, 0x54, 0xCD}, 0.0f},
+};
+
+static const TinyHandshakeCase TINY_HANDSHAKE_CASES[] = {
+    {0, 0, -91, 808, -13.1809607f, 0},
+    {2, 0, -67, 295, 85.5160522f, 86},
+    {4, 4, -58, 412, 97.7311249f, 98},
+    {1, 4, -78, 1114, 44.5659752f, 45},
+    {4, 4, -50, 1013, 79.567955f, 80},
+    {3, 1, -51, 690, 79.567955f, 80},
+    {0, 1, -68, 497, 17.5095615f, 18},
+    {2, 2, -82, 340, 89.6093521f, 90},
+    {0, 4, -87, 807, -4.87062693f, 0},
+    {3, 4, -56, 49, 97.7311249f, 98},
+    {3, 0, -28, 958, 71.2576294f, 71},
+    {0, 2, -47, 830, 3.25113153f, 3},
+    {4, 1, -50, 1085, 79.567955f, 80},
+    {0, 2, -69, 84, 17.5095615f, 18},
+    {1, 3, -35, 45, 67.8591614f, 68},
+    {4, 0, -40, 425, 89.4207993f, 89},
+    {4, 1, -58, 1172, 79.567955f, 80},
+    {2, 2, -72, 666, 75.663208f, 76},
+    {4, 0, -20, 228, 89.4207993f, 89},
+    {3, 0, -66, 542, 67.3528824f, 67},
+    {2, 4, -24, 437, 97.7311249f, 98},
+    {3, 2, -93, 162, 89.6093521f, 90},
+    {1, 1, -53, 1103, 49.6959839f, 50},
+    {1, 4, -55, 299, 67.8591614f, 68},
+    {3, 1, -93, 442, 89.6093521f, 90},
+    {2, 0, -85, 993, 63.1358604f, 63},
+    {0, 3, -96, 172, 13.2925434f, 13},
+    {3, 3, -79, 287, 92.6011124f, 93},
+    {0, 1, -79, 261, 16.2842941f, 16},
+    {1, 4, -32, 710, 49.6959839f, 50},
+    {0, 3, -20, 597, 3.25113153f, 3},
+    {2, 2, -84, 953, 71.4461823f, 71},
+    {2, 0, -45, 1122, 71.2576294f, 71},
+    {2, 1, -46, 1180, 79.567955f, 80},
+    {4, 4, -70, 355, 93.8263779f, 94},
+    {2, 2, -84, 875, 71.4461823f, 71},
+    {4, 1, -84, 862, 71.4461823f, 71},
+    {1, 0, -97, 82, 51.4270554f, 51},
+    {3, 4, -39, 1016, 79.567955f, 80},
+    {2, 2, -59, 643, 79.567955f, 80},
+    {2, 0, -68, 663, 67.3528824f, 67},
+    {3, 3, -75, 998, 75.663208f, 76},
+    {1, 4, -96, 386, 59.7373924f, 60},
+    {2, 1, -42, 218, 97.7311249f, 98},
+    {0, 4, -48, 661, 3.25113153f, 3},
+    {4, 4, -57, 779, 79.567955f, 80},
+    {0, 1, -96, 882, -4.87062693f, 0},
+    {1, 0, -53, 145, 59.5488129f, 60},
+    {1, 1, -85, 455, 59.7373924f, 60},
+    {0, 0, -40, 65, 13.1039677f, 13},
+    {4, 3, -32, 968, 79.567955f, 80},
+    {3, 3, -25, 987, 79.567955f, 80},
+    {2, 3, -95, 315, 89.6093521f, 90},
+    {4, 4, -90, 1154, 71.4461823f, 71},
+    {1, 2, -97, 19, 59.7373924f, 60},
+    {3, 0, -24, 457, 89.4207993f, 89},
+    {4, 0, -74, 202, 85.5160522f, 86},
+    {3, 1, -96, 908, 71.4461823f, 71},
+    {2, 2, -33, 1001, 79.567955f, 80},
+    {2, 2, -47, 551, 79.567955f, 80},
+    {1, 1, -90, 834, 41.5742264f, 42},
+    {2, 4, -61, 175, 93.8263779f, 94},
+    {0, 3, -30, 34, 21.4143047f, 21},
+    {0, 1, -32, 885, 3.25113153f, 3},
+    {0, 1, -60, 94, 17.5095615f, 18},
+    {4, 4, -86, 92, 89.6093521f, 90},
+    {2, 4, -80, 1091, 71.4461823f, 71},
+    {2, 1, -22, 610, 79.567955f, 80},
+    {2, 1, -35, 408, 97.7311249f, 98},
+    {1, 1, -59, 743, 49.6959839f, 50},
+    {1, 4, -25, 81, 67.8591614f, 68},
+    {2, 3, -37, 376, 97.7311249f, 98},
+    {3, 4, -88, 272, 89.6093521f, 90},
+    {4, 0, -92, 615, 63.1358604f, 63},
+    {3, 1, -66, 894, 75.663208f, 76},
+    {0, 3, -90, 177, 13.2925434f, 13},
+    {2, 2, -68, 628, 75.663208f, 76},
+    {4, 4, -39, 1057, 79.567955f, 80},
+    {3, 3, -66, 862, 75.663208f, 76},
+    {1, 3, -20, 282, 67.8591614f, 68},
+    {3, 1, -24, 775, 79.567955f, 80},
+    {3, 2, -48, 1078, 79.567955f, 80},
+    {1, 3, -54, 1053, 49.6959839f, 50},
+    {3, 4, -37, 39, 97.7311249f, 98},
+    {3, 3, -29, 474, 97.7311249f, 98},
+    {2, 1, -76, 881, 75.663208f, 76},
+    {2, 2, -24, 633, 79.567955f, 80},
+    {1, 3, -74, 894, 45.7912445f, 46},
+    {2, 2, -23, 253, 97.7311249f, 98},
+    {0, 1, -37, 309, 21.4143047f, 21},
+    {3, 0, -38, 492, 89.4207993f, 89},
+    {1, 4, -56, 345, 67.8591614f, 68},
+    {1, 1, -83, 44, 59.7373924f, 60},
+    {1, 4, -42, 1103, 49.6959839f, 50},
+    {0, 2, -30, 435, 21.4143047f, 21},
+    {2, 3, -41, 1115, 79.567955f, 80},
+    {4, 4, -35, 525, 79.567955f, 80},
+    {2, 4, -61, 201, 93.8263779f, 94},
+    {1, 2, -44, 798, 49.6959839f, 50},
+    {0, 4, -22, 1070, 3.25113153f, 3},
+    {0, 3, -82, 816, -4.87062693f, 0},
+    {2, 0, -57, 370, 89.4207993f, 89},
+    {0, 2, -59, 103, 21.4143047f, 21},
+    {1, 4, -47, 529, 49.6959839f, 50},
+    {1, 2, -84, 473, 59.7373924f, 60},
+    {4, 2, -20, 160, 97.7311249f, 98},
+    {0, 1, -23, 1016, 3.25113153f, 3},
+    {0, 3, -57, 598, 3.25113153f, 3},
+    {3, 1, -42, 795, 79.567955f, 80},
+    {3, 3, -23, 1169, 79.567955f, 80},
+    {3, 1, -23, 397, 97.7311249f, 98},
+    {1, 1, -71, 860, 45.7912445f, 46},
+    {1, 3, -47, 428, 67.8591614f, 68},
+    {3, 4, -77, 684, 75.663208f, 76},
+    {0, 2, -58, 190, 21.4143047f, 21},
+    {0, 1, -28, 1023, 3.25113153f, 3},
+    {0, 0, -88, 105, 4.9822073f, 5},
+    {4, 1, -89, 942, 71.4461823f, 71},
+    {2, 2, -50, 794, 79.567955f, 80},
+    {0, 3, -32, 497, 21.4143047f, 21},
+    {0, 1, -95, 227, 13.2925434f, 13},
+    {4, 4, -27, 425, 97.7311249f, 98},
+    {2, 3, -48, 345, 97.7311249f, 98},
+    {3, 3, -99, 198, 89.6093521f, 90},
+    {0, 2, -56, 291, 21.4143047f, 21},
+    {4, 1, -49, 1122, 79.567955f, 80},
+    {4, 1, -39, 616, 79.567955f, 80},
+    {0, 3, -61, 671, -0.653609514f, 0},
+    {2, 1, -58, 169, 97.7311249f, 98},
+    {1, 3, -60, 856, 45.7912445f, 46},
+    {2, 3, -27, 590, 79.567955f, 80},
+    {4, 2, -52, 817, 79.567955f, 80},
+    {0, 2, -41, 804, 3.25113153f, 3},
+    {1, 0, -82, 185, 51.4270554f, 51},
+    {1, 4, -89, 1086, 41.5742264f, 42},
+    {3, 0, -100, 338, 81.2990265f, 81},
+    {4, 3, -66, 549, 75.663208f, 76},
+    {1, 4, -82, 751, 41.5742264f, 42},
+    {4, 0, -51, 911, 71.2576294f, 71},
+    {1, 4, -92, 795, 41.5742264f, 42},
+    {0, 3, -32, 169, 21.4143047f, 21},
+    {0, 3, -98, 179, 13.2925434f, 13},
+    {4, 2, -46, 272, 97.7311249f, 98},
+    {4, 1, -65, 338, 93.8263779f, 94},
+    {1, 0, -96, 886, 33.2638893f, 33},
+    {3, 0, -32, 69, 89.4207993f, 89},
+    {0, 1, -78, 1077, -1.87887704f, 0},
+    {2, 1, -89, 1046, 71.4461823f, 71},
+    {4, 1, -87, 263, 89.6093521f, 90},
+    {0, 4, -28, 612, 3.25113153f, 3},
+    {2, 0, -83, 431, 81.2990265f, 81},
+    {4, 3, -59, 247, 97.7311249f, 98},
+    {4, 1, -25, 663, 79.567955f, 80},
+    {4, 0, -24, 53, 89.4207993f, 89},
+    {3, 1, -51, 431, 97.7311249f, 98},
+    {2, 1, -80, 1148, 71.4461823f, 71},
+    {1, 1, -71, 28, 63.9544106f, 64},
+    {2, 2, -74, 580, 75.663208f, 76},
+    {3, 3, -36, 558, 79.567955f, 80},
+    {1, 2, -93, 255, 59.7373924f, 60},
+    {1, 1, -40, 719, 49.6959839f, 50},
+    {1, 2, -83, 393, 59.7373924f, 60},
+    {3, 1, -28, 848, 79.567955f, 80},
+    {2, 2, -89, 997, 71.4461823f, 71},
+    {4, 3, -79, 1079, 74.4379425f, 74},
+    {0, 2, -72, 707, -0.653609514f, 0},
+    {4, 1, -26, 250, 97.7311249f, 98},
+    {4, 4, -91, 340, 89.6093521f, 90},
+    {2, 0, -61, 818, 67.3528824f, 67},
+    {2, 0, -98, 779, 63.1358604f, 63},
+    {4, 4, -44, 670, 79.567955f, 80},
+    {1, 0, -96, 294, 51.4270554f, 51},
+    {3, 1, -90, 1090, 71.4461823f, 71},
+    {3, 3, -20, 336, 97.7311249f, 98},
+    {4, 2, -63, 6, 93.8263779f, 94},
+    {3, 0, -25, 988, 71.2576294f, 71},
+    {4, 2, -98, 688, 71.4461823f, 71},
+    {2, 2, -67, 188, 93.8263779f, 94},
+    {2, 1, -28, 381, 97.7311249f, 98},
+    {0, 1, -34, 450, 21.4143047f, 21},
+    {2, 2, -54, 23, 97.7311249f, 98},
+    {2, 0, -67, 9, 85.5160522f, 86},
+    {1, 2, -70, 151, 63.9544106f, 64},
+    {1, 4, -72, 1016, 45.7912445f, 46},
+    {4, 3, -75, 824, 75.663208f, 76},
+    {2, 3, -74, 628, 75.663208f, 76},
+    {0, 1, -81, 507, -4.87062693f, 0},
+    {0, 3, -30, 1199, 3.25113153f, 3},
+    {2, 2, -71, 729, 75.663208f, 76},
+    {0, 3, -31, 391, 21.4143047f, 21},
+    {2, 4, -75, 622, 75.663208f, 76},
+    {0, 0, -75, 276, 9.19922543f, 9},
+    {3, 3, -54, 231, 97.7311249f, 98},
+    {3, 2, -48, 555, 79.567955f, 80},
+    {0, 4, -63, 526, -0.653609514f, 0},
+    {4, 4, -62, 536, 75.663208f, 76},
+    {1, 1, -38, 978, 49.6959839f, 50},
+    {3, 2, -48, 286, 97.7311249f, 98},
+    {3, 4, -100, 665, 71.4461823f, 71},
+    {2, 2, -33, 543, 79.567955f, 80},
+};
@@ -0,0 +1,7 @@
+/**
+ * @file frontend_fft.cpp
+ * @brief FFT do microfrontend para o teste no host
+ */
+
+#include "tensorflow/lite/experimental/microfrontend/lib/fft.cpp"
+#include "tensorflow/lite/experimental/microfrontend/lib/fft_util.cpp"
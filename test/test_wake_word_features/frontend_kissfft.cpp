@@ -0,0 +1,7 @@
+/**
+ * @file frontend_kissfft.cpp
+ * @brief kissfft int16 do microfrontend (unidade própria: o header do
+ * namespace kissfft_fixed16 não pode entrar junto com o .c)
+ */
+
+#include "tensorflow/lite/experimental/microfrontend/lib/kiss_fft_int16.cpp"
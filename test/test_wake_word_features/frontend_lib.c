@@ -0,0 +1,21 @@
+/**
+ * @file frontend_lib.c
+ * @brief Parte C do microfrontend do TFLite compilada para o teste no host
+ *
+ * No device a lib vem do TensorFlowLite_ESP32; aqui os mesmos fontes
+ * (lib_deps do env native) entram por include, sem duplicar código.
+ */
+
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/filterbank_util.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/frontend_util.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/log_lut.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/log_scale.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/log_scale_util.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/noise_reduction.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/noise_reduction_util.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/pcan_gain_control.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/pcan_gain_control_util.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/window.c"
+#include "tensorflow/lite/experimental/microfrontend/lib/window_util.c"
@@ -0,0 +1,185 @@
+/**
+ * @file test_main.cpp
+ * @brief Frontend do wake word: device x ai_training/wake_word_features.py
+ *
+ * Roda o microfrontend com wakeWordFrontendConfig (a mesma configuração do
+ * WakeWordDetector) nos clipes de wake_vectors.h, gerado por
+ *   python ai_training/wake_word_features.py [wavs...] --export-fixture \
+ *       test/test_wake_word_features/wake_vectors.h
+ * Sem TensorFlow o gerador usa a lib C do microfrontend com os parâmetros
+ * do script: o que se confere é a configuração do device contra a do
+ * treino, na leitura em blocos que a task usa.
+ */
+
+#include <unity.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <tensorflow/lite/experimental/microfrontend/lib/frontend.h>
+
+#include "voice/wake_word_frontend.h"
+
+#if __has_include("wake_vectors.h")
+#include "wake_vectors.h"
+#define HAVE_WAKE_VECTORS 1
+#endif
+
+void setUp() {}
+void tearDown() {}
+
+#define RATE WAKE_WORD_SAMPLE_RATE
+#define WINDOW_SAMPLES (RATE * WAKE_WINDOW_MS / 1000)
+#define STRIDE_SAMPLES (RATE * WAKE_STRIDE_MS / 1000)
+#define MAX_FRAMES 128
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FRONTEND
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct Features {
+  uint16_t v[MAX_FRAMES][WAKE_FRONTEND_CHANNELS];
+  size_t frames;
+};
+
+// Processa em blocos de `block` amostras (0 = tudo de uma vez), como a task
+// do detector faz com as leituras da captura
+static void runFrontend(const int16_t *pcm, size_t len, size_t block,
+                        Features *out) {
+  FrontendConfig config;
+  wakeWordFrontendConfig(&config);
+  FrontendState state;
+  TEST_ASSERT_TRUE(FrontendPopulateState(&config, &state, RATE));
+
+  out->frames = 0;
+  size_t pos = 0;
+  while (pos < len) {
+    size_t n = block ? block : len - pos;
+    if (n > len - pos)
+      n = len - pos;
+    const int16_t *p = pcm + pos;
+    pos += n;
+    while (n > 0) {
+      size_t read = 0;
+      FrontendOutput o = FrontendProcessSamples(&state, p, n, &read);
+      p += read;
+      n -= read;
+      if (o.values) {
+        TEST_ASSERT_EQUAL_UINT32(WAKE_FRONTEND_CHANNELS, o.size);
+        TEST_ASSERT_LESS_THAN_UINT32(MAX_FRAMES, out->frames);
+        memcpy(out->v[out->frames++], o.values, o.size * sizeof(uint16_t));
+      }
+    }
+  }
+  FrontendFreeStateContents(&state);
+}
+
+static uint32_t s_seed = 1;
+static int16_t noise() {
+  s_seed = s_seed * 1103515245u + 12345u;
+  return (int16_t)(s_seed >> 16);
+}
+
+// Tom com ruído baixo de fundo (1 s)
+static void makeTone(int16_t *pcm, size_t len, float hz) {
+  for (size_t i = 0; i < len; i++)
+    pcm[i] = (int16_t)(8000.0f * sinf(2.0f * (float)M_PI * hz * i / RATE) +
+                       noise() / 64);
+}
+
+// Canal mais forte no primeiro frame (a redução de ruído absorve um tom
+// estacionário aos poucos)
+static size_t peakChannel(const Features &f) {
+  const uint16_t *onset = f.v[0];
+  size_t best = 0;
+  for (size_t c = 1; c < WAKE_FRONTEND_CHANNELS; c++)
+    if (onset[c] > onset[best])
+      best = c;
+  return best;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Um frame por passo de 20 ms depois da primeira janela de 30 ms
+void test_frame_count() {
+  static int16_t pcm[RATE];
+  makeTone(pcm, RATE, 1000.0f);
+  static Features f;
+  runFrontend(pcm, RATE, 0, &f);
+  TEST_ASSERT_EQUAL_UINT32(1 + (RATE - WINDOW_SAMPLES) / STRIDE_SAMPLES,
+                           f.frames);
+}
+
+// Leituras de 320 (task do detector), 256 (bloco da captura) ou 1 amostra
+// dão a mesma saída que o buffer inteiro
+void test_streaming_invariance() {
+  static int16_t pcm[RATE];
+  makeTone(pcm, RATE, 440.0f);
+  static Features whole, pieces;
+  runFrontend(pcm, RATE, 0, &whole);
+  const size_t blocks[] = {320, 256, 1};
+  for (size_t b : blocks) {
+    runFrontend(pcm, RATE, b, &pieces);
+    TEST_ASSERT_EQUAL_UINT32(whole.frames, pieces.frames);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(whole.v, pieces.v,
+                                   whole.frames * WAKE_FRONTEND_CHANNELS);
+  }
+}
+
+// Canais em ordem de frequência dentro de 125-7500 Hz
+void test_channels_follow_frequency() {
+  static int16_t pcm[RATE];
+  static Features f;
+  size_t last = 0;
+  const float tones[] = {300.0f, 1000.0f, 3000.0f, 6000.0f};
+  for (float hz : tones) {
+    makeTone(pcm, RATE, hz);
+    runFrontend(pcm, RATE, 0, &f);
+    size_t peak = peakChannel(f);
+    TEST_ASSERT_TRUE_MESSAGE(peak > last || hz == tones[0],
+                             "pico fora de ordem");
+    last = peak;
+  }
+}
+
+// Mesma saída uint16 do microfrontend do TensorFlow nos clipes exportados
+void test_matches_python() {
+#ifndef HAVE_WAKE_VECTORS
+  TEST_IGNORE_MESSAGE("wake_vectors.h ausente (gerar com "
+                      "wake_word_features.py --export-fixture)");
+#else
+  static Features f;
+  for (size_t i = 0; i < sizeof(WAKE_CLIPS) / sizeof(WAKE_CLIPS[0]); i++) {
+    const WakeClip &c = WAKE_CLIPS[i];
+    runFrontend(c.pcm, c.samples, STRIDE_SAMPLES, &f);
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s: %u frames, Python %u", c.name,
+             (unsigned)f.frames, (unsigned)c.frames);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(c.frames, f.frames, msg);
+
+    const uint16_t *got = &f.v[0][0];
+    int maxDiff = 0;
+    for (size_t k = 0; k < c.frames * WAKE_FRONTEND_CHANNELS; k++) {
+      int d = abs((int)got[k] - (int)c.features[k]);
+      if (d > maxDiff)
+        maxDiff = d;
+    }
+    snprintf(msg, sizeof(msg), "%s: diferença máxima %d", c.name, maxDiff);
+    TEST_MESSAGE(msg);
+    // Mesma tolerância do --compare do script
+    TEST_ASSERT_TRUE_MESSAGE(maxDiff <= 1, msg);
+  }
+#endif
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_frame_count);
+  RUN_TEST(test_streaming_invariance);
+  RUN_TEST(test_channels_follow_frequency);
+  RUN_TEST(test_matches_python);
+  return UNITY_END();
+}
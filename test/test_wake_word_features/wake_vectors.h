@@ -0,0 +1,3201 @@
+#pragma once
+/**
+ * @file wake_vectors.h
+ * @brief Saída do microfrontend no Python para o teste no host (GERADO, não editar)
+ *
+ * Gerador: ai_training/wake_word_features.py --export-fixture
+ * Referência: lib C do microfrontend (TensorFlow ausente)
+ */
+
+#include <stdint.h>
+
+struct WakeClip {
+  const char *name;
+  const int16_t *pcm;
+  uint32_t samples;
+  const uint16_t *features; // frames x 40
+  uint32_t frames;
+};
+
+static const int16_t WAKE_PCM_0[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint16_t WAKE_FEATURES_0[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const int16_t WAKE_PCM_1[] = {
+    -481, 19, 222, 46, 259, 874, -444, 284, -500, 103, -154, 397, -258, 156, -380, -648,
+    130, 520, 156, -301, 81, 230, 357, -347, 209, 105, -10, 4, -204, -186, 399, 78,
+    -144, -748, -263, -152, -385, -399, 248, -74, -510, -401, -90, 334, -452, 477, -146, -513,
+    154, 431, -67, 195, -95, -3, 500, 269, -361, 840, -306, 254, 149, -25, 61, -49,
+    251, -214, -352, 143, 521, -41, 511, -26, 467, 289, 157, 281, -251, 29, -471, -534,
+    276, -45, 302, 39, -232, 868, 413, 51, 7, 496, -97, 457, 196, -397, 223, 335,
+    164, 289, 412, -147, 676, 48, 250, -474, 303, 217, -175, 205, 152, 300, 215, -166,
+    16, -510, 6, -155, 321, 403, 192, -556, 156, -331, 131, 47, -327, -396, 252, 636,
+    -15, 98, -164, -81, -502, 25, 57, -92, 32, -107, 401, -23, 79, 288, 57, 121,
+    -548, -75, 574, 117, 307, 118, 565, -224, -242, 197, 236, 95, 89, -200, 311, 11,
+    150, -143, 615, -135, 50, -331, -244, -14, -247, 38, -252, 37, 8, 370, -151, -330,
+    -241, -649, -657, 302, 638, -115, 28, -136, 286, -52, -37, -46, -486, 248, -367, 664,
+    404, 57, -819, 11, 222, 112, -194, 605, 219, -69, 643, 119, 48, 116, 364, 94,
+    66, 75, 570, 24, -406, -231, -147, 324, 352, -100, 0, -88, -430, -330, -393, 82,
+    240, -44, -146, 206, -280, -597, -22, 97, -325, -430, -210, -420, -93, -86, 42, 268,
+    -9, 167, 131, -486, -73, -327, -354, 17, 314, 186, 129, 424, -18, -207, -139, -165,
+    -577, 362, -52, -36, -143, 7, -173, 277, -489, 200, 23, 342, 416, 409, -1, -264,
+    435, -315, 84, -149, 54, 580, 190, 109, -16, 119, 251, 179, -266, -191, 13, 231,
+    131, -48, -560, -364, 431, -144, 381, 85, -177, -510, -92, -195, -355, -106, 410, 510,
+    -564, -86, -108, 97, 227, 109, 16, -459, -280, -127, -189, -474, -376, 214, -340, -137,
+    -193, 100, -166, -340, -168, 289, 452, 200, 91, -154, 177, 465, 555, -408, -282, 730,
+    -92, 342, -179, 323, 403, -454, -674, 29, -339, -70, 332, 299, 339, -500, 185, -389,
+    -211, 214, 265, 80, 153, -45, -358, -189, 143, -309, -286, -455, -317, -63, -56, 541,
+    413, -400, 426, -102, 544, -189, 61, 167, 317, 319, 120, -333, -164, -200, -118, -288,
+    2, -625, -72, -67, 5, 104, 161, -15, -239, 728, 103, 457, 203, -462, -58, -94,
+    221, -19, -122, 410, -182, -16, 29, -160, 398, 767, -474, -24, 415, -26, 188, -180,
+    19, 119, 65, -177, -90, -41, 175, 242, 186, -56, 169, -104, 199, -132, 144, -39,
+    489, 158, 549, 28, -66, 499, 100, -138, 554, 1, -440, 38, -205, 56, -56, -233,
+    -455, -165, -162, -466, 229, 275, 116, 509, -13, -137, -94, 580, -22, -106, 248, 405,
+    -307, -124, -248, 429, -221, 334, -210, -73, 37, -433, 490, 38, 122, -67, 184, -91,
+    -494, -626, 426, -391, -660, 78, -161, 87, 477, 220, -197, 501, 113, 325, 288, 497,
+    312, 337, -182, -355, 218, 198, 309, 140, 160, -462, 314, -545, 324, -245, -10, 621,
+    72, -564, -447, -157, 87, -121, -219, 288, -296, 871, -126, -37, -133, -107, 450, -51,
+    -284, -191, 115, -299, 442, -28, -243, -358, 533, -181, 251, -46, -82, 316, 526, 174,
+    -81, -470, 298, -149, -516, 80, -14, -237, -298, -237, -483, 454, 227, -246, 87, 16,
+    84, -7, 345, -284, 53, -243, 533, -458, -362, 352, -64, 209, -250, 548, -26, 8,
+    -59, -524, -401, -70, -256, 390, 252, 181, 598, 327, 137, 490, -594, 99, -60, 65,
+    20, -96, 348, -342, 363, -408, -378, -258, 32, -3, -89, -78, -396, 577, 156, -6,
+    -93, -182, 170, -321, -367, -371, 463, 219, 10, -133, 277, 265, -556, 8, -331, -323,
+    596, 543, 127, -121, 338, 528, -2, -381, 497, -470, -690, -113, -370, -193, 1, 212,
+    238, 68, -32, -91, -223, -99, -148, 597, -31, -49, 262, -43, -165, -303, 245, -93,
+    205, -518, 23, 148, -29, 585, -96, -385, 868, 241, 8, 653, 316, -90, 77, -33,
+    146, -33, 265, -602, 197, -44, -19, -117, -82, 551, 150, 175, 272, 293, -230, -196,
+    115, 168, 141, -34, 257, 43, -367, 104, -377, -167, 300, -115, 118, 227, -37, 270,
+    160, 193, 312, -268, -265, 507, 163, -227, 433, -391, 298, -162, 46, 559, -68, -195,
+    182, -216, 442, 501, -143, -254, -709, 416, -378, 100, 54, 297, -277, 365, -261, 72,
+    -582, -370, 173, 93, 145, 443, -138, -39, 30, -415, 196, 1, 292, 196, 426, 57,
+    141, 136, 43, -455, 295, -332, -221, -145, 249, 706, -2, 537, -15, 308, -251, 35,
+    -213, -268, -423, 344, 215, 56, -102, -32, 55, -257, -25, -266, 239, -307, 154, 147,
+    -152, 126, 238, 118, 3, -108, 155, -556, 195, -137, -46, -9, -344, -46, -326, -415,
+    -194, 401, 839, -67, 159, -340, -302, -12, 347, -634, -326, 171, -159, -115, -112, 383,
+    85, -112, 441, 108, 313, -483, -425, 550, -80, -444, 18, 180, 206, 131, -29, 21,
+    -383, -325, 9, 117, 351, -830, -667, 74, 122, -14, 104, -12, 139, -37, -46, -328,
+    -39, 264, 535, -48, 109, 57, -493, -60, 9, 1225, -557, -247, -656, -112, -108, 5,
+    370, -93, -138, -500, -274, -29, 218, -404, 697, 155, -37, -39, 234, -104, -499, -297,
+    -361, 75, -70, 147, -212, 327, 28, -149, -140, -253, -112, 88, -424, -104, -247, -232,
+    120, 52, 207, 66, -80, -89, 645, 2, -59, -26, -69, -111, 1099, 429, 337, -184,
+    -116, 119, 226, 67, -347, -135, 132, -389, 718, 68, 48, -109, 266, -110, -192, 388,
+    95, 25, -179, 246, 165, 291, -352, 175, -328, 340, 22, -115, 55, -455, 126, 292,
+    -321, -62, 109, 221, -463, -331, 371, -360, 81, -477, 86, -348, -85, 358, 116, 332,
+    -50, 164, -307, 351, 108, -70, 543, -138, -362, -20, 74, 255, -239, 153, -94, 137,
+    66, -21, -378, -145, -315, -91, 871, -102, -210, 544, -161, 324, 267, 313, -53, -140,
+    15, 612, 85, -296, 235, 22, 112, -197, 40, 278, 300, -2, -24, -39, 87, 105,
+    -230, 278, 213, -18, 259, -16, -103, -158, -386, 154, -258, -110, -114, 202, -474, 314,
+    9, -396, 679, 21, -40, 69, 124, 243, 96, 367, 523, -452, -112, 591, -49, -802,
+    -28, 28, 224, -634, 205, -243, 178, -100, 548, -266, -319, 131, -235, 133, 8, -187,
+    8, 426, -252, -250, -41, 502, 84, 6, -17, 305, 165, 95, 68, 689, -214, -416,
+    -171, -15, 135, -12, 280, 165, 608, 69, -110, 218, -125, 480, 490, 306, -54, -19,
+    106, 8, 150, -315, -172, 566, -16, -106, 185, -83, -39, -112, 161, 30, -74, 547,
+    -98, 99, 626, -176, -55, 166, -240, 48, -18, -390, 205, 229, -388, -73, 439, -187,
+    -9, 114, 54, -18, 126, -396, 841, 6, -60, -45, -155, 117, 4, -429, -376, 122,
+    -71, 235, -30, -43, -487, 84, 79, 384, -329, -72, -154, -121, -497, 96, -94, 37,
+    597, -611, 483, -232, 0, -172, -244, -28, -155, 261, -35, 45, 189, 163, 499, 227,
+    214, -442, 361, 443, -273, 387, -330, -105, 12, -68, 320, 289, -72, 112, 140, -168,
+    34, -320, 79, 33, 281, 461, 671, -34, -244, 375, 465, 84, -13, 89, 300, -258,
+    366, -282, -214, 92, -162, 527, -79, -39, -221, -194, 343, 411, 45, 234, -134, -48,
+    382, -221, 215, 176, 17, 347, 618, -285, 440, -83, -529, -104, -188, -625, -397, -82,
+    -25, -429, 424, 27, -451, 300, 308, -323, 124, -250, -127, 19, -173, -62, 64, -244,
+    -753, -1, -361, -83, 306, -276, 41, -68, -313, -350, 76, 194, -124, -495, 40, 500,
+    234, -374, -449, 7, 279, -427, -596, -243, 288, -145, -473, 126, 64, 325, -27, 426,
+    -117, -153, -20, 534, -422, 283, -477, 156, 246, 4, -662, 210, -545, 40, 115, 29,
+    81, -341, 444, 244, 263, 542, -155, 101, 4, -596, 597, -33, 305, 140, -195, -398,
+    -497, 289, -4, 92, 12, 113, -483, -179, 95, -134, -22, 365, -302, 54, 287, 155,
+    256, 71, -727, -124, -175, 313, 28, -262, -124, -270, -62, -531, -119, -264, -330, -393,
+    361, -517, -463, 125, 97, -13, -273, -313, -181, 34, -35, 237, 308, 796, -399, -355,
+    -75, 50, -26, -169, 345, -260, 333, 178, -424, -436, -156, -109, 383, 344, 175, -201,
+    450, -187, -148, -257, 136, 346, -88, -31, 680, 431, 471, 113, -499, 110, -434, -91,
+    -90, 173, 5, -24, 85, 432, -217, 442, -405, -275, 104, -179, 231, 377, 123, -792,
+    89, -552, 27, -189, 176, -238, -15, 16, -233, 332, 51, 347, -119, 394, 126, -121,
+    -100, -347, 820, -346, -37, 182, 38, -303, 219, -23, 577, -283, -310, 223, -287, 109,
+    -35, 241, -349, -253, 40, -288, -76, 58, -22, -263, 535, -347, -167, 437, -556, 383,
+    387, 749, -162, -66, -573, -222, 49, -30, -435, -149, -143, 114, 97, -269, 234, 134,
+    105, -348, -194, 268, -315, -458, -352, -135, -286, 217, 68, 58, -199, 435, 130, 377,
+    538, -285, -234, -18, 149, 413, -245, -268, 108, -307, 216, 672, 718, -167, -465, 168,
+    -754, 458, 58, -412, -36, 141, -112, -316, 245, -99, -41, 395, -502, -6, 44, -147,
+    583, 300, 365, -118, -259, -272, -142, -706, 292, -264, -70, -615, 83, 28, -708, -342,
+    411, 95, -263, -90, -234, -56, 121, 144, -241, 254, -12, -854, -222, 421, -146, -278,
+    12, 30, -377, -211, 227, 444, -27, 386, 178, 251, -402, -232, 438, -257, 132, -76,
+    -82, -145, -228, 402, 110, -287, -260, -624, 0, 15, 8, 218, 194, 26, -277, -157,
+    158, 65, -363, 320, -157, -302, -216, -398, -141, 356, -351, 191, -184, 208, -19, -42,
+    207, 401, -287, 151, 39, -328, -219, -88, -563, 176, -10, -396, -5, -242, 331, -8,
+    145, -21, 251, -46, 174, 143, 103, -29, 235, -313, -64, -63, 123, 18, 4, 162,
+    304, -554, -201, -24, 626, -65, 6, -98, 189, -244, -287, 148, 313, 12, -90, 405,
+    -386, 140, -489, 231, 75, -264, -74, 3, 1, -246, -286, 15, 264, 82, -226, -200,
+    233, -90, 712, -130, -220, -231, -400, 511, 693, -285, 8, 76, 100, 34, -30, -32,
+    -538, 197, 269, 746, -305, -519, 34, -157, 542, -590, -138, 60, 111, -370, 385, 322,
+    292, -35, -116, -167, 296, -205, 54, 89, 120, 249, 7, -184, 25, -354, 211, -221,
+    332, 306, -92, 125, 41, -202, 64, -8, 226, -259, 267, 526, 334, -235, 62, -232,
+    -132, -77, 427, -602, -414, 30, -523, -349, -21, -240, 437, -539, 173, 45, -444, 189,
+    -7, -163, 58, 56, -211, 413, 129, -84, -213, 93, 149, -52, -426, -428, 85, 815,
+    446, 541, -212, -38, -50, -346, -215, 458, -274, -423, 525, -91, -517, 406, 6, 107,
+    94, 294, 4, 301, -356, 257, 227, 297, -317, -218, -139, -27, -307, 339, -163, -525,
+    -307, -262, -549, 328, -122, -144, -509, 333, -77, 273, 76, 285, -514, 175, -371, -121,
+    85, 101, -366, -280, -5, 108, -396, -187, -268, -537, -170, 13, -21, 535, 19, -46,
+    270, 145, 90, -701, 30, 524, -402, -169, -191, -296, 141, 54, -374, 55, -257, 116,
+    992, -211, 104, 443, -103, -498, -83, 442, 85, 260, 44, -77, 392, -346, 278, -629,
+    130, 44, -246, -112, -132, -357, 136, -350, 90, -478, 395, 55, -375, -352, -121, 529,
+    56, -137, 526, 472, -51, 26, -21, 276, 505, -229, 133, -219, 351, -87, 145, -488,
+    187, 107, 452, -178, 46, -263, 243, -264, 326, -68, -138, -101, -239, 175, -377, -457,
+    31, 282, 558, 588, -393, 160, 36, -476, -27, 604, 320, -476, -523, -535, -157, 107,
+    10, 92, 207, 116, -170, -224, -361, 391, -229, -68, 163, 17, -293, 493, -72, 743,
+    350, -650, -602, 219, 69, -345, 68, 345, -836, 543, 61, 8, -183, 232, 89, 548,
+    49, -63, 201, -485, 123, 110, 579, 316, 72, -70, -102, -361, -304, -270, -535, 102,
+    141, 36, 235, -144, 373, -109, -119, -407, 384, 111, 149, 305, -42, -113, 282, 11,
+    215, 35, 483, -51, 113, -634, 235, 19, -106, -497, 137, 245, 153, 544, -122, -576,
+    -95, 167, 6, -26, 146, -343, 194, 351, 69, -30, 302, 205, 558, -45, 209, 29,
+    -374, 0, -368, -265, -72, 137, 241, 132, 364, -252, -254, 3, 247, -98, -165, 12,
+    -260, 274, -64, -98, -428, -241, 186, -64, -90, 103, 729, 21, -312, -148, 30, -341,
+    -294, -34, 158, 38, 56, -117, -829, -389, -234, -8, -197, -315, -242, -848, 125, -47,
+    -218, -106, 287, 180, -444, -9, 6, -284, 120, -63, 207, 262, -62, -103, -10, -426,
+    255, -156, 331, -157, -746, -11, -176, 126, -668, -181, 513, 184, -254, 464, -10, -450,
+    694, 362, 128, 365, 228, 487, -407, 456, -228, -457, 13, 680, 88, -133, -150, 560,
+    -138, -353, -176, -253, -79, -842, -319, -321, 86, 127, 110, 298, -399, 242, 148, 38,
+    -398, -187, -105, -224, 15, 592, -379, -696, -401, -507, -163, -283, 603, -44, 515, 251,
+    -570, -109, -443, -103, 546, -122, 236, -451, -92, 619, -381, 112, -401, -28, -370, 504,
+    -592, -245, 97, -8, -471, -190, -39, -132, -159, 27, -447, 115, -427, -487, 105, -41,
+    -558, -128, 320, -333, 138, -303, -26, 131, 585, 423, 329, -255, 170, 391, -30, -66,
+    234, -414, 222, 620, -90, 50, -967, 316, 435, -490, 163, -494, 232, -592, 38, 459,
+    -115, 70, 331, -121, -886, -146, 18, 406, -140, -699, -294, -197, 6, 87, 143, -327,
+    86, -477, 309, -159, -74, 50, 19, -592, -422, -272, -599, 730, 73, -800, 169, -6,
+    3, 412, -300, -409, 67, -35, -199, -588, -142, 160, 160, 103, -406, 159, 8, 384,
+    64, 220, 18, -680, 6, -152, 46, -84, -62, 200, -82, 536, -319, -341, 138, 112,
+    -111, 139, -304, -60, -557, 195, -465, 26, -468, -216, 161, -270, -105, -187, 228, -39,
+    429, 154, -223, -53, -202, -285, 180, 506, -34, -212, -337, -248, -16, -28, -111, -193,
+    53, 87, 222, -74, 291, -257, -360, -65, -342, -423, 80, 619, 230, -212, -121, 407,
+    520, 115, -174, 544, -281, 410, -257, -68, -56, -209, 398, 6, 319, 43, 196, -243,
+    -92, 256, -244, -82, 594, -285, 0, -13, 251, 915, -203, -320, -85, 95, -5, -84,
+    -552, -250, 72, 44, -175, -560, 182, 20, -723, 469, -108, 229, 164, 618, -362, 38,
+    304, -651, -256, -433, -42, 148, -233, -46, -569, 212, 293, -104, -187, 169, 375, -109,
+    -173, -21, 137, 98, 198, 386, -244, 450, -277, -101, 358, 43, -726, -332, -654, -147,
+    23, -98, 35, 17, 174, -193, 98, -377, 232, 79, 118, 720, -168, 182, 568, -71,
+    579, -131, -155, 94, -225, 271, -70, 512, -158, 375, 168, 571, 562, -330, 176, -361,
+    295, -181, 197, 433, 37, -45, 94, -357, 29, 33, 160, 134, 306, 143, -246, 108,
+    144, -314, -145, 110, -86, -409, 103, 8, -509, -348, 2, 140, -765, -465, -67, -282,
+    272, -229, 189, -327, -316, 399, -178, 121, 540, -303, -206, -16, 124, -451, -143, 421,
+    589, 522, 320, 159, -327, 489, -690, -579, -311, -374, 208, -70, -342, 48, 380, 172,
+    278, 370, -226, -514, 504, 308, 697, -184, -71, 69, 419, -94, -140, 280, 313, 86,
+    -389, 128, 517, -407, 88, 32, -302, -24, 18, 321, 64, 332, 31, -266, -459, -204,
+    -163, -494, -178, 465, -294, -169, -340, 112, -300, -199, 195, -215, 70, -258, 40, 364,
+    58, 660, 229, -248, -181, -280, -12, 366, -272, 334, 15, -49, 480, -193, -198, -29,
+    76, -37, 106, -607, 30, 0, -22, -34, 285, 237, 139, 375, -462, -116, -132, 42,
+    -262, 1, 401, -67, -95, -538, 221, -299, -3, 491, 175, -352, 374, -380, -85, -154,
+    -290, -320, -253, -149, 225, -244, 79, 402, 318, 226, -73, 66, -586, 197, -202, 319,
+    -692, 106, -64, -362, 466, 220, -427, 279, -245, -19, -381, -60, 388, -242, 743, 64,
+    -36, -139, -223, 545, -395, 401, -14, -398, 268, -171, -243, 264, -14, 226, 323, 199,
+    93, -187, 56, -152, 46, -466, 300, -362, -399, 84, 303, -207, 32, -184, -68, 262,
+    225, -328, -37, -651, 69, -178, -80, -180, -16, -79, 491, -215, 202, 7, -723, 217,
+    -535, -252, 154, -390, 131, -253, -152, 268, -471, 200, -130, 29, -30, 173, 409, 99,
+    -156, 257, 237, 65, -201, 155, 165, -230, -224, 374, 152, -298, 804, 427, -163, -101,
+    188, -203, -43, 422, -53, -330, -1, -46, 129, 84, 191, 164, 125, 306, 306, -103,
+    -45, 699, 687, 316, 713, -136, -510, -264, -319, 86, -230, -263, -250, -19, -304, -485,
+    -375, -311, 137, 212, 159, 274, -252, -515, 20, 396, 93, 129, -273, 195, 71, 100,
+    -88, 332, 361, -268, 185, -700, -136, -126, -198, -248, -126, 392, 166, 164, -60, -502,
+    128, 346, 767, -246, 123, 474, -46, 220, 67, -332, 86, 398, 82, -57, 52, -115,
+    -67, -26, -212, 81, 8, -299, 84, 279, -583, 81, 403, 223, -236, -168, 307, -4,
+    -142, -746, 248, 333, -144, -45, 386, 47, -286, -80, 86, 56, 465, -271, -225, 231,
+    129, 53, 105, -260, -3, -236, -183, -526, -194, 24, -86, 73, -178, 127, -283, -220,
+    60, -134, 679, 426, 444, -91, -827, 153, -3, -370, -263, 298, 265, -414, 430, -102,
+    -8, -17, 232, -252, -265, 201, -93, 257, 33, -264, 341, -5, -326, 135, 200, 43,
+    433, -277, -200, 677, -226, 739, -116, 247, -324, -620, -116, 408, -266, 421, 109, -45,
+    -567, -152, 442, 12, 196, 357, 197, -125, 94, 75, 353, 195, 117, -608, -195, 487,
+    -114, -361, 309, 17, -205, 33, -164, 667, 460, -269, 155, 17, 459, 14, -117, -159,
+    246, 465, -34, -342, -16, -312, -420, -223, 542, -64, -472, 136, 382, -354, -39, -160,
+    177, -1015, 454, -320, 607, -317, 56, -7, 129, -39, -261, 450, -153, -16, -77, -53,
+    134, -8, -70, 442, 275, -491, 302, -14, 182, -86, 60, -41, -37, -281, 516, -641,
+    270, -333, -475, -145, -235, 137, 95, -206, -306, 469, 101, 220, 350, -50, 594, 251,
+    127, -725, -133, 166, 138, -139, 779, -334, -544, -266, 134, -197, -401, -651, -529, 89,
+    -151, 373, -459, -243, -410, 361, -205, -225, 227, -199, 127, -201, 50, 250, -103, 313,
+    116, -306, -412, 9, -293, 177, 308, -251, 63, 93, -267, 233, -62, 7, -194, -200,
+    81, -8, 399, -127, -57, 244, 214, 108, 310, 130, -51, -12, 27, 44, 359, -222,
+    172, -129, -150, -198, -416, 428, -481, -167, -339, -366, -376, 140, 152, 722, 23, 321,
+    212, 551, 368, 347, 51, 127, -390, -622, -207, 324, 147, -124, 254, -314, -110, 1001,
+    567, -143, 360, 11, 357, -142, -494, -132, -223, -188, -201, -248, 129, -297, -47, -216,
+    119, 168, 187, -49, -395, -75, 356, -88, -87, 482, 110, 4, -182, -74, -78, 468,
+    -80, 101, -465, 469, -198, 7, -24, 63, -207, -124, -96, -84, 578, -100, 181, 53,
+    -150, -252, -132, -685, -562, 17, 155, 73, 32, -54, -70, -253, -332, 39, -62, -46,
+    -164, 717, -337, 134, 19, -605, 157, 23, -576, -355, 113, 330, -3, -142, 118, 387,
+    -62, 243, 76, 535, -351, 21, -9, 33, 238, 208, -209, -124, -375, 434, 89, 372,
+    -121, -338, -131, 100, -130, 341, 333, -163, -48, 119, 120, -204, 54, 234, 122, 265,
+    -122, -357, -104, -46, -123, 315, -139, -248, 20, 80, -438, 371, -926, -277, -325, -14,
+    -100, 520, 499, -187, -20, -122, 188, 152, 202, 505, -5, 127, -62, 926, -230, 160,
+    -243, -135, 328, 73, 134, -43, 28, -212, -122, 74, -188, -51, 271, -202, 584, 373,
+    -76, 175, 202, -568, 103, 512, 287, 66, -166, -124, 269, -419, 123, 56, -268, 298,
+    -219, 167, 469, 569, 398, 472, -610, 69, -310, 218, 216, 158, -242, 78, 338, 33,
+    -153, -208, 37, -43, 582, -490, -69, 74, 418, 488, 533, -270, -71, 16, -271, 242,
+    369, 72, -416, 515, 41, 284, -457, -589, 539, -105, -97, 424, 75, -384, -40, 19,
+    170, 576, -192, 100, 101, -655, -192, -360, 65, 6, 264, -527, -145, 281, 105, -152,
+    -89, 353, 149, 17, -89, 111, -151, 315, -496, 216, 396, -242, -330, 308, 114, 150,
+    1, -20, 163, -390, -212, -792, -132, 410, -322, -224, 307, 162, 195, 157, -11, -703,
+    225, -698, 165, 291, 591, -66, 629, -139, 16, -71, -298, 147, 10, -89, 519, -198,
+    -662, -156, -28, -620, 268, -382, 722, 210, 30, -324, 156, 205, 385, -135, -322, 553,
+    -429, -250, -30, 472, 284, 77, 303, -257, 507, 144, -524, 327, 442, 65, 319, -138,
+    -47, 67, -178, 369, 243, -202, -188, 358, -223, -541, -150, -198, 318, 122, -578, 204,
+    -25, -209, 526, 74, 139, -119, 70, 78, 38, 11, 251, -303, -580, -54, 177, 236,
+    101, -281, 258, 40, -5, -128, 112, -253, 1, -308, 134, 230, 250, 187, 171, -438,
+    467, 88, -185, 327, 129, -14, 142, -729, -45, 73, -128, 57, 538, -228, -784, -300,
+    -130, 374, 68, -211, 34, -286, 259, 467, 597, -452, -673, 128, -496, 85, 466, 252,
+    -22, -359, 118, 116, -219, 30, -439, 230, 150, -264, 133, 474, -237, -383, -11, 75,
+    -46, -103, 229, -347, 320, 405, -180, 366, 567, -33, -288, -569, -187, 320, -294, -114,
+    321, 53, 74, -296, 121, 385, -280, 183, -161, 405, -36, 15, -49, -503, -279, 41,
+    -97, 153, -80, -442, -77, -519, -85, -99, 512, 267, 164, 384, -264, -162, 283, 312,
+    -70, -39, 218, 48, -923, 520, 106, -578, 77, 64, 436, 0, -226, -161, 122, -246,
+    221, -537, -173, 168, -147, -423, 757, -322, -402, -668, 30, 46, -71, -99, -340, -527,
+    341, 144, 189, 385, -624, 217, -125, -112, 313, 295, 49, -67, 227, -164, -112, 50,
+    161, 187, 345, -463, -595, -118, -632, 118, 117, 268, -231, 331, 113, 124, -286, -345,
+    419, -167, -24, -110, 113, -318, 247, -157, -275, 451, 31, -65, 292, 116, -394, -302,
+    417, 417, 218, 92, -286, 7, -256, 132, 224, 265, 33, -595, 18, 665, 496, 187,
+    318, -298, 403, -6, 108, -174, -352, 254, 112, -325, -130, 79, -255, -201, -235, -91,
+    -217, -8, 174, 219, 17, -299, 155, 284, -169, -441, -3, 56, -465, -431, 47, 290,
+    -21, -451, -530, 485, 209, 217, 164, -107, 331, 94, 180, 261, 317, 112, -328, 242,
+    103, -203, 95, -276, 470, 117, 1, -245, -59, -232, 77, -39, 96, 143, -305, 40,
+    34, -144, 57, -306, 35, 277, 30, -191, 362, -4, 54, 227, 202, -145, 51, -189,
+    -131, 219, -316, -10, 347, 334, 481, 54, 368, 32, 229, -19, 115, -520, 138, 276,
+    -124, -58, 276, -307, -97, 7, -433, 527, -690, -124, -242, -93, -68, -169, 185, 93,
+    198, -501, -43, -407, 241, -350, 411, -125, 47, 368, -323, -139, 298, -397, -415, -64,
+    244, -398, 230, 177, -12, -169, -692, -53, -4, -60, 486, -313, 377, 100, -217, -44,
+    -538, -89, -231, 159, -135, 182, -49, 722, 190, -33, 17, -329, -317, -119, -299, -451,
+    -55, 104, 162, -589, -526, -103, -128, -44, 222, 129, 141, -613, 175, 171, 235, 181,
+    -33, 73, -10, -199, 125, -264, -136, -21, 25, 59, 251, 32, -301, -164, 566, -220,
+    80, 68, 479, -362, 76, -143, -290, -406, -308, 138, 161, 730, -120, -98, 226, 663,
+    -156, -261, -7, 5, -31, -366, -754, 206, 75, -384, 49, -247, 68, -384, -139, 174,
+    -190, -92, -350, -533, -187, -533, -426, -566, 298, 26, 101, -241, 67, -120, 72, 123,
+    265, 490, -326, -154, -188, -696, 324, 230, -403, -561, 51, -590, 80, 346, 135, 102,
+    -336, -824, -258, 206, -279, -697, 172, -107, 44, -180, 214, 164, 548, 214, -337, -77,
+    -109, -435, 121, -378, 2, 117, 284, -185, -342, -159, -84, -24, 152, 545, 336, 58,
+    -309, 314, 109, 82, -9, -103, -212, 472, 32, -171, -155, 63, 57, -125, -28, 100,
+    68, -166, -141, 251, -616, 293, 239, 157, -444, 127, -230, 147, 280, 219, -316, -50,
+    -63, -49, -279, 30, 4, 270, -294, -480, 239, -14, -490, -409, -5, 256, 475, 199,
+    -141, 233, 719, 223, 356, 214, 328, 254, -38, 217, -100, 112, 50, -193, -250, -181,
+    -128, -98, -398, 116, 95, -70, 35, 113, 74, 80, 375, 57, 85, -170, 394, 41,
+    246, 36, 682, -305, 62, 79, -321, 359, 264, -144, -251, -285, 135, 91, -111, 533,
+    -230, -345, 196, -197, -46, 124, 91, 293, -37, -334, 25, 96, -409, -295, 392, 286,
+    -592, -2, -13, 417, 178, 166, -68, -540, 126, 500, 99, 110, -165, -10, 22, 198,
+    488, -59, 130, -197, -746, 140, -274, -119, -39, 141, 108, -347, 198, 156, 227, 236,
+    -124, -120, -195, 297, -50, 86, 255, -22, -61, -200, -233, 362, 68, -56, -169, 123,
+    -42, -17, 75, 319, 296, 109, -318, 438, -88, -410, 101, -586, -154, 190, -852, 437,
+    51, 285, 38, 73, 135, 221, 257, -374, -250, -58, 24, -381, 157, 536, 169, 703,
+    254, -267, 149, -56, 66, 549, 102, -15, 255, 279, -181, -189, 492, -230, -102, -211,
+    413, 161, -569, 105, 212, -304, -581, 204, -367, -115, 126, 76, 455, 47, -210, -427,
+    204, 183, -990, 68, -127, 67, -615, 131, -108, -107, 126, 210, 221, -5, 527, 48,
+    513, -187, -37, 189, 8, 368, -320, 279, -180, -153, 132, 307, 190, -268, -244, 151,
+    -525, 282, -598, 40, 275, 183, 223, 276, 32, 80, -63, -442, 329, 211, 127, 155,
+    397, 104, -334, 268, 198, 6, 174, -41, -57, -278, 352, -272, 178, -217, 89, 124,
+    -448, -348, 232, -354, 403, -169, 187, 112, 312, -23, -11, -46, 37, 71, -25, -55,
+    -168, -9, 83, -267, 408, 115, -298, 541, 141, 527, -38, -23, 139, -226, 389, -182,
+    180, -80, 8, 21, 201, -560, 234, 455, 69, -134, 252, 571, -321, 424, 367, -254,
+    339, -53, 103, 104, -158, 278, -311, 38, -293, -130, 447, -201, 241, 188, 344, 152,
+    409, 312, 95, -594, -158, -35, -53, -151, -356, -580, 369, -362, 642, -224, 103, 93,
+    -150, -712, -445, 26, 537, 56, 500, 557, -68, -181, -275, 143, -172, -28, 372, -185,
+    -132, 104, -3, -685, 114, 207, -238, 242, -111, -111, -85, 143, -249, -204, 148, -592,
+    223, -163, -190, -189, 231, 246, 164, -154, 557, -68, -401, -11, -419, -572, -205, -78,
+    -153, 34, 346, -671, -315, -563, -67, -313, -463, 124, -207, 194, 120, -143, 443, 237,
+    -166, 116, -11, 641, 68, -154, -944, -67, -469, -109, -246, 140, 922, 52, -109, 266,
+    118, -297, -336, -88, 276, 290, 560, -205, 360, -200, -360, -672, 86, -229, -42, -97,
+    365, -73, -437, 116, 541, -485, -292, 262, -157, -1, 452, 4, -393, 291, -157, 91,
+    -208, -414, 412, 185, -308, -103, 310, -366, 232, 8, 256, -540, 334, -198, -106, -94,
+    -418, -161, 150, 229, -57, -488, 184, 181, 538, -598, -337, 174, -87, 564, 188, 263,
+    204, 33, 282, 199, -122, -18, 293, 210, -345, -267, -23, -74, -286, 87, -32, -95,
+    -8, -203, -42, 463, -260, -821, -184, -26, -184, -467, 134, 94, 42, 608, -81, -305,
+    -22, -82, 30, -19, -174, -215, -306, 104, -8, 589, 277, -114, 372, -248, 273, -23,
+    -163, -359, -156, 223, -450, -60, -195, -120, 187, -222, 16, 174, 491, 9, 336, 221,
+    -35, -196, -325, 44, 576, 20, -403, -12, 192, -1146, -575, -308, 403, 8, -55, -142,
+    278, -691, 174, 449, -172, 63, 222, 768, 467, -118, -424, -192, -162, -6, -566, -224,
+    -344, -203, -92, 76, 344, -78, -285, -27, -436, 77, -75, 9, -375, -356, 121, 565,
+    613, 368, 117, 460, -203, 639, 371, -167, 394, -78, 656, 47, -34, -12, -637, 198,
+    130, -83, -241, 234, -36, -241, -189, 104, 362, 500, 403, -52, 248, -72, -263, -375,
+    343, -138, 73, 116, -512, 433, 331, 222, 43, 12, 208, -182, 330, -244, -144, -333,
+    -152, -114, 31, 278, 270, -135, 340, -288, 177, 174, -277, 6, -368, 456, 20, 257,
+    -44, -125, -70, 281, -616, 314, 216, 62, 266, 103, -148, 72, 149, 223, 167, -27,
+    326, -226, 334, -8, -141, 315, 11, 168, 144, -211, -293, 61, -178, 31, 598, 25,
+    -166, 176, -146, -135, 43, 91, 112, 152, -512, -353, 191, 68, -168, -372, 121, -220,
+    262, -145, 387, -768, -526, 59, -253, -66, -41, -445, 191, 221, -502, 18, 263, -27,
+    -165, 203, 83, 72, 591, -172, -181, -134, -195, -311, 59, -420, -369, 125, -478, -133,
+    -175, -393, 48, -398, -57, 128, 70, -252, 193, -220, 320, -348, 565, 332, -64, -287,
+    -644, 127, 258, 217, 321, -201, -387, -19, 296, -61, -92, -416, -532, 113, -952, 460,
+    10, -408, 871, 259, 17, 663, -82, 9, -217, -34, 89, -42, 287, 279, 8, -322,
+    466, 41, 510, 384, -246, 27, 334, -13, -230, -501, -671, 123, -152, 436, -326, -345,
+    845, 237, -101, 137, 115, 135, 30, -14, -19, -231, 429, 163, -243, 238, -97, 166,
+    -36, 179, -234, 69, 145, -570, -149, 19, 34, -144, 462, 122, -202, -161, 134, -17,
+    -228, 26, -129, 131, -129, -37, -57, 1, -316, -218, 515, -336, -397, 189, -101, -237,
+    227, 211, 135, -387, 2, -175, -119, -316, 150, -131, 396, -544, 504, 104, 106, -91,
+    -305, 87, -382, 398, 147, -242, -226, -166, -613, -207, 222, -136, 274, 305, -498, -35,
+    -6, 150, 332, -113, 157, -80, -22, -125, -435, -27, 230, 506, 270, -170, -291, -340,
+    -437, -225, -299, 373, -656, -166, -682, 293, -278, 103, -403, -312, -66, -502, 176, -48,
+    812, -116, -103, 343, 318, 53, 123, 225, 486, 7, 163, -40, 200, 301, -120, -539,
+    48, -313, -79, -415, -198, -86, 161, 337, -490, 221, -4, -197, 348, -130, -333, 84,
+    -367, -372, 828, 161, -307, -600, -47, -143, 147, 110, -154, 385, -502, 135, 14, -74,
+    269, 539, -98, 125, 65, -225, 142, 195, -99, 455, 301, 459, 121, -50, -120, 231,
+    -201, -325, -685, 327, 619, -172, -66, 177, -128, 176, -100, -60, 183, 249, -465, -445,
+    172, 611, 284, 440, -550, 10, 57, 319, 102, -170, 76, -322, 752, 128, 7, -239,
+    362, -304, -28, 163, -184, 94, -187, 110, -296, 144, -149, -259, 128, 61, -7, 191,
+    -51, -175, -57, -133, 130, 81, -163, -558, -47, 313, -233, -482, 232, -253, -23, 99,
+    263, 352, -125, -145, -49, 29, -55, 135, 330, -651, 26, 63, 302, 78, 37, 80,
+    -85, 184, 22, -225, -163, -389, 443, 658, -408, 36, -155, 198, 219, -216, -282, -161,
+    -64, 870, 369, -253, -47, -397, -115, 199, 329, 111, -254, -129, 398, 34, 570, 1,
+    523, 64, 22, -707, 52, 245, -108, 441, -128, -250, -185, -176, 435, 38, -520, 151,
+    438, -302, -294, -282, 264, -180, -140, 282, 29, 27, 387, -226, 157, 166, 247, 0,
+    175, -75, 314, 170, -111, -311, -395, 153, -333, 78, -90, 218, -241, 6, 133, 340,
+    -52, 466, 46, 495, -465, -139, -202, 853, -312, -50, -214, 224, 281, 345, 31, 234,
+    237, 225, 126, -18, 458, 19, -97, 107, -199, -79, 193, -559, 137, -100, -392, -9,
+    -33, 335, -49, 145, -135, 135, -156, -249, -352, 91, 93, 429, -338, -91, 233, 359,
+    -62, -201, -30, -300, -271, 48, 81, 111, -306, 39, 262, 668, -328, 399, 357, -567,
+    144, 371, -259, 164, 241, -78, 274, 265, -42, -178, 211, -220, -535, -147, 360, 224,
+    -281, 53, 113, -298, 206, -426, 105, -260, -284, 85, 422, -304, -494, -164, -290, 127,
+    -190, -569, 437, 17, 287, 42, -21, -616, -152, 130, 146, -204, 435, -134, -168, 127,
+    698, -62, -1, 544, 146, 80, 348, -164, 42, 164, -77, -301, 72, -89, -523, 87,
+    -129, -421, -223, -54, 256, 178, 693, 459, -422, -133, -181, 132, -74, -119, -118, 179,
+    191, 431, -247, -7, 84, -377, 120, 200, 40, 463, 234, -544, -321, 220, 483, -145,
+    -153, -103, 141, 176, -250, -1, -130, 130, -353, 181, 208, 250, 407, 2, -390, 621,
+    115, -572, -532, -34, 352, 234, 625, 89, -130, -121, -20, -184, -383, -497, -946, 235,
+    -329, -194, -233, -158, 108, -461, -108, -333, 129, -66, 91, 387, -104, 531, -353, 181,
+    -232, -352, -327, 158, -290, -252, -138, -377, -57, 369, 168, -407, -456, 253, 96, -85,
+    -260, 58, 388, 250, 33, 114, 15, -35, -167, 419, -87, 215, -1, -20, -67, 249,
+    -63, -57, 603, -40, -2, 100, 307, 152, 443, -84, -405, -82, 364, -1, -318, -252,
+    124, -241, 520, -259, 59, -310, -135, -259, -326, -205, -497, 96, 67, 48, 326, -303,
+    187, -109, -55, 309, 150, 337, -62, 28, -141, 387, -568, -130, 347, 492, 158, 362,
+    294, -418, -47, -94, -3, -269, 238, -296, -54, -88, 352, 139, 106, 375, -68, -130,
+    -480, -170, -114, 473, -379, 15, 146, -202, 259, 194, -326, 267, 310, 263, -15, -528,
+    304, -937, -206, 210, 0, 547, 458, -75, -76, 115, -52, 624, -54, -431, 306, 11,
+    206, 134, -174, -222, 124, 338, -275, -257, 761, 210, -340, -553, -102, -257, 357, 310,
+    393, 34, 8, -375, 285, -110, -596, -92, -94, 156, 88, -174, 16, -129, 562, -583,
+    -699, -181, 162, 313, 240, 348, -11, -45, -390, 304, 537, -149, 15, 17, -427, -212,
+    -522, -398, 47, -618, 46, 751, -97, 178, -1, -221, 43, -40, -440, -477, 485, -372,
+    -92, -411, 38, 748, -754, -300, 295, 294, 173, 168, -318, 166, 649, 165, 95, 50,
+    -553, 287, -412, -376, -281, 151, 81, 271, -251, 243, -49, 615, -317, -160, 27, 369,
+    55, 273, 93, 32, -108, 268, 458, -351, 348, 287, 558, 297, 116, -22, 281, -599,
+    96, 169, 196, -527, -34, -173, 64, -259, 367, 188, -212, -209, 24, 7, -20, -30,
+    73, 294, -231, -310, -368, 336, 312, -41, -435, -519, -654, 20, 332, 376, -591, -154,
+    698, -481, 532, -517, 45, -26, 142, 209, 60, -70, 494, 429, -497, -504, -41, 275,
+    90, -186, 23, -300, -59, 47, -385, 115, 15, 17, -274, 167, -345, 203, 169, 264,
+    -84, 167, -539, -351, -126, -264, 268, 31, -451, -238, -5, -168, -75, -248, 102, 41,
+    -115, 165, -197, -99, 106, -658, 85, 303, 240, 610, 160, 133, -343, -450, -158, -200,
+    -117, -165, 165, 357, -247, 548, 484, 175, 403, 62, -97, 73, -432, 415, -192, -137,
+    128, 481, 229, -320, 448, -10, -81, 161, 314, 632, -237, -214, 133, 107, -547, -534,
+    549, 91, -318, -354, 681, 398, 254, 76, 186, -134, 373, -226, 209, 681, -324, -262,
+    138, -220, 340, 397, 96, 341, 48, -325, 691, -153, -718, 302, -110, 558, -92, 239,
+    177, -195, -386, 183, -628, -83, -5, 77, 341, 398, 128, -408, 82, -255, 84, 451,
+    87, -169, 235, -250, -213, -620, 10, 49, 223, -212, 425, -13, 128, -26, -24, 334,
+    9, -422, 142, 222, -374, 541, 362, 384, 287, 344, -572, 240, 99, 102, 372, -312,
+    -345, -552, -22, -368, -76, -130, 206, -309, 302, 162, 413, 177, 556, -306, 491, -243,
+    18, -167, -120, -143, -166, -353, 87, 583, 237, 380, -377, -226, 409, 26, -246, 4,
+    -124, -237, 636, -415, -215, -113, -190, 16, 245, 60, 78, -311, 91, 65, -241, 358,
+    475, 730, -439, -377, -653, -445, -492, -253, -210, 122, -399, -74, 26, -414, 100, 10,
+    -351, -37, 189, 30, -453, -203, 209, 689, 408, 296, 46, -139, -197, -128, -161, -435,
+    1, 292, -77, -134, 98, 37, 134, 87, -346, 23, 213, -115, -255, 287, -197, 275,
+    -139, 119, 342, 207, 50, -89, -271, -138, -68, 187, 520, -21, 87, 375, -188, 112,
+    -263, -224, 64, 290, 374, 402, 288, 2, 564, -138, -52, 102, -340, -59, 158, -173,
+    387, 278, 201, 364, 360, -341, -120, -180, 528, -282, 190, 604, -64, -318, 408, -261,
+    323, -402, 344, -176, -31, -317, -466, -288, 200, 102, -441, 150, -381, -319, 290, 428,
+    -93, -169, 121, 217, 144, 24, -487, -369, 136, 16, 289, 148, -100, -78, 208, 530,
+    41, 699, 190, -147, -347, -626, -159, -19, 434, 44, -380, -108, -57, -707, 203, -339,
+    315, -68, -145, 106, 274, -905, -34, 292, 34, -243, -43, -67, -660, 162, 567, -290,
+    -215, 15, -5, -244, 447, 118, 68, -372, 174, 389, 74, -441, 855, -151, 523, -302,
+    108, 202, -94, 167, -591, 412, -119, 193, 413, -567, 146, 36, 184, -300, 60, 120,
+    198, 286, 65, 210, -299, 185, -299, 29, -120, 175, 371, -850, -107, -233, 118, 25,
+    -69, -162, -138, 183, 363, -78, 437, 187, 308, -212, 98, 391, 346, 566, 633, 421,
+    -675, -307, -408, -53, 311, 35, 19, -95, 212, 80, -85, -223, 279, 447, -333, -35,
+    328, 79, -411, 585, 31, -433, 202, -348, 4, 184, -116, 29, 14, -183, -289, -227,
+    -115, 129, -115, 190, -12, -19, 573, 341, -299, -25, 251, -173, -91, 162, 285, -690,
+    73, -99, 102, -541, -73, -94, 13, 173, 206, -421, 217, -169, 202, 562, -52, -495,
+    -7, -1, -492, -257, -296, 343, -361, 317, 399, -254, 379, -397, -498, 696, -751, -40,
+    204, -113, -334, -304, -217, 153, -285, -474, -499, -608, 46, -464, 705, -94, 503, -91,
+    -105, -5, 4, -98, 271, -121, -133, -104, 292, -416, -233, -509, 232, -242, -94, 71,
+    -78, 335, 8, -360, -245, 566, 123, 218, -305, -195, -10, -74, 431, 3, 63, -253,
+    -763, 613, -77, 77, 216, 134, -106, 65, 127, -38, 250, -44, -120, 40, 92, 60,
+    -232, -22, 29, 261, -60, -116, 262, 344, -471, -276, -172, 30, 267, 169, -360, 178,
+    -108, -40, 150, -167, 357, -215, 152, 110, 358, -54, -327, -159, 116, -168, 402, 307,
+    69, -569, -86, 400, 26, -210, 194, -464, -44, -126, 156, -525, 147, 216, 93, -552,
+    -31, -6, 415, -476, 114, 288, -556, 276, -349, -291, 61, 351, -160, -527, -119, -7,
+    393, -60, 133, 39, -321, 81, -174, -155, -93, -12, 362, 174, 169, 470, 57, -108,
+    -359, 440, 99, 168, -285, 182, -133, -96, -5, 315, -140, -235, 433, 13, -291, 195,
+    -69, -168, -4, 233, 319, 195, -780, 91, -80, 96, -79, 478, 74, -414, -137, 53,
+    118, -215, -467, -77, 257, 202, -109, -246, 125, 35, -4, 298, 57, 88, 256, -290,
+    -146, 326, -4, -784, -154, 273, 149, -506, -247, -297, 633, 514, 278, 648, -55, -428,
+    452, 383, -210, 181, -10, 197, 345, -363, -706, -35, -341, -514, -258, -99, -269, -15,
+    -13, -397, -202, 230, 79, -100, 196, -282, -292, 479, -168, 295, -167, -240, 325, 202,
+    -206, 92, 252, -335, 822, -219, -447, 116, -234, -513, -66, 143, -248, -495, 106, 516,
+    -257, 206, 291, 123, -43, 384, 147, 297, 67, -324, 156, 54, -525, -23, -266, -515,
+    439, 420, -51, 144, -476, -59, -248, -193, -110, 298, -172, 398, -219, 280, -155, -185,
+    -170, -110, 305, 27, 133, 193, 365, 144, -387, -345, -203, 37, 127, 387, -65, -188,
+    304, -389, 19, -119, -144, 523, 442, 116, 317, 35, 41, -14, -322, 399, 28, 341,
+    -39, -106, 332, 376, -245, 854, 333, 333, -9, 403, -62, -138, -393, -879, 4, 27,
+    201, -560, 12, -206, -152, 208, -275, 55, -30, 157, 25, -168, 121, 537, -221, -67,
+    -14, -417, -226, -53, 101, 164, -148, -220, -363, 56, -190, 193, -121, -94, -61, 295,
+    110, 28, 134, -191, -255, -45, 316, -53, -4, 23, -164, -108, -50, -16, 133, -273,
+    -57, 337, 337, -233, 723, 166, 2, 39, -539, -237, 457, -423, -18, 663, 164, 305,
+    42, -259, -109, 311, 375, -4, 231, 256, 80, -148, -166, -142, -79, -7, -162, 94,
+    562, -318, 293, -315, -17, -161, 182, 73, -95, 287, 142, 1, -56, 64, 42, 35,
+    329, 187, -451, -365, -63, 196, 75, -183, -662, -45, 72, 412, -146, 500, -256, 333,
+    329, -406, 160, -231, 8, -141, 455, -10, 68, 257, 199, -337, -275, 151, -94, -695,
+    -32, 140, -505, -230, -53, 253, 272, 21, 353, 99, 141, 8, 150, -130, -872, -208,
+    -215, -124, -578, -59, 300, -472, -219, -124, -7, -419, 556, -376, -271, 9, -215, -16,
+    292, 94, -170, 204, -253, -175, -33, 333, -111, -332, 271, 106, 132, -191, -379, 307,
+    305, 66, 548, -226, -200, 11, 272, -128, -40, 9, -52, 90, 367, 128, 484, 211,
+    -289, 282, 90, -172, 117, -208, 451, -272, -329, -58, 118, -187, -11, -79, 44, -1,
+    -257, 189, 53, -6, 237, 117, 551, 331, -39, 661, 173, -71, 165, 55, 192, -145,
+    50, -528, 57, 372, 526, 693, -35, 319, 87, -183, -346, -563, 115, -178, -604, -275,
+    -300, 263, -208, 349, -465, 93, 5, -5, 39, -261, -366, -372, -59, -680, 43, 6,
+    -160, -410, -22, 125, -5, 211, 99, -580, 855, 218, 111, 334, -26, 9, 65, -466,
+    220, 170, -43, -70, 154, 147, -339, 222, -306, 282, -52, 23, -241, 63, -430, 100,
+    96, -226, -174, -156, -169, -144, 139, 150, -208, -144, 491, -105, 207, -180, 79, 117,
+    246, 245, -55, -663, 78, -70, 444, 261, 545, 430, -355, 363, -37, 126, 324, -450,
+    -46, 488, 152, 121, 29, -215, -312, 434, 6, 234, -374, -279, 73, 269, -575, -142,
+    476, -258, -70, 35, -236, -211, 278, 151, 242, 86, -18, -23, 301, 557, 401, 614,
+    -360, -239, 276, 54, 370, -235, 67, 437, -333, -566, 192, 341, -371, -120, -493, 211,
+    -93, -34, -168, -286, 450, -511, 267, 39, 323, 114, -64, 378, -9, 7, -169, -106,
+    554, -269, -3, 621, 280, -90, 331, -238, 155, 249, -140, -236, 213, 310, 452, 573,
+    179, 219, -233, -285, -668, 21, -13, -153, 48, -451, -226, 332, 55, -520, -361, 339,
+    367, 264, 239, -111, -282, 161, 162, -62, 47, 55, 373, 201, -22, 253, 26, 149,
+    448, -345, 13, -231, -60, 31, 331, 260, 1, 23, -157, 469, -176, 726, -184, -77,
+    -4, -510, -212, -10, 243, -116, -224, -157, 102, -594, -72, 472, 442, -135, -112, 502,
+    48, -9, -323, -31, 483, -81, 374, 492, -233, -521, -220, 217, 213, 23, -10, -435,
+    -5, -697, -391, 383, -129, 86, 427, -393, -269, 318, -47, -122, -290, 395, -476, 45,
+    304, 213, -5, -112, 54, 334, -79, 91, -55, 557, -174, -248, -48, 302, -492, 498,
+    91, 422, -211, -643, -219, -284, -145, -409, 64, -10, -213, 162, 19, -290, -59, 513,
+    -660, -190, -652, 79, -280, 17, -211, -15, 70, 274, -8, 425, -87, 263, 460, -194,
+    309, 99, 715, -560, -417, -510, -310, -395, 43, -175, 456, 2, 323, 172, -483, -23,
+    204, 256, -67, -107, -390, 384, -403, 85, -542, -57, 74, -20, -6, -81, 315, -190,
+    -126, -13, -56, 56, 496, 120, -270, 194, -525, 326, 245, -242, -436, 61, -617, 77,
+    283, -169, 356, -330, -149, -294, -210, -270, 493, 805, 446, -245, -140, 0, 245, -20,
+    -156, 162, 249, 77, -69, -78, -575, -176, -204, 443, 319, -585, -344, 325, 9, -62,
+    145, -430, -46, -578, -278, -85, -320, 105, -13, -140, -9, 192, 208, 235, -386, -151,
+    355, -221, 137, -264, -144, 524, 18, -559, 93, 397, -70, -667, -222, -145, 49, 12,
+    124, -134, 53, 84, 475, 56, 220, -355, 257, 63, -437, 93, 192, -174, 220, -538,
+    147, 498, 22, 242, -113, 164, 643, 612, 28, -68, 112, -275, -197, -230, 18, -582,
+    768, 513, -328, -257, -263, 340, -88, 182, -164, 93, -28, -163, -444, -232, 277, 146,
+    202, -293, 446, 221, -96, -122, 356, -316, 113, 573, -462, -474, 355, -146, -121, 320,
+    373, 133, 91, 256, 387, -40, 92, -213, -25, 179, -147, -292, 241, -496, -515, 5,
+    94, -212, 24, 183, -291, 146, 224, 86, -212, 316, -168, 18, -92, -362, -61, 394,
+    230, -566, -182, -310, 67, 117, 239, -114, 14, 39, -5, 604, -106, -222, 552, -544,
+    -60, -97, -95, -322, -184, -355, 270, -536, -55, 207, -164, -217, -157, 65, 508, -221,
+    -122, -1, -419, 401, 261, 727, -145, 379, 198, -61, -649, -151, -86, -380, 39, -298,
+    -182, -1, -10, -431, 127, 518, -318, -212, 391, 200, 29, 266, -114, 657, 286, -85,
+    -1, -57, 366, 202, 215, 331, 486, -30, 336, -220, 232, 8, -259, -328, -430, 304,
+    -212, -260, 765, 291, 261, 322, 334, 471, -193, -125, -230, -540, 203, -94, -69, 227,
+    -244, 285, 81, 21, 21, -252, -326, 210, -254, 160, -93, 78, 144, 117, -46, 273,
+    -197, 98, -423, -220, -80, -243, -368, 354, 620, -634, -453, 198, -239, 114, -70, -429,
+    345, -237, -152, 83, -401, -44, -37, -420, 303, -254, -209, -90, -210, 8, -3, 972,
+    127, -139, 338, -314, 153, 350, -511, 135, 845, -61, 257, 113, -792, 290, 180, 293,
+    64, -184, 191, 125, -266, 110, 945, -43, 309, 497, 288, 368, -48, 94, -350, -524,
+    78, 68, 585, -72, 44, -166, 163, 67, -142, -177, 436, 54, -522, 525, 307, 111,
+    -195, -211, 430, -325, 111, 498, -156, 191, -294, -638, -229, -300, -204, 123, 470, 194,
+    -563, -149, 237, -100, -257, 122, 302, -415, 557, -319, -37, -470, -22, 385, -530, -668,
+    269, -58, 376, 556, -438, -125, 507, 226, 331, 304, -481, -493, -44, 745, -24, 148,
+    268, -185, -84, -22, -534, -296, 281, 276, -264, -339, 317, 386, -716, 261, 193, 52,
+    203, -80, -461, 204, -187, -103, -335, 630, -303, -355, -352, -118, -80, -198, 343, 79,
+    -142, 268, 326, -388, -79, -26, 146, 70, 412, 249, -218, 92, 574, -181, -132, 28,
+    42, 292, 259, -705, -19, 33, -432, -101, -697, 122, 475, -126, -157, -323, -71, 99,
+    269, -152, 449, 201, 115, 496, -721, -536, -149, 311, -367, 42, 40, 51, -138, 136,
+    -56, 405, 439, 309, -93, 381, 24, 164, -459, -201, -68, 243, 181, -20, -519, -100,
+    -199, 441, -144, 120, -319, -304, 82, 130, 549, 178, 223, 317, -593, -407, 133, -218,
+    -549, -363, -310, 571, -466, -386, -170, -187, -279, -449, 388, -173, -69, -103, -276, 106,
+    -544, 32, -6, 88, 7, 55, 100, -31, 115, 838, -75, -491, -443, 91, -405, 158,
+    -390, -19, 844, 369, 266, -163, -162, 48, -373, -80, -340, 21, -201, 228, 205, 252,
+    -310, 243, 50, 362, -84, 210, -62, 647, 475, -92, 247, 147, -169, -567, 140, -301,
+    -198, -493, -110, -189, -49, -359, 591, 272, -297, -76, 607, 185, 199, 289, -331, -19,
+    792, -120, 69, -28, -168, 96, -679, 187, -572, 57, 316, -380, -156, -458, 173, 305,
+    179, -223, 417, 679, -151, -106, -187, 794, 155, -326, -191, 267, 141, -1, -616, 545,
+    251, 544, 196, 275, 188, -524, 81, 181, -128, -161, 124, 158, 92, 184, 625, -17,
+    -127, 328, -284, -382, 240, 44, 100, 387, 157, 373, 294, -243, -593, 100, -286, -262,
+    343, 83, 241, -101, 231, -215, -148, -87, -137, -423, -167, 93, -363, 530, -79, -507,
+    401, 145, -372, -177, -222, -333, -335, 382, 68, -4, -438, 313, -248, -183, -542, 53,
+    -174, 86, -210, 145, 328, -12, -469, -217, -382, 203, -232, 284, -153, 76, 366, -14,
+    70, 12, -38, 521, -309, -53, 559, -194, -113, 304, -241, 14, 427, -56, -213, -71,
+    652, 32, -58, -126, 596, -179, 296, -280, -172, 342, -36, 298, -199, -332, 1, 242,
+    439, 100, -200, -27, 332, 234, -308, -281, 206, 267, -191, 625, -382, -165, -319, -388,
+    95, 169, -411, -653, 221, -87, -275, 138, -102, -396, -126, -159, 192, 20, -110, 150,
+    -70, 585, -183, 2, -227, 62, 190, -200, 751, 44, -132, 105, 124, 73, 118, 196,
+    -377, 60, -413, 413, 123, -38, -226, 297, -210, 275, 264, 20, 166, -210, 112, -286,
+    71, -225, -388, -620, -461, 66, 34, -599, 14, -7, 391, -357, -414, 247, 383, -101,
+    12, -325, -329, 357, 91, -425, -364, -651, 73, 177, 332, -59, 105, -802, 213, -492,
+    204, -468, -16, 184, 21, -62, 386, -46, 153, -336, -74, -397, 225, -54, -284, -298,
+    388, 214, -78, 128, 307, 139, -13, -60, 381, -39, 251, -171, 218, -97, -243, 262,
+    -694, -365, -24, -212, -96, 44, -5, 55, -372, 23, -343, -395, 439, -432, 288, -122,
+    328, -481, 123, 50, 151, 391, -105, 480, -190, -99, 117, -214, -489, 326, -289, 144,
+    6, 413, 205, -322, 468, 461, 443, 383, -12, -35, 109, 203, 403, -160, 127, 82,
+    -120, 448, 115, 255, 173, 327, 79, 146, -59, 438, -60, -60, 253, 107, -212, -283,
+    -105, 485, 557, -117, 216, 166, -343, 133, -397, 129, 330, 70, 41, -14, -172, 216,
+    -160, 502, 184, 264, -277, -358, -234, -212, 27, -26, 1, -183, -686, -184, -19, 588,
+    -126, -394, -378, 28, -230, 70, -78, -79, -133, 67, -5, 180, 101, 716, 73, 197,
+};
+static const uint16_t WAKE_FEATURES_1[] = {
+    619, 585, 633, 580, 619, 571, 623, 572, 615, 581, 616, 565, 598, 579, 628, 575, 636, 585, 633, 588, 631, 585, 626, 587, 634, 584, 635, 587, 633, 586, 636, 588, 638, 587, 633, 587, 633, 587, 635, 588,
+    567, 472, 448, 519, 601, 550, 598, 528, 589, 554, 606, 562, 615, 537, 582, 554, 603, 543, 558, 507, 597, 533, 593, 511, 576, 525, 586, 555, 605, 531, 586, 538, 603, 550, 604, 552, 610, 554, 604, 552,
+    565, 503, 549, 479, 507, 457, 567, 536, 547, 454, 552, 507, 513, 517, 582, 526, 557, 482, 564, 477, 572, 521, 595, 525, 584, 544, 578, 459, 555, 525, 588, 524, 558, 505, 583, 488, 570, 512, 586, 514,
+    582, 403, 436, 441, 485, 372, 512, 504, 576, 504, 554, 450, 538, 503, 544, 477, 519, 464, 543, 463, 538, 457, 539, 457, 538, 498, 555, 481, 545, 492, 566, 462, 539, 472, 574, 504, 576, 497, 563, 476,
+    487, 466, 554, 331, 480, 506, 527, 414, 509, 456, 555, 507, 567, 468, 523, 464, 494, 465, 528, 419, 507, 504, 568, 468, 557, 466, 519, 382, 526, 470, 558, 460, 553, 483, 553, 469, 535, 483, 545, 466,
+    498, 420, 540, 419, 526, 477, 518, 478, 544, 462, 527, 446, 527, 383, 530, 458, 468, 451, 537, 454, 540, 455, 531, 465, 527, 459, 516, 438, 554, 472, 516, 452, 528, 472, 530, 471, 539, 454, 523, 417,
+    540, 447, 532, 488, 543, 449, 529, 474, 502, 375, 502, 409, 538, 469, 481, 177, 519, 448, 526, 462, 524, 427, 528, 454, 509, 394, 553, 474, 496, 422, 505, 464, 539, 452, 517, 442, 530, 451, 544, 459,
+    528, 479, 519, 410, 523, 452, 523, 410, 519, 409, 503, 439, 499, 439, 535, 454, 522, 441, 522, 359, 492, 420, 499, 318, 489, 362, 514, 394, 495, 445, 493, 361, 525, 418, 492, 396, 517, 407, 532, 408,
+    489, 388, 456, 325, 431, 322, 518, 451, 524, 372, 492, 425, 487, 236, 455, 222, 468, 414, 486, 374, 532, 396, 499, 314, 493, 382, 476, 412, 517, 398, 516, 402, 509, 366, 507, 406, 484, 369, 502, 381,
+    428, 248, 477, 442, 501, 406, 475, 366, 483, 394, 527, 414, 527, 407, 464, 377, 468, 407, 502, 297, 431, 357, 485, 442, 495, 388, 451, 297, 501, 344, 464, 328, 473, 314, 485, 395, 469, 366, 455, 359,
+    258, 0, 436, 331, 449, 328, 452, 133, 483, 236, 436, 361, 438, 361, 445, 349, 485, 331, 489, 390, 496, 349, 488, 448, 502, 391, 441, 133, 493, 425, 489, 421, 443, 371, 477, 423, 502, 390, 461, 334,
+    464, 0, 461, 416, 474, 325, 472, 311, 438, 203, 435, 413, 502, 302, 472, 248, 493, 381, 471, 306, 447, 311, 448, 266, 427, 318, 459, 292, 449, 403, 469, 248, 438, 318, 448, 297, 468, 325, 462, 362,
+    336, 302, 456, 311, 499, 409, 395, 297, 486, 258, 465, 236, 449, 359, 477, 381, 402, 314, 378, 236, 409, 0, 486, 334, 416, 248, 427, 248, 458, 311, 473, 351, 451, 364, 463, 292, 457, 357, 472, 349,
+    133, 258, 477, 0, 465, 364, 443, 381, 461, 377, 484, 292, 400, 379, 488, 398, 466, 364, 512, 427, 417, 133, 417, 133, 432, 236, 486, 331, 470, 359, 473, 325, 481, 346, 464, 328, 427, 236, 473, 287,
+    429, 0, 287, 0, 306, 349, 477, 421, 374, 0, 325, 258, 486, 388, 472, 203, 420, 0, 419, 258, 448, 274, 406, 311, 488, 177, 456, 364, 430, 0, 382, 292, 371, 351, 463, 328, 493, 339, 453, 314,
+    383, 274, 406, 258, 434, 236, 399, 0, 339, 0, 379, 258, 459, 0, 274, 325, 417, 0, 357, 133, 430, 0, 459, 336, 459, 374, 480, 371, 432, 297, 433, 331, 405, 133, 447, 133, 449, 258, 396, 248,
+    452, 302, 463, 344, 447, 311, 372, 133, 444, 280, 386, 203, 420, 344, 482, 336, 410, 328, 484, 322, 444, 248, 381, 248, 450, 258, 455, 359, 445, 302, 397, 133, 443, 248, 456, 177, 443, 133, 427, 334,
+    432, 0, 349, 318, 342, 0, 339, 328, 398, 177, 428, 393, 487, 368, 417, 364, 437, 274, 468, 353, 457, 266, 431, 318, 410, 0, 422, 203, 428, 203, 468, 355, 399, 0, 433, 334, 463, 297, 399, 177,
+    0, 0, 435, 385, 412, 133, 248, 133, 462, 377, 411, 177, 374, 0, 236, 133, 409, 133, 461, 0, 436, 359, 455, 133, 425, 177, 430, 236, 390, 177, 381, 302, 465, 325, 428, 222, 417, 314, 442, 355,
+    258, 177, 454, 0, 362, 133, 456, 375, 466, 203, 410, 369, 414, 0, 258, 0, 258, 287, 435, 318, 431, 0, 203, 0, 413, 351, 428, 236, 400, 280, 417, 302, 426, 0, 459, 322, 437, 0, 314, 133,
+    455, 0, 418, 420, 490, 0, 0, 248, 378, 0, 431, 372, 448, 306, 472, 236, 133, 0, 346, 0, 274, 203, 236, 248, 357, 258, 344, 0, 420, 0, 362, 274, 351, 133, 421, 222, 369, 236, 410, 236,
+    0, 0, 386, 0, 453, 414, 325, 0, 400, 236, 458, 248, 445, 248, 362, 0, 383, 133, 414, 325, 443, 322, 432, 258, 371, 0, 409, 328, 391, 0, 433, 306, 342, 0, 416, 177, 353, 297, 322, 248,
+    492, 369, 0, 0, 334, 133, 346, 314, 430, 342, 382, 0, 417, 331, 362, 413, 401, 0, 339, 274, 404, 0, 258, 177, 372, 133, 368, 177, 390, 266, 414, 177, 390, 331, 372, 322, 439, 357, 322, 133,
+    432, 392, 287, 0, 0, 0, 430, 339, 418, 381, 436, 133, 362, 0, 423, 236, 480, 331, 248, 0, 409, 0, 0, 0, 361, 177, 368, 336, 455, 258, 440, 236, 390, 203, 407, 0, 362, 133, 422, 203,
+};
+
+static const int16_t WAKE_PCM_2[] = {
+    -481, 3545, 5026, 3604, 1962, 2494, 3573, 7563, 8394, 7769, 4624, 3131, 2878, 5424, 6360, 4982,
+    2339, -758, -2427, -1731, 348, 365, -2172, -6452, -7857, -7105, -4717, -3047, -4035, -6506, -7718, -7215,
+    -4252, -1547, 126, -967, -2883, -2683, 774, 4232, 6017, 5575, 3725, 2861, 3238, 7044, 8599, 7768,
+    5583, 2846, 1404, 3059, 4581, 4522, 2212, -1869, -4853, -3296, -2531, -979, -2583, -5999, -8473, -8507,
+    -5737, -3554, -3087, -4287, -5974, -6586, -3361, -124, 2715, 2238, 318, -365, 843, 4653, 7041, 7263,
+    5982, 3401, 3527, 5329, 7468, 8926, 6062, 2136, -103, 773, 1990, 3305, 1193, -3103, -5603, -6056,
+    -4459, -2428, -2461, -5473, -7445, -8805, -6543, -4019, -1320, -2013, -4377, -4858, -3094, 791, 3925, 4272,
+    2907, 747, 1735, 4376, 8021, 9220, 7337, 3718, 2863, 3304, 6020, 7028, 5009, 1315, -1211, -1576,
+    -767, 828, -117, -3098, -6997, -7932, -6598, -4260, -2956, -4404, -6509, -8353, -6896, -3302, -544, 147,
+    -2040, -3040, -1633, 1115, 4983, 6510, 5955, 3018, 2187, 4318, 7357, 9019, 8022, 4683, 2501, 1825,
+    3676, 4991, 5061, 1109, -2448, -4674, -3775, -1641, -1354, -3094, -6746, -8641, -8066, -5039, -3235, -3379,
+    -5307, -7581, -7106, -3091, 905, 1982, 1364, -586, -506, 1416, 5079, 7579, 6894, 5339, 2788, 4168,
+    6298, 8164, 7117, 5159, 1925, 143, 690, 3304, 3219, 566, -2537, -5796, -5898, -3861, -2028, -3024,
+    -5828, -8418, -8128, -6238, -3542, -1971, -2967, -4478, -4856, -2984, 960, 3699, 3545, 1892, 512, 2025,
+    5306, 7994, 8482, 6785, 3552, 2195, 4176, 6562, 6782, 4531, 1024, -1962, -1837, -159, 1140, 123,
+    -3536, -6636, -7603, -6540, -3764, -3367, -5180, -7437, -8115, -6389, -2966, -84, -451, -2375, -3475, -2189,
+    915, 5326, 6092, 4725, 2590, 2453, 4440, 7907, 8500, 7701, 4382, 2415, 2668, 4596, 5495, 3995,
+    1187, -3092, -3997, -3031, -1040, -515, -3403, -6860, -8722, -7488, -4598, -2754, -3723, -5892, -7259, -6015,
+    -2759, 503, 1273, 316, -566, -965, 2287, 5648, 7446, 6369, 4405, 2773, 3523, 6390, 8827, 8216,
+    4059, 1317, 175, 1633, 3472, 3145, 225, -4069, -6170, -5545, -3541, -2648, -3833, -6246, -9109, -8572,
+    -5899, -2708, -2136, -3793, -5505, -4949, -2005, 1584, 3843, 3277, 1753, 1125, 2807, 5192, 7996, 9059,
+    5896, 3811, 2811, 5126, 7379, 6664, 3847, 831, -1847, -1266, 915, 1658, -95, -4535, -6829, -7792,
+    -5640, -3079, -2937, -5316, -7780, -8456, -6468, -2831, -383, -1282, -3108, -4056, -2061, 1923, 5099, 6330,
+    4521, 1903, 3001, 5047, 8618, 8747, 7065, 4044, 2383, 3090, 4945, 5417, 3811, 61, -3079, -3999,
+    -2207, -1265, -1268, -4165, -7375, -8515, -6913, -4347, -3133, -3218, -6210, -7047, -5743, -2849, 681, 1368,
+    221, -1482, -861, 2798, 5764, 7489, 6342, 3786, 3291, 5100, 6600, 8595, 7794, 4071, 1384, 461,
+    2227, 3830, 3025, -437, -4066, -5791, -4651, -2529, -1880, -3932, -6834, -9040, -7875, -5281, -2431, -2342,
+    -3618, -5631, -4606, -1958, 1679, 4099, 2922, 834, 1080, 2643, 5671, 8449, 7728, 5453, 3146, 3060,
+    4974, 7238, 6852, 3569, 662, -1084, -467, 1705, 1495, -939, -4615, -6538, -6997, -4909, -2742, -3064,
+    -6295, -8452, -8526, -5171, -2473, -327, -1786, -3504, -3715, -1817, 2947, 5277, 5458, 3386, 2154, 2717,
+    5213, 7809, 9195, 6070, 2798, 2251, 3191, 5505, 6367, 3830, -407, -2536, -3132, -1211, 6, -905,
+    -4311, -7369, -8599, -6850, -3660, -2770, -4189, -6738, -7463, -6026, -1592, 277, 1321, -925, -1843, 70,
+    2963, 5682, 6826, 5544, 3544, 2812, 4630, 7895, 8410, 7841, 3466, 1059, 961, 2775, 4531, 2726,
+    -1036, -4450, -5380, -4487, -1811, -2100, -4601, -7859, -8456, -7812, -4363, -2492, -2815, -4445, -5618, -4789,
+    -1573, 1553, 3634, 2020, -83, 587, 3081, 6339, 8131, 7217, 4343, 3494, 3917, 5808, 7821, 6819,
+    3611, 139, -753, -211, 1798, 1299, -702, -5419, -7469, -6113, -4262, -2584, -4081, -6030, -8653, -8030,
+    -5125, -2467, -1307, -2292, -4232, -3398, -707, 3065, 5806, 5129, 2957, 2230, 2542, 6361, 8638, 8558,
+    5913, 3022, 2741, 3635, 6309, 5507, 2802, -893, -2968, -2702, -973, -108, -2099, -4570, -7781, -8113,
+    -5987, -3687, -2985, -5413, -7746, -7996, -4653, -1249, 802, 317, -1060, -1832, -823, 3401, 6118, 6610,
+    5662, 3592, 3210, 5287, 8412, 9205, 6493, 2751, 1604, 1158, 2841, 4230, 2128, -1437, -4444, -4922,
+    -3289, -1746, -2222, -4974, -8156, -9022, -7269, -3523, -2460, -3292, -5129, -6435, -4841, -1301, 2452, 2872,
+    1697, -543, 624, 3739, 6946, 8916, 6814, 3912, 3857, 4409, 6662, 8610, 6811, 2928, 29, -763,
+    898, 2179, 1728, -2313, -5139, -7024, -5908, -3753, -2788, -3722, -6995, -8643, -7428, -4237, -1959, -1453,
+    -2776, -4270, -3569, -525, 3503, 5106, 3835, 2334, 1246, 3378, 7093, 8738, 8239, 5552, 2837, 2987,
+    4783, 6584, 6138, 2439, -1262, -2341, -1924, -503, 543, -2476, -5350, -8220, -7653, -4731, -3294, -3641,
+    -5525, -8013, -7071, -4122, -1237, 393, -870, -1533, -2626, 198, 3926, 6842, 6218, 4794, 2474, 3412,
+    5406, 8089, 8707, 6067, 2878, 1676, 2087, 4097, 4522, 1723, -1517, -4524, -4384, -2669, -1045, -2357,
+    -5288, -8146, -8702, -7021, -3395, -2858, -4035, -6121, -6278, -3601, -528, 2821, 2483, 1123, -640, 834,
+    3894, 7025, 7694, 6664, 4046, 3107, 4605, 7178, 8121, 5848, 2504, -401, -28, 1124, 2738, 1425,
+    -2361, -5503, -6502, -5150, -3134, -2842, -4623, -8222, -8699, -7416, -4062, -1630, -2048, -3604, -5130, -3941,
+    -194, 3927, 5643, 3491, 1862, 1280, 3715, 7267, 9241, 7032, 4452, 2905, 2978, 5152, 6628, 6012,
+    2293, -1390, -2143, -1323, 580, -349, -2954, -5555, -8146, -7654, -4689, -2871, -3625, -6189, -8147, -7271,
+    -4490, -1124, 398, -699, -2147, -3114, -141, 4380, 6649, 5961, 3919, 2514, 3830, 6530, 8699, 7954,
+    5390, 2678, 2006, 2817, 4785, 4583, 1220, -2198, -4483, -2911, -2781, -1480, -3389, -6085, -8642, -8453,
+    -5618, -3432, -2873, -4929, -6769, -6574, -3654, -501, 2945, 2105, 123, -685, 1327, 4519, 7014, 7500,
+    5345, 3521, 3156, 5437, 7488, 8385, 5676, 1936, -249, 24, 1975, 2936, 573, -2810, -6072, -6623,
+    -4503, -2666, -2667, -5260, -8201, -8942, -6148, -3543, -1682, -2256, -4271, -5174, -2146, 920, 4047, 4254,
+    2775, 1376, 1955, 4598, 7353, 8682, 7277, 3884, 3424, 3704, 5937, 6871, 5603, 1601, -1655, -1824,
+    -657, 755, -132, -2772, -6330, -7667, -7007, -3992, -3316, -3957, -6888, -8445, -6921, -4046, -474, 317,
+    -1813, -3027, -2098, 1219, 4213, 6062, 5762, 2882, 2510, 3643, 7208, 8576, 7848, 5241, 2307, 2146,
+    3477, 5298, 4139, 1595, -2390, -4413, -2988, -1766, -1469, -3152, -6421, -8422, -8313, -5255, -3178, -2912,
+    -5000, -6953, -6827, -3537, -48, 2006, 2207, -552, -1001, 2012, 4955, 7949, 7646, 5405, 3102, 3365,
+    5909, 8719, 8021, 4851, 1938, 53, 996, 2501, 3040, 913, -2881, -5917, -5970, -4016, -2305, -3013,
+    -6124, -8215, -8485, -6280, -2877, -1757, -2923, -4960, -5595, -2729, 701, 3678, 3861, 2424, 431, 2257,
+    5075, 7642, 9306, 6600, 3792, 2862, 4322, 6708, 7203, 5328, 1757, -1993, -1857, 517, 1048, -947,
+    -3555, -6775, -7510, -6687, -3485, -3282, -4647, -7554, -7881, -6841, -3414, -376, -669, -2036, -3328, -2211,
+    1501, 5390, 5892, 4511, 2692, 2948, 4698, 7637, 8971, 7806, 4523, 2167, 2320, 4876, 5281, 3842,
+    581, -2792, -3945, -2894, -814, -931, -2985, -6900, -8817, -7389, -4974, -2453, -2968, -5395, -7327, -6265,
+    -2785, 558, 1983, 364, -1170, -255, 1891, 5457, 7808, 6795, 4458, 2856, 4040, 6526, 8343, 8253,
+    4525, 1501, 909, 1359, 3191, 3203, -31, -3562, -5909, -5808, -3148, -1945, -3845, -6533, -8330, -8622,
+    -5715, -2695, -1915, -3471, -5210, -5634, -1616, 1391, 3692, 3386, 1421, 777, 2256, 5171, 7902, 8450,
+    5917, 3704, 2960, 4760, 6488, 7202, 4599, 1187, -1837, -1268, 429, 1238, -930, -3939, -7108, -7367,
+    -4832, -3904, -2719, -5628, -7933, -8583, -6354, -2670, -681, -712, -2857, -3555, -1556, 2149, 5653, 6016,
+    4321, 1862, 2936, 5593, 7801, 9323, 6673, 3772, 2078, 2703, 5146, 6039, 3903, 372, -2820, -3879,
+    -2175, -960, -1117, -4065, -7099, -8158, -6403, -4367, -3138, -3571, -5847, -7421, -5959, -2298, 1039, 1204,
+    366, -1745, -953, 2479, 5784, 8032, 6233, 3907, 2672, 4138, 7417, 9030, 7424, 4331, 1062, 592,
+    2591, 3490, 3175, -84, -3958, -5403, -4207, -3056, -1626, -3959, -7533, -9040, -8262, -5774, -2971, -2385,
+    -4132, -6217, -4731, -1959, 1294, 3900, 3130, 650, 651, 2392, 5983, 8429, 7760, 5335, 3265, 3049,
+    4676, 7402, 6653, 3952, 739, -1635, -542, 1128, 1195, -1153, -4444, -6924, -7100, -5297, -2950, -2969,
+    -5754, -8702, -8727, -5593, -1974, -1088, -2172, -3674, -3464, -1529, 1984, 5365, 5400, 3778, 1942, 3234,
+    5589, 8281, 8749, 6994, 3036, 2456, 2876, 5574, 6136, 3615, -871, -2827, -3791, -1496, -168, -1373,
+    -4542, -8047, -7972, -6252, -3616, -2426, -4653, -6778, -7619, -6159, -1309, 788, 1302, -539, -2028, -949,
+    2393, 6534, 7268, 5793, 3470, 3046, 4366, 7428, 8801, 6835, 3571, 1461, 791, 2936, 4368, 2932,
+    -496, -4187, -6222, -4312, -2427, -1759, -4330, -7763, -9113, -7901, -4676, -2977, -2852, -5024, -6474, -5357,
+    -1131, 1507, 2874, 2293, 531, 495, 2822, 6263, 8248, 7488, 4790, 3276, 3999, 6849, 7335, 6448,
+    3452, 196, -1123, -96, 2090, 1282, -902, -4782, -7531, -6901, -4354, -2902, -3448, -6234, -8452, -8238,
+    -4616, -2130, -1054, -2480, -3839, -3442, -1047, 2852, 5889, 5233, 3290, 1853, 2638, 6372, 8264, 8402,
+    5804, 3291, 2398, 3953, 6031, 6347, 2964, -193, -3405, -2973, -781, -210, -1472, -4770, -7813, -8899,
+    -5805, -4057, -3128, -5281, -7203, -7863, -5131, -1453, 558, 782, -1285, -1750, -386, 3787, 6575, 6811,
+    4966, 2702, 3904, 5062, 8037, 8859, 6532, 2828, 1326, 1605, 4108, 4060, 2188, -1021, -4733, -5025,
+    -3561, -1574, -2540, -5136, -7893, -9212, -7198, -4063, -2451, -3505, -4856, -6739, -4843, -561, 1651, 3348,
+    1880, 724, 439, 3524, 6402, 8108, 6959, 4267, 2553, 4018, 6511, 8072, 6593, 2749, 187, -596,
+    857, 1864, 1269, -1442, -5651, -7438, -6241, -3771, -2992, -4057, -7077, -8760, -7899, -4095, -1599, -880,
+    -2352, -4723, -3945, -509, 3394, 5476, 3957, 1962, 1732, 3238, 7009, 9525, 8839, 5159, 2408, 2885,
+    3869, 6849, 5884, 2294, -1033, -2707, -2198, -592, 354, -2184, -5690, -7663, -8202, -5296, -3182, -3593,
+    -5123, -7497, -7148, -4741, -1352, 375, -302, -2656, -1956, -167, 3802, 5930, 6578, 4458, 2027, 2998,
+    6399, 8553, 8270, 5884, 2499, 1177, 2346, 4280, 4251, 2391, -1725, -5379, -4898, -2444, -1617, -2693,
+    -5417, -8251, -9122, -6777, -3463, -2082, -3841, -5590, -6349, -4055, -928, 2052, 2936, 558, -257, 724,
+    4025, 7148, 7889, 6722, 3942, 2764, 4447, 6586, 8066, 6119, 2537, 83, -73, 1457, 2306, 1121,
+    -2050, -5564, -7103, -4948, -3293, -3036, -4994, -8064, -9035, -6923, -4367, -1429, -1887, -3350, -4823, -3568,
+    207, 3927, 4517, 3709, 1742, 1292, 3797, 7191, 8330, 7842, 4769, 2338, 3132, 5025, 7070, 5621,
+    2354, -1299, -2332, -1477, 441, 278, -2426, -6134, -7831, -7523, -4772, -3114, -3708, -6302, -8113, -7130,
+    -3803, -1354, 188, -839, -1872, -2349, 531, 4208, 6716, 5732, 3527, 2674, 4003, 6579, 8655, 8687,
+    5043, 2555, 982, 3096, 4751, 4261, 1638, -2134, -4491, -4382, -2510, -1218, -2469, -5891, -8760, -8659,
+    -5755, -3429, -2023, -4560, -6715, -6775, -4272, 414, 2941, 1665, 169, -570, 1193, 4657, 7482, 7765,
+    5169, 3642, 3494, 6036, 7395, 7539, 5683, 1928, 433, -313, 1949, 2908, 1108, -3076, -5441, -6069,
+    -4331, -2752, -2990, -5492, -7825, -9058, -6739, -3456, -1503, -1981, -4195, -5247, -3221, 137, 3921, 4217,
+    3222, 1563, 1637, 4656, 7741, 8615, 7210, 4266, 2933, 3377, 6156, 7506, 5670, 1476, -1401, -2444,
+    -884, 653, 474, -3619, -6909, -7927, -7177, -4517, -3009, -4537, -6473, -8869, -6803, -3545, -1045, 215,
+    -1499, -3128, -2149, 1054, 4465, 6805, 5519, 3158, 2215, 4214, 7271, 8871, 7506, 4455, 2276, 2629,
+    3973, 5675, 4233, 1206, -2548, -4689, -3746, -1169, -1381, -3555, -5969, -8768, -8591, -5002, -3078, -2942,
+    -4972, -6638, -6445, -3092, -89, 2354, 1563, -153, -1108, 1250, 4977, 7598, 7072, 5430, 2992, 2979,
+    5587, 7845, 7387, 5475, 1581, -114, 375, 3032, 2923, 908, -3104, -5630, -6460, -3802, -2764, -3239,
+    -5809, -8393, -9064, -6542, -3142, -1632, -3216, -4988, -5477, -3420, 790, 3801, 3955, 2758, 925, 1897,
+    5336, 8183, 8717, 5878, 3861, 3316, 3796, 6295, 6917, 4665, 1376, -1487, -2119, -18, 841, -29,
+    -2535, -7014, -7630, -5611, -3793, -3537, -4909, -7012, -8344, -6315, -3050, -584, -41, -2514, -3059, -2653,
+    1623, 5008, 5898, 4649, 2601, 2089, 4750, 7281, 9078, 7023, 4753, 2128, 1878, 3836, 5374, 4788,
+    808, -2915, -3555, -2409, -1144, -1070, -3614, -6693, -8201, -7835, -4716, -3152, -3107, -5788, -7127, -6734,
+    -2704, 658, 2285, 501, -951, -1085, 2149, 5299, 7949, 6811, 4360, 2867, 3639, 6671, 8040, 7249,
+    4654, 1685, 841, 2123, 2853, 3196, 245, -4086, -5917, -4814, -3032, -2650, -3981, -6996, -8925, -8327,
+    -5696, -2717, -1762, -3337, -5506, -5462, -2818, 1775, 3523, 3363, 1739, 677, 1959, 6093, 8206, 9071,
+    6339, 2819, 2388, 5022, 7044, 6773, 4589, 1147, -2344, -653, 644, 1367, -616, -3803, -6925, -6855,
+    -5379, -3356, -3001, -5881, -7810, -8301, -5532, -2326, -455, -1043, -2924, -3961, -2049, 1716, 4620, 5891,
+    4248, 2339, 2810, 5005, 8447, 8826, 6884, 3470, 2450, 2883, 4975, 6055, 3934, 147, -2678, -3701,
+    -1994, -606, -713, -4148, -7266, -9253, -6840, -4314, -3000, -4443, -6175, -7260, -5793, -1843, 617, 887,
+    -95, -1296, -733, 2362, 6092, 7162, 6506, 4297, 2963, 4303, 7376, 8823, 7937, 4052, 1405, 670,
+    1834, 3711, 2592, -525, -4047, -5613, -4585, -2639, -1702, -4129, -7257, -8933, -7827, -5247, -2739, -2291,
+    -4368, -5515, -5219, -2084, 1317, 3360, 3008, 909, 437, 2745, 6839, 8432, 7621, 5248, 3232, 2952,
+    5135, 7370, 7172, 4074, 489, -1476, -1413, 807, 1273, -811, -4717, -7433, -7218, -5651, -2865, -3516,
+    -6206, -8435, -7991, -5421, -2696, -670, -1569, -3715, -3632, -1447, 2664, 5501, 5274, 3350, 1959, 2382,
+    5961, 8279, 9099, 6303, 2711, 2162, 3176, 5544, 5222, 3429, 304, -2852, -3500, -1072, -293, -1852,
+    -3929, -7345, -8289, -6131, -3650, -2482, -4904, -6422, -7851, -6021, -1893, 1501, 1085, -813, -1983, 9,
+    2752, 5893, 7096, 5448, 3378, 2091, 4530, 7285, 8792, 7096, 3702, 1394, 695, 3123, 4229, 2815,
+    -1150, -4446, -5600, -4411, -2238, -1481, -4738, -8197, -9389, -8138, -4777, -2729, -2130, -4804, -5629, -4713,
+    -2063, 1914, 2894, 2066, 979, 385, 3331, 6125, 8337, 8073, 4444, 3151, 3289, 6025, 7364, 7307,
+    2935, -100, -1001, 65, 1274, 1352, -1274, -5092, -7266, -6438, -4645, -2677, -4259, -7066, -8523, -8079,
+    -5624, -2071, -586, -2555, -3838, -4090, -986, 3015, 5794, 5225, 3149, 1485, 3307, 6653, 8668, 8427,
+    6128, 2705, 2615, 4597, 5856, 5965, 2214, -320, -2565, -3189, -722, -524, -1471, -5740, -7898, -7648,
+    -6009, -3435, -2824, -5212, -8265, -7771, -5098, -1063, 651, -249, -1631, -2294, -261, 3480, 6592, 6605,
+    5152, 2572, 3393, 5249, 8000, 8728, 6513, 2540, 686, 1356, 2932, 5073, 2571, -2044, -4276, -5140,
+    -3523, -1403, -2491, -5293, -7866, -8959, -7320, -4709, -2571, -3083, -5230, -6289, -5082, -839, 2215, 3350,
+    1556, 195, 619, 2910, 6981, 8178, 6955, 4213, 2926, 4368, 6572, 8493, 6177, 2676, 91, -618,
+    641, 2351, 1159, -1770, -5893, -6785, -6354, -3610, -3174, -4489, -6984, -9087, -7805, -4718, -1501, -1296,
+    -2462, -4283, -3933, -544, 3044, 4778, 4382, 2736, 1589, 3333, 6456, 8605, 8105, 5297, 2763, 2524,
+    4676, 6478, 6048, 2632, -706, -3105, -2447, -342, -232, -2508, -5568, -7440, -7470, -5502, -3346, -3039,
+    -5186, -7682, -7687, -4079, -1375, 1056, -418, -2017, -2304, -111, 4270, 6551, 6814, 4473, 2931, 3097,
+    5896, 8714, 8290, 5891, 3327, 948, 2224, 4123, 4743, 3053, -1916, -4845, -4761, -2770, -1476, -2499,
+    -5981, -8532, -8673, -6523, -3865, -3087, -3633, -5955, -7250, -3837, -634, 2513, 2662, 1433, -750, 838,
+    4412, 6641, 7862, 5887, 3789, 3199, 4475, 7164, 7497, 6317, 2822, -239, -454, 1600, 2959, 1169,
+    -2382, -5650, -6603, -5170, -2938, -2348, -5022, -7216, -9171, -7381, -3658, -1577, -2430, -3890, -5458, -3673,
+    23, 3428, 4839, 3575, 1877, 1427, 4115, 6902, 9126, 7745, 4896, 3454, 2969, 5450, 7308, 5559,
+    2788, -1408, -2738, -1336, 43, 406, -2599, -5592, -8224, -6835, -4539, -2480, -3269, -6651, -7942, -7653,
+    -3812, -981, 586, -383, -2461, -2329, 620, 3949, 6555, 6008, 3975, 2660, 3996, 6710, 8499, 8389,
+    5573, 2100, 1326, 2975, 4590, 4116, 1816, -2130, -5001, -4484, -2223, -1093, -3498, -6439, -8601, -8741,
+    -5716, -3569, -2546, -4756, -6811, -6146, -4050, 23, 2788, 1646, -45, -662, 1217, 4172, 7369, 8218,
+    6296, 3967, 3546, 5449, 7373, 8547, 4959, 1505, -420, -97, 2295, 2778, 655, -2658, -5445, -6219,
+    -4345, -2348, -3099, -5839, -7617, -8545, -6096, -3729, -1695, -2161, -3783, -5157, -3386, 771, 4023, 4524,
+    2502, 1385, 2246, 4124, 7788, 8850, 6843, 4250, 2725, 3957, 5953, 7312, 5368, 1445, -1922, -2416,
+    -915, 236, -130, -2552, -6789, -8126, -6994, -4055, -3288, -4496, -6715, -8545, -6906, -3849, -561, 389,
+    -1434, -2306, -1978, 750, 4495, 6112, 5379, 3608, 2157, 4454, 7136, 8875, 8413, 4691, 1993, 1786,
+    3602, 5098, 4551, 637, -2468, -4343, -3553, -1661, -823, -2895, -6355, -8302, -8536, -5524, -3216, -3007,
+    -5328, -6931, -6048, -3460, 172, 1559, 1557, -749, -794, 1960, 5291, 7273, 7753, 4711, 3070, 3351,
+    5604, 7787, 7683, 4999, 1929, -213, 963, 3100, 3318, 862, -3253, -5849, -6532, -3780, -2595, -2799,
+    -6586, -8388, -8762, -6624, -2670, -1520, -3247, -4523, -5454, -2902, 578, 3728, 4363, 1980, 1649, 2007,
+    5030, 7899, 8404, 7124, 3437, 3194, 4184, 6066, 7375, 4790, 992, -1278, -1758, 153, 1421, 54,
+    -3434, -6991, -7678, -6206, -3644, -3505, -4525, -7816, -8828, -6491, -2792, -715, -401, -2352, -3404, -1761,
+    1717, 4635, 6107, 4110, 2802, 2268, 4533, 7451, 8972, 7422, 4849, 1857, 2455, 4195, 4773, 4475,
+    217, -3029, -3927, -3271, -962, -1349, -3745, -6702, -9177, -7407, -4979, -2904, -3487, -5528, -6863, -6147,
+    -3047, 808, 2070, 744, -1198, -666, 2072, 5334, 7399, 7252, 4650, 2671, 4683, 6923, 8254, 7606,
+    4811, 1199, 240, 1958, 3193, 2707, 209, -3656, -5761, -5334, -3162, -2009, -3332, -6155, -8463, -8537,
+    -5752, -2109, -1282, -3137, -4624, -5374, -2967, 1120, 3433, 3517, 1345, 397, 2002, 5581, 7974, 7844,
+    5613, 3158, 3127, 5015, 7134, 7392, 4269, 288, -1488, -800, 677, 1488, -706, -3841, -6944, -7303,
+    -5517, -2961, -2840, -5664, -7748, -9111, -6247, -2768, -724, -1221, -2948, -3209, -1579, 2150, 5094, 5287,
+    4235, 2650, 3341, 4903, 8197, 9409, 6957, 4097, 2133, 2439, 4912, 6148, 4058, 203, -2908, -3827,
+    -2276, -667, -1409, -4016, -7371, -8918, -6990, -4054, -3477, -3865, -5909, -7282, -6182, -2556, 1046, 1459,
+    -142, -2209, -491, 2720, 5802, 7460, 6699, 3993, 2608, 4253, 7160, 8675, 7845, 3827, 971, 871,
+    2338, 3764, 3065, -520, -3978, -5985, -5008, -3297, -2260, -3853, -7089, -8862, -8252, -5022, -2858, -2523,
+    -4047, -5923, -4475, -1560, 2189, 3510, 1995, 1126, 524, 2272, 5847, 8708, 8198, 4982, 3632, 3191,
+    5421, 7386, 7246, 3784, 168, -1158, -676, 1453, 1540, -1067, -4179, -7123, -7302, -4668, -2790, -3426,
+    -5555, -8606, -8478, -4923, -2479, 78, -1692, -3184, -4076, -2004, 2341, 5646, 5071, 3873, 2079, 2763,
+    5140, 8282, 9211, 6472, 3653, 2531, 3549, 5293, 5985, 3685, 144, -2842, -3128, -2144, -478, -915,
+    -4737, -8067, -8108, -6479, -4084, -2935, -4662, -6212, -7163, -5832, -1752, 838, 1456, -666, -1950, -710,
+    3136, 6711, 7238, 5359, 3441, 2621, 4429, 7383, 9249, 6905, 3121, 1232, 1476, 2527, 4041, 2617,
+    -575, -5273, -5042, -4508, -1645, -2389, -4303, -7508, -8859, -7670, -4874, -1996, -2886, -4776, -6221, -5017,
+    -1359, 2016, 3266, 2610, 708, 17, 3397, 6562, 8611, 7368, 4885, 2998, 3653, 5773, 8251, 6162,
+    3796, -188, -1572, -72, 1510, 1678, -1140, -5167, -7413, -5996, -4097, -2572, -3482, -6628, -8033, -7787,
+    -4939, -2669, -1039, -2057, -3837, -3927, -181, 2549, 4665, 4536, 2954, 1543, 2735, 5611, 8168, 8583,
+    5743, 3492, 1934, 3734, 5536, 6276, 2976, -860, -2773, -2897, -758, -231, -1653, -4898, -8039, -7795,
+    -5778, -3811, -3567, -5082, -7673, -7448, -4808, -1719, 854, 543, -1603, -1864, -329, 3400, 6255, 6732,
+    5147, 3041, 3483, 5281, 8017, 8921, 6708, 3239, 1417, 1757, 3480, 4331, 2525, -1200, -4086, -5356,
+    -3355, -1943, -2341, -5081, -8349, -8496, -7602, -4288, -2768, -3608, -5767, -6253, -4524, -276, 2230, 3286,
+    1704, 526, 969, 3937, 7027, 8458, 6520, 3675, 2781, 4491, 6802, 7834, 6749, 2703, -158, 271,
+    1319, 2069, 1823, -1699, -4979, -7123, -6383, -3768, -2929, -4462, -7346, -9065, -7571, -4827, -1776, -1473,
+    -2772, -4270, -3523, -540, 2851, 4988, 4559, 2142, 1536, 4027, 6903, 8857, 7940, 5251, 2795, 3185,
+    4543, 6492, 5361, 3175, -1195, -2841, -2110, -214, -97, -2209, -5744, -8143, -7121, -5390, -3045, -3393,
+    -5856, -8049, -7645, -5308, -1656, 663, -6, -1876, -2216, 43, 3802, 6291, 6163, 4469, 2673, 3293,
+    5824, 9175, 8197, 6107, 2751, 628, 2381, 4158, 3916, 1782, -1599, -4196, -4679, -3007, -1353, -2027,
+    -5491, -8039, -8669, -6032, -4041, -2505, -3824, -5942, -6289, -4098, -735, 2160, 2123, 1249, -300, 1171,
+    3987, 6955, 7987, 6420, 3701, 3392, 5041, 7047, 8018, 6224, 2649, -339, -213, 1665, 2705, 1543,
+    -2331, -5986, -6844, -5314, -3260, -2419, -4917, -7914, -8874, -7199, -4454, -1249, -2630, -3835, -5129, -3540,
+    -100, 4046, 5303, 3371, 1683, 1498, 4204, 7432, 9096, 8171, 4774, 2861, 3075, 6194, 6510, 5789,
+    1965, -1413, -2255, -1358, 401, 92, -2502, -6316, -8188, -7136, -4895, -3102, -3560, -6522, -7534, -6919,
+    -4183, -625, 591, -1384, -2395, -1772, 813, 4372, 6361, 5852, 4084, 2107, 3813, 6623, 8477, 8579,
+    5210, 2582, 1940, 3434, 5074, 4998, 1102, -2068, -4802, -3918, -2008, -1076, -2974, -5895, -8195, -8425,
+    -6141, -3548, -2698, -4472, -5913, -7035, -3941, -24, 2666, 2438, 694, -916, 1022, 4639, 7242, 8039,
+    6075, 3517, 2809, 5805, 7741, 8343, 5192, 1496, 430, 172, 1989, 3272, 1072, -3090, -5866, -6372,
+    -4453, -2141, -3065, -5225, -8021, -9508, -6985, -3905, -1559, -2224, -3939, -5590, -3390, 772, 3815, 4286,
+    2802, 1610, 1879, 4547, 7610, 8928, 6994, 4588, 2211, 3852, 6285, 6738, 5006, 2019, -1349, -2062,
+    -751, 711, 210, -3407, -6707, -8749, -6787, -3757, -3310, -4521, -6603, -8168, -6780, -3434, -612, -678,
+    -1267, -3663, -2042, 1289, 5267, 6327, 6020, 3103, 2445, 4050, 6823, 9071, 7943, 4794, 2710, 1616,
+    2865, 4978, 4418, 623, -2231, -4725, -2809, -1417, -1078, -3455, -6338, -8472, -7689, -5543, -3406, -2496,
+    -5495, -7182, -6479, -2921, 551, 2174, 1640, -707, -285, 1612, 4592, 7952, 7821, 5156, 3474, 3366,
+    5847, 8174, 7758, 5517, 1946, -171, 697, 3056, 2777, 95, -3331, -6113, -5628, -3855, -2971, -2914,
+    -5919, -8702, -8172, -6188, -2997, -1859, -2750, -4724, -5171, -2872, 1211, 3484, 3395, 2168, 1083, 2179,
+    5167, 7757, 8886, 6618, 3826, 2664, 4310, 6212, 7108, 4653, 1369, -1311, -1494, 114, 1268, -583,
+    -3060, -6715, -7919, -5726, -3562, -3053, -4683, -8183, -8474, -6503, -3223, -451, 104, -2397, -4120, -2323,
+    1362, 5337, 6212, 4549, 2767, 2160, 4873, 8098, 9585, 7049, 3686, 2201, 1756, 4272, 5962, 4511,
+    730, -3136, -3963, -2766, -1313, -1066, -4032, -6739, -8556, -7871, -4716, -2459, -3695, -6084, -7283, -6171,
+    -2936, 448, 2062, 333, -677, -417, 1726, 5929, 8190, 6846, 4210, 2400, 3692, 6816, 8123, 7592,
+    4944, 1456, 356, 1240, 3366, 3421, -71, -3428, -6051, -5013, -3389, -2158, -3506, -6964, -9047, -8394,
+    -5803, -2655, -2049, -3895, -5413, -5758, -2542, 1285, 4264, 3698, 1740, 1044, 1989, 5438, 8561, 8641,
+    5918, 3430, 3208, 4851, 6052, 7638, 4627, 225, -1431, -1132, 1019, 1359, -660, -4196, -6892, -7649,
+    -5208, -3830, -3375, -5228, -8079, -8834, -5354, -2964, -928, -1641, -2792, -3555, -1815, 1887, 4815, 5262,
+    4449, 2448, 2763, 5535, 7450, 9152, 6878, 3764, 2379, 3066, 4875, 5683, 4203, 96, -3072, -3661,
+    -2047, -454, -851, -4560, -7975, -8737, -7706, -4215, -2777, -3678, -6544, -7174, -5832, -2263, 453, 1118,
+    419, -1630, -763, 2278, 6058, 7187, 6560, 3789, 2619, 4783, 7105, 8554, 7671, 4214, 802, 338,
+    2626, 4128, 3178, -168, -4261, -5743, -5081, -2640, -1842, -3611, -6970, -9531, -8056, -4484, -2078, -2116,
+    -3789, -6087, -4752, -1992, 1853, 3427, 2470, 1227, 639, 2317, 5981, 8489, 7678, 5195, 2966, 3202,
+    5212, 7395, 7189, 4254, 451, -1658, -429, 1480, 1339, -1244, -4524, -7062, -7441, -5234, -2944, -3179,
+    -6009, -8780, -8808, -5115, -2044, -444, -1412, -3538, -3421, -1290, 2637, 5500, 5653, 3565, 1641, 3050,
+    5810, 8231, 8864, 6184, 3927, 2291, 3353, 5174, 5832, 3379, -132, -3076, -3150, -1392, -588, -1363,
+    -4589, -7850, -8360, -6802, -3844, -2691, -4468, -7069, -7261, -5567, -1852, 1048, 1199, -824, -1782, -740,
+    2760, 6465, 6956, 5691, 3804, 3267, 5330, 7661, 9075, 7001, 3822, 1076, 1208, 2361, 4218, 3053,
+    -876, -4317, -5220, -4495, -2349, -2066, -4792, -6974, -9678, -7755, -4856, -2539, -2800, -4930, -5959, -4870,
+    -1294, 1522, 3293, 1762, 675, 157, 3506, 6450, 8476, 7822, 4502, 2900, 3988, 5657, 7320, 6740,
+    3771, -252, -868, 251, 1733, 1373, -1927, -5014, -7111, -6525, -3712, -3106, -3454, -6479, -8845, -8082,
+    -5604, -2032, -1136, -2063, -4110, -3606, -1008, 3606, 5398, 4768, 2837, 1411, 2820, 6143, 8399, 8042,
+    5839, 3223, 2555, 3389, 5420, 5812, 3052, -679, -2778, -2569, -743, -644, -1528, -4976, -7702, -7926,
+    -5927, -3432, -3164, -5290, -7254, -7889, -5252, -1489, 817, 509, -1085, -2065, -568, 3229, 7015, 6712,
+    5146, 3116, 3563, 5046, 8150, 8534, 6204, 2726, 799, 1765, 3691, 5073, 2378, -1342, -4220, -4471,
+    -3683, -2075, -2198, -4878, -7963, -9290, -7875, -3915, -2354, -3627, -5341, -6639, -4608, -1382, 2068, 3139,
+    1302, -117, 251, 3057, 6788, 7797, 6484, 3731, 3286, 4193, 6756, 7716, 6562, 2897, 24, -607,
+    1017, 2701, 1137, -1865, -5524, -7677, -5565, -3406, -3109, -4834, -7094, -9407, -7620, -4185, -1594, -1155,
+    -3227, -5262, -3968, -285, 2966, 4366, 4374, 2123, 1667, 3365, 7008, 9017, 8669, 5540, 2537, 2640,
+    4514, 5956, 5947, 2328, -995, -2731, -1803, -462, -232, -2243, -5733, -8082, -7548, -4745, -2889, -3387,
+    -6015, -7483, -7404, -4542, -1103, 543, -373, -1477, -2216, -74, 3717, 6608, 6552, 4305, 2707, 3440,
+    6056, 8292, 8393, 6225, 2117, 1526, 2463, 4293, 4048, 2264, -1942, -4378, -4396, -2645, -1787, -2464,
+    -5492, -8331, -9024, -6537, -3687, -2256, -4109, -6455, -6288, -4321, -1016, 1874, 2493, 1071, 87, 998,
+    3967, 7525, 8837, 6543, 4188, 3265, 5035, 7464, 8028, 6321, 2429, -23, -218, 1237, 2333, 1097,
+    -2337, -5727, -7137, -5152, -3041, -2804, -4743, -7553, -8820, -7200, -3642, -1564, -1618, -3728, -4410, -3485,
+    246, 3562, 5486, 3253, 1766, 1699, 3695, 7638, 9158, 7522, 4528, 2449, 3272, 5359, 6628, 6163,
+    1979, -1622, -2387, -1628, 221, 259, -2438, -5812, -8103, -7544, -4683, -2955, -4241, -6615, -7725, -7007,
+    -4699, -802, 376, -399, -2320, -2118, 457, 3766, 6653, 6475, 3914, 2637, 3525, 6557, 8767, 8480,
+    5917, 2356, 1601, 2668, 3930, 4666, 1439, -2256, -4531, -3994, -2116, -1580, -2535, -5818, -8307, -8222,
+    -6112, -3459, -2929, -4133, -6545, -6459, -3617, -119, 2187, 1749, -72, -285, 1162, 4567, 7343, 7920,
+    5664, 3429, 3301, 5609, 7996, 8168, 5331, 2523, -197, -133, 2188, 2262, 843, -2516, -6678, -5954,
+    -4572, -2433, -2835, -5252, -7986, -8632, -6536, -3919, -1873, -2288, -4179, -5444, -3089, 1027, 3879, 5141,
+    3144, 990, 1878, 4475, 7766, 9366, 7247, 4258, 2961, 3915, 5708, 6792, 5828, 1480, -1565, -2423,
+    -339, 891, -522, -2912, -6283, -8261, -7235, -3963, -3355, -4412, -6784, -8255, -6520, -3543, -811, -402,
+    -1288, -2782, -3197, 1066, 4549, 6459, 4776, 3373, 2321, 4014, 7248, 9134, 8154, 4878, 2717, 1862,
+    4040, 4947, 4408, 1433, -2490, -3975, -3851, -1348, -1287, -3285, -6362, -8370, -7884, -5677, -3328, -2898,
+    -5591, -6651, -7047, -3352, 542, 2280, 1559, -174, -760, 1548, 5053, 7183, 7708, 5302, 3281, 3660,
+    6291, 8211, 7602, 5415, 1902, 36, 1058, 2658, 2943, 357, -2828, -6188, -5768, -4194, -2304, -2994,
+    -6342, -8842, -8466, -6615, -2734, -1910, -2633, -4689, -4897, -2906, 948, 3742, 4013, 2294, 881, 1889,
+    4898, 8029, 8710, 6311, 4239, 2907, 3900, 7006, 7248, 5488, 1196, -1565, -1606, -299, 1486, -328,
+    -3346, -6883, -7726, -6032, -3489, -3599, -4591, -6999, -8360, -6710, -2843, 63, -755, -1744, -2969, -2278,
+    1831, 4910, 6247, 4864, 2574, 2724, 4303, 7669, 8695, 7371, 4806, 1872, 2494, 4376, 5840, 4411,
+    1161, -2465, -3985, -3475, -1252, -1131, -3646, -7120, -9062, -8187, -4480, -3295, -2816, -5925, -7170, -6153,
+    -3040, -161, 1388, 706, -460, -766, 2407, 6121, 7555, 6698, 4222, 3112, 3707, 6468, 8789, 7521,
+    4491, 1506, 279, 850, 3359, 3244, -29, -3368, -6001, -5529, -3438, -2030, -3706, -6665, -8621, -9027,
+    -5484, -2971, -2160, -3642, -5106, -4993, -2293, 1230, 4309, 3363, 1175, 649, 1834, 5028, 8073, 8251,
+    5836, 3504, 3336, 4132, 6660, 6555, 4453, 489, -1971, -1072, 376, 1553, -314, -4179, -6572, -7166,
+    -5595, -3177, -3213, -4755, -7865, -8565, -7054, -2709, -996, -1082, -3068, -3461, -823, 2038, 5046, 6055,
+    4225, 2007, 2238, 5061, 8350, 9226, 7563, 3671, 2426, 2571, 4466, 5078, 4062, 32, -3002, -3808,
+    -1844, -713, -1633, -3981, -6838, -9104, -7366, -4070, -3051, -3947, -5860, -7500, -6338, -2096, 582, 1554,
+    -208, -1876, -327, 2573, 5638, 7402, 6622, 3580, 3125, 4341, 7330, 8079, 7713, 3900, 1090, 547,
+    1790, 3550, 3110, -31, -4033, -6237, -4641, -2590, -1528, -4474, -7341, -8762, -8161, -4586, -2387, -2040,
+    -3903, -5756, -4873, -1787, 1623, 3583, 3115, 1182, 181, 2375, 6087, 8337, 7647, 5484, 3169, 3198,
+    5421, 7200, 6972, 4498, 174, -2180, -767, 1170, 1323, -1270, -4387, -7023, -6934, -4194, -3071, -3775,
+    -6010, -8410, -8248, -5620, -2426, -875, -1882, -3327, -3760, -795, 2734, 5125, 5708, 3205, 2243, 2785,
+    5543, 8075, 8613, 6683, 3007, 2114, 3157, 5298, 6078, 3389, -193, -2862, -2755, -1526, 54, -1182,
+    -4658, -7903, -8742, -6452, -3302, -2949, -4900, -6890, -7432, -6709, -2481, 513, 1400, -672, -1888, -693,
+    3169, 5555, 7446, 6150, 3285, 2996, 5071, 8375, 9174, 6851, 3169, 904, 932, 2875, 3515, 2553,
+    -1096, -4462, -5588, -4111, -1908, -2150, -4643, -7528, -9425, -7554, -4689, -2436, -3108, -5117, -6024, -4399,
+    -879, 2392, 3453, 2629, 230, 1147, 3465, 6408, 8823, 7376, 5481, 3086, 3656, 6042, 7097, 7001,
+    3656, 62, -1339, 307, 1708, 1301, -1424, -4856, -6745, -5965, -3795, -2844, -3583, -6651, -8891, -8413,
+    -4722, -2082, -833, -2106, -4487, -3354, -629, 3106, 5251, 4813, 3028, 1558, 3467, 6018, 8554, 8161,
+    5742, 3004, 2424, 4255, 6216, 5780, 3520, -923, -2823, -2524, -1161, -24, -2071, -4691, -7916, -7850,
+    -5938, -3630, -3224, -4810, -7995, -7311, -4900, -1406, 1058, 553, -1485, -2025, -118, 3616, 6616, 6905,
+    5392, 2823, 3417, 5400, 7933, 8992, 6505, 3300, 1251, 1416, 3238, 4404, 2320, -1213, -3848, -5109,
+    -3693, -1638, -2336, -5018, -7890, -8833, -7010, -3969, -2941, -3595, -5200, -6324, -4844, -1370, 2328, 2746,
+    1754, -171, 988, 2822, 6450, 8389, 6656, 4231, 2948, 3723, 6846, 8178, 5993, 3036, 215, -757,
+    587, 2415, 1546, -1639, -4745, -7152, -6070, -3770, -2902, -4585, -7086, -9237, -8069, -4406, -2207, -1390,
+    -3065, -4831, -3662, -889, 3188, 5191, 4272, 1978, 1816, 3325, 7113, 8505, 8686, 5657, 2810, 2430,
+    3979, 6518, 6084, 2923, -676, -3049, -2474, -296, 406, -2146, -5740, -8474, -8232, -5177, -4177, -2986,
+    -5696, -8205, -6642, -4365, -1077, 1309, -243, -1940, -2465, 63, 3961, 6503, 6782, 4708, 2743, 3018,
+    6454, 8499, 9044, 6358, 2487, 1260, 2558, 4123, 4262, 1637, -2383, -4402, -4828, -2429, -1797, -2760,
+    -4584, -8045, -8846, -6430, -3575, -2391, -3785, -5989, -6546, -4537, -97, 2447, 2255, 1054, -486, 966,
+    4071, 7471, 7884, 6389, 3977, 2481, 4558, 7229, 8100, 5960, 2992, -13, -469, 1270, 2718, 1261,
+    -2437, -5604, -6869, -5137, -3265, -2771, -4835, -7665, -9210, -7497, -3501, -1956, -2100, -3369, -4905, -3763,
+    227, 3737, 4939, 3171, 1706, 1445, 3898, 6964, 9043, 7535, 5174, 2190, 3640, 5372, 6846, 5538,
+    1904, -1190, -2965, -1032, 414, -107, -2755, -6271, -8679, -7417, -4485, -3187, -3557, -6015, -8616, -7327,
+    -4113, -650, 721, -929, -2341, -2364, 503, 4181, 6092, 5948, 4045, 3032, 3960, 6397, 8454, 7942,
+    4992, 2190, 1172, 3238, 4020, 4360, 1031, -1844, -4770, -4033, -2627, -1545, -2799, -6476, -8357, -8506,
+    -5176, -3456, -2838, -4087, -6177, -6492, -3749, 128, 2734, 1956, 324, -686, 1294, 4924, 7392, 7258,
+    5754, 3133, 3146, 4875, 7502, 7972, 5810, 2422, -599, 498, 2083, 2651, 1345, -2836, -6159, -6307,
+    -4990, -3090, -2045, -5164, -8428, -9453, -6840, -3688, -1476, -2120, -4357, -4678, -3748, 626, 3724, 4364,
+    3160, 1796, 1631, 4655, 7765, 8592, 7287, 4469, 2607, 4091, 6190, 7439, 5458, 1661, -1583, -1981,
+    -953, 405, -638, -2690, -5876, -8129, -6721, -3991, -3116, -4121, -7010, -8390, -6793, -3341, -1066, -419,
+    -1321, -2354, -1923, 1437, 4126, 6402, 5448, 3562, 2531, 3951, 7197, 8602, 8685, 5011, 2197, 1575,
+    3889, 4830, 4418, 1406, -2682, -4249, -3718, -1517, -1404, -2987, -6643, -8937, -7946, -5347, -3090, -2857,
+    -5117, -7108, -6506, -3526, 397, 2178, 1174, -1008, -838, 1781, 4883, 7143, 7612, 4838, 3131, 3604,
+    6157, 8459, 7811, 5003, 1654, 60, 829, 2833, 3330, -15, -3154, -5852, -5643, -3900, -2356, -3038,
+    -5979, -8309, -8676, -6487, -3299, -2130, -2376, -4144, -5616, -2847, 805, 3985, 4195, 2006, 624, 1782,
+    5002, 8907, 8996, 6325, 3785, 2395, 4083, 6663, 7436, 5072, 981, -1671, -1346, -39, 1668, -144,
+    -3004, -6739, -7712, -6760, -3639, -2794, -4934, -7013, -8557, -6825, -3280, -683, 2, -2131, -3856, -1872,
+    1930, 4661, 5850, 4478, 2997, 2265, 4474, 7912, 9017, 7528, 4746, 1847, 2410, 4354, 5743, 4259,
+    927, -2852, -3766, -2711, -1205, -1406, -3988, -6816, -9039, -7529, -4939, -2715, -3699, -5695, -7140, -5906,
+    -2943, 1017, 1879, 1174, -1462, -961, 1705, 6416, 7311, 6828, 4283, 3193, 4159, 6841, 8448, 7940,
+    4860, 1627, 409, 1518, 3703, 3055, 112, -3504, -6090, -5498, -3160, -2733, -3321, -6561, -9161, -8443,
+    -5739, -2474, -2018, -3308, -5471, -5103, -2613, 1135, 3400, 3522, 1669, 1089, 1915, 5509, 8511, 8687,
+    5926, 3268, 2960, 4503, 6704, 7166, 4601, 913, -1814, -1157, 845, 2027, -762, -3636, -6658, -7971,
+    -5285, -2922, -3461, -5232, -7692, -8489, -5836, -2377, -569, -1151, -2611, -3820, -2280, 1839, 5515, 6013,
+    3826, 2356, 2688, 4851, 8280, 8509, 7108, 3616, 1782, 2856, 5248, 5446, 3481, 96, -3250, -3584,
+    -2398, -1209, -760, -4080, -7092, -8577, -7095, -4948, -3046, -3816, -6166, -7709, -5511, -2521, 571, 1589,
+    698, -1525, -740, 2931, 6092, 7585, 6661, 3782, 2936, 4497, 6997, 8317, 7451, 4008, 674, 728,
+    2080, 3290, 2737, -314, -3720, -5572, -4132, -2312, -2487, -4010, -7184, -8804, -8148, -5268, -2692, -2125,
+    -3917, -5358, -5402, -1992, 1829, 3224, 2942, 1173, 567, 3105, 6344, 7867, 7612, 5616, 3684, 3147,
+    5276, 7301, 7155, 4211, 184, -1360, -713, 1326, 1155, -621, -4312, -6868, -6569, -4801, -3381, -2849,
+    -5873, -8900, -8810, -5634, -1900, -426, -951, -3342, -3882, -1506, 2437, 5055, 4953, 2956, 1024, 3043,
+    5377, 8241, 8536, 6303, 3565, 1713, 3244, 5085, 6020, 3544, -118, -2650, -3350, -1004, -635, -1222,
+    -4855, -8058, -8744, -6338, -4168, -3220, -4635, -7255, -7680, -5194, -1739, 414, 541, -427, -1737, -636,
+    2631, 6304, 7660, 5951, 3490, 3047, 4864, 7572, 8540, 7388, 3506, 1311, 1092, 2861, 4013, 3026,
+    -815, -4316, -4892, -4228, -2255, -1973, -4051, -7349, -8545, -7715, -5018, -2527, -2369, -4762, -6462, -5216,
+    -1369, 1782, 3856, 1910, 493, 197, 2960, 6316, 8103, 7249, 4329, 3135, 3757, 6101, 8060, 6500,
+    3714, 36, -1152, 382, 1895, 1879, -1297, -4933, -7249, -6077, -4766, -2922, -3485, -6086, -8469, -7675,
+    -4772, -2361, -953, -2316, -3979, -4057, -722, 2587, 5155, 4714, 3172, 1880, 3243, 6637, 8630, 8363,
+    5414, 2948, 2279, 4450, 5567, 5930, 3327, -837, -2741, -2505, -1211, 237, -1394, -4885, -7951, -8635,
+    -5590, -4442, -3360, -4881, -7379, -7078, -4658, -1544, 715, 565, -1388, -1473, -321, 2962, 6755, 6944,
+    5272, 3182, 2909, 5186, 8198, 9015, 6220, 2874, 1868, 1837, 3191, 3790, 2396, -1500, -4089, -4824,
+    -3134, -1780, -2183, -5258, -7648, -9034, -7718, -4213, -2523, -3087, -5303, -6566, -4660, -1127, 2769, 2382,
+    793, -206, 762, 3903, 7215, 8679, 6899, 4252, 2598, 4472, 7191, 7808, 6510, 3034, -475, -943,
+    230, 1813, 1509, -2329, -5290, -6229, -5986, -3458, -2707, -4495, -7102, -8858, -8140, -5008, -1245, -1629,
+    -2982, -4849, -3673, 257, 2492, 4763, 4498, 2524, 1796, 3713, 6475, 9019, 8770, 5490, 2968, 2768,
+    4070, 6678, 5414, 2330, -1278, -2697, -2006, -6, -141, -1842, -5698, -7443, -8017, -5450, -3198, -3077,
+    -5652, -7524, -7420, -4592, -1201, 914, 297, -2300, -1900, 385, 4430, 6841, 6611, 4408, 3016, 2741,
+    6084, 8627, 8729, 5447, 2699, 1060, 2289, 3877, 4859, 2326, -1925, -4735, -4652, -2858, -1491, -2445,
+    -5356, -7988, -8976, -6877, -4059, -2191, -3503, -6016, -6962, -4825, -1180, 2304, 2830, 1192, -980, 646,
+    4805, 6811, 8650, 5803, 3876, 3025, 4849, 7419, 8125, 6034, 3023, 294, -764, 927, 2542, 1553,
+    -2119, -5815, -6716, -5568, -3196, -2688, -5163, -7551, -8878, -7262, -4290, -1453, -2049, -3355, -4635, -3262,
+    -84, 3693, 4265, 3207, 1577, 1356, 4284, 7310, 8442, 7428, 4773, 2566, 3061, 5020, 6842, 5670,
+    2094, -1112, -2780, -1530, 373, -523, -2444, -5802, -7826, -6600, -4547, -2918, -4174, -6770, -8276, -7492,
+    -4224, -965, 554, -458, -2745, -1736, 1010, 4481, 6930, 6037, 3718, 2599, 3258, 6981, 8553, 8145,
+    5557, 2896, 1700, 2544, 5124, 4515, 1632, -1977, -4178, -3504, -2462, -1447, -2599, -5866, -9081, -8992,
+    -5439, -3249, -3053, -4784, -5814, -6147, -3618, -21, 2434, 1815, 534, -873, 1302, 5304, 7188, 7535,
+    5844, 3226, 3565, 5687, 7796, 8399, 5696, 1760, 582, 124, 1368, 3150, 887, -2148, -5918, -6153,
+    -4446, -2912, -3260, -5143, -8749, -8936, -6798, -3468, -1282, -1832, -4074, -5471, -3164, 236, 3795, 4889,
+    2978, 1088, 1964, 4280, 7487, 8198, 7155, 4323, 2929, 3424, 6313, 6967, 5464, 1685, -1487, -1877,
+    -743, 308, 189, -2795, -6869, -7416, -6293, -3784, -2701, -3953, -7482, -8090, -6876, -3489, -229, -286,
+    -1837, -3517, -2229, 630, 4600, 6262, 5596, 2934, 2731, 4283, 7535, 9101, 8489, 4577, 2682, 1571,
+    3544, 4967, 4325, 1101, -2664, -4696, -3444, -1044, -870, -2752, -6871, -8903, -7665, -5382, -3330, -3045,
+    -5190, -7169, -5814, -3808, 53, 1984, 1147, -434, -546, 1528, 5194, 7314, 7471, 5156, 2914, 3863,
+    6369, 8837, 7497, 4770, 1051, -415, 392, 2446, 2790, 757, -3579, -5989, -5919, -4391, -2293, -3108,
+    -6245, -8530, -8508, -6232, -3589, -1943, -2611, -4113, -4800, -2587, 1005, 3649, 3778, 2094, 745, 1508,
+    5067, 8330, 8550, 6445, 3930, 2830, 4332, 6552, 6761, 4984, 1448, -1656, -2000, 214, 900, 130,
+    -3665, -6684, -7392, -5847, -3640, -3128, -5096, -7592, -8497, -6389, -2574, -528, -346, -1794, -3524, -1912,
+    1229, 4739, 6208, 5051, 3107, 2848, 4901, 7633, 9552, 7363, 4306, 2175, 1912, 4129, 5654, 4086,
+    1139, -2499, -3880, -2518, -734, -1437, -3713, -7149, -8178, -7889, -4659, -2329, -3521, -6019, -6864, -6507,
+    -2568, 149, 2177, 503, -1028, -1138, 1440, 5275, 7823, 6981, 4056, 3118, 3498, 6177, 8707, 8134,
+    4531, 1233, 403, 1753, 3390, 3060, -278, -3979, -5754, -5402, -3064, -2025, -3557, -6538, -8561, -7905,
+    -5666, -2109, -1779, -3600, -5683, -5864, -2616, 1365, 4186, 3474, 1196, 553, 2196, 4893, 8481, 7989,
+    6303, 3402, 2845, 4909, 7249, 6213, 4486, 1094, -1474, -1439, 541, 1292, -1094, -3873, -6448, -7693,
+    -5644, -3278, -3207, -5641, -7486, -8293, -6043, -3014, -353, -584, -2748, -4041, -889, 1835, 5677, 5487,
+    4215, 2505, 2481, 5316, 7483, 9348, 6885, 4069, 2479, 2204, 4971, 5786, 4159, -40, -2900, -3591,
+    -2011, -355, -1131, -3888, -7678, -8434, -7373, -4303, -3014, -3771, -5941, -8355, -6053, -2621, 858, 1488,
+    -69, -1625, -877, 2571, 6309, 7427, 6750, 4133, 3202, 4121, 7172, 9010, 7725, 4663, 1830, 1062,
+    1534, 3404, 2552, -313, -3664, -5715, -4806, -2867, -1854, -3796, -7088, -9159, -7795, -4702, -2907, -2339,
+    -3779, -5710, -5566, -1401, 1775, 3168, 3024, 625, 530, 2826, 5995, 8439, 7947, 5213, 2913, 3066,
+    5314, 7533, 6900, 4225, 421, -1378, -11, 1537, 1209, -828, -4270, -7291, -7066, -4641, -2705, -4160,
+    -5915, -8427, -8176, -6141, -2325, -754, -1563, -3258, -3546, -1805, 2674, 5069, 5539, 4015, 1917, 2313,
+    5700, 8434, 8277, 6204, 3161, 2517, 2992, 5735, 6290, 3356, 170, -3433, -3744, -840, -1033, -1442,
+    -4419, -7819, -8751, -6800, -4096, -2815, -4782, -7352, -8122, -6172, -1860, 357, 1702, -773, -1330, -642,
+    2785, 6240, 7276, 5603, 3729, 2812, 4716, 7503, 8999, 6554, 3360, 587, 1326, 2639, 3986, 2848,
+    -830, -3924, -5487, -4548, -2498, -1506, -4235, -7283, -9293, -7826, -4624, -2519, -2302, -4758, -6081, -5217,
+    -2255, 2637, 3259, 2245, 649, 642, 2988, 6641, 8556, 7416, 5076, 2995, 3570, 6094, 7826, 6863,
+    3295, 124, -1068, 334, 1684, 1426, -973, -4617, -7578, -6740, -4370, -2762, -3564, -6410, -8987, -7860,
+    -5174, -1984, -756, -2390, -3619, -4002, -808, 2994, 5566, 4748, 2493, 1581, 3253, 6094, 9099, 8801,
+    5963, 2549, 2307, 4377, 5972, 5706, 3374, -1100, -3044, -2824, -729, -555, -1557, -4931, -7843, -8660,
+    -5925, -3510, -2739, -5567, -7265, -7336, -5671, -1192, 442, 159, -1275, -1746, -427, 2866, 6330, 6925,
+    5459, 2988, 3217, 5447, 7753, 8758, 6321, 2977, 1015, 1616, 3893, 4517, 2667, -774, -4389, -5242,
+    -3885, -1374, -2092, -4715, -8218, -8742, -7254, -4217, -2434, -2927, -5531, -6628, -4243, -985, 1916, 3160,
+    1423, -193, 597, 3823, 7294, 8525, 6130, 4388, 2908, 4263, 6575, 8435, 6569, 2603, -185, -678,
+    870, 1997, 995, -1788, -5080, -6779, -5998, -3881, -2581, -4238, -7149, -8520, -7643, -4443, -1473, -1547,
+    -3037, -4112, -3715, -1275, 3092, 5337, 4352, 1724, 1376, 3248, 7426, 9367, 8400, 5974, 2818, 2290,
+    5075, 6774, 5616, 2887, -1007, -2652, -1741, -640, -596, -2120, -5990, -8572, -7958, -5389, -3495, -3460,
+    -5719, -8194, -7714, -4393, -1015, 546, 35, -2232, -2540, 577, 3704, 6840, 6328, 4190, 3060, 3541,
+    5782, 8550, 8786, 5638, 3555, 1014, 1777, 4252, 4258, 1624, -1779, -4382, -4924, -3360, -1365, -1898,
+    -5686, -8076, -8454, -6444, -3734, -2142, -3667, -5678, -6460, -4630, -370, 2338, 1973, 792, -655, 285,
+    4547, 7712, 8067, 6464, 3355, 2992, 4459, 7017, 7956, 6403, 2358, 263, -486, 1711, 2428, 1093,
+    -2378, -5739, -6435, -5241, -3004, -2541, -4413, -7522, -9281, -7625, -4220, -1583, -1576, -3171, -4869, -3714,
+    304, 3137, 4823, 3440, 1559, 2143, 4459, 7395, 9211, 7701, 4819, 2720, 2814, 5667, 6767, 5971,
+    2169, -1384, -2252, -1054, 22, 989, -2197, -5772, -8075, -6807, -4770, -3189, -4225, -7199, -8113, -7265,
+    -3907, -1360, 401, -1022, -2650, -2076, 251, 4361, 6497, 6132, 3840, 2358, 3812, 7104, 8524, 8214,
+    5415, 1998, 1245, 2812, 4777, 4690, 1565, -2357, -4855, -4080, -2414, -1040, -2853, -6068, -8594, -8164,
+    -5878, -3312, -2601, -4621, -6750, -6590, -3556, -151, 2244, 1972, -3, -754, 1044, 4607, 7646, 7524,
+    5649, 3783, 3563, 5057, 8423, 8224, 5651, 2124, -649, 40, 2544, 2425, 979, -2043, -5662, -6086,
+    -4581, -2976, -2983, -5014, -7746, -8857, -6563, -3289, -1543, -2378, -4368, -5205, -3324, 484, 3549, 4532,
+    3452, 939, 2022, 4216, 7683, 8657, 7328, 4346, 2611, 3923, 6031, 6982, 5280, 1775, -1421, -2177,
+    -423, 918, -403, -3382, -6558, -7761, -6580, -4351, -3650, -4343, -6838, -7918, -7122, -3090, -857, 358,
+    -1163, -3371, -2047, 767, 4684, 6252, 5846, 3233, 2497, 4378, 7321, 8587, 7657, 5034, 2096, 1119,
+    3495, 5274, 3940, 1014, -2551, -4090, -3259, -1607, -754, -3032, -6354, -8669, -7924, -5538, -3956, -3257,
+    -5281, -7056, -7027, -3452, 567, 1625, 1117, -574, -798, 1049, 5672, 7249, 7108, 5100, 2939, 3489,
+    6186, 8201, 7766, 5352, 1450, -145, 851, 3032, 2889, 303, -2909, -5809, -5813, -4168, -2771, -2812,
+    -5588, -8428, -8150, -6488, -3336, -1729, -2548, -4930, -5249, -2875, 907, 3878, 4343, 2350, 1389, 2155,
+    4777, 8320, 8717, 6406, 3948, 2585, 4649, 6193, 6778, 4903, 1353, -1728, -1756, -152, 1141, -146,
+    -3784, -6614, -7681, -6059, -3453, -2922, -4274, -7124, -8468, -5915, -2922, -578, -269, -2114, -3144, -2169,
+    1542, 4435, 6201, 5133, 3258, 3139, 4579, 7949, 9076, 7318, 4013, 1510, 2368, 4010, 4892, 3984,
+    452, -2514, -4288, -2532, -1558, -1003, -3588, -6974, -8667, -7868, -5215, -3305, -3516, -6381, -7229, -6240,
+    -3051, 141, 1811, 805, -1002, -611, 2005, 4984, 8478, 7097, 4609, 3302, 3853, 6505, 8481, 7240,
+    4843, 1572, 240, 1465, 3400, 3183, -129, -3388, -6197, -5136, -3405, -2151, -3698, -6398, -9199, -8334,
+    -5611, -3034, -2144, -3609, -5505, -5383, -2318, 1534, 3544, 3287, 2066, 555, 2459, 5421, 8357, 8446,
+    6235, 3715, 2935, 4140, 7054, 7048, 4965, 1064, -963, -765, 228, 1722, -471, -3910, -6690, -7853,
+    -5475, -2805, -3050, -5276, -7904, -8625, -6423, -2208, -521, -739, -3196, -3880, -1672, 2255, 4579, 5646,
+    4583, 2046, 2504, 5185, 7838, 8725, 7282, 4028, 2308, 2857, 4807, 5727, 4276, 817, -2559, -3098,
+    -2569, -880, -920, -4043, -7009, -8854, -7008, -3896, -3226, -4512, -6120, -7164, -6317, -2507, 246, 1674,
+    -93, -1496, -907, 2101, 6396, 6994, 6579, 3985, 3217, 4446, 7010, 8997, 7370, 4104, 1027, 535,
+    2763, 3442, 2957, 361, -3695, -5839, -4495, -3009, -1911, -3628, -7144, -9172, -7861, -4839, -2122, -1731,
+    -3928, -5570, -5387, -2271, 1077, 3622, 2809, 819, 574, 2191, 5885, 8743, 7988, 4877, 2840, 3632,
+    5796, 7667, 7253, 3924, 152, -1198, -421, 1134, 1555, -747, -4148, -6917, -6998, -4550, -2964, -3320,
+    -5540, -8673, -8266, -5831, -2312, -629, -1245, -3171, -3751, -1361, 2300, 5708, 5161, 4179, 1785, 2731,
+    5702, 7925, 8557, 6451, 3700, 2057, 3128, 5261, 5993, 3016, -281, -2565, -2803, -1670, -395, -900,
+    -4576, -7716, -8740, -6527, -3395, -3050, -4123, -6386, -7856, -6085, -2126, 1038, 1210, -656, -1843, -986,
+    2886, 5549, 6882, 6084, 3329, 3019, 5276, 7213, 8437, 7287, 3545, 974, 804, 3277, 3604, 2822,
+    -448, -4045, -5501, -4300, -2198, -1738, -4437, -7410, -9043, -7073, -4788, -2694, -2780, -4458, -6636, -4465,
+    -1401, 2445, 3125, 1526, 214, 223, 2950, 6167, 8493, 7444, 4613, 3201, 3709, 5763, 7675, 7316,
+    2867, -45, -1750, 152, 1465, 1559, -1446, -4975, -7037, -6190, -4206, -2367, -3918, -6315, -8167, -8231,
+    -4756, -1844, -191, -2782, -4392, -4298, -1270, 2489, 5252, 4627, 3276, 1742, 3460, 6434, 8215, 8470,
+    6098, 3374, 2326, 3870, 5556, 6299, 2777, -550, -3542, -2755, -810, -51, -1709, -5229, -7621, -8297,
+    -6020, -3518, -3210, -5035, -6883, -7505, -5386, -1274, 266, 776, -1092, -2339, -703, 3454, 5832, 7010,
+    5349, 2880, 3440, 5078, 7925, 8383, 6284, 2861, 1600, 2432, 3977, 4098, 2358, -1243, -4201, -5154,
+    -3683, -1653, -1942, -4806, -8002, -9002, -7697, -4297, -2633, -2800, -5071, -6977, -5020, -673, 2216, 2903,
+    1637, -455, 555, 3013, 6697, 8246, 6590, 4402, 2976, 4028, 6645, 8149, 6703, 3252, -434, -881,
+    1107, 1991, 1600, -1975, -5480, -6457, -5871, -4195, -2613, -3876, -7215, -9484, -7922, -4676, -1680, -1245,
+    -2766, -4572, -3657, -407, 3720, 5120, 4422, 1875, 1880, 3609, 6357, 8946, 8314, 5151, 3093, 2179,
+    4770, 6889, 5848, 2948, -1110, -2684, -1443, 336, 138, -2153, -5537, -8334, -7897, -5520, -3208, -4028,
+    -4938, -7284, -7840, -4880, -1356, 986, -248, -1767, -2412, 190, 3844, 6382, 6052, 4198, 3012, 3486,
+    6190, 8165, 8979, 6194, 2637, 1111, 2581, 3819, 4605, 2711, -2175, -5000, -4321, -3010, -1592, -2095,
+    -5056, -8149, -8654, -6311, -3303, -2566, -3722, -6188, -6552, -4127, -673, 1992, 2739, 319, -904, 805,
+    4201, 7080, 8141, 6503, 3541, 3197, 4931, 7296, 7854, 6420, 2361, -117, -360, 1069, 2523, 1672,
+    -1979, -6196, -6922, -5578, -3069, -2617, -4539, -7780, -8879, -7240, -4021, -1016, -1809, -3780, -4252, -4070,
+    -60, 3429, 4709, 3236, 1519, 1265, 4286, 6743, 8839, 7873, 4614, 2517, 2980, 5333, 7247, 5409,
+    2087, -1279, -3002, -1029, 528, 862, -2675, -5726, -7868, -7271, -5357, -3202, -3918, -6700, -8079, -7591,
+    -4289, -801, 378, -1246, -2371, -1766, 208, 4095, 6917, 6175, 3843, 2792, 3576, 7223, 9031, 8197,
+    5428, 2357, 1837, 3067, 4891, 4857, 2198, -2167, -4156, -4356, -1992, -1226, -2991, -6302, -8963, -8154,
+    -6200, -3599, -1970, -4138, -6234, -6223, -3538, 374, 2055, 1825, -69, -1186, 1297, 4529, 7444, 8024,
+    5462, 3731, 3307, 5311, 7721, 7807, 5322, 2295, -363, 437, 1994, 2926, 1141, -2589, -5872, -6118,
+    -4820, -2619, -3297, -5545, -8202, -9096, -7162, -3192, -1004, -2864, -4655, -4866, -3484, 605, 3640, 4009,
+    3235, 1020, 1577, 4613, 7299, 8774, 7108, 3854, 3009, 3382, 5680, 6890, 5126, 1719, -1465, -1240,
+    -625, 592, 385, -3332, -6342, -7607, -7166, -4032, -2144, -4358, -6653, -8217, -7768, -3300, -420, 319,
+    -1428, -3150, -2016, 1123, 4410, 6503, 6336, 3199, 2738, 4617, 7409, 9292, 7885, 4977, 1840, 1290,
+    3605, 5202, 5031, 1172, -2454, -4509, -3368, -1561, -1250, -3308, -6058, -8624, -8596, -4884, -2777, -2938,
+    -5261, -7143, -6019, -3718, 378, 2595, 1181, -259, -1085, 831, 4887, 7325, 7175, 5214, 3625, 3698,
+    5330, 7958, 8173, 5048, 1447, 152, 1187, 2283, 3557, 317, -3217, -6385, -5968, -3592, -2922, -3786,
+    -5625, -8552, -8322, -5705, -3575, -1865, -2313, -4576, -4878, -2580, 479, 3294, 3931, 2968, 882, 2092,
+    5334, 7852, 8543, 6556, 3297, 2496, 4479, 6741, 6843, 4622, 1552, -1156, -2460, 188, 1291, -93,
+    -3323, -6883, -8195, -5850, -3877, -3142, -5161, -6824, -8732, -6931, -3447, -626, -513, -2367, -2993, -1944,
+    1350, 5231, 6470, 4373, 2654, 2420, 4760, 7700, 9400, 7750, 4140, 2165, 2827, 4007, 5363, 4286,
+    794, -2485, -3822, -3586, -1113, -1062, -4025, -7070, -9403, -7485, -4374, -3059, -3614, -6024, -7343, -6147,
+    -2622, 399, 2282, 881, -882, -326, 1185, 5027, 7474, 7189, 4130, 3010, 3919, 6547, 8279, 7842,
+    4567, 1807, 722, 1844, 3153, 3418, 233, -3446, -6349, -5619, -3421, -1931, -3276, -6481, -9287, -8535,
+    -5905, -2367, -2113, -3333, -5655, -5542, -2375, 1514, 4301, 3609, 1799, 978, 1659, 5193, 8411, 8110,
+    5439, 3106, 2680, 5374, 6510, 6731, 4350, 615, -1787, -1645, 972, 1186, -503, -4139, -7291, -7297,
+    -5973, -3261, -3208, -5308, -7926, -8356, -6011, -2673, -412, -134, -2897, -4091, -2187, 2077, 4750, 5946,
+    3717, 2284, 3419, 5518, 8340, 8773, 6841, 3925, 1693, 2691, 4486, 5771, 3774, 488, -2755, -3459,
+    -2519, -398, -1146, -3735, -7463, -8408, -7137, -3686, -2418, -4038, -6066, -7357, -6115, -2955, 880, 1162,
+    -198, -1956, -849, 2198, 5897, 7146, 6903, 4218, 2596, 4257, 7681, 8804, 7578, 4386, 865, 622,
+    3001, 3591, 3030, -288, -4144, -5654, -5505, -2584, -2638, -3819, -6688, -9315, -8230, -5608, -2402, -1998,
+    -3928, -6011, -4738, -1307, 1593, 3495, 2635, 1767, 681, 2316, 5919, 8678, 8074, 5396, 2586, 3837,
+    5680, 7948, 7210, 4310, 621, -1883, -502, 1377, 1380, -963, -4396, -6960, -6884, -4618, -2365, -3486,
+    -6115, -8000, -8563, -5982, -2012, -616, -1476, -3044, -3595, -1011, 2751, 4996, 4744, 3553, 1684, 2546,
+    6049, 8518, 9009, 6359, 3688, 1959, 3205, 5331, 5754, 3187, -376, -2943, -3608, -1005, -362, -1910,
+    -4222, -7561, -8789, -6672, -4101, -3301, -4832, -6496, -7555, -5567, -2344, 1134, 749, -862, -2375, -498,
+    2716, 6332, 7062, 5846, 3785, 2921, 4380, 7390, 8325, 7172, 3360, 1380, 941, 2957, 4446, 2763,
+    -682, -4247, -5533, -3666, -2561, -2125, -3800, -7695, -9101, -7326, -4855, -2432, -2305, -4816, -6357, -5034,
+    -840, 2056, 3279, 2042, 1029, 329, 3391, 6295, 8257, 7796, 4789, 3337, 3491, 5722, 7735, 7046,
+    3966, 246, -1297, 46, 2077, 1776, -1542, -5242, -6901, -6198, -4389, -2167, -4213, -6744, -8946, -8426,
+    -4971, -1775, -1316, -2875, -3754, -3875, -1235, 3022, 5107, 4406, 2694, 1581, 3328, 6281, 8588, 8644,
+    5824, 3703, 2210, 3979, 5718, 5977, 3370, -836, -2249, -2654, -1016, 74, -1579, -5075, -7818, -7911,
+    -6270, -3445, -3567, -4678, -7256, -7663, -5342, -1171, 581, 725, -1073, -2077, -101, 3183, 6561, 6647,
+    5137, 2824, 2696, 4788, 7613, 8743, 6528, 2533, 1121, 1621, 3922, 3986, 2084, -997, -4063, -5236,
+    -3515, -2140, -2520, -4526, -7842, -9348, -7485, -4771, -2356, -3065, -5058, -6452, -4571, -1800, 2420, 2473,
+    1696, -493, 585, 3775, 6996, 8269, 7296, 4251, 3141, 3832, 6581, 7560, 6720, 2964, -331, -1028,
+    1140, 2426, 1385, -1582, -5029, -6842, -5902, -3695, -2326, -4312, -6894, -8988, -7482, -4628, -1972, -995,
+    -3585, -4803, -3734, -703, 3149, 5107, 4197, 2285, 1251, 3569, 6450, 8458, 8560, 4893, 3161, 2596,
+    4951, 5910, 5948, 2756, -846, -2457, -2192, 203, -80, -2184, -5532, -8272, -8189, -4964, -3514, -3301,
+    -5700, -7384, -7307, -4945, -626, 1107, 282, -1566, -2260, 62, 3981, 6748, 6899, 4270, 2862, 3422,
+    5868, 8906, 8648, 6229, 2906, 1560, 2303, 4282, 4433, 2575, -1772, -4585, -4423, -2758, -1683, -2698,
+    -5534, -7797, -8188, -6684, -3474, -2360, -4157, -5843, -6924, -4177, -195, 2354, 2539, 801, -560, 1016,
+    3947, 7795, 8302, 6584, 3555, 2693, 4473, 6998, 8093, 6078, 2530, -318, -953, 1246, 2564, 1865,
+    -2334, -6024, -7117, -5240, -3367, -2664, -4856, -7745, -9027, -7212, -4021, -1440, -1602, -2842, -4731, -3329,
+};
+static const uint16_t WAKE_FEATURES_2[] = {
+    618, 585, 633, 584, 663, 608, 660, 580, 616, 580, 614, 565, 598, 578, 628, 575, 636, 585, 632, 588, 631, 584, 629, 605, 660, 584, 635, 587, 632, 586, 635, 587, 637, 587, 632, 587, 632, 587, 635, 588,
+    564, 479, 470, 529, 619, 561, 616, 533, 591, 555, 607, 562, 616, 538, 582, 553, 603, 543, 557, 504, 597, 534, 592, 558, 617, 524, 585, 555, 605, 532, 585, 538, 603, 551, 603, 552, 609, 554, 604, 552,
+    566, 502, 553, 496, 592, 531, 588, 526, 550, 450, 550, 505, 510, 516, 581, 525, 557, 479, 562, 472, 572, 523, 593, 529, 588, 544, 578, 458, 554, 525, 587, 524, 558, 505, 584, 487, 570, 512, 586, 513,
+    583, 382, 505, 460, 573, 510, 570, 498, 572, 504, 555, 457, 538, 503, 544, 476, 517, 464, 545, 463, 536, 458, 547, 507, 571, 498, 555, 479, 544, 492, 565, 462, 538, 471, 575, 504, 576, 497, 563, 476,
+    495, 465, 548, 445, 557, 491, 554, 451, 504, 454, 555, 506, 564, 466, 525, 465, 495, 468, 528, 420, 504, 505, 565, 486, 556, 465, 518, 379, 523, 469, 559, 461, 553, 484, 554, 470, 533, 483, 546, 466,
+    495, 434, 536, 446, 545, 472, 539, 467, 544, 460, 526, 445, 527, 391, 530, 457, 466, 450, 538, 456, 541, 455, 526, 470, 540, 458, 514, 437, 555, 472, 515, 449, 527, 471, 529, 471, 539, 454, 521, 415,
+    542, 450, 527, 463, 534, 457, 530, 461, 505, 381, 502, 409, 537, 470, 480, 133, 520, 450, 525, 463, 521, 425, 526, 456, 530, 387, 553, 472, 493, 422, 506, 465, 539, 452, 517, 444, 529, 452, 545, 459,
+    528, 475, 520, 399, 524, 445, 521, 410, 515, 399, 501, 434, 496, 439, 536, 454, 521, 441, 524, 368, 494, 422, 501, 442, 520, 366, 514, 391, 496, 447, 492, 362, 525, 417, 491, 395, 518, 409, 533, 409,
+    487, 396, 457, 351, 513, 431, 511, 433, 523, 369, 492, 422, 486, 248, 453, 236, 466, 415, 483, 375, 532, 395, 502, 428, 511, 381, 474, 413, 517, 397, 516, 407, 509, 364, 506, 405, 484, 371, 502, 378,
+    418, 236, 474, 424, 506, 417, 503, 342, 483, 391, 528, 412, 527, 409, 465, 381, 468, 406, 501, 302, 431, 351, 483, 406, 500, 393, 453, 297, 500, 342, 460, 325, 473, 314, 486, 396, 469, 364, 453, 362,
+    222, 0, 448, 359, 497, 398, 492, 318, 479, 236, 434, 364, 438, 357, 445, 351, 485, 328, 489, 388, 495, 342, 487, 399, 493, 392, 439, 133, 495, 424, 489, 424, 442, 372, 476, 424, 501, 388, 463, 334,
+    469, 0, 461, 392, 490, 377, 484, 328, 441, 222, 435, 413, 499, 292, 474, 258, 496, 383, 471, 306, 447, 311, 447, 374, 484, 314, 459, 297, 447, 404, 468, 236, 435, 314, 450, 292, 468, 331, 463, 362,
+    355, 287, 452, 342, 482, 371, 477, 314, 487, 258, 466, 248, 452, 364, 479, 385, 399, 306, 375, 236, 416, 0, 481, 357, 477, 236, 427, 258, 458, 311, 473, 351, 454, 362, 463, 292, 456, 359, 472, 349,
+    177, 266, 474, 133, 476, 346, 470, 369, 459, 372, 483, 292, 396, 378, 488, 397, 465, 359, 512, 428, 416, 133, 424, 351, 471, 236, 486, 334, 470, 357, 473, 325, 482, 351, 465, 331, 427, 248, 472, 280,
+    422, 0, 325, 222, 471, 342, 465, 379, 404, 0, 297, 266, 484, 386, 471, 222, 414, 0, 420, 258, 447, 274, 417, 336, 466, 177, 455, 364, 432, 0, 381, 292, 369, 351, 464, 328, 493, 336, 453, 314,
+    385, 248, 414, 292, 466, 318, 459, 177, 328, 0, 388, 258, 457, 0, 274, 318, 414, 0, 361, 0, 429, 0, 458, 322, 459, 377, 480, 372, 429, 292, 432, 328, 403, 133, 449, 133, 451, 258, 397, 258,
+    457, 287, 463, 311, 455, 306, 452, 222, 443, 292, 381, 203, 417, 342, 482, 325, 405, 334, 483, 325, 447, 236, 382, 306, 450, 258, 457, 361, 447, 306, 398, 133, 444, 258, 455, 177, 443, 133, 425, 334,
+    432, 0, 369, 258, 450, 297, 447, 287, 414, 177, 432, 395, 488, 369, 414, 359, 433, 274, 468, 349, 457, 266, 427, 292, 446, 0, 419, 203, 428, 203, 470, 359, 401, 0, 434, 331, 463, 287, 397, 177,
+    0, 0, 438, 322, 443, 292, 441, 177, 460, 381, 411, 203, 377, 0, 236, 133, 405, 133, 461, 0, 436, 364, 454, 287, 439, 177, 428, 222, 385, 177, 378, 297, 465, 318, 428, 222, 420, 314, 443, 355,
+    177, 177, 445, 203, 441, 287, 434, 336, 463, 203, 409, 362, 410, 0, 236, 0, 236, 287, 435, 311, 428, 0, 287, 280, 435, 349, 426, 248, 396, 280, 417, 302, 428, 0, 461, 318, 436, 0, 311, 133,
+    454, 0, 422, 381, 433, 274, 426, 236, 371, 0, 434, 377, 452, 311, 472, 222, 0, 0, 344, 0, 280, 177, 302, 248, 423, 258, 344, 0, 422, 0, 361, 274, 353, 133, 420, 203, 364, 236, 411, 236,
+    0, 0, 405, 0, 422, 258, 418, 0, 402, 222, 459, 258, 448, 248, 364, 0, 378, 133, 412, 331, 442, 322, 427, 248, 421, 0, 410, 325, 393, 0, 434, 306, 339, 0, 417, 177, 353, 292, 325, 258,
+    493, 361, 222, 0, 416, 236, 417, 274, 428, 339, 386, 0, 410, 334, 362, 418, 404, 0, 339, 274, 404, 0, 314, 248, 417, 133, 366, 177, 391, 274, 415, 177, 386, 331, 375, 322, 439, 357, 322, 133,
+    414, 390, 302, 0, 414, 236, 406, 297, 412, 378, 433, 0, 355, 0, 427, 236, 480, 334, 258, 0, 412, 0, 266, 236, 409, 177, 368, 336, 456, 258, 441, 236, 393, 203, 408, 0, 361, 133, 422, 203,
+};
+
+static const int16_t WAKE_PCM_3[] = {
+    0, 473, 950, 1430, 1912, 2394, 2878, 3360, 3841, 4319, 4793, 5262, 5726, 6182, 6630, 7069,
+    7497, 7913, 8317, 8705, 9079, 9435, 9774, 10093, 10392, 10669, 10923, 11152, 11357, 11535, 11686, 11809,
+    11902, 11964, 11996, 11996, 11963, 11897, 11798, 11665, 11497, 11295, 11058, 10786, 10481, 10141, 9767, 9360,
+    8921, 8450, 7949, 7418, 6859, 6273, 5662, 5028, 4372, 3696, 3003, 2295, 1574, 843, 104, -639,
+    -1384, -2128, -2868, -3601, -4324, -5032, -5724, -6396, -7044, -7666, -8258, -8817, -9340, -9824, -10266, -10663,
+    -11013, -11313, -11562, -11757, -11895, -11977, -12000, -11963, -11866, -11707, -11488, -11209, -10869, -10470, -10012, -9499,
+    -8931, -8311, -7642, -6927, -6169, -5372, -4541, -3678, -2790, -1882, -957, -23, 916, 1854, 2784, 3701,
+    4599, 5472, 6313, 7116, 7877, 8588, 9246, 9843, 10377, 10841, 11232, 11546, 11780, 11931, 11997, 11976,
+    11868, 11672, 11389, 11019, 10564, 10027, 9410, 8718, 7956, 7127, 6238, 5296, 4308, 3280, 2221, 1140,
+    45, -1055, -2150, -3231, -4288, -5313, -6295, -7226, -8096, -8897, -9621, -10260, -10808, -11259, -11606, -11847,
+    -11976, -11993, -11895, -11681, -11354, -10914, -10366, -9712, -8959, -8113, -7181, -6173, -5098, -3966, -2789, -1578,
+    -347, 893, 2127, 3343, 4527, 5665, 6744, 7753, 8678, 9508, 10233, 10844, 11332, 11691, 11915, 11999,
+    11942, 11743, 11403, 10924, 10311, 9570, 8709, 7738, 6667, 5509, 4278, 2988, 1656, 299, -1067, -2423,
+    -3751, -5034, -6255, -7396, -8441, -9374, -10184, -10856, -11381, -11749, -11955, -11994, -11863, -11563, -11098, -10471,
+    -9690, -8767, -7712, -6540, -5268, -3914, -2497, -1038, 441, 1918, 3369, 4773, 6106, 7348, 8478, 9477,
+    10329, 11018, 11531, 11860, 11996, 11937, 11681, 11231, 10593, 9776, 8792, 7656, 6388, 5006, 3535, 1998,
+    422, -1165, -2736, -4264, -5719, -7076, -8310, -9396, -10315, -11048, -11580, -11900, -12000, -11876, -11528, -10963,
+    -10188, -9217, -8067, -6758, -5316, -3766, -2138, -464, 1223, 2890, 4504, 6032, 7442, 8704, 9792, 10683,
+    11355, 11795, 11990, 11935, 11629, 11077, 10289, 9279, 8068, 6680, 5144, 3493, 1761, -14, -1793, -3536,
+    -5205, -6761, -8169, -9395, -10411, -11192, -11717, -11974, -11955, -11657, -11085, -10252, -9175, -7878, -6391, -4746,
+    -2984, -1146, 725, 2582, 4380, 6074, 7622, 8985, 10126, 11016, 11630, 11952, 11970, 11683, 11096, 10222,
+    9081, 7701, 6117, 4369, 2503, 565, -1391, -3315, -5154, -6858, -8380, -9678, -10715, -11460, -11891, -11994,
+    -11764, -11206, -10332, -9166, -7738, -6088, -4260, -2307, -283, 1754, 3743, 5628, 7353, 8865, 10118, 11075,
+    11704, 11985, 11908, 11471, 10687, 9576, 8171, 6513, 4651, 2642, 547, -1569, -3641, -5603, -7392, -8950,
+    -10228, -11182, -11779, -11999, -11832, -11281, -10362, -9102, -7541, -5729, -3723, -1590, 600, 2775, 4860, 6786,
+    8485, 9900, 10979, 11684, 11988, 11879, 11358, 10441, 9157, 7549, 5672, 3592, 1380, -886, -3124, -5254,
+    -7199, -8887, -10256, -11253, -11841, -11995, -11707, -10985, -9855, -8354, -6538, -4474, -2237, 89, 2416, 4655,
+    6720, 8531, 10016, 11116, 11787, 12000, 11743, 11025, 9872, 8326, 6446, 4307, 1992, -408, -2795, -5074,
+    -7151, -8940, -10368, -11373, -11912, -11960, -11512, -10585, -9215, -7456, -5381, -3076, -636, 1835, 4232, 6452,
+    8400, 9988, 11148, 11826, 11991, 11632, 10763, 9420, 7658, 5554, 3200, 699, -1837, -4295, -6564, -8540,
+    -10132, -11266, -11887, -11964, -11492, -10489, -8999, -7089, -4845, -2371, 218, 2801, 5256, 7467, 9326, 10743,
+    11649, 11997, 11768, 10970, 9638, 7836, 5649, 3182, 554, -2105, -4665, -6997, -8984, -10527, -11545, -11984,
+    -11820, -11058, -9734, -7913, -5684, -3161, -472, 2246, 4852, 7211, 9197, 10707, 11659, 11999, 11708, 10798,
+    9313, 7331, 4954, 2309, -465, -3217, -5800, -8073, -9910, -11210, -11898, -11935, -11314, -10068, -8263, -5996,
+    -3391, -593, 2242, 4956, 7394, 9418, 10910, 11783, 11985, 11501, 10356, 8612, 6369, 3752, 914, -1982,
+    -4766, -7274, -9359, -10894, -11787, -11981, -11463, -10259, -8440, -6111, -3410, -500, 2445, 5246, 7731, 9747,
+    11168, 11905, 11909, 11176, 9750, 7714, 5195, 2347, -652, -3614, -6353, -8693, -10485, -11612, -12000, -11620,
+    -10494, -8690, -6324, -3544, -530, 2522, 5414, 7955, 9978, 11346, 11967, 11797, 10843, 9166, 6874, 4120,
+    1084, -2028, -5008, -7653, -9781, -11247, -11947, -11830, -10901, -9220, -6901, -4100, -1012, 2151, 5168, 7828,
+    9942, 11359, 11977, 11749, 10687, 8863, 6405, 3486, 313, -2887, -5883, -8457, -10422, -11633, -11997, -11485,
+    -10132, -8033, -5339, -2248, 1014, 4204, 7086, 9443, 11097, 11920, 11848, 10882, 9092, 6611, 3625, 358,
+    -2940, -6018, -8637, -10594, -11736, -11971, -11278, -9706, -7376, -4465, -1201, 2161, 5358, 8135, 10271, 11595,
+    11997, 11442, 9971, 7698, 4803, 1517, -1895, -5158, -8006, -10206, -11575, -11998, -11437, -9934, -7610, -4655,
+    -1309, 2149, 5432, 8266, 10411, 11685, 11977, 11260, 9589, 7104, 4012, 575, -2916, -6161, -8881, -10841,
+    -11868, -11871, -10845, -8875, -6130, -2847, 689, 4169, 7286, 9765, 11384, 11997, 11545, 10065, 7686, 4616,
+    1129, -2463, -5838, -8690, -10758, -11853, -11872, -10808, -8755, -5899, -2497, 1139, 4673, 7780, 10169, 11616,
+    11983, 11233, 9430, 6741, 3416, -235, -3869, -7140, -9737, -11411, -12000, -11443, -9789, -7194, -3904, -233,
+    3464, 6829, 9535, 11317, 11996, 11503, 9883, 7290, 3976, 266, -3474, -6874, -9595, -11363, -11999, -11436,
+    -9726, -7036, -3635, 136, 3899, 7270, 9905, 11535, 11990, 11218, 9294, 6414, 2870, -974, -4722, -7984,
+    -10420, -11773, -11899, -10780, -8530, -5381, -1662, 2237, 5903, 8947, 11044, 11967, 11614, 10019, 7348, 3885,
+    0, -3889, -7362, -10040, -11632, -11959, -10982, -8803, -5658, -1889, 2092, 5847, 8959, 11083, 11979, 11544,
+    9822, 7001, 3394, -598, -4527, -7950, -10479, -11825, -11832, -10495, -7962, -4517, -553, 3479, 7115, 9937,
+    11615, 11954, 10908, 8596, 5282, 1349, -2746, -6523, -9539, -11438, -11992, -11131, -8953, -5713, -1790, 2349,
+    6212, 9337, 11347, 11998, 11208, 9066, 5828, 1882, -2297, -6200, -9353, -11368, -11996, -11156, -8945, -5633,
+    -1624, 2590, 6488, 9585, 11495, 11976, 10963, 8580, 5120, 1014, -3224, -7059, -10007, -11692, -11897, -10591,
+    -7936, -4266, -48, 4181, 7877, 10564, 11894, 11689, 9973, 6964, 3047, -1270, -5425, -8876, -11169, -11999,
+    -11254, -9027, -5607, -1443, 2916, 6892, 9956, 11697, 11879, 10472, 7661, 3819, -540, -4830, -8473, -10972,
+    -11987, -11375, -9214, -5795, -1582, 2852, 6899, 10002, 11731, 11844, 10320, 7365, 3387, -1066, -5375, -8938,
+    -11254, -11997, -11057, -8562, -4858, -466, 3997, 7897, 10680, 11947, 11513, 9436, 6007, 1714, -2828, -6968,
+    -10108, -11791, -11771, -10045, -6859, -2673, 1906, 6211, 9612, 11607, 11900, 10443, 7446, 3347, -1251, -5667,
+    -9246, -11453, -11956, -10675, -7796, -3746, 869, 5358, 9044, 11367, 11974, 10768, 7927, 3877, -766, -5296,
+    -9021, -11368, -11972, -10737, -7847, -3744, 941, 5484, 9181, 11454, 11946, 10576, 7552, 3344, -1393, -5915,
+    -9510, -11608, -11876, -10265, -7025, -2668, 2118, 6570, 9978, 11792, 11719, 9766, 6240, 1707, -3106, -7420,
+    -10537, -11948, -11418, -9029, -5166, -456, 4333, 8415, 11119, 11997, 10898, 7999, 3775, -1078, -5756, -9481,
+    -11630, -11842, -10074, -6619, -2051, 2865, 7304, 10514, 11953, 11370, 8861, 4845, 3, -4844, -8869, -11381,
+    -11947, -10464, -7183, -2663, 2320, 6906, 10302, 11915, 11462, 9015, 4997, 104, -4812, -8889, -11411, -11931,
+    -10352, -6948, -2314, 2732, 7299, 10574, 11973, 11241, 8504, 4246, -775, -5662, -9535, -11697, -11754, -9690,
+    -5873, -990, 4077, 8407, 11211, 11974, 10552, 7200, 2526, -2615, -7280, -10608, -11983, -11146, -8247, -3817,
+    1324, 6224, 9968, 11856, 11531, 9047, 4867, -231, -5289, -9355, -11659, -11762, -9638, -5686, -651, 4512,
+    8820, 11447, 11889, 10055, 6292, 1317, -3915, -8396, -11261, -11951, -10327, -6700, -1768, 3511, 8110, 11130,
+    11976, 10478, 6924, 2007, -3309, -7977, -11073, -11983, -10521, -6971, -2034, 3312, 8001, 11098, 11978, 10461,
+    6844, 1851, -3519, -8183, -11200, -11955, -10291, -6538, -1455, 3927, 8514, 11367, 11899, 9996, 6042, 845,
+    -4529, -8975, -11573, -11782, -9552, -5342, -20, 5311, 9539, 11782, 11565, 8929, 4420, -1019, -6248, -10166,
+    -11944, -11201, -8089, -3262, 2261, 7307, 10802, 11999, 10635, 6997, 1859, -3681, -8435, -11379, -11874, -9808,
+    -5622, -216, 5240, 9563, 11810, 11489, 8662, 3943, -1642, -6872, -10598, -11999, -10761, -7152, -1962, 3665,
+    8485, 11428, 11836, 9613, 5248, -290, -5767, -9958, -11922, -11213, -7984, -2957, 2740, 7823, 11141, 11940,
+    10034, 5848, 331, -5266, -9666, -11862, -11347, -8233, -3228, 2521, 7695, 11099, 11946, 10032, 5797, 215,
+    -5421, -9801, -11902, -11231, -7938, -2787, 3020, 8123, 11322, 11861, 9608, 5087, -638, -6216, -10326, -11989,
+    -10806, -7052, -1615, 4211, 9034, 11700, 11564, 8653, 3662, -2215, -7561, -11086, -11935, -9896, -5457, 309,
+    6004, 10242, 11985, 10805, 6982, 1448, -4445, -9251, -11785, -11420, -8240, -3023, 2945, 8188, 11404, 11791,
+    9246, 4398, -1550, -7115, -10904, -11966, -10028, -5571, 290, 6082, 10344, 11997, 10617, 6548, 816, -5127,
+    -9770, -11928, -11047, -7344, -1761, 4277, 9222, 11802, 11349, 7974, 2541, -3552, -8730, -11652, -11554, -8457,
+    -3159, 2964, 8319, 11506, 11686, 8808, 3619, -2523, -8006, -11385, -11766, -9041, -3925, 2233, 7803, 11306,
+    11807, 9166, 4081, -2095, -7716, -11276, -11818, -9189, -4090, 2113, 7750, 11300, 11800, 9110, 3950, -2284,
+    -7902, -11374, -11752, -8926, -3661, 2608, 8167, 11491, 11662, 8628, 3218, -3083, -8536, -11635, -11516, -8206,
+    -2618, 3701, 8995, 11786, 11292, 7643, 1856, -4455, -9521, -11917, -10963, -6923, -929, 5331, 10088, 11993,
+    10501, 6029, -160, -6306, -10660, -11976, -9872, -4944, 1403, 7351, 11193, 11819, 9043, 3659, -2784, -8427,
+    -11634, -11473, -7983, -2172, 4274, 9479, 11923, 10887, 6667, 492, -5830, -10445, -11993, -10013, -5081, 1353,
+    7391, 11246, 11773, 8809, 3227, -3317, -8878, -11795, -11194, -7248, -1130, 5330, 10195, 12000, 10197, 5323,
+    -1159, -7295, -11230, -11767, -8739, -3057, 3557, 9093, 11862, 11016, 6805, 511, -5943, -10579, -11971, -9685,
+    -4417, 2214, 8166, 11599, 11448, 7752, 1650, -4967, -10044, -11999, -10216, -5246, 1366, 7555, 11381, 11641,
+    8247, 2259, -4443, -9749, -11983, -10433, -5582, 1039, 7334, 11305, 11685, 8347, 2348, -4404, -9753, -11986,
+    -10382, -5449, 1236, 7527, 11400, 11603, 8063, 1917, -4852, -10054, -12000, -10052, -4837, 1954, 8113, 11630,
+    11351, 7361, 959, -5760, -10593, -11949, -9375, -3712, 3177, 9022, 11888, 10822, 6169, -532, -7060, -11245,
+    -11688, -8235, -2032, 4853, 10118, 11998, 9855, 4402, -2533, -8620, -11805, -11010, -6496, 218, 6861, 11182,
+    11711, 8261, 1999, -4947, -10210, -11990, -9673, -4044, 2973, 8975, 11897, 10730, 5869, -1017, -7557, -11489,
+    -11449, -7445, -858, 6031, 10828, 11860, 8761, 2605, -4463, -9975, -11999, -9820, -4195, 2906, 8990, 11911,
+    10637, 5608, -1404, -7924, -11641, -11233, -6839, -12, 6823, 11231, 11637, 7889, 1320, -5725, -10723, -11878,
+    -8768, -2505, 4663, 10155, 11986, 9490, 3562, -3659, -9558, -11992, -10071, -4488, 2733, 8961, 11922, 10530,
+    5286, -1896, -8387, -11803, -10885, -5962, 1159, 7856, 11657, 11153, 6523, -526, -7382, -11502, -11350, -6975,
+    0, 6979, 11356, 11491, 7327, 417, -6654, -11230, -11588, -7586, -724, 6414, 11134, 11648, 7755, 922,
+    -6264, -11075, -11680, -7840, -1012, 6205, 11057, 11685, 7842, 993, -6240, -11081, -11666, -7761, -865, 6368,
+    11146, 11619, 7596, 629, -6586, -11247, -11539, -7342, -283, 6890, 11377, 11420, 6995, -172, -7275, -11526,
+    -11249, -6547, 736, 7732, 11680, 11015, 5992, -1406, -8250, -11823, -10701, -5322, 2179, 8815, 11936, 10291,
+    4529, -3048, -9408, -11996, -9767, -3610, 4004, 10008, 11977, 9111, 2560, -5031, -10586, -11851, -8304, -1380,
+    6108, 11112, 11587, 7332, 78, -7211, -11550, -11156, -6183, 1333, 8304, 11860, 10528, 4851, -2832, -9348,
+    -11997, -9676, -3340, 4387, 10293, 11918, 8579, 1660, -5955, -11085, -11579, -7223, 163, 7484, 11664, 10940,
+    5608, -2089, -8909, -11969, -9969, -3748, 4064, 10156, 11938, 8645, 1673, -6016, -11142, -11515, -6967, 564,
+    7856, 11784, 10657, 4951, -2886, -9485, -11999, -9338, -2643, 5197, 10793, 11715, 7558, 118, -7377, -11666,
+    -10877, -5347, 2519, 9289, 11999, 9459, 2773, -5133, -10788, -11704, -7471, 54, 7559, 11731, 10722, 4971,
+    -2984, -9620, -11991, -9038, -2066, 5829, 11130, 11471, 6692, -1080, -8372, -11919, -10125, -3788, 4253, 10386,
+    11848, 7972, 500, -7201, -11652, -10834, -5110, 2933, 9648, 11985, 8874, 1723, -6216, -11324, -11264, -6058,
+    1922, 9025, 11995, 9463, 2584, -5486, -11035, -11503, -6667, 1249, 8591, 11963, 9798, 3091, -5052, -10853,
+    -11612, -6968, 924, 8388, 11941, 9917, 3254, -4934, -10814, -11625, -6978, 951, 8435, 11951, 9834, 3077,
+    -5137, -10925, -11546, -6698, 1329, 8728, 11983, 9541, 2555, -5651, -11165, -11351, -6111, 2055, 9240, 11999,
+    9001, 1679, -6453, -11484, -10984, -5188, 3115, 9916, 11925, 8161, 442, -7495, -11797, -10367, -3893, 4479,
+    10671, 11660, 6955, -1153, -8699, -11988, -9401, -2199, 6086, 11382, 11078, 5317, -3069, -9943, -11908, -7983,
+    -106, 7828, 11882, 10039, 3206, -5225, -11057, -11381, -6027, 2339, 9539, 11970, 8407, 629, -7468, -11818,
+    -10228, -3490, 5008, 10985, 11421, 6088, -2326, -9565, -11962, -8294, -415, 7678, 11870, 10022, 3067, -5455,
+    -11196, -11219, -5504, 3031, 10016, 11867, 7626, -535, -8424, -11979, -9363, -1916, 6523, 11595, 10671, 4222,
+    -4417, -10769, -11532, -6301, 2209, 9572, 11950, 8095, 11, -8081, -11949, -9562, -2162, 6375, 11568, 10683,
+    4178, -4530, -10854, -11454, -6007, 2618, 9861, 11885, 7611, -702, -8646, -11998, -8968, -1162, 7266, 11822,
+    10067, 2931, -5775, -11393, -10907, -4570, 4223, 10750, 11497, 6054, -2654, -9933, -11853, -7368, 1104, 8982,
+    11995, 8504, 395, -7932, -11948, -9461, -1818, 6819, 11738, 10245, 3149, -5673, -11391, -10864, -4374, 4521,
+    10934, 11331, 5487, -3385, -10392, -11662, -6485, 2283, 9790, 11872, 7367, -1230, -9147, -11978, -8139, 238,
+    8485, 11998, 8806, 687, -7820, -11947, -9375, -1538, 7166, 11843, 9855, 2314, -6535, -11699, -10255, -3011,
+    5939, 11528, 10583, 3632, -5385, -11344, -10850, -4177, 4880, 11156, 11064, 4648, -4429, -10973, -11232, -5048,
+    4036, 10805, 11361, 5378, -3706, -10656, -11459, -5642, 3438, 10533, 11529, 5842, -3236, -10439, -11576, -5980,
+    3101, 10378, 11604, 6056, -3033, -10351, -11613, -6072, 3032, 10359, 11604, 6027, -3098, -10402, -11577, -5922,
+    3232, 10479, 11531, 5756, -3432, -10587, -11461, -5526, 3697, 10723, 11364, 5230, -4027, -10882, -11236, -4867,
+    4417, 11058, 11069, 4434, -4867, -11244, -10857, -3929, 5370, 11432, 10591, 3348, -5923, -11611, -10264, -2691,
+    6519, 11771, 9867, 1956, -7148, -11898, -9389, -1145, 7802, 11979, 8823, 258, -8467, -11998, -8159, 699,
+    9130, 11940, 7390, -1721, -9773, -11786, -6510, 2799, 10377, 11522, 5516, -3919, -10920, -11128, -4406, 5065,
+    11380, 10591, 3184, -6218, -11730, -9895, -1856, 7351, 11944, 9030, 434, -8438, -11996, -7989, 1063, 9446,
+    11859, 6768, -2612, -10339, -11509, -5372, 4181, 11078, 10926, 3813, -5734, -11625, -10093, -2109, 7227, 11939,
+    9001, 290, -8610, -11982, -7651, 1605, 9830, 11723, 6053, -3526, -10830, -11133, -4230, 5415, 11553, 10197,
+    2219, -7204, -11944, -8910, -71, 8818, 11955, 7285, -2149, -10180, -11549, -5350, 4359, 11210, 10700, 3155,
+    -6468, -11835, -9404, -770, 8376, 11991, 7679, -1716, -9978, -11628, -5566, 4194, 11170, 10721, 3136, -6540,
+    -11859, -9269, -489, 8621, 11968, 7306, -2252, -10303, -11444, -4901, 4938, 11458, 10268, 2161, -7406, -11979,
+    -8464, 773, 9490, 11786, 6098, -3726, -11025, -10839, -3286, 6504, 11870, 9151, 191, -8901, -11918, -6790,
+    2984, 10719, 11112, 3886, -6008, -11780, -9457, -628, 8636, 11953, 7030, -2746, -10628, -11167, -3982, 5962,
+    11779, 9431, 538, -8731, -11935, -6838, 3020, 10778, 11024, 3578, -6369, -11867, -9068, 80, 9174, 11840,
+    6199, -3796, -11127, -10635, -2657, 7194, 11977, 8312, -1223, -9897, -11575, -5062, 5038, 11570, 9897, 1197,
+    -8356, -11971, -7068, 2870, 10765, 10984, 3363, -6663, -11929, -8661, 809, 9703, 11640, 5224, -4946, -11564,
+    -9865, -1063, 8507, 11947, 6766, -3302, -10987, -10727, -2702, 7283, 11991, 8001, -1800, -10296, -11307, -4089,
+    6108, 11857, 8958, -481, -9572, -11667, -5226, 5044, 11620, 9676, 630, -8882, -11868, -6124, 4130, 11344,
+    10196, 1524, -8276, -11963, -6803, 3393, 11079, 10555, 2200, -7790, -11996, -7283, 2850, 10864, 10784, 2662,
+    -7450, -12000, -7581, 2510, 10725, 10907, 2912, -7271, -11997, -7709, 2377, 10677, 10938, 2954, -7260, -11997,
+    -7672, 2454, 10727, 10880, 2789, -7419, -12000, -7470, 2739, 10867, 10726, 2415, -7739, -11993, -7092, 3229,
+    11084, 10461, 1828, -8208, -11953, -6525, 3915, 11349, 10057, 1023, -8801, -11844, -5750, 4784, 11625, 9481,
+    0, -9483, -11621, -4748, 5812, 11861, 8694, -1236, -10206, -11230, -3500, 6961, 11992, 7656, -2667, -10906,
+    -10609, -2000, 8180, 11944, 6330, -4259, -11502, -9695, -253, 9392, 11632, 4691, -5956, -11899, -8431, 1712,
+    10501, 10968, 2734, -7673, -11987, -6772, 3833, 11388, 9872, 483, -9294, -11652, -4699, 6013, 11916, 8277,
+    -1996, -10672, -10784, -2235, 8113, 11938, 6154, -4588, -11635, -9298, 546, 9951, 11314, 3524, -7121, -12000,
+    -7151, 3502, 11314, 9935, 478, -9371, -11592, -4367, 6420, 11972, 7748, -2809, -11071, -10275, -1064, 9021,
+    11711, 4790, -6067, -11940, -7994, 2533, 10977, 10375, 1216, -8950, -11725, -4809, 6087, 11947, 7912, -2682,
+    -11055, -10252, -933, 9164, 11640, 4426, -6477, -11984, -7494, 3253, 11285, 9885, 214, -9638, -11418, -3625,
+    7211, 11996, 6703, -4227, -11603, -9213, 941, 10304, 10975, 2381, -8228, -11882, -5484, 5559, 11895, 8147,
+    -2515, -11044, -10191, -674, 9420, 11495, 3777, -7164, -11995, -6586, 4452, 11686, 8923, -1480, -10618, -10654,
+    -1549, 8888, 11692, 4443, -6630, -11997, -7030, 4000, 11582, 9166, -1170, -10496, -10744, -1690, 8831, 11698,
+    4417, -6700, -12000, -6869, 4239, 11659, 8924, -1591, -10721, -10494, -1100, 9258, 11520, 3699, -7365, -11975,
+    -6083, 5151, 11862, 8149, -2733, -11212, -9818, 229, 10077, 11033, 2246, -8529, -11763, -4588, 6652, 12000,
+    6708, -4538, -11757, -8530, 2283, 11067, 9999, 21, -9978, -11077, -2286, 8549, 11744, 4433, -6848, -11997,
+    -6392, 4949, 11849, 8108, -2923, -11327, -9537, 843, 10466, 10652, 1224, -9312, -11434, -3217, 7914, 11881,
+    5082, -6326, -11997, -6776, 4604, 11800, 8262, -2799, -11312, -9515, 963, 10564, 10517, 856, -9590, -11261,
+    -2618, 8427, 11745, 4285, -7112, -11976, -5828, 5684, 11965, 7222, -4181, -11729, -8450, 2637, 11288, 9499,
+    -1084, -10666, -10363, -448, 9885, 11039, 1934, -8972, -11531, -3352, 7952, 11844, 4685, -6850, -11987, -5919,
+    5688, 11973, 7043, -4490, -11814, -8051, 3275, 11525, 8939, -2061, -11122, -9705, 864, 10620, 10351, 303,
+    -10034, -10881, -1428, 9380, 11299, 2502, -8672, -11612, -3518, 7924, 11828, 4470, -7148, -11954, -5356, 6357,
+    12000, 6173, -5559, -11973, -6921, 4766, 11884, 7600, -3983, -11742, -8212, 3219, 11554, 8760, -2479, -11329,
+    -9246, 1768, 11075, 9674, -1089, -10800, -10049, 446, 10510, 10373, 159, -10212, -10652, -725, 9911, 10890,
+    1249, -9612, -11090, -1733, 9321, 11258, 2175, -9041, -11397, -2576, 8775, 11511, 2936, -8528, -11604, -3255,
+    8302, 11678, 3535, -8099, -11736, -3775, 7921, 11781, 3976, -7770, -11815, -4139, 7647, 11840, 4265, -7553,
+    -11857, -4354, 7489, 11867, 4406, -7456, -11872, -4422, 7453, 11870, 4401, -7481, -11863, -4343, 7539, 11850,
+    4249, -7628, -11829, -4117, 7745, 11800, 3948, -7891, -11761, -3741, 8064, 11709, 3495, -8263, -11644, -3210,
+    8485, 11562, 2884, -8729, -11459, -2518, 8991, 11334, 2111, -9269, -11181, -1663, 9558, 10998, 1173, -9856,
+    -10780, -642, 10157, 10523, 71, -10456, -10222, 540, 10748, 9874, -1189, -11026, -9474, 1872, 11285, 9019,
+    -2588, -11515, -8503, 3332, 11710, 7925, -4100, -11862, -7280, 4884, 11961, 6568, -5679, -12000, -5787, 6476,
+    11968, 4936, -7266, -11857, -4018, 8038, 11659, 3034, -8781, -11364, -1990, 9482, 10966, 890, -10127, -10457,
+    256, 10701, 9832, -1439, -11189, -9088, 2646, 11577, 8223, -3863, -11847, -7237, 5073, 11985, 6133, -6256,
+    -11976, -4919, 7392, 11808, 3603, -8457, -11469, -2199, 9428, 10949, 724, -10281, -10245, 801, 10988, 9353,
+    -2352, -11526, -8277, 3900, 11870, 7023, -5414, -11999, -5605, 6858, 11895, 4042, -8196, -11543, -2358, 9390,
+    10934, 586, -10402, -10064, 1239, 11194, 8939, -3073, -11731, -7571, 4869, 11984, 5981, -6575, -11926, -4199,
+    8137, 11541, 2266, -9502, -10820, -230, 10615, 9766, -1851, -11428, -8392, 3914, 11896, 6726, -5887, -11985,
+    -4807, 7700, 11670, 2691, -9278, -10941, -442, 10551, 9803, -1862, -11454, -8278, 4133, 11933, 6407, -6280,
+    -11947, -4248, 8207, 11472, 1880, -9822, -10505, 606, 11038, 9065, -3104, -11782, -7195, 5499, 11996, 4964,
+    -7672, -11646, -2462, 9508, 10724, -198, -10897, -9250, 2886, 11750, 7278, -5461, -11996, -4891, 7780, 11596,
+    2204, -9702, -10546, 643, 11100, 8878, -3492, -11870, -6667, 6171, 11941, 4024, -8510, -11280, -1098, 10347,
+    9899, -1935, -11545, -7861, 4881, 11998, 5277, -7536, -11648, -2301, 9708, 10488, -871, -11224, -8572, 4019,
+    11950, 6011, -6910, -11803, -2972, 9318, 10763, -327, -11038, -8880, 3639, 11912, 6272, -6699, -11839, -3128,
+    9246, 10792, -310, -11050, -8827, 3760, 11932, 6081, -6922, -11783, -2773, 9505, 10582, -820, -11256, -8405,
+    4375, 11986, 5423, -7558, -11593, -1896, 10050, 10079, -1851, -11586, -7559, 5453, 11982, 4255, -8539, -11163,
+    -482, 10776, 9178, -3378, -11900, -6201, 6915, 11759, 2526, -9734, -10329, 1463, 11501, 7734, -5324, -11985,
+    -4235, 8612, 11093, 212, -10926, -8891, 3872, 11963, 5605, -7527, -11560, -1607, 10293, 9728, -2626, -11798,
+    -6657, 6565, 11816, 2709, -9693, -10305, 1627, 11579, 7423, -5784, -11937, -3521, 9196, 10679, -894, -11375,
+    -7936, 5222, 11983, 4055, -8848, -10895, 437, 11233, 8223, -4901, -11996, -4321, 8678, 10983, -258, -11182,
+    -8302, 4833, 11997, 4325, -8699, -10956, 357, 11230, 8179, -5020, -11989, -4069, 8909, 10811, -736, -11369,
+    -7845, 5455, 11956, 3544, -9292, -10527, 1391, 11572, 7280, -6123, -11861, -2741, 9816, 10064, -2316, -11791,
+    -6455, 6994, 11650, 1649, -10430, -9374, 3495, 11959, 5337, -8023, -11252, -264, 11059, 8395, -4895, -11988,
+    -3894, 9137, 10582, -1402, -11607, -7069, 6455, 11772, 2111, -10238, -9549, 3310, 11950, 5346, -8083, -11191,
+    0, 11192, 8070, -5381, -11943, -3205, 9643, 10125, -2385, -11835, -6083, 7488, 11432, 668, -10957, -8472,
+    4931, 11978, 3574, -9444, -10268, 2174, 11808, 6171, -7453, -11429, -600, 11008, 8342, -5148, -11957, -3237,
+    9690, 10020, -2685, -11897, -5618, 7982, 11178, -205, -11322, -7658, 6010, 11825, 2177, -10321, -9310, 3894,
+    11997, 4372, -8990, -10554, 1740, 11750, 6316, -7426, -11397, -364, 11150, 7971, -5719, -11866, -2351, 10270,
+    9323, -3950, -11999, -4170, 9182, 10372, -2185, -11846, -5791, 7952, 11135, -478, -11458, -7197, 6643, 11639,
+    1129, -10887, -8385, 5305, 11915, 2611, -10184, -9363, 3983, 12000, 3948, -9394, -10146, 2710, 11931, 5135,
+    -8560, -10752, 1513, 11744, 6169, -7714, -11205, 408, 11473, 7057, -6887, -11530, -591, 11149, 7807, -6102,
+    -11749, -1478, 10798, 8430, -5378, -11886, -2249, 10446, 8939, -4729, -11962, -2906, 10110, 9346, -4165, -11994,
+    -3449, 9808, 9663, -3695, -12000, -3882, 9553, 9901, -3323, -11991, -4207, 9353, 10068, -3053, -11978, -4428,
+    9217, 10172, -2887, -11968, -4546, 9149, 10216, -2826, -11965, -4563, 9151, 10203, -2872, -11970, -4479, 9223,
+    10132, -3023, -11981, -4294, 9363, 10000, -3278, -11994, -4004, 9566, 9801, -3636, -12000, -3609, 9825, 9528,
+    -4093, -11989, -3103, 10129, 9171, -4644, -11947, -2486, 10466, 8718, -5282, -11857, -1753, 10819, 8159, -5996,
+    -11701, -906, 11169, 7479, -6774, -11457, 56, 11491, 6667, -7596, -11101, 1125, 11758, 5713, -8441, -10610,
+    2293, 11939, 4609, -9279, -9960, 3543, 12000, 3352, -10077, -9129, 4851, 11904, 1947, -10795, -8098, 6188,
+    11615, 405, -11387, -6853, 7512, 11097, -1252, -11804, -5391, 8776, 10318, -2991, -11994, -3716, 9919, 9251,
+    -4766, -11904, -1850, 10878, 7881, -6515, -11485, 173, 11582, 6208, -8167, -10696, 2298, 11957, 4248, -9636,
+    -9510, 4451, 11935, 2040, -10828, -7915, 6540, 11455, -351, -11645, -5926, 8456, 10473, -2833, -11994, -3589,
+    10075, 8971, -5290, -11790, -982, 11270, 6962, -7582, -10975, 1782, 11917, 4500, -9549, -9521, 4551, 11908,
+    1683, -11029, -7443, 7148, 11167, -1341, -11864, -4813, 9372, 9662, -4382, -11923, -1761, 11019, 7422, -7211,
+    -11118, 1523, 11897, 4548, -9581, -9424, 4793, 11857, 1216, -11243, -6898, 7763, 10811, -2323, -11979, -3688,
+    10132, 8759, -5756, -11632, -41, 11613, 5811, -8730, -10138, 3715, 11974, 2193, -10895, -7554, 7185, 11079,
+    -1758, -11940, -4074, 9954, 8923, -5615, -11651, -35, 11635, 5661, -8903, -9954, 4112, 11931, 1615, -11158,
+    -6955, 7835, 10695, -2740, -11999, -2961, 10596, 7980, -6823, -11203, 1541, 11929, 4068, -10021, -8765, 5920,
+    11532, -539, -11784, -4943, 9489, 9344, -5163, -11732, -253, 11617, 5599, -9045, -9750, 4579, 11845, 830,
+    -11467, -6051, 8717, 10009, -4183, -11902, -1194, 11364, 6312, -8527, -10140, 3983, 11924, 1344, -11325, -6388,
+    8485, 10156, -3984, -11920, -1282, 11355, 6283, -8593, -10057, 4186, 11889, 1007, -11451, -5994, 8846, 9834,
+    -4585, -11818, -519, 11596, 5511, -9228, -9471, 5172, 11683, -184, -11763, -4821, 9715, 8942, -5930, -11449,
+    1099, 11913, 3911, -10272, -8217, 6835, 11072, -2218, -11997, -2767, 10850, 7261, -7848, -10501, 3522, 11950,
+    1384, -11384, -6042, 8917, 9679, -4977, -11702, 231, 11797, 4537, -9967, -8552, 6529, 11173, -2053, -11995,
+    -2735, 10906, 7074, -8098, -10284, 4029, 11876, 653, -11620, -5217, 9575, 8965, -6074, -11334, 1662, 11981,
+    2984, -10827, -7168, 8063, 10272, -4116, -11852, -421, 11692, 4880, -9835, -8618, 6567, 11104, -2372, -11999,
+    -2145, 11194, 6343, -8821, -9638, 5228, 11585, -926, -11929, -3488, 10642, 7410, -7917, -10317, 4137, 11831,
+    181, -11765, -4458, 10148, 8134, -7209, -10735, 3345, 11938, 935, -11604, -5079, 9794, 8563, -6755, -10957,
+    2882, 11974, 1334, -11506, -5370, 9628, 8733, -6585, -11024, 2759, 11980, 1383, -11504, -5343, 9669, 8658,
+    -6708, -10948, 2978, 11961, 1080, -11597, -4997, 9913, 8332, -7117, -10716, 3536, 11896, 423, -11756, -4319,
+    10329, 7727, -7786, -10285, 4415, 11730, -587, -11922, -3286, 10857, 6798, -8663, -9589, 5582, 11379, -1943,
+    -12000, -1879, 11404, 5494, -9666, -8545, 6976, 10737, -3611, -11867, -91, 11840, 3768, -10673, -7068, 8493,
+    9682, -5522, -11373, 2047, 11998, 1601, -11513, -5086, 9978, 8092, -7546, -10355, 4450, 11683, -973, -11973,
+    -2574, 11213, 5879, -9485, -8661, 6951, 10691, -3838, -11806, 418, 11927, 3021, -11059, -6194, 9288, 8845,
+    -6770, -10768, 3720, 11820, -389, -11930, -2956, 11104, 6053, -9420, -8668, 7021, 10607, -4101, -11733, 887,
+    11976, 2376, -11331, -5447, 9859, 8106, -7680, -10165, 4962, 11489, -1906, -11996, -1267, 11662, 4336, -10525,
+    -7090, 8675, 9348, -6250, -10966, 3420, 11846, -380, -11944, -2668, 11266, 5527, -9868, -8017, 7851, 9987,
+    -5354, -11323, 2538, 11953, 417, -11850, -3330, 11034, 6027, -9566, -8351, 7544, 10174, -5095, -11397, 2367,
+    11962, 478, -11849, -3280, 11077, 5883, -9699, -8149, 7802, 9960, -5498, -11229, 2916, 11898, -197, -11943,
+    -2515, 11374, 5081, -10232, -7375, 8585, 9287, -6523, -10731, 4156, 11645, -1605, -11996, -1007, 11778, 3553,
+    -11013, -5919, 9746, 7999, -8046, -9704, 5997, 10966, -3697, -11740, 1252, 12000, 1230, -11747, -3642, 11002,
+    5886, -9806, -7872, 8218, 9525, -6310, -10785, 4165, 11611, -1873, -11980, -475, 11887, 2788, -11347, -4979,
+    10390, 6971, -9059, -8694, 7412, 10093, -5514, -11127, 3438, 11766, -1260, -11999, -944, 11827, 3100, -11264,
+    -5137, 10340, 6991, -9091, -8609, 7566, 9944, -5818, -10963, 3908, 11642, -1896, -11968, -156, 11942, 2185,
+    -11573, -4135, 10879, 5953, -9889, -7591, 8638, 9009, -7166, -10175, 5518, 11066, -3741, -11664, 1886, 11963,
+    0, -11963, -1869, 11673, 3675, -11107, -5378, 10287, 6940, -9239, -8330, 7992, 9520, -6581, -10491, 5041,
+    11228, -3410, -11721, 1723, 11968, -19, -11971, -1669, 11738, 3307, -11279, -4864, 10611, 6314, -9753, -7633,
+    8727, 8800, -7557, -9800, 6268, 10620, -4886, -11253, 3438, 11693, -1951, -11940, 449, 11996, 1042, -11868,
+    -2500, 11563, 3904, -11092, -5234, 10468, 6475, -9706, -7611, 8820, 8631, -7829, -9525, 6749, 10286, -5597,
+    -10909, 4391, 11391, -3149, -11733, 1886, 11934, -619, -12000, -637, 11934, 1870, -11742, -3066, 11433, 4213,
+    -11013, -5303, 10493, 6325, -9881, -7274, 9188, 8143, -8424, -8928, 7599, 9625, -6724, -10231, 5808, 10747,
+    -4862, -11172, 3895, 11506, -2916, -11753, 1932, 11913, -953, -11991, -16, 11990, 967, -11914, -1895, 11768,
+    2794, -11557, -3660, 11285, 4490, -10958, -5280, 10582, 6027, -10161, -6730, 9700, 7387, -9206, -7997, 8682,
+    8560, -8133, -9075, 7565, 9543, -6981, -9965, 6386, 10342, -5784, -10675, 5177, 10966, -4570, -11216, 3966,
+    11427, -3366, -11601, 2775, 11740, -2193, -11848, 1623, 11925, -1067, -11974, 526, 11997, -1, -11997, -507,
+    11976, 996, -11936, -1466, 11880, 1916, -11809, -2347, 11725, 2758, -11630, -3148, 11527, 3519, -11417, -3869,
+    11301, 4199, -11181, -4510, 11059, 4801, -10937, -5072, 10814, 5326, -10693, -5560, 10575, 5777, -10461, -5976,
+    10352, 6158, -10248, -6324, 10151, 6473, -10060, -6606, 9978, 6724, -9903, -6826, 9838, 6913, -9781, -6986,
+    9735, 7044, -9698, -7088, 9671, 7117, -9654, -7133, 9648, 7135, -9652, -7122, 9666, 7095, -9691, -7055,
+    9726, 7000, -9771, -6930, 9825, 6846, -9888, -6747, 9961, 6633, -10042, -6503, 10130, 6357, -10226, -6196,
+    10329, 6017, -10437, -5822, 10550, 5609, -10668, -5378, 10788, 5129, -10910, -4861, 11033, 4574, -11155, -4268,
+    11275, 3942, -11392, -3596, 11504, 3230, -11609, -2844, 11705, 2438, -11792, -2011, 11866, 1565, -11926, -1099,
+    11969, 614, -11994, -110, 11999, -411, -11981, 948, 11938, -1501, -11867, 2069, 11766, -2648, -11634, 3238,
+    11467, -3836, -11264, 4439, 11023, -5046, -10742, 5653, 10418, -6257, -10051, 6854, 9638, -7440, -9180, 8012,
+    8675, -8565, -8123, 9095, 7523, -9596, -6876, 10064, 6183, -10494, -5445, 10881, 4664, -11219, -3843, 11503,
+    2984, -11728, -2092, 11888, 1170, -11980, -223, 11997, -742, -11937, 1720, 11794, -2703, -11567, 3684, 11252,
+    -4655, -10847, 5606, 10351, -6529, -9763, 7414, 9086, -8250, -8320, 9028, 7469, -9737, -6537, 10368, 5530,
+    -10909, -4454, 11351, 3318, -11685, -2132, 11903, 906, -11997, 346, 11960, -1612, -11788, 2877, 11477, -4125,
+    -11025, 5340, 10432, -6505, -9701, 7602, 8835, -8614, -7842, 9524, 6730, -10314, -5511, 10969, 4198, -11475,
+    -2809, 11816, 1361, -11984, 125, 11968, -1627, -11763, 3119, 11364, -4578, -10773, 5976, 9993, -7287, -9031,
+    8485, 7899, -9545, -6611, 10441, 5188, -11151, -3651, 11657, 2028, -11940, -349, 11989, -1355, -11796, 3048,
+    11355, -4695, -10671, 6258, 9750, -7700, -8605, 8985, 7256, -10079, -5729, 10951, 4053, -11573, -2266, 11925,
+    407, -11988, 1479, 11754, -3345, -11220, 5143, 10392, -6823, -9284, 8337, 7917, -9640, -6324, 10689, 4541,
+    -11449, -2616, 11891, 598, -11992, 1453, 11742, -3479, -11139, 5417, 10192, -7205, -8923, 8783, 7363, -10096,
+    -5555, 11094, 3553, -11737, -1417, 11996, -783, -11851, 2973, 11299, -5078, -10349, 7021, 9026, -8728, -7368,
+    10132, 5429, -11174, -3275, 11808, 981, -11998, 1367, 11730, -3679, -11001, 5863, 9832, -7830, -8260, 9494,
+    6341, -10780, -4145, 11626, 1761, -11988, 715, 11840, -3177, -11176, 5518, 10016, -7629, -8402, 9413, 6396,
+    -10780, -4084, 11658, 1567, -11997, 1041, 11770, -3616, -10975, 6033, 9642, -8170, -7824, 9916, 5604, -11174,
+    -3086, 11871, 395, -11960, 2335, 11425, -4958, -10283, 7334, 8582, -9329, -6406, 10828, 3865, -11737, -1093,
+    11995, -1756, -11576, 4523, 10492, -7046, -8792, 9172, 6566, -10769, -3938, 11733, 1057, -11992, 1904, 11520,
+    -4766, -10333, 7347, 8491, -9480, -6102, 11022, 3309, -11862, -285, 11934, -2774, -11221, 5666, 9756, -8194,
+    -7626, 10181, 4965, -11482, -1947, 11994, -1222, -11670, 4323, 10518, -7132, -8607, 9443, 6064, -11080, -3064,
+    11911, -177, -11862, 3423, 10922, -6427, -9150, 8956, 6667, -10808, -3655, 11829, 342, -11924, 3015, 11073,
+    -6147, -9328, 8800, 6819, -10748, -3739, 11822, 334, -11918, 3115, 11013, -6318, -9171, 8998, 6534, -10917,
+    -3319, 11896, -201, -11835, 3720, 10726, -6924, -8652, 9521, 5787, -11266, -2380, 11987, -1261, -11602, 4802,
+    10132, -7909, -7700, 10281, 4525, -11681, -901, 11961, -2827, -11077, 6295, 9100, -9157, -6213, 11120, 2691,
+    -11973, 1118, 11616, -4830, -10068, 8062, 7474, -10471, -4090, 11795, 261, -11880, 3612, 10699, -7115, -8363,
+    9865, 5111, -11553, -1286, 11979, -2697, -11080, 6396, 8939, -9393, -5782, 11339, 1954, -12000, 2113, 11282,
+    -5952, -9251, 9113, 6129, -11216, -2271, 11998, -1873, -11349, 5809, 9330, -9057, -6169, 11214, 2240, -11999,
+    1981, 11300, -5973, -9185, 9230, 5905, -11332, -1861, 11996, -2437, -11121, 6436, 8801, -9614, -5322, 11542,
+    1129, -11953, 3229, 10772, -7173, -8140, 10164, 4397, -11785, -40, 11799, -4338, -10186, 8132, 7150, -10805,
+    -3101, 11969, -1400, -11440, 5719, 9276, -9234, -5770, 11428, 1415, -11967, 3163, 10754, -7291, -7949, 10354,
+    3951, -11881, 653, 11627, -5175, -9610, 8926, 6119, -11322, -1675, 11980, -3044, -10778, 7305, 7884, -10432,
+    -3737, 11919, -1018, -11512, 5626, 9255, -9343, -5494, 11558, 826, -11891, 3994, 10268, -8170, -6939, 11001,
+    2441, -12000, 2483, 10979, -7002, -8090, 10344, 3809, -11922, 1142, 11446, -5911, -8978, 9664, 4930, -11732,
+    0, 11731, -4946, -9641, 9024, 5816, -11492, -929, 11887, -4142, -10116, 8472, 6483, -11255, -1641, 11961,
+    -3521, -10438, 8041, 6950, -11059, -2138, 11990, -3097, -10635, 7754, 7233, -10931, -2421, 11998, -2876, -10725,
+    7626, 7341, -10887, -2495, 11999, -2862, -10718, 7662, 7280, -10932, -2360, 11995, -3055, -10613, 7860, 7047,
+    -11060, -2015, 11977, -3452, -10399, 8212, 6633, -11257, -1455, 11926, -4046, -10056, 8699, 6023, -11494, -680,
+    11809, -4827, -9555, 9295, 5200, -11733, 312, 11585, -5771, -8861, 9958, 4146, -11923, 1514, 11202, -6848,
+    -7936, 10637, 2848, -12000, 2908, 10602, -8008, -6742, 11261, 1301, -11889, 4461, 9723, -9186, -5251, 11745,
+    -482, -11508, 6116, 8509, -10293, -3447, 11989, -2464, -10771, 7790, 6913, -11217, -1342, 11884, -4576, -9601,
+    9370, 4914, -11830, 1019, 11317, -6711, -7936, 10712, 2526, -11989, 3546, 10189, -8720, -5754, 11649, -187,
+    -11553, 6094, 8431, -10416, -3082, 12000, -3097, -10402, 8467, 6024, -11584, -19, 11593, -6007, -8466, 10418,
+    3028, -11999, 3251, 10295, -8652, -5748, 11675, -403, -11462, 6456, 8046, -10717, -2362, 11970, -4002, -9838,
+    9246, 4902, -11865, 1449, 11088, -7398, -7112, 11223, 1065, -11797, 5306, 8926, -10138, -3429, 11999, -3094,
+    -10314, 8714, 5557, -11750, 871, 11271, -7053, -7397, 11119, 1274, -11821, 5250, 8918, -10185, -3274, 12000,
+    -3391, -10113, 9022, 5081, -11858, 1547, 10991, -7705, -6667, 11449, 227, -11576, 6300, 8018, -10831, -1888,
+    11900, -4863, -9136, 10058, 3408, -12000, 3441, 10032, -9181, -4772, 11917, -2072, -10724, 8245, 5971, -11690,
+    784, 11235, -7290, -7007, 11357, 405, -11592, 6348, 7888, -10954, -1482, 11820, -5445, -8624, 10511, 2441,
+    -11947, 4603, 9229, -10056, -3278, 11996, -3836, -9717, 9612, 3996, -11992, 3157, 10105, -9198, -4598, 11953,
+    -2574, -10406, 8831, 5088, -11896, 2091, 10632, -8521, -5471, 11836, -1713, -10795, 8278, 5752, -11784, 1441,
+    10902, -8110, -5935, 11747, -1277, -10962, 8020, 6021, -11731, 1221, 10976, -8010, -6013, 11738, -1273, -10945,
+    8082, 5911, -11766, 1434, 10869, -8232, -5712, 11812, -1702, -10742, 8458, 5414, -11870, 2077, 10557, -8753,
+    -5014, 11930, -2556, -10304, 9108, 4505, -11978, 3137, 9973, -9513, -3884, 12000, -3813, -9550, 9951, 3146,
+    -11976, 4577, 9020, -10405, -2288, 11886, -5417, -8369, 10853, 1310, -11705, 6318, 7581, -11268, -214, 11407,
+    -7259, -6645, 11620, -993, -10966, 8214, 5549, -11875, 2297, 10355, -9151, -4289, 11996, -3677, -9550, 10031,
+    2867, -11941, 5104, 8530, -10808, -1293, 11673, -6539, -7280, 11432, -414, -11152, 7934, 5795, -11848, 2219,
+    10344, -9230, -4081, 12000, -4076, -9225, 10359, 2160, -11832, 5924, 7780, -11248, -71, 11295, -7685, -6012,
+    11820, -2128, -10351, 9271, 3947, -11998, 4357, 8978, -10582, -1632, 11714, -6515, -7177, 11516, -856, -10916,
+    8485, 4979, -11971, 3412, 9575, -10136, -2449, 11858, -5903, -7695, 11332, -311, -11111, 8174, 5319, -11944,
+    3159, 9698, -10055, -2540, 11863, -5921, -7635, 11375, -501, -11015, 8394, 4993, -11977, 3614, 9376, -10363,
+    -1907, 11737, -6567, -6990, 11622, -1425, -10588, 9105, 3976, -11993, 4748, 8535, -10967, -534, 11355, -7763,
+    -5675, 11917, -3058, -9672, 10159, 2206, -11780, 6466, 7014, -11638, 1578, 10470, -9321, -3569, 11964, -5303,
+    -8026, 11265, -352, -11001, 8547, 4627, -11999, 4336, 8755, -10887, -600, 11335, -7905, -5397, 11961, -3603,
+    -9246, 10571, 1271, -11529, 7442, 5898, -11906, 3124, 9535, -10361, -1662, 11623, -7185, -6148, 11871, -2911,
+    -9646, 10285, 1775, -11643, 7148, 6157, -11875, 2969, 9589, -10351, -1613, 11593, -7335, -5925, 11915, -3296,
+    -9360, 10551, 1173, -11460, 7734, 5443, -11970, 3885, 8939, -10861, -453, 11213, -8322, -4694, 12000, -4721,
+    -8291, 11236, -548, -10803, 9059, 3658, -11945, 5777, 7376, -11612, 1821, 10167, -9885, -2318, 11725, -7006,
+    -6147, 11902, -3342, -9234, 10715, 669, -11248, 8336, 4568, -11997, 5061, 7930, -11435, 1271, 10410, -9659,
+    -2618, 11771, -6892, -6197, 11905, -3445, -9111, 10835, 313, -11088, 8703, 4003, -11962, 5749, 7270, -11684,
+    2278, 9819, -10314, -1368, 11434, -8013, -4853, 12000, -5017, -7868, 11498, -1612, -10166, 10006, 1895, -11572,
+    7684, 5204, -11997, 4751, 8050, -11440, 1466, 10218, -9978, -1898, 11560, -7754, -5078, 12000, -4967, -7837,
+    11536, -1842, -9987, 10234, 1380, -11393, 8217, 4465, -11982, 5651, 7206, -11743, 2733, 9427, -10722, -331,
+    11001, -9014, -3336, 11851, -6755, -6092, 11949, -4107, -8440, 11320, -1245, -10252, 10028, 1653, -11445, 8175,
+    4417, -11972, 5887, 6899, -11834, 3310, 8974, -11062, 592, 10549, -9725, -2119, 11561, -7915, -4685, 11986,
+    -5741, -6986, 11826, -3325, -8923, 11115, -790, -10422, 9910, 1742, -11435, 8287, 4160, -11939, 6335, 6364,
+    -11936, 4152, 8274, -11451, 1837, 9825, -10524, -511, 10975, -9214, -2802, 11699, -7589, -4953, 11992, -5722,
+    -6894, 11866, -3691, -8568, 11345, -1575, -9934, 10468, 554, -10963, 9282, 2627, -11640, 7840, 4584, -11966,
+    6199, 6374, -11950, 4418, 7955, -11611, 2554, 9296, -10978, 663, 10375, -10085, -1207, 11181, -8970, -3010,
+    11711, -7673, -4706, 11969, -6235, -6264, 11968, -4699, -7658, 11723, -3104, -8869, 11256, -1486, -9886, 10592,
+    121, -10701, 9757, 1686, -11314, 8780, 3185, -11729, 7687, 4596, -11952, 6506, 5902, -11995, 5263, 7090,
+    -11871, 3983, 8150, -11595, 2688, 9078, -11185, 1399, 9872, -10656, 131, 10531, -10028, -1099, 11060, -9317,
+    -2278, 11463, -8539, -3398, 11748, -7711, -4450, 11923, -6848, -5428, 11996, -5962, -6330, 11978, -5066, -7153,
+    11879, -4171, -7898, 11709, -3287, -8565, 11478, -2422, -9157, 11196, -1582, -9676, 10873, -773, -10127, 10517,
+    0, -10515, 10137, 734, -10843, 9740, 1426, -11118, 9334, 2075, -11343, 8926, 2679, -11526, 8521, 3239,
+    -11670, 8124, 3754, -11781, 7739, 4224, -11864, 7372, 4651, -11923, 7025, 5036, -11962, 6702, 5380, -11986,
+    6404, 5683, -11997, 6135, 5948, -12000, 5896, 6175, -11997, 5688, 6367, -11990, 5512, 6523, -11982, 5371,
+    6645, -11973, 5263, 6733, -11967, 5191, 6789, -11963, 5154, 6812, -11961, 5152, 6803, -11963, 5185, 6762,
+    -11968, 5254, 6688, -11975, 5358, 6581, -11983, 5496, 6439, -11992, 5668, 6264, -11998, 5872, 6052, -12000,
+    6108, 5804, -11995, 6375, 5517, -11981, 6669, 5192, -11955, 6990, 4825, -11911, 7335, 4417, -11847, 7700,
+    3965, -11759, 8083, 3470, -11640, 8478, 2930, -11488, 8883, 2345, -11296, 9292, 1716, -11059, 9698, 1043,
+    -10773, 10096, 327, -10432, 10478, -430, -10030, 10837, -1223, -9564, 11164, -2050, -9028, 11451, -2905, -8420,
+    11688, -3782, -7735, 11865, -4673, -6973, 11972, -5570, -6131, 11998, -6461, -5212, 11935, -7336, -4216, 11772,
+    -8182, -3148, 11499, -8983, -2014, 11108, -9725, -822, 10593, -10392, 418, 9947, -10967, 1692, 9168, -11431,
+    2984, 8254, -11767, 4278, 7207, -11960, 5551, 6033, -11992, 6782, 4739, -11849, 7945, 3338, -11520, 9014,
+    1847, -10995, 9962, 288, -10268, 10760, -1316, -9340, 11381, -2934, -8212, 11799, -4534, -6896, 11990, -6078,
+    -5408, 11934, -7527, -3768, 11614, -8841, -2008, 11022, -9978, -163, 10152, -10896, 1725, 9012, -11558, 3608,
+    7614, -11929, 5432, 5982, -11980, 7141, 4151, -11691, 8678, 2162, -11050, 9983, 71, -10058, 11002, -2062,
+    -8727, 11684, -4165, -7083, 11987, -6165, -5168, 11881, -7984, -3036, 11346, -9544, -756, 10381, -10772, 1590,
+    9001, -11602, 3913, 7242, -11981, 6115, 5158, -11869, 8096, 2822, -11248, 9758, 327, -10121, 11011, -2221,
+    -8517, 11776, -4705, -6490, 11996, -7000, -4119, 11634, -8984, -1508, 10682, -10541, 1217, 9165, -11570, 3916,
+    7139, -11992, 6440, 4694, -11759, 8641, 1952, -10855, 10377, -939, -9306, 11525, -3813, -7180, 11993, -6492,
+    -4585, 11723, -8800, -1668, 10704, -10572, 1395, 8973, -11671, 4403, 6620, -11996, 7148, 3784, -11494, 9429,
+    648, -10172, 11062, -2572, -8095, 11905, -5641, -5391, 11866, -8319, -2246, 10914, -10385, 1111, 9095, -11651,
+    4417, 6523, -11988, 7400, 3387, -11335, 9798, -69, -9715, 11385, -3557, -7235, 11997, -6769, -4089, 11544,
+    -9407, -539, 10035, -11210, 3098, 7576, -11981, 6480, 4372, -11612, 9272, 710, -10105, 11180, -3058, -7575,
+    11983, -6555, -4248, 11566, -9410, -447, 9936, -11302, 3438, 7230, -11999, 6989, 3711, -11388, 9803, -253,
+    -9500, 11542, -4225, -6513, 11976, -7747, -2743, 11015, -10392, 1385, 8735, -11816, 5385, 5377, -11813, 8759,
+    1324, -10343, 11070, -2930, -7552, 11992, -6847, -3764, 11369, -9905, 550, 9241, -11677, 4827, 5856, -11887,
+    8485, 1642, -10466, 11002, -2835, -7571, 11994, -6949, -3575, 11279, -10097, 970, 8918, -11795, 5409, 5220,
+    -11752, 9075, 707, -9933, 11391, -3949, -6573, 11965, -8029, -2160, 10665, -10872, 2630, 7653, -11994, 7032,
+    3377, -11168, 10316, -1488, -8487, 11907, -6140, -4358, 11497, -9784, 546, 9109, -11765, 5391, 5115, -11699,
+    9323, 186, -9550, 11615, -4812, -5660, 11814, -8967, -705, 9838, -11491, 4417, 6007, -11873, 8741, 1009,
+    -9992, 11419, -4218, -6165, 11894, -8657, -1100, 10026, -11409, 4218, 6138, -11886, 8720, 978, -9941, 11465,
+    -4417, -5927, 11845, -8927, -643, 9732, -11575, 4812, 5525, -11757, 9265, 94, -9381, 11721, -5392, -4921,
+    11596, -9713, 668, 8866, -11870, 6141, 4101, -11327, 10238, -1640, -8157, 11978, -7033, -3053, 10905, -10794,
+    2809, 7221, -11989, 8029, 1768, -10278, 11322, -4151, -6027, 11836, -9075, -249, 9390, -11747, 5626, 4550,
+    -11445, 10098, -1486, -8191, 11982, -7172, -2780, 10737, -11003, 3396, 6636, -11924, 8699, 730, -9636, 11677,
+    -5408, -4705, 11471, -10092, 1554, 8083, -11992, 7412, 2408, -10523, 11206, -3983, -6046, 11813, -9264, 200,
+    9001, -11879, 6421, 3537, -11014, 10780, -3005, -6867, 11941, -8681, -630, 9499, -11753, 5831, 4142, -11235,
+    10530, -2524, -7228, 11974, -8435, -932, 9653, -11710, 5692, 4246, -11257, 10523, -2556, -7164, 11964, -8560,
+    -708, 9489, -11775, 6013, 3854, -11088, 10759, -3100, -6667, 11896, -9038, 43, 8978, -11909, 6771, 2949,
+    -10671, 11179, -4137, -5694, 11683, -9799, 1320, 8045, -12000, 7896, 1505, -9893, 11652, -5611, -4181, 11175,
+    -10706, 3094, 6578, -11865, 9254, -490, -8597, 11973, -7405, -2069, 10171, -11539, 5277, 4469, -11262, 10624,
+    -2984, -6618, 11863, -9306, 638, 8447, -11989, 7673, 1665, -9910, 11675, -5814, -3840, 10986, -10973, 3816,
+    5821, -11671, 9940, -1761, -7558, 11978, -8643, -280, 9019, -11932, 7147, 2243, -10186, 11571, -5516, -4081,
+    11055, -10936, 3810, 5754, -11633, 10074, -2081, -7237, 11938, -9031, 376, 8515, -11991, 7853, 1267, -9580,
+    11823, -6582, -2819, 10435, -11462, 5259, 4256, -11088, 10941, -3917, -5566, 11552, -10293, 2585, 6738, -11844,
+    9546, -1289, -7770, 11982, -8730, 47, 8662, -11987, 7870, 1126, -9422, 11881, -6990, -2220, 10056, -11684,
+    6108, 3228, -10574, 11416, -5243, -4146, 10989, -11095, 4407, 4975, -11312, 10739, -3612, -5714, 11556, -10362,
+    2867, 6367, -11733, 9980, -2179, -6939, 11855, -9604, 1553, 7433, -11933, 9244, -991, -7854, 11977, -8909,
+    497, 8209, -11997, 8606, -73, -8501, 11999, -8342, -283, 8736, -11992, 8122, 568, -8918, 11980, -7949,
+    -784, 9050, -11969, 7825, 929, -9134, 11960, -7754, -1005, 9172, -11957, 7736, 1012, -9165, 11959, -7771,
+    -949, 9112, -11967, 7858, 816, -9014, 11978, -7997, -614, 8867, -11990, 8186, 342, -8669, 11999, -8420,
+    0, 8417, -11998, 8696, -412, -8106, 11983, -9010, 893, 7731, -11944, 9353, -1441, -7287, 11873, -9719,
+    2056, 6770, -11760, 10099, -2733, -6173, 11595, -10481, 3467, 5494, -11364, 10852, -4253, -4727, 11057, -11199,
+    5082, 3871, -10661, 11506, -5943, -2924, 10162, -11754, 6823, 1889, -9551, 11925, -7705, -770, 8816, -11999,
+    8570, -426, -7949, 11954, -9396, 1687, 6944, -11770, 10158, -2996, -5798, 11427, -10828, 4334, 4514, -10906,
+    11375, -5674, -3100, 10192, -11768, 6984, 1568, -9272, 11976, -8231, 60, 8140, -11966, 9372, -1755, -6798,
+    11711, -10363, 3483, 5253, -11186, 11160, -5197, -3525, 10373, -11715, 6847, 1644, -9262, 11982, -8373, 349,
+    7856, -11921, 9713, -2401, -6169, 11500, -10801, 4447, 4231, -10694, 11571, -6411, -2088, 9496, -11962, 8209,
+    -196, -7916, 11922, -9754, 2541, 5982, -11413, 10955, -4852, -3746, 10415, -11728, 7021, 1286, -8930, 12000,
+    -8931, 1300, 6991, -11714, 10467, -3892, -4659, 10840, -11516, 6353, 2027, -9377, 11983, -8535, 781, 7364,
+    -11796, 10290, -3612, -4877, 10916, -11480, 6295, 2038, -9349, 11988, -8646, 996, 7147, -11731, 10483, -4031,
+    -4417, 10674, -11644, 6854, 1320, -8839, 11996, -9242, 1940, 6312, -11461, 10983, -5120, -3247, 10023, -11896,
+    7958, -140, -7744, 11853, -10195, 3582, 4766, -10800, 11597, -6780, -1314, 8770, -11989, 9427, -2324, -5894,
+    11275, -11238, 5808, 2403, -9460, 11989, -8786, 1389, 6667, -11542, 10921, -5106, -3133, 9881, -11941, 8343,
+    -799, -7120, 11673, -10715, 4708, 3514, -10079, 11905, -8140, 559, 7281, -11709, 10660, -4631, -3556, 10082,
+    -11909, 8194, -672, -7159, 11666, -10764, 4879, 3260, -9889, 11951, -8501, 1137, 6747, -11526, 11009, -5441,
+    -2618, 9475, -11995, 9033, -1949, -6021, 11244, -11348, 6292, 1619, -8792, 11977, -9737, 3094, 4944, -10747,
+    11701, -7383, -255, 7776, -11800, 10529, -4539, -3480, 9940, -11955, 8633, -1463, -6356, 11342, -11285, 6216,
+    1609, -8716, 11962, -9916, 3490, 4474, -10461, 11838, -8006, 657, 6978, -11548, 11056, -5725, -2107, 9015,
+    -11986, 9732, -3240, -4658, 10528, -11825, 7994, -702, -6891, 11501, -11143, 5978, 1761, -8738, 11954, -10034,
+    3808, 4047, -10166, 11933, -8600, 1597, 6083, -11169, 11499, -6941, -562, 7824, -11766, 10726, -5151, -2597,
+    9246, -11995, 9691, -3312, -4455, 10349, -11901, 8467, -1493, -6103, 11146, -11539, 7124, 254, -7523, 11664,
+    -10965, 5722, 1887, -8712, 11935, -10232, 4311, 3381, -9679, 11998, -9391, 2935, 4720, -10440, 11891, -8487,
+    1624, 5898, -11016, 11653, -7559, 401, 6916, -11431, 11322, -6641, -717, 7782, -11712, 10930, -5759, -1720,
+    8507, -11884, 10507, -4934, -2606, 9103, -11972, 10079, -4182, -3372, 9585, -12000, 9666, -3515, -4021, 9968,
+    -11986, 9288, -2942, -4557, 10265, -11949, 8958, -2468, -4983, 10487, -11903, 8688, -2097, -5304, 10645, -11860,
+    8485, -1833, -5524, 10747, -11827, 8356, -1675, -5646, 10798, -11811, 8304, -1625, -5671, 10801, -11814, 8331,
+    -1683, -5600, 10756, -11835, 8435, -1849, -5432, 10661, -11871, 8614, -2122, -5164, 10510, -11916, 8864, -2500,
+    -4793, 10296, -11961, 9175, -2982, -4316, 10009, -11993, 9539, -3562, -3727, 9638, -11997, 9942, -4236, -3022,
+    9169, -11955, 10368, -4994, -2199, 8587, -11846, 10795, -5824, -1257, 7880, -11646, 11200, -6710, -199, 7032,
+    -11331, 11555, -7630, 970, 6033, -10874, 11826, -8556, 2237, 4875, -10250, 11980, -9457, 3583, 3556, -9434,
+    11976, -10291, 4980, 2081, -8407, 11777, -11014, 6393, 464, -7154, 11343, -11575, 7774, -1271, -5671, 10640,
+    -11918, 9069, -3084, -3963, 9638, -11989, 10212, -4924, -2052, 8320, -11735, 11131, -6724, 23, 6682, -11107,
+    11752, -8404, 2205, 4737, -10072, 11999, -9871, 4415, 2526, -8613, 11801, -11026, 6554, 110, -6735, 11105,
+    -11767, 8507, -2416, -4475, 9875, -11998, 10144, -4934, -1903, 8109, -11637, 11331, -7299, 871, 5839, -10632,
+    11942, -9348, 3702, 3148, -8968, 11868, -10910, 6412, 162, -6680, 11034, -11823, 8797, -2939, -3861, 9417,
+    -11947, 10646, -5937, -668, 7056, -11189, 11755, -8580, 2680, 4067, -9521, 11958, -10611, 5913, 647, -7000,
+    11146, -11787, 8728, -2934, -3775, 9300, -11917, 10815, -6344, -99, 6507, -10891, 11897, -9219, 3691, 2973,
+    -8717, 11772, -11203, 7192, -976, -5535, 10348, -11995, 9978, -4919, -1636, 7688, -11402, 11653, -8373, 2561,
+    4022, -9387, 11919, -10860, 6535, -251, -6106, 10629, -11969, 9732, -4592, -1915, 7847, -11443, 11639, -8384,
+    2647, 3869, -9238, 11879, -11018, 6915, -783, -5576, 10296, -12000, 10194, -5412, -944, 7022, -11054, 11873,
+    -9246, 3943, 2499, -8214, 11555, -11564, 8244, -2556, -3862, 9169, -11848, 11136, -7245, 1289, 5030, -9914,
+    11979, -10644, 6293, -165, -6007, 10479, -11995, 10134, -5424, -805, 6805, -10895, 11937, -9644, 4663, 1614,
+    -7438, 11192, -11839, 9206, -4027, -2262, 7922, -11396, 11731, -8842, 3528, 2750, -8271, 11528, -11635, 8570,
+    -3174, -3082, 8498, -11605, 11568, -8402, 2969, 3262, -8610, 11638, -11539, 8344, -2916, -3289, 8611, -11633,
+    11553, -8398, 3015, 3166, -8503, 11587, -11607, 8563, -3265, -2890, 8281, -11495, 11694, -8832, 3663, 2459,
+    -7936, 11343, -11800, 9192, -4204, -1870, 7456, -11114, 11904, -9629, 4879, 1120, -6828, 10784, -11980, 10117,
+    -5675, -209, 6036, -10327, 11996, -10627, 6572, -860, -5065, 9711, -11912, 11121, -7542, 2077, 3904, -8906,
+    11684, -11552, 8547, -3423, -2547, 7882, -11265, 11865, -9539, 4867, 999, -6615, 10607, -11999, 10458, -6365,
+    723, 5090, -9663, 11888, -11230, 7855, -2584, -3307, 8397, -11463, 11773, -9258, 4527, 1284, -6785, 10663,
+    -11998, 10479, -6472, 933, 4824, -9436, 11816, -11409, 8316, -3269, -2541, 7752, -11144, 11930, -9930, 5617,
+    0, -5613, 9920, -11925, 11170, -7835, 2694, 3063, -8112, 11295, -11884, 9752, -5392, -197, 5737, -9967,
+    11928, -11181, 7900, -2833, -2870, 7922, -11185, 11930, -9994, 5818, -342, -5207, 9589, -11830, 11436, -8500,
+    3680, 1953, -7150, 10763, -11998, 10590, -6853, 1614, 3976, -8691, 11502, -11801, 9526, -5180, -289, 5691,
+    -9857, 11887, -11347, 8361, -3576, -1974, 7097, -10694, 12000, -10740, 7189, -2109, -3416, 8211, -11262, 11925,
+    -10067, 6084, -822, -4609, 9068, -11621, 11737, -9399, 5099, 261, -5562, 9704, -11828, 11500, -8792, 4270,
+    1129, -6292, 10157, -11935, 11264, -8288, 3621, 1781, -6817, 10462, -11980, 11068, -7917, 3167, 2218, -7152,
+    10644, -11995, 10940, -7696, 2916, 2443, -7311, 10720, -11998, 10896, -7637, 2871, 2458, -7299, 10700, -11997,
+    10940, -7742, 3033, 2264, -7117, 10580, -11987, 11067, -8006, 3400, 1859, -6756, 10349, -11953, 11263, -8417,
+    3965, 1240, -6205, 9986, -11868, 11498, -8953, 4718, 403, -5445, 9459, -11694, 11736, -9582, 5640, -648,
+    -4460, 8735, -11385, 11924, -10258, 6698, -1906, -3233, 7773, -10885, 12000, -10920, 7848, -3349, -1757, 6539,
+    -10132, 11888, -11494, 9027, -4936, -40, 5004, -9068, 11505, -11886, 10148, -6604, 1889, 3157, -7639, 10768,
+    -11993, 11104, -8262, 3971, 1012, -5814, 9597, -11702, 11768, -9788, 6111, -1378, -3589, 7932, -10905, 11999,
+    -11031, 8172, -3917, -1005, 5750, -9513, 11655, -11818, 9978, -6452, 1839, 3079, -7476, 10613, -11968, 11318,
+    -8779, 4776, 18, -4805, 8791, -11317, 11970, -10647, 7570, -3251, -1598, 6182, -9750, 11722, -11782, 9924,
+    -6455, 1943, 2881, -7235, 10418, -11920, 11505, -9245, 5505, -888, -3866, 8001, -10859, 11991, -11222, 8678,
+    -4766, 106, 4567, -8518, 11130, -11999, 10992, -8272, 4266, 398, -4997, 8818, -11274, 11988, -10855, 8055,
+    -4022, -623, 5170, -8923, 11314, -11983, 10833, -8044, 4040, 570, -5090, 8840, -11261, 11992, -10930, 8237,
+    -4319, -237, 4754, -8563, 11102, -12000, 11129, -8622, 4852, -374, -4154, 8072, -10811, 11974, -11399, 9173,
+    -5622, 1263, 3274, -7336, 10342, -11863, 11687, -9842, 6598, -2418, -2101, 6318, -9638, 11596, -11918, 10564,
+    -7730, 3816, 628, -4980, 8635, -11087, 11998, -11248, 8944, -5409, 1132, 3296, -7267, 10241, -11813, 11774,
+    -10132, 7116, -3139, -1260, 5484, -8965, 11238, -11999, 11153, -8817, 5306, -1092, -3264, 7182, -10145, 11766,
+    -11833, 10342, -7495, 3668, 636, -4852, 8432, -10912, 11973, -11482, 9507, -6307, 2298, 2003, -6042, 9305,
+    -11375, 11993, -11084, 8769, -5344, 1247, 3003, -6871, 9872, -11631, 11932, -10741, 8213, -4664, 540, 3647,
+    -7379, 10196, -11754, 11866, -10522, 7890, -4297, 184, 3948, -7596, 10320, -11793, 11841, -10463, 7829, -4258,
+    181, 3913, -7537, 10261, -11763, 11871, -10575, 8032, -4547, 531, 3544, -7199, 10011, -11653, 11938, -10839,
+    8485, -5154, 1232, 2828, -6559, 9535, -11418, 11996, -11208, 9148, -6053, 2276, 1753, -5581, 8778, -10987,
+    11964, -11604, 9951, -7194, 3641, 311, -4225, 7668, -10265, 11732, -11913, 10791, -8494, 5275, -1486, -2459,
+    6134, -9144, 11167, -11987, 11523, -9826, 7083, -3589, -283, 4120, -7518, 10119, -11651, 11958, -11011, 8912,
+    -5886, 2251, 1615, -5309, 8450, -10715, 11874, -11812, 10539, -8189, 5006, -1317, -2503, 6064, -9008, 11040,
+    -11957, 11673, -10218, 7744, -4499, 810, 2956, -6424, 9253, -11167, 11978, -11613, 10110, -7621, 4391, -737,
+    -2984, 6412, -9217, 11129, -11969, 11659, -10233, 7832, -4686, 1099, 2589, -6027, 8893, -10917, 11913, -11791,
+    10566, -8357, 5372, -1891, -1761, 5246, -8243, 10478, -11748, 11942, -11044, 9141, -6408, 3098, 489, -4027,
+    7199, -9720, 11367, -11996, 11554, -10084, 7721, -4677, 1223, 2334, -5682, 8528, -10624, 11790, -11929, 11031,
+    -9179, 6535, -3331, -156, 3625, -6779, 9351, -11124, 11949, -11761, 10578, -8505, 5719, -2456, -1008, 4384,
+    -7391, 9780, -11355, 11990, -11635, 10324, -8167, 5345, -2089, -1332, 4642, -7571, 9884, -11398, 11993, -11626,
+    10329, -8209, 5439, -2240, -1132, 4411, -7338, 9684, -11269, 11970, -11737, 10592, -8626, 5995, -2905, -405,
+    3680, -6668, 9144, -10919, 11863, -11907, 11050, -9361, 6971, -4061, 851, 2419, -5504, 8177, -10241, 11546,
+    -12000, 11572, -10297, 8271, -5646, 2614, 604, -3773, 6667, -9077, 10834, -11814, 11950, -11236, 9727, -7531,
+    4807, -1749, -1428, 4501, -7255, 9502, -11085, 11900, -11892, 11066, -9481, 7250, -4527, 1499, 1626, -4637,
+    7331, -9528, 11082, -11892, 11907, -11129, 9614, -7464, 4825, -1871, -1201, 4191, -6902, 9161, -10822, 11780,
+    -11976, 11402, -10096, 8146, -5679, 2854, 148, -3136, 5923, -8332, 10216, -11458, 11984, -11764, 10815, -9198,
+    7017, -4407, 1531, 1434, -4308, 6916, -9101, 10733, -11717, 11995, -11555, 10426, -8678, 6418, -3781, 925,
+    1981, -4767, 7270, -9346, 10875, -11772, 11988, -11512, 10377, -8648, 6429, -3848, 1051, 1800, -4546, 7032,
+    -9120, 10695, -11673, 12000, -11662, 10682, -9115, 7050, -4603, 1908, 886, -3628, 6169, -8375, 10127, -11335,
+    11936, -11902, 11236, -9978, 8196, -5986, 3467, -770, -1963, 4589, -6974, 8996, -10553, 11567, -11989, 11800,
+    -11013, 9671, -7843, 5624, -3127, 478, 2190, -4746, 7063, -9028, 10547, -11547, 11982, -11834, 11113, -9856,
+    8126, -6010, 3609, -1040, -1574, 4109, -6446, 8476, -10106, 11260, -11888, 11963, -11484, 10477, -8990, 7093,
+    -4876, 2441, 101, -2634, 5044, -7223, 9076, -10521, 11497, -11962, 11898, -11311, 10230, -8704, 6802, -4608,
+    2219, 262, -2727, 5071, -7195, 9010, -10441, 11429, -11934, 11940, -11447, 10479, -9079, 7306, -5236, 2955,
+    -558, -1858, 4195, -6357, 8260, -9829, 11001, -11734, 11999, -11790, 11116, -10008, 8510, -6683, 4600, -2343,
+};
+static const uint16_t WAKE_FEATURES_3[] = {
+    660, 607, 665, 608, 665, 604, 657, 595, 626, 547, 482, 0, 0, 0, 0, 378, 497, 416, 488, 476, 322, 328, 484, 0, 457, 266, 0, 0, 248, 446, 425, 460, 463, 0, 460, 466, 457, 501, 522, 499,
+    0, 0, 0, 0, 478, 539, 653, 607, 664, 606, 657, 593, 609, 516, 493, 438, 483, 451, 0, 410, 452, 334, 0, 471, 258, 447, 468, 480, 383, 450, 424, 395, 426, 453, 459, 452, 459, 399, 505, 501,
+    0, 0, 0, 0, 0, 0, 0, 0, 409, 533, 654, 609, 665, 603, 648, 565, 517, 432, 0, 0, 0, 0, 374, 462, 468, 460, 461, 453, 433, 0, 0, 292, 466, 462, 473, 378, 0, 258, 507, 486,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 555, 591, 665, 607, 659, 584, 566, 0, 0, 0, 457, 410, 325, 377, 437, 248, 472, 417, 0, 0, 390, 437, 448, 435, 458, 465, 511, 405,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 518, 657, 609, 663, 594, 584, 399, 448, 436, 404, 361, 445, 390, 427, 441, 402, 405, 425, 314, 440, 425, 494, 477, 497, 409,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 396, 643, 608, 662, 596, 565, 418, 0, 0, 0, 346, 236, 0, 0, 133, 412, 0, 390, 391, 509, 468, 497, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 280, 636, 608, 662, 588, 525, 0, 0, 0, 444, 364, 461, 407, 366, 0, 133, 465, 524, 411, 412, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 375, 643, 608, 659, 574, 461, 336, 466, 397, 395, 346, 448, 413, 503, 458, 500, 346, 414, 339,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 655, 607, 652, 504, 133, 0, 0, 0, 0, 415, 485, 436, 419, 0, 424, 374,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 562, 664, 605, 600, 0, 0, 0, 452, 461, 492, 292, 0, 0, 408, 364,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 570, 597, 664, 586, 430, 351, 494, 457, 459, 0, 0, 0, 306, 318,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 322, 638, 609, 652, 488, 494, 433, 381, 222, 406, 177, 177, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 564, 664, 599, 505, 0, 177, 0, 379, 292, 325, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 609, 605, 658, 402, 0, 0, 435, 248, 306, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 660, 601, 478, 287, 377, 0, 0, 297,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 598, 600, 658, 274, 0, 0, 344, 222,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 659, 597, 133, 0, 306, 236,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 610, 605, 647, 236, 351, 306,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 562, 662, 574, 392, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 630, 606, 536, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 525, 582, 661, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 509, 648, 599,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 606, 604,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 388, 570,
+};
+
+static const int16_t WAKE_PCM_4[] = {
+    -481, 6200, 11978, 16226, 19280, 20874, 18577, 16464, 11256, 6283, -154, -5783, -12014, -16024, -19401, -20648,
+    -18891, -15660, -11600, -6481, 81, 6410, 12113, 15833, 19230, 20105, 19011, 16184, 11552, 5994, 399, -6103,
+    -11900, -16928, -19284, -20152, -19406, -16579, -11508, -6255, -510, 5780, 11666, 16515, 18569, 20477, 18875, 15667,
+    11910, 6611, -67, -5986, -11851, -16184, -18522, -19731, -19382, -15340, -12062, -5926, 149, 6155, 11816, 16131,
+    19272, 19786, 18669, 16323, 12277, 6139, 511, -6207, -11289, -15891, -18864, -19719, -19272, -16151, -12227, -6714,
+    276, 6136, 12057, 16220, 18789, 20868, 19434, 16232, 11762, 6676, -97, -5723, -11559, -16577, -18798, -19665,
+    -18857, -15891, -11343, -6328, 676, 6229, 12006, 15706, 19324, 20217, 18846, 16385, 11907, 6481, 215, -6347,
+    -11739, -16690, -19015, -20155, -18700, -15778, -11563, -6736, 156, 5849, 11887, 16228, 18694, 19604, 19273, 16816,
+    11741, 6278, -164, -6261, -12258, -16155, -18964, -20092, -18989, -16287, -11354, -6203, 79, 6469, 11813, 16302,
+    18474, 19925, 19595, 16298, 12063, 6298, 565, -6405, -11998, -15983, -18785, -19905, -18932, -16380, -11445, -6169,
+    150, 6037, 12371, 16045, 19071, 19669, 18778, 16167, 11509, 6218, -252, -6144, -11747, -15811, -19173, -20330,
+    -19262, -16829, -12412, -5879, 638, 6065, 11783, 16045, 19307, 19948, 18984, 16134, 11270, 6429, -367, -5517,
+    -11352, -16123, -19840, -19989, -18800, -16068, -11950, -5575, 219, 6111, 12399, 16299, 19069, 20116, 19386, 16274,
+    11822, 6256, 570, -6157, -12161, -16412, -19168, -19676, -18669, -16281, -11755, -6269, -430, 5850, 11362, 16262,
+    19261, 19956, 18876, 16387, 11476, 5583, -22, -6083, -12081, -16611, -19231, -20420, -19114, -16266, -11714, -5913,
+    -9, 6347, 11887, 15694, 18948, 19673, 18667, 16198, 12070, 6367, 129, -5756, -11773, -16387, -19160, -20165,
+    -19598, -15818, -11808, -6216, -143, 6188, 11582, 16457, 18533, 20200, 19044, 16523, 12171, 6589, -1, -6444,
+    -11321, -16496, -18938, -20149, -18968, -15600, -11566, -6071, -16, 6299, 12007, 16359, 18755, 19809, 19034, 16411,
+    11887, 6133, -560, -6544, -11325, -16324, -18640, -19915, -19198, -16690, -11848, -6376, -355, 6074, 12166, 16690,
+    18457, 19914, 18913, 16278, 11982, 6289, 16, -6639, -12035, -16307, -19210, -20474, -19397, -15966, -12096, -6317,
+    -193, 6281, 11589, 15841, 18853, 20289, 19473, 16381, 11847, 6026, 177, -5716, -11201, -16588, -19303, -19270,
+    -19113, -15838, -11935, -5857, 403, 5726, 11082, 16209, 18682, 19930, 19353, 16479, 12094, 5681, 185, -6569,
+    -11967, -15966, -18757, -19920, -18869, -16225, -12114, -6370, 143, 5871, 11470, 15725, 18704, 19937, 18965, 16721,
+    12169, 5780, 426, -6283, -11211, -16369, -18960, -19833, -18704, -15861, -11636, -6513, -164, 5981, 11637, 15892,
+    19023, 19375, 18949, 16113, 11760, 6285, 161, -6195, -11995, -15452, -18918, -19543, -18819, -16642, -11814, -6275,
+    221, 6162, 11634, 16590, 18839, 19984, 19050, 16020, 12153, 6948, -474, -6204, -11341, -16207, -18833, -20180,
+    -19003, -16062, -11691, -6357, -90, 6140, 11931, 16422, 19207, 19944, 19191, 16076, 11955, 6049, 144, -6219,
+    -11267, -16023, -18473, -19972, -19087, -15682, -11656, -6319, 554, 6181, 11316, 16218, 18817, 20056, 18966, 15948,
+    11301, 6015, -162, -6646, -11527, -15905, -18905, -19491, -19034, -16317, -11850, -5601, -22, 6075, 12004, 16585,
+    18714, 19876, 18773, 16610, 11535, 6514, -210, -6254, -11719, -16613, -18531, -19962, -18899, -16247, -11571, -6272,
+    -494, 5554, 12182, 15790, 18361, 20078, 18860, 16267, 12232, 6400, -197, -5680, -11642, -15856, -18733, -19503,
+    -18709, -15843, -11938, -6535, 218, 6379, 12064, 16320, 19181, 19538, 19335, 15636, 12079, 5935, -10, -5559,
+    -11683, -16744, -19468, -20157, -18934, -16301, -11975, -5892, -296, 7052, 11629, 16144, 18888, 19893, 19471, 16129,
+    11472, 5989, 115, -6479, -11314, -16208, -19264, -20358, -18489, -16362, -11505, -6226, -82, 6496, 12282, 16355,
+    18940, 19530, 19319, 16032, 11239, 6260, -14, -6417, -12054, -16418, -19504, -19546, -18794, -16426, -11669, -6164,
+    84, 6174, 12101, 15896, 19074, 19757, 19554, 15723, 11394, 6532, -64, -5972, -12006, -15632, -19047, -19992,
+    -19080, -16704, -12157, -6250, -256, 6571, 12008, 16362, 19619, 20327, 19158, 16670, 11161, 6280, -60, -6116,
+    -11736, -16276, -18673, -20342, -18658, -16588, -12134, -6438, 32, 6177, 11667, 16103, 18625, 20577, 19177, 16175,
+    11663, 5998, 170, -6502, -12122, -16552, -18559, -19781, -19011, -16314, -11479, -5916, -556, 6188, 11424, 15858,
+    19617, 20543, 19148, 16060, 12093, 6709, -2, -6561, -11259, -16650, -19711, -20113, -19391, -16374, -11755, -5968,
+    238, 6248, 11724, 16090, 18798, 19901, 18873, 16778, 11724, 6131, 262, -6223, -11920, -16483, -18776, -20093,
+    -18816, -16698, -11732, -6032, -29, 6765, 11660, 15795, 19890, 20241, 19029, 16833, 12072, 6091, 77, -6213,
+    -11610, -16213, -18756, -20602, -18824, -16224, -11775, -6297, -82, 6731, 11906, 16355, 19294, 20293, 18791, 15985,
+    11870, 6348, 141, -6214, -11499, -16137, -19388, -19896, -19398, -16347, -11456, -6295, 118, 6407, 11719, 16450,
+    19181, 20193, 19333, 15913, 11491, 6687, 163, -6407, -11323, -16571, -18723, -20162, -18975, -15621, -11824, -6376,
+    182, 5964, 12197, 16681, 18878, 19746, 18312, 16597, 11378, 6281, 54, -5883, -12033, -15816, -19282, -19928,
+    -19603, -16550, -11582, -6087, 145, 6623, 11618, 16142, 19051, 19585, 19217, 16181, 12047, 6376, 426, -6123,
+    -11614, -16045, -18978, -20455, -18726, -16512, -11976, -6326, 249, 6886, 11754, 16717, 19006, 20308, 18770, 16215,
+    11543, 5913, -423, -5836, -11541, -16125, -19123, -20032, -18966, -16437, -11781, -6446, 239, 5874, 11910, 16328,
+    18869, 20126, 19259, 16298, 11758, 6073, 155, -6737, -11561, -16317, -19067, -20009, -19366, -16226, -12082, -6595,
+    -194, 6581, 12595, 16113, 19180, 19660, 18720, 16168, 12103, 5546, -326, -6009, -11914, -16296, -19133, -19617,
+    -18937, -16293, -11315, -6073, 313, 5697, 11331, 16730, 18941, 19556, 19039, 16360, 11962, 6312, -29, -6159,
+    -12139, -16505, -19012, -19883, -18670, -17011, -12423, -6107, 122, 6166, 11860, 16169, 19161, 19963, 18975, 15852,
+    11716, 6444, 535, -6228, -11647, -16123, -19514, -20060, -19012, -14955, -12313, -6428, -656, 6069, 11647, 16185,
+    19391, 19907, 18883, 15681, 11481, 6152, 218, -6584, -11059, -16025, -19059, -20039, -18787, -16285, -12254, -6477,
+    -361, 6255, 11686, 16327, 18809, 20327, 19049, 16031, 11616, 5927, -112, -6093, -12180, -16284, -19268, -20232,
+    -18901, -16129, -11549, -6115, -80, 6091, 12401, 16182, 18963, 19974, 18952, 16069, 12855, 6610, 337, -6364,
+    -11872, -16061, -18796, -19933, -19369, -16316, -11624, -6570, 718, 6249, 11804, 16071, 19288, 19890, 18829, 16569,
+    11850, 6205, -179, -5935, -11591, -15890, -19373, -19825, -19349, -15841, -11733, -6295, 55, 5725, 11882, 16472,
+    18700, 19938, 19130, 16401, 11293, 5850, 371, -6540, -11675, -16658, -18935, -20348, -19106, -15822, -11640, -5848,
+    -50, 164, -307, 351, 108, -70, 543, -138, -362, -20, 74, 255, -239, 153, -94, 137,
+    66, -21, -378, -145, -315, -91, 871, -102, -210, 544, -161, 324, 267, 313, -53, -140,
+    15, 612, 85, -296, 235, 22, 112, -197, 40, 278, 300, -2, -24, -39, 87, 105,
+    -230, 278, 213, -18, 259, -16, -103, -158, -386, 154, -258, -110, -114, 202, -474, 314,
+    9, -396, 679, 21, -40, 69, 124, 243, 96, 367, 523, -452, -112, 591, -49, -802,
+    -28, 28, 224, -634, 205, -243, 178, -100, 548, -266, -319, 131, -235, 133, 8, -187,
+    8, 426, -252, -250, -41, 502, 84, 6, -17, 305, 165, 95, 68, 689, -214, -416,
+    -171, -15, 135, -12, 280, 165, 608, 69, -110, 218, -125, 480, 490, 306, -54, -19,
+    106, 8, 150, -315, -172, 566, -16, -106, 185, -83, -39, -112, 161, 30, -74, 547,
+    -98, 99, 626, -176, -55, 166, -240, 48, -18, -390, 205, 229, -388, -73, 439, -187,
+    -9, 114, 54, -18, 126, -396, 841, 6, -60, -45, -155, 117, 4, -429, -376, 122,
+    -71, 235, -30, -43, -487, 84, 79, 384, -329, -72, -154, -121, -497, 96, -94, 37,
+    597, -611, 483, -232, 0, -172, -244, -28, -155, 261, -35, 45, 189, 163, 499, 227,
+    214, -442, 361, 443, -273, 387, -330, -105, 12, -68, 320, 289, -72, 112, 140, -168,
+    34, -320, 79, 33, 281, 461, 671, -34, -244, 375, 465, 84, -13, 89, 300, -258,
+    366, -282, -214, 92, -162, 527, -79, -39, -221, -194, 343, 411, 45, 234, -134, -48,
+    382, -221, 215, 176, 17, 347, 618, -285, 440, -83, -529, -104, -188, -625, -397, -82,
+    -25, -429, 424, 27, -451, 300, 308, -323, 124, -250, -127, 19, -173, -62, 64, -244,
+    -753, -1, -361, -83, 306, -276, 41, -68, -313, -350, 76, 194, -124, -495, 40, 500,
+    234, -374, -449, 7, 279, -427, -596, -243, 288, -145, -473, 126, 64, 325, -27, 426,
+    -117, -153, -20, 534, -422, 283, -477, 156, 246, 4, -662, 210, -545, 40, 115, 29,
+    81, -341, 444, 244, 263, 542, -155, 101, 4, -596, 597, -33, 305, 140, -195, -398,
+    -497, 289, -4, 92, 12, 113, -483, -179, 95, -134, -22, 365, -302, 54, 287, 155,
+    256, 71, -727, -124, -175, 313, 28, -262, -124, -270, -62, -531, -119, -264, -330, -393,
+    361, -517, -463, 125, 97, -13, -273, -313, -181, 34, -35, 237, 308, 796, -399, -355,
+    -75, 50, -26, -169, 345, -260, 333, 178, -424, -436, -156, -109, 383, 344, 175, -201,
+    450, -187, -148, -257, 136, 346, -88, -31, 680, 431, 471, 113, -499, 110, -434, -91,
+    -90, 173, 5, -24, 85, 432, -217, 442, -405, -275, 104, -179, 231, 377, 123, -792,
+    89, -552, 27, -189, 176, -238, -15, 16, -233, 332, 51, 347, -119, 394, 126, -121,
+    -100, -347, 820, -346, -37, 182, 38, -303, 219, -23, 577, -283, -310, 223, -287, 109,
+    -35, 241, -349, -253, 40, -288, -76, 58, -22, -263, 535, -347, -167, 437, -556, 383,
+    387, 749, -162, -66, -573, -222, 49, -30, -435, -149, -143, 114, 97, -269, 234, 134,
+    105, -348, -194, 268, -315, -458, -352, -135, -286, 217, 68, 58, -199, 435, 130, 377,
+    538, -285, -234, -18, 149, 413, -245, -268, 108, -307, 216, 672, 718, -167, -465, 168,
+    -754, 458, 58, -412, -36, 141, -112, -316, 245, -99, -41, 395, -502, -6, 44, -147,
+    583, 300, 365, -118, -259, -272, -142, -706, 292, -264, -70, -615, 83, 28, -708, -342,
+    411, 95, -263, -90, -234, -56, 121, 144, -241, 254, -12, -854, -222, 421, -146, -278,
+    12, 30, -377, -211, 227, 444, -27, 386, 178, 251, -402, -232, 438, -257, 132, -76,
+    -82, -145, -228, 402, 110, -287, -260, -624, 0, 15, 8, 218, 194, 26, -277, -157,
+    158, 65, -363, 320, -157, -302, -216, -398, -141, 356, -351, 191, -184, 208, -19, -42,
+    207, 401, -287, 151, 39, -328, -219, -88, -563, 176, -10, -396, -5, -242, 331, -8,
+    145, -21, 251, -46, 174, 143, 103, -29, 235, -313, -64, -63, 123, 18, 4, 162,
+    304, -554, -201, -24, 626, -65, 6, -98, 189, -244, -287, 148, 313, 12, -90, 405,
+    -386, 140, -489, 231, 75, -264, -74, 3, 1, -246, -286, 15, 264, 82, -226, -200,
+    233, -90, 712, -130, -220, -231, -400, 511, 693, -285, 8, 76, 100, 34, -30, -32,
+    -538, 197, 269, 746, -305, -519, 34, -157, 542, -590, -138, 60, 111, -370, 385, 322,
+    292, -35, -116, -167, 296, -205, 54, 89, 120, 249, 7, -184, 25, -354, 211, -221,
+    332, 306, -92, 125, 41, -202, 64, -8, 226, -259, 267, 526, 334, -235, 62, -232,
+    -132, -77, 427, -602, -414, 30, -523, -349, -21, -240, 437, -539, 173, 45, -444, 189,
+    -7, -163, 58, 56, -211, 413, 129, -84, -213, 93, 149, -52, -426, -428, 85, 815,
+    446, 541, -212, -38, -50, -346, -215, 458, -274, -423, 525, -91, -517, 406, 6, 107,
+    94, 294, 4, 301, -356, 257, 227, 297, -317, -218, -139, -27, -307, 339, -163, -525,
+    -307, -262, -549, 328, -122, -144, -509, 333, -77, 273, 76, 285, -514, 175, -371, -121,
+    85, 101, -366, -280, -5, 108, -396, -187, -268, -537, -170, 13, -21, 535, 19, -46,
+    270, 145, 90, -701, 30, 524, -402, -169, -191, -296, 141, 54, -374, 55, -257, 116,
+    992, -211, 104, 443, -103, -498, -83, 442, 85, 260, 44, -77, 392, -346, 278, -629,
+    130, 44, -246, -112, -132, -357, 136, -350, 90, -478, 395, 55, -375, -352, -121, 529,
+    56, -137, 526, 472, -51, 26, -21, 276, 505, -229, 133, -219, 351, -87, 145, -488,
+    187, 107, 452, -178, 46, -263, 243, -264, 326, -68, -138, -101, -239, 175, -377, -457,
+    31, 282, 558, 588, -393, 160, 36, -476, -27, 604, 320, -476, -523, -535, -157, 107,
+    10, 92, 207, 116, -170, -224, -361, 391, -229, -68, 163, 17, -293, 493, -72, 743,
+    350, -650, -602, 219, 69, -345, 68, 345, -836, 543, 61, 8, -183, 232, 89, 548,
+    49, -63, 201, -485, 123, 110, 579, 316, 72, -70, -102, -361, -304, -270, -535, 102,
+    141, 36, 235, -144, 373, -109, -119, -407, 384, 111, 149, 305, -42, -113, 282, 11,
+    215, 35, 483, -51, 113, -634, 235, 19, -106, -497, 137, 245, 153, 544, -122, -576,
+    -95, 167, 6, -26, 146, -343, 194, 351, 69, -30, 302, 205, 558, -45, 209, 29,
+    -374, 0, -368, -265, -72, 137, 241, 132, 364, -252, -254, 3, 247, -98, -165, 12,
+    -260, 274, -64, -98, -428, -241, 186, -64, -90, 103, 729, 21, -312, -148, 30, -341,
+    -294, -34, 158, 38, 56, -117, -829, -389, -234, -8, -197, -315, -242, -848, 125, -47,
+    -218, -106, 287, 180, -444, -9, 6, -284, 120, -63, 207, 262, -62, -103, -10, -426,
+    255, -156, 331, -157, -746, -11, -176, 126, -668, -181, 513, 184, -254, 464, -10, -450,
+    694, 362, 128, 365, 228, 487, -407, 456, -228, -457, 13, 680, 88, -133, -150, 560,
+    -138, -353, -176, -253, -79, -842, -319, -321, 86, 127, 110, 298, -399, 242, 148, 38,
+    -398, -187, -105, -224, 15, 592, -379, -696, -401, -507, -163, -283, 603, -44, 515, 251,
+    -570, -109, -443, -103, 546, -122, 236, -451, -92, 619, -381, 112, -401, -28, -370, 504,
+    -592, -245, 97, -8, -471, -190, -39, -132, -159, 27, -447, 115, -427, -487, 105, -41,
+    -558, -128, 320, -333, 138, -303, -26, 131, 585, 423, 329, -255, 170, 391, -30, -66,
+    234, -414, 222, 620, -90, 50, -967, 316, 435, -490, 163, -494, 232, -592, 38, 459,
+    -115, 70, 331, -121, -886, -146, 18, 406, -140, -699, -294, -197, 6, 87, 143, -327,
+    86, -477, 309, -159, -74, 50, 19, -592, -422, -272, -599, 730, 73, -800, 169, -6,
+    3, 412, -300, -409, 67, -35, -199, -588, -142, 160, 160, 103, -406, 159, 8, 384,
+    64, 220, 18, -680, 6, -152, 46, -84, -62, 200, -82, 536, -319, -341, 138, 112,
+    -111, 139, -304, -60, -557, 195, -465, 26, -468, -216, 161, -270, -105, -187, 228, -39,
+    429, 154, -223, -53, -202, -285, 180, 506, -34, -212, -337, -248, -16, -28, -111, -193,
+    53, 87, 222, -74, 291, -257, -360, -65, -342, -423, 80, 619, 230, -212, -121, 407,
+    520, 115, -174, 544, -281, 410, -257, -68, -56, -209, 398, 6, 319, 43, 196, -243,
+    -92, 256, -244, -82, 594, -285, 0, -13, 251, 915, -203, -320, -85, 95, -5, -84,
+    -552, -250, 72, 44, -175, -560, 182, 20, -723, 469, -108, 229, 164, 618, -362, 38,
+    304, -651, -256, -433, -42, 148, -233, -46, -569, 212, 293, -104, -187, 169, 375, -109,
+    -173, -21, 137, 98, 198, 386, -244, 450, -277, -101, 358, 43, -726, -332, -654, -147,
+    23, -98, 35, 17, 174, -193, 98, -377, 232, 79, 118, 720, -168, 182, 568, -71,
+    579, -131, -155, 94, -225, 271, -70, 512, -158, 375, 168, 571, 562, -330, 176, -361,
+    295, -181, 197, 433, 37, -45, 94, -357, 29, 33, 160, 134, 306, 143, -246, 108,
+    144, -314, -145, 110, -86, -409, 103, 8, -509, -348, 2, 140, -765, -465, -67, -282,
+    272, -229, 189, -327, -316, 399, -178, 121, 540, -303, -206, -16, 124, -451, -143, 421,
+    589, 522, 320, 159, -327, 489, -690, -579, -311, -374, 208, -70, -342, 48, 380, 172,
+    278, 370, -226, -514, 504, 308, 697, -184, -71, 69, 419, -94, -140, 280, 313, 86,
+    -389, 128, 517, -407, 88, 32, -302, -24, 18, 321, 64, 332, 31, -266, -459, -204,
+    -163, -494, -178, 465, -294, -169, -340, 112, -300, -199, 195, -215, 70, -258, 40, 364,
+    58, 660, 229, -248, -181, -280, -12, 366, -272, 334, 15, -49, 480, -193, -198, -29,
+    76, -37, 106, -607, 30, 0, -22, -34, 285, 237, 139, 375, -462, -116, -132, 42,
+    -262, 1, 401, -67, -95, -538, 221, -299, -3, 491, 175, -352, 374, -380, -85, -154,
+    -290, -320, -253, -149, 225, -244, 79, 402, 318, 226, -73, 66, -586, 197, -202, 319,
+    -692, 106, -64, -362, 466, 220, -427, 279, -245, -19, -381, -60, 388, -242, 743, 64,
+    -36, -139, -223, 545, -395, 401, -14, -398, 268, -171, -243, 264, -14, 226, 323, 199,
+    93, -187, 56, -152, 46, -466, 300, -362, -399, 84, 303, -207, 32, -184, -68, 262,
+    225, -328, -37, -651, 69, -178, -80, -180, -16, -79, 491, -215, 202, 7, -723, 217,
+    -535, -252, 154, -390, 131, -253, -152, 268, -471, 200, -130, 29, -30, 173, 409, 99,
+    -156, 257, 237, 65, -201, 155, 165, -230, -224, 374, 152, -298, 804, 427, -163, -101,
+    188, -203, -43, 422, -53, -330, -1, -46, 129, 84, 191, 164, 125, 306, 306, -103,
+    -45, 699, 687, 316, 713, -136, -510, -264, -319, 86, -230, -263, -250, -19, -304, -485,
+    -375, -311, 137, 212, 159, 274, -252, -515, 20, 396, 93, 129, -273, 195, 71, 100,
+    -88, 332, 361, -268, 185, -700, -136, -126, -198, -248, -126, 392, 166, 164, -60, -502,
+    128, 346, 767, -246, 123, 474, -46, 220, 67, -332, 86, 398, 82, -57, 52, -115,
+    -67, -26, -212, 81, 8, -299, 84, 279, -583, 81, 403, 223, -236, -168, 307, -4,
+    -142, -746, 248, 333, -144, -45, 386, 47, -286, -80, 86, 56, 465, -271, -225, 231,
+    129, 53, 105, -260, -3, -236, -183, -526, -194, 24, -86, 73, -178, 127, -283, -220,
+    60, -134, 679, 426, 444, -91, -827, 153, -3, -370, -263, 298, 265, -414, 430, -102,
+    -8, -17, 232, -252, -265, 201, -93, 257, 33, -264, 341, -5, -326, 135, 200, 43,
+    433, -277, -200, 677, -226, 739, -116, 247, -324, -620, -116, 408, -266, 421, 109, -45,
+    -567, -152, 442, 12, 196, 357, 197, -125, 94, 75, 353, 195, 117, -608, -195, 487,
+    -114, -361, 309, 17, -205, 33, -164, 667, 460, -269, 155, 17, 459, 14, -117, -159,
+    246, 465, -34, -342, -16, -312, -420, -223, 542, -64, -472, 136, 382, -354, -39, -160,
+    177, -1015, 454, -320, 607, -317, 56, -7, 129, -39, -261, 450, -153, -16, -77, -53,
+    134, -8, -70, 442, 275, -491, 302, -14, 182, -86, 60, -41, -37, -281, 516, -641,
+    270, -333, -475, -145, -235, 137, 95, -206, -306, 469, 101, 220, 350, -50, 594, 251,
+    127, -725, -133, 166, 138, -139, 779, -334, -544, -266, 134, -197, -401, -651, -529, 89,
+    -151, 373, -459, -243, -410, 361, -205, -225, 227, -199, 127, -201, 50, 250, -103, 313,
+    116, -306, -412, 9, -293, 177, 308, -251, 63, 93, -267, 233, -62, 7, -194, -200,
+    81, -8, 399, -127, -57, 244, 214, 108, 310, 130, -51, -12, 27, 44, 359, -222,
+    172, -129, -150, -198, -416, 428, -481, -167, -339, -366, -376, 140, 152, 722, 23, 321,
+    212, 551, 368, 347, 51, 127, -390, -622, -207, 324, 147, -124, 254, -314, -110, 1001,
+    567, -143, 360, 11, 357, -142, -494, -132, -223, -188, -201, -248, 129, -297, -47, -216,
+    119, 168, 187, -49, -395, -75, 356, -88, -87, 482, 110, 4, -182, -74, -78, 468,
+    -80, 101, -465, 469, -198, 7, -24, 63, -207, -124, -96, -84, 578, -100, 181, 53,
+    -150, -252, -132, -685, -562, 17, 155, 73, 32, -54, -70, -253, -332, 39, -62, -46,
+    -164, 717, -337, 134, 19, -605, 157, 23, -576, -355, 113, 330, -3, -142, 118, 387,
+    -62, 243, 76, 535, -351, 21, -9, 33, 238, 208, -209, -124, -375, 434, 89, 372,
+    -121, -338, -131, 100, -130, 341, 333, -163, -48, 119, 120, -204, 54, 234, 122, 265,
+    -122, -357, -104, -46, -123, 315, -139, -248, 20, 80, -438, 371, -926, -277, -325, -14,
+    -100, 6700, 12254, 15993, 19001, 19878, 19209, 16333, 11958, 6685, -5, -6053, -11818, -15254, -19251, -19840,
+    -19265, -16316, -11428, -6108, 134, 6137, 11783, 15969, 18899, 20074, 18833, 16129, 12027, 5978, 584, -5807,
+    -11832, -16005, -18819, -20568, -18918, -15668, -11469, -6115, -166, 6057, 12025, 15762, 19144, 20056, 18753, 16478,
+    11537, 6348, 469, -5611, -11358, -15708, -19631, -19931, -19331, -15962, -11540, -6023, -242, 6259, 12094, 16214,
+    18868, 19792, 19058, 16138, 12337, 5690, -69, -6107, -11337, -15692, -18488, -20270, -19092, -16164, -12026, -5938,
+    369, 6252, 11340, 16696, 19062, 20284, 18564, 15592, 12295, 6075, -97, -5757, -11681, -16564, -19061, -19981,
+    -18851, -15604, -11947, -6080, 101, 5525, 11564, 15820, 19086, 20006, 19285, 15654, 11611, 6461, 105, -6332,
+    -11844, -15827, -18872, -19983, -19111, -16070, -11907, -5865, -496, 6396, 12152, 15938, 18691, 20308, 19135, 16331,
+    11757, 6161, 163, -6570, -11967, -16972, -19153, -19590, -19343, -16405, -11449, -6018, 195, 6337, 11744, 15477,
+    19246, 19302, 19187, 16472, 12347, 6115, 629, -6320, -11740, -16251, -19319, -19853, -19011, -16270, -11237, -6379,
+    -662, 6025, 11728, 15560, 19289, 19618, 19743, 16390, 11785, 5857, 156, -5975, -11371, -16315, -19343, -19447,
+    -19450, -16431, -11785, -5708, 284, 6257, 12059, 15923, 19528, 20144, 18497, 16507, 12198, 6245, 319, -6319,
+    -11803, -16113, -19199, -19631, -18778, -16382, -11943, -5823, -223, 5640, 11605, 15982, 19339, 20122, 18443, 16384,
+    11731, 5972, 526, -6106, -11617, -16299, -18951, -19922, -18983, -16169, -11505, -6484, -580, 6126, 11932, 16416,
+    19122, 19719, 19279, 16220, 11751, 6052, 112, -6433, -11755, -16488, -18887, -19770, -18771, -15994, -11585, -6618,
+    467, 6268, 11571, 16508, 19150, 19986, 19163, 15451, 11711, 6253, -128, -6123, -11218, -16409, -19805, -20300,
+    -19151, -15806, -11688, -6392, 34, 5895, 12015, 16648, 19618, 19548, 18349, 16309, 11259, 6265, 466, -5928,
+    -11778, -16539, -18903, -19884, -19240, -16150, -12195, -5950, 150, 5916, 11889, 16654, 18784, 19617, 19010, 16256,
+    11710, 6078, 229, -6527, -11436, -15776, -19201, -19634, -18454, -16213, -12043, -6749, -187, 6500, 11462, 16066,
+    19342, 20053, 19095, 15885, 11877, 6565, -280, -5998, -11917, -15775, -19057, -19985, -19070, -16683, -12034, -6140,
+    -97, 6333, 11676, 15738, 18944, 19481, 18936, 16081, 12268, 6447, 164, -5797, -12020, -16343, -18738, -19688,
+    -19091, -16220, -11538, -6133, -923, 6700, 11862, 15603, 19098, 20064, 19457, 16180, 11529, 6019, 122, -6426,
+    -11535, -16717, -19194, -19832, -19168, -16603, -10999, -6502, -402, 5512, 11786, 16227, 18950, 19901, 18681, 15653,
+    12097, 6324, 189, -5795, -12380, -15964, -19146, -20112, -18708, -15886, -11706, -6247, 227, 6017, 11644, 16231,
+    19183, 20187, 19366, 15718, 11160, 6062, -632, -6063, -11639, -15913, -19252, -19669, -18908, -16056, -12042, -6525,
+    419, 6013, 11732, 16070, 19134, 19682, 19268, 16023, 11481, 6631, 31, -6245, -11463, -16064, -19415, -20302,
+    -18604, -15764, -11537, -6088, -286, 6187, 11500, 16312, 19246, 20265, 19054, 15585, 11773, 6846, 496, -5993,
+    -11438, -16479, -18618, -20006, -18913, -16354, -12108, -5927, 112, 5855, 11626, 16259, 18766, 19799, 18786, 16089,
+    11539, 6172, 174, -5962, -11738, -16479, -18866, -19716, -19190, -16622, -11759, -6124, -465, 5749, 11802, 16470,
+    19001, 19549, 18492, 16666, 11965, 6397, 164, -6287, -11425, -16086, -18841, -19739, -18704, -16068, -12084, -5939,
+    103, 5977, 11851, 15904, 19491, 20117, 19022, 15936, 11697, 5949, 77, -6220, -11660, -16037, -19326, -19960,
+    -18987, -16324, -11698, -6486, 35, 6458, 11785, 15990, 19383, 19996, 19075, 16407, 11957, 6036, 51, -6369,
+    -11886, -15961, -19337, -20010, -18675, -15846, -11275, -6126, 368, 6212, 11985, 16161, 19136, 19480, 19159, 16456,
+    11632, 6122, 276, -6487, -11852, -16174, -19455, -19473, -19711, -16305, -11998, -6273, -68, 6012, 11941, 16273,
+    19220, 19499, 18978, 15774, 11997, 5830, 411, -6306, -11708, -15813, -19344, -20139, -18724, -16577, -12170, -6244,
+    244, 5783, 11986, 16358, 19009, 19831, 18329, 16127, 11751, 6120, 486, -6494, -11378, -16081, -19239, -20044,
+    -19559, -16269, -11986, -6021, -135, 6362, 11707, 16902, 19211, 19967, 19038, 15851, 11439, 6061, -299, -6632,
+    -11811, -16076, -18859, -20589, -19547, -16283, -11884, -6224, 222, 6310, 11897, 15567, 19196, 20171, 19256, 16361,
+    11723, 6253, -10, -6379, -11631, -16445, -19158, -20021, -18996, -16121, -11504, -6149, -301, 6017, 12322, 15961,
+    19102, 20068, 19500, 15819, 11831, 6037, -290, -6586, -12064, -16043, -18861, -19270, -19141, -16278, -11530, -5517,
+    -156, 5919, 11748, 16186, 18990, 19634, 18267, 16386, 11830, 5796, 49, -6427, -11687, -16565, -19160, -19826,
+    -19211, -16272, -12106, -6713, -187, 5647, 11330, 15614, 19319, 20026, 19123, 15939, 11822, 6060, 72, -6057,
+    -11490, -15691, -19347, -20154, -19209, -16876, -11432, -5950, -403, 5619, 11807, 15591, 19101, 20346, 19156, 16282,
+    11420, 5356, -258, -5974, -12035, -16877, -18850, -20107, -18977, -16360, -11541, -6016, 548, 6395, 11419, 16103,
+    18912, 19565, 19142, 15802, 11758, 6297, 284, -6366, -12097, -16339, -19105, -20024, -18869, -15635, -11420, -6122,
+    -309, 6495, 11865, 16262, 19012, 19897, 18809, 16652, 11788, 6009, -155, -6117, -11699, -16305, -19049, -19900,
+    -18953, -16347, -11896, -5929, -616, 6474, 11994, 16338, 18577, 20127, 18792, 16328, 12035, 6400, -316, -6230,
+    -11819, -16229, -19300, -19970, -19017, -15911, -12050, -6660, 239, 6166, 11266, 15771, 19016, 20256, 19496, 16379,
+    11615, 6413, 719, -5958, -11399, -15966, -18693, -19746, -19059, -15963, -11856, -6068, 50, 5987, 11506, 16000,
+    18893, 19902, 18623, 16297, 11851, 6110, 35, -6067, -11682, -16101, -18646, -19943, -18936, -16350, -11362, -6139,
+    246, 6216, 12437, 15876, 19083, 20079, 18700, 16539, 12020, 6036, -251, -6466, -11620, -16090, -19132, -19467,
+    -19251, -16525, -11559, -6377, -46, 6304, 11847, 16473, 18984, 19666, 19046, 16277, 11346, 5885, 392, -5895,
+    -12348, -16183, -19034, -19583, -18843, -16014, -11824, -6720, 126, 6680, 11855, 16291, 18856, 19990, 19043, 16379,
+    12244, 6122, 130, -6377, -12501, -16040, -19295, -20119, -19060, -16039, -11648, -6527, 198, 6336, 11982, 16416,
+    18897, 19880, 18827, 16477, 11706, 6266, 255, -6202, -11816, -16380, -19254, -19638, -18953, -16236, -11925, -6058,
+    -42, 6164, 11831, 16499, 19317, 20109, 18703, 16618, 11668, 5770, 101, -6766, -11910, -15990, -19873, -19563,
+    -18970, -15895, -11717, -6107, 135, 6402, 12013, 15806, 18771, 19942, 19045, 15799, 11912, 6716, 169, -5477,
+    -11502, -16448, -18872, -20056, -18955, -15632, -11654, -6196, 255, 6460, 11575, 15992, 19513, 19770, 18919, 15969,
+    12169, 6341, -569, -6075, -11543, -16484, -19602, -19796, -19388, -16295, -11629, -6104, 455, 6227, 11546, 15753,
+    19225, 20183, 18031, 16248, 11629, 6247, -615, -6049, -11863, -16287, -18895, -19790, -18800, -16186, -11229, -6133,
+    513, -187, -37, 189, 8, 368, -320, 279, -180, -153, 132, 307, 190, -268, -244, 151,
+    -525, 282, -598, 40, 275, 183, 223, 276, 32, 80, -63, -442, 329, 211, 127, 155,
+    397, 104, -334, 268, 198, 6, 174, -41, -57, -278, 352, -272, 178, -217, 89, 124,
+    -448, -348, 232, -354, 403, -169, 187, 112, 312, -23, -11, -46, 37, 71, -25, -55,
+    -168, -9, 83, -267, 408, 115, -298, 541, 141, 527, -38, -23, 139, -226, 389, -182,
+    180, -80, 8, 21, 201, -560, 234, 455, 69, -134, 252, 571, -321, 424, 367, -254,
+    339, -53, 103, 104, -158, 278, -311, 38, -293, -130, 447, -201, 241, 188, 344, 152,
+    409, 312, 95, -594, -158, -35, -53, -151, -356, -580, 369, -362, 642, -224, 103, 93,
+    -150, -712, -445, 26, 537, 56, 500, 557, -68, -181, -275, 143, -172, -28, 372, -185,
+    -132, 104, -3, -685, 114, 207, -238, 242, -111, -111, -85, 143, -249, -204, 148, -592,
+    223, -163, -190, -189, 231, 246, 164, -154, 557, -68, -401, -11, -419, -572, -205, -78,
+    -153, 34, 346, -671, -315, -563, -67, -313, -463, 124, -207, 194, 120, -143, 443, 237,
+    -166, 116, -11, 641, 68, -154, -944, -67, -469, -109, -246, 140, 922, 52, -109, 266,
+    118, -297, -336, -88, 276, 290, 560, -205, 360, -200, -360, -672, 86, -229, -42, -97,
+    365, -73, -437, 116, 541, -485, -292, 262, -157, -1, 452, 4, -393, 291, -157, 91,
+    -208, -414, 412, 185, -308, -103, 310, -366, 232, 8, 256, -540, 334, -198, -106, -94,
+    -418, -161, 150, 229, -57, -488, 184, 181, 538, -598, -337, 174, -87, 564, 188, 263,
+    204, 33, 282, 199, -122, -18, 293, 210, -345, -267, -23, -74, -286, 87, -32, -95,
+    -8, -203, -42, 463, -260, -821, -184, -26, -184, -467, 134, 94, 42, 608, -81, -305,
+    -22, -82, 30, -19, -174, -215, -306, 104, -8, 589, 277, -114, 372, -248, 273, -23,
+    -163, -359, -156, 223, -450, -60, -195, -120, 187, -222, 16, 174, 491, 9, 336, 221,
+    -35, -196, -325, 44, 576, 20, -403, -12, 192, -1146, -575, -308, 403, 8, -55, -142,
+    278, -691, 174, 449, -172, 63, 222, 768, 467, -118, -424, -192, -162, -6, -566, -224,
+    -344, -203, -92, 76, 344, -78, -285, -27, -436, 77, -75, 9, -375, -356, 121, 565,
+    613, 368, 117, 460, -203, 639, 371, -167, 394, -78, 656, 47, -34, -12, -637, 198,
+    130, -83, -241, 234, -36, -241, -189, 104, 362, 500, 403, -52, 248, -72, -263, -375,
+    343, -138, 73, 116, -512, 433, 331, 222, 43, 12, 208, -182, 330, -244, -144, -333,
+    -152, -114, 31, 278, 270, -135, 340, -288, 177, 174, -277, 6, -368, 456, 20, 257,
+    -44, -125, -70, 281, -616, 314, 216, 62, 266, 103, -148, 72, 149, 223, 167, -27,
+    326, -226, 334, -8, -141, 315, 11, 168, 144, -211, -293, 61, -178, 31, 598, 25,
+    -166, 176, -146, -135, 43, 91, 112, 152, -512, -353, 191, 68, -168, -372, 121, -220,
+    262, -145, 387, -768, -526, 59, -253, -66, -41, -445, 191, 221, -502, 18, 263, -27,
+    -165, 203, 83, 72, 591, -172, -181, -134, -195, -311, 59, -420, -369, 125, -478, -133,
+    -175, -393, 48, -398, -57, 128, 70, -252, 193, -220, 320, -348, 565, 332, -64, -287,
+    -644, 127, 258, 217, 321, -201, -387, -19, 296, -61, -92, -416, -532, 113, -952, 460,
+    10, -408, 871, 259, 17, 663, -82, 9, -217, -34, 89, -42, 287, 279, 8, -322,
+    466, 41, 510, 384, -246, 27, 334, -13, -230, -501, -671, 123, -152, 436, -326, -345,
+    845, 237, -101, 137, 115, 135, 30, -14, -19, -231, 429, 163, -243, 238, -97, 166,
+    -36, 179, -234, 69, 145, -570, -149, 19, 34, -144, 462, 122, -202, -161, 134, -17,
+    -228, 26, -129, 131, -129, -37, -57, 1, -316, -218, 515, -336, -397, 189, -101, -237,
+    227, 211, 135, -387, 2, -175, -119, -316, 150, -131, 396, -544, 504, 104, 106, -91,
+    -305, 87, -382, 398, 147, -242, -226, -166, -613, -207, 222, -136, 274, 305, -498, -35,
+    -6, 150, 332, -113, 157, -80, -22, -125, -435, -27, 230, 506, 270, -170, -291, -340,
+    -437, -225, -299, 373, -656, -166, -682, 293, -278, 103, -403, -312, -66, -502, 176, -48,
+    812, -116, -103, 343, 318, 53, 123, 225, 486, 7, 163, -40, 200, 301, -120, -539,
+    48, -313, -79, -415, -198, -86, 161, 337, -490, 221, -4, -197, 348, -130, -333, 84,
+    -367, -372, 828, 161, -307, -600, -47, -143, 147, 110, -154, 385, -502, 135, 14, -74,
+    269, 539, -98, 125, 65, -225, 142, 195, -99, 455, 301, 459, 121, -50, -120, 231,
+    -201, -325, -685, 327, 619, -172, -66, 177, -128, 176, -100, -60, 183, 249, -465, -445,
+    172, 611, 284, 440, -550, 10, 57, 319, 102, -170, 76, -322, 752, 128, 7, -239,
+    362, -304, -28, 163, -184, 94, -187, 110, -296, 144, -149, -259, 128, 61, -7, 191,
+    -51, -175, -57, -133, 130, 81, -163, -558, -47, 313, -233, -482, 232, -253, -23, 99,
+    263, 352, -125, -145, -49, 29, -55, 135, 330, -651, 26, 63, 302, 78, 37, 80,
+    -85, 184, 22, -225, -163, -389, 443, 658, -408, 36, -155, 198, 219, -216, -282, -161,
+    -64, 870, 369, -253, -47, -397, -115, 199, 329, 111, -254, -129, 398, 34, 570, 1,
+    523, 64, 22, -707, 52, 245, -108, 441, -128, -250, -185, -176, 435, 38, -520, 151,
+    438, -302, -294, -282, 264, -180, -140, 282, 29, 27, 387, -226, 157, 166, 247, 0,
+    175, -75, 314, 170, -111, -311, -395, 153, -333, 78, -90, 218, -241, 6, 133, 340,
+    -52, 466, 46, 495, -465, -139, -202, 853, -312, -50, -214, 224, 281, 345, 31, 234,
+    237, 225, 126, -18, 458, 19, -97, 107, -199, -79, 193, -559, 137, -100, -392, -9,
+    -33, 335, -49, 145, -135, 135, -156, -249, -352, 91, 93, 429, -338, -91, 233, 359,
+    -62, -201, -30, -300, -271, 48, 81, 111, -306, 39, 262, 668, -328, 399, 357, -567,
+    144, 371, -259, 164, 241, -78, 274, 265, -42, -178, 211, -220, -535, -147, 360, 224,
+    -281, 53, 113, -298, 206, -426, 105, -260, -284, 85, 422, -304, -494, -164, -290, 127,
+    -190, -569, 437, 17, 287, 42, -21, -616, -152, 130, 146, -204, 435, -134, -168, 127,
+    698, -62, -1, 544, 146, 80, 348, -164, 42, 164, -77, -301, 72, -89, -523, 87,
+    -129, -421, -223, -54, 256, 178, 693, 459, -422, -133, -181, 132, -74, -119, -118, 179,
+    191, 431, -247, -7, 84, -377, 120, 200, 40, 463, 234, -544, -321, 220, 483, -145,
+    -153, -103, 141, 176, -250, -1, -130, 130, -353, 181, 208, 250, 407, 2, -390, 621,
+    115, -572, -532, -34, 352, 234, 625, 89, -130, -121, -20, -184, -383, -497, -946, 235,
+    -329, -194, -233, -158, 108, -461, -108, -333, 129, -66, 91, 387, -104, 531, -353, 181,
+    -232, -352, -327, 158, -290, -252, -138, -377, -57, 369, 168, -407, -456, 253, 96, -85,
+    -260, 58, 388, 250, 33, 114, 15, -35, -167, 419, -87, 215, -1, -20, -67, 249,
+    -63, -57, 603, -40, -2, 100, 307, 152, 443, -84, -405, -82, 364, -1, -318, -252,
+    124, -241, 520, -259, 59, -310, -135, -259, -326, -205, -497, 96, 67, 48, 326, -303,
+    187, -109, -55, 309, 150, 337, -62, 28, -141, 387, -568, -130, 347, 492, 158, 362,
+    294, -418, -47, -94, -3, -269, 238, -296, -54, -88, 352, 139, 106, 375, -68, -130,
+    -480, -170, -114, 473, -379, 15, 146, -202, 259, 194, -326, 267, 310, 263, -15, -528,
+    304, -937, -206, 210, 0, 547, 458, -75, -76, 115, -52, 624, -54, -431, 306, 11,
+    206, 134, -174, -222, 124, 338, -275, -257, 761, 210, -340, -553, -102, -257, 357, 310,
+    393, 34, 8, -375, 285, -110, -596, -92, -94, 156, 88, -174, 16, -129, 562, -583,
+    -699, -181, 162, 313, 240, 348, -11, -45, -390, 304, 537, -149, 15, 17, -427, -212,
+    -522, -398, 47, -618, 46, 751, -97, 178, -1, -221, 43, -40, -440, -477, 485, -372,
+    -92, -411, 38, 748, -754, -300, 295, 294, 173, 168, -318, 166, 649, 165, 95, 50,
+    -553, 287, -412, -376, -281, 151, 81, 271, -251, 243, -49, 615, -317, -160, 27, 369,
+    55, 273, 93, 32, -108, 268, 458, -351, 348, 287, 558, 297, 116, -22, 281, -599,
+    96, 169, 196, -527, -34, -173, 64, -259, 367, 188, -212, -209, 24, 7, -20, -30,
+    73, 294, -231, -310, -368, 336, 312, -41, -435, -519, -654, 20, 332, 376, -591, -154,
+    698, -481, 532, -517, 45, -26, 142, 209, 60, -70, 494, 429, -497, -504, -41, 275,
+    90, -186, 23, -300, -59, 47, -385, 115, 15, 17, -274, 167, -345, 203, 169, 264,
+    -84, 167, -539, -351, -126, -264, 268, 31, -451, -238, -5, -168, -75, -248, 102, 41,
+    -115, 165, -197, -99, 106, -658, 85, 303, 240, 610, 160, 133, -343, -450, -158, -200,
+    -117, -165, 165, 357, -247, 548, 484, 175, 403, 62, -97, 73, -432, 415, -192, -137,
+    128, 481, 229, -320, 448, -10, -81, 161, 314, 632, -237, -214, 133, 107, -547, -534,
+    549, 91, -318, -354, 681, 398, 254, 76, 186, -134, 373, -226, 209, 681, -324, -262,
+    138, -220, 340, 397, 96, 341, 48, -325, 691, -153, -718, 302, -110, 558, -92, 239,
+    177, -195, -386, 183, -628, -83, -5, 77, 341, 398, 128, -408, 82, -255, 84, 451,
+    87, -169, 235, -250, -213, -620, 10, 49, 223, -212, 425, -13, 128, -26, -24, 334,
+    9, -422, 142, 222, -374, 541, 362, 384, 287, 344, -572, 240, 99, 102, 372, -312,
+    -345, -552, -22, -368, -76, -130, 206, -309, 302, 162, 413, 177, 556, -306, 491, -243,
+    18, -167, -120, -143, -166, -353, 87, 583, 237, 380, -377, -226, 409, 26, -246, 4,
+    -124, -237, 636, -415, -215, -113, -190, 16, 245, 60, 78, -311, 91, 65, -241, 358,
+    475, 730, -439, -377, -653, -445, -492, -253, -210, 122, -399, -74, 26, -414, 100, 10,
+    -351, -37, 189, 30, -453, -203, 209, 689, 408, 296, 46, -139, -197, -128, -161, -435,
+    1, 292, -77, -134, 98, 37, 134, 87, -346, 23, 213, -115, -255, 287, -197, 275,
+    -139, 119, 342, 207, 50, -89, -271, -138, -68, 187, 520, -21, 87, 375, -188, 112,
+    -263, -224, 64, 290, 374, 402, 288, 2, 564, -138, -52, 102, -340, -59, 158, -173,
+    387, 278, 201, 364, 360, -341, -120, -180, 528, -282, 190, 604, -64, -318, 408, -261,
+    323, -402, 344, -176, -31, -317, -466, -288, 200, 102, -441, 150, -381, -319, 290, 428,
+    -93, -169, 121, 217, 144, 24, -487, -369, 136, 16, 289, 148, -100, -78, 208, 530,
+    41, 699, 190, -147, -347, -626, -159, -19, 434, 44, -380, -108, -57, -707, 203, -339,
+    315, -68, -145, 106, 274, -905, -34, 292, 34, -243, -43, -67, -660, 162, 567, -290,
+    -215, 15, -5, -244, 447, 118, 68, -372, 174, 389, 74, -441, 855, -151, 523, -302,
+    108, 202, -94, 167, -591, 412, -119, 193, 413, -567, 146, 36, 184, -300, 60, 120,
+    198, 286, 65, 210, -299, 185, -299, 29, -120, 175, 371, -850, -107, -233, 118, 25,
+    -69, -162, -138, 183, 363, -78, 437, 187, 308, -212, 98, 391, 346, 566, 633, 421,
+    -675, -307, -408, -53, 311, 35, 19, -95, 212, 80, -85, -223, 279, 447, -333, -35,
+    328, 79, -411, 585, 31, -433, 202, -348, 4, 184, -116, 29, 14, -183, -289, -227,
+    -115, 129, -115, 190, -12, -19, 573, 341, -299, -25, 251, -173, -91, 162, 285, -690,
+    73, -99, 102, -541, -73, -94, 13, 173, 206, -421, 217, -169, 202, 562, -52, -495,
+    -7, -1, -492, -257, -296, 343, -361, 317, 399, -254, 379, -397, -498, 696, -751, -40,
+    204, -113, -334, -304, -217, 153, -285, -474, -499, -608, 46, -464, 705, -94, 503, -91,
+    -105, -5, 4, -98, 271, -121, -133, -104, 292, -416, -233, -509, 232, -242, -94, 71,
+    -78, 335, 8, -360, -245, 566, 123, 218, -305, -195, -10, -74, 431, 3, 63, -253,
+    -763, 613, -77, 77, 216, 134, -106, 65, 127, -38, 250, -44, -120, 40, 92, 60,
+    -232, -22, 29, 261, -60, -116, 262, 344, -471, -276, -172, 30, 267, 169, -360, 178,
+    -108, -40, 150, -167, 357, -215, 152, 110, 358, -54, -327, -159, 116, -168, 402, 307,
+    69, -569, -86, 400, 26, -210, 194, -464, -44, -126, 156, -525, 147, 216, 93, -552,
+    -31, -6, 415, -476, 114, 288, -556, 276, -349, -291, 61, 351, -160, -527, -119, -7,
+    393, -60, 133, 39, -321, 81, -174, -155, -93, -12, 362, 174, 169, 470, 57, -108,
+    -359, 440, 99, 168, -285, 182, -133, -96, -5, 315, -140, -235, 433, 13, -291, 195,
+    -69, -168, -4, 233, 319, 195, -780, 91, -80, 96, -79, 478, 74, -414, -137, 53,
+    118, -215, -467, -77, 257, 202, -109, -246, 125, 35, -4, 298, 57, 88, 256, -290,
+    -146, 326, -4, -784, -154, 273, 149, -506, -247, -297, 633, 514, 278, 648, -55, -428,
+    452, 383, -210, 181, -10, 197, 345, -363, -706, -35, -341, -514, -258, -99, -269, -15,
+    -13, -397, -202, 230, 79, -100, 196, -282, -292, 479, -168, 295, -167, -240, 325, 202,
+    -206, 92, 252, -335, 822, -219, -447, 116, -234, -513, -66, 143, -248, -495, 106, 516,
+    -257, 206, 291, 123, -43, 384, 147, 297, 67, -324, 156, 54, -525, -23, -266, -515,
+    439, 420, -51, 144, -476, -59, -248, -193, -110, 298, -172, 398, -219, 280, -155, -185,
+    -170, -110, 305, 27, 133, 193, 365, 144, -387, -345, -203, 37, 127, 387, -65, -188,
+    304, 5791, 11775, 16062, 18877, 20523, 19464, 16296, 12073, 6215, 41, -6194, -12078, -15782, -18993, -19659,
+    -19060, -16287, -11424, -5804, -245, 7035, 12088, 16513, 19012, 20403, 18959, 16042, 11362, 5301, 4, -6153,
+    -11555, -16740, -19009, -20206, -19173, -15972, -12031, -6126, -30, 6337, 11781, 16012, 19143, 20537, 18800, 16113,
+    11742, 5764, -226, -6233, -11654, -16016, -19169, -20220, -19384, -16125, -11946, -5987, -121, 6086, 11695, 16475,
+    19132, 20028, 19155, 15989, 11501, 6135, 316, -6233, -11760, -16158, -19185, -20108, -19071, -16197, -11622, -6454,
+    -57, 6517, 12093, 15948, 19744, 20166, 19024, 16220, 11216, 5944, 457, -6603, -11774, -15518, -18857, -19695,
+    -18979, -16439, -11865, -5869, 375, 6177, 11986, 16436, 19101, 19852, 18855, 16039, 11677, 6174, -162, -6086,
+    -11194, -16499, -18728, -20315, -19038, -16341, -11573, -6108, -95, 6467, 11898, 16182, 18965, 20064, 19063, 16215,
+    12084, 6368, -451, -6546, -11818, -15984, -18946, -20183, -19683, -16226, -11684, -5768, -146, 6681, 11500, 16513,
+    19350, 19594, 19181, 15949, 11763, 6040, 455, -6190, -11688, -15923, -18822, -20337, -19297, -16030, -11850, -6876,
+    -32, 6320, 11251, 15950, 18968, 20253, 19293, 16201, 12109, 6280, 141, -6172, -11605, -16310, -19893, -20208,
+    -19236, -16304, -12334, -6240, 300, 5709, 11536, 16056, 19014, 19581, 19577, 15805, 11484, 6189, -215, -6196,
+    -11464, -16086, -19191, -19796, -19275, -16356, -11789, -5847, -111, 5848, 12027, 16287, 19154, 19809, 18643, 16487,
+    12061, 6246, 548, -6406, -11956, -16169, -18749, -20128, -19061, -16171, -11808, -6090, 367, 6308, 12239, 16391,
+    18732, 20282, 19111, 16008, 11873, 5973, 451, -6452, -12085, -16239, -18903, -20187, -19032, -16260, -11712, -6181,
+    -257, 6369, 11808, 16175, 19259, 20117, 19572, 16511, 11717, 6841, 173, -6251, -11591, -16126, -18829, -20145,
+    -18972, -16708, -11699, -5808, 526, 6874, 11721, 16499, 19109, 19817, 18675, 15618, 11871, 6003, -604, -6455,
+    -12056, -15917, -19229, -19651, -19486, -16088, -11751, -6185, 39, 5919, 11390, 15808, 18962, 19320, 19064, 16186,
+    11595, 5771, -22, -6055, -11761, -15970, -18923, -20580, -18166, -15962, -11644, -5846, -26, 6189, 11820, 15714,
+    19241, 20170, 18979, 16110, 11910, 6327, -339, -5958, -12062, -15898, -19074, -19977, -19262, -16117, -12186, -6080,
+    96, 5954, 11581, 16024, 18852, 19856, 19160, 16330, 11547, 6036, 491, -6285, -11549, -16360, -18942, -19883,
+    -18775, -15935, -11811, -6843, 78, 6110, 12200, 16442, 19566, 20430, 18666, 16543, 11718, 6306, 324, -6630,
+    -11802, -15693, -18870, -19879, -18993, -16395, -12068, -5746, 6, 6414, 11382, 15901, 19094, 20269, 18446, 16038,
+    12231, 5922, -70, -6145, -11992, -16391, -18743, -19849, -18779, -16094, -11774, -6203, 301, 6738, 12157, 16794,
+    18661, 19761, 19297, 16234, 12126, 5945, 67, -5744, -12088, -16746, -18829, -19659, -19392, -16300, -12249, -5969,
+    -93, 6147, 11588, 15894, 19471, 19489, 19288, 16219, 12079, 6294, -64, -5802, -11765, -16174, -19190, -20106,
+    -18467, -16449, -11759, -5559, 280, 6091, 12086, 15943, 19176, 20249, 18881, 15944, 11969, 6491, 452, -5607,
+    -11577, -15962, -19254, -20285, -19689, -16159, -11769, -6334, 48, 5729, 11530, 16512, 19076, 19480, 18660, 16519,
+    12122, 6444, 239, -6291, -12037, -16019, -18859, -20062, -18974, -16125, -11383, -5980, -22, 6433, 11781, 16330,
+    19469, 19655, 19034, 15950, 11696, 6212, 331, -5921, -11755, -16157, -19178, -19531, -19197, -15454, -11940, -6257,
+    -4, 5670, 11544, 16171, 19264, 19884, 18797, 16024, 11858, 5586, -72, -5708, -11313, -16315, -19133, -19498,
+    -18974, -16190, -12078, -6212, 483, 6099, 12130, 16673, 18788, 19479, 18801, 16397, 11968, 6203, -10, -6615,
+    -11761, -16877, -19412, -19617, -19150, -16094, -11329, -6574, -269, 6498, 11708, 16058, 18731, 20395, 18545, 16226,
+    12059, 6394, -5, -6292, -11701, -15846, -19100, -19909, -19076, -15623, -11930, -6428, -48, 6483, 11264, 16679,
+    19112, 20422, 18810, 15538, 11537, 5896, -145, -6589, -11692, -16190, -19234, -19838, -19003, -16471, -11815, -5667,
+    -660, 5991, 11104, 16259, 18741, 20017, 18810, 16166, 11826, 6455, -8, -5755, -11843, -15917, -18561, -20194,
+    -18712, -16081, -11041, -6740, -417, 5670, 11445, 15786, 19065, 19825, 19478, 16182, 12079, 6353, -483, -6204,
+    -11551, -15924, -19088, -20107, -19411, -15797, -12159, -6095, -542, 6123, 11830, 16160, 19015, 19919, 19336, 15991,
+    11630, 6167, -56, -6125, -11259, -16060, -19291, -19806, -19546, -15854, -11511, -6423, -436, 6241, 11139, 16258,
+    19304, 19831, 19377, 15851, 11607, 5886, -210, -6451, -11263, -15376, -18575, -20245, -19161, -16180, -11511, -6200,
+    -156, 6342, 12005, 16257, 18952, 19922, 18446, 16004, 11551, 6623, 319, -6765, -12100, -15855, -19012, -20062,
+    -18876, -16610, -11801, -6758, -278, 6096, 11435, 16285, 19009, 19860, 19012, 16372, 11963, 6415, -386, -6331,
+    -11401, -16401, -18884, -20264, -19165, -15656, -11737, -6739, 93, 6578, 11686, 15514, 18799, 19855, 19070, 16193,
+    11880, 6046, 53, -6096, -11281, -16124, -18802, -20355, -18764, -16117, -12193, -6087, 192, 6006, 11975, 15642,
+    19168, 20498, 19043, 16422, 11643, 6344, 643, -5568, -11728, -16248, -18909, -20275, -19218, -16411, -11738, -6762,
+    768, 6693, 11428, 15923, 18759, 20340, 18934, 16363, 11592, 6273, -28, -6343, -12199, -16412, -18744, -19854,
+    -18819, -16474, -11310, -5960, -96, 6058, 12112, 15864, 19134, 20573, 18559, 15706, 12111, 6035, -121, -5860,
+    -11383, -16047, -18930, -19744, -18634, -16220, -11664, -6393, -25, 6360, 11608, 15888, 19262, 19504, 18506, 16185,
+    11849, 5968, 24, -5998, -12046, -16035, -18797, -19914, -19233, -15865, -11924, -6163, -92, 5819, 11695, 16575,
+    19251, 19434, 18839, 15870, 11823, 6298, 239, -6295, -11741, -16141, -19026, -19396, -19127, -16403, -11203, -6725,
+    -60, 6083, 11660, 15859, 18837, 19645, 19291, 15644, 11701, 6387, -164, -6397, -11913, -16115, -18513, -20221,
+    -19143, -16181, -12174, -5779, 261, 6908, 11610, 16559, 19219, 19939, 18372, 16029, 11669, 5800, 39, -6479,
+    -11937, -16181, -19032, -20431, -18895, -15663, -12074, -6392, 391, 6380, 11784, 16446, 18907, 20657, 19307, 16095,
+    11755, 6123, 366, -5978, -11540, -15849, -18536, -20030, -18685, -16400, -11524, -6173, -259, 5852, 11326, 16484,
+    18809, 19740, 19786, 16472, 12017, 6502, 334, -5709, -11948, -16305, -19251, -20540, -18818, -16275, -11824, -5953,
+    -244, 6466, 11837, 16201, 19042, 19748, 18695, 16390, 11502, 6340, -93, -6103, -11612, -16064, -19067, -19727,
+    -19218, -16082, -12179, -6400, -80, 5937, 11387, 16534, 19641, 19366, 18568, 16378, 11517, 6294, -70, -6609,
+    -11411, -16417, -19173, -19917, -19422, -16224, -11793, -6600, 303, 5926, 11547, 16090, 18811, 20008, 19018, 17152,
+    11883, 6042, 338, -6495, -11603, -15830, -19533, -19865, -18176, -16241, -11499, -6067, -792, 6470, 11936, 16474,
+    19085, 19816, 19212, 16305, 11490, 6291, 945, -6223, -11446, -15684, -18733, -19632, -19069, -16087, -12106, -6704,
+    78, 68, 585, -72, 44, -166, 163, 67, -142, -177, 436, 54, -522, 525, 307, 111,
+    -195, -211, 430, -325, 111, 498, -156, 191, -294, -638, -229, -300, -204, 123, 470, 194,
+    -563, -149, 237, -100, -257, 122, 302, -415, 557, -319, -37, -470, -22, 385, -530, -668,
+    269, -58, 376, 556, -438, -125, 507, 226, 331, 304, -481, -493, -44, 745, -24, 148,
+    268, -185, -84, -22, -534, -296, 281, 276, -264, -339, 317, 386, -716, 261, 193, 52,
+    203, -80, -461, 204, -187, -103, -335, 630, -303, -355, -352, -118, -80, -198, 343, 79,
+    -142, 268, 326, -388, -79, -26, 146, 70, 412, 249, -218, 92, 574, -181, -132, 28,
+    42, 292, 259, -705, -19, 33, -432, -101, -697, 122, 475, -126, -157, -323, -71, 99,
+    269, -152, 449, 201, 115, 496, -721, -536, -149, 311, -367, 42, 40, 51, -138, 136,
+    -56, 405, 439, 309, -93, 381, 24, 164, -459, -201, -68, 243, 181, -20, -519, -100,
+    -199, 441, -144, 120, -319, -304, 82, 130, 549, 178, 223, 317, -593, -407, 133, -218,
+    -549, -363, -310, 571, -466, -386, -170, -187, -279, -449, 388, -173, -69, -103, -276, 106,
+    -544, 32, -6, 88, 7, 55, 100, -31, 115, 838, -75, -491, -443, 91, -405, 158,
+    -390, -19, 844, 369, 266, -163, -162, 48, -373, -80, -340, 21, -201, 228, 205, 252,
+    -310, 243, 50, 362, -84, 210, -62, 647, 475, -92, 247, 147, -169, -567, 140, -301,
+    -198, -493, -110, -189, -49, -359, 591, 272, -297, -76, 607, 185, 199, 289, -331, -19,
+    792, -120, 69, -28, -168, 96, -679, 187, -572, 57, 316, -380, -156, -458, 173, 305,
+    179, -223, 417, 679, -151, -106, -187, 794, 155, -326, -191, 267, 141, -1, -616, 545,
+    251, 544, 196, 275, 188, -524, 81, 181, -128, -161, 124, 158, 92, 184, 625, -17,
+    -127, 328, -284, -382, 240, 44, 100, 387, 157, 373, 294, -243, -593, 100, -286, -262,
+    343, 83, 241, -101, 231, -215, -148, -87, -137, -423, -167, 93, -363, 530, -79, -507,
+    401, 145, -372, -177, -222, -333, -335, 382, 68, -4, -438, 313, -248, -183, -542, 53,
+    -174, 86, -210, 145, 328, -12, -469, -217, -382, 203, -232, 284, -153, 76, 366, -14,
+    70, 12, -38, 521, -309, -53, 559, -194, -113, 304, -241, 14, 427, -56, -213, -71,
+    652, 32, -58, -126, 596, -179, 296, -280, -172, 342, -36, 298, -199, -332, 1, 242,
+    439, 100, -200, -27, 332, 234, -308, -281, 206, 267, -191, 625, -382, -165, -319, -388,
+    95, 169, -411, -653, 221, -87, -275, 138, -102, -396, -126, -159, 192, 20, -110, 150,
+    -70, 585, -183, 2, -227, 62, 190, -200, 751, 44, -132, 105, 124, 73, 118, 196,
+    -377, 60, -413, 413, 123, -38, -226, 297, -210, 275, 264, 20, 166, -210, 112, -286,
+    71, -225, -388, -620, -461, 66, 34, -599, 14, -7, 391, -357, -414, 247, 383, -101,
+    12, -325, -329, 357, 91, -425, -364, -651, 73, 177, 332, -59, 105, -802, 213, -492,
+    204, -468, -16, 184, 21, -62, 386, -46, 153, -336, -74, -397, 225, -54, -284, -298,
+    388, 214, -78, 128, 307, 139, -13, -60, 381, -39, 251, -171, 218, -97, -243, 262,
+    -694, -365, -24, -212, -96, 44, -5, 55, -372, 23, -343, -395, 439, -432, 288, -122,
+    328, -481, 123, 50, 151, 391, -105, 480, -190, -99, 117, -214, -489, 326, -289, 144,
+    6, 413, 205, -322, 468, 461, 443, 383, -12, -35, 109, 203, 403, -160, 127, 82,
+    -120, 448, 115, 255, 173, 327, 79, 146, -59, 438, -60, -60, 253, 107, -212, -283,
+    -105, 485, 557, -117, 216, 166, -343, 133, -397, 129, 330, 70, 41, -14, -172, 216,
+    -160, 502, 184, 264, -277, -358, -234, -212, 27, -26, 1, -183, -686, -184, -19, 588,
+    -126, -394, -378, 28, -230, 70, -78, -79, -133, 67, -5, 180, 101, 716, 73, 197,
+};
+static const uint16_t WAKE_FEATURES_4[] = {
+    619, 585, 632, 580, 619, 570, 620, 578, 649, 609, 668, 604, 609, 578, 628, 575, 634, 583, 632, 588, 631, 584, 626, 586, 632, 583, 634, 587, 631, 585, 635, 587, 637, 587, 632, 587, 631, 587, 634, 588,
+    559, 473, 377, 520, 599, 549, 600, 535, 608, 564, 624, 557, 611, 540, 583, 552, 605, 544, 563, 506, 594, 529, 588, 513, 580, 526, 586, 555, 605, 530, 583, 539, 603, 549, 603, 553, 610, 553, 604, 551,
+    645, 589, 646, 590, 648, 594, 650, 598, 645, 534, 595, 553, 653, 592, 644, 585, 624, 569, 623, 552, 610, 557, 615, 546, 587, 557, 595, 486, 584, 533, 589, 524, 577, 520, 591, 501, 581, 519, 584, 511,
+    486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 437, 274, 465, 353, 501, 409, 519, 425, 526, 442, 537, 488, 550, 477, 538, 492, 569, 466, 534, 467, 573, 504, 575, 498, 566, 478,
+    266, 0, 430, 0, 0, 0, 287, 0, 0, 0, 0, 0, 339, 0, 416, 287, 434, 377, 491, 344, 487, 486, 559, 455, 557, 455, 513, 375, 520, 470, 561, 463, 549, 480, 552, 470, 534, 484, 548, 468,
+    336, 0, 426, 0, 318, 0, 297, 0, 0, 0, 0, 0, 203, 0, 446, 306, 394, 368, 507, 409, 525, 434, 522, 454, 527, 450, 511, 434, 549, 472, 518, 454, 524, 470, 529, 471, 539, 455, 525, 419,
+    461, 177, 432, 274, 414, 0, 375, 0, 0, 0, 0, 0, 331, 222, 346, 0, 481, 382, 497, 430, 509, 407, 520, 445, 509, 381, 550, 472, 490, 422, 507, 466, 537, 450, 516, 442, 530, 451, 546, 461,
+    453, 344, 425, 0, 387, 0, 382, 0, 0, 0, 0, 0, 177, 133, 473, 339, 491, 385, 496, 297, 477, 402, 492, 302, 488, 349, 511, 391, 490, 445, 495, 364, 523, 416, 491, 396, 517, 408, 533, 409,
+    390, 0, 274, 0, 0, 0, 392, 0, 0, 0, 0, 0, 133, 0, 325, 0, 426, 355, 458, 328, 524, 377, 494, 297, 493, 371, 472, 409, 513, 398, 517, 405, 507, 362, 507, 406, 483, 371, 504, 382,
+    589, 540, 599, 553, 605, 553, 605, 559, 611, 444, 499, 524, 609, 549, 595, 531, 580, 497, 565, 487, 538, 472, 529, 445, 526, 417, 512, 419, 511, 391, 499, 382, 494, 359, 498, 414, 470, 366, 467, 369,
+    0, 0, 0, 0, 0, 0, 0, 0, 422, 526, 585, 488, 0, 0, 0, 0, 407, 0, 453, 297, 468, 248, 469, 433, 492, 366, 417, 0, 483, 417, 481, 410, 427, 351, 470, 416, 499, 385, 454, 328,
+    0, 0, 0, 0, 0, 0, 0, 0, 412, 508, 566, 472, 0, 0, 248, 0, 423, 236, 411, 0, 401, 203, 421, 222, 416, 302, 446, 248, 437, 393, 463, 203, 422, 302, 443, 266, 460, 302, 462, 361,
+    575, 522, 576, 519, 578, 527, 582, 529, 580, 480, 545, 501, 587, 521, 568, 515, 555, 501, 542, 457, 511, 430, 522, 430, 503, 404, 497, 377, 464, 314, 501, 372, 463, 355, 474, 318, 465, 383, 482, 374,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 0, 344, 133, 465, 346, 353, 0, 383, 0, 414, 177, 471, 302, 465, 355, 469, 325, 477, 344, 461, 328, 427, 236, 473, 287,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 236, 0, 311, 0, 405, 133, 371, 280, 478, 0, 440, 342, 424, 0, 375, 287, 364, 349, 461, 325, 494, 339, 453, 311,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 0, 203, 0, 379, 0, 441, 314, 448, 351, 469, 353, 426, 292, 428, 328, 399, 133, 445, 133, 449, 258, 396, 248,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 314, 0, 236, 0, 437, 203, 405, 0, 349, 222, 439, 222, 444, 342, 440, 302, 391, 133, 439, 248, 454, 177, 443, 133, 427, 331,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 318, 0, 420, 266, 427, 133, 411, 297, 395, 0, 408, 177, 423, 203, 465, 353, 394, 0, 431, 331, 463, 297, 399, 177,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 266, 0, 415, 0, 402, 306, 442, 0, 413, 0, 418, 203, 383, 133, 374, 302, 462, 322, 426, 222, 417, 314, 442, 353,
+    560, 514, 563, 515, 565, 521, 567, 520, 573, 346, 426, 485, 569, 514, 556, 498, 530, 459, 530, 475, 511, 394, 485, 377, 468, 416, 432, 297, 386, 318, 452, 325, 427, 203, 455, 322, 434, 0, 325, 133,
+    0, 0, 0, 0, 0, 0, 0, 0, 287, 498, 553, 443, 0, 0, 222, 0, 0, 0, 133, 0, 0, 0, 0, 133, 314, 177, 314, 0, 401, 0, 334, 258, 328, 0, 410, 203, 349, 203, 401, 222,
+    0, 0, 0, 0, 0, 0, 0, 0, 274, 484, 538, 426, 0, 0, 0, 0, 0, 0, 311, 133, 395, 203, 397, 177, 331, 0, 391, 302, 381, 0, 417, 302, 328, 0, 409, 133, 334, 280, 314, 236,
+    537, 498, 547, 499, 554, 503, 554, 509, 552, 461, 519, 479, 556, 493, 540, 476, 528, 463, 501, 423, 502, 404, 461, 342, 454, 377, 396, 318, 451, 287, 362, 177, 433, 355, 381, 292, 442, 369, 362, 177,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0, 0, 0, 342, 0, 0, 0, 334, 0, 349, 318, 451, 258, 437, 222, 382, 203, 405, 0, 364, 133, 422, 203,
+};
+
+static const int16_t WAKE_PCM_5[] = {
+    0, 1578, 3167, 4766, 6372, 7982, 9592, 11200, 12802, 14395, 15976, 17541, 19085, 20607, 22101, 23563,
+    24990, 26378, 27722, 29018, 30263, 31451, 32579, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32557, 31201,
+    29737, 28168, 26497, 24727, 22864, 20911, 18875, 16760, 14573, 12321, 10011, 7650, 5247, 2810, 348, -2130,
+    -4614, -7095, -9561, -12004, -14412, -16774, -19081, -21320, -23481, -25553, -27526, -29390, -31133, -32746, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -31663,
+    -29771, -27705, -25475, -23091, -20564, -17908, -15135, -12261, -9301, -6272, -3191, -76, 3054, 6179, 9281, 12338,
+    15331, 18239, 21042, 23721, 26256, 28628, 30819, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 31367, 29061, 26518, 23756, 20795, 17654, 14359, 10934, 7405, 3801,
+    151, -3515, -7166, -10769, -14295, -17710, -20984, -24085, -26985, -29656, -32069, -32768, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32373, -29863, -27043, -23938, -20578, -16994, -13221, -9297, -5262,
+    -1156, 2976, 7091, 11144, 15089, 18883, 22481, 25842, 28925, 31693, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 31901, 29031, 25793, 22223, 18363, 14259, 9960, 5521, 996, -3556, -8076,
+    -12504, -16782, -20850, -24652, -28135, -31248, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32301, -29223, -25706, -21801, -17561, -13046, -8323, -3460, 1470, 6392, 11230, 15908, 20354, 24493, 28260, 31591,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32586, 29306, 25522, 21292, 16687, 11782, 6659,
+    1407, -3884, -9122, -14212, -19063, -23587, -27699, -31322, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768,
+    -32768, -30724, -26890, -22528, -17719, -12552, -7127, -1547, 4077, 9635, 15014, 20106, 24806, 29014, 32641, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 30930, 26893, 22266, 17147, 11642, 5869, -47, -5976, -11787,
+    -17349, -22536, -27229, -31317, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -30585, -26262, -21302, -15822,
+    -9948, -3820, 2415, 8606, 14599, 20247, 25408, 29949, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30269, 25670, 20391, 14565, 8342, 1885, -4637, -11049, -17179, -22859, -27934, -32260, -32768, -32768, -32768, -32768,
+    -32768, -32768, -32768, -30553, -25794, -20292, -14200, -7689, -942, 5845, 12478, 18761, 24509, 29549, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 31920, 27237, 21710, 15504, 8808, 1824, -5231, -12136, -18675, -24638, -29834,
+    -32768, -32768, -32768, -32768, -32768, -32768, -32768, -30340, -25137, -19096, -12411, -5301, 2000, 9249, 16200, 22619,
+    28284, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30522, 25163, 18908, 11972, 4599, -2953, -10413, -17514,
+    -23997, -29624, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -27847, -21795, -14912, -7455, 298, 8054, 15517,
+    22400, 28436, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 27752, 21488, 14357, 6639, -1359, -9317, -16913,
+    -23836, -29801, -32768, -32768, -32768, -32768, -32768, -32768, -30716, -24854, -17937, -10252, -2120, 6117, 14107, 21508,
+    27999, 32767, 32767, 32767, 32767, 32767, 32767, 31398, 25526, 18513, 10666, 2330, -6124, -14318, -21880, -28467,
+    -32768, -32768, -32768, -32768, -32768, -32768, -29998, -23630, -16151, -7904, 726, 9337, 17521, 24889, 31086, 32767,
+    32767, 32767, 32767, 32767, 32128, 26121, 18830, 10605, 1847, -7017, -15549, -23322, -29948, -32768, -32768, -32768,
+    -32768, -32768, -32447, -26375, -18947, -10537, -1573, 7487, 16174, 24035, 30658, 32767, 32767, 32767, 32767, 32767,
+    31044, 24436, 16514, 7696, -1548, -10724, -19334, -26910, -32768, -32768, -32768, -32768, -32768, -32768, -27543, -19986,
+    -11304, -1977, 7474, 16520, 24648, 31393, 32767, 32767, 32767, 32767, 32767, 28708, 21228, 12508, 3047, -6606,
+    -15886, -24248, -31196, -32768, -32768, -32768, -32768, -32768, -28133, -20369, -11367, -1665, 8151, 17487, 25770, 32490,
+    32767, 32767, 32767, 32767, 32499, 25715, 17317, 7824, -2173, -12047, -21176, -28977, -32768, -32768, -32768, -32768,
+    -32768, -28968, -21078, -11813, -1768, 8406, 18045, 26517, 32767, 32767, 32767, 32767, 32767, 30553, 22915, 13732,
+    3614, -6760, -16693, -25509, -32605, -32768, -32768, -32768, -32768, -30734, -23002, -13668, -3373, 7170, 17228, 26093,
+    32767, 32767, 32767, 32767, 32767, 29543, 21350, 11619, 1043, -9623, -19609, -28190, -32768, -32768, -32768, -32768,
+    -32768, -26775, -17797, -7493, 3379, 14015, 23621, 31477, 32767, 32767, 32767, 32767, 30308, 22037, 12082, 1193,
+    -9801, -20059, -28789, -32768, -32768, -32768, -32768, -32355, -24586, -14885, -4004, 7204, 17859, 27117, 32767, 32767,
+    32767, 32767, 32767, 25659, 16010, 5058, -6317, -17194, -26687, -32768, -32768, -32768, -32768, -32768, -25368, -15515,
+    -4364, 7163, 18107, 27553, 32767, 32767, 32767, 32767, 31965, 23681, 13374, 1916, -9719, -20537, -29605, -32768,
+    -32768, -32768, -32768, -29584, -20435, -9491, 2296, 13896, 24287, 32550, 32767, 32767, 32767, 32767, 25620, 15388,
+    3764, -8211, -19461, -28966, -32768, -32768, -32768, -32768, -29185, -19662, -8323, 3795, 15577, 25932, 32767, 32767,
+    32767, 32767, 31434, 22471, 11386, -785, -12895, -23798, -32456, -32768, -32768, -32768, -32630, -23980, -13012, -778,
+    11545, 22764, 31785, 32767, 32767, 32767, 32767, 24299, 13254, 888, -11579, -22912, -31982, -32768, -32768, -32768,
+    -32420, -23455, -12118, 455, 12995, 24232, 32767, 32767, 32767, 32767, 30982, 21380, 9567, -3247, -15739, -26613,
+    -32768, -32768, -32768, -32768, -28433, -17936, -5539, 7456, 19676, 29824, 32767, 32767, 32767, 32767, 24493, 12950,
+    0, -12964, -24539, -32768, -32768, -32768, -32768, -29344, -18861, -6297, 6974, 19489, 29865, 32767, 32767, 32767,
+    32740, 23337, 11313, -1993, -15089, -26499, -32768, -32768, -32768, -32768, -26539, -15058, -1843, 11596, 23717, 32767,
+    32767, 32767, 32767, 28653, 17606, 4496, -9152, -21743, -31798, -32768, -32768, -32768, -29844, -19042, -5968, 7829,
+    20707, 31123, 32767, 32767, 32767, 30220, 19426, 6272, -7656, -20667, -31176, -32768, -32768, -32768, -29818, -18777,
+    -5412, 8635, 21627, 31951, 32767, 32767, 32767, 28599, 17065, 3378, -10746, -23531, -32768, -32768, -32768, -32768,
+    -26452, -14220, -159, 13935, 26256, 32767, 32767, 32767, 32767, 23212, 10157, -4233, -18084, -29587, -32768, -32768,
+    -32768, -30091, -18692, -4811, 9719, 22974, 32767, 32767, 32767, 32767, 25537, 12731, -1800, -16101, -28243, -32768,
+    -32768, -32768, -30714, -19317, -5272, 9508, 22998, 32767, 32767, 32767, 32767, 24551, 11289, -3554, -17916, -29792,
+    -32768, -32768, -32768, -28539, -16194, -1552, 13322, 26323, 32767, 32767, 32767, 31452, 20023, 5714, -9427, -23227,
+    -32768, -32768, -32768, -32768, -22864, -8910, 6354, 20705, 32040, 32767, 32767, 32767, 24820, 11157, -4168, -18890,
+    -30821, -32768, -32768, -32768, -25985, -12487, 2898, 17860, 30145, 32767, 32767, 32767, 26422, 12925, -2553, -17655,
+    -30071, -32768, -32768, -32768, -26157, -12481, 3136, 18281, 30603, 32767, 32767, 32767, 25174, 11145, -4643, -19715,
+    -31698, -32768, -32768, -32768, -23417, -8892, 7060, 21901, 32767, 32767, 32767, 32552, 20801, 5690, -10353, -24735,
+    -32768, -32768, -32768, -30098, -17221, -1521, 14442, 28051, 32767, 32767, 32767, 26664, 12585, -3592, -19185, -31603,
+    -32768, -32768, -32768, -22064, -6837, 9551, 24345, 32767, 32767, 32767, 29536, 16151, 9, -16147, -29563, -32768,
+    -32768, -32768, -23943, -8876, 7733, 23020, 32767, 32767, 32767, 30052, 16657, 346, -16039, -29629, -32768, -32768,
+    -32768, -23158, -7713, 9108, 24330, 32767, 32767, 32767, 28346, 14153, -2585, -18872, -31784, -32768, -32768, -32301,
+    -19578, -3300, 13589, 28023, 32767, 32767, 32767, 23998, 8419, -8717, -24265, -32768, -32768, -32768, -27489, -12724,
+    4414, 20745, 32767, 32767, 32767, 30158, 16222, -771, -17631, -31184, -32768, -32768, -32128, -18953, -2169, 15041,
+    29398, 32767, 32767, 32767, 20972, 4390, -13050, -27988, -32768, -32768, -32768, -22333, -5894, 11704, 27035, 32767,
+    32767, 32767, 23079, 6689, -11030, -26588, -32768, -32768, -32768, -23238, -6780, 11038, 26671, 32767, 32767, 32767,
+    22815, 6170, -11729, -27278, -32768, -32768, -32768, -21794, -4851, 13091, 28380, 32767, 32767, 32767, 20142, 2818,
+    -15098, -29918, -32768, -32768, -31842, -17807, -65, 17703, 31798, 32767, 32767, 29763, 14734, -3398, -20828, -32768,
+    -32768, -32768, -26964, -10873, 7535, 24357, 32767, 32767, 32767, 23325, 6198, -12270, -28117, -32768, -32768, -32693,
+    -18739, -722, 17466, 31875, 32767, 32767, 28875, 13143, -5474, -22906, -32768, -32768, -32768, -23839, -6539, 12218,
+    28284, 32767, 32767, 32042, 17493, -967, -19224, -32768, -32768, -32768, -26614, -9857, 9133, 26075, 32767, 32767,
+    32767, 19495, 1102, -17555, -32222, -32768, -32768, -27443, -10761, 8404, 25650, 32767, 32767, 32767, 19322, 715,
+    -18070, -32669, -32768, -32768, -26460, -9290, 10067, 27077, 32767, 32767, 32026, 16958, -2126, -20720, -32768, -32768,
+    -32768, -23506, -5383, 14036, 30114, 32767, 32767, 28844, 12205, -7382, -25204, -32768, -32768, -32768, -18190, 1031,
+    20015, 32767, 32767, 32767, 23274, 4827, -14816, -30835, -32768, -32768, -27466, -10076, 9817, 27292, 32767, 32767,
+    30821, 14660, -5167, -23716, -32768, -32768, -32768, -18569, 968, 20273, 32767, 32767, 32767, 21827, 2721, -17089,
+    -32566, -32768, -32768, -24479, -5869, 14256, 30739, 32767, 32767, 26581, 8470, -11839, -29101, -32768, -32768, -28190,
+    -10531, 9882, 27731, 32767, 32767, 29361, 12064, -8411, -26687, -32768, -32768, -30137, -13084, 7442, 26010, 32767,
+    32767, 30554, 13605, -6985, -25721, -32768, -32768, -30629, -13632, 7042, 25833, 32767, 32767, 30366, 13167, -7613,
+    -26339, -32768, -32768, -29752, -12202, 8694, 27224, 32767, 32767, 28762, 10727, -10275, -28455, -32768, -32768, -27354,
+    -8726, 12338, 29982, 32767, 32767, 25478, 6185, -14851, -31737, -32768, -32768, -23078, -3098, 17769, 32767, 32767,
+    32767, 20095, -532, -21020, -32768, -32768, -32768, -16480, 4677, 24505, 32767, 32767, 30143, 12197, -9281, -28089,
+    -32768, -32768, -26609, -7240, 14248, 31598, 32767, 32767, 22223, 1642, -19433, -32768, -32768, -32768, -16937, 4509,
+    24635, 32767, 32767, 29363, 10758, -11056, -29592, -32768, -32768, -24159, -3767, 17766, 32767, 32767, 32767, 17743,
+    -3864, -24318, -32768, -32768, -29131, -10191, 11855, 30308, 32767, 32767, 22682, 1703, -19810, -32768, -32768, -32282,
+    -14725, 7379, 27219, 32767, 32767, 25840, 5501, -16556, -32768, -32768, -32768, -17485, 4555, 25183, 32767, 32767,
+    27492, 7531, -14810, -32498, -32768, -32768, -18608, 3462, 24447, 32767, 32767, 27823, 7825, -14681, -32510, -32768,
+    -32768, -18164, 4118, 25090, 32767, 32767, 26876, 6390, -16174, -32768, -32768, -32768, -16125, 6514, 27044, 32767,
+    32767, 24535, 3197, -19201, -32768, -32768, -31250, -12375, 10591, 30074, 32767, 32767, 20564, -1774, -23535, -32768,
+    -32768, -27450, -6774, 16176, 32767, 32767, 32767, 14674, -8443, -28732, -32768, -32768, -21653, 725, 22870, 32767,
+    32767, 27537, 6663, -16492, -32768, -32768, -32243, -13481, 9911, 29916, 32767, 32767, 19564, -3391, -25189, -32768,
+    -32768, -24817, -2859, 20104, 32767, 32767, 29203, 8685, -14877, -32768, -32768, -32734, -13983, 9688, 29965, 32767,
+    32767, 18694, -4680, -26412, -32768, -32768, -22796, -40, 22742, 32767, 32767, 26297, 4399, -19085, -32768, -32768,
+    -29227, -8350, 15543, 32767, 32767, 31633, 11872, -12197, -31859, -32768, -32768, -14959, 9109, 29869, 32767, 32767,
+    17620, -6320, -27956, -32768, -32768, -19873, 3862, 26186, 32767, 32767, 21742, -1752, -24608, -32768, -32768, -23251,
+    0, 23262, 32767, 32767, 24424, 1389, -22179, -32768, -32768, -25285, -2414, 21379, 32767, 32767, 25850, 3075,
+    -20879, -32768, -32768, -26133, -3373, 20685, 32767, 32767, 26140, 3310, -20801, -32768, -32768, -25871, -2884, 21227,
+    32767, 32767, 25319, 2095, -21953, -32768, -32768, -24473, -942, 22968, 32767, 32767, 23315, -574, -24250, -32768,
+    -32768, -21823, 2453, 25774, 32767, 32767, 19973, -4687, -27501, -32768, -32768, -17739, 7264, 29383, 32767, 32767,
+    15098, -10161, -31361, -32768, -32557, -12032, 13346, 32767, 32767, 30369, 8532, -16769, -32768, -32768, -27680, -4601,
+    20362, 32767, 32767, 24440, 261, -24036, -32768, -32768, -20610, 4443, 27681, 32767, 32767, 16171, -9439, -31159,
+    -32768, -32253, -11132, 14622, 32767, 32767, 28595, 5532, -19851, -32768, -32768, -24078, 543, 24948, 32767, 32767,
+    18695, -6965, -29698, -32768, -32768, -12493, 13547, 32767, 32767, 28818, 5576, -20052, -32768, -32768, -23223, 1879,
+    26188, 32767, 32767, 16504, -9622, -31617, -32768, -31128, -8812, 17324, 32767, 32767, 25193, 393, -24589, -32768,
+    -32768, -17822, 8398, 30962, 32767, 31529, 9242, -17109, -32768, -32768, -24904, 182, 25198, 32767, 32767, 16568,
+    -9948, -32067, -32768, -30127, -6886, 19429, 32767, 32767, 22306, -3600, -27907, -32768, -32768, -12627, 14178, 32767,
+    32767, 26574, 1667, -24004, -32768, -32768, -17033, 9775, 32160, 32767, 29578, 5742, -20720, -32768, -32768, -20193,
+    6406, 30084, 32767, 31543, 8612, -18288, -32768, -32768, -22223, 4162, 28636, 32767, 32659, 10304, -16841, -32768,
+    -32768, -23225, 3080, 27960, 32767, 32767, 10848, -16447, -32768, -32768, -23258, 3169, 28117, 32767, 32767, 10257,
+    -17122, -32768, -32768, -22325, 4430, 29094, 32767, 31803, 8517, -18837, -32768, -32768, -20370, 6849, 30799, 32767,
+    30004, 5598, -21511, -32768, -32768, -17293, 10383, 32767, 32767, 27204, 1472, -24985, -32768, -32768, -12977, 14930,
+    32767, 32767, 23182, -3842, -28997, -32768, -31336, -7331, 20286, 32767, 32767, 17722, -10230, -32768, -32768, -26612,
+    -352, 26093, 32767, 32767, 10685, -17416, -32768, -32768, -20091, 7795, 31796, 32767, 28023, 2095, -24895, -32768,
+    -32768, -11634, 16693, 32767, 32767, 20292, -7752, -31884, -32768, -27648, -1384, 25593, 32767, 32767, 10223, -18183,
+    -32768, -32768, -18346, 10102, 32767, 32767, 25421, -1782, -28079, -32768, -31211, -6388, 21743, 32767, 32767, 14073,
+    -14725, -32768, -32768, -21005, 7363, 31908, 32767, 26982, 38, -26937, -32768, -31874, -7208, 21249, 32767, 32767,
+    13927, -15099, -32768, -32768, -20023, 8725, 32767, 32767, 25371, -2340, -28819, -32768, -29894, -3874, 24220, 32767,
+    32767, 9770, -19252, -32768, -32768, -15232, 14078, 32767, 32767, 20179, -8846, -32768, -32768, -24559, 3681, 29939,
+    32767, 28346, 1315, -26440, -32768, -31537, -6061, 22730, 32767, 32767, 10497, -18911, -32768, -32768, -14581, 15070,
+    32767, 32767, 18290, -11283, -32768, -32768, -21615, 7610, 32632, 32767, 24558, -4101, -30492, -32768, -27131, 793,
+    28284, 32767, 29353, 2290, -26066, -32768, -31250, -5128, 23886, 32767, 32767, 7712, -21785, -32768, -32768, -10038,
+    19797, 32767, 32767, 12107, -17949, -32768, -32768, -13923, 16266, 32767, 32767, 15493, -14763, -32768, -32768, -16825,
+    13455, 32767, 32767, 17927, -12352, -32768, -32768, -18808, 11461, 32767, 32767, 19474, -10788, -32768, -32768, -19932,
+    10337, 32767, 32767, 20186, -10109, -32768, -32768, -20239, 10106, 32767, 32767, 20091, -10327, -32768, -32768, -19741,
+    10773, 32767, 32767, 19185, -11440, -32768, -32768, -18419, 12325, 32767, 32767, 17434, -13422, -32768, -32768, -16225,
+    14725, 32767, 32767, 14781, -16223, -32768, -32768, -13095, 17902, 32767, 32767, 11160, -19745, -32768, -32768, -8970,
+    21729, 32767, 32767, 6522, -23828, -32768, -31297, -3817, 26007, 32767, 29409, 861, -28224, -32768, -27195, 2331,
+    30433, 32767, 24632, -5738, -32575, -32768, -21700, 9330, 32767, 32767, 18385, -13063, -32768, -32768, -14686, 16884,
+    32767, 32767, 10612, -20725, -32768, -32768, -6185, 24505, 32767, 30101, 1447, -28128, -32768, -26629, 3543, 31487,
+    32767, 22560, -8705, -32768, -32768, -17908, 13937, 32767, 32767, 12709, -19114, -32768, -32768, -7029, 24090, 32767,
+    30004, 967, -28702, -32768, -25504, 5349, 32767, 32767, 20177, -11754, -32768, -32768, -14101, 18050, 32767, 32767,
+    7396, -24013, -32768, -29702, -236, 29394, 32767, 24284, -7162, -32768, -32768, -17835, 14529, 32767, 32767, 10518,
+    -21560, -32768, -31348, -2566, 27920, 32767, 25595, -5721, -32768, -32768, -18552, 13980, 32767, 32767, 10454, -21799,
+    -32768, -30896, -1629, 28736, 32767, 24353, -7505, -32768, -32768, -16336, 16458, 32767, 32767, 7202, -24688, -32768,
+    -28213, 2575, 31632, 32767, 20326, -12420, -32768, -32768, -10954, 21680, 32767, 30502, 638, -29671, -32768, -22633,
+    9948, 32767, 32767, 12954, -20028, -32768, -31523, -2094, 28786, 32767, 23432, -9154, -32768, -32768, -13274, 19874,
+    32767, 31435, 1792, -29105, -32768, -22795, 10067, 32767, 32767, 11926, -21229, -32768, -30226, 266, 30581, 32767,
+    20664, -12654, -32768, -32768, -8858, 23981, 32767, 27707, -4077, -32768, -32768, -16872, 16795, 32767, 32767, 3988,
+    -27855, -32768, -23559, 9566, 32767, 32767, 11210, -22211, -32768, -28870, 2697, 32342, 32767, 17414, -16487, -32768,
+    -32768, -3544, 28358, 32767, 22553, -11008, -32768, -32768, -9008, 24276, 32767, 26669, -6000, -32768, -32768, -13631,
+    20362, 32767, 29860, -1604, -31906, -32768, -17419, 16813, 32767, 32255, 2100, -29606, -32768, -20414, 13766, 32767,
+    32767, 5081, -27586, -32768, -22678, 11310, 32767, 32767, 7335, -25967, -32768, -24278, 9500, 32767, 32767, 8872,
+    -24833, -32768, -25271, 8366, 32767, 32767, 9706, -24236, -32768, -25697, 7925, 32767, 32767, 9848, -24200, -32768,
+    -25574, 8180, 32767, 32767, 9298, -24729, -32768, -24898, 9130, 32767, 32767, 8051, -25798, -32768, -23640, 10762,
+    32767, 32767, 6092, -27361, -32768, -21751, 13050, 32767, 32767, 3410, -29337, -32768, -19168, 15946, 32767, 31602,
+    0, -31611, -32768, -15826, 19372, 32767, 28979, -4119, -32768, -32768, -11668, 23205, 32767, 25519, -8889, -32768,
+    -32768, -6666, 27265, 32767, 21100, -14197, -32768, -32318, -842, 31306, 32767, 15638, -19854, -32768, -28103, 5705,
+    32767, 32767, 9114, -25576, -32768, -22572, 12776, 32767, 32767, 1610, -30979, -32768, -15664, 20044, 32767, 27591,
+    -6654, -32768, -32768, -7450, 27043, 32767, 20515, -15294, -32768, -30993, 1819, 32767, 32767, 11747, -23738, -32768,
+    -23836, 11672, 32767, 32767, 1592, -31236, -32768, -14557, 21401, 32767, 25827, -9362, -32768, -32768, -3548, 30071,
+    32767, 15966, -20224, -32768, -26648, 8443, 32767, 32767, 4052, -29832, -32768, -16030, 20289, 32767, 26374, -8941,
+    -32768, -32768, -3109, 30548, 32767, 14755, -21590, -32768, -24980, 10843, 32767, 32767, 713, -32128, -32768, -12085,
+    24037, 32767, 22345, -14088, -32768, -30708, 3136, 32767, 32767, 7935, -27426, -32768, -18280, 18530, 32767, 27156,
+    -8382, -32768, -32768, -2246, 31399, 32767, 12590, -23879, -32768, -21952, 14840, 32767, 29743, -4935, -32768, -32768,
+    -5163, 29628, 32767, 14810, -22100, -32768, -23432, 13334, 32767, 30552, -3900, -32768, -32768, -5634, 29435, 32767,
+    14725, -22333, -32768, -22895, 14130, 32767, 29747, -5304, -32768, -32768, -3667, 30860, 32767, 12328, -24549, -32768,
+    -20275, 17168, 32767, 27164, -9109, -32768, -32727, 764, 32767, 32767, 7485, -28430, -32768, -15293, 22174, 32767,
+    22358, -15128, -32768, -28433, 7609, 32767, 32767, 71, -32768, -32768, -7621, 28496, 32767, 14775, -22828, -32768,
+    -21306, 16496, 32767, 27025, -9744, -32768, -31792, 2810, 32767, 32767, 4079, -31039, -32768, -10722, 26380, 32767,
+    16940, -21088, -32768, -22585, 15345, 32767, 27539, -9330, -32768, -31715, 3211, 32767, 32767, 2854, -31967, -32768,
+    -8726, 28089, 32767, 14283, -23707, -32768, -19426, 18948, 32767, 24074, -13937, -32768, -28166, 8790, 32767, 31663,
+    -3614, -32768, -32768, -1492, 32767, 32767, 6446, -29907, -32768, -11174, 26507, 32767, 15617, -22832, -32768, -19730,
+    18961, 32767, 23478, -14967, -32768, -26837, 10916, 32767, 29796, -6869, -32768, -32350, 2878, 32767, 32767, 1011,
+    -32768, -32768, -4760, 31266, 32767, 8340, -28906, -32768, -11726, 26413, 32767, 14901, -23828, -32768, -17853, 21189,
+    32767, 20577, -18532, -32768, -23070, 15885, 32767, 25334, -13277, -32768, -27374, 10730, 32767, 29200, -8263, -32768,
+    -30821, 5892, 32767, 32248, -3630, -32768, -32768, 1487, 32767, 32767, 530, -32768, -32768, -2415, 32767, 32767,
+    4164, -32041, -32768, -5777, 31069, 32767, 7251, -30136, -32768, -8587, 29252, 32767, 9786, -28428, -32768, -10851,
+    27674, 32767, 11782, -26997, -32768, -12582, 26404, 32767, 13254, -25900, -32768, -13798, 25490, 32767, 14218, -25177,
+    -32768, -14514, 24964, 32767, 14687, -24852, -32768, -14739, 24843, 32767, 14669, -24936, -32768, -14477, 25130, 32767,
+    14163, -25425, -32768, -13724, 25818, 32767, 13161, -26304, -32768, -12470, 26882, 32767, 11650, -27544, -32768, -10699,
+    28284, 32767, 9615, -29096, -32768, -8395, 29970, 32767, 7038, -30895, -32768, -5543, 31861, 32767, 3911, -32768,
+    -32768, -2141, 32767, 32767, 236, -32768, -32768, 1801, 32767, 32767, -3962, -32768, -31581, 6241, 32767, 30062,
+    -8628, -32768, -28344, 11108, 32767, 26415, -13665, -32768, -24267, 16281, 32767, 21893, -18931, -32768, -19289, 21588,
+    32767, 16454, -24220, -32768, -13393, 26794, 32767, 10114, -29270, -32768, -6632, 31606, 32767, 2967, -32768, -32768,
+    854, 32767, 32767, -4798, -32768, -30294, 8822, 32767, 27409, -12877, -32768, -24123, 16909, 32767, 20445, -20853,
+    -32768, -16397, 24638, 32767, 12011, -28190, -32768, -7331, 31428, 32767, 2414, -32768, -32768, 2671, 32767, 31177,
+    -7841, -32768, -27589, 13001, 32767, 23410, -18045, -32768, -18684, 22859, 32767, 13473, -27320, -32768, -7861, 31300,
+    32767, 1952, -32768, -32768, 4130, 32767, 29797, -10243, -32768, -25236, 16229, 32767, 19936, -21916, -32768, -13997,
+    27124, 32767, 7553, -31673, -32768, -767, 32767, 32553, -6170, -32768, -27973, 13045, 32767, 22419, -19625, -32768,
+    -16024, 25667, 32767, 8968, -30926, -32768, -1472, 32767, 32675, -6206, -32768, -27592, 13777, 32767, 21355, -20933,
+    -32768, -14162, 27357, 32767, 6267, -32740, -32768, 2020, 32767, 30217, -10346, -32768, -23984, 18330, 32767, 16546,
+    -25574, -32768, -8206, 31692, 32767, -659, -32768, -30834, 9619, 32767, 24259, -18204, -32768, -16303, 25933, 32767,
+    7347, -32339, -32768, 2144, 32767, 29594, -11639, -32768, -22223, 20570, 32767, 13414, -28366, -32768, -3660, 32767,
+    32767, -6451, -32768, -26205, 16269, 32767, 17588, -25121, -32768, -7670, 32359, 32767, -2903, -32768, -28573, 13397,
+    32767, 20035, -23034, -32768, -9908, 31059, 32767, -1091, -32768, -29599, 12131, 32767, 20908, -22329, -32768, -10427,
+    30821, 32767, -1034, -32768, -29422, 12533, 32767, 20272, -23072, -32768, -9242, 31683, 32767, -2734, -32768, -28016,
+    14585, 32767, 18078, -25193, -32768, -6320, 32767, 32767, -6170, -32768, -25197, 18176, 32767, 14184, -28464, -32768,
+    -1608, 32767, 30593, -11259, -32768, -20670, 23050, 32767, 8419, -32448, -32768, 4876, 32767, 25780, -17748, -32768,
+    -14115, 28708, 32767, 707, -32768, -29636, 12907, 32767, 18684, -25091, -32768, -5357, 32767, 32426, -8754, -32768,
+    -22191, 21883, 32767, 9030, -32311, -32768, 5422, 32767, 24744, -19279, -32768, -11738, 30654, 32767, -2979, -32768,
+    -26452, 17406, 32767, 13518, -29494, -32768, 1455, 32767, 27409, -16338, -32768, -14404, 28928, 32767, -858, -32768,
+    -27674, 16111, 32767, 14418, -28997, -32768, 1191, 32767, 27263, -16733, -32768, -13562, 29697, 32767, -2453, -32768,
+    -26150, 18183, 32767, 11813, -30974, -32768, 4637, 32767, 24267, -20408, -32768, -9137, 32721, 32767, -7721, -32768,
+    -21518, 23314, 32767, 5497, -32768, -31245, 11651, 32767, 17789, -26742, -32768, -880, 32767, 27983, -16315, -32768,
+    -12980, 30458, 32767, -4673, -32768, -23563, 21516, 32767, 7038, -32768, -31830, 11032, 32767, 17821, -26942, -32768,
+    0, 32767, 26899, -17938, -32768, -10683, 32144, 32767, -7951, -32768, -20277, 24960, 32767, 2227, -32768, -28239,
+    16438, 32767, 11914, -31480, -32768, 7248, 32767, 20569, -24843, -32768, -2000, 32767, 27807, -17158, -32768, -10790,
+    32301, 32767, -8950, -32768, -18726, 26607, 32767, -683, -32768, -25528, 20034, 32767, 7257, -32768, -31033, 12981,
+    32767, 14572, -29965, -32768, 5801, 32767, 21052, -24752, -32768, -1215, 32767, 26571, -19063, -32768, -7837, 32767,
+    31075, -13165, -32768, -13901, 30605, 32767, -7283, -32768, -19303, 26507, 32767, -1595, -32768, -23990, 22142, 32767,
+    3764, -32768, -27951, 17684, 32767, 8702, -32768, -31211, 13277, 32767, 13161, -31315, -32768, 9035, 32767, 17116,
+    -28532, -32768, 5042, 32767, 20564, -25714, -32768, 1361, 32767, 23523, -22957, -32768, -1969, 32767, 26023, -20341,
+    -32768, -4925, 32767, 28100, -17927, -32768, -7498, 32767, 29796, -15763, -32768, -9686, 32767, 31153, -13884, -32768,
+    -11497, 32694, 32210, -12315, -32768, -12939, 31842, 32767, -11075, -32768, -14024, 31178, 32767, -10175, -32768, -14759,
+    30724, 32767, -9622, -32768, -15153, 30497, 32767, -9421, -32768, -15211, 30504, 32767, -9573, -32768, -14931, 30745,
+    32767, -10076, -32768, -14313, 31211, 32767, -10928, -32768, -13348, 31888, 32669, -12121, -32768, -12029, 32750, 31759,
+    -13644, -32768, -10345, 32767, 30569, -15481, -32768, -8286, 32767, 29061, -17607, -32768, -5844, 32767, 27195, -19988,
+    -32768, -3018, 32767, 24929, -22579, -32768, 186, 32767, 22223, -25321, -32768, 3751, 32767, 19042, -28136, -32768,
+    7643, 32767, 15362, -30930, -32768, 11809, 32767, 11174, -32768, -30430, 16172, 32767, 6490, -32768, -26992, 20627,
+    32767, 1350, -32768, -22844, 25042, 32767, -4175, -32768, -17969, 29252, 32767, -9971, -32768, -12388, 32767, 30836,
+    -15886, -32768, -6167, 32767, 26271, -21718, -32768, 576, 32767, 20692, -27224, -32768, 7659, 32767, 14159, -32120,
+    -31698, 14837, 32767, 6800, -32768, -26382, 21801, 32767, -1169, -32768, -19755, 28186, 32767, -9444, -32768, -11965,
+    32767, 29904, -17635, -32768, -3273, 32767, 23207, -25272, -32768, 5939, 32767, 15000, -31830, -31735, 15172, 32767,
+    5611, -32768, -24810, 23827, 32767, -4470, -32768, -16043, 31241, 32206, -14606, -32768, -5869, 32767, 24741, -24038,
+    -32768, 5077, 32767, 15160, -31936, -31413, 15976, 32767, 4052, -32768, -22992, 25877, 32767, -7744, -32768, -12294,
+    32767, 29197, -19185, -32768, -135, 32767, 19371, -29101, -32768, 12383, 32767, 7311, -32768, -25179, 23950, 32767,
+    -5860, -32768, -13581, 32767, 29743, -18717, -32768, -115, 32767, 18869, -29677, -32768, 13706, 32767, 5383, -32768,
+    -23185, 26117, 32767, -9132, -32768, -9869, 32767, 26600, -22742, -32768, 5136, 32767, 13558, -32768, -29216, 19732,
+    32767, -1797, -32768, -16475, 31631, 31147, -17211, -32768, -842, 32767, 18664, -30149, -32499, 15263, 32767, 2768,
+    -32768, -20171, 29058, 32767, -13942, -32768, -3979, 32767, 21039, -28425, -32768, 13277, 32767, 4481, -32768, -21294,
+    28284, 32767, -13281, -32768, -4274, 32767, 20945, -28645, -32768, 13955, 32767, 3358, -32768, -19980, 29486, 32767,
+    -15284, -32768, -1730, 32767, 18369, -30760, -31569, 17239, 32767, -614, -32768, -16071, 32385, 29807, -19767, -32768,
+    3664, 32767, 13036, -32768, -27389, 22783, 32767, -7394, -32768, -9224, 32767, 24203, -26161, -32768, 11741, 32767,
+    4614, -32768, -20142, 29722, 32263, -16592, -32768, 771, 32767, 15123, -32768, -28506, 21764, 32767, -6844, -32768,
+    -9118, 32767, 23579, -26992, -32768, 13431, 32767, 2175, -32768, -17390, 31918, 29884, -20245, -32768, 5540, 32767,
+    9948, -32768, -23893, 26876, 32767, -13720, -32768, -1403, 32767, 16268, -32768, -28725, 21890, 32767, -7906, -32768,
+    -7149, 32767, 21142, -29404, -32128, 17428, 32767, -3086, -32768, -11625, 32767, 24700, -26389, -32768, 13789, 32767,
+    603, -32768, -14861, 32767, 27113, -24031, -32768, 11152, 32767, 3115, -32768, -16929, 32648, 28543, -22518, -32768,
+    9606, 32767, 4448, -32768, -17899, 32092, 29109, -21949, -32768, 9195, 32767, 4608, -32768, -17809, 32230, 28860,
+    -22358, -32768, 9927, 32767, 3599, -32768, -16657, 32767, 27773, -23723, -32768, 11785, 32767, 1411, -32768, -14396,
+    32767, 25757, -25952, -32768, 14716, 32767, -1957, -32768, -10954, 32767, 22662, -28877, -31963, 18608, 32767, -6475,
+    -32768, -6263, 32767, 18314, -32222, -28484, 23255, 32767, -12038, -32768, -304, 32767, 12561, -32768, -23559, 28312,
+    32272, -18406, -32768, 6824, 32767, 5338, -32768, -16953, 32767, 26973, -25155, -32768, 14833, 32767, -3242, -32768,
+    -8579, 32767, 19596, -31615, -28871, 23169, 32767, -12794, -32768, 1392, 32767, 10070, -32768, -20645, 30959, 29483,
+    -22566, -32768, 12400, 32767, -1297, -32768, -9852, 32767, 20177, -31400, -28892, 23404, 32767, -13670, -32768, 2958,
+    32767, 7920, -32768, -18157, 32767, 27018, -25602, -32768, 16541, 32767, -6354, -32768, -4224, 32767, 14452, -32768,
+    -23633, 28917, 31160, -20832, -32768, 11400, 32767, -1267, -32768, -8893, 32767, 18423, -32768, -26723, 26171, 32767,
+    -17845, -32768, 8460, 32767, 1391, -32768, -11102, 32767, 20091, -31888, -27838, 25146, 32767, -16982, -32768, 7891,
+    32767, 1595, -32768, -10934, 32767, 19611, -32330, -27163, 26007, 32767, -18325, -32768, 9719, 32767, -657, -32768,
+    -8382, 32767, 16937, -32768, -24583, 28615, 30958, -21743, -32768, 13854, 32767, -5349, -32768, -3355, 32767, 11845,
+    -32768, -19730, 32488, 26662, -26820, -32346, 19991, 32767, -12325, -32768, 4175, 32767, 4099, -32768, -12142, 32767,
+    19622, -32687, -26242, 27393, 31750, -21033, -32768, 13884, 32767, -6243, -32768, -1584, 32767, 9293, -32768, -16597,
+    32767, 23235, -30197, -28980, 24707, 32767, -18381, -32768, 11461, 32767, -4200, -32768, -3148, 32767, 10333, -32768,
+    -17122, 32767, 23304, -30303, -28697, 25220, 32767, -19395, -32768, 13026, 32767, -6319, -32768, -519, 32767, 7284,
+    -32768, -13785, 32767, 19843, -32768, -25303, 28793, 30031, -23886, -32768, 18392, 32767, -12471, -32768, 6286, 32767,
+    0, -32768, -6229, 32767, 12250, -32768, -17926, 32767, 23134, -30795, -27766, 26640, 31735, -21937, -32768, 16804,
+    32767, -11366, -32768, 5744, 32767, -62, -32768, -5564, 32767, 11023, -32768, -16214, 32767, 21048, -32510, -25443,
+    29090, 29334, -25189, -32667, 20892, 32767, -16286, -32768, 11461, 32767, -6503, -32768, 1498, 32767, 3473, -32768,
+    -8333, 32767, 13012, -32768, -17448, 32767, 21583, -32352, -25371, 29401, 28770, -26097, -31750, 22496, 32767, -18657,
+    -32768, 14638, 32767, -10497, -32768, 6288, 32767, -2064, -32768, -2125, 32767, 6233, -32768, -10219, 32767, 14044,
+    -32768, -17676, 32767, 21085, -32768, -24248, 30626, 27144, -28079, -29759, 25330, 32082, -22413, -32768, 19362, 32767,
+    -16208, -32768, 12984, 32767, -9719, -32768, 6441, 32767, -3176, -32768, -53, 32767, 3223, -32768, -6316, 32767,
+    9313, -32768, -12201, 32767, 14967, -32768, -17600, 32767, 20091, -32768, -22433, 32334, 24623, -30686, -26656, 28939,
+    28532, -27111, -30250, 25217, 31811, -23271, -32768, 21288, 32767, -19279, -32768, 17258, 32767, -15234, -32768, 13219,
+    32767, -11221, -32768, 9249, 32767, -7309, -32768, 5410, 32767, -3556, -32768, 1752, 32767, -3, -32768, -1689,
+    32767, 3319, -32768, -4886, 32767, 6388, -32768, -7824, 32767, 9193, -32768, -10495, 32767, 11729, -32768, -12896,
+    32767, 13997, -32768, -15032, 32767, 16002, -32768, -16908, 32767, 17752, -32768, -18534, 32767, 19257, -32768, -19921,
+    32767, 20528, -32768, -21080, 32767, 21577, -32768, -22020, 32767, 22412, -32768, -22753, 32767, 23044, -32605, -23286,
+    32449, 23480, -32326, -23626, 32237, 23725, -32181, -23777, 32160, 23782, -32174, -23740, 32222, 23651, -32304, -23516,
+    32420, 23332, -32569, -23101, 32749, 22820, -32768, -22490, 32767, 22110, -32768, -21677, 32767, 21192, -32768, -20652,
+    32767, 20057, -32768, -19405, 32767, 18695, -32768, -17926, 32767, 17096, -32768, -16203, 32767, 15247, -32768, -14226,
+    32767, 13140, -32768, -11987, 32767, 10767, -32768, -9480, 32767, 8126, -32768, -6704, 32767, 5216, -32768, -3663,
+    32767, 2046, -32768, -368, 32767, -1369, -32768, 3161, 32767, -5005, -32768, 6895, 32767, -8826, -32768, 10792,
+    32767, -12785, -32768, 14797, 32767, -16820, -32768, 18843, 32767, -20855, -32768, 22845, 32128, -24800, -30601, 26707,
+    28917, -28550, -27075, 30316, 25076, -31987, -22920, 32767, 20610, -32768, -18151, 32767, 15548, -32768, -12810, 32767,
+    9948, -32768, -6972, 32767, 3899, -32768, -744, 32767, -2474, -32768, 5733, 32767, -9011, -32768, 12281, 32767,
+    -15516, -32768, 18687, 32767, -21764, -32545, 24713, 30287, -27501, -27734, 30094, 24897, -32458, -21790, 32767, 18433,
+    -32768, -14847, 32767, 11061, -32768, -7107, 32767, 3021, -32768, 1154, 32767, -5374, -32768, 9591, 32767, -13751,
+    -32768, 17801, 32767, -21684, -32337, 25341, 29451, -28715, -26140, 31747, 22433, -32768, -18369, 32767, 13994, -32768,
+    -9362, 32767, 4535, -32768, 418, 32767, -5422, -32768, 10397, 32767, -15259, -32768, 19919, 32767, -24290, -30103,
+    28284, 26329, -31815, -22037, 32767, 17293, -32768, -12171, 32767, 6762, -32768, -1163, 32767, -4517, -32768, 10161,
+    32767, -15650, -32768, 20859, 32499, -25666, -28683, 29949, 24187, -32768, -19096, 32767, 13511, -32768, -7553, 32767,
+    1357, -32768, 4930, 32767, -11151, -32768, 17143, 32767, -22742, -30946, 27790, 26392, -32132, -21080, 32767, 15138,
+    -32768, -8719, 32767, 1995, -32768, 4844, 32767, -11597, -32768, 18057, 32767, -24016, -29743, 29276, 24543, -32768,
+    -18517, 32767, 11842, -32768, -4723, 32767, -2610, -32768, 9911, 32767, -16927, -32768, 23402, 30086, -29093, -24560,
+    32767, 18097, -32768, -10916, 32767, 3270, -32768, 4556, 32767, -12263, -32768, 19544, 32767, -26099, -27534, 31645,
+    21135, -32768, -13817, 32767, 5869, -32768, 2384, 32767, -10591, -32768, 18392, 32767, -25432, -28006, 31376, 21321,
+    -32768, -13614, 32767, 5223, -32768, 3470, 32767, -12053, -32768, 20110, 32139, -27235, -26080, 32767, 18680, -32768,
+    -10288, 32767, 1315, -32768, 7782, 32767, -16527, -32768, 24447, 28608, -31098, -21354, 32767, 12883, -32768, -3644,
+    32767, -5855, -32768, 15077, 32767, -23486, -29306, 30573, 21887, -32768, -13125, 32767, 3523, -32768, 6348, 32767,
+    -15886, -32768, 24490, 28305, -31600, -20341, 32767, 11029, -32768, -951, 32767, -9246, -32768, 18886, 32520, -27314,
+    -25419, 32767, 16549, -32768, -6490, 32767, -4075, -32768, 14409, 32767, -23773, -28690, 31477, 20213, -32768, -10214,
+    32767, -592, -32768, 11409, 32767, -21422, -30499, 29853, 22223, -32768, -12184, 32767, 1140, -32768, 10049, 32767,
+    -20491, -31094, 29333, 22730, -32768, -12463, 32767, 1114, -32768, 10383, 32767, -21060, -30569, 29994, 21779, -32768,
+    -11063, 32767, -670, -32768, 12400, 32767, -23080, -28840, 31737, 19289, -32768, -7934, 32767, -4205, -32768, 16008,
+    32767, -26364, -25668, 32767, 15084, -32768, -3003, 32767, -9423, -32768, 20984, 30335, -30524, -20710, 32767, 8970,
+    -32768, 3728, 32767, -16101, -32768, 26874, 24913, -32768, -13632, 32767, 869, -32768, 12041, 32767, -23717, -27876,
+    32767, 17036, -32768, -4287, 32767, -8989, -32768, 21320, 29796, -31310, -19272, 32767, 6515, -32768, 7042, 32767,
+    -19840, -30836, 30378, 20430, -32768, -7570, 32767, -6243, -32768, 19362, 31100, -30190, -20564, 32767, 7467, -32768,
+    6605, 32767, -19909, -30618, 30766, 19682, -32768, -6204, 32767, -8122, -32768, 21454, 29337, -32045, -17741, 32767,
+    3764, -32768, 10765, 32767, -23909, -27134, 32767, 14657, -32768, -134, 32767, -14461, -32768, 27108, 23832, -32768,
+    -10337, 32767, -4668, -32768, 19063, 30921, -30779, -19233, 32767, 4716, -32768, 10542, 32767, -24304, -26497, 32767,
+    13170, -32768, 2177, 32767, -17250, -32033, 29752, 20396, -32768, -5582, 32767, -10148, -32768, 24349, 26279, -32768,
+    -12456, 32767, -3393, -32768, 18753, 30849, -31145, -18313, 32767, 2752, -32768, 13312, 32767, -27232, -23130, 32767,
+    8136, -32768, 8275, 32767, -23341, -26967, 32767, 12697, -32768, 3806, 32767, -19703, -29927, 32214, 16434, -32768,
+    0, 32767, -16487, -32136, 30081, 19386, -32768, -3097, 32767, -13807, -32768, 28239, 21610, -32768, -5470, 32767,
+    -11738, -32768, 26802, 23167, -32768, -7125, 32767, -10322, -32768, 25847, 24109, -32768, -8071, 32767, -9586, -32768,
+    25419, 24471, -32768, -8318, 32767, -9539, -32768, 25539, 24267, -32768, -7868, 32767, -10182, -32768, 26200, 23490,
+    -32768, -6715, 32767, -11506, -32768, 27372, 22110, -32768, -4851, 32767, -13488, -32768, 28997, 20078, -32768, -2266,
+    32767, -16088, -31849, 30982, 17335, -32768, 1041, 32767, -19237, -29536, 32767, 13822, -32768, 5047, 32767, -22826,
+    -26452, 32767, 9493, -32768, 9695, 32767, -26695, -22475, 32767, 4335, -32768, 14870, 32410, -30621, -17504, 32767,
+    -1608, -32768, 20387, 28362, -32768, -11492, 32767, -8214, -32768, 25967, 23043, -32768, -4474, 32767, -15253, -32002,
+    31233, 16379, -32768, 3398, 32767, -22368, -26454, 32767, 8419, -32768, 11819, 32767, -29066, -19180, 32767, -623,
+    -32768, 20314, 28103, -32768, -10273, 32767, -10322, -32768, 28222, 20082, -32768, -63, 32767, -20022, -28219, 32767,
+    10094, -32768, 10837, 32767, -28841, -19160, 32767, -1342, -32768, 21521, 26820, -32768, -7874, 32767, -13340, -32768,
+    30821, 16339, -32768, 4829, 32767, -24660, -23706, 32767, 3552, -32768, 17686, 29754, -32768, -11428, 32767, -10313,
+    -32768, 29047, 18525, -32768, 2903, 32767, -23510, -24657, 32767, 4248, -32768, 17501, 29726, -32768, -10914, 32767,
+    -11304, -32768, 30073, 16938, -32768, 5156, 32767, -25684, -22223, 32767, 756, -32768, 20999, 26728, -32768, -6294,
+    32767, -16209, -30454, 32767, 11362, -32768, 11471, 32767, -30603, -15905, 32767, -6908, -32768, 27484, 19902, -32768,
+    2612, 32767, -24300, -23357, 32767, 1351, -32768, 21160, 26292, -32768, -4941, 32767, -18151, -28745, 32767, 8135,
+    -32768, 15343, 30762, -32768, -10927, 32767, -12788, -32391, 32040, 13321, -32768, 10524, 32767, -30661, -15327, 32767,
+    -8579, -32768, 29435, 16961, -32768, 6969, 32767, -28402, -18238, 32767, -5708, -32768, 27594, 19174, -32768, 4802,
+    32767, -27033, -19782, 32767, -4255, -32768, 26732, 20071, -32768, 4069, 32767, -26701, -20044, 32767, -4243, -32768,
+    26939, 19703, -32768, 4779, 32767, -27441, -19041, 32767, -5673, -32768, 28194, 18048, -32768, 6923, 32767, -29177,
+    -16712, 32767, -8521, -32768, 30361, 15017, -32768, 10456, 32767, -31709, -12947, 32767, -12710, -31834, 32767, 10487,
+    -32768, 15256, 30068, -32768, -7628, 32767, -18057, -27897, 32767, 4367, -32768, 21060, 25271, -32768, -712, 32767,
+    -24197, -22149, 32767, -3310, -32768, 27381, 18497, -32768, 7656, 32767, -30504, -14298, 32767, -12255, -31833, 32767,
+    9558, -32768, 17012, 28433, -32768, -4309, 32767, -21796, -24267, 32767, -1380, -32768, 26445, 19317, -32768, 7397,
+    32767, -30765, -13605, 32767, -13588, -30749, 32767, 7201, -32768, 19745, 25932, -32768, -236, 32767, -25616, -20041,
+    32767, -7095, -32768, 30902, 13156, -32768, 14524, 29927, -32768, -5439, 32767, -21718, -23924, 32767, -2854, -32768,
+    28284, 16597, -32768, 11373, 31917, -32768, -8163, 32767, -19676, -25648, 32767, -1036, -32768, 27246, 17729, -32768,
+    10531, 32327, -32768, -8466, 32767, -19736, -25450, 32767, -1671, -32768, 27979, 16644, -32768, 12046, 31254, -32768,
+    -6357, 32767, -21891, -23300, 32767, -4751, -32768, 30349, 13254, -32768, 15826, 28449, -32768, -1781, 32767, -25878,
+    -18917, 32767, -10195, -32241, 32767, 7354, -32768, 21553, 23379, -32768, 5260, 32767, -31069, -11897, 32767, -17677,
+    -26753, 32767, -1172, -32768, 28490, 15424, -32768, 14454, 29185, -32768, -2000, 32767, -26351, -17989, 32767, -12009,
+    -30821, 32767, 4236, -32768, 24806, 19660, -32768, 10413, 31783, -32768, -5539, 32767, -23949, -20495, 32767, -9705,
+    -32153, 32767, 5918, -32768, 23828, 20524, -32768, 9897, 31965, -32768, -5377, 32767, -24449, -19751, 32767, -10985,
+    -31201, 32767, 3911, -32768, 25779, 18143, -32768, 12949, 29796, -32768, -1510, 32767, -27739, -15647, 32767, -15737,
+    -27637, 32767, -1825, -32768, 30197, 12194, -32768, 19257, 24586, -32768, 6069, 32767, -32768, -7727, 32767, -23354,
+    -20491, 32767, -11139, -30779, 32767, 2230, -32768, 27785, 15226, -32768, 16870, 26434, -32768, 4236, 32767, -32198,
+    -8726, 32767, -22973, -20656, 32767, -11484, -30369, 32767, 1043, -32768, 29010, 13343, -32768, 19162, 24234, -32768,
+    7594, 32729, -32768, -4562, 32767, -26710, -16176, 32767, -16724, -26227, 32767, -5374, -32768, 32767, 6316, -32768,
+    25613, 17348, -32768, 15836, 26834, -32768, 4886, 32767, -32768, -6328, 32767, -25848, -16926, 32767, -16556, -26125,
+    32767, -6140, -32768, 32767, 4599, -32768, 27389, 14885, -32768, 18837, 24019, -32768, 9109, 31423, -32768, -1105,
+    32767, -30047, -11120, 32767, -22517, -20308, 32767, -13689, -28133, 32767, -4150, -32768, 32767, 5509, -32768, 27249,
+    14725, -32768, 19625, 22998, -32768, 11032, 29914, -32768, 1972, 32767, -32418, -7063, 32767, -26384, -15617, 32767,
+    -19138, -23286, 32767, -11084, -29743, 32767, -2635, -32768, 32767, 5806, -32768, 27623, 13865, -32768, 21117, 21214,
+    -32768, 13840, 27580, -32768, 6124, 32752, -32768, -1704, 32767, -30715, -9340, 32767, -25296, -16510, 32767, -19072,
+    -22980, 32767, -12305, -28561, 32767, -5250, -32768, 32767, 1847, -32768, 30939, 8757, -32768, 26132, 15280, -32768,
+    20664, 21246, -32768, 14727, 26516, -32768, 8515, 30985, -32768, 2208, 32767, -32768, -4024, 32767, -29899, -10032,
+    32767, -25575, -15686, 32767, -20785, -20879, 32767, -15665, -25526, 32767, -10346, -29564, 32767, -4954, -32768, 32767,
+    402, -32768, 32525, 5621, -32768, 29266, 10618, -32768, 25623, 15321, -32768, 21687, 19674, -32768, 17545, 23632,
+    -32768, 13278, 27168, -32768, 8962, 30261, -32768, 4662, 32767, -32768, 437, 32767, -32768, -3662, 32767, -31056,
+    -7594, 32767, -28464, -11326, 32767, -25704, -14832, 32767, -22825, -18094, 32767, -19872, -21100, 32767, -16887, -23845,
+    32767, -13905, -26327, 32767, -10957, -28550, 32767, -8072, -30522, 32767, -5273, -32254, 32767, -2577, -32768, 32767,
+    0, -32768, 32767, 2446, -32768, 32467, 4754, -32768, 31115, 6916, -32768, 29753, 8931, -32768, 28402, 10796,
+    -32768, 27079, 12512, -32768, 25798, 14081, -32768, 24574, 15504, -32768, 23418, 16787, -32768, 22340, 17932, -32768,
+    21348, 18944, -32768, 20450, 19827, -32768, 19652, 20585, -32768, 18959, 21222, -32768, 18375, 21743, -32768, 17903,
+    22150, -32768, 17545, 22445, -32768, 17303, 22631, -32768, 17179, 22708, -32768, 17173, 22678, -32768, 17284, 22540,
+    -32768, 17514, 22293, -32768, 17859, 21935, -32768, 18320, 21465, -32768, 18893, 20879, -32768, 19574, 20174, -32768,
+    20362, 19346, -32768, 21249, 18392, -32768, 22231, 17306, -32768, 23301, 16084, -32768, 24449, 14723, -32768, 25667,
+    13218, -32768, 26942, 11567, -32768, 28262, 9767, -32768, 29611, 7818, -32768, 30972, 5720, -32768, 32326, 3476,
+    -32768, 32767, 1089, -32768, 32767, -1432, -32768, 32767, -4077, -31879, 32767, -6833, -30094, 32767, -9683, -28065,
+    32767, -12606, -25783, 32767, -15577, -23242, 32767, -18565, -20437, 32767, -21537, -17372, 32767, -24454, -14053, 32767,
+    -27272, -10493, 32767, -29944, -6713, 32767, -32418, -2739, 32767, -32768, 1392, 32767, -32768, 5639, 30560, -32768,
+    9948, 27514, -32768, 14259, 24024, -32768, 18504, 20109, -32768, 22606, 15796, -32768, 26483, 11127, -32768, 30047,
+    6158, -32768, 32767, 959, -32768, 32767, -4387, -31132, 32767, -9781, -27374, 32767, -15113, -22988, 32767, -20260,
+    -18025, 32767, -25091, -12561, 32767, -29470, -6694, 32767, -32768, -542, 32767, -32768, 5751, 30040, -32768, 12027,
+    25381, -32768, 18107, 19942, -32768, 23805, 13835, -32768, 28925, 7207, -32768, 32767, 236, -32768, 32767, -6872,
+    -29090, 32767, -13884, -23611, 32767, -20550, -17226, 32767, -26612, -10120, 32767, -31813, -2521, 32767, -32768, 5301,
+    30004, -32768, 13044, 24140, -32768, 20383, 17192, -32768, 26985, 9407, -32768, 32526, 1090, -32768, 32767, -7404,
+    -28391, 32767, -15682, -21632, 32767, -23333, -13729, 32767, -29946, -5028, 32767, -32768, 4055, 30549, -32768, 13053,
+    23795, -32768, 21468, 15647, -32768, 28803, 6508, -32768, 32767, -3130, -31021, 32767, -12710, -23934, 32767, -21640,
+    -15284, 32767, -29333, -5559, 32767, -32768, 4649, 29910, -32768, 14676, 22068, -32768, 23828, 12615, -32768, 31429,
+    2160, -32768, 32767, -8575, -26983, 32767, -18804, -17971, 32767, -27731, -7485, 32767, -32768, 3704, 30316, -32768,
+    14725, 21744, -32768, 24667, 11289, -32768, 32659, -230, -32383, 32767, -11855, -24118, 32767, -22563, -13629, 32767,
+    -31358, -1795, 32767, -32768, 10327, 25255, -32768, 21601, 14573, -32768, 30907, 2368, -32768, 32767, -10195, -25248,
+    32767, -21851, -14159, 32767, -31368, -1489, 32767, -32768, 11461, 24099, -32768, 23297, 12370, -32768, 32678, -843,
+    -31668, 32767, -14084, -21711, 32767, -25824, -9144, 32767, -32768, 4618, 29117, -32768, 17949, 17922, -32768, 29198,
+    4414, -32768, 32767, -9767, -25174, 32767, -22823, -12548, 32767, -32768, 1832, 30805, -32768, 16090, 19519, -32768,
+    28284, 5473, -32768, 32767, -9451, -25235, 32767, -23163, -11918, 32767, -32768, 3232, 29726, -32768, 18029, 17399,
+    -32768, 30249, 2357, -32768, 32767, -13164, -21910, 32767, -26762, -7201, 32767, -32768, 8766, 25510, -32768, 23441,
+    11256, -32768, 32767, -4960, -28291, 32767, -20468, -14528, 32767, -32612, 1819, 30364, -32768, 17971, 17050, -32768,
+    31075, 621, -31833, 32767, -16039, -18867, 32767, -29891, -2349, 32767, -32768, 14724, 20023, -32768, 29136, 3363,
+    -32768, 32767, -14060, -20548, 32767, -28856, -3667, 32767, -32768, 14061, 20461, -32768, 29066, 3261, -32768, 32767,
+    -14725, -19757, 32767, -29756, -2145, 32438, -32768, 16039, 18417, -32768, 30883, 315, -31270, 32767, -17973, -16402,
+    32767, -32376, 2227, 29554, -32768, 20469, 13670, -32768, 32767, -5466, -27191, 32767, -23443, -10176, 32767, -32768,
+    9362, 24071, -32768, 26764, 5894, -32768, 32767, -13837, -20091, 32767, -30251, -830, 31302, -32768, 18754, 15167,
+    -32768, 32767, -4955, -27302, 32767, -23906, -9267, 32767, -32768, 11320, 22120, -32768, 28997, 2434, -32120, 32767,
+    -18025, -15683, 32767, -32768, 5178, 26944, -32768, 24708, 8025, -32768, 32767, -13277, -20153, 32767, -30879, 667,
+    30004, -32768, 21405, 11789, -32768, 32767, -10018, -22889, 32767, -28937, -2100, 31664, -32768, 19437, 13806, -32768,
+    32767, -8414, -24094, 32767, -28117, -3108, 32176, -32768, 18972, 14153, -32768, 32767, -8520, -23879, 32767, -28533,
+    -2361, 31629, -32768, 20044, 12847, -32768, 32767, -10334, -22223, 32767, -30127, 144, 29927, -32768, 22570, 9831,
+    -32768, 32767, -13789, -18981, 32767, -32664, 4400, 26815, -32768, 26319, 5016, -32768, 32767, -18703, -13935, 32767,
+    -32768, 10313, 21926, -32768, 30847, -1633, -28657, 32767, -24685, -6898, 32767, -32768, 17589, 14898, -32768, 32767,
+    -9948, -22060, 32767, -31021, 2126, 28156, -32768, 25578, 5549, -32768, 32767, -19380, -12799, 32767, -32768, 12720,
+    19402, -32768, 32767, -5869, -25193, 32767, -28811, -932, 30063, -32768, 23824, 7477, -32768, 32767, -18387, -13602,
+    32767, -32768, 12699, 19180, -32768, 32767, -6937, -24124, 32767, -30103, 1254, 28382, -32768, 26175, 4223, -31934,
+    32767, -21941, -9395, 32767, -32768, 17529, 14188, -32768, 32767, -13056, -18552, 32767, -32768, 8618, 22459, -32768,
+    31821, -4297, -25898, 32767, -29101, 156, 28875, -32768, 26235, 3754, -31406, 32767, -23300, -7400, 32767, -32768,
+    20362, 10760, -32768, 32767, -17476, -13822, 32767, -32768, 14690, 16583, -32768, 32767, -12041, -19047, 32767, -32768,
+    9558, 21225, -32768, 32767, -7264, -23129, 32767, -32012, 5175, 24775, -32768, 30812, -3304, -26181, 32767, -29696,
+    1658, 27363, -32768, 28687, -242, -28338, 32767, -27808, -942, 29121, -32768, 27073, 1894, -29727, 32767, -26496,
+    -2612, 30165, -32768, 26085, 3098, -30445, 32767, -25847, -3351, 30572, -32768, 25786, 3373, -30549, 32767, -25902,
+    -3163, 30375, -32768, 26194, 2722, -30046, 32767, -26658, -2047, 29557, -32768, 27285, 1140, -28898, 32767, -28066,
+    0, 28056, -32768, 28988, -1373, -27018, 32767, -30032, 2975, 25769, -32768, 31178, -4804, -24290, 32767, -32398,
+    6852, 22566, -32768, 32767, -9109, -20578, 32767, -32768, 11557, 18313, -32768, 32767, -14177, -15757, 32767, -32768,
+    16940, 12902, -32768, 32767, -19810, -9747, 32767, -32768, 22742, 6297, -31837, 32767, -25683, -2566, 29387, -32768,
+    28567, -1421, -26497, 32767, -31321, 5623, 23146, -32768, 32767, -9988, -19327, 32767, -32768, 14447, 15048, -32768,
+    32767, -18912, -10333, 32767, -32768, 23282, 5228, -30906, 32767, -27435, 199, 27134, -32768, 31238, -5851, -22659,
+    32767, -32768, 11609, 17511, -32768, 32767, -17324, -11752, 32767, -32768, 22823, 5481, -30875, 32767, -27911, 1163,
+    26188, -32768, 32378, -8003, -20564, 32767, -32768, 14822, 14104, -32768, 32767, -21369, -6961, 31655, -32768, 27364,
+    -653, -26386, 32767, -32513, 8471, 19939, -32768, 32767, -16174, -12488, 32767, -32768, 23402, 4287, -29768, 32767,
+    -29771, 4334, 23304, -32768, 32767, -12974, -15530, 32767, -32768, 21176, 6756, -31257, 32767, -28450, 2603, 24545,
+    -32768, 32767, -12041, -16258, 32767, -32768, 20984, 6793, -31162, 32767, -28819, 3319, 23823, -32768, 32767, -13438,
+    -14725, 32767, -32768, 22848, 4399, -29463, 32767, -30807, 6468, 21041, -32768, 32767, -17068, -10825, 32767, -32768,
+    26528, -466, -25812, 32767, -32768, 11941, 15888, -32768, 32767, -22601, -4379, 29232, -32768, 31422, -7746, -19648,
+    32767, -32768, 19362, 8011, -31535, 32767, -29286, 4631, 22223, -32768, 32767, -17019, -10443, 32767, -32768, 27810,
+    -2662, -23734, 32767, -32768, 15693, 11714, -32768, 32767, -27134, 1863, 24269, -32768, 32767, -15437, -11854, 32767,
+    -32768, 27314, -2240, -23864, 32767, -32768, 16263, 10866, -32768, 32767, -28336, 3789, 22491, -32768, 32767, -18138,
+    -8726, 31582, -32768, 30110, -6496, -20069, 32767, -32768, 20975, 5395, -29306, 32767, -32458, 10315, 16480, -32768,
+    32767, -24611, -851, 25919, -32768, 32767, -15131, -11601, 32767, -32768, 28776, -4876, -21186, 32767, -32768, 20718,
+    5362, -29055, 32767, -32768, 11632, 14912, -32768, 32767, -26687, 2190, 23258, -32768, 32767, -19085, -7022, 30049,
+    -32768, 32439, -10801, -15525, 32767, -32768, 26648, -2340, -22969, 32767, -32768, 19927, 5869, -29127, 32767, -32768,
+    12695, 13489, -32768, 32767, -28666, 5324, 20277, -32768, 32767, -23137, -1874, 26079, -32768, 32767, -17171, -8657,
+    30821, -32768, 32304, -11041, -14850, 32767, -32768, 28225, -4976, -20342, 32767, -32768, 23747, 846, -25075, 32767,
+    -32768, 19072, 6291, -29041, 32767, -32768, 14372, 11270, -32264, 32767, -31302, 9783, 15733, -32768, 32767, -28289,
+    5412, 19659, -32768, 32767, -25198, 1337, 23054, -32768, 32767, -22137, -2389, 25940, -32768, 32767, -19196, -5735,
+    28355, -32768, 32767, -16446, -8686, 30343, -32768, 32767, -13939, -11240, 31951, -32768, 32222, -11716, -13404, 32767,
+    -32768, 30961, -9805, -15189, 32767, -32768, 29861, -8226, -16609, 32767, -32768, 28960, -6992, -17680, 32767, -32768,
+    28284, -6109, -18413, 32767, -32768, 27854, -5584, -18819, 32767, -32768, 27681, -5418, -18903, 32767, -32768, 27769,
+    -5611, -18666, 32767, -32768, 28117, -6164, -18106, 32767, -32768, 28715, -7073, -17213, 32767, -32768, 29546, -8334,
+    -15978, 32767, -32768, 30585, -9938, -14386, 32767, -32768, 31798, -11874, -12423, 32127, -32768, 32767, -14119, -10074,
+    30563, -32768, 32767, -16646, -7332, 28625, -32768, 32767, -19413, -4192, 26265, -32768, 32767, -22366, -662, 23439,
+    -32768, 32767, -25432, 3235, 20110, -32768, 32767, -28522, 7458, 16250, -32768, 32767, -31523, 11944, 11854, -31447,
+    32767, -32768, 16601, 6937, -28023, 32767, -32768, 21309, 1545, -23847, 32767, -32768, 25913, -4236, -18902, 32767,
+    -32768, 30228, -10280, -13210, 32128, -32768, 32767, -16413, -6840, 27734, -32768, 32767, -22413, 78, 22272, -32768,
+    32767, -28013, 7351, 15791, -32768, 32767, -32768, 14717, 8419, -28709, 32767, -32768, 21848, 368, -22449, 32767,
+    -32768, 28356, -8054, -14915, 32767, -32768, 32767, -16447, -6344, 27029, -32768, 32767, -24330, 2903, 19465, -32768,
+    32767, -31159, 12341, 10492, -29894, 32767, -32768, 21373, 540, -22266, 32767, -32768, 29324, -9798, -12870, 31389,
+    -32768, 32767, -19789, -2227, 23519, -32768, 32767, -28601, 8934, 13557, -31738, 32767, -32768, 19711, 2156, -23332,
+    32767, -32768, 29093, -9780, -12585, 31000, -32768, 32767, -21146, -329, 21689, -32768, 32767, -30730, 12305, 9910,
+    -29055, 32767, -32768, 23974, -3254, -18451, 32767, -32768, 32767, -16396, -5452, 25628, -32768, 32767, -27911, 8536,
+    13408, -31291, 32767, -32768, 21785, -835, -20353, 32767, -32768, 32440, -15305, -6382, 26157, -32768, 32767, -27945,
+    8824, 12896, -30794, 32767, -32768, 23051, -2610, -18586, 32767, -32768, 32767, -18041, -3148, 23408, -32768, 32767,
+    -30821, 13142, 8329, -27380, 32767, -32768, 27481, -8521, -12873, 30564, -32768, 32767, -24150, 4298, 16766, -32768,
+    32767, -32768, 20978, -549, -20023, 32767, -32768, 32767, -18081, -2683, 22682, -32768, 32767, -32147, 15543, 5380,
+    -24793, 32767, -32768, 30686, -13422, -7539, 26407, -32768, 32767, -29474, 11759, 9167, -27571, 32767, -32768, 28568,
+    -10579, -10275, 28326, -32768, 32767, -28007, 9897, 10872, -28699, 32767, -32768, 27814, -9719, -10964, 28705, -32768,
+    32767, -27995, 10049, 10552, -28344, 32767, -32768, 28544, -10882, -9633, 27603, -32768, 32767, -29439, 12209, 8197,
+    -26452, 32767, -32768, 30641, -14013, -6233, 24854, -32768, 32767, -32095, 16263, 3734, -22761, 32767, -32768, 32767,
+    -18917, -696, 20120, -32768, 32767, -32768, 21906, -2867, -16883, 32369, -32768, 32767, -25139, 6923, 13012, -29686,
+    32767, -32768, 28491, -11409, -8489, 26273, -32768, 32767, -31798, 16223, 3329, -22051, 32767, -32768, 32767, -21216,
+    2411, 16968, -32210, 32767, -32768, 26182, -8613, -11023, 27990, -32768, 32767, -30860, 15089, 4281, -22615, 32767,
+    -32768, 32767, -21574, 3110, 16079, -31452, 32767, -32768, 27719, -10898, -8470, 25840, -32768, 32767, -32768, 18724,
+    0, -18711, 32767, -32768, 32767, -26116, 8981, 10211, -27041, 32767, -32768, 32507, -17972, -657, 19123, -32768,
+    32767, -32768, 26333, -9444, -9567, 26406, -32768, 32767, -32768, 19395, -1141, -17355, 31963, -32768, 32767, -28334,
+    12265, 6511, -23832, 32767, -32768, 32767, -22844, 5379, 13254, -28970, 32767, -32768, 31754, -17266, -964, 18971,
+    -32768, 32767, -32768, 27870, -11921, -6580, 23655, -32768, 32767, -32768, 23965, -7031, -11386, 27371, -32768, 32767,
+    -32768, 20281, -2741, -15363, 30226, -32768, 32767, -31329, 16997, 869, -18541, 32346, -32768, 32767, -29307, 14234,
+    3764, -20974, 32767, -32768, 32767, -27628, 12071, 5937, -22722, 32767, -32768, 32767, -26389, 10557, 7393, -23840,
+    32767, -32768, 32767, -25654, 9719, 8143, -24369, 32767, -32768, 32767, -25456, 9569, 8195, -24330, 32767, -32768,
+    32767, -25806, 10110, 7548, -23722, 32767, -32768, 32767, -26687, 11332, 6198, -22520, 32767, -32768, 32767, -28057,
+    13218, 4132, -20682, 32767, -32768, 32767, -29844, 15728, 1344, -18150, 31530, -32768, 32767, -31940, 18798, -2161,
+    -14865, 29115, -32768, 32767, -32768, 22327, -6354, -10775, 25911, -32768, 32767, -32768, 26161, -11162, -5856, 21797,
+    -32768, 32767, -32768, 30089, -16452, -133, 16680, -30225, 32767, -32768, 32767, -22013, 6298, 10522, -25465, 32767,
+    -32768, 32767, -27540, 13238, 3373, -19381, 31989, -32768, 32767, -32627, 20370, -4595, -11963, 26441, -32768, 32767,
+    -32768, 27240, -13055, -3349, 19168, -31710, 32767, -32768, 32767, -21505, 6131, 10264, -24919, 32767, -32768, 32767,
+    -29262, 15921, 59, -16016, 29302, -32768, 32767, -32768, 25235, -10837, -5327, 20605, -32499, 32767, -32768, 32767,
+    -21518, 6475, 9603, -24115, 32767, -32768, 32767, -30815, 18350, -2961, -12888, 26669, -32768, 32767, -32768, 28926,
+    -15886, 353, 15222, -28393, 32767, -32768, 32767, -27572, 14221, 1328, -16657, 29395, -32768, 32767, -32768, 26851,
+    -13408, -2078, 17232, -29744, 32767, -32768, 32767, -26812, 13467, 1899, -16965, 29467, -32768, 32767, -32768, 27456,
+    -14397, -791, 15848, -28543, 32767, -32768, 32767, -28741, 16174, -1248, -13847, 26907, -32768, 32767, -32768, 30575,
+    -18739, 4209, 10914, -24455, 32767, -32768, 32767, -32768, 21992, -8060, -7003, 21061, -32128, 32767, -32768, 32767,
+    -25767, 12720, 2094, -16601, 28784, -32768, 32767, -32768, 29813, -18029, 3774, 10985, -24225, 32767, -32768, 32767,
+    -32768, 23720, -10462, -4199, 18280, -29884, 32767, -32768, 32767, -29388, 17686, -3639, -10879, 23939, -32768, 32767,
+    -32768, 32767, -24983, 12226, 2120, -16174, 28108, -32768, 32767, -32768, 31689, -21023, 7659, 6676, -20142, 31015,
+    -32768, 32767, -32768, 29229, -17814, 4158, 10011, -22904, 32767, -32768, 32767, -32768, 27375, -15547, 1800, 12156,
+    -24596, 32767, -32768, 32767, -32768, 26301, -14325, 614, 13159, -25319, 32767, -32768, 32767, -32768, 26095, -14193,
+    603, 13045, -25124, 32767, -32768, 32767, -32768, 26775, -15156, 1769, 11812, -23997, 32767, -32768, 32767, -32768,
+    28284, -17180, 4106, 9427, -21864, 31783, -32768, 32767, -32768, 30492, -20175, 7587, 5844, -18604, 29259, -32768,
+    32767, -32768, 32767, -23979, 12136, 1037, -14082, 25562, -32768, 32767, -32768, 32767, -28313, 17583, -4955, -8197,
+    20448, -30481, 32767, -32768, 32767, -32755, 23611, -11964, -942, 13735, -25061, 32767, -32768, 32767, -32768, 29708,
+    -19622, 7502, 5383, -17697, 28166, -32768, 32767, -32768, 32767, -27298, 16687, -4389, -8342, 20213, -30027, 32767,
+    -32768, 32767, -32768, 25812, -14996, 2699, 9852, -21414, 30845, -32768, 32767, -32768, 32767, -25402, 14635, -2456,
+    -9948, 21374, -30722, 32767, -32768, 32767, -32768, 26105, -15620, 3662, 8630, -20091, 29642, -32768, 32767, -32768,
+    32767, -27855, 17905, -6303, -5869, 17485, -27475, 32767, -32768, 32767, -32768, 30469, -21361, 10327, 1629, -13424,
+    23997, -32401, 32767, -32768, 32767, -32768, 25736, -15589, 4077, 7781, -18941, 28427, -32768, 32767, -32768, 32767,
+    -30595, 21783, -11103, -519, 12082, -22598, 31171, -32768, 32767, -32768, 32767, -28350, 19063, -8188, -3360, 14613,
+    -24635, 32598, -32768, 32767, -32768, 32767, -27224, 17815, -6964, -4441, 15472, -25235, 32767, -32768, 32767, -32768,
+    32767, -27364, 18130, -7467, -3774, 14702, -24459, 32281, -32768, 32767, -32768, 32767, -28753, 19984, -9683, -1350,
+    12265, -22227, 30479, -32768, 32767, -32768, 32767, -31204, 23236, -13536, 2835, 8063, -18347, 27256, -32768, 32767,
+    -32768, 32767, -32768, 27571, -18820, 8713, 2012, -12578, 22223, -30258, 32767, -32768, 32767, -32768, 32422, -25104,
+    16024, -5830, -4760, 15003, -24185, 31672, -32768, 32767, -32768, 32767, -31605, 24167, -15089, 4997, 5421, -15457,
+    24437, -31759, 32767, -32768, 32767, -32768, 32046, -24880, 16082, -6237, -4004, 13969, -23008, 30537, -32768, 32767,
+    -32768, 32767, -32768, 27154, -18931, 9514, 492, -10454, 19742, -27775, 32767, -32768, 32767, -32768, 32767, -30660,
+    23389, -14691, 5104, 4780, -14359, 23052, -30336, 32767, -32768, 32767, -32768, 32767, -28928, 21393, -12603, 3083,
+    6605, -15891, 24234, -31153, 32767, -32768, 32767, -32768, 32767, -28828, 21431, -12825, 3505, 6000, -15153, 23439,
+    -30400, 32767, -32768, 32767, -32768, 32767, -30382, 23499, -15342, 6361, 2953, -12092, 20564, -27916, 32767, -32768,
+    32767, -32768, 32767, -32768, 27320, -19954, 11555, -2566, -6543, 15298, -23248, 29988, -32768, 32767, -32768, 32767,
+    -32768, 32235, -26143, 18747, -10425, 1595, 7300, -15819, 23542, -30093, 32767, -32768, 32767, -32768, 32767, -32768,
+    27087, -20032, 12029, -3467, -5247, 13698, -21488, 28255, -32768, 32767, -32768, 32767, -32768, 32767, -29965, 23644,
+    -16254, 8137, 335, -8778, 16812, -24078, 30254, -32768, 32767, -32768, 32767, -32768, 32767, -29014, 22673, -15360,
+    7396, 872, -9089, 16904, -23984, 30034, -32768, 32767, -32768, 32767, -32768, 32767, -30263, 24354, -17454, 9851,
+    -1859, -6194, 13982, -21192, 27535, -32762, 32767, -32768, 32767, -32768, 32767, -32768, 28366, -22277, 15334, -7811,
+};
+static const uint16_t WAKE_FEATURES_5[] = {
+    665, 609, 670, 613, 668, 610, 663, 600, 656, 600, 657, 603, 659, 603, 657, 600, 655, 599, 653, 598, 653, 597, 648, 592, 641, 591, 643, 590, 642, 588, 639, 587, 633, 585, 629, 580, 627, 580, 624, 577,
+    0, 0, 0, 0, 482, 543, 656, 609, 668, 604, 645, 518, 432, 0, 366, 461, 602, 570, 637, 584, 642, 584, 633, 567, 637, 585, 644, 587, 641, 575, 606, 546, 612, 561, 626, 575, 630, 573, 630, 574,
+    0, 0, 0, 0, 0, 0, 0, 0, 417, 537, 657, 608, 666, 595, 604, 311, 203, 0, 0, 0, 0, 258, 596, 580, 641, 581, 623, 519, 471, 495, 625, 583, 643, 583, 628, 533, 578, 524, 592, 552,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 557, 594, 666, 611, 649, 460, 236, 0, 266, 0, 455, 0, 349, 0, 494, 545, 639, 588, 630, 487, 494, 430, 563, 560, 635, 580, 621, 497,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 520, 658, 609, 656, 512, 385, 177, 455, 133, 372, 0, 334, 0, 0, 0, 550, 569, 635, 564, 559, 336, 470, 133, 541, 564,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 391, 641, 607, 658, 540, 287, 0, 0, 0, 287, 0, 266, 0, 371, 0, 177, 456, 629, 581, 604, 473, 604, 548,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 266, 636, 609, 660, 507, 371, 0, 371, 0, 318, 0, 236, 0, 0, 372, 545, 485, 588, 570, 613, 359,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 645, 609, 644, 177, 0, 287, 516, 481, 570, 490, 508, 177, 364, 0, 392, 0, 545, 559,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 656, 608, 601, 351, 236, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 280, 564, 663, 593, 280, 0, 0, 0, 302, 0, 349, 0, 258, 0, 568, 532,
+    402, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 574, 598, 659, 427, 203, 0, 0, 0, 0, 280, 587, 542, 538, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 318, 641, 605, 582, 0, 236, 503, 599, 526, 483, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 562, 662, 570, 592, 466, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0, 613, 606, 611, 457, 504, 236, 203, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 351, 0, 0, 0, 0, 0, 0, 533, 656, 564, 0, 0, 489, 444, 506, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 266, 0, 397, 0, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 596, 596, 608, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 322, 0, 383, 361, 426, 236, 395, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 654, 535, 248, 361, 514, 406,
+    501, 459, 396, 248, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 607, 600, 545, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 280, 302, 411, 274, 423, 292, 297, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 562, 655, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 390, 258, 422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 628, 598, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 520, 579, 637, 0,
+    133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 318, 0, 0, 0, 0, 0, 0, 0, 0, 512, 646, 537,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 292, 0, 0, 0, 0, 0, 602, 599,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 567,
+};
+
+static const WakeClip WAKE_CLIPS[] = {
+    {"silence", WAKE_PCM_0, 8000, WAKE_FEATURES_0, 24},
+    {"noise", WAKE_PCM_1, 8000, WAKE_FEATURES_1, 24},
+    {"tones", WAKE_PCM_2, 8000, WAKE_FEATURES_2, 24},
+    {"sweep", WAKE_PCM_3, 8000, WAKE_FEATURES_3, 24},
+    {"bursts", WAKE_PCM_4, 8000, WAKE_FEATURES_4, 24},
+    {"clipped", WAKE_PCM_5, 8000, WAKE_FEATURES_5, 24},
+};
@@ -0,0 +1,322 @@
+/**
+ * @file test_main.cpp
+ * @brief WalkieAudio: ADPCM em pacotes e jitter buffer num enlace simulado
+ *
+ * Um WalkieAudio transmite (sendFrame a cada 25 ms) e outro recebe; no
+ * meio, um enlace determinístico que perde, duplica e atrasa pacotes (o
+ * atraso variável reordena). O motor de áudio é simulado puxando blocos de
+ * AUDIO_ENGINE_BLOCK a cada 16 ms, como no device. MeshSystem.sendAudio e
+ * audioDriver.playSource são costuras definidas aqui: o teste não precisa
+ * de rádio nem de I2S.
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "hardware/ima_adpcm.cpp"
+#include "wifi/walkie_audio.cpp"
+
+void setUp() {}
+void tearDown() {}
+
+#define FRAME_MS (WALKIE_FRAME * 1000 / WALKIE_RATE)
+#define BLOCK_MS (AUDIO_ENGINE_BLOCK * 1000 / WALKIE_RATE)
+#define PACKETS 120 // 3 s de fala
+
+static const uint8_t TALKER[6] = {0x24, 0x0A, 0xC4, 0x01, 0x02, 0x03};
+
+// ═══════════════════════════════════════════════════════════════════════════
+// ENLACE SIMULADO
+// ═══════════════════════════════════════════════════════════════════════════
+
+struct LinkConfig {
+  uint8_t lossPct;  // Perda (nunca os dois primeiros nem o último)
+  uint8_t dupPct;   // Cópia extra, até dupMs depois
+  uint8_t jitterMs; // Atraso uniforme em [0, jitterMs]: reordena
+  uint8_t dupMs;
+};
+
+struct InFlight {
+  uint32_t arriveMs;
+  uint32_t order; // Desempate estável
+  std::vector<uint8_t> bytes;
+};
+
+struct Link {
+  LinkConfig cfg;
+  uint32_t seed = 2024;
+  uint32_t order = 0;
+  uint32_t lost = 0, duplicated = 0;
+  size_t bytes = 0; // Payload de áudio transmitido
+  std::vector<InFlight> flight;
+  std::vector<MeshAudioPayload> sent; // Na ordem de envio (referência)
+
+  uint32_t rnd(uint32_t n) {
+    seed = seed * 1664525u + 1013904223u;
+    return (seed >> 8) % n;
+  }
+
+  void push(const MeshAudioPayload *p, size_t len) {
+    MeshAudioPayload copy = {};
+    memcpy(&copy, p, len);
+    sent.push_back(copy);
+    bytes += len;
+
+    uint16_t seq = p->sequence;
+    bool edge = seq < 2 || seq == PACKETS - 1;
+    if (!edge && rnd(100) < cfg.lossPct) {
+      lost++;
+      return;
+    }
+    uint32_t now = millis();
+    std::vector<uint8_t> pkt((const uint8_t *)p, (const uint8_t *)p + len);
+    uint32_t delay = cfg.jitterMs ? rnd(cfg.jitterMs + 1) : 0;
+    flight.push_back({now + delay, order++, pkt});
+    if (rnd(100) < cfg.dupPct) {
+      duplicated++;
+      flight.push_back({now + delay + rnd(cfg.dupMs + 1u), order++, pkt});
+    }
+  }
+
+  // Entrega o que já chegou, na ordem de chegada
+  void deliver(WalkieAudio &rx) {
+    std::stable_sort(flight.begin(), flight.end(),
+                     [](const InFlight &a, const InFlight &b) {
+                       return a.arriveMs != b.arriveMs
+                                  ? a.arriveMs < b.arriveMs
+                                  : a.order < b.order;
+                     });
+    size_t n = 0;
+    while (n < flight.size() && flight[n].arriveMs <= millis()) {
+      rx.receive(TALKER, flight[n].bytes.data(), flight[n].bytes.size());
+      n++;
+    }
+    flight.erase(flight.begin(), flight.begin() + n);
+  }
+};
+
+static Link *s_link = nullptr;
+static AudioSource *s_playing = nullptr;
+
+// ─── Costuras de link (rádio e motor do device) ────────────────────────────
+
+EspNowMesh MeshSystem;
+EspNowMesh::EspNowMesh() {}
+EspNowMesh::~EspNowMesh() {}
+bool EspNowMesh::sendAudio(const MeshAudioPayload *audio, size_t len) {
+  if (!audio || len < MESH_AUDIO_HEADER_LEN || len > sizeof(MeshAudioPayload))
+    return false;
+  s_link->push(audio, len);
+  return true;
+}
+
+AudioDriver audioDriver;
+AudioDriver::AudioDriver() {}
+bool AudioDriver::playSource(AudioSource *source, uint32_t rate,
+                             uint8_t priority) {
+  (void)priority;
+  TEST_ASSERT_EQUAL_UINT32(WALKIE_RATE, rate);
+  s_playing = source;
+  return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// FALA
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Dois tons, como voz sustentada; amostra n do sinal inteiro
+static int16_t speech(size_t n) {
+  float t = (float)n / WALKIE_RATE;
+  return (int16_t)(6000.0f * sinf(2.0f * (float)M_PI * 300.0f * t) +
+                   3000.0f * sinf(2.0f * (float)M_PI * 1100.0f * t));
+}
+
+struct TalkResult {
+  std::vector<int16_t> out;
+  WalkieStats tx, rx;
+  uint32_t linkLost, linkDuplicated;
+  size_t linkBytes;
+  std::vector<int16_t> reference; // Decodificação contínua do que saiu
+};
+
+// Transmite PACKETS quadros e toca até o receptor encerrar a fala
+static void talk(const LinkConfig &cfg, TalkResult *r) {
+  Link link;
+  link.cfg = cfg;
+  s_link = &link;
+  s_playing = nullptr;
+
+  WalkieAudio tx, rx;
+  TEST_ASSERT_TRUE(rx.begin());
+  tx.startTalking();
+
+  int16_t frame[WALKIE_FRAME];
+  int16_t block[AUDIO_ENGINE_BLOCK];
+  int sentFrames = 0;
+  bool done = false;
+  for (uint32_t t = 0; !done && t < 20000; t++) {
+    if (t % FRAME_MS == 0 && sentFrames < PACKETS) {
+      for (int i = 0; i < WALKIE_FRAME; i++)
+        frame[i] = speech((size_t)sentFrames * WALKIE_FRAME + i);
+      TEST_ASSERT_TRUE(tx.sendFrame(frame, WALKIE_FRAME));
+      sentFrames++;
+    }
+    link.deliver(rx);
+    if (s_playing && t % BLOCK_MS == 0) {
+      size_t n = s_playing->read(block, AUDIO_ENGINE_BLOCK);
+      r->out.insert(r->out.end(), block, block + n);
+      if (n < AUDIO_ENGINE_BLOCK) {
+        // Fim da fala: o motor solta a fonte
+        s_playing->close();
+        s_playing = nullptr;
+        done = sentFrames == PACKETS;
+      }
+    }
+    host::advanceMs(1);
+  }
+  TEST_ASSERT_TRUE_MESSAGE(done, "fala não terminou");
+  TEST_ASSERT_FALSE(rx.isReceiving());
+
+  // Referência: um decodificador só, do primeiro ao último pacote
+  ImaAdpcmState st;
+  imaAdpcmReset(st);
+  r->reference.resize((size_t)PACKETS * WALKIE_FRAME);
+  for (int k = 0; k < PACKETS; k++)
+    imaAdpcmDecode(st, link.sent[k].data, link.sent[k].samples,
+                   &r->reference[(size_t)k * WALKIE_FRAME]);
+
+  r->tx = tx.getStats();
+  r->rx = rx.getStats();
+  r->linkLost = link.lost;
+  r->linkDuplicated = link.duplicated;
+  r->linkBytes = link.bytes;
+  s_link = nullptr;
+}
+
+// Início do áudio: primeira amostra não nula (o sinal começa em 0)
+static size_t firstAudio(const std::vector<int16_t> &out) {
+  size_t i = 0;
+  while (i < out.size() && out[i] == 0)
+    i++;
+  return i;
+}
+
+// Saída = silêncio de acúmulo + decodificação contínua + silêncio final
+static void assertPlaysReference(const TalkResult &r) {
+  size_t lead = firstAudio(r.out);
+  size_t refLead = firstAudio(r.reference);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(refLead, lead);
+  size_t start = lead - refLead;
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(start + r.reference.size(),
+                                      r.out.size());
+  TEST_ASSERT_EQUAL_INT16_ARRAY(r.reference.data(), &r.out[start],
+                                r.reference.size());
+  for (size_t i = start + r.reference.size(); i < r.out.size(); i++)
+    TEST_ASSERT_EQUAL_INT16(0, r.out[i]);
+}
+
+static void report(const char *name, const TalkResult &r) {
+  char msg[192];
+  snprintf(msg, sizeof(msg),
+           "%s: enlace -%u/+%u; tocados %u, perdidos %u, atrasados %u, "
+           "repetidos %u, ocultados %u, underruns %u, pulados %u, alvo %u",
+           name, (unsigned)r.linkLost, (unsigned)r.linkDuplicated,
+           (unsigned)r.rx.played, (unsigned)r.rx.lost, (unsigned)r.rx.late,
+           (unsigned)r.rx.duplicates, (unsigned)r.rx.concealed,
+           (unsigned)r.rx.underruns, (unsigned)r.rx.skipped,
+           (unsigned)r.rx.target);
+  TEST_MESSAGE(msg);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTES
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Enlace limpo: tudo tocado, nada ocultado. Cada pacote decodificado só
+// com o próprio cabeçalho sai igual à decodificação contínua
+void test_clean_link() {
+  static TalkResult r;
+  r = TalkResult();
+  talk({0, 0, 0, 0}, &r);
+  report("limpo", r);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.tx.sent);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.received);
+  // 4 bits por amostra
+  TEST_ASSERT_EQUAL_UINT32(PACKETS * (MESH_AUDIO_HEADER_LEN + WALKIE_FRAME / 2),
+                           r.linkBytes);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.played);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.lost);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.late);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.concealed);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.skipped);
+  assertPlaysReference(r);
+}
+
+// Cópias chegando depois: descartadas, o áudio sai igual
+void test_duplicates_dropped() {
+  static TalkResult r;
+  r = TalkResult();
+  talk({0, 25, 0, 40}, &r);
+  report("duplicados", r);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, r.linkDuplicated);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS + r.linkDuplicated, r.rx.received);
+  // Cópia com o original ainda no anel = repetida; depois dele = atrasada
+  TEST_ASSERT_EQUAL_UINT32(r.linkDuplicated, r.rx.duplicates + r.rx.late);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.played);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.lost);
+  assertPlaysReference(r);
+}
+
+// Atraso variável maior que um quadro: reordena sem perder nada. Pacote
+// dado como perdido e que chega depois conta como atrasado
+void test_reorder_absorbed() {
+  static TalkResult r;
+  r = TalkResult();
+  talk({0, 0, 60, 0}, &r);
+  report("reordenado", r);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.received);
+  TEST_ASSERT_EQUAL_UINT32(r.rx.lost, r.rx.late);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.played + r.rx.lost + r.rx.skipped);
+  // O alvo sobe com os underruns e segura o jitter
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(PACKETS / 20, r.rx.lost);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT8(WALKIE_TARGET_MAX, r.rx.target);
+}
+
+// Perda sem jitter: cada buraco vira um pacote ocultado
+void test_loss_concealed() {
+  static TalkResult r;
+  r = TalkResult();
+  talk({10, 0, 0, 0}, &r);
+  report("perda", r);
+  TEST_ASSERT_GREATER_THAN_UINT32(0, r.linkLost);
+  TEST_ASSERT_EQUAL_UINT32(r.linkLost, r.rx.lost);
+  TEST_ASSERT_EQUAL_UINT32(r.rx.lost, r.rx.concealed);
+  TEST_ASSERT_EQUAL_UINT32(0, r.rx.late);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS - r.linkLost,
+                           r.rx.played + r.rx.skipped);
+}
+
+// Tudo junto: cada sequência contada uma vez (tocada, perdida ou pulada)
+void test_lossy_jittery_link() {
+  static TalkResult r;
+  r = TalkResult();
+  talk({5, 5, 60, 40}, &r);
+  report("misto", r);
+  TEST_ASSERT_EQUAL_UINT32(PACKETS, r.rx.played + r.rx.lost + r.rx.skipped);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT32(r.linkLost, r.rx.lost);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT32(PACKETS - r.linkLost, r.rx.played);
+  TEST_ASSERT_EQUAL_UINT32(r.rx.lost, r.rx.concealed);
+  TEST_ASSERT_LESS_OR_EQUAL_UINT8(WALKIE_TARGET_MAX, r.rx.target);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_clean_link);
+  RUN_TEST(test_duplicates_dropped);
+  RUN_TEST(test_reorder_absorbed);
+  RUN_TEST(test_loss_concealed);
+  RUN_TEST(test_lossy_jittery_link);
+  return UNITY_END();
+}